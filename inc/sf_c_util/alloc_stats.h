@@ -0,0 +1,109 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef ALLOC_STATS_H
+#define ALLOC_STATS_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_pal/interlocked.h"
+
+#include "umock_c/umock_c_prod.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* number of distinct functions tracked per module, anything beyond that is counted in other_functions */
+#define ALLOC_STATS_FUNCTION_SLOT_COUNT 32
+
+/* function_name reported for the allocations counted in other_functions */
+#define ALLOC_STATS_OTHER_FUNCTIONS_NAME "(other)"
+
+typedef struct ALLOC_STATS_COUNTERS_TAG
+{
+    volatile_atomic int64_t allocation_count; /* malloc, malloc_2, malloc_flex, calloc and realloc of NULL */
+    volatile_atomic int64_t allocated_bytes;
+    volatile_atomic int64_t reallocation_count;
+    volatile_atomic int64_t reallocated_bytes;
+    volatile_atomic int64_t free_count;
+} ALLOC_STATS_COUNTERS;
+
+typedef struct ALLOC_STATS_FUNCTION_SLOT_TAG
+{
+    void* volatile_atomic function_name; /* NULL means free */
+    ALLOC_STATS_COUNTERS counters;
+} ALLOC_STATS_FUNCTION_SLOT;
+
+/* one instance of this is defined (statically) for each module of sf_c_util and for each instantiation of the async op wrappers when allocation stats are enabled */
+typedef struct ALLOC_STATS_TAG
+{
+    const char* module_name;
+    volatile_atomic int32_t registration_state;
+    struct ALLOC_STATS_TAG* next;
+    ALLOC_STATS_FUNCTION_SLOT functions[ALLOC_STATS_FUNCTION_SLOT_COUNT];
+    ALLOC_STATS_COUNTERS other_functions;
+} ALLOC_STATS;
+
+typedef struct ALLOC_STATS_SNAPSHOT_TAG
+{
+    const char* module_name;
+    const char* function_name;
+    uint64_t allocation_count;
+    uint64_t allocated_bytes;
+    uint64_t reallocation_count;
+    uint64_t reallocated_bytes;
+    uint64_t free_count;
+} ALLOC_STATS_SNAPSHOT;
+
+typedef void (*ALLOC_STATS_SNAPSHOT_CB)(void* context, const ALLOC_STATS_SNAPSHOT* snapshot);
+
+#define ALLOC_STATS_INITIALIZER(module_name) \
+    { MU_TOSTRING(module_name) }
+
+    MOCKABLE_FUNCTION(, void*, alloc_stats_malloc, ALLOC_STATS*, stats, const char*, function_name, size_t, size);
+    MOCKABLE_FUNCTION(, void*, alloc_stats_malloc_2, ALLOC_STATS*, stats, const char*, function_name, size_t, nmemb, size_t, size);
+    MOCKABLE_FUNCTION(, void*, alloc_stats_malloc_flex, ALLOC_STATS*, stats, const char*, function_name, size_t, base, size_t, nmemb, size_t, size);
+    MOCKABLE_FUNCTION(, void*, alloc_stats_calloc, ALLOC_STATS*, stats, const char*, function_name, size_t, nmemb, size_t, size);
+    MOCKABLE_FUNCTION(, void*, alloc_stats_realloc, ALLOC_STATS*, stats, const char*, function_name, void*, ptr, size_t, size);
+    MOCKABLE_FUNCTION(, void*, alloc_stats_realloc_2, ALLOC_STATS*, stats, const char*, function_name, void*, ptr, size_t, nmemb, size_t, size);
+    MOCKABLE_FUNCTION(, void*, alloc_stats_realloc_flex, ALLOC_STATS*, stats, const char*, function_name, void*, ptr, size_t, base, size_t, nmemb, size_t, size);
+    MOCKABLE_FUNCTION(, void, alloc_stats_free, ALLOC_STATS*, stats, const char*, function_name, void*, ptr);
+
+    MOCKABLE_FUNCTION(, int, alloc_stats_snapshot, ALLOC_STATS_SNAPSHOT_CB, on_snapshot, void*, on_snapshot_context);
+    MOCKABLE_FUNCTION(, int, alloc_stats_get_totals, const char*, module_name, const char*, function_name, ALLOC_STATS_SNAPSHOT*, totals);
+
+/* the hooks below are used by fabric_async_op_wrapper.h and by alloc_stats_redirect.h. They count the allocations of the calling function in stats_name when SF_C_UTIL_ALLOC_STATS is defined and are plain malloc/free otherwise */
+#ifdef SF_C_UTIL_ALLOC_STATS
+
+#define ALLOC_STATS_DEFINE(stats_name, module_name) \
+    static ALLOC_STATS stats_name = ALLOC_STATS_INITIALIZER(module_name);
+
+#define ALLOC_STATS_MALLOC(stats_name, size) \
+    alloc_stats_malloc(&stats_name, __func__, size)
+
+#define ALLOC_STATS_FREE(stats_name, ptr) \
+    alloc_stats_free(&stats_name, __func__, ptr)
+
+#else
+
+#define ALLOC_STATS_DEFINE(stats_name, module_name)
+#define ALLOC_STATS_MALLOC(stats_name, size) malloc(size)
+#define ALLOC_STATS_FREE(stats_name, ptr) free(ptr)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ALLOC_STATS_H */
@@ -0,0 +1,46 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+/* included by the sources of sf_c_util after all other headers (in particular after c_pal/gballoc_hl_redirect.h), followed by ALLOC_STATS_DEFINE_MODULE(module_name).
+When SF_C_UTIL_ALLOC_STATS is defined, every allocation of the source is counted per module and calling function, otherwise this header changes nothing */
+
+#ifndef ALLOC_STATS_REDIRECT_H
+#define ALLOC_STATS_REDIRECT_H
+
+#include "sf_c_util/alloc_stats.h"
+
+#ifdef SF_C_UTIL_ALLOC_STATS
+
+#define ALLOC_STATS_DEFINE_MODULE(module_name) ALLOC_STATS_DEFINE(alloc_stats_module, module_name)
+
+#undef malloc
+#define malloc(size) alloc_stats_malloc(&alloc_stats_module, __func__, size)
+
+#undef malloc_2
+#define malloc_2(nmemb, size) alloc_stats_malloc_2(&alloc_stats_module, __func__, nmemb, size)
+
+#undef malloc_flex
+#define malloc_flex(base, nmemb, size) alloc_stats_malloc_flex(&alloc_stats_module, __func__, base, nmemb, size)
+
+#undef calloc
+#define calloc(nmemb, size) alloc_stats_calloc(&alloc_stats_module, __func__, nmemb, size)
+
+#undef realloc
+#define realloc(ptr, size) alloc_stats_realloc(&alloc_stats_module, __func__, ptr, size)
+
+#undef realloc_2
+#define realloc_2(ptr, nmemb, size) alloc_stats_realloc_2(&alloc_stats_module, __func__, ptr, nmemb, size)
+
+#undef realloc_flex
+#define realloc_flex(ptr, base, nmemb, size) alloc_stats_realloc_flex(&alloc_stats_module, __func__, ptr, base, nmemb, size)
+
+#undef free
+#define free(ptr) alloc_stats_free(&alloc_stats_module, __func__, ptr)
+
+#else
+
+#define ALLOC_STATS_DEFINE_MODULE(module_name)
+
+#endif
+
+#endif /* ALLOC_STATS_REDIRECT_H */
@@ -31,6 +31,7 @@
 #include "com_wrapper/com_wrapper.h"
 #include "sf_c_util/fabric_async_op_cb.h"
 #include "sf_c_util/fabric_async_op_cb_com.h"
+#include "sf_c_util/fabric_op_stats.h"
 #include "sf_c_util/hresult_to_string.h"
 
 #include "umock_c/umock_c_prod.h"
@@ -167,12 +168,17 @@ extern "C" {
                 else \
                 { \
                     IFabricAsyncOperationContext* fabric_operation_context; \
+                    FABRIC_OP_STATS_DECLARE_START_TIME(start_time_us) \
+                    /* Codes_SRS_FABRIC_ASYNC_OP_SYNC_WRAPPER_01_021: [ If SF_C_UTIL_FABRIC_OP_STATS is defined, _execute shall call fabric_op_stats_record_begin before calling Begin{operation_name} and fabric_op_stats_record_end once the result of the operation is known. ]*/ \
+                    FABRIC_OP_STATS_BEGIN(MU_C4(interface_name, _, operation_name, _execute_stats), start_time_us) \
                     /* Codes_SRS_FABRIC_ASYNC_OP_SYNC_WRAPPER_01_006: [ _execute shall call Begin{operation_name} on com_object, passing as arguments the begin arguments and the async operation callback COM object. ]*/ \
                     result = com_object->lpVtbl->MU_C2(Begin, operation_name)(com_object BS2SF_ASYNC_OP_SYNC_EXTRACT_BEGIN_ARG_VALUES(__VA_ARGS__), callback, &fabric_operation_context); \
                     if (FAILED(result)) \
                     { \
                         /* Codes_SRS_FABRIC_ASYNC_OP_SYNC_WRAPPER_01_011: [ If Begin{operation_name} fails, _execute shall return the error returned by Begin{operation_name}. ]*/ \
                         LogHRESULTError(result, "com_object->lpVtbl->Begin" MU_TOSTRING(operation_name) " failed."); \
+                        /* Codes_SRS_FABRIC_ASYNC_OP_SYNC_WRAPPER_01_023: [ If SF_C_UTIL_FABRIC_OP_STATS is defined and Begin{operation_name} fails, _execute shall call fabric_op_stats_record_begin_failed with the error returned by Begin{operation_name} instead of fabric_op_stats_record_end. ]*/ \
+                        FABRIC_OP_STATS_BEGIN_FAILED(MU_C4(interface_name, _, operation_name, _execute_stats), result) \
                         /* return result as is */ \
                     } \
                     else \
@@ -186,12 +192,15 @@ extern "C" {
                                 /* Codes_SRS_FABRIC_ASYNC_OP_SYNC_WRAPPER_01_013: [ If any other error occurs, _execute shall fail and return E_FAIL. ]*/ \
                                 LogError("InterlockedHL_WaitForValue failed"); \
                                 result = E_FAIL; \
+                                /* Codes_SRS_FABRIC_ASYNC_OP_SYNC_WRAPPER_01_022: [ If SF_C_UTIL_FABRIC_OP_STATS is defined and waiting for the operation fails, _execute shall call fabric_op_stats_record_end with E_FAIL, marking the operation as completed asynchronously. ]*/ \
+                                FABRIC_OP_STATS_END(MU_C4(interface_name, _, operation_name, _execute_stats), start_time_us, false, result) \
                             } \
                         } \
                         if (!FAILED(result)) \
                         { \
                             /* Codes_SRS_FABRIC_ASYNC_OP_SYNC_WRAPPER_01_008: [ _execute shall call End{operation_name} on com_object. ]*/ \
                             result = com_object->lpVtbl->MU_C2(End, operation_name)(com_object, fabric_operation_context BS2SF_ASYNC_OP_SYNC_EXTRACT_END_ARG_VALUES(__VA_ARGS__)); \
+                            FABRIC_OP_STATS_END(MU_C4(interface_name, _, operation_name, _execute_stats), start_time_us, fabric_operation_context->lpVtbl->CompletedSynchronously(fabric_operation_context), result) \
                             if (FAILED(result)) \
                             { \
                                 /* Codes_SRS_FABRIC_ASYNC_OP_SYNC_WRAPPER_01_012: [ If End{operation_name} fails, _execute shall return the error returned by End{operation_name}. ]*/ \
@@ -245,6 +254,7 @@ extern "C" {
     } \
 
 #define DEFINE_FABRIC_ASYNC_OPERATION_SYNC(interface_name, operation_name, ...) \
+    FABRIC_OP_STATS_DEFINE(MU_C4(interface_name, _, operation_name, _execute_stats), interface_name, operation_name, execute) \
     BS2SF_ASYNC_OP_SYNC_IMPLEMENT_WRAPPER_CB(interface_name, operation_name, __VA_ARGS__) \
     BS2SF_ASYNC_OP_SYNC_IMPLEMENT_EXECUTE(interface_name, operation_name, __VA_ARGS__)
 
@@ -24,8 +24,10 @@
 #include "c_pal/gballoc_hl_redirect.h"
 
 #include "com_wrapper/com_wrapper.h"
+#include "sf_c_util/alloc_stats.h"
 #include "sf_c_util/fabric_async_op_cb.h"
 #include "sf_c_util/fabric_async_op_cb_com.h"
+#include "sf_c_util/fabric_op_stats.h"
 #include "sf_c_util/hresult_to_string.h"
 
 #include "umock_c/umock_c_prod.h"
@@ -155,7 +157,8 @@ extern "C" {
         { \
             bool callback_expected = false; \
             /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_006: [ _execute_async shall allocate a context used to store on_complete and on_complete_context. ]*/ \
-            MU_C4(interface_name, _, operation_name, _CONTEXT)* fabric_async_operation_wrapper_context = (MU_C4(interface_name, _, operation_name, _CONTEXT)*)malloc(sizeof(MU_C4(interface_name, _, operation_name, _CONTEXT))); \
+            /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_034: [ If SF_C_UTIL_ALLOC_STATS is defined, _execute_async and _wrapper_cb shall count the allocation and the free of the context with alloc_stats_malloc and alloc_stats_free, in the stats of the fabric_async_op_wrapper module. ]*/ \
+            MU_C4(interface_name, _, operation_name, _CONTEXT)* fabric_async_operation_wrapper_context = (MU_C4(interface_name, _, operation_name, _CONTEXT)*)ALLOC_STATS_MALLOC(MU_C4(interface_name, _, operation_name, _execute_async_alloc_stats), sizeof(MU_C4(interface_name, _, operation_name, _CONTEXT))); \
             if (fabric_async_operation_wrapper_context == NULL) \
             { \
                 /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_016: [ If any other error occurs, _execute_async shall fail and return E_FAIL. ]*/ \
@@ -192,12 +195,16 @@ extern "C" {
                         } \
                         else \
                         { \
+                            /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_032: [ If SF_C_UTIL_FABRIC_OP_STATS is defined, _execute_async shall call fabric_op_stats_record_begin before calling Begin{operation_name} and fabric_op_stats_record_end once the result of the operation is known. ]*/ \
+                            FABRIC_OP_STATS_BEGIN(MU_C4(interface_name, _, operation_name, _execute_async_stats), fabric_async_operation_wrapper_context->start_time_us) \
                             /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_009: [ _execute_async shall call Begin{operation_name} on com_object, passing as arguments the begin arguments and the async operation callback COM object. ]*/ \
                             result = com_object->lpVtbl->MU_C2(Begin, operation_name)(com_object BS2SF_ASYNC_OP_EXTRACT_BEGIN_ARG_VALUES(__VA_ARGS__), callback, &fabric_operation_context); \
                             if (FAILED(result)) \
                             { \
                                 /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_014: [ If Begin{operation_name} fails, _execute_async shall return the error returned by Begin{operation_name}. ]*/ \
                                 LogHRESULTError(result, "com_object->lpVtbl->Begin" MU_TOSTRING(operation_name) " failed."); \
+                                /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_035: [ If SF_C_UTIL_FABRIC_OP_STATS is defined and Begin{operation_name} fails, _execute_async shall call fabric_op_stats_record_begin_failed with the error returned by Begin{operation_name} instead of fabric_op_stats_record_end. ]*/ \
+                                FABRIC_OP_STATS_BEGIN_FAILED(MU_C4(interface_name, _, operation_name, _execute_async_stats), result) \
                                 /* return result as is */ \
                             } \
                             else \
@@ -208,6 +215,7 @@ extern "C" {
                                     /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_011: [ _execute_async shall call End{operation_name} on com_object. ]*/ \
                                     BS2SF_ASYNC_OP_EXTRACT_VARS_FOR_END_ARGS(__VA_ARGS__) \
                                     result = com_object->lpVtbl->MU_C2(End, operation_name)(com_object, fabric_operation_context BS2SF_ASYNC_OP_EXTRACT_ADDRESS_END_ARG_VALUES(__VA_ARGS__)); \
+                                    FABRIC_OP_STATS_END(MU_C4(interface_name, _, operation_name, _execute_async_stats), fabric_async_operation_wrapper_context->start_time_us, true, result) \
                                     if (FAILED(result)) \
                                     { \
                                         /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_015: [ If End{operation_name} fails, _execute_async shall return the error returned by End{operation_name}. ]*/ \
@@ -243,7 +251,7 @@ extern "C" {
                 if (!callback_expected) \
                 { \
                     /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_029: [ _execute_async shall free the context used to store on_complete and on_complete_context. ]*/ \
-                    free(fabric_async_operation_wrapper_context); \
+                    ALLOC_STATS_FREE(MU_C4(interface_name, _, operation_name, _execute_async_alloc_stats), fabric_async_operation_wrapper_context); \
                 } \
             } \
         } \
@@ -273,6 +281,8 @@ extern "C" {
                 MU_C4(interface_name, _, operation_name, _CONTEXT)* fabric_async_operation_wrapper_context = (MU_C4(interface_name, _, operation_name, _CONTEXT)*)context; \
                 /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_022: [ _wrapper_cb shall call End{operation_name} on the com_object passed to _execute_async. ]*/ \
                 HRESULT hr = fabric_async_operation_wrapper_context->com_object->lpVtbl->MU_C2(End, operation_name)(fabric_async_operation_wrapper_context->com_object, fabric_async_operation_context BS2SF_ASYNC_OP_EXTRACT_ADDRESS_END_ARG_VALUES(__VA_ARGS__)); \
+                /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_033: [ If SF_C_UTIL_FABRIC_OP_STATS is defined, _wrapper_cb shall call fabric_op_stats_record_end with the result of End{operation_name}, marking the operation as completed asynchronously. ]*/ \
+                FABRIC_OP_STATS_END(MU_C4(interface_name, _, operation_name, _execute_async_stats), fabric_async_operation_wrapper_context->start_time_us, false, hr) \
                 if (FAILED(hr)) \
                 { \
                     /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_024: [ If the End{operation_name} fails, _wrapper_cb shall call the on_complete and pass as arguments on_complete_context and the result of the End{operation_name} call. ]*/ \
@@ -288,17 +298,20 @@ extern "C" {
                 /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_030: [ _wrapper_cb shall release the com object passed as argument to _execute_async. ]*/ \
                 (void)fabric_async_operation_wrapper_context->com_object->lpVtbl->Release(fabric_async_operation_wrapper_context->com_object); \
                 /* Codes_SRS_FABRIC_ASYNC_OP_WRAPPER_01_031: [ _wrapper_cb shall free the context created in _execute_async. ]*/ \
-                free(context); \
+                ALLOC_STATS_FREE(MU_C4(interface_name, _, operation_name, _execute_async_alloc_stats), context); \
             } \
         } \
     } \
 
 #define DEFINE_FABRIC_ASYNC_OPERATION(interface_name, operation_name, ...) \
+    FABRIC_OP_STATS_DEFINE(MU_C4(interface_name, _, operation_name, _execute_async_stats), interface_name, operation_name, execute_async) \
+    ALLOC_STATS_DEFINE(MU_C4(interface_name, _, operation_name, _execute_async_alloc_stats), fabric_async_op_wrapper) \
     typedef struct MU_C4(interface_name, _, operation_name, _CONTEXT_TAG) \
     { \
         MU_C4(interface_name, _, operation_name, _COMPLETE_CB) on_complete; \
         void* on_complete_context; \
         interface_name* com_object; \
+        FABRIC_OP_STATS_DECLARE_START_TIME(start_time_us) \
     } MU_C4(interface_name, _, operation_name, _CONTEXT); \
     BS2SF_IMPLEMENT_WRAPPER_CB(interface_name, operation_name, __VA_ARGS__) \
     BS2SF_IMPLEMENT_EXECUTE_ASYNC(interface_name, operation_name, __VA_ARGS__)
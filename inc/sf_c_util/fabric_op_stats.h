@@ -0,0 +1,121 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef FABRIC_OP_STATS_H
+#define FABRIC_OP_STATS_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#include <stdbool.h>
+#endif
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_pal/interlocked.h"
+
+#include "umock_c/umock_c_prod.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* latencies are kept in log-linear buckets: values below 8us get one bucket each, every power of 2 above that is split in 4 buckets */
+#define FABRIC_OP_STATS_LATENCY_SUB_BUCKET_BITS 2
+#define FABRIC_OP_STATS_LATENCY_BUCKET_COUNT 128
+/* latency buckets are striped by thread id so that concurrent completions do not contend on the same cache lines */
+#define FABRIC_OP_STATS_LATENCY_STRIPE_COUNT 8
+/* number of distinct HRESULT values tracked per operation, anything beyond that is counted in other_hresult_count */
+#define FABRIC_OP_STATS_HRESULT_SLOT_COUNT 16
+
+typedef struct FABRIC_OP_STATS_HRESULT_SLOT_TAG
+{
+    volatile_atomic int64_t key; /* 0 means free, otherwise (1 << 32) | (uint32_t)hresult */
+    volatile_atomic int64_t count;
+} FABRIC_OP_STATS_HRESULT_SLOT;
+
+/* one instance of this is defined (statically) for each instantiation of the async op wrappers when stats are enabled */
+typedef struct FABRIC_OP_STATS_TAG
+{
+    const char* interface_name;
+    const char* operation_name;
+    const char* api_name;
+    volatile_atomic int32_t registration_state;
+    struct FABRIC_OP_STATS_TAG* next;
+    volatile_atomic int64_t call_count;
+    volatile_atomic int64_t begin_failed_count;
+    volatile_atomic int64_t completed_synchronously_count;
+    volatile_atomic int64_t completed_asynchronously_count;
+    volatile_atomic int64_t other_hresult_count;
+    FABRIC_OP_STATS_HRESULT_SLOT hresults[FABRIC_OP_STATS_HRESULT_SLOT_COUNT];
+    volatile_atomic int64_t latency_buckets[FABRIC_OP_STATS_LATENCY_STRIPE_COUNT][FABRIC_OP_STATS_LATENCY_BUCKET_COUNT];
+} FABRIC_OP_STATS;
+
+typedef struct FABRIC_OP_STATS_HRESULT_COUNT_TAG
+{
+    HRESULT hresult;
+    uint64_t count;
+} FABRIC_OP_STATS_HRESULT_COUNT;
+
+typedef struct FABRIC_OP_STATS_SNAPSHOT_TAG
+{
+    const char* interface_name;
+    const char* operation_name;
+    const char* api_name;
+    uint64_t call_count;
+    uint64_t begin_failed_count;
+    uint64_t completed_synchronously_count;
+    uint64_t completed_asynchronously_count;
+    uint64_t other_hresult_count;
+    uint32_t hresult_count;
+    FABRIC_OP_STATS_HRESULT_COUNT hresults[FABRIC_OP_STATS_HRESULT_SLOT_COUNT];
+    uint64_t latency_buckets[FABRIC_OP_STATS_LATENCY_BUCKET_COUNT];
+} FABRIC_OP_STATS_SNAPSHOT;
+
+typedef void (*FABRIC_OP_STATS_SNAPSHOT_CB)(void* context, const FABRIC_OP_STATS_SNAPSHOT* snapshot);
+
+#define FABRIC_OP_STATS_INITIALIZER(interface_name, operation_name, api_name) \
+    { MU_TOSTRING(interface_name), MU_TOSTRING(operation_name), MU_TOSTRING(api_name) }
+
+    MOCKABLE_FUNCTION(, double, fabric_op_stats_record_begin, FABRIC_OP_STATS*, stats);
+    MOCKABLE_FUNCTION(, void, fabric_op_stats_record_begin_failed, FABRIC_OP_STATS*, stats, HRESULT, result);
+    MOCKABLE_FUNCTION(, void, fabric_op_stats_record_end, FABRIC_OP_STATS*, stats, double, start_time_us, bool, completed_synchronously, HRESULT, result);
+    MOCKABLE_FUNCTION(, int, fabric_op_stats_snapshot, FABRIC_OP_STATS_SNAPSHOT_CB, on_snapshot, void*, on_snapshot_context);
+    MOCKABLE_FUNCTION(, uint64_t, fabric_op_stats_get_latency_percentile_us, const FABRIC_OP_STATS_SNAPSHOT*, snapshot, double, percentile);
+
+/* the hooks below are used by fabric_async_op_wrapper.h and fabric_async_op_sync_wrapper.h and expand to nothing unless SF_C_UTIL_FABRIC_OP_STATS is defined */
+#ifdef SF_C_UTIL_FABRIC_OP_STATS
+
+#define FABRIC_OP_STATS_DEFINE(stats_name, interface_name, operation_name, api_name) \
+    static FABRIC_OP_STATS stats_name = FABRIC_OP_STATS_INITIALIZER(interface_name, operation_name, api_name);
+
+#define FABRIC_OP_STATS_DECLARE_START_TIME(start_time_us) \
+    double start_time_us;
+
+#define FABRIC_OP_STATS_BEGIN(stats_name, start_time_us) \
+    start_time_us = fabric_op_stats_record_begin(&stats_name);
+
+#define FABRIC_OP_STATS_BEGIN_FAILED(stats_name, result) \
+    fabric_op_stats_record_begin_failed(&stats_name, result);
+
+#define FABRIC_OP_STATS_END(stats_name, start_time_us, completed_synchronously, result) \
+    fabric_op_stats_record_end(&stats_name, start_time_us, completed_synchronously, result);
+
+#else
+
+#define FABRIC_OP_STATS_DEFINE(stats_name, interface_name, operation_name, api_name)
+#define FABRIC_OP_STATS_DECLARE_START_TIME(start_time_us)
+#define FABRIC_OP_STATS_BEGIN(stats_name, start_time_us)
+#define FABRIC_OP_STATS_BEGIN_FAILED(stats_name, result)
+#define FABRIC_OP_STATS_END(stats_name, start_time_us, completed_synchronously, result)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FABRIC_OP_STATS_H */
@@ -19,7 +19,12 @@ extern "C" {
 
     typedef struct FABRIC_STRING_LIST_RESULT_TAG* FABRIC_STRING_LIST_RESULT_HANDLE;
 
+    /*copies strings: the result, the pointers and the characters of all the strings are one allocation*/
     MOCKABLE_FUNCTION(, FABRIC_STRING_LIST_RESULT_HANDLE, fabric_string_list_result_create, ULONG, nStrings, const wchar_t**, strings);
+
+    /*does not copy strings: the result takes ownership of buffer (which is freed with free when the result is destroyed) and strings (the pointers and the characters) has to stay valid until then,
+    usually because it lives in buffer. buffer can be NULL, in which case strings is only borrowed (string literals for example)*/
+    MOCKABLE_FUNCTION(, FABRIC_STRING_LIST_RESULT_HANDLE, fabric_string_list_result_create_move, ULONG, nStrings, const wchar_t**, strings, void*, buffer);
     MOCKABLE_FUNCTION(, void, fabric_string_list_result_destroy, FABRIC_STRING_LIST_RESULT_HANDLE, fabric_string_list_result);
     MOCKABLE_FUNCTION(, HRESULT, fabric_string_list_result_GetStrings, FABRIC_STRING_LIST_RESULT_HANDLE, fabric_string_list_result, ULONG*, nStrings, const LPCWSTR**, strings);
 
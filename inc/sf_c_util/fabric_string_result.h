@@ -20,7 +20,10 @@ extern "C" {
 
     typedef struct FABRIC_STRING_RESULT_TAG* FABRIC_STRING_RESULT_HANDLE;
 
+    typedef void (*FABRIC_STRING_RESULT_FREE_FUNC)(void* context);
+
     MOCKABLE_FUNCTION(, FABRIC_STRING_RESULT_HANDLE, fabric_string_result_create, const wchar_t*, result_string);
+    MOCKABLE_FUNCTION(, FABRIC_STRING_RESULT_HANDLE, fabric_string_result_create_with_custom_free, const wchar_t*, string_result, FABRIC_STRING_RESULT_FREE_FUNC, free_func, void*, free_func_context);
     MOCKABLE_FUNCTION(, void, fabric_string_result_destroy, FABRIC_STRING_RESULT_HANDLE, fabric_string_result);
     MOCKABLE_FUNCTION(, LPCWSTR, fabric_string_result_get_String, FABRIC_STRING_RESULT_HANDLE, fabric_string_result);
 
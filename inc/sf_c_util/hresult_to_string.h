@@ -40,22 +40,42 @@ extern "C" {
     in order will try to find the meaning of the HRESULT as follows:
     1) system (as defined in FORMAT_MESSAGE_FROM_SYSTEM)
     2) service fabric's code
-    3) every other loaded module
+    3) every other loaded module (only the modules whose message table has the HRESULT are asked)
 
     caller needs to dispose (call free()) of the string (note the missing "const" from the return value)
     */
     char* hresult_to_string(malloc_t the_malloc, free_t the_free, HRESULT hresult);
     wchar_t* hresult_to_wstring(HRESULT hresult);
 
+/*number of distinct HRESULTs whose strings hresult_to_string_interned keeps, the strings of the others are not interned*/
+#define HRESULT_TO_STRING_INTERNED_SLOT_BITS 8
+#define HRESULT_TO_STRING_INTERNED_SLOT_COUNT (1 << HRESULT_TO_STRING_INTERNED_SLOT_BITS)
+
+/*size of a buffer that fits the string of any HRESULT*/
+#define HRESULT_TO_STRING_BUFFER_SIZE 1000
+
+    /*will return the same string as hresult_to_string, without allocating any memory (other than the index of the message tables of the modules of the process, which is built once and again only when modules are loaded or unloaded).
+    The string of an HRESULT is kept the first time the HRESULT is seen (in static memory, until the process exits) and returned by every later call, without taking any lock.
+    When the string cannot be kept it is produced in buffer (of size characters) and buffer is returned.
+    will return NULL if it cannot determine the meaning (or it fails internally)
+    the returned string must not be free'd and it is valid until buffer goes away
+    */
+    const char* hresult_to_string_buffer(HRESULT hresult, char* buffer, size_t size);
+
+    /*will return the string kept by hresult_to_string_buffer (do not free it).
+    will return NULL if no module can provide the meaning of hresult, while another thread produces the string of hresult or if the string could not be kept
+    */
+    const char* hresult_to_string_interned(HRESULT hresult);
+
 /*the below macro is just like LogError, but it will print "HRESULT="some string" if the string exists*/
 #define LogHRESULTWithFormat(log_macro, hr, FORMAT, ...)                                                                                                                                              \
     do                                                                                                                                                                                          \
     {                                                                                                                                                                                           \
-        char* hresult_to_string_result = hresult_to_string(same_as_malloc, same_as_free, hr);                                                                                                   \
+        char hresult_to_string_local_buffer[HRESULT_TO_STRING_BUFFER_SIZE];                                                                                                                     \
+        const char* hresult_to_string_result = hresult_to_string_buffer(hr, hresult_to_string_local_buffer, sizeof(hresult_to_string_local_buffer));                                            \
         if (hresult_to_string_result != NULL)                                                                                                                                                   \
         {                                                                                                                                                                                       \
             log_macro(FORMAT " HRESULT=\"%s\"", __VA_ARGS__ MU_IFCOMMALOGIC(MU_COUNT_ARG(__VA_ARGS__)) hresult_to_string_result);                                                                \
-            same_as_free(hresult_to_string_result);                                                                                                                                             \
         }                                                                                                                                                                                       \
         else                                                                                                                                                                                    \
         {                                                                                                                                                                                       \
@@ -67,11 +87,11 @@ extern "C" {
 #define LogHRESULTWithoutFormat(log_macro, hr)                                                                                                                                    \
     do                                                                                                                                                                          \
     {                                                                                                                                                                           \
-        char* hresult_to_string_result = hresult_to_string(same_as_malloc, same_as_free, hr);                                                                                   \
+        char hresult_to_string_local_buffer[HRESULT_TO_STRING_BUFFER_SIZE];                                                                                                     \
+        const char* hresult_to_string_result = hresult_to_string_buffer(hr, hresult_to_string_local_buffer, sizeof(hresult_to_string_local_buffer));                            \
         if (hresult_to_string_result != NULL)                                                                                                                                   \
         {                                                                                                                                                                       \
             log_macro("HRESULT=\"%s\"", hresult_to_string_result);                                                                                                               \
-            same_as_free(hresult_to_string_result);                                                                                                                                     \
         }                                                                                                                                                                       \
         else                                                                                                                                                                    \
         {                                                                                                                                                                       \
@@ -0,0 +1,845 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+/*THIS FILE IS GENERATED, DO NOT EDIT BY HAND!!!*/
+/*generator is called "servicefabric_enums_to_strings_generator"*/
+
+#ifndef SERVICEFABRIC_ENUMS_SF_SERVICE_CONFIG_H
+#define SERVICEFABRIC_ENUMS_SF_SERVICE_CONFIG_H
+
+#include "fabrictypes.h"
+
+#include "sf_c_util/servicefabric_enums_to_strings.h"
+#include "sf_c_util/sf_service_config.h"
+
+/*the Service Fabric enums can be the types of sf_service_config configuration values, a value is the name of an enumerator in any case*/
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_ERROR_CODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_ERROR_CODE, MU_C2(FABRIC_ERROR_CODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_ERROR_CODE FABRIC_ERROR_CODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_ERROR_CODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_ERROR_CODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_ERROR_CODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_ERROR_CODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_CLIENT_ROLE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_CLIENT_ROLE, MU_C2(FABRIC_CLIENT_ROLE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_CLIENT_ROLE FABRIC_CLIENT_ROLE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_CLIENT_ROLE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_CLIENT_ROLE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_CLIENT_ROLE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_CLIENT_ROLE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_QUERY_SERVICE_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_QUERY_SERVICE_STATUS, MU_C2(FABRIC_QUERY_SERVICE_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_QUERY_SERVICE_STATUS FABRIC_QUERY_SERVICE_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_QUERY_SERVICE_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_QUERY_SERVICE_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_QUERY_SERVICE_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_QUERY_SERVICE_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_QUERY_NODE_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_QUERY_NODE_STATUS, MU_C2(FABRIC_QUERY_NODE_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_QUERY_NODE_STATUS FABRIC_QUERY_NODE_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_QUERY_NODE_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_QUERY_NODE_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_QUERY_NODE_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_QUERY_NODE_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_QUERY_NODE_STATUS_FILTER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_QUERY_NODE_STATUS_FILTER, MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_QUERY_NODE_STATUS_FILTER FABRIC_QUERY_NODE_STATUS_FILTER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_QUERY_NODE_STATUS_FILTER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_QUERY_NODE_STATUS_FILTER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_QUERY_NODE_STATUS_FILTER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_QUERY_NODE_STATUS_FILTER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_KIND, MU_C2(FABRIC_SERVICE_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_KIND FABRIC_SERVICE_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_PARTITION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_PARTITION_KIND, MU_C2(FABRIC_SERVICE_PARTITION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_PARTITION_KIND FABRIC_SERVICE_PARTITION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_PARTITION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_PARTITION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_PARTITION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_PARTITION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_QUERY_SERVICE_PARTITION_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_QUERY_SERVICE_PARTITION_STATUS, MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_QUERY_SERVICE_PARTITION_STATUS FABRIC_QUERY_SERVICE_PARTITION_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_QUERY_SERVICE_PARTITION_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_QUERY_SERVICE_PARTITION_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_QUERY_SERVICE_PARTITION_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_QUERY_SERVICE_PARTITION_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_QUERY_SERVICE_REPLICA_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_QUERY_SERVICE_REPLICA_STATUS, MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_QUERY_SERVICE_REPLICA_STATUS FABRIC_QUERY_SERVICE_REPLICA_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_QUERY_SERVICE_REPLICA_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_QUERY_SERVICE_REPLICA_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_QUERY_SERVICE_REPLICA_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_QUERY_SERVICE_REPLICA_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_QUERY_SERVICE_OPERATION_NAME(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_QUERY_SERVICE_OPERATION_NAME, MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_QUERY_SERVICE_OPERATION_NAME FABRIC_QUERY_SERVICE_OPERATION_NAME
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_QUERY_SERVICE_OPERATION_NAME
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_QUERY_SERVICE_OPERATION_NAME SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_QUERY_SERVICE_OPERATION_NAME)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_QUERY_SERVICE_OPERATION_NAME(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_QUERY_REPLICATOR_OPERATION_NAME(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_QUERY_REPLICATOR_OPERATION_NAME FABRIC_QUERY_REPLICATOR_OPERATION_NAME
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_QUERY_REPLICATOR_OPERATION_NAME
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_QUERY_REPLICATOR_OPERATION_NAME SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_QUERY_REPLICATOR_OPERATION_NAME)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_QUERY_REPLICATOR_OPERATION_NAME(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_EXEHOST_WORKING_FOLDER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_EXEHOST_WORKING_FOLDER, MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_EXEHOST_WORKING_FOLDER FABRIC_EXEHOST_WORKING_FOLDER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_EXEHOST_WORKING_FOLDER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_EXEHOST_WORKING_FOLDER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_EXEHOST_WORKING_FOLDER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_EXEHOST_WORKING_FOLDER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_DLLHOST_HOSTED_DLL_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_DLLHOST_HOSTED_DLL_KIND, MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_DLLHOST_HOSTED_DLL_KIND FABRIC_DLLHOST_HOSTED_DLL_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_DLLHOST_HOSTED_DLL_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_DLLHOST_HOSTED_DLL_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_DLLHOST_HOSTED_DLL_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_DLLHOST_HOSTED_DLL_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_DLLHOST_ISOLATION_POLICY(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_DLLHOST_ISOLATION_POLICY, MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_DLLHOST_ISOLATION_POLICY FABRIC_DLLHOST_ISOLATION_POLICY
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_DLLHOST_ISOLATION_POLICY
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_DLLHOST_ISOLATION_POLICY SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_DLLHOST_ISOLATION_POLICY)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_DLLHOST_ISOLATION_POLICY(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SECURITY_CREDENTIAL_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SECURITY_CREDENTIAL_KIND, MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SECURITY_CREDENTIAL_KIND FABRIC_SECURITY_CREDENTIAL_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SECURITY_CREDENTIAL_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SECURITY_CREDENTIAL_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SECURITY_CREDENTIAL_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SECURITY_CREDENTIAL_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_PROTECTION_LEVEL(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_PROTECTION_LEVEL, MU_C2(FABRIC_PROTECTION_LEVEL, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_PROTECTION_LEVEL FABRIC_PROTECTION_LEVEL
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_PROTECTION_LEVEL
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_PROTECTION_LEVEL SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_PROTECTION_LEVEL)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_PROTECTION_LEVEL(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_X509_STORE_LOCATION(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_X509_STORE_LOCATION, MU_C2(FABRIC_X509_STORE_LOCATION, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_X509_STORE_LOCATION FABRIC_X509_STORE_LOCATION
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_X509_STORE_LOCATION
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_X509_STORE_LOCATION SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_X509_STORE_LOCATION)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_X509_STORE_LOCATION(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_X509_FIND_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_X509_FIND_TYPE, MU_C2(FABRIC_X509_FIND_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_X509_FIND_TYPE FABRIC_X509_FIND_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_X509_FIND_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_X509_FIND_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_X509_FIND_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_X509_FIND_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_LOAD_METRIC_WEIGHT(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_LOAD_METRIC_WEIGHT FABRIC_SERVICE_LOAD_METRIC_WEIGHT
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_LOAD_METRIC_WEIGHT
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_LOAD_METRIC_WEIGHT SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_LOAD_METRIC_WEIGHT)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_LOAD_METRIC_WEIGHT(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_MOVE_COST(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_MOVE_COST, MU_C2(FABRIC_MOVE_COST, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_MOVE_COST FABRIC_MOVE_COST
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_MOVE_COST
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_MOVE_COST SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_MOVE_COST)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_MOVE_COST(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_CORRELATION_SCHEME(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_CORRELATION_SCHEME, MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_CORRELATION_SCHEME FABRIC_SERVICE_CORRELATION_SCHEME
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_CORRELATION_SCHEME
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_CORRELATION_SCHEME SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_CORRELATION_SCHEME)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_CORRELATION_SCHEME(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_PARTITION_ACCESS_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_PARTITION_ACCESS_STATUS FABRIC_SERVICE_PARTITION_ACCESS_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_PARTITION_ACCESS_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_PARTITION_ACCESS_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_PARTITION_ACCESS_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_PARTITION_ACCESS_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPLICA_ROLE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPLICA_ROLE, MU_C2(FABRIC_REPLICA_ROLE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPLICA_ROLE FABRIC_REPLICA_ROLE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPLICA_ROLE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPLICA_ROLE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPLICA_ROLE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPLICA_ROLE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPLICA_OPEN_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPLICA_OPEN_MODE, MU_C2(FABRIC_REPLICA_OPEN_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPLICA_OPEN_MODE FABRIC_REPLICA_OPEN_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPLICA_OPEN_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPLICA_OPEN_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPLICA_OPEN_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPLICA_OPEN_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPLICA_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPLICA_STATUS, MU_C2(FABRIC_REPLICA_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPLICA_STATUS FABRIC_REPLICA_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPLICA_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPLICA_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPLICA_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPLICA_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_OPERATION_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_OPERATION_TYPE, MU_C2(FABRIC_OPERATION_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_OPERATION_TYPE FABRIC_OPERATION_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_OPERATION_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_OPERATION_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_OPERATION_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_OPERATION_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPLICA_SET_QUORUM_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPLICA_SET_QUORUM_MODE, MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPLICA_SET_QUORUM_MODE FABRIC_REPLICA_SET_QUORUM_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPLICA_SET_QUORUM_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPLICA_SET_QUORUM_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPLICA_SET_QUORUM_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPLICA_SET_QUORUM_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPLICATOR_SETTINGS_FLAGS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPLICATOR_SETTINGS_FLAGS, MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPLICATOR_SETTINGS_FLAGS FABRIC_REPLICATOR_SETTINGS_FLAGS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPLICATOR_SETTINGS_FLAGS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPLICATOR_SETTINGS_FLAGS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPLICATOR_SETTINGS_FLAGS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPLICATOR_SETTINGS_FLAGS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_FAULT_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_FAULT_TYPE, MU_C2(FABRIC_FAULT_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_FAULT_TYPE FABRIC_FAULT_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_FAULT_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_FAULT_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_FAULT_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_FAULT_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_HEALTH_STATE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_HEALTH_STATE, MU_C2(FABRIC_HEALTH_STATE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_HEALTH_STATE FABRIC_HEALTH_STATE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_HEALTH_STATE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_HEALTH_STATE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_HEALTH_STATE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_HEALTH_STATE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_HEALTH_REPORT_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_HEALTH_REPORT_KIND, MU_C2(FABRIC_HEALTH_REPORT_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_HEALTH_REPORT_KIND FABRIC_HEALTH_REPORT_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_HEALTH_REPORT_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_HEALTH_REPORT_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_HEALTH_REPORT_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_HEALTH_REPORT_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_HEALTH_ENTITY_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_HEALTH_ENTITY_KIND, MU_C2(FABRIC_HEALTH_ENTITY_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_HEALTH_ENTITY_KIND FABRIC_HEALTH_ENTITY_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_HEALTH_ENTITY_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_HEALTH_ENTITY_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_HEALTH_ENTITY_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_HEALTH_ENTITY_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_HEALTH_EVALUATION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_HEALTH_EVALUATION_KIND, MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_HEALTH_EVALUATION_KIND FABRIC_HEALTH_EVALUATION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_HEALTH_EVALUATION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_HEALTH_EVALUATION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_HEALTH_EVALUATION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_HEALTH_EVALUATION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_PROPERTY_TYPE_ID(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_PROPERTY_TYPE_ID, MU_C2(FABRIC_PROPERTY_TYPE_ID, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_PROPERTY_TYPE_ID FABRIC_PROPERTY_TYPE_ID
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_PROPERTY_TYPE_ID
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_PROPERTY_TYPE_ID SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_PROPERTY_TYPE_ID)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_PROPERTY_TYPE_ID(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_PROPERTY_BATCH_OPERATION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_PROPERTY_BATCH_OPERATION_KIND, MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_PROPERTY_BATCH_OPERATION_KIND FABRIC_PROPERTY_BATCH_OPERATION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_PROPERTY_BATCH_OPERATION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_PROPERTY_BATCH_OPERATION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_PROPERTY_BATCH_OPERATION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_PROPERTY_BATCH_OPERATION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_ENDPOINT_ROLE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_ENDPOINT_ROLE, MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_ENDPOINT_ROLE FABRIC_SERVICE_ENDPOINT_ROLE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_ENDPOINT_ROLE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_ENDPOINT_ROLE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_ENDPOINT_ROLE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_ENDPOINT_ROLE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_ENUMERATION_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_ENUMERATION_STATUS, MU_C2(FABRIC_ENUMERATION_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_ENUMERATION_STATUS FABRIC_ENUMERATION_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_ENUMERATION_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_ENUMERATION_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_ENUMERATION_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_ENUMERATION_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_PARTITION_KEY_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_PARTITION_KEY_TYPE, MU_C2(FABRIC_PARTITION_KEY_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_PARTITION_KEY_TYPE FABRIC_PARTITION_KEY_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_PARTITION_KEY_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_PARTITION_KEY_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_PARTITION_KEY_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_PARTITION_KEY_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_PARTITION_SCHEME(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_PARTITION_SCHEME, MU_C2(FABRIC_PARTITION_SCHEME, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_PARTITION_SCHEME FABRIC_PARTITION_SCHEME
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_PARTITION_SCHEME
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_PARTITION_SCHEME SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_PARTITION_SCHEME)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_PARTITION_SCHEME(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_DESCRIPTION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_DESCRIPTION_KIND, MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_DESCRIPTION_KIND FABRIC_SERVICE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_DESCRIPTION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_DESCRIPTION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_DESCRIPTION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_UPGRADE_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_UPGRADE_KIND, MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_UPGRADE_KIND FABRIC_APPLICATION_UPGRADE_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_UPGRADE_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_UPGRADE_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_UPGRADE_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_UPGRADE_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_UPGRADE_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_UPGRADE_KIND, MU_C2(FABRIC_UPGRADE_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_UPGRADE_KIND FABRIC_UPGRADE_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_UPGRADE_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_UPGRADE_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_UPGRADE_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_UPGRADE_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_UPGRADE_SORT_ORDER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_UPGRADE_SORT_ORDER, MU_C2(FABRIC_UPGRADE_SORT_ORDER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_UPGRADE_SORT_ORDER FABRIC_UPGRADE_SORT_ORDER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_UPGRADE_SORT_ORDER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_UPGRADE_SORT_ORDER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_UPGRADE_SORT_ORDER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_UPGRADE_SORT_ORDER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_ROLLING_UPGRADE_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_ROLLING_UPGRADE_MODE, MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_ROLLING_UPGRADE_MODE FABRIC_ROLLING_UPGRADE_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_ROLLING_UPGRADE_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_ROLLING_UPGRADE_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_ROLLING_UPGRADE_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_ROLLING_UPGRADE_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_MONITORED_UPGRADE_FAILURE_ACTION(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_MONITORED_UPGRADE_FAILURE_ACTION FABRIC_MONITORED_UPGRADE_FAILURE_ACTION
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_MONITORED_UPGRADE_FAILURE_ACTION
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_MONITORED_UPGRADE_FAILURE_ACTION SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_MONITORED_UPGRADE_FAILURE_ACTION(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_UPGRADE_STATE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_UPGRADE_STATE, MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_UPGRADE_STATE FABRIC_APPLICATION_UPGRADE_STATE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_UPGRADE_STATE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_UPGRADE_STATE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_UPGRADE_STATE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_UPGRADE_STATE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_UPGRADE_STATE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_UPGRADE_STATE, MU_C2(FABRIC_UPGRADE_STATE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_UPGRADE_STATE FABRIC_UPGRADE_STATE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_UPGRADE_STATE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_UPGRADE_STATE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_UPGRADE_STATE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_UPGRADE_STATE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_UPGRADE_DOMAIN_STATE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_UPGRADE_DOMAIN_STATE, MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_UPGRADE_DOMAIN_STATE FABRIC_UPGRADE_DOMAIN_STATE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_UPGRADE_DOMAIN_STATE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_UPGRADE_DOMAIN_STATE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_UPGRADE_DOMAIN_STATE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_UPGRADE_DOMAIN_STATE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_UPGRADE_FAILURE_REASON(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_UPGRADE_FAILURE_REASON, MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_UPGRADE_FAILURE_REASON FABRIC_UPGRADE_FAILURE_REASON
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_UPGRADE_FAILURE_REASON
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_UPGRADE_FAILURE_REASON SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_UPGRADE_FAILURE_REASON)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_UPGRADE_FAILURE_REASON(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_LOCAL_STORE_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_LOCAL_STORE_KIND, MU_C2(FABRIC_LOCAL_STORE_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_LOCAL_STORE_KIND FABRIC_LOCAL_STORE_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_LOCAL_STORE_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_LOCAL_STORE_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_LOCAL_STORE_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_LOCAL_STORE_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_REPLICA_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_REPLICA_KIND, MU_C2(FABRIC_SERVICE_REPLICA_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_REPLICA_KIND FABRIC_SERVICE_REPLICA_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_REPLICA_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_REPLICA_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_REPLICA_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_REPLICA_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_TRANSACTION_ISOLATION_LEVEL(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_TRANSACTION_ISOLATION_LEVEL, MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_TRANSACTION_ISOLATION_LEVEL FABRIC_TRANSACTION_ISOLATION_LEVEL
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_TRANSACTION_ISOLATION_LEVEL
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_TRANSACTION_ISOLATION_LEVEL SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_TRANSACTION_ISOLATION_LEVEL)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_TRANSACTION_ISOLATION_LEVEL(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_NODE_DEACTIVATION_INTENT(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_NODE_DEACTIVATION_INTENT, MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_NODE_DEACTIVATION_INTENT FABRIC_NODE_DEACTIVATION_INTENT
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_NODE_DEACTIVATION_INTENT
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_NODE_DEACTIVATION_INTENT SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_NODE_DEACTIVATION_INTENT)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_NODE_DEACTIVATION_INTENT(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_DISABLE_FLAG(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_DISABLE_FLAG, MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_DISABLE_FLAG FABRIC_SERVICE_DISABLE_FLAG
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_DISABLE_FLAG
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_DISABLE_FLAG SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_DISABLE_FLAG)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_DISABLE_FLAG(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_TYPE_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_TYPE_STATUS, MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_TYPE_STATUS FABRIC_APPLICATION_TYPE_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_TYPE_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_TYPE_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_TYPE_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_TYPE_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_STATUS, MU_C2(FABRIC_APPLICATION_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_STATUS FABRIC_APPLICATION_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_DEFINITION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_DEFINITION_KIND, MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_DEFINITION_KIND FABRIC_APPLICATION_DEFINITION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_DEFINITION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_DEFINITION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_DEFINITION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_DEFINITION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_TYPE_DEFINITION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_TYPE_DEFINITION_KIND FABRIC_APPLICATION_TYPE_DEFINITION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_TYPE_DEFINITION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_TYPE_DEFINITION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_TYPE_DEFINITION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_TYPE_DEFINITION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_DEFINITION_KIND_FILTER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_DEFINITION_KIND_FILTER FABRIC_APPLICATION_DEFINITION_KIND_FILTER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_DEFINITION_KIND_FILTER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_DEFINITION_KIND_FILTER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_DEFINITION_KIND_FILTER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_DEFINITION_KIND_FILTER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_TYPE_REGISTRATION_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_TYPE_REGISTRATION_STATUS FABRIC_SERVICE_TYPE_REGISTRATION_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_TYPE_REGISTRATION_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_TYPE_REGISTRATION_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_TYPE_REGISTRATION_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_DEPLOYMENT_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_DEPLOYMENT_STATUS, MU_C2(FABRIC_DEPLOYMENT_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_DEPLOYMENT_STATUS FABRIC_DEPLOYMENT_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_DEPLOYMENT_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_DEPLOYMENT_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_DEPLOYMENT_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_DEPLOYMENT_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_HOST_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_HOST_TYPE, MU_C2(FABRIC_HOST_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_HOST_TYPE FABRIC_HOST_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_HOST_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_HOST_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_HOST_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_HOST_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_HOST_ISOLATION_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_HOST_ISOLATION_MODE, MU_C2(FABRIC_HOST_ISOLATION_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_HOST_ISOLATION_MODE FABRIC_HOST_ISOLATION_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_HOST_ISOLATION_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_HOST_ISOLATION_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_HOST_ISOLATION_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_HOST_ISOLATION_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_ENTRY_POINT_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_ENTRY_POINT_STATUS, MU_C2(FABRIC_ENTRY_POINT_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_ENTRY_POINT_STATUS FABRIC_ENTRY_POINT_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_ENTRY_POINT_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_ENTRY_POINT_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_ENTRY_POINT_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_ENTRY_POINT_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_NODE_UPGRADE_PHASE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_NODE_UPGRADE_PHASE, MU_C2(FABRIC_NODE_UPGRADE_PHASE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_NODE_UPGRADE_PHASE FABRIC_NODE_UPGRADE_PHASE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_NODE_UPGRADE_PHASE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_NODE_UPGRADE_PHASE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_NODE_UPGRADE_PHASE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_NODE_UPGRADE_PHASE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_UPGRADE_SAFETY_CHECK_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_UPGRADE_SAFETY_CHECK_KIND, MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_UPGRADE_SAFETY_CHECK_KIND FABRIC_UPGRADE_SAFETY_CHECK_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_UPGRADE_SAFETY_CHECK_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_UPGRADE_SAFETY_CHECK_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_UPGRADE_SAFETY_CHECK_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_UPGRADE_SAFETY_CHECK_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SAFETY_CHECK_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SAFETY_CHECK_KIND, MU_C2(FABRIC_SAFETY_CHECK_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SAFETY_CHECK_KIND FABRIC_SAFETY_CHECK_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SAFETY_CHECK_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SAFETY_CHECK_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SAFETY_CHECK_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SAFETY_CHECK_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPAIR_TARGET_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPAIR_TARGET_KIND, MU_C2(FABRIC_REPAIR_TARGET_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPAIR_TARGET_KIND FABRIC_REPAIR_TARGET_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPAIR_TARGET_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPAIR_TARGET_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPAIR_TARGET_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPAIR_TARGET_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_RESTART_NODE_DESCRIPTION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_RESTART_NODE_DESCRIPTION_KIND, MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_RESTART_NODE_DESCRIPTION_KIND FABRIC_RESTART_NODE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_RESTART_NODE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_RESTART_NODE_DESCRIPTION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_RESTART_NODE_DESCRIPTION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_RESTART_NODE_DESCRIPTION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_START_NODE_DESCRIPTION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_START_NODE_DESCRIPTION_KIND, MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_START_NODE_DESCRIPTION_KIND FABRIC_START_NODE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_START_NODE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_START_NODE_DESCRIPTION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_START_NODE_DESCRIPTION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_START_NODE_DESCRIPTION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_STOP_NODE_DESCRIPTION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_STOP_NODE_DESCRIPTION_KIND, MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_STOP_NODE_DESCRIPTION_KIND FABRIC_STOP_NODE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_STOP_NODE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_STOP_NODE_DESCRIPTION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_STOP_NODE_DESCRIPTION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_STOP_NODE_DESCRIPTION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPAIR_TASK_STATE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPAIR_TASK_STATE, MU_C2(FABRIC_REPAIR_TASK_STATE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPAIR_TASK_STATE FABRIC_REPAIR_TASK_STATE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPAIR_TASK_STATE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPAIR_TASK_STATE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPAIR_TASK_STATE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPAIR_TASK_STATE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPAIR_IMPACT_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPAIR_IMPACT_KIND, MU_C2(FABRIC_REPAIR_IMPACT_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPAIR_IMPACT_KIND FABRIC_REPAIR_IMPACT_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPAIR_IMPACT_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPAIR_IMPACT_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPAIR_IMPACT_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPAIR_IMPACT_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPAIR_NODE_IMPACT_LEVEL(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPAIR_NODE_IMPACT_LEVEL, MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPAIR_NODE_IMPACT_LEVEL FABRIC_REPAIR_NODE_IMPACT_LEVEL
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPAIR_NODE_IMPACT_LEVEL
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPAIR_NODE_IMPACT_LEVEL SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPAIR_NODE_IMPACT_LEVEL)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPAIR_NODE_IMPACT_LEVEL(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_REPAIR_TASK_RESULT(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_REPAIR_TASK_RESULT, MU_C2(FABRIC_REPAIR_TASK_RESULT, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_REPAIR_TASK_RESULT FABRIC_REPAIR_TASK_RESULT
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_REPAIR_TASK_RESULT
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_REPAIR_TASK_RESULT SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_REPAIR_TASK_RESULT)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_REPAIR_TASK_RESULT(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_NODE_DEACTIVATION_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_NODE_DEACTIVATION_STATUS, MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_NODE_DEACTIVATION_STATUS FABRIC_NODE_DEACTIVATION_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_NODE_DEACTIVATION_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_NODE_DEACTIVATION_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_NODE_DEACTIVATION_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_NODE_DEACTIVATION_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_NODE_DEACTIVATION_TASK_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_NODE_DEACTIVATION_TASK_TYPE, MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_NODE_DEACTIVATION_TASK_TYPE FABRIC_NODE_DEACTIVATION_TASK_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_NODE_DEACTIVATION_TASK_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_NODE_DEACTIVATION_TASK_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_NODE_DEACTIVATION_TASK_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_NODE_DEACTIVATION_TASK_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_PARTITION_SELECTOR_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_PARTITION_SELECTOR_TYPE, MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_PARTITION_SELECTOR_TYPE FABRIC_PARTITION_SELECTOR_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_PARTITION_SELECTOR_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_PARTITION_SELECTOR_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_PARTITION_SELECTOR_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_PARTITION_SELECTOR_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_DATA_LOSS_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_DATA_LOSS_MODE, MU_C2(FABRIC_DATA_LOSS_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_DATA_LOSS_MODE FABRIC_DATA_LOSS_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_DATA_LOSS_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_DATA_LOSS_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_DATA_LOSS_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_DATA_LOSS_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_TEST_COMMAND_PROGRESS_STATE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_TEST_COMMAND_PROGRESS_STATE, MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_TEST_COMMAND_PROGRESS_STATE FABRIC_TEST_COMMAND_PROGRESS_STATE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_TEST_COMMAND_PROGRESS_STATE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_TEST_COMMAND_PROGRESS_STATE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_TEST_COMMAND_PROGRESS_STATE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_TEST_COMMAND_PROGRESS_STATE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_QUORUM_LOSS_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_QUORUM_LOSS_MODE, MU_C2(FABRIC_QUORUM_LOSS_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_QUORUM_LOSS_MODE FABRIC_QUORUM_LOSS_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_QUORUM_LOSS_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_QUORUM_LOSS_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_QUORUM_LOSS_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_QUORUM_LOSS_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_RESTART_PARTITION_MODE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_RESTART_PARTITION_MODE, MU_C2(FABRIC_RESTART_PARTITION_MODE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_RESTART_PARTITION_MODE FABRIC_RESTART_PARTITION_MODE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_RESTART_PARTITION_MODE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_RESTART_PARTITION_MODE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_RESTART_PARTITION_MODE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_RESTART_PARTITION_MODE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_NODE_TRANSITION_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_NODE_TRANSITION_TYPE, MU_C2(FABRIC_NODE_TRANSITION_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_NODE_TRANSITION_TYPE FABRIC_NODE_TRANSITION_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_NODE_TRANSITION_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_NODE_TRANSITION_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_NODE_TRANSITION_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_NODE_TRANSITION_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_RECONFIGURATION_PHASE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_RECONFIGURATION_PHASE, MU_C2(FABRIC_RECONFIGURATION_PHASE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_RECONFIGURATION_PHASE FABRIC_RECONFIGURATION_PHASE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_RECONFIGURATION_PHASE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_RECONFIGURATION_PHASE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_RECONFIGURATION_PHASE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_RECONFIGURATION_PHASE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_RECONFIGURATION_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_RECONFIGURATION_TYPE, MU_C2(FABRIC_RECONFIGURATION_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_RECONFIGURATION_TYPE FABRIC_RECONFIGURATION_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_RECONFIGURATION_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_RECONFIGURATION_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_RECONFIGURATION_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_RECONFIGURATION_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_CHAOS_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_CHAOS_STATUS, MU_C2(FABRIC_CHAOS_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_CHAOS_STATUS FABRIC_CHAOS_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_CHAOS_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_CHAOS_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_CHAOS_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_CHAOS_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_CHAOS_SCHEDULE_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_CHAOS_SCHEDULE_STATUS, MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_CHAOS_SCHEDULE_STATUS FABRIC_CHAOS_SCHEDULE_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_CHAOS_SCHEDULE_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_CHAOS_SCHEDULE_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_CHAOS_SCHEDULE_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_CHAOS_SCHEDULE_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_CHAOS_EVENT_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_CHAOS_EVENT_KIND, MU_C2(FABRIC_CHAOS_EVENT_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_CHAOS_EVENT_KIND FABRIC_CHAOS_EVENT_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_CHAOS_EVENT_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_CHAOS_EVENT_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_CHAOS_EVENT_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_CHAOS_EVENT_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_PROVISION_APPLICATION_TYPE_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_PROVISION_APPLICATION_TYPE_KIND, MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_PROVISION_APPLICATION_TYPE_KIND FABRIC_PROVISION_APPLICATION_TYPE_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_PROVISION_APPLICATION_TYPE_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_PROVISION_APPLICATION_TYPE_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_PROVISION_APPLICATION_TYPE_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_PROVISION_APPLICATION_TYPE_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_DIAGNOSTICS_SINKS_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_DIAGNOSTICS_SINKS_KIND, MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_DIAGNOSTICS_SINKS_KIND FABRIC_DIAGNOSTICS_SINKS_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_DIAGNOSTICS_SINKS_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_DIAGNOSTICS_SINKS_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_DIAGNOSTICS_SINKS_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_DIAGNOSTICS_SINKS_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_PLACEMENT_POLICY_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_PLACEMENT_POLICY_TYPE, MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_PLACEMENT_POLICY_TYPE FABRIC_PLACEMENT_POLICY_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_PLACEMENT_POLICY_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_PLACEMENT_POLICY_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_PLACEMENT_POLICY_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_PLACEMENT_POLICY_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_PACKAGE_SHARING_POLICY_SCOPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_PACKAGE_SHARING_POLICY_SCOPE FABRIC_PACKAGE_SHARING_POLICY_SCOPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_PACKAGE_SHARING_POLICY_SCOPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_PACKAGE_SHARING_POLICY_SCOPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_PACKAGE_SHARING_POLICY_SCOPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_PACKAGE_SHARING_POLICY_SCOPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_HEALTH_STATE_FILTER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_HEALTH_STATE_FILTER, MU_C2(FABRIC_HEALTH_STATE_FILTER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_HEALTH_STATE_FILTER FABRIC_HEALTH_STATE_FILTER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_HEALTH_STATE_FILTER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_HEALTH_STATE_FILTER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_HEALTH_STATE_FILTER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_HEALTH_STATE_FILTER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SCALING_TRIGGER_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SCALING_TRIGGER_KIND, MU_C2(FABRIC_SCALING_TRIGGER_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SCALING_TRIGGER_KIND FABRIC_SCALING_TRIGGER_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SCALING_TRIGGER_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SCALING_TRIGGER_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SCALING_TRIGGER_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SCALING_TRIGGER_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SCALING_MECHANISM_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SCALING_MECHANISM_KIND, MU_C2(FABRIC_SCALING_MECHANISM_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SCALING_MECHANISM_KIND FABRIC_SCALING_MECHANISM_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SCALING_MECHANISM_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SCALING_MECHANISM_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SCALING_MECHANISM_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SCALING_MECHANISM_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_TEST_COMMAND_STATE_FILTER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_TEST_COMMAND_STATE_FILTER, MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_TEST_COMMAND_STATE_FILTER FABRIC_TEST_COMMAND_STATE_FILTER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_TEST_COMMAND_STATE_FILTER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_TEST_COMMAND_STATE_FILTER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_TEST_COMMAND_STATE_FILTER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_TEST_COMMAND_STATE_FILTER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_TEST_COMMAND_TYPE_FILTER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_TEST_COMMAND_TYPE_FILTER, MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_TEST_COMMAND_TYPE_FILTER FABRIC_TEST_COMMAND_TYPE_FILTER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_TEST_COMMAND_TYPE_FILTER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_TEST_COMMAND_TYPE_FILTER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_TEST_COMMAND_TYPE_FILTER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_TEST_COMMAND_TYPE_FILTER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_TEST_COMMAND_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_TEST_COMMAND_TYPE, MU_C2(FABRIC_TEST_COMMAND_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_TEST_COMMAND_TYPE FABRIC_TEST_COMMAND_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_TEST_COMMAND_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_TEST_COMMAND_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_TEST_COMMAND_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_TEST_COMMAND_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_KEY_VALUE_STORE_MIGRATION_STATE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_KEY_VALUE_STORE_MIGRATION_STATE FABRIC_KEY_VALUE_STORE_MIGRATION_STATE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_KEY_VALUE_STORE_MIGRATION_STATE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_KEY_VALUE_STORE_MIGRATION_STATE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_KEY_VALUE_STORE_MIGRATION_STATE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_KEY_VALUE_STORE_PROVIDER_KIND(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_KEY_VALUE_STORE_PROVIDER_KIND FABRIC_KEY_VALUE_STORE_PROVIDER_KIND
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_KEY_VALUE_STORE_PROVIDER_KIND
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_KEY_VALUE_STORE_PROVIDER_KIND SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_KEY_VALUE_STORE_PROVIDER_KIND(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_NETWORK_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_NETWORK_TYPE, MU_C2(FABRIC_NETWORK_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_NETWORK_TYPE FABRIC_NETWORK_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_NETWORK_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_NETWORK_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_NETWORK_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_NETWORK_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_NETWORK_STATUS(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_NETWORK_STATUS, MU_C2(FABRIC_NETWORK_STATUS, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_NETWORK_STATUS FABRIC_NETWORK_STATUS
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_NETWORK_STATUS
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_NETWORK_STATUS SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_NETWORK_STATUS)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_NETWORK_STATUS(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_NETWORK_STATUS_FILTER(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_NETWORK_STATUS_FILTER, MU_C2(FABRIC_NETWORK_STATUS_FILTER, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_NETWORK_STATUS_FILTER FABRIC_NETWORK_STATUS_FILTER
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_NETWORK_STATUS_FILTER
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_NETWORK_STATUS_FILTER SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_NETWORK_STATUS_FILTER)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_NETWORK_STATUS_FILTER(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_ORDERING(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_ORDERING, MU_C2(FABRIC_ORDERING, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_ORDERING FABRIC_ORDERING
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_ORDERING
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_ORDERING SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_ORDERING)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_ORDERING(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_BLOCK_LIST_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_BLOCK_LIST_TYPE, MU_C2(FABRIC_BLOCK_LIST_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_BLOCK_LIST_TYPE FABRIC_BLOCK_LIST_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_BLOCK_LIST_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_BLOCK_LIST_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_BLOCK_LIST_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_BLOCK_LIST_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_STORE_BACKUP_OPTION(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_STORE_BACKUP_OPTION, MU_C2(FABRIC_STORE_BACKUP_OPTION, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_STORE_BACKUP_OPTION FABRIC_STORE_BACKUP_OPTION
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_STORE_BACKUP_OPTION
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_STORE_BACKUP_OPTION SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_STORE_BACKUP_OPTION)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_STORE_BACKUP_OPTION(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_CODE_PACKAGE_EVENT_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_CODE_PACKAGE_EVENT_TYPE, MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_CODE_PACKAGE_EVENT_TYPE FABRIC_CODE_PACKAGE_EVENT_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_CODE_PACKAGE_EVENT_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_CODE_PACKAGE_EVENT_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_CODE_PACKAGE_EVENT_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_CODE_PACKAGE_EVENT_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_SERVICE_HOST_UPGRADE_IMPACT(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_SERVICE_HOST_UPGRADE_IMPACT FABRIC_SERVICE_HOST_UPGRADE_IMPACT
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_SERVICE_HOST_UPGRADE_IMPACT
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_SERVICE_HOST_UPGRADE_IMPACT SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_SERVICE_HOST_UPGRADE_IMPACT)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_SERVICE_HOST_UPGRADE_IMPACT(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_EXECUTION_POLICY_EXECUTION_TYPE(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_EXECUTION_POLICY_EXECUTION_TYPE FABRIC_EXECUTION_POLICY_EXECUTION_TYPE
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_EXECUTION_POLICY_EXECUTION_TYPE
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_EXECUTION_POLICY_EXECUTION_TYPE SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_EXECUTION_POLICY_EXECUTION_TYPE(lval, rval) lval = rval
+
+#define SF_SERVICE_CONFIG_DO_READ_FABRIC_EXECUTION_POLICY_RESTART_POLICY(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum(FABRIC_EXECUTION_POLICY_RESTART_POLICY, MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+#define SF_SERVICE_CONFIG_RETURN_TYPE_FABRIC_EXECUTION_POLICY_RESTART_POLICY FABRIC_EXECUTION_POLICY_RESTART_POLICY
+#define SF_SERVICE_CONFIG_INIT_RETURN_FABRIC_EXECUTION_POLICY_RESTART_POLICY
+#define SF_SERVICE_CONFIG_GETTER_ERROR_FABRIC_EXECUTION_POLICY_RESTART_POLICY SF_SERVICE_CONFIG_GETTER_ERROR_enum(FABRIC_EXECUTION_POLICY_RESTART_POLICY)
+#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_FABRIC_EXECUTION_POLICY_RESTART_POLICY(lval, rval) lval = rval
+
+#endif
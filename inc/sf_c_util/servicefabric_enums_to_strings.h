@@ -15,143 +15,419 @@ extern "C"
 {
 #endif
 MU_DECLARE_ENUM_STRINGS(FABRIC_ERROR_CODE);
+int MU_C2(FABRIC_ERROR_CODE, _FromString)(const char* enumAsString, FABRIC_ERROR_CODE* destination);
+int MU_C2(FABRIC_ERROR_CODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ERROR_CODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_CLIENT_ROLE);
+int MU_C2(FABRIC_CLIENT_ROLE, _FromString)(const char* enumAsString, FABRIC_CLIENT_ROLE* destination);
+int MU_C2(FABRIC_CLIENT_ROLE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CLIENT_ROLE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_QUERY_SERVICE_STATUS);
+int MU_C2(FABRIC_QUERY_SERVICE_STATUS, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_STATUS* destination);
+int MU_C2(FABRIC_QUERY_SERVICE_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_QUERY_NODE_STATUS);
+int MU_C2(FABRIC_QUERY_NODE_STATUS, _FromString)(const char* enumAsString, FABRIC_QUERY_NODE_STATUS* destination);
+int MU_C2(FABRIC_QUERY_NODE_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_NODE_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_QUERY_NODE_STATUS_FILTER);
+int MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _FromString)(const char* enumAsString, FABRIC_QUERY_NODE_STATUS_FILTER* destination);
+int MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_NODE_STATUS_FILTER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_KIND);
+int MU_C2(FABRIC_SERVICE_KIND, _FromString)(const char* enumAsString, FABRIC_SERVICE_KIND* destination);
+int MU_C2(FABRIC_SERVICE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_PARTITION_KIND);
+int MU_C2(FABRIC_SERVICE_PARTITION_KIND, _FromString)(const char* enumAsString, FABRIC_SERVICE_PARTITION_KIND* destination);
+int MU_C2(FABRIC_SERVICE_PARTITION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_PARTITION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_QUERY_SERVICE_PARTITION_STATUS);
+int MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_PARTITION_STATUS* destination);
+int MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_PARTITION_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_QUERY_SERVICE_REPLICA_STATUS);
+int MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_REPLICA_STATUS* destination);
+int MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_REPLICA_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER);
+int MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER* destination);
+int MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_QUERY_SERVICE_OPERATION_NAME);
+int MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_OPERATION_NAME* destination);
+int MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_OPERATION_NAME* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_QUERY_REPLICATOR_OPERATION_NAME);
+int MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _FromString)(const char* enumAsString, FABRIC_QUERY_REPLICATOR_OPERATION_NAME* destination);
+int MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_REPLICATOR_OPERATION_NAME* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND);
+int MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _FromString)(const char* enumAsString, FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND* destination);
+int MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_EXEHOST_WORKING_FOLDER);
+int MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _FromString)(const char* enumAsString, FABRIC_EXEHOST_WORKING_FOLDER* destination);
+int MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_EXEHOST_WORKING_FOLDER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_DLLHOST_HOSTED_DLL_KIND);
+int MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _FromString)(const char* enumAsString, FABRIC_DLLHOST_HOSTED_DLL_KIND* destination);
+int MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DLLHOST_HOSTED_DLL_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_DLLHOST_ISOLATION_POLICY);
+int MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _FromString)(const char* enumAsString, FABRIC_DLLHOST_ISOLATION_POLICY* destination);
+int MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DLLHOST_ISOLATION_POLICY* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SECURITY_CREDENTIAL_KIND);
+int MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _FromString)(const char* enumAsString, FABRIC_SECURITY_CREDENTIAL_KIND* destination);
+int MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SECURITY_CREDENTIAL_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND);
+int MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _FromString)(const char* enumAsString, FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND* destination);
+int MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_PROTECTION_LEVEL);
+int MU_C2(FABRIC_PROTECTION_LEVEL, _FromString)(const char* enumAsString, FABRIC_PROTECTION_LEVEL* destination);
+int MU_C2(FABRIC_PROTECTION_LEVEL, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PROTECTION_LEVEL* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_X509_STORE_LOCATION);
+int MU_C2(FABRIC_X509_STORE_LOCATION, _FromString)(const char* enumAsString, FABRIC_X509_STORE_LOCATION* destination);
+int MU_C2(FABRIC_X509_STORE_LOCATION, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_X509_STORE_LOCATION* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_X509_FIND_TYPE);
+int MU_C2(FABRIC_X509_FIND_TYPE, _FromString)(const char* enumAsString, FABRIC_X509_FIND_TYPE* destination);
+int MU_C2(FABRIC_X509_FIND_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_X509_FIND_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_LOAD_METRIC_WEIGHT);
+int MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _FromString)(const char* enumAsString, FABRIC_SERVICE_LOAD_METRIC_WEIGHT* destination);
+int MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_LOAD_METRIC_WEIGHT* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_MOVE_COST);
+int MU_C2(FABRIC_MOVE_COST, _FromString)(const char* enumAsString, FABRIC_MOVE_COST* destination);
+int MU_C2(FABRIC_MOVE_COST, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_COST* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE);
+int MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _FromString)(const char* enumAsString, FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE* destination);
+int MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_CORRELATION_SCHEME);
+int MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _FromString)(const char* enumAsString, FABRIC_SERVICE_CORRELATION_SCHEME* destination);
+int MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_CORRELATION_SCHEME* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_PARTITION_ACCESS_STATUS);
+int MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _FromString)(const char* enumAsString, FABRIC_SERVICE_PARTITION_ACCESS_STATUS* destination);
+int MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_PARTITION_ACCESS_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPLICA_ROLE);
+int MU_C2(FABRIC_REPLICA_ROLE, _FromString)(const char* enumAsString, FABRIC_REPLICA_ROLE* destination);
+int MU_C2(FABRIC_REPLICA_ROLE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICA_ROLE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPLICA_OPEN_MODE);
+int MU_C2(FABRIC_REPLICA_OPEN_MODE, _FromString)(const char* enumAsString, FABRIC_REPLICA_OPEN_MODE* destination);
+int MU_C2(FABRIC_REPLICA_OPEN_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICA_OPEN_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPLICA_STATUS);
+int MU_C2(FABRIC_REPLICA_STATUS, _FromString)(const char* enumAsString, FABRIC_REPLICA_STATUS* destination);
+int MU_C2(FABRIC_REPLICA_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICA_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_OPERATION_TYPE);
+int MU_C2(FABRIC_OPERATION_TYPE, _FromString)(const char* enumAsString, FABRIC_OPERATION_TYPE* destination);
+int MU_C2(FABRIC_OPERATION_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_OPERATION_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPLICA_SET_QUORUM_MODE);
+int MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _FromString)(const char* enumAsString, FABRIC_REPLICA_SET_QUORUM_MODE* destination);
+int MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICA_SET_QUORUM_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPLICATOR_SETTINGS_FLAGS);
+int MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _FromString)(const char* enumAsString, FABRIC_REPLICATOR_SETTINGS_FLAGS* destination);
+int MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICATOR_SETTINGS_FLAGS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_FAULT_TYPE);
+int MU_C2(FABRIC_FAULT_TYPE, _FromString)(const char* enumAsString, FABRIC_FAULT_TYPE* destination);
+int MU_C2(FABRIC_FAULT_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_FAULT_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_HEALTH_STATE);
+int MU_C2(FABRIC_HEALTH_STATE, _FromString)(const char* enumAsString, FABRIC_HEALTH_STATE* destination);
+int MU_C2(FABRIC_HEALTH_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_STATE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_HEALTH_REPORT_KIND);
+int MU_C2(FABRIC_HEALTH_REPORT_KIND, _FromString)(const char* enumAsString, FABRIC_HEALTH_REPORT_KIND* destination);
+int MU_C2(FABRIC_HEALTH_REPORT_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_REPORT_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_HEALTH_ENTITY_KIND);
+int MU_C2(FABRIC_HEALTH_ENTITY_KIND, _FromString)(const char* enumAsString, FABRIC_HEALTH_ENTITY_KIND* destination);
+int MU_C2(FABRIC_HEALTH_ENTITY_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_ENTITY_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_HEALTH_EVALUATION_KIND);
+int MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _FromString)(const char* enumAsString, FABRIC_HEALTH_EVALUATION_KIND* destination);
+int MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_EVALUATION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_PROPERTY_TYPE_ID);
+int MU_C2(FABRIC_PROPERTY_TYPE_ID, _FromString)(const char* enumAsString, FABRIC_PROPERTY_TYPE_ID* destination);
+int MU_C2(FABRIC_PROPERTY_TYPE_ID, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PROPERTY_TYPE_ID* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_PROPERTY_BATCH_OPERATION_KIND);
+int MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _FromString)(const char* enumAsString, FABRIC_PROPERTY_BATCH_OPERATION_KIND* destination);
+int MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PROPERTY_BATCH_OPERATION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_ENDPOINT_ROLE);
+int MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _FromString)(const char* enumAsString, FABRIC_SERVICE_ENDPOINT_ROLE* destination);
+int MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_ENDPOINT_ROLE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_ENUMERATION_STATUS);
+int MU_C2(FABRIC_ENUMERATION_STATUS, _FromString)(const char* enumAsString, FABRIC_ENUMERATION_STATUS* destination);
+int MU_C2(FABRIC_ENUMERATION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ENUMERATION_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_PARTITION_KEY_TYPE);
+int MU_C2(FABRIC_PARTITION_KEY_TYPE, _FromString)(const char* enumAsString, FABRIC_PARTITION_KEY_TYPE* destination);
+int MU_C2(FABRIC_PARTITION_KEY_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PARTITION_KEY_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_PARTITION_SCHEME);
+int MU_C2(FABRIC_PARTITION_SCHEME, _FromString)(const char* enumAsString, FABRIC_PARTITION_SCHEME* destination);
+int MU_C2(FABRIC_PARTITION_SCHEME, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PARTITION_SCHEME* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_DESCRIPTION_KIND);
+int MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_SERVICE_DESCRIPTION_KIND* destination);
+int MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_DESCRIPTION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS);
+int MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromString)(const char* enumAsString, FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS* destination);
+int MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS);
+int MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromString)(const char* enumAsString, FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS* destination);
+int MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS);
+int MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromString)(const char* enumAsString, FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS* destination);
+int MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS);
+int MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromString)(const char* enumAsString, FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS* destination);
+int MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE);
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _FromString)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE* destination);
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE);
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _FromString)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE* destination);
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE);
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _FromString)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE* destination);
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS);
+int MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _FromString)(const char* enumAsString, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS* destination);
+int MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_UPGRADE_KIND);
+int MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _FromString)(const char* enumAsString, FABRIC_APPLICATION_UPGRADE_KIND* destination);
+int MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_UPGRADE_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_UPGRADE_KIND);
+int MU_C2(FABRIC_UPGRADE_KIND, _FromString)(const char* enumAsString, FABRIC_UPGRADE_KIND* destination);
+int MU_C2(FABRIC_UPGRADE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_UPGRADE_SORT_ORDER);
+int MU_C2(FABRIC_UPGRADE_SORT_ORDER, _FromString)(const char* enumAsString, FABRIC_UPGRADE_SORT_ORDER* destination);
+int MU_C2(FABRIC_UPGRADE_SORT_ORDER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_SORT_ORDER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_ROLLING_UPGRADE_MODE);
+int MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _FromString)(const char* enumAsString, FABRIC_ROLLING_UPGRADE_MODE* destination);
+int MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ROLLING_UPGRADE_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION);
+int MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _FromString)(const char* enumAsString, FABRIC_MONITORED_UPGRADE_FAILURE_ACTION* destination);
+int MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MONITORED_UPGRADE_FAILURE_ACTION* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE);
+int MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _FromString)(const char* enumAsString, FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE* destination);
+int MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS);
+int MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _FromString)(const char* enumAsString, FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS* destination);
+int MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_UPGRADE_STATE);
+int MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _FromString)(const char* enumAsString, FABRIC_APPLICATION_UPGRADE_STATE* destination);
+int MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_UPGRADE_STATE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_UPGRADE_STATE);
+int MU_C2(FABRIC_UPGRADE_STATE, _FromString)(const char* enumAsString, FABRIC_UPGRADE_STATE* destination);
+int MU_C2(FABRIC_UPGRADE_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_STATE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_UPGRADE_DOMAIN_STATE);
+int MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _FromString)(const char* enumAsString, FABRIC_UPGRADE_DOMAIN_STATE* destination);
+int MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_DOMAIN_STATE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_UPGRADE_FAILURE_REASON);
+int MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _FromString)(const char* enumAsString, FABRIC_UPGRADE_FAILURE_REASON* destination);
+int MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_FAILURE_REASON* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_LOCAL_STORE_KIND);
+int MU_C2(FABRIC_LOCAL_STORE_KIND, _FromString)(const char* enumAsString, FABRIC_LOCAL_STORE_KIND* destination);
+int MU_C2(FABRIC_LOCAL_STORE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_LOCAL_STORE_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_REPLICA_KIND);
+int MU_C2(FABRIC_SERVICE_REPLICA_KIND, _FromString)(const char* enumAsString, FABRIC_SERVICE_REPLICA_KIND* destination);
+int MU_C2(FABRIC_SERVICE_REPLICA_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_REPLICA_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE);
+int MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE* destination);
+int MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE);
+int MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE* destination);
+int MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_TRANSACTION_ISOLATION_LEVEL);
+int MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _FromString)(const char* enumAsString, FABRIC_TRANSACTION_ISOLATION_LEVEL* destination);
+int MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TRANSACTION_ISOLATION_LEVEL* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_NODE_DEACTIVATION_INTENT);
+int MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _FromString)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_INTENT* destination);
+int MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_INTENT* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_DISABLE_FLAG);
+int MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _FromString)(const char* enumAsString, FABRIC_SERVICE_DISABLE_FLAG* destination);
+int MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_DISABLE_FLAG* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_TYPE_STATUS);
+int MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _FromString)(const char* enumAsString, FABRIC_APPLICATION_TYPE_STATUS* destination);
+int MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_TYPE_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_STATUS);
+int MU_C2(FABRIC_APPLICATION_STATUS, _FromString)(const char* enumAsString, FABRIC_APPLICATION_STATUS* destination);
+int MU_C2(FABRIC_APPLICATION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_DEFINITION_KIND);
+int MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _FromString)(const char* enumAsString, FABRIC_APPLICATION_DEFINITION_KIND* destination);
+int MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_DEFINITION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_TYPE_DEFINITION_KIND);
+int MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _FromString)(const char* enumAsString, FABRIC_APPLICATION_TYPE_DEFINITION_KIND* destination);
+int MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_TYPE_DEFINITION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_DEFINITION_KIND_FILTER);
+int MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _FromString)(const char* enumAsString, FABRIC_APPLICATION_DEFINITION_KIND_FILTER* destination);
+int MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_DEFINITION_KIND_FILTER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER);
+int MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _FromString)(const char* enumAsString, FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER* destination);
+int MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS);
+int MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _FromString)(const char* enumAsString, FABRIC_SERVICE_TYPE_REGISTRATION_STATUS* destination);
+int MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_TYPE_REGISTRATION_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_DEPLOYMENT_STATUS);
+int MU_C2(FABRIC_DEPLOYMENT_STATUS, _FromString)(const char* enumAsString, FABRIC_DEPLOYMENT_STATUS* destination);
+int MU_C2(FABRIC_DEPLOYMENT_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DEPLOYMENT_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_HOST_TYPE);
+int MU_C2(FABRIC_HOST_TYPE, _FromString)(const char* enumAsString, FABRIC_HOST_TYPE* destination);
+int MU_C2(FABRIC_HOST_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HOST_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_HOST_ISOLATION_MODE);
+int MU_C2(FABRIC_HOST_ISOLATION_MODE, _FromString)(const char* enumAsString, FABRIC_HOST_ISOLATION_MODE* destination);
+int MU_C2(FABRIC_HOST_ISOLATION_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HOST_ISOLATION_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_ENTRY_POINT_STATUS);
+int MU_C2(FABRIC_ENTRY_POINT_STATUS, _FromString)(const char* enumAsString, FABRIC_ENTRY_POINT_STATUS* destination);
+int MU_C2(FABRIC_ENTRY_POINT_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ENTRY_POINT_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_NODE_UPGRADE_PHASE);
+int MU_C2(FABRIC_NODE_UPGRADE_PHASE, _FromString)(const char* enumAsString, FABRIC_NODE_UPGRADE_PHASE* destination);
+int MU_C2(FABRIC_NODE_UPGRADE_PHASE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_UPGRADE_PHASE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_UPGRADE_SAFETY_CHECK_KIND);
+int MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _FromString)(const char* enumAsString, FABRIC_UPGRADE_SAFETY_CHECK_KIND* destination);
+int MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_SAFETY_CHECK_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SAFETY_CHECK_KIND);
+int MU_C2(FABRIC_SAFETY_CHECK_KIND, _FromString)(const char* enumAsString, FABRIC_SAFETY_CHECK_KIND* destination);
+int MU_C2(FABRIC_SAFETY_CHECK_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SAFETY_CHECK_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND);
+int MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _FromString)(const char* enumAsString, FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND* destination);
+int MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPAIR_TARGET_KIND);
+int MU_C2(FABRIC_REPAIR_TARGET_KIND, _FromString)(const char* enumAsString, FABRIC_REPAIR_TARGET_KIND* destination);
+int MU_C2(FABRIC_REPAIR_TARGET_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TARGET_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_RESTART_NODE_DESCRIPTION_KIND);
+int MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_RESTART_NODE_DESCRIPTION_KIND* destination);
+int MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RESTART_NODE_DESCRIPTION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_START_NODE_DESCRIPTION_KIND);
+int MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_START_NODE_DESCRIPTION_KIND* destination);
+int MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_START_NODE_DESCRIPTION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_STOP_NODE_DESCRIPTION_KIND);
+int MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_STOP_NODE_DESCRIPTION_KIND* destination);
+int MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STOP_NODE_DESCRIPTION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND);
+int MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND* destination);
+int MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPAIR_TASK_STATE);
+int MU_C2(FABRIC_REPAIR_TASK_STATE, _FromString)(const char* enumAsString, FABRIC_REPAIR_TASK_STATE* destination);
+int MU_C2(FABRIC_REPAIR_TASK_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TASK_STATE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE);
+int MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _FromString)(const char* enumAsString, FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE* destination);
+int MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS);
+int MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _FromString)(const char* enumAsString, FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS* destination);
+int MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPAIR_IMPACT_KIND);
+int MU_C2(FABRIC_REPAIR_IMPACT_KIND, _FromString)(const char* enumAsString, FABRIC_REPAIR_IMPACT_KIND* destination);
+int MU_C2(FABRIC_REPAIR_IMPACT_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_IMPACT_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPAIR_NODE_IMPACT_LEVEL);
+int MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _FromString)(const char* enumAsString, FABRIC_REPAIR_NODE_IMPACT_LEVEL* destination);
+int MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_NODE_IMPACT_LEVEL* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_REPAIR_TASK_RESULT);
+int MU_C2(FABRIC_REPAIR_TASK_RESULT, _FromString)(const char* enumAsString, FABRIC_REPAIR_TASK_RESULT* destination);
+int MU_C2(FABRIC_REPAIR_TASK_RESULT, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TASK_RESULT* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_NODE_DEACTIVATION_STATUS);
+int MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _FromString)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_STATUS* destination);
+int MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_NODE_DEACTIVATION_TASK_TYPE);
+int MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _FromString)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_TASK_TYPE* destination);
+int MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_TASK_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_PARTITION_SELECTOR_TYPE);
+int MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _FromString)(const char* enumAsString, FABRIC_PARTITION_SELECTOR_TYPE* destination);
+int MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PARTITION_SELECTOR_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_DATA_LOSS_MODE);
+int MU_C2(FABRIC_DATA_LOSS_MODE, _FromString)(const char* enumAsString, FABRIC_DATA_LOSS_MODE* destination);
+int MU_C2(FABRIC_DATA_LOSS_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DATA_LOSS_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_TEST_COMMAND_PROGRESS_STATE);
+int MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _FromString)(const char* enumAsString, FABRIC_TEST_COMMAND_PROGRESS_STATE* destination);
+int MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TEST_COMMAND_PROGRESS_STATE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_QUORUM_LOSS_MODE);
+int MU_C2(FABRIC_QUORUM_LOSS_MODE, _FromString)(const char* enumAsString, FABRIC_QUORUM_LOSS_MODE* destination);
+int MU_C2(FABRIC_QUORUM_LOSS_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUORUM_LOSS_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_RESTART_PARTITION_MODE);
+int MU_C2(FABRIC_RESTART_PARTITION_MODE, _FromString)(const char* enumAsString, FABRIC_RESTART_PARTITION_MODE* destination);
+int MU_C2(FABRIC_RESTART_PARTITION_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RESTART_PARTITION_MODE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND);
+int MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND* destination);
+int MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND);
+int MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND* destination);
+int MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND);
+int MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND* destination);
+int MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND);
+int MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND* destination);
+int MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_NODE_TRANSITION_TYPE);
+int MU_C2(FABRIC_NODE_TRANSITION_TYPE, _FromString)(const char* enumAsString, FABRIC_NODE_TRANSITION_TYPE* destination);
+int MU_C2(FABRIC_NODE_TRANSITION_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_TRANSITION_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_RECONFIGURATION_PHASE);
+int MU_C2(FABRIC_RECONFIGURATION_PHASE, _FromString)(const char* enumAsString, FABRIC_RECONFIGURATION_PHASE* destination);
+int MU_C2(FABRIC_RECONFIGURATION_PHASE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RECONFIGURATION_PHASE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_RECONFIGURATION_TYPE);
+int MU_C2(FABRIC_RECONFIGURATION_TYPE, _FromString)(const char* enumAsString, FABRIC_RECONFIGURATION_TYPE* destination);
+int MU_C2(FABRIC_RECONFIGURATION_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RECONFIGURATION_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_CHAOS_STATUS);
+int MU_C2(FABRIC_CHAOS_STATUS, _FromString)(const char* enumAsString, FABRIC_CHAOS_STATUS* destination);
+int MU_C2(FABRIC_CHAOS_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CHAOS_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_CHAOS_SCHEDULE_STATUS);
+int MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _FromString)(const char* enumAsString, FABRIC_CHAOS_SCHEDULE_STATUS* destination);
+int MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CHAOS_SCHEDULE_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_CHAOS_EVENT_KIND);
+int MU_C2(FABRIC_CHAOS_EVENT_KIND, _FromString)(const char* enumAsString, FABRIC_CHAOS_EVENT_KIND* destination);
+int MU_C2(FABRIC_CHAOS_EVENT_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CHAOS_EVENT_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_PROVISION_APPLICATION_TYPE_KIND);
+int MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _FromString)(const char* enumAsString, FABRIC_PROVISION_APPLICATION_TYPE_KIND* destination);
+int MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PROVISION_APPLICATION_TYPE_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY);
+int MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _FromString)(const char* enumAsString, FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY* destination);
+int MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_DIAGNOSTICS_SINKS_KIND);
+int MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _FromString)(const char* enumAsString, FABRIC_DIAGNOSTICS_SINKS_KIND* destination);
+int MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DIAGNOSTICS_SINKS_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_PLACEMENT_POLICY_TYPE);
+int MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _FromString)(const char* enumAsString, FABRIC_PLACEMENT_POLICY_TYPE* destination);
+int MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PLACEMENT_POLICY_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_PACKAGE_SHARING_POLICY_SCOPE);
+int MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _FromString)(const char* enumAsString, FABRIC_PACKAGE_SHARING_POLICY_SCOPE* destination);
+int MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PACKAGE_SHARING_POLICY_SCOPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_HEALTH_STATE_FILTER);
+int MU_C2(FABRIC_HEALTH_STATE_FILTER, _FromString)(const char* enumAsString, FABRIC_HEALTH_STATE_FILTER* destination);
+int MU_C2(FABRIC_HEALTH_STATE_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_STATE_FILTER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS);
+int MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _FromString)(const char* enumAsString, FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS* destination);
+int MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SCALING_TRIGGER_KIND);
+int MU_C2(FABRIC_SCALING_TRIGGER_KIND, _FromString)(const char* enumAsString, FABRIC_SCALING_TRIGGER_KIND* destination);
+int MU_C2(FABRIC_SCALING_TRIGGER_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SCALING_TRIGGER_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SCALING_MECHANISM_KIND);
+int MU_C2(FABRIC_SCALING_MECHANISM_KIND, _FromString)(const char* enumAsString, FABRIC_SCALING_MECHANISM_KIND* destination);
+int MU_C2(FABRIC_SCALING_MECHANISM_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SCALING_MECHANISM_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_TEST_COMMAND_STATE_FILTER);
+int MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _FromString)(const char* enumAsString, FABRIC_TEST_COMMAND_STATE_FILTER* destination);
+int MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TEST_COMMAND_STATE_FILTER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_TEST_COMMAND_TYPE_FILTER);
+int MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _FromString)(const char* enumAsString, FABRIC_TEST_COMMAND_TYPE_FILTER* destination);
+int MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TEST_COMMAND_TYPE_FILTER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_TEST_COMMAND_TYPE);
+int MU_C2(FABRIC_TEST_COMMAND_TYPE, _FromString)(const char* enumAsString, FABRIC_TEST_COMMAND_TYPE* destination);
+int MU_C2(FABRIC_TEST_COMMAND_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TEST_COMMAND_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE);
+int MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE* destination);
+int MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE);
+int MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_MIGRATION_STATE* destination);
+int MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_MIGRATION_STATE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND);
+int MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_PROVIDER_KIND* destination);
+int MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_PROVIDER_KIND* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_NETWORK_TYPE);
+int MU_C2(FABRIC_NETWORK_TYPE, _FromString)(const char* enumAsString, FABRIC_NETWORK_TYPE* destination);
+int MU_C2(FABRIC_NETWORK_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NETWORK_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_NETWORK_STATUS);
+int MU_C2(FABRIC_NETWORK_STATUS, _FromString)(const char* enumAsString, FABRIC_NETWORK_STATUS* destination);
+int MU_C2(FABRIC_NETWORK_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NETWORK_STATUS* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_NETWORK_STATUS_FILTER);
+int MU_C2(FABRIC_NETWORK_STATUS_FILTER, _FromString)(const char* enumAsString, FABRIC_NETWORK_STATUS_FILTER* destination);
+int MU_C2(FABRIC_NETWORK_STATUS_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NETWORK_STATUS_FILTER* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_ORDERING);
+int MU_C2(FABRIC_ORDERING, _FromString)(const char* enumAsString, FABRIC_ORDERING* destination);
+int MU_C2(FABRIC_ORDERING, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ORDERING* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_BLOCK_LIST_TYPE);
+int MU_C2(FABRIC_BLOCK_LIST_TYPE, _FromString)(const char* enumAsString, FABRIC_BLOCK_LIST_TYPE* destination);
+int MU_C2(FABRIC_BLOCK_LIST_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_BLOCK_LIST_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_STORE_BACKUP_OPTION);
+int MU_C2(FABRIC_STORE_BACKUP_OPTION, _FromString)(const char* enumAsString, FABRIC_STORE_BACKUP_OPTION* destination);
+int MU_C2(FABRIC_STORE_BACKUP_OPTION, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STORE_BACKUP_OPTION* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_CODE_PACKAGE_EVENT_TYPE);
+int MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _FromString)(const char* enumAsString, FABRIC_CODE_PACKAGE_EVENT_TYPE* destination);
+int MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CODE_PACKAGE_EVENT_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_SERVICE_HOST_UPGRADE_IMPACT);
+int MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _FromString)(const char* enumAsString, FABRIC_SERVICE_HOST_UPGRADE_IMPACT* destination);
+int MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_HOST_UPGRADE_IMPACT* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE);
+int MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _FromString)(const char* enumAsString, FABRIC_EXECUTION_POLICY_EXECUTION_TYPE* destination);
+int MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_EXECUTION_POLICY_EXECUTION_TYPE* destination);
 MU_DECLARE_ENUM_STRINGS(FABRIC_EXECUTION_POLICY_RESTART_POLICY);
+int MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _FromString)(const char* enumAsString, FABRIC_EXECUTION_POLICY_RESTART_POLICY* destination);
+int MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_EXECUTION_POLICY_RESTART_POLICY* destination);
 
 #ifdef __cplusplus
 }
@@ -44,6 +44,7 @@ Currently supports the following types:
    char* (char_ptr)
    wchar_t* (wchar_ptr)
    THANDLE(RC_STRING) (thandle_rc_string)
+   enums, see SF_SERVICE_CONFIG_DO_READ_enum (sf_c_util/servicefabric_enums_sf_service_config.h has the Service Fabric enums)
 */
 
 typedef char* char_ptr;
@@ -414,6 +415,60 @@ typedef THANDLE(RC_STRING) thandle_rc_string;
         } \
     }
 
+// An enum type T can be used for configuration values when there is a function int from_string(const char*, T*) for it (for example T_FromString of
+// MU_DEFINE_ENUM or T_FromStringCaseInsensitive of servicefabric_enums_to_strings.h) and the following are defined:
+//   #define SF_SERVICE_CONFIG_DO_READ_T(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) \
+//       SF_SERVICE_CONFIG_DO_READ_enum(T, from_string, config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)
+//   #define SF_SERVICE_CONFIG_RETURN_TYPE_T T
+//   #define SF_SERVICE_CONFIG_INIT_RETURN_T
+//   #define SF_SERVICE_CONFIG_GETTER_ERROR_T SF_SERVICE_CONFIG_GETTER_ERROR_enum(T)
+//   #define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_T(lval, rval) lval = rval
+
+/*Codes_SRS_SF_SERVICE_CONFIG_01_005: [ If the type is an enum then: ]*/
+#define SF_SERVICE_CONFIG_DO_READ_enum(enum_type, from_string, config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) \
+    if (!error_occurred_flag) \
+    { \
+        char* enum_as_string; \
+        /*Codes_SRS_SF_SERVICE_CONFIG_01_006: [ SF_SERVICE_CONFIG_CREATE(name) shall call configuration_reader_get_char_string with the activation_context, sf_config_name, sf_parameters_section_name, and SF_SERVICE_CONFIG_PARAMETER_NAME_config_name. ]*/ \
+        if (configuration_reader_get_char_string(config->activation_context, config->sf_config_name_string, config->sf_parameters_section_name_string, parameter_string, &enum_as_string) != 0) \
+        { \
+            /*Codes_SRS_SF_SERVICE_CONFIG_42_034: [ If there are any errors then SF_SERVICE_CONFIG_CREATE(name) shall fail and return NULL. ]*/ \
+            LogError("configuration_reader_get_char_string(\"%ls\", \"%ls\", \"%ls\") failed", \
+                config->sf_config_name_string, config->sf_parameters_section_name_string, parameter_string); \
+            error_occurred_flag = true; \
+        } \
+        else \
+        { \
+            /*Codes_SRS_SF_SERVICE_CONFIG_01_007: [ SF_SERVICE_CONFIG_CREATE(name) shall convert the value to the enum by calling the from string function of the enum. ]*/ \
+            if ((enum_as_string == NULL) || (from_string(enum_as_string, &result_value) != 0)) \
+            { \
+                /*Codes_SRS_SF_SERVICE_CONFIG_01_008: [ If the value is NULL, empty or not the name of a value of the enum then SF_SERVICE_CONFIG_CREATE(name) shall fail and return NULL. ]*/ \
+                if (no_logging) \
+                { \
+                    LogError("Invalid %ls=***, it is not a value of " MU_TOSTRING(enum_type), parameter_string); \
+                } \
+                else \
+                { \
+                    LogError("Invalid %ls=%s, it is not a value of " MU_TOSTRING(enum_type), parameter_string, MU_P_OR_NULL(enum_as_string)); \
+                } \
+                error_occurred_flag = true; \
+            } \
+            else \
+            { \
+                if (no_logging) \
+                { \
+                    LogVerbose("Config loaded: %ls = ***", parameter_string); \
+                } \
+                else \
+                { \
+                    LogVerbose("Config loaded: %ls = %" PRI_MU_ENUM "", parameter_string, MU_ENUM_VALUE(enum_type, result_value)); \
+                } \
+            } \
+            /*Codes_SRS_SF_SERVICE_CONFIG_01_009: [ SF_SERVICE_CONFIG_CREATE(name) shall free the string. ]*/ \
+            free(enum_as_string); \
+        } \
+    }
+
 #define SF_SERVICE_CONFIG_IS_TYPE_SKIP_SKIP 0
 #define SF_SERVICE_CONFIG_IS_TYPE_SKIP(type) MU_IF(MU_C2(SF_SERVICE_CONFIG_IS_TYPE_SKIP_, type), 0, 1)
 
@@ -574,6 +629,8 @@ typedef THANDLE(RC_STRING) thandle_rc_string;
 #define SF_SERVICE_CONFIG_GETTER_ERROR_char_ptr NULL
 #define SF_SERVICE_CONFIG_GETTER_ERROR_wchar_ptr NULL
 #define SF_SERVICE_CONFIG_GETTER_ERROR_thandle_rc_string NULL
+/*Codes_SRS_SF_SERVICE_CONFIG_01_010: [ ...(enum_type)-1 if the type is an enum ]*/
+#define SF_SERVICE_CONFIG_GETTER_ERROR_enum(enum_type) ((enum_type)-1)
 
 #define SF_SERVICE_CONFIG_GETTER_ERROR(type) MU_C2(SF_SERVICE_CONFIG_GETTER_ERROR_, type)
 
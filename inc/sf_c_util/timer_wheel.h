@@ -0,0 +1,58 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#include <stdbool.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "umock_c/umock_c_prod.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the wheel is hierarchical: every level has TIMER_WHEEL_LEVEL_SLOT_COUNT slots and a slot of a level spans TIMER_WHEEL_LEVEL_SLOT_COUNT ticks of the level below it */
+#define TIMER_WHEEL_LEVEL_BITS 6
+#define TIMER_WHEEL_LEVEL_SLOT_COUNT (1 << TIMER_WHEEL_LEVEL_BITS)
+#define TIMER_WHEEL_LEVEL_COUNT 4
+
+/* a timer that expires TIMER_WHEEL_MAX_TICKS or more ticks away waits in the last level until it gets closer */
+#define TIMER_WHEEL_MAX_TICKS ((uint64_t)1 << (TIMER_WHEEL_LEVEL_BITS * TIMER_WHEEL_LEVEL_COUNT))
+
+/* is_cancelled is true when the wheel was destroyed before the timer expired */
+typedef void (*TIMER_WHEEL_CALLBACK)(void* context, bool is_cancelled);
+
+/* a timer is owned by its user (usually it is a field of the state of an asynchronous operation), the wheel only links it, so scheduling never allocates */
+typedef struct TIMER_WHEEL_TIMER_TAG
+{
+    struct TIMER_WHEEL_TIMER_TAG* next; /* NULL when the timer is not scheduled */
+    struct TIMER_WHEEL_TIMER_TAG* previous;
+    uint64_t expiry_tick;
+    TIMER_WHEEL_CALLBACK callback;
+    void* callback_context;
+} TIMER_WHEEL_TIMER;
+
+#define TIMER_WHEEL_TIMER_INITIALIZER { NULL, NULL, 0, NULL, NULL }
+
+typedef struct TIMER_WHEEL_TAG* TIMER_WHEEL_HANDLE;
+
+    MOCKABLE_FUNCTION(, TIMER_WHEEL_HANDLE, timer_wheel_create, uint32_t, tick_ms);
+    MOCKABLE_FUNCTION(, void, timer_wheel_destroy, TIMER_WHEEL_HANDLE, timer_wheel);
+
+    MOCKABLE_FUNCTION(, void, timer_wheel_timer_init, TIMER_WHEEL_TIMER*, timer);
+    MOCKABLE_FUNCTION(, int, timer_wheel_schedule, TIMER_WHEEL_HANDLE, timer_wheel, TIMER_WHEEL_TIMER*, timer, uint32_t, delay_ms, TIMER_WHEEL_CALLBACK, callback, void*, callback_context);
+    MOCKABLE_FUNCTION(, bool, timer_wheel_cancel, TIMER_WHEEL_HANDLE, timer_wheel, TIMER_WHEEL_TIMER*, timer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_WHEEL_H */
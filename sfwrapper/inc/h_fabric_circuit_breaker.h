@@ -0,0 +1,72 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_CIRCUIT_BREAKER_H
+#define H_FABRIC_CIRCUIT_BREAKER_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_pal/interlocked.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*returned by H_FABRIC_API when the circuit breaker of the handle is open and the call was not attempted*/
+#define H_FABRIC_E_CIRCUIT_BREAKER_OPEN MAKE_HRESULT(SEVERITY_ERROR, FACILITY_ITF, 0x0B01)
+
+#define H_FABRIC_CIRCUIT_BREAKER_STATE_VALUES \
+    H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED, \
+    H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN, \
+    H_FABRIC_CIRCUIT_BREAKER_STATE_HALF_OPEN
+
+MU_DEFINE_ENUM(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_VALUES)
+
+/*what h_fabric_circuit_breaker_enter lets a call do: ALLOWED runs normally, PROBE is the only call running while the breaker is half open, REJECTED shall fail fast*/
+#define H_FABRIC_CIRCUIT_BREAKER_ENTRY_VALUES \
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, \
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE, \
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED
+
+MU_DEFINE_ENUM(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_VALUES)
+
+/*the configuration is a value type, it is copied in the breaker by h_fabric_circuit_breaker_init*/
+typedef struct H_FABRIC_CIRCUIT_BREAKER_CONFIG_TAG
+{
+    uint32_t failure_percent; /*the breaker opens when at least this percentage of the calls of the window failed with a transient error, 0 means no circuit breaker*/
+    uint32_t minimum_calls; /*the failure rate of a window is not looked at before this many calls completed in it*/
+    uint32_t window_ms; /*length of the window over which the failure rate is computed*/
+    uint32_t open_ms; /*time the breaker stays open before letting a probe call through*/
+} H_FABRIC_CIRCUIT_BREAKER_CONFIG;
+
+/*the circuit breaker is embedded in the H_FABRIC_HANDLE*/
+typedef struct H_FABRIC_CIRCUIT_BREAKER_TAG
+{
+    H_FABRIC_CIRCUIT_BREAKER_CONFIG config;
+    volatile_atomic int32_t state; /*H_FABRIC_CIRCUIT_BREAKER_STATE*/
+    volatile_atomic int32_t calls; /*calls completed in the current window*/
+    volatile_atomic int32_t failures; /*calls completed in the current window with a transient error*/
+    volatile_atomic int64_t window_start_ms;
+    volatile_atomic int64_t opened_ms; /*when the breaker last opened*/
+} H_FABRIC_CIRCUIT_BREAKER;
+
+    MOCKABLE_FUNCTION(, void, h_fabric_circuit_breaker_init, H_FABRIC_CIRCUIT_BREAKER*, breaker, const H_FABRIC_CIRCUIT_BREAKER_CONFIG*, config);
+
+    MOCKABLE_FUNCTION(, H_FABRIC_CIRCUIT_BREAKER_ENTRY, h_fabric_circuit_breaker_enter, H_FABRIC_CIRCUIT_BREAKER*, breaker);
+    MOCKABLE_FUNCTION(, void, h_fabric_circuit_breaker_exit, H_FABRIC_CIRCUIT_BREAKER*, breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY, entry, HRESULT, hr);
+
+    MOCKABLE_FUNCTION(, H_FABRIC_CIRCUIT_BREAKER_STATE, h_fabric_circuit_breaker_get_state, H_FABRIC_CIRCUIT_BREAKER*, breaker);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_CIRCUIT_BREAKER_H*/
@@ -0,0 +1,33 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_CLIENT_FACTORY_H
+#define H_FABRIC_CLIENT_FACTORY_H
+
+#include "windows.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef H_FABRIC_CLIENT_FACTORY_SEAM
+/*creates the IFabric client with the interface iid, same contract as FabricCreateLocalClient*/
+typedef HRESULT (*H_FABRIC_CLIENT_FACTORY_CREATE_LOCAL_CLIENT)(void* context, REFIID iid, void** fabricClient);
+
+/*a factory is owned by whoever sets it (for example a fake Service Fabric runtime in tests) and has to outlive its use*/
+typedef struct H_FABRIC_CLIENT_FACTORY_TAG
+{
+    H_FABRIC_CLIENT_FACTORY_CREATE_LOCAL_CLIENT create_local_client;
+    void* context;
+} H_FABRIC_CLIENT_FACTORY;
+
+    /*only in test builds (H_FABRIC_CLIENT_FACTORY_SEAM), production builds have no process-wide factory to replace*/
+    MOCKABLE_FUNCTION(, void, h_fabric_client_factory_set, const H_FABRIC_CLIENT_FACTORY*, factory);
+#endif
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_client_factory_create_local_client, REFIID, iid, void**, fabricClient);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_CLIENT_FACTORY_H*/
@@ -0,0 +1,57 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_CLIENT_HOLDER_H
+#define H_FABRIC_CLIENT_HOLDER_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "windows.h"
+
+#include "c_pal/interlocked.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*creates a new instance of the IFabric interface held by the holder (usually a thin wrapper over CREATE_IFABRICINSTANCE_NAME)*/
+typedef HRESULT (*H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE)(void** instance);
+
+/*releases an instance of the IFabric interface held by the holder (usually a thin wrapper over ->Release())*/
+typedef void (*H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE)(void* instance);
+
+/*one instance of the IFabric interface. It stays alive as long as it is the current generation of the holder or there are calls using it*/
+typedef struct H_FABRIC_CLIENT_GENERATION_TAG
+{
+    void* instance;
+    uint32_t generation; /*1 for the instance created with the holder, incremented at every recreate*/
+    volatile_atomic int32_t ref_count; /*1 for the holder while this is the current generation + 1 for every call using it*/
+} H_FABRIC_CLIENT_GENERATION;
+
+/*the holder is embedded in the H_FABRIC_HANDLE*/
+typedef struct H_FABRIC_CLIENT_HOLDER_TAG
+{
+    void* volatile_atomic current; /*H_FABRIC_CLIENT_GENERATION*, only ever replaced with interlocked_exchange_pointer*/
+    volatile_atomic int32_t pins; /*number of threads between reading current and taking a reference on it*/
+    volatile_atomic int32_t is_recreating; /*1 while a thread creates the next generation, everyone else waits for it*/
+    H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE create_instance;
+    H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE release_instance;
+} H_FABRIC_CLIENT_HOLDER;
+
+    MOCKABLE_FUNCTION(, int, h_fabric_client_holder_init, H_FABRIC_CLIENT_HOLDER*, holder, void*, instance, H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE, create_instance, H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE, release_instance);
+    MOCKABLE_FUNCTION(, void, h_fabric_client_holder_deinit, H_FABRIC_CLIENT_HOLDER*, holder);
+
+    MOCKABLE_FUNCTION(, H_FABRIC_CLIENT_GENERATION*, h_fabric_client_holder_acquire, H_FABRIC_CLIENT_HOLDER*, holder);
+    MOCKABLE_FUNCTION(, void, h_fabric_client_holder_release, H_FABRIC_CLIENT_HOLDER*, holder, H_FABRIC_CLIENT_GENERATION*, generation);
+
+    MOCKABLE_FUNCTION(, int, h_fabric_client_holder_recreate, H_FABRIC_CLIENT_HOLDER*, holder, H_FABRIC_CLIENT_GENERATION*, failed_generation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_CLIENT_HOLDER_H*/
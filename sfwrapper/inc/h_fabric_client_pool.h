@@ -0,0 +1,62 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_CLIENT_POOL_H
+#define H_FABRIC_CLIENT_POOL_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_pal/interlocked.h"
+
+#include "h_fabric_client_holder.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*how a call picks the client it runs on: THREAD_AFFINITY always gives the same client to the same thread, LEAST_IN_FLIGHT gives the client with the fewest calls in progress*/
+#define H_FABRIC_CLIENT_POOL_SELECTION_VALUES \
+    H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, \
+    H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT
+
+MU_DEFINE_ENUM(H_FABRIC_CLIENT_POOL_SELECTION, H_FABRIC_CLIENT_POOL_SELECTION_VALUES)
+
+#define H_FABRIC_CLIENT_POOL_CACHE_LINE_SIZE 64
+
+/*one client of the pool. Every client has its own holder, so a client that failed is recreated without disturbing the others*/
+/*the entries are padded to 2 cache lines: the allocation is only 16 bytes aligned, and with 2 lines the counters of 2 entries never share a cache line*/
+typedef struct H_FABRIC_CLIENT_POOL_ENTRY_TAG
+{
+    H_FABRIC_CLIENT_HOLDER holder;
+    volatile_atomic int32_t in_flight; /*number of calls using this client*/
+    unsigned char padding[2 * H_FABRIC_CLIENT_POOL_CACHE_LINE_SIZE - sizeof(H_FABRIC_CLIENT_HOLDER) - sizeof(int32_t)];
+} H_FABRIC_CLIENT_POOL_ENTRY;
+
+/*the pool is embedded in the H_FABRIC_HANDLE, the entries are allocated together with the handle*/
+typedef struct H_FABRIC_CLIENT_POOL_TAG
+{
+    H_FABRIC_CLIENT_POOL_SELECTION selection;
+    uint32_t size;
+    H_FABRIC_CLIENT_POOL_ENTRY* entries;
+} H_FABRIC_CLIENT_POOL;
+
+    MOCKABLE_FUNCTION(, int, h_fabric_client_pool_init, H_FABRIC_CLIENT_POOL*, pool, H_FABRIC_CLIENT_POOL_ENTRY*, entries, uint32_t, size, H_FABRIC_CLIENT_POOL_SELECTION, selection, H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE, create_instance, H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE, release_instance);
+    MOCKABLE_FUNCTION(, void, h_fabric_client_pool_deinit, H_FABRIC_CLIENT_POOL*, pool);
+
+    MOCKABLE_FUNCTION(, H_FABRIC_CLIENT_POOL_ENTRY*, h_fabric_client_pool_acquire, H_FABRIC_CLIENT_POOL*, pool);
+    MOCKABLE_FUNCTION(, H_FABRIC_CLIENT_POOL_ENTRY*, h_fabric_client_pool_acquire_other, H_FABRIC_CLIENT_POOL*, pool, H_FABRIC_CLIENT_POOL_ENTRY*, other);
+    MOCKABLE_FUNCTION(, void, h_fabric_client_pool_release, H_FABRIC_CLIENT_POOL*, pool, H_FABRIC_CLIENT_POOL_ENTRY*, entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_CLIENT_POOL_H*/
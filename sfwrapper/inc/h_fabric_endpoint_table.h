@@ -0,0 +1,50 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_ENDPOINT_TABLE_H
+#define H_FABRIC_ENDPOINT_TABLE_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*readers pin the table in one of these slots (picked by thread id) while they take a reference on the current snapshot, publishing waits for every slot*/
+#define H_FABRIC_ENDPOINT_TABLE_PIN_SLOT_COUNT 16
+
+typedef struct H_FABRIC_ENDPOINT_TABLE_TAG* H_FABRIC_ENDPOINT_TABLE_HANDLE;
+
+/*an immutable view of the table. It stays valid (together with everything returned by h_fabric_endpoint_table_snapshot_find) until h_fabric_endpoint_table_release_snapshot*/
+typedef struct H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_TAG* H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE;
+
+/*creates the client that registers the filters. Service Fabric only delivers notifications to the handler given when the client is created (usually a thin wrapper over FabricCreateLocalClient3)*/
+typedef HRESULT (*H_FABRIC_ENDPOINT_TABLE_CREATE_CLIENT)(IFabricServiceNotificationEventHandler* notification_handler, IFabricServiceManagementClient6** client);
+
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_endpoint_table_create_local_client, IFabricServiceNotificationEventHandler*, notification_handler, IFabricServiceManagementClient6**, client);
+
+    MOCKABLE_FUNCTION(, H_FABRIC_ENDPOINT_TABLE_HANDLE, h_fabric_endpoint_table_create, H_FABRIC_ENDPOINT_TABLE_CREATE_CLIENT, create_client);
+    MOCKABLE_FUNCTION(, void, h_fabric_endpoint_table_destroy, H_FABRIC_ENDPOINT_TABLE_HANDLE, table);
+
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_endpoint_table_add_filter, H_FABRIC_ENDPOINT_TABLE_HANDLE, table, FABRIC_URI, name, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, flags, DWORD, timeoutMilliseconds, LONGLONG*, filterId);
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_endpoint_table_remove_filter, H_FABRIC_ENDPOINT_TABLE_HANDLE, table, LONGLONG, filterId, DWORD, timeoutMilliseconds);
+
+    MOCKABLE_FUNCTION(, H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE, h_fabric_endpoint_table_acquire_snapshot, H_FABRIC_ENDPOINT_TABLE_HANDLE, table);
+    MOCKABLE_FUNCTION(, void, h_fabric_endpoint_table_release_snapshot, H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE, snapshot);
+
+    MOCKABLE_FUNCTION(, uint64_t, h_fabric_endpoint_table_snapshot_get_version, H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE, snapshot);
+    MOCKABLE_FUNCTION(, const FABRIC_RESOLVED_SERVICE_PARTITION*, h_fabric_endpoint_table_snapshot_find, H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE, snapshot, FABRIC_URI, name, FABRIC_PARTITION_KEY_TYPE, partitionKeyType, const void*, partitionKey);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_ENDPOINT_TABLE_H*/
@@ -0,0 +1,66 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_HEDGE_H
+#define H_FABRIC_HEDGE_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#include <cstddef>
+#else
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#endif
+
+#include "windows.h"
+
+#include "c_pal/interlocked.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+
+#include "sf_c_util/timer_wheel.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*4 buckets for every power of 2, so that all the uint32_t latencies fit with at most 25% error*/
+#define H_FABRIC_HEDGE_LATENCY_BUCKETS 128
+
+/*once this many latencies were recorded the histogram halves all its counts, so that it follows the cluster when its latency changes*/
+#define H_FABRIC_HEDGE_LATENCY_DECAY_SAMPLES 1024
+
+/*the configuration is a value type, it is kept in the H_FABRIC_HANDLE*/
+typedef struct H_FABRIC_HEDGE_CONFIG_TAG
+{
+    uint32_t percentile; /*a second call is made when the first one did not complete in this percentile of the observed latency, 0 means no hedging*/
+    uint32_t minimum_samples; /*no second call is made before this many latencies were observed*/
+    uint32_t minimum_delay_ms; /*a second call is never made earlier than this*/
+} H_FABRIC_HEDGE_CONFIG;
+
+/*latencies of the successful calls of one hedged API. It is a static of the API, all its fields start at 0*/
+typedef struct H_FABRIC_HEDGE_LATENCY_TAG
+{
+    volatile_atomic int32_t samples; /*recorded since the last decay*/
+    volatile_atomic int32_t is_decaying; /*1 while a thread halves the buckets*/
+    volatile_atomic int32_t buckets[H_FABRIC_HEDGE_LATENCY_BUCKETS];
+} H_FABRIC_HEDGE_LATENCY;
+
+/*runs the call once with args (a copy that belongs to the attempt) and writes the COM object it produces in result.
+shared is a pointer slot of the call, NULL until an attempt sets it, that the attempts use to tell each other something (for example the client they picked)*/
+typedef HRESULT (*H_FABRIC_HEDGE_ATTEMPT)(void* args, void* volatile_atomic* shared, void** result);
+
+/*called once no attempt of the call runs any more. It is called by the attempt that completes last, which can be after h_fabric_hedge_execute returned*/
+typedef void (*H_FABRIC_HEDGE_ON_DONE)(void* context);
+
+    MOCKABLE_FUNCTION(, void, h_fabric_hedge_latency_record, H_FABRIC_HEDGE_LATENCY*, latency, uint32_t, latency_ms);
+    MOCKABLE_FUNCTION(, bool, h_fabric_hedge_get_delay, const H_FABRIC_HEDGE_CONFIG*, config, H_FABRIC_HEDGE_LATENCY*, latency, uint32_t*, delay_ms);
+
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_hedge_execute, const H_FABRIC_HEDGE_CONFIG*, config, H_FABRIC_HEDGE_LATENCY*, latency, TIMER_WHEEL_HANDLE, timer_wheel, THANDLE(THREADPOOL), threadpool, H_FABRIC_HEDGE_ATTEMPT, attempt, void*, args, size_t, args_size, H_FABRIC_HEDGE_ON_DONE, on_done, void*, on_done_context, void**, result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_HEDGE_H*/
@@ -23,9 +23,23 @@
 #include "c_pal/gballoc_hl_redirect.h"
 #include "c_pal/timer.h"
 #include "c_pal/threadapi.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
 
 #include "sf_c_util/hresult_to_string.h"
 #include "sf_macros.h"
+#include "h_fabric_retry_policy.h"
+#include "h_fabric_client_holder.h"
+#include "h_fabric_client_pool.h"
+#include "h_fabric_single_flight.h"
+#include "h_fabric_circuit_breaker.h"
+#include "h_fabric_hedge.h"
+#include "sf_c_util/timer_wheel.h"
+#include "c_util/worker_thread.h"
+#include "servicefabricdox_cancellation.h"
 
 #include "umock_c/umock_c_prod.h"
 /*this is prefix that is added to all data types and all APIs that are generated with this macro-based generator*/
@@ -37,6 +51,19 @@
 Users should always use H_FABRIC_API(something) when calling/mocking etc*/
 #define H_FABRIC_API(IFABRIC_METHOD_NAME) MU_C2(H_FABRIC_PREFIX, IFABRIC_METHOD_NAME)
 
+/*the below macro introduces the name of the _async variant of an API, for example HGetNodeList_async*/
+#define H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _async)
+
+/*called exactly once when an _async API completes, result is what the API would have returned*/
+typedef SERVICEFABRIC_DOX_ON_COMPLETE H_FABRIC_ON_COMPLETE;
+
+/*the next try of an _async API, the timer of the delay before it only queues it on the retry worker of the handle*/
+typedef struct H_FABRIC_ASYNC_RETRY_TAG
+{
+    struct H_FABRIC_ASYNC_RETRY_TAG* next;
+    void (*run)(struct H_FABRIC_ASYNC_RETRY_TAG* retry);
+} H_FABRIC_ASYNC_RETRY;
+
 /*the below macro introduces the name of the handle with retries. The name is always based on the IFabric interface that it wraps.*/
 /*this is an example: IFabricQueryClient10 -> HIFabricQueryClient10, users should only use H_FABRIC_HANDLE macro*/
 #define H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) MU_C2(H_FABRIC_PREFIX, IFABRIC_INTERFACE_NAME)
@@ -45,6 +72,20 @@ Users should always use H_FABRIC_API(something) when calling/mocking etc*/
 /*the function name should be used through the macro*/
 #define H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME)   MU_C3(H_FABRIC_PREFIX, IFABRIC_INTERFACE_NAME, _create)
 
+/*this macro introduces a name for function that is used to create the client with a H_FABRIC_RETRY_POLICY*/
+/*the function name should be used through the macro*/
+#define H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFABRIC_INTERFACE_NAME)   MU_C3(H_FABRIC_PREFIX, IFABRIC_INTERFACE_NAME, _create_with_retry_policy)
+
+/*this macro introduces a name for function that is used to create the client backed by a pool of instances of the IFabric interface*/
+/*the function name should be used through the macro*/
+#define H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME)   MU_C3(H_FABRIC_PREFIX, IFABRIC_INTERFACE_NAME, _create_pooled)
+
+/*these macros introduce the names of the functions that configure a handle after it was created, before any API is called with it*/
+/*the function names should be used through the macros*/
+#define H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME)   MU_C3(H_FABRIC_PREFIX, IFABRIC_INTERFACE_NAME, _set_circuit_breaker)
+#define H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME)   MU_C3(H_FABRIC_PREFIX, IFABRIC_INTERFACE_NAME, _set_hedging)
+#define H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME)   MU_C3(H_FABRIC_PREFIX, IFABRIC_INTERFACE_NAME, _set_timer_wheel)
+
 /*this macro introduces a name for function that is used to destroy a client*/
 /*the function name should be used through the macro*/
 #define H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME)   MU_C3(H_FABRIC_PREFIX, IFABRIC_INTERFACE_NAME, _destroy)
@@ -56,9 +97,17 @@ Users should always use H_FABRIC_API(something) when calling/mocking etc*/
 #define H_FABRIC_DEFINE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)     \
 H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)             \
 {                                                               \
-    IFABRIC_INTERFACE_NAME* This;                               \
-    uint32_t msBetweenRetries;                                  \
-    uint32_t nMaxRetries;                                       \
+    H_FABRIC_CLIENT_POOL clients;                               \
+    H_FABRIC_RETRY_POLICY retryPolicy;                          \
+    H_FABRIC_SINGLE_FLIGHT singleFlight;                        \
+    H_FABRIC_CIRCUIT_BREAKER circuitBreaker;                    \
+    H_FABRIC_HEDGE_CONFIG hedgeConfig;                          \
+    TIMER_WHEEL_HANDLE timerWheel; /*not owned*/                \
+    THANDLE(THREADPOOL) threadpool; /*set with hedging*/        \
+    volatile_atomic int32_t hedgedCalls; /*not done yet*/       \
+    WORKER_THREAD_HANDLE retryWorker;                           \
+    void* volatile_atomic retryQueue; /*H_FABRIC_ASYNC_RETRY**/ \
+    H_FABRIC_CLIENT_POOL_ENTRY clientEntries[];                 \
 };                                                              \
 
 /*this macro introduces the HANDLE typedef*/
@@ -122,6 +171,52 @@ H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)             \
 #define ARGS_C_CALL(in_args) \
     MU_C2(ARGS_C_CALL_, in_args)
 
+/*the following below macros (ARGS_C_FIELDS, ARGS_C_FIELDS_IN_ARGS, ARGS_C_FIELDS_PROXY, ARGS_C_FIELDS_ARG) deal with taking a IN_ARGS(ARG(type1, name1), ARG(type2, name2),...)
+* and transforming it to type1 name1; type2 name2;... which is something that can be used in a C struct definition*/
+/*expands to something that can be placed in a C struct definition*/
+#define ARGS_C_FIELDS_ARG(arg_type, arg_name) arg_type arg_name;
+
+/*arg has the form ARG(type, name)*/
+#define ARGS_C_FIELDS_PROXY(arg) MU_C2(ARGS_C_FIELDS_, arg)
+
+/*... has the form ARG(type1, name1), ARG(type2, name2),...*/
+#define ARGS_C_FIELDS_IN_ARGS(...) \
+    MU_FOR_EACH_1(ARGS_C_FIELDS_PROXY, __VA_ARGS__)
+
+/*in_args has the form IN_ARGS(ARG(type1, name1), ARG(type2, name2)...)*/
+#define ARGS_C_FIELDS(in_args) \
+    MU_C2(ARGS_C_FIELDS_, in_args)
+
+/*the following below macros (ARGS_C_FIELDS_SET, ARGS_C_FIELDS_SET_IN_ARGS, ARGS_C_FIELDS_SET_PROXY, ARGS_C_FIELDS_SET_ARG) deal with taking a IN_ARGS(ARG(type1, name1), ARG(type2, name2),...)
+* and transforming it to callArgs.name1 = name1; callArgs.name2 = name2;... which copies the arguments in the fields of a local struct called callArgs*/
+#define ARGS_C_FIELDS_SET_ARG(arg_type, arg_name) callArgs.arg_name = arg_name;
+
+/*arg has the form ARG(type, name)*/
+#define ARGS_C_FIELDS_SET_PROXY(arg) MU_C2(ARGS_C_FIELDS_SET_, arg)
+
+/*... has the form ARG(type1, name1), ARG(type2, name2),...*/
+#define ARGS_C_FIELDS_SET_IN_ARGS(...) \
+    MU_FOR_EACH_1(ARGS_C_FIELDS_SET_PROXY, __VA_ARGS__)
+
+/*in_args has the form IN_ARGS(ARG(type1, name1), ARG(type2, name2)...)*/
+#define ARGS_C_FIELDS_SET(in_args) \
+    MU_C2(ARGS_C_FIELDS_SET_, in_args)
+
+/*the following below macros (ARGS_C_FIELDS_CALL, ARGS_C_FIELDS_CALL_IN_ARGS, ARGS_C_FIELDS_CALL_PROXY, ARGS_C_FIELDS_CALL_ARG) deal with taking a IN_ARGS(ARG(type1, name1), ARG(type2, name2),...)
+* and transforming it to , callArgs->name1, callArgs->name2... which is something that can be used in a C function call with the fields of the struct pointed to by callArgs*/
+#define ARGS_C_FIELDS_CALL_ARG(arg_type, arg_name) , callArgs->arg_name
+
+/*arg has the form ARG(type, name)*/
+#define ARGS_C_FIELDS_CALL_PROXY(arg) MU_C2(ARGS_C_FIELDS_CALL_, arg)
+
+/*... has the form ARG(type1, name1), ARG(type2, name2),...*/
+#define ARGS_C_FIELDS_CALL_IN_ARGS(...) \
+    MU_FOR_EACH_1(ARGS_C_FIELDS_CALL_PROXY, __VA_ARGS__)
+
+/*in_args has the form IN_ARGS(ARG(type1, name1), ARG(type2, name2)...)*/
+#define ARGS_C_FIELDS_CALL(in_args) \
+    MU_C2(ARGS_C_FIELDS_CALL_, in_args)
+
 /*expands to a conditional (to be prepended by a false value)*/
 #define RESULT_CHECK(result) || (hr == result)
 
@@ -190,6 +285,52 @@ H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)             \
 #define ARGS_C_CALL(in_args) \
     MU_C2A(ARGS_C_CALL_, in_args)
 
+/*the following below macros (ARGS_C_FIELDS, ARGS_C_FIELDS_IN_ARGS, ARGS_C_FIELDS_PROXY, ARGS_C_FIELDS_ARG) deal with taking a IN_ARGS(ARG(type1, name1), ARG(type2, name2),...)
+* and transforming it to type1 name1; type2 name2;... which is something that can be used in a C struct definition*/
+/*expands to something that can be placed in a C struct definition*/
+#define ARGS_C_FIELDS_ARG(arg_type, arg_name) arg_type arg_name;
+
+/*arg has the form ARG(type, name)*/
+#define ARGS_C_FIELDS_PROXY(arg) MU_C2(ARGS_C_FIELDS_, arg)
+
+/*... has the form ARG(type1, name1), ARG(type2, name2),...*/
+#define ARGS_C_FIELDS_IN_ARGS(...) \
+    MU_FOR_EACH_1(ARGS_C_FIELDS_PROXY, __VA_ARGS__)
+
+/*in_args has the form IN_ARGS(ARG(type1, name1), ARG(type2, name2)...)*/
+#define ARGS_C_FIELDS(in_args) \
+    MU_C2A(ARGS_C_FIELDS_, in_args)
+
+/*the following below macros (ARGS_C_FIELDS_SET, ARGS_C_FIELDS_SET_IN_ARGS, ARGS_C_FIELDS_SET_PROXY, ARGS_C_FIELDS_SET_ARG) deal with taking a IN_ARGS(ARG(type1, name1), ARG(type2, name2),...)
+* and transforming it to callArgs.name1 = name1; callArgs.name2 = name2;... which copies the arguments in the fields of a local struct called callArgs*/
+#define ARGS_C_FIELDS_SET_ARG(arg_type, arg_name) callArgs.arg_name = arg_name;
+
+/*arg has the form ARG(type, name)*/
+#define ARGS_C_FIELDS_SET_PROXY(arg) MU_C2(ARGS_C_FIELDS_SET_, arg)
+
+/*... has the form ARG(type1, name1), ARG(type2, name2),...*/
+#define ARGS_C_FIELDS_SET_IN_ARGS(...) \
+    MU_FOR_EACH_1(ARGS_C_FIELDS_SET_PROXY, __VA_ARGS__)
+
+/*in_args has the form IN_ARGS(ARG(type1, name1), ARG(type2, name2)...)*/
+#define ARGS_C_FIELDS_SET(in_args) \
+    MU_C2A(ARGS_C_FIELDS_SET_, in_args)
+
+/*the following below macros (ARGS_C_FIELDS_CALL, ARGS_C_FIELDS_CALL_IN_ARGS, ARGS_C_FIELDS_CALL_PROXY, ARGS_C_FIELDS_CALL_ARG) deal with taking a IN_ARGS(ARG(type1, name1), ARG(type2, name2),...)
+* and transforming it to , callArgs->name1, callArgs->name2... which is something that can be used in a C function call with the fields of the struct pointed to by callArgs*/
+#define ARGS_C_FIELDS_CALL_ARG(arg_type, arg_name) , callArgs->arg_name
+
+/*arg has the form ARG(type, name)*/
+#define ARGS_C_FIELDS_CALL_PROXY(arg) MU_C2(ARGS_C_FIELDS_CALL_, arg)
+
+/*... has the form ARG(type1, name1), ARG(type2, name2),...*/
+#define ARGS_C_FIELDS_CALL_IN_ARGS(...) \
+    MU_FOR_EACH_1(ARGS_C_FIELDS_CALL_PROXY, __VA_ARGS__)
+
+/*in_args has the form IN_ARGS(ARG(type1, name1), ARG(type2, name2)...)*/
+#define ARGS_C_FIELDS_CALL(in_args) \
+    MU_C2A(ARGS_C_FIELDS_CALL_, in_args)
+
 /*expands to a conditional (to be prepended by a false value)*/
 #define RESULT_CHECK(result) || (hr == result)
 
@@ -209,63 +350,97 @@ H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)             \
 #define H_FABRIC_DECLARE_API(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args) \
     MOCKABLE_FUNCTION(, HRESULT, H_FABRIC_API(IFABRIC_METHOD_NAME), H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), handle ARGS_MOCKABLE_FUNCTION_DECLARATION(in_args))
 
-/*this macro expands to a full function definition. The name of the function is H_FABRIC_API(IFABRIC_METHOD_NAME) and it contains the code to run with retries and timeout.*/
-#define H_FABRIC_DEFINE_API_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures)                                                                          \
-HRESULT H_FABRIC_API(IFABRIC_METHOD_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle                                                                                                    \
+/*the below macro declares the _async variant of an API, in_args is the same as for H_FABRIC_DECLARE_API. The sync layer has to have MU_C2(IFABRIC_METHOD_NAME, _async)*/
+#define H_FABRIC_DECLARE_API_ASYNC(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args) \
+    MOCKABLE_FUNCTION(, HRESULT, H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), handle ARGS_MOCKABLE_FUNCTION_DECLARATION(in_args), H_FABRIC_ON_COMPLETE, on_complete, void*, on_complete_context)
+
+/*this macro expands to a full function definition. The name of the function is H_FABRIC_FUNCTION_NAME and it contains the code to run with retries and timeout.*/
+/*firstRunClient is NULL when the call is not hedged, otherwise it points to where the first run of the hedged call publishes its client*/
+#define H_FABRIC_DEFINE_API_FUNCTION_WITH_RESULTS(H_FABRIC_FUNCTION_NAME, IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures)                                         \
+HRESULT H_FABRIC_FUNCTION_NAME(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle, void* volatile_atomic* firstRunClient                                                                        \
     ARGS_C_DECLARATION(in_args)                                                                                                                                                             \
 )                                                                                                                                                                                           \
 {                                                                                                                                                                                           \
     HRESULT hr; /*also used a result*/                                                                                                                                                      \
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY breakerEntry;                                                                                                                                            \
     /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_007: [ If handle is NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return NULL. ]*/                                                 \
     if (handle == NULL)                                                                                                                                                                     \
     {                                                                                                                                                                                       \
         LogError("invalid " MU_TOSTRING(HANDLE_TYPE) " handle=%p", handle);                                                                                                                 \
         hr = E_POINTER;                                                                                                                                                                     \
     }                                                                                                                                                                                       \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_038: [ If the circuit breaker of the handle rejects the call (h_fabric_circuit_breaker_enter) then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return H_FABRIC_E_CIRCUIT_BREAKER_OPEN without calling IFABRIC_METHOD_NAME. ]*/ \
+    else if ((breakerEntry = h_fabric_circuit_breaker_enter(&handle->circuitBreaker)) == H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED)                                                           \
+    {                                                                                                                                                                                       \
+        LogError("circuit breaker of handle=%p is open, " MU_TOSTRING(IFABRIC_METHOD_NAME) " was not called", handle);                                                                      \
+        hr = H_FABRIC_E_CIRCUIT_BREAKER_OPEN;                                                                                                                                               \
+    }                                                                                                                                                                                       \
     else                                                                                                                                                                                    \
     {                                                                                                                                                                                       \
         /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall record the start time of the request by calling timer_global_get_elapsed_ms. ]*/             \
         double startTime = timer_global_get_elapsed_ms(); /*time spend here cannot exceed timeoutMilliseconds*/                                                                             \
         double elapsed;                                                                                                                                                                     \
-        uint32_t retries = 0; /*incremented at every API call - 0 means "it will call once", "1" means it will call 2 times". It is in the name: **re**tries.*/                             \
+        uint32_t tries = 0; /*incremented at every API call*/                                                                                                                               \
+        uint32_t delay;                                                                                                                                                                     \
+        H_FABRIC_RETRY_STATE retryState = H_FABRIC_RETRY_STATE_INITIALIZER;                                                                                                                 \
+        H_FABRIC_CLIENT_GENERATION* generation;                                                                                                                                             \
+        H_FABRIC_CLIENT_POOL_ENTRY* pooledClient;                                                                                                                                           \
+        if (firstRunClient == NULL)                                                                                                                                                         \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_031: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall pick the client of the handle that runs the call by calling h_fabric_client_pool_acquire. ]*/ \
+            pooledClient = h_fabric_client_pool_acquire(&handle->clients);                                                                                                                  \
+        }                                                                                                                                                                                   \
+        else                                                                                                                                                                                \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_065: [ Every run of the call shall pick its client by calling h_fabric_client_pool_acquire_other with the client published by the first run, and the first run shall publish its client. ]*/ \
+            /*the first run finds no client and publishes its own, the second run starts after the hedging delay and gets a client other than the one of the first run*/                    \
+            pooledClient = h_fabric_client_pool_acquire_other(&handle->clients, interlocked_compare_exchange_pointer(firstRunClient, NULL, NULL));                                          \
+            (void)interlocked_compare_exchange_pointer(firstRunClient, pooledClient, NULL);                                                                                                 \
+        }                                                                                                                                                                                   \
                                                                                                                                                                                             \
-        do                                                                                                                                                                                  \
+        while (true)                                                                                                                                                                        \
         {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_016: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall take a reference on the current instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_acquire. ]*/ \
+            generation = h_fabric_client_holder_acquire(&pooledClient->holder);                                                                                                             \
+                                                                                                                                                                                            \
             /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_009: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall call IFABRIC_METHOD_NAME on the instance of IFABRIC_INTERFACE_NAME. ]*/                  \
-            hr = IFABRIC_METHOD_NAME(handle->This ARGS_C_CALL(in_args));                                                                                                                    \
+            hr = IFABRIC_METHOD_NAME((IFABRIC_INTERFACE_NAME*)generation->instance ARGS_C_CALL(in_args));                                                                                   \
+            tries++;                                                                                                                                                                        \
             if (FAILED(hr))                                                                                                                                                                 \
             {                                                                                                                                                                               \
-                LogHRESULTError(hr, "failure in " MU_TOSTRING(IFABRIC_METHOD_NAME) "(handle->This=%p, ...)",                                                                                \
-                    handle->This);                                                                                                                                                          \
+                LogHRESULTError(hr, "failure in " MU_TOSTRING(IFABRIC_METHOD_NAME) "(instance=%p (generation=%" PRIu32 "), ...)",                                                           \
+                    generation->instance, generation->generation);                                                                                                                          \
                                                                                                                                                                                             \
-                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME. ]*/ \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_042: [ If the call failed and the cancellation of the calling thread was cancelled (servicefabric_dox_cancellation_is_current_cancelled) then H_FABRIC_API(IFABRIC_METHOD_NAME) shall stop retrying and return HRESULT_FROM_WIN32(ERROR_CANCELLED). ]*/ \
+                if (servicefabric_dox_cancellation_is_current_cancelled())                                                                                                                  \
+                {                                                                                                                                                                           \
+                    /*this is the attempt of a hedged call that lost, nobody waits for its result*/                                                                                         \
+                    hr = HRESULT_FROM_WIN32(ERROR_CANCELLED);                                                                                                                               \
+                    h_fabric_client_holder_release(&pooledClient->holder, generation);                                                                                                      \
+                    break;                                                                                                                                                                  \
+                }                                                                                                                                                                           \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/ \
                 /* FABRIC_E_TIMEOUT was observed in certain cases, such as RestartPartition. We should retry by creating a new client and trying the call again, */                         \
                 /* up to the timeout specified in the H_FABRIC_HANDLE. */                                                                                                                   \
-                if ((hr == E_ABORT) || (hr == FABRIC_E_OBJECT_CLOSED) || (hr == FABRIC_E_GATEWAY_NOT_REACHABLE) || (hr == FABRIC_E_TIMEOUT))                                                \
+                else if ((hr == E_ABORT) || (hr == FABRIC_E_OBJECT_CLOSED) || (hr == FABRIC_E_GATEWAY_NOT_REACHABLE) || (hr == FABRIC_E_TIMEOUT))                                           \
                 {                                                                                                                                                                           \
-                    IFABRIC_INTERFACE_NAME* newInstance = NULL;                                                                                                                             \
-                                                                                                                                                                                            \
-                    HRESULT hr_create;                                                                                                                                                      \
-                    hr_create = CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME)(&newInstance);                                                                                          \
-                    if (FAILED(hr_create))                                                                                                                                                  \
+                    /*only one thread recreates the instance that failed, the others wait for it and retry with the new instance*/                                                          \
+                    if (h_fabric_client_holder_recreate(&pooledClient->holder, generation) != 0)                                                                                            \
                     {                                                                                                                                                                       \
                         /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_012: [ If creating the new instance of IFABRIC_INTERFACE_NAME fails then H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the existing IFABRIC_INTERFACE_NAME. ]*/ \
-                        LogHRESULTError(hr_create, "failure in CREATE_IFABRICINSTANCE_NAME(" MU_TOSTRING(IFABRIC_INTERFACE_NAME) ")(&newInstance=%p)", &newInstance);                       \
+                        LogError("failure in h_fabric_client_holder_recreate(&pooledClient->holder=%p, generation=%p (generation=%" PRIu32 "))", &pooledClient->holder, generation, generation->generation); \
                         /*keep retrying until timeout*/                                                                                                                                     \
                     }                                                                                                                                                                       \
                     else                                                                                                                                                                    \
                     {                                                                                                                                                                       \
-                        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall release the existing instance and shall retry using new newly created IFABRIC_INTERFACE_NAME. ]*/ \
-                        /*let go of the old instance*/                                                                                                                                      \
-                        (void)handle->This->lpVtbl->Release(handle->This);                                                                                                                  \
-                                                                                                                                                                                            \
-                        /*replace it with the new instance*/                                                                                                                                \
-                        handle->This = newInstance;                                                                                                                                         \
+                        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the new instance of IFABRIC_INTERFACE_NAME. ]*/        \
                     }                                                                                                                                                                       \
                 }                                                                                                                                                                           \
                 else if (0 RESULTS_CHECK(permanent_failures))                                                                                                                               \
                 {                                                                                                                                                                           \
                     /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_42_001: [ If the result is any value from permanent_failures then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return. ]*/              \
+                    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_017: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once IFABRIC_METHOD_NAME returned. ]*/ \
+                    h_fabric_client_holder_release(&pooledClient->holder, generation);                                                                                                      \
                     break;                                                                                                                                                                  \
                 }                                                                                                                                                                           \
                 else                                                                                                                                                                        \
@@ -277,30 +452,457 @@ HRESULT H_FABRIC_API(IFABRIC_METHOD_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME
             else                                                                                                                                                                            \
             {                                                                                                                                                                               \
                 /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_010: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/                                    \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_017: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once IFABRIC_METHOD_NAME returned. ]*/ \
+                h_fabric_client_holder_release(&pooledClient->holder, generation);                                                                                                          \
                 break;                                                                                                                                                                      \
             }                                                                                                                                                                               \
                                                                                                                                                                                             \
-            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep msBetweenRetries. ]*/                                                              \
-            ThreadAPI_Sleep(handle->msBetweenRetries);                                                                                                                                      \
-            retries++;                                                                                                                                                                      \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_017: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once IFABRIC_METHOD_NAME returned. ]*/ \
+            h_fabric_client_holder_release(&pooledClient->holder, generation);                                                                                                              \
+                                                                                                                                                                                            \
             elapsed = timer_global_get_elapsed_ms() - startTime;                                                                                                                            \
+            if (elapsed >= timeoutMilliseconds)                                                                                                                                             \
+            {                                                                                                                                                                               \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_016: [ If the total time spend retrying exceeds timeoutMilliseconds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/ \
+                break;                                                                                                                                                                      \
+            }                                                                                                                                                                               \
                                                                                                                                                                                             \
-            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_016: [ If the total time spend retrying exceeds timeoutMilliseconds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/ \
-            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_017: [ If the total number of retries exceeds nMaxRetries then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/  \
-        } while ((retries < handle->nMaxRetries) && (elapsed < timeoutMilliseconds));                                                                                                       \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_010: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall call h_fabric_retry_policy_get_next_delay with the retry policy of the handle and the time left until timeoutMilliseconds. ]*/ \
+            if (!h_fabric_retry_policy_get_next_delay(&handle->retryPolicy, &retryState, (uint32_t)(timeoutMilliseconds - elapsed), &delay))                                                \
+            {                                                                                                                                                                               \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_017: [ If h_fabric_retry_policy_get_next_delay returns false then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/ \
+                break;                                                                                                                                                                      \
+            }                                                                                                                                                                               \
+                                                                                                                                                                                            \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay by calling servicefabric_dox_cancellation_sleep. ]*/ \
+            if (!servicefabric_dox_cancellation_sleep(delay))                                                                                                                               \
+            {                                                                                                                                                                               \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_087: [ If the cancellation of the calling thread is cancelled while H_FABRIC_API(IFABRIC_METHOD_NAME) sleeps then H_FABRIC_API(IFABRIC_METHOD_NAME) shall stop retrying and return HRESULT_FROM_WIN32(ERROR_CANCELLED). ]*/ \
+                /*this is the attempt of a hedged call that lost, it does not wait for the delay*/                                                                                          \
+                hr = HRESULT_FROM_WIN32(ERROR_CANCELLED);                                                                                                                                   \
+                break;                                                                                                                                                                      \
+            }                                                                                                                                                                               \
+        }                                                                                                                                                                                   \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_032: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the client by calling h_fabric_client_pool_release once it stopped retrying. ]*/   \
+        h_fabric_client_pool_release(&handle->clients, pooledClient);                                                                                                                       \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_039: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall report the result of the call to the circuit breaker of the handle by calling h_fabric_circuit_breaker_exit. ]*/ \
+        h_fabric_circuit_breaker_exit(&handle->circuitBreaker, breakerEntry, hr);                                                                                                           \
                                                                                                                                                                                             \
         if(FAILED(hr))                                                                                                                                                                      \
         {                                                                                                                                                                                   \
-            LogHRESULTError(hr, "tried for %" PRIu32 " times in %" PRIu32 "[ms] and it failed", retries, timeoutMilliseconds);                                                              \
+            LogHRESULTError(hr, "tried for %" PRIu32 " times in %" PRIu32 "[ms] and it failed", tries, timeoutMilliseconds);                                                                \
         }                                                                                                                                                                                   \
     }                                                                                                                                                                                       \
                                                                                                                                                                                             \
     return hr;                                                                                                                                                                              \
 }
 
+/*this macro expands to a full function definition. The name of the function is H_FABRIC_API(IFABRIC_METHOD_NAME) and it contains the code to run with retries and timeout.*/
+#define H_FABRIC_DEFINE_API_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures)                                                                          \
+static H_FABRIC_DEFINE_API_FUNCTION_WITH_RESULTS(MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _execute), IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures)              \
+HRESULT H_FABRIC_API(IFABRIC_METHOD_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle                                                                                                    \
+    ARGS_C_DECLARATION(in_args)                                                                                                                                                             \
+)                                                                                                                                                                                           \
+{                                                                                                                                                                                           \
+    return MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _execute)(handle, NULL ARGS_C_CALL(in_args));                                                                                           \
+}
+
 /*this macro expands to a full function definition. The name of the function is H_FABRIC_API(IFABRIC_METHOD_NAME) and it contains the code to run with retries and timeout.*/
 #define H_FABRIC_DEFINE_API(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args)                                                                                                           \
     H_FABRIC_DEFINE_API_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, NONE())
+/*this macro expands to a full function definition. The name of the function is H_FABRIC_API(IFABRIC_METHOD_NAME) and it runs H_FABRIC_DEFINE_API_WITH_RESULTS code only once for all the calls with the same inputs that happen at the same time.*/\
+/*only for APIs that do not change anything in the cluster. key_function has the signature void key_function(H_FABRIC_SINGLE_FLIGHT_KEY* key, in_args...) and adds the inputs that make 2 calls the same to key*/\
+/*result_name is the name of the argument from in_args that receives the result, it has to be a pointer to pointer to a COM object*/                                                        \
+#define H_FABRIC_DEFINE_API_SINGLE_FLIGHT_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures, key_function, result_name)                                 \
+static H_FABRIC_DEFINE_API_FUNCTION_WITH_RESULTS(MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _execute), IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures)              \
+HRESULT H_FABRIC_API(IFABRIC_METHOD_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle                                                                                                    \
+    ARGS_C_DECLARATION(in_args)                                                                                                                                                             \
+)                                                                                                                                                                                           \
+{                                                                                                                                                                                           \
+    HRESULT hr;                                                                                                                                                                             \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_021: [ If handle is NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return E_POINTER. ]*/                                            \
+    if (handle == NULL)                                                                                                                                                                     \
+    {                                                                                                                                                                                       \
+        LogError("invalid " MU_TOSTRING(HANDLE_TYPE) " handle=%p", handle);                                                                                                                 \
+        hr = E_POINTER;                                                                                                                                                                     \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        H_FABRIC_SINGLE_FLIGHT_KEY singleFlightKey;                                                                                                                                         \
+        H_FABRIC_SINGLE_FLIGHT_CALL* singleFlightCall;                                                                                                                                      \
+        bool isLeader;                                                                                                                                                                      \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_022: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall build the key of the call by calling h_fabric_single_flight_key_init and key_function. ]*/   \
+        h_fabric_single_flight_key_init(&singleFlightKey);                                                                                                                                  \
+        key_function(&singleFlightKey ARGS_C_CALL(in_args));                                                                                                                                \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_023: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall join the call in flight of IFABRIC_METHOD_NAME with the same key by calling h_fabric_single_flight_join. ]*/\
+        singleFlightCall = h_fabric_single_flight_join(&handle->singleFlight, MU_TOSTRING(IFABRIC_METHOD_NAME), &singleFlightKey, &isLeader);                                               \
+        if (singleFlightCall == NULL)                                                                                                                                                       \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_024: [ If h_fabric_single_flight_join returns NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall execute the call with retries and timeout by itself. ]*/\
+            hr = MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _execute)(handle, NULL ARGS_C_CALL(in_args));                                                                                     \
+        }                                                                                                                                                                                   \
+        else if (isLeader)                                                                                                                                                                  \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_025: [ If the caller is the leader then H_FABRIC_API(IFABRIC_METHOD_NAME) shall execute the call with retries and timeout. ]*/          \
+            hr = MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _execute)(handle, NULL ARGS_C_CALL(in_args));                                                                                     \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_026: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall share the result of the call with the callers that joined it by calling h_fabric_single_flight_complete. ]*/\
+            h_fabric_single_flight_complete(&handle->singleFlight, singleFlightCall, hr, SUCCEEDED(hr) ? (IUnknown*)*(result_name) : NULL);                                                 \
+        }                                                                                                                                                                                   \
+        else                                                                                                                                                                                \
+        {                                                                                                                                                                                   \
+            IUnknown* sharedResult;                                                                                                                                                         \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_027: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall wait at most timeoutMilliseconds for the result of the leader by calling h_fabric_single_flight_wait. ]*/\
+            hr = h_fabric_single_flight_wait(singleFlightCall, timeoutMilliseconds, &sharedResult);                                                                                         \
+            if (SUCCEEDED(hr))                                                                                                                                                              \
+            {                                                                                                                                                                               \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_028: [ On success H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the reference on the shared result in result_name. ]*/             \
+                *(result_name) = (void*)sharedResult;                                                                                                                                       \
+            }                                                                                                                                                                               \
+            else                                                                                                                                                                            \
+            {                                                                                                                                                                               \
+                LogHRESULTError(hr, "failure in h_fabric_single_flight_wait(singleFlightCall=%p, timeoutMilliseconds=%" PRIu32 ", &sharedResult=%p) for " MU_TOSTRING(IFABRIC_METHOD_NAME), singleFlightCall, timeoutMilliseconds, &sharedResult);\
+            }                                                                                                                                                                               \
+        }                                                                                                                                                                                   \
+    }                                                                                                                                                                                       \
+    return hr;                                                                                                                                                                              \
+}
+
+/*this macro expands to a full function definition. The name of the function is H_FABRIC_API(IFABRIC_METHOD_NAME). See H_FABRIC_DEFINE_API_SINGLE_FLIGHT_WITH_RESULTS.*/
+#define H_FABRIC_DEFINE_API_SINGLE_FLIGHT(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, key_function, result_name)                                                                  \
+    H_FABRIC_DEFINE_API_SINGLE_FLIGHT_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, NONE(), key_function, result_name)
+
+/*this macro expands to a full function definition. The name of the function is H_FABRIC_API(IFABRIC_METHOD_NAME) and it runs H_FABRIC_DEFINE_API_WITH_RESULTS code a second time, on another client, when the first run is slow.*/
+/*only for APIs that do not change anything in the cluster, because both runs might complete. When the first run did not complete in the configured percentile of the latencies of the API a second run starts, the first that succeeds gives the result and the other one is cancelled (see h_fabric_hedge)*/
+/*result_name is the name of the argument from in_args that receives the result, it has to be a pointer to pointer to a COM object*/
+#define H_FABRIC_DEFINE_API_HEDGED_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures, result_name)                                                      \
+static H_FABRIC_DEFINE_API_FUNCTION_WITH_RESULTS(MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _execute), IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures)              \
+/*every run of a hedged call has its own copy of the arguments, in the call of h_fabric_hedge_execute*/                                                                                     \
+typedef struct MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _HEDGE_ARGS_TAG)                                                                                                                    \
+{                                                                                                                                                                                           \
+    H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle;                                                                                                                                         \
+    ARGS_C_FIELDS(in_args)                                                                                                                                                                  \
+} MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _HEDGE_ARGS);                                                                                                                                    \
+/*latencies of IFABRIC_METHOD_NAME, shared by all the handles*/                                                                                                                             \
+static H_FABRIC_HEDGE_LATENCY MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _hedgeLatency);                                                                                                      \
+/*firstRunClient is the slot that the runs share, so that they use different clients*/                                                                                                      \
+static HRESULT MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _attempt)(void* args, void* volatile_atomic* firstRunClient, void** attemptResult)                                                  \
+{                                                                                                                                                                                           \
+    MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _HEDGE_ARGS)* callArgs = args;                                                                                                                 \
+    /*every run writes its result in its own place, only the one of the winner is handed out*/                                                                                              \
+    callArgs->result_name = (void*)attemptResult;                                                                                                                                           \
+    return MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _execute)(callArgs->handle, firstRunClient ARGS_C_FIELDS_CALL(in_args));                                                                \
+}                                                                                                                                                                                           \
+HRESULT H_FABRIC_API(IFABRIC_METHOD_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle                                                                                                    \
+    ARGS_C_DECLARATION(in_args)                                                                                                                                                             \
+)                                                                                                                                                                                           \
+{                                                                                                                                                                                           \
+    HRESULT hr;                                                                                                                                                                             \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_043: [ If handle is NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return E_POINTER. ]*/                                            \
+    if (handle == NULL)                                                                                                                                                                     \
+    {                                                                                                                                                                                       \
+        LogError("invalid " MU_TOSTRING(HANDLE_TYPE) " handle=%p", handle);                                                                                                                 \
+        hr = E_POINTER;                                                                                                                                                                     \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _HEDGE_ARGS) callArgs;                                                                                                                     \
+        void* hedgedResult;                                                                                                                                                                 \
+        /*the threadpool of the handle is only set with hedging*/                                                                                                                           \
+        THANDLE(THREADPOOL) threadpool = (handle->hedgeConfig.percentile == 0) ? NULL : handle->threadpool;                                                                                 \
+                                                                                                                                                                                            \
+        callArgs.handle = handle;                                                                                                                                                           \
+        ARGS_C_FIELDS_SET(in_args)                                                                                                                                                          \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_090: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall count the call in the hedged calls of the handle until h_fabric_hedge_execute calls its on_done, which can be after H_FABRIC_API(IFABRIC_METHOD_NAME) returned. ]*/ \
+        /*the run that lost can outlive this function, it uses the handle until then*/                                                                                                      \
+        (void)interlocked_increment(&handle->hedgedCalls);                                                                                                                                  \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_044: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall execute the call with retries and timeout by calling h_fabric_hedge_execute with the hedging configuration, the timer wheel and the threadpool of the handle and the latencies of IFABRIC_METHOD_NAME. ]*/ \
+        hr = h_fabric_hedge_execute(&handle->hedgeConfig, &MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _hedgeLatency), handle->timerWheel, threadpool, MU_C2(H_FABRIC_API(IFABRIC_METHOD_NAME), _attempt), &callArgs, sizeof(callArgs), MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _on_hedged_call_done), handle, &hedgedResult); \
+        if (SUCCEEDED(hr))                                                                                                                                                                  \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_045: [ On success H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the result of the call that succeeded first in result_name. ]*/        \
+            *(result_name) = hedgedResult;                                                                                                                                                  \
+        }                                                                                                                                                                                   \
+        else                                                                                                                                                                                \
+        {                                                                                                                                                                                   \
+            LogHRESULTError(hr, "failure in h_fabric_hedge_execute for " MU_TOSTRING(IFABRIC_METHOD_NAME));                                                                                 \
+        }                                                                                                                                                                                   \
+    }                                                                                                                                                                                       \
+    return hr;                                                                                                                                                                              \
+}
+
+/*this macro expands to a full function definition. The name of the function is H_FABRIC_API(IFABRIC_METHOD_NAME). See H_FABRIC_DEFINE_API_HEDGED_WITH_RESULTS.*/
+#define H_FABRIC_DEFINE_API_HEDGED(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, result_name)                                                                                       \
+    H_FABRIC_DEFINE_API_HEDGED_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, NONE(), result_name)
+
+/*this macro expands to the full definition of H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME): the retries and the timeout of H_FABRIC_DEFINE_API_WITH_RESULTS, but no thread waits for them.*/
+/*every try is started with MU_C2(IFABRIC_METHOD_NAME, _async) of the sync layer and continues from its completion, the delays between the tries are timers of the timer wheel of the handle.*/
+/*the inputs, the memory they point to and the handle have to stay valid until on_complete is called*/
+#define H_FABRIC_DEFINE_API_ASYNC_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures)                                                                    \
+typedef struct MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _ARGS_TAG)                                                                                                                    \
+{                                                                                                                                                                                           \
+    ARGS_C_FIELDS(in_args)                                                                                                                                                                  \
+} MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _ARGS);                                                                                                                                    \
+/*everything a call needs between its tries, it is freed right before on_complete is called*/                                                                                               \
+typedef struct MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL_TAG)                                                                                                                    \
+{                                                                                                                                                                                           \
+    H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle;                                                                                                                                         \
+    MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _ARGS) args;                                                                                                                             \
+    H_FABRIC_ON_COMPLETE on_complete;                                                                                                                                                       \
+    void* on_complete_context;                                                                                                                                                              \
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY breakerEntry;                                                                                                                                            \
+    double startTime;                                                                                                                                                                       \
+    uint32_t tries;                                                                                                                                                                         \
+    H_FABRIC_RETRY_STATE retryState;                                                                                                                                                        \
+    H_FABRIC_CLIENT_POOL_ENTRY* pooledClient;                                                                                                                                               \
+    H_FABRIC_CLIENT_GENERATION* generation;                                                                                                                                                 \
+    H_FABRIC_CLIENT_GENERATION* failedGeneration; /*the instance to re-create before the next try, NULL when there is none*/                                                                \
+    HRESULT lastResult; /*the result of the last try, the call completes with it if the timer wheel is destroyed before the next try*/                                                      \
+    TIMER_WHEEL_TIMER retryTimer;                                                                                                                                                           \
+    H_FABRIC_ASYNC_RETRY retry; /*queued on the retry worker of the handle when retryTimer fires*/                                                                                          \
+    bool isRetryCancelled; /*true when the timer wheel was destroyed before retryTimer fired*/                                                                                              \
+} MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL);                                                                                                                                    \
+static void MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _complete)(MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)* call, HRESULT hr)                                              \
+{                                                                                                                                                                                           \
+    H_FABRIC_ON_COMPLETE on_complete = call->on_complete;                                                                                                                                   \
+    void* on_complete_context = call->on_complete_context;                                                                                                                                  \
+                                                                                                                                                                                            \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_063: [ Once it stopped retrying, H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall give back the client by calling h_fabric_client_pool_release, report the result to the circuit breaker of the handle by calling h_fabric_circuit_breaker_exit, free the state of the call and call on_complete with on_complete_context and the result. ]*/ \
+    if (call->failedGeneration != NULL)                                                                                                                                                     \
+    {                                                                                                                                                                                       \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_067: [ If the instance that failed was not re-created yet then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall give back the reference on it by calling h_fabric_client_holder_release without re-creating it. ]*/ \
+        h_fabric_client_holder_release(&call->pooledClient->holder, call->failedGeneration);                                                                                                \
+    }                                                                                                                                                                                       \
+    h_fabric_client_pool_release(&call->handle->clients, call->pooledClient);                                                                                                               \
+    h_fabric_circuit_breaker_exit(&call->handle->circuitBreaker, call->breakerEntry, hr);                                                                                                   \
+    if (FAILED(hr))                                                                                                                                                                         \
+    {                                                                                                                                                                                       \
+        LogHRESULTError(hr, "tried for %" PRIu32 " times in %" PRIu32 "[ms] and it failed", call->tries, call->args.timeoutMilliseconds);                                                   \
+    }                                                                                                                                                                                       \
+    free(call);                                                                                                                                                                             \
+    on_complete(on_complete_context, hr);                                                                                                                                                   \
+}                                                                                                                                                                                           \
+static void MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _try)(MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)* call);                                                              \
+/*runs on the retry worker of the handle, so re-creating the instance never holds up the timer wheel*/                                                                                      \
+static void MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _run_retry)(H_FABRIC_ASYNC_RETRY* retry)                                                                                         \
+{                                                                                                                                                                                           \
+    MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)* call = (void*)((unsigned char*)retry - offsetof(MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL), retry));                  \
+    if (call->isRetryCancelled)                                                                                                                                                             \
+    {                                                                                                                                                                                       \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_068: [ If the timer wheel of the handle is destroyed before the next try started then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall complete the call with the last error code. ]*/ \
+        LogError("the timer wheel was destroyed before the next try, %" PRIu32 " tries", call->tries);                                                                                      \
+        MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _complete)(call, call->lastResult);                                                                                                  \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        if (call->failedGeneration != NULL)                                                                                                                                                 \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_066: [ When the delay before the next try elapsed, if the previous try completed with FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall re-create the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_recreate and give back the reference on the instance that failed by calling h_fabric_client_holder_release before starting the try. ]*/ \
+            if (h_fabric_client_holder_recreate(&call->pooledClient->holder, call->failedGeneration) != 0)                                                                                  \
+            {                                                                                                                                                                               \
+                LogError("failure in h_fabric_client_holder_recreate(&call->pooledClient->holder=%p, call->failedGeneration=%p (generation=%" PRIu32 "))", &call->pooledClient->holder, call->failedGeneration, call->failedGeneration->generation); \
+                /*keep retrying until timeout*/                                                                                                                                             \
+            }                                                                                                                                                                               \
+            h_fabric_client_holder_release(&call->pooledClient->holder, call->failedGeneration);                                                                                            \
+            call->failedGeneration = NULL;                                                                                                                                                  \
+        }                                                                                                                                                                                   \
+        MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _try)(call);                                                                                                                         \
+    }                                                                                                                                                                                       \
+}                                                                                                                                                                                           \
+/*runs on the thread of the timer wheel, so it only queues the next try*/                                                                                                                   \
+static void MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _on_retry_timer)(void* context, bool is_cancelled)                                                                               \
+{                                                                                                                                                                                           \
+    MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)* call = context;                                                                                                                  \
+    /*the retry worker might complete and free the call as soon as it is queued*/                                                                                                           \
+    H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle = call->handle;                                                                                                                          \
+    void* head;                                                                                                                                                                             \
+    call->isRetryCancelled = is_cancelled;                                                                                                                                                  \
+    call->retry.run = MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _run_retry);                                                                                                           \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_081: [ When the delay before the next try elapsed (or the timer wheel was destroyed), H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall only queue the call on the retry worker of the handle and call worker_thread_schedule_process, the retry worker continues the call. ]*/ \
+    do                                                                                                                                                                                      \
+    {                                                                                                                                                                                       \
+        head = interlocked_compare_exchange_pointer(&handle->retryQueue, NULL, NULL);                                                                                                       \
+        call->retry.next = head;                                                                                                                                                            \
+    } while (interlocked_compare_exchange_pointer(&handle->retryQueue, &call->retry, head) != head);                                                                                        \
+    WORKER_THREAD_SCHEDULE_PROCESS_RESULT schedule_result = worker_thread_schedule_process(handle->retryWorker);                                                                            \
+    if (schedule_result != WORKER_THREAD_SCHEDULE_PROCESS_OK)                                                                                                                               \
+    {                                                                                                                                                                                       \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_082: [ If worker_thread_schedule_process fails then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall run the queued calls of the handle on the thread of the timer wheel. ]*/ \
+        LogError("failure in worker_thread_schedule_process(handle->retryWorker=%p), WORKER_THREAD_SCHEDULE_PROCESS_RESULT schedule_result=%" PRI_MU_ENUM ", continuing the queued calls on the timer wheel thread", \
+            handle->retryWorker, MU_ENUM_VALUE(WORKER_THREAD_SCHEDULE_PROCESS_RESULT, schedule_result));                                                                                    \
+        MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _run_retries)(handle);                                                                                                               \
+    }                                                                                                                                                                                       \
+}                                                                                                                                                                                           \
+static void MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _on_try_complete)(void* context, HRESULT hr)                                                                                     \
+{                                                                                                                                                                                           \
+    MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)* call = context;                                                                                                                  \
+    bool retry;                                                                                                                                                                             \
+    double elapsed;                                                                                                                                                                         \
+    uint32_t delay;                                                                                                                                                                         \
+                                                                                                                                                                                            \
+    call->tries++;                                                                                                                                                                          \
+    if (FAILED(hr))                                                                                                                                                                         \
+    {                                                                                                                                                                                       \
+        LogHRESULTError(hr, "failure in " MU_TOSTRING(IFABRIC_METHOD_NAME) "_async(instance=%p (generation=%" PRIu32 "), ...)",                                                             \
+            call->generation->instance, call->generation->generation);                                                                                                                      \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_056: [ If the try completed with FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall keep the reference on the instance of IFABRIC_INTERFACE_NAME and retry. ]*/ \
+        if ((hr == E_ABORT) || (hr == FABRIC_E_OBJECT_CLOSED) || (hr == FABRIC_E_GATEWAY_NOT_REACHABLE) || (hr == FABRIC_E_TIMEOUT))                                                        \
+        {                                                                                                                                                                                   \
+            /*re-creating the instance waits for Service Fabric to create a client and for the other threads re-creating it, so it does not happen on this completion thread of Service Fabric but before the next try*/ \
+            call->failedGeneration = call->generation;                                                                                                                                      \
+            retry = true;                                                                                                                                                                   \
+        }                                                                                                                                                                                   \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_057: [ If the try succeeded or completed with any value from permanent_failures then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall complete the call with that result. ]*/ \
+        else if (0 RESULTS_CHECK(permanent_failures))                                                                                                                                       \
+        {                                                                                                                                                                                   \
+            retry = false;                                                                                                                                                                  \
+        }                                                                                                                                                                                   \
+        else                                                                                                                                                                                \
+        {                                                                                                                                                                                   \
+            /*some other HRESULT, so retry without re-creating the object*/                                                                                                                 \
+            retry = true;                                                                                                                                                                   \
+        }                                                                                                                                                                                   \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        retry = false;                                                                                                                                                                      \
+    }                                                                                                                                                                                       \
+                                                                                                                                                                                            \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_058: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once the try completed, unless it keeps it to re-create the instance. ]*/ \
+    if (call->failedGeneration == NULL)                                                                                                                                                     \
+    {                                                                                                                                                                                       \
+        h_fabric_client_holder_release(&call->pooledClient->holder, call->generation);                                                                                                      \
+    }                                                                                                                                                                                       \
+                                                                                                                                                                                            \
+    if (!retry)                                                                                                                                                                             \
+    {                                                                                                                                                                                       \
+        MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _complete)(call, hr);                                                                                                                \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        call->lastResult = hr;                                                                                                                                                              \
+        elapsed = timer_global_get_elapsed_ms() - call->startTime;                                                                                                                          \
+        if (elapsed >= call->args.timeoutMilliseconds)                                                                                                                                      \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_059: [ If the total time spent retrying exceeds timeoutMilliseconds then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall complete the call with the last error code. ]*/ \
+            MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _complete)(call, hr);                                                                                                            \
+        }                                                                                                                                                                                   \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_060: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall call h_fabric_retry_policy_get_next_delay with the retry policy of the handle and the time left until timeoutMilliseconds, and if it returns false complete the call with the last error code. ]*/ \
+        else if (!h_fabric_retry_policy_get_next_delay(&call->handle->retryPolicy, &call->retryState, (uint32_t)(call->args.timeoutMilliseconds - elapsed), &delay))                        \
+        {                                                                                                                                                                                   \
+            MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _complete)(call, hr);                                                                                                            \
+        }                                                                                                                                                                                   \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_061: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall start the next try once the delay elapsed by calling timer_wheel_schedule with the timer wheel of the handle. ]*/ \
+        else if (timer_wheel_schedule(call->handle->timerWheel, &call->retryTimer, delay, MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _on_retry_timer), call) != 0)                      \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_062: [ If timer_wheel_schedule fails then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall complete the call with the last error code. ]*/ \
+            LogError("failure in timer_wheel_schedule(delay=%" PRIu32 ")", delay);                                                                                                          \
+            MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _complete)(call, hr);                                                                                                            \
+        }                                                                                                                                                                                   \
+        else                                                                                                                                                                                \
+        {                                                                                                                                                                                   \
+            /*the next try starts from the thread of the timer wheel*/                                                                                                                      \
+        }                                                                                                                                                                                   \
+    }                                                                                                                                                                                       \
+}                                                                                                                                                                                           \
+static void MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _try)(MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)* call)                                                               \
+{                                                                                                                                                                                           \
+    HRESULT hr;                                                                                                                                                                             \
+    const MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _ARGS)* callArgs = &call->args;                                                                                                    \
+    TIMER_WHEEL_HANDLE previousTimerWheel;                                                                                                                                                  \
+                                                                                                                                                                                            \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_054: [ To start a try H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall take a reference on the current instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_acquire and call MU_C2(IFABRIC_METHOD_NAME, _async) on it. ]*/ \
+    call->generation = h_fabric_client_holder_acquire(&call->pooledClient->holder);                                                                                                         \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_064: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall make the timer wheel of the handle current by calling servicefabric_dox_cancellation_set_current_timer_wheel while it calls MU_C2(IFABRIC_METHOD_NAME, _async), so the try gets a deadline, and restore the previous one afterwards. ]*/ \
+    previousTimerWheel = servicefabric_dox_cancellation_get_current_timer_wheel();                                                                                                          \
+    servicefabric_dox_cancellation_set_current_timer_wheel(call->handle->timerWheel);                                                                                                       \
+    hr = MU_C2(IFABRIC_METHOD_NAME, _async)((IFABRIC_INTERFACE_NAME*)call->generation->instance ARGS_C_FIELDS_CALL(in_args), MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _on_try_complete), call); \
+    servicefabric_dox_cancellation_set_current_timer_wheel(previousTimerWheel);                                                                                                             \
+    if (FAILED(hr))                                                                                                                                                                         \
+    {                                                                                                                                                                                       \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_055: [ If MU_C2(IFABRIC_METHOD_NAME, _async) fails then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall handle it as a try that completed with that result. ]*/ \
+        MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _on_try_complete)(call, hr);                                                                                                         \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        /*call belongs to the completion of the try now, it might already be freed*/                                                                                                        \
+    }                                                                                                                                                                                       \
+}                                                                                                                                                                                           \
+HRESULT H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle                                                                                              \
+    ARGS_C_DECLARATION(in_args),                                                                                                                                                            \
+    H_FABRIC_ON_COMPLETE on_complete,                                                                                                                                                       \
+    void* on_complete_context                                                                                                                                                               \
+)                                                                                                                                                                                           \
+{                                                                                                                                                                                           \
+    HRESULT hr;                                                                                                                                                                             \
+    MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)* call;                                                                                                                            \
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY breakerEntry;                                                                                                                                            \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_046: [ If handle is NULL then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall fail and return E_POINTER. ]*/                                      \
+    if (handle == NULL)                                                                                                                                                                     \
+    {                                                                                                                                                                                       \
+        LogError("invalid " MU_TOSTRING(HANDLE_TYPE) " handle=%p", handle);                                                                                                                 \
+        hr = E_POINTER;                                                                                                                                                                     \
+    }                                                                                                                                                                                       \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_047: [ If on_complete is NULL then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall fail and return E_INVALIDARG. ]*/                              \
+    else if (on_complete == NULL)                                                                                                                                                           \
+    {                                                                                                                                                                                       \
+        LogError("Invalid arguments: handle=%p, H_FABRIC_ON_COMPLETE on_complete=%p", handle, on_complete);                                                                                 \
+        hr = E_INVALIDARG;                                                                                                                                                                  \
+    }                                                                                                                                                                                       \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_048: [ If the handle has no timer wheel then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall fail and return HRESULT_FROM_WIN32(ERROR_INVALID_STATE). ]*/ \
+    else if (handle->timerWheel == NULL)                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        LogError("handle=%p has no timer wheel, see " MU_TOSTRING(H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME)), handle);                                                        \
+        hr = HRESULT_FROM_WIN32(ERROR_INVALID_STATE);                                                                                                                                       \
+    }                                                                                                                                                                                       \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_049: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall allocate the state of the call. ]*/                                                        \
+    else if ((call = malloc(sizeof(MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)))) == NULL)                                                                                        \
+    {                                                                                                                                                                                       \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_050: [ If allocating the state of the call fails then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall fail and return E_OUTOFMEMORY. ]*/      \
+        LogError("failure in malloc(sizeof(" MU_TOSTRING(MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)) ")=%zu)", sizeof(MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _CALL)));   \
+        hr = E_OUTOFMEMORY;                                                                                                                                                                 \
+    }                                                                                                                                                                                       \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_051: [ If the circuit breaker of the handle rejects the call (h_fabric_circuit_breaker_enter) then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall free the state of the call, fail and return H_FABRIC_E_CIRCUIT_BREAKER_OPEN. ]*/ \
+    else if ((breakerEntry = h_fabric_circuit_breaker_enter(&handle->circuitBreaker)) == H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED)                                                           \
+    {                                                                                                                                                                                       \
+        LogError("circuit breaker of handle=%p is open, " MU_TOSTRING(IFABRIC_METHOD_NAME) "_async was not called", handle);                                                                \
+        free(call);                                                                                                                                                                         \
+        hr = H_FABRIC_E_CIRCUIT_BREAKER_OPEN;                                                                                                                                               \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _ARGS) callArgs;                                                                                                                     \
+        H_FABRIC_RETRY_STATE retryState = H_FABRIC_RETRY_STATE_INITIALIZER;                                                                                                                 \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_052: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall copy the inputs in the state of the call, record the start time by calling timer_global_get_elapsed_ms, initialize the timer of the call by calling timer_wheel_timer_init and pick the client that runs the call by calling h_fabric_client_pool_acquire. ]*/ \
+        ARGS_C_FIELDS_SET(in_args)                                                                                                                                                          \
+        call->args = callArgs;                                                                                                                                                              \
+        call->handle = handle;                                                                                                                                                              \
+        call->on_complete = on_complete;                                                                                                                                                    \
+        call->on_complete_context = on_complete_context;                                                                                                                                    \
+        call->breakerEntry = breakerEntry;                                                                                                                                                  \
+        call->startTime = timer_global_get_elapsed_ms();                                                                                                                                    \
+        call->tries = 0;                                                                                                                                                                    \
+        call->retryState = retryState;                                                                                                                                                      \
+        timer_wheel_timer_init(&call->retryTimer);                                                                                                                                          \
+        call->pooledClient = h_fabric_client_pool_acquire(&handle->clients);                                                                                                                \
+        call->failedGeneration = NULL;                                                                                                                                                      \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_053: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall start the first try and return S_OK, on_complete is called when the call completes. ]*/ \
+        MU_C2(H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME), _try)(call);                                                                                                                         \
+        hr = S_OK;                                                                                                                                                                          \
+    }                                                                                                                                                                                       \
+    return hr;                                                                                                                                                                              \
+}
+
+/*this macro expands to the full definition of H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME). See H_FABRIC_DEFINE_API_ASYNC_WITH_RESULTS.*/
+#define H_FABRIC_DEFINE_API_ASYNC(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args)                                                                                                     \
+    H_FABRIC_DEFINE_API_ASYNC_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, NONE())
 
 /*this macro expands to a full function definition. The name of the function is H_FABRIC_API(IFABRIC_METHOD_NAME) and it contains the code to run with retries.*/
 #define H_FABRIC_DEFINE_API_NO_SF_TIMEOUT_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, permanent_failures)                                                            \
@@ -309,51 +911,61 @@ HRESULT H_FABRIC_API(IFABRIC_METHOD_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME
 )                                                                                                                                                                                           \
 {                                                                                                                                                                                           \
     HRESULT hr; /*also used a result*/                                                                                                                                                      \
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY breakerEntry;                                                                                                                                            \
     /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_001: [ If handle is NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return NULL. ]*/                                                 \
     if (handle == NULL)                                                                                                                                                                     \
     {                                                                                                                                                                                       \
         LogError("invalid " MU_TOSTRING(HANDLE_TYPE) " handle=%p", handle);                                                                                                                 \
         hr = E_POINTER;                                                                                                                                                                     \
     }                                                                                                                                                                                       \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_040: [ If the circuit breaker of the handle rejects the call (h_fabric_circuit_breaker_enter) then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return H_FABRIC_E_CIRCUIT_BREAKER_OPEN without calling IFABRIC_METHOD_NAME. ]*/ \
+    else if ((breakerEntry = h_fabric_circuit_breaker_enter(&handle->circuitBreaker)) == H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED)                                                           \
+    {                                                                                                                                                                                       \
+        LogError("circuit breaker of handle=%p is open, " MU_TOSTRING(IFABRIC_METHOD_NAME) " was not called", handle);                                                                      \
+        hr = H_FABRIC_E_CIRCUIT_BREAKER_OPEN;                                                                                                                                               \
+    }                                                                                                                                                                                       \
     else                                                                                                                                                                                    \
     {                                                                                                                                                                                       \
-        uint32_t retries = 0; /*incremented at every API call - 0 means "it will call once", "1" means it will call 2 times". It is in the name: **re**tries.*/                             \
+        uint32_t tries = 0; /*incremented at every API call*/                                                                                                                               \
+        uint32_t delay;                                                                                                                                                                     \
+        H_FABRIC_RETRY_STATE retryState = H_FABRIC_RETRY_STATE_INITIALIZER;                                                                                                                 \
+        H_FABRIC_CLIENT_GENERATION* generation;                                                                                                                                             \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_033: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall pick the client of the handle that runs the call by calling h_fabric_client_pool_acquire. ]*/ \
+        H_FABRIC_CLIENT_POOL_ENTRY* pooledClient = h_fabric_client_pool_acquire(&handle->clients);                                                                                          \
                                                                                                                                                                                             \
-        do                                                                                                                                                                                  \
+        while (true)                                                                                                                                                                        \
         {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_018: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall take a reference on the current instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_acquire. ]*/ \
+            generation = h_fabric_client_holder_acquire(&pooledClient->holder);                                                                                                             \
+                                                                                                                                                                                            \
             /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_002: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall call IFABRIC_METHOD_NAME on the instance of IFABRIC_INTERFACE_NAME. ]*/                  \
-            hr = IFABRIC_METHOD_NAME(handle->This ARGS_C_CALL(in_args));                                                                                                                    \
+            hr = IFABRIC_METHOD_NAME((IFABRIC_INTERFACE_NAME*)generation->instance ARGS_C_CALL(in_args));                                                                                   \
+            tries++;                                                                                                                                                                        \
             if (FAILED(hr))                                                                                                                                                                 \
             {                                                                                                                                                                               \
-                LogHRESULTError(hr, "failure in " MU_TOSTRING(IFABRIC_METHOD_NAME) "(handle->This=%p, ...)",                                                                                \
-                    handle->This);                                                                                                                                                          \
+                LogHRESULTError(hr, "failure in " MU_TOSTRING(IFABRIC_METHOD_NAME) "(instance=%p (generation=%" PRIu32 "), ...)",                                                           \
+                    generation->instance, generation->generation);                                                                                                                          \
                                                                                                                                                                                             \
-                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_004: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME. ]*/ \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_004: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/ \
                 if ((hr == E_ABORT) || (hr == FABRIC_E_OBJECT_CLOSED) || (hr == FABRIC_E_GATEWAY_NOT_REACHABLE))                                                                            \
                 {                                                                                                                                                                           \
-                    IFABRIC_INTERFACE_NAME* newInstance = NULL;                                                                                                                             \
-                                                                                                                                                                                            \
-                    HRESULT hr_create;                                                                                                                                                      \
-                    hr_create = CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME)(&newInstance);                                                                                          \
-                    if (FAILED(hr_create))                                                                                                                                                  \
+                    /*only one thread recreates the instance that failed, the others wait for it and retry with the new instance*/                                                          \
+                    if (h_fabric_client_holder_recreate(&pooledClient->holder, generation) != 0)                                                                                            \
                     {                                                                                                                                                                       \
                         /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_005: [ If creating the new instance of IFABRIC_INTERFACE_NAME fails then H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the existing IFABRIC_INTERFACE_NAME. ]*/ \
-                        LogHRESULTError(hr_create, "failure in CREATE_IFABRICINSTANCE_NAME(" MU_TOSTRING(IFABRIC_INTERFACE_NAME) ")(&newInstance=%p)", &newInstance);                       \
+                        LogError("failure in h_fabric_client_holder_recreate(&pooledClient->holder=%p, generation=%p (generation=%" PRIu32 "))", &pooledClient->holder, generation, generation->generation); \
                         /*keep retrying until retry count is exceeded*/                                                                                                                                     \
                     }                                                                                                                                                                       \
                     else                                                                                                                                                                    \
                     {                                                                                                                                                                       \
-                        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_006: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall release the existing instance and shall retry using new newly created IFABRIC_INTERFACE_NAME. ]*/ \
-                        /*let go of the old instance*/                                                                                                                                      \
-                        (void)handle->This->lpVtbl->Release(handle->This);                                                                                                                  \
-                                                                                                                                                                                            \
-                        /*replace it with the new instance*/                                                                                                                                \
-                        handle->This = newInstance;                                                                                                                                         \
+                        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_006: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the new instance of IFABRIC_INTERFACE_NAME. ]*/        \
                     }                                                                                                                                                                       \
                 }                                                                                                                                                                           \
                 else if (0 RESULTS_CHECK(permanent_failures))                                                                                                                               \
                 {                                                                                                                                                                           \
                     /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_42_002: [ If the result is any value from permanent_failures then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return. ]*/              \
+                    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_019: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once IFABRIC_METHOD_NAME returned. ]*/ \
+                    h_fabric_client_holder_release(&pooledClient->holder, generation);                                                                                                      \
                     break;                                                                                                                                                                  \
                 }                                                                                                                                                                           \
                 else                                                                                                                                                                        \
@@ -365,19 +977,34 @@ HRESULT H_FABRIC_API(IFABRIC_METHOD_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME
             else                                                                                                                                                                            \
             {                                                                                                                                                                               \
                 /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_003: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/                                    \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_019: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once IFABRIC_METHOD_NAME returned. ]*/ \
+                h_fabric_client_holder_release(&pooledClient->holder, generation);                                                                                                          \
                 break;                                                                                                                                                                      \
             }                                                                                                                                                                               \
                                                                                                                                                                                             \
-            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep msBetweenRetries. ]*/                                                              \
-            ThreadAPI_Sleep(handle->msBetweenRetries);                                                                                                                                      \
-            retries++;                                                                                                                                                                      \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_019: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once IFABRIC_METHOD_NAME returned. ]*/ \
+            h_fabric_client_holder_release(&pooledClient->holder, generation);                                                                                                              \
+                                                                                                                                                                                            \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_011: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall call h_fabric_retry_policy_get_next_delay with the retry policy of the handle and UINT32_MAX as the time left. ]*/ \
+            if (!h_fabric_retry_policy_get_next_delay(&handle->retryPolicy, &retryState, UINT32_MAX, &delay))                                                                               \
+            {                                                                                                                                                                               \
+                /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_009: [ If h_fabric_retry_policy_get_next_delay returns false then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/ \
+                break;                                                                                                                                                                      \
+            }                                                                                                                                                                               \
                                                                                                                                                                                             \
-            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_009: [ If the total number of retries exceeds nMaxRetries then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/  \
-        } while (retries < handle->nMaxRetries);                                                                                                                                            \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay. ]*/                    \
+            ThreadAPI_Sleep(delay);                                                                                                                                                         \
+        }                                                                                                                                                                                   \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_034: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the client by calling h_fabric_client_pool_release once it stopped retrying. ]*/   \
+        h_fabric_client_pool_release(&handle->clients, pooledClient);                                                                                                                       \
+                                                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_041: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall report the result of the call to the circuit breaker of the handle by calling h_fabric_circuit_breaker_exit. ]*/ \
+        h_fabric_circuit_breaker_exit(&handle->circuitBreaker, breakerEntry, hr);                                                                                                           \
                                                                                                                                                                                             \
         if(FAILED(hr))                                                                                                                                                                      \
         {                                                                                                                                                                                   \
-            LogHRESULTError(hr, "tried for %" PRIu32 " times and it failed", retries);                                                                                                      \
+            LogHRESULTError(hr, "tried for %" PRIu32 " times and it failed", tries);                                                                                                        \
         }                                                                                                                                                                                   \
     }                                                                                                                                                                                       \
                                                                                                                                                                                             \
@@ -388,43 +1015,273 @@ HRESULT H_FABRIC_API(IFABRIC_METHOD_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME
 #define H_FABRIC_DEFINE_API_NO_SF_TIMEOUT(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args)                                                                                             \
     H_FABRIC_DEFINE_API_NO_SF_TIMEOUT_WITH_RESULTS(IFABRIC_INTERFACE_NAME, IFABRIC_METHOD_NAME, in_args, NONE())
 
-/*this macro introduces the declaration for _create for the IFabric type wrapper*/                                                                                                          \
+/*this macro introduces the declaration for _create for the IFabric type wrapper*/
 #define H_FABRIC_DECLARE_CREATE(IFABRIC_INTERFACE_NAME)                                                                                                                                     \
     MOCKABLE_FUNCTION(, H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME), uint32_t, nMaxRetries, uint32_t, msBetweenRetries);                        \
+    MOCKABLE_FUNCTION(, H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFABRIC_INTERFACE_NAME), const H_FABRIC_RETRY_POLICY*, retryPolicy);              \
+    MOCKABLE_FUNCTION(, H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME), uint32_t, clientCount, H_FABRIC_CLIENT_POOL_SELECTION, selection, const H_FABRIC_RETRY_POLICY*, retryPolicy); \
+    MOCKABLE_FUNCTION(, int, H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME), H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), handle, uint32_t, failurePercent, uint32_t, minimumCalls, uint32_t, windowMs, uint32_t, openMs); \
+    MOCKABLE_FUNCTION(, int, H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME), H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), handle, uint32_t, percentile, uint32_t, minimumSamples, uint32_t, minimumDelayMs, THANDLE(THREADPOOL), threadpool); \
+    MOCKABLE_FUNCTION(, int, H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME), H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), handle, TIMER_WHEEL_HANDLE, timerWheel);                     \
 
 /*this macro introduces the definition for _create of for the IFabric type wrapper*/
 #define H_FABRIC_DEFINE_CREATE(IFABRIC_INTERFACE_NAME)                                                                                                                                      \
+static HRESULT MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _create_instance)(void** instance)                                                                                            \
+{                                                                                                                                                                                           \
+    IFABRIC_INTERFACE_NAME* newInstance;                                                                                                                                                    \
+    HRESULT result = CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME)(&newInstance);                                                                                                     \
+    if (SUCCEEDED(result))                                                                                                                                                                  \
+    {                                                                                                                                                                                       \
+        *instance = newInstance;                                                                                                                                                            \
+    }                                                                                                                                                                                       \
+    return result;                                                                                                                                                                          \
+}                                                                                                                                                                                           \
+                                                                                                                                                                                            \
+static void MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _release_instance)(void* instance)                                                                                               \
+{                                                                                                                                                                                           \
+    IFABRIC_INTERFACE_NAME* This = (IFABRIC_INTERFACE_NAME*)instance;                                                                                                                       \
+    (void)This->lpVtbl->Release(This);                                                                                                                                                      \
+}                                                                                                                                                                                           \
+                                                                                                                                                                                            \
+/*on_done of h_fabric_hedge_execute for the hedged APIs of the handle, H_FABRIC_HANDLE_DESTROY waits for it*/                                                                               \
+static void MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _on_hedged_call_done)(void* context)                                                                                             \
+{                                                                                                                                                                                           \
+    H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle = context;                                                                                                                               \
+    if (interlocked_decrement(&handle->hedgedCalls) == 0)                                                                                                                                   \
+    {                                                                                                                                                                                       \
+        wake_by_address_single(&handle->hedgedCalls);                                                                                                                                       \
+    }                                                                                                                                                                                       \
+}                                                                                                                                                                                           \
+                                                                                                                                                                                            \
+/*the function of the retry worker of the handle, it continues the _async calls whose delay before the next try elapsed*/                                                                   \
+static void MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _run_retries)(void* context)                                                                                                     \
+{                                                                                                                                                                                           \
+    H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle = context;                                                                                                                               \
+    H_FABRIC_ASYNC_RETRY* queued;                                                                                                                                                           \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_083: [ The retry worker of the handle shall take all the queued calls out of the queue of the handle, continue them in the order they were queued and look at the queue again, until it is empty. ]*/ \
+    while ((queued = interlocked_exchange_pointer(&handle->retryQueue, NULL)) != NULL)                                                                                                      \
+    {                                                                                                                                                                                       \
+        H_FABRIC_ASYNC_RETRY* ordered = NULL;                                                                                                                                               \
+        while (queued != NULL)                                                                                                                                                              \
+        {                                                                                                                                                                                   \
+            H_FABRIC_ASYNC_RETRY* next = queued->next;                                                                                                                                      \
+            queued->next = ordered;                                                                                                                                                         \
+            ordered = queued;                                                                                                                                                               \
+            queued = next;                                                                                                                                                                  \
+        }                                                                                                                                                                                   \
+        while (ordered != NULL)                                                                                                                                                             \
+        {                                                                                                                                                                                   \
+            /*run might free the call that holds ordered*/                                                                                                                                  \
+            H_FABRIC_ASYNC_RETRY* next = ordered->next;                                                                                                                                     \
+            ordered->run(ordered);                                                                                                                                                          \
+            ordered = next;                                                                                                                                                                 \
+        }                                                                                                                                                                                   \
+    }                                                                                                                                                                                       \
+}                                                                                                                                                                                           \
+                                                                                                                                                                                            \
+H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME)(uint32_t clientCount, H_FABRIC_CLIENT_POOL_SELECTION selection, const H_FABRIC_RETRY_POLICY* retryPolicy) \
+{                                                                                                                                                                                           \
+    H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) result;                                                                                                                                         \
+    if (                                                                                                                                                                                    \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_036: [ If clientCount is 0 then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/                       \
+        (clientCount == 0) ||                                                                                                                                                               \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_012: [ If retryPolicy is NULL then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/                    \
+        (retryPolicy == NULL)                                                                                                                                                               \
+        )                                                                                                                                                                                   \
+    {                                                                                                                                                                                       \
+        LogError("invalid arguments uint32_t clientCount=%" PRIu32 ", H_FABRIC_CLIENT_POOL_SELECTION selection=%" PRI_MU_ENUM ", const H_FABRIC_RETRY_POLICY* retryPolicy=%p",              \
+            clientCount, MU_ENUM_VALUE(H_FABRIC_CLIENT_POOL_SELECTION, selection), retryPolicy);                                                                                            \
+        result = NULL;                                                                                                                                                                      \
+    }                                                                                                                                                                                       \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_013: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall allocate memory to hold a copy of retryPolicy and clientCount clients. ]*/   \
+    else if ((result = malloc_flex(sizeof(H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)), clientCount, sizeof(H_FABRIC_CLIENT_POOL_ENTRY))) == NULL)                                  \
+    {                                                                                                                                                                                       \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_015: [ If there are any failures then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/                 \
+        LogError("failure in malloc_flex(sizeof(" MU_TOSTRING(H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)) ")=%zu, clientCount=%" PRIu32 ", sizeof(H_FABRIC_CLIENT_POOL_ENTRY)=%zu)", \
+            sizeof(H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)), clientCount, sizeof(H_FABRIC_CLIENT_POOL_ENTRY));                                                                  \
+        /*return as is*/                                                                                                                                                                    \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_014: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall create clientCount instances of IFABRIC_INTERFACE_NAME by calling CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME). ]*/ \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_020: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall hand the instances of IFABRIC_INTERFACE_NAME to the client pool of the handle by calling h_fabric_client_pool_init with clientCount and selection. ]*/ \
+        if (h_fabric_client_pool_init(&result->clients, result->clientEntries, clientCount, selection, MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _create_instance), MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _release_instance)) != 0) \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_015: [ If there are any failures then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/             \
+            LogError("failure in h_fabric_client_pool_init(&result->clients=%p, result->clientEntries=%p, clientCount=%" PRIu32 ", selection=%" PRI_MU_ENUM ", ...)",                       \
+                &result->clients, result->clientEntries, clientCount, MU_ENUM_VALUE(H_FABRIC_CLIENT_POOL_SELECTION, selection));                                                            \
+            free(result);                                                                                                                                                                   \
+            result = NULL;                                                                                                                                                                  \
+        }                                                                                                                                                                                   \
+        else                                                                                                                                                                                \
+        {                                                                                                                                                                                   \
+            result->retryPolicy = *retryPolicy;                                                                                                                                             \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_029: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall initialize the single flight group of the handle by calling h_fabric_single_flight_init. ]*/ \
+            h_fabric_single_flight_init(&result->singleFlight);                                                                                                                             \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_037: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall initialize the circuit breaker of the handle as disabled by calling h_fabric_circuit_breaker_init, and create the handle with no hedging and no timer wheel. ]*/ \
+            H_FABRIC_CIRCUIT_BREAKER_CONFIG noCircuitBreaker = { 0 };                                                                                                                       \
+            h_fabric_circuit_breaker_init(&result->circuitBreaker, &noCircuitBreaker);                                                                                                      \
+            result->hedgeConfig.percentile = 0;                                                                                                                                             \
+            result->hedgeConfig.minimum_samples = 0;                                                                                                                                        \
+            result->hedgeConfig.minimum_delay_ms = 0;                                                                                                                                       \
+            result->timerWheel = NULL;                                                                                                                                                      \
+            (void)interlocked_exchange(&result->hedgedCalls, 0);                                                                                                                            \
+            result->retryWorker = NULL;                                                                                                                                                     \
+            (void)interlocked_exchange_pointer(&result->retryQueue, NULL);                                                                                                                  \
+        }                                                                                                                                                                                   \
+    }                                                                                                                                                                                       \
+    return result;                                                                                                                                                                          \
+}                                                                                                                                                                                           \
+                                                                                                                                                                                            \
+H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFABRIC_INTERFACE_NAME)(const H_FABRIC_RETRY_POLICY* retryPolicy)                                          \
+{                                                                                                                                                                                           \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_035: [ H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFABRIC_INTERFACE_NAME) shall create a handle with 1 client by calling H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) and return it. ]*/ \
+    return H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME)(1, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, retryPolicy);                                                           \
+}                                                                                                                                                                                           \
+                                                                                                                                                                                            \
 H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME)(uint32_t nMaxRetries, uint32_t msBetweenRetries)                                                     \
 {                                                                                                                                                                                           \
     H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) result;                                                                                                                                         \
-    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_001: [ H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall allocate memory to hold nMaxRetries, msBetweenRetries and an instance of IFABRIC_INTERFACE_NAME. ]*/ \
-    result = malloc(sizeof(H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)));                                                                                                           \
-    if (result == NULL)                                                                                                                                                                     \
+    H_FABRIC_RETRY_POLICY retryPolicy;                          \
+    /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_001: [ H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall initialize a fixed delay retry policy of nMaxRetries tries and msBetweenRetries by calling h_fabric_retry_policy_init_fixed. ]*/ \
+    if (h_fabric_retry_policy_init_fixed(&retryPolicy, nMaxRetries, msBetweenRetries) != 0)                                                                                                 \
     {                                                                                                                                                                                       \
         /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_003: [ If there are any failures then H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/                        \
-        LogError("failure in malloc(sizeof(" MU_TOSTRING(H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)) ")=%zu)", sizeof(H_FABRIC_HANDLE_STRUCT_TYPE(IFABRIC_INTERFACE_NAME)));       \
-        /*return as is*/                                                                                                                                                                    \
+        LogError("failure in h_fabric_retry_policy_init_fixed(&retryPolicy=%p, nMaxRetries=%" PRIu32 ", msBetweenRetries=%" PRIu32 ")", &retryPolicy, nMaxRetries, msBetweenRetries);       \
+        result = NULL;                                                                                                                                                                      \
     }                                                                                                                                                                                       \
     else                                                                                                                                                                                    \
     {                                                                                                                                                                                       \
-        result->This = NULL;                                                                                                                                                                \
-        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_002: [ H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME by calling CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME). ]*/ \
-        HRESULT hr = CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME)(&result->This);                                                                                                    \
-        if (FAILED(hr))                                                                                                                                                                     \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_002: [ H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall create the handle by calling H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFABRIC_INTERFACE_NAME). ]*/ \
+        result = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFABRIC_INTERFACE_NAME)(&retryPolicy);                                                                                            \
+        if (result == NULL)                                                                                                                                                                 \
         {                                                                                                                                                                                   \
             /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_003: [ If there are any failures then H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/                    \
-            LogHRESULTError(hr, "failure in CREATE_IFABRICINSTANCE_NAME(" MU_TOSTRING(IFABRIC_INTERFACE_NAME) ")(&result->This=%p))", &result->This);                                       \
+            LogError("failure in " MU_TOSTRING(H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFABRIC_INTERFACE_NAME)) "(&retryPolicy=%p)", &retryPolicy);                                        \
+        }                                                                                                                                                                                   \
+    }                                                                                                                                                                                       \
+    return result;                                                                                                                                                                          \
+}                                                                                                                                                                                           \
+                                                                                                                                                                                            \
+int H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle, uint32_t failurePercent, uint32_t minimumCalls, uint32_t windowMs, uint32_t openMs) \
+{                                                                                                                                                                                           \
+    int result;                                                                                                                                                                             \
+    if (                                                                                                                                                                                    \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_069: [ If handle is NULL then H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/       \
+        (handle == NULL) ||                                                                                                                                                                 \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_070: [ If failurePercent is 0 or greater than 100 then H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/ \
+        (failurePercent == 0) ||                                                                                                                                                            \
+        (failurePercent > 100) ||                                                                                                                                                           \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_071: [ If minimumCalls is 0 then H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/    \
+        (minimumCalls == 0) ||                                                                                                                                                              \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_072: [ If windowMs is 0 then H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/        \
+        (windowMs == 0)                                                                                                                                                                     \
+        )                                                                                                                                                                                   \
+    {                                                                                                                                                                                       \
+        LogError("invalid arguments " MU_TOSTRING(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME)) " handle=%p, uint32_t failurePercent=%" PRIu32 ", uint32_t minimumCalls=%" PRIu32 ", uint32_t windowMs=%" PRIu32 ", uint32_t openMs=%" PRIu32 "", \
+            handle, failurePercent, minimumCalls, windowMs, openMs);                                                                                                                        \
+        result = MU_FAILURE;                                                                                                                                                                \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_073: [ H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall initialize the circuit breaker of the handle with failurePercent, minimumCalls, windowMs and openMs by calling h_fabric_circuit_breaker_init and return 0. ]*/ \
+        H_FABRIC_CIRCUIT_BREAKER_CONFIG config;                                                                                                                                             \
+        config.failure_percent = failurePercent;                                                                                                                                            \
+        config.minimum_calls = minimumCalls;                                                                                                                                                \
+        config.window_ms = windowMs;                                                                                                                                                        \
+        config.open_ms = openMs;                                                                                                                                                            \
+        h_fabric_circuit_breaker_init(&handle->circuitBreaker, &config);                                                                                                                    \
+        result = 0;                                                                                                                                                                         \
+    }                                                                                                                                                                                       \
+    return result;                                                                                                                                                                          \
+}                                                                                                                                                                                           \
+                                                                                                                                                                                            \
+int H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle, uint32_t percentile, uint32_t minimumSamples, uint32_t minimumDelayMs, THANDLE(THREADPOOL) threadpool) \
+{                                                                                                                                                                                           \
+    int result;                                                                                                                                                                             \
+    if (                                                                                                                                                                                    \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_074: [ If handle is NULL then H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/               \
+        (handle == NULL) ||                                                                                                                                                                 \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_075: [ If percentile is 0 or greater than 100 then H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/ \
+        (percentile == 0) ||                                                                                                                                                                \
+        (percentile > 100) ||                                                                                                                                                               \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_076: [ If minimumSamples is 0 then H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/          \
+        (minimumSamples == 0) ||                                                                                                                                                            \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_088: [ If threadpool is NULL then H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/           \
+        (threadpool == NULL)                                                                                                                                                                \
+        )                                                                                                                                                                                   \
+    {                                                                                                                                                                                       \
+        LogError("invalid arguments " MU_TOSTRING(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME)) " handle=%p, uint32_t percentile=%" PRIu32 ", uint32_t minimumSamples=%" PRIu32 ", uint32_t minimumDelayMs=%" PRIu32 ", THANDLE(THREADPOOL) threadpool=%p", \
+            handle, percentile, minimumSamples, minimumDelayMs, threadpool);                                                                                                                \
+        result = MU_FAILURE;                                                                                                                                                                \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_089: [ H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall keep a reference on threadpool, which runs the second runs of the hedged calls. ]*/ \
+        if (handle->hedgeConfig.percentile == 0)                                                                                                                                            \
+        {                                                                                                                                                                                   \
+            /*the first time hedging is set*/                                                                                                                                               \
+            THANDLE_INITIALIZE(THREADPOOL)(&handle->threadpool, threadpool);                                                                                                                \
         }                                                                                                                                                                                   \
         else                                                                                                                                                                                \
         {                                                                                                                                                                                   \
-            result->nMaxRetries = nMaxRetries;                                                                                                                                              \
-            result->msBetweenRetries = msBetweenRetries;                                                                                                                                    \
-            goto allok;                                                                                                                                                                     \
+            THANDLE_ASSIGN(THREADPOOL)(&handle->threadpool, threadpool);                                                                                                                    \
+        }                                                                                                                                                                                   \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_077: [ H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall set the hedging configuration of the handle to percentile, minimumSamples and minimumDelayMs and return 0. ]*/ \
+        handle->hedgeConfig.percentile = percentile;                                                                                                                                        \
+        handle->hedgeConfig.minimum_samples = minimumSamples;                                                                                                                               \
+        handle->hedgeConfig.minimum_delay_ms = minimumDelayMs;                                                                                                                              \
+        result = 0;                                                                                                                                                                         \
+    }                                                                                                                                                                                       \
+    return result;                                                                                                                                                                          \
+}                                                                                                                                                                                           \
+                                                                                                                                                                                            \
+int H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME)(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME) handle, TIMER_WHEEL_HANDLE timerWheel)                                                  \
+{                                                                                                                                                                                           \
+    int result;                                                                                                                                                                             \
+    if (                                                                                                                                                                                    \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_078: [ If handle is NULL then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/           \
+        (handle == NULL) ||                                                                                                                                                                 \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_079: [ If timerWheel is NULL then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/       \
+        (timerWheel == NULL)                                                                                                                                                                \
+        )                                                                                                                                                                                   \
+    {                                                                                                                                                                                       \
+        LogError("invalid arguments " MU_TOSTRING(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME)) " handle=%p, TIMER_WHEEL_HANDLE timerWheel=%p", handle, timerWheel);                             \
+        result = MU_FAILURE;                                                                                                                                                                \
+    }                                                                                                                                                                                       \
+    else                                                                                                                                                                                    \
+    {                                                                                                                                                                                       \
+        if (handle->retryWorker == NULL)                                                                                                                                                    \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_084: [ If the handle has no retry worker yet then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall create it by calling worker_thread_create and start it by calling worker_thread_open. ]*/ \
+            handle->retryWorker = worker_thread_create(MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _run_retries), handle);                                                               \
+            if (handle->retryWorker == NULL)                                                                                                                                                \
+            {                                                                                                                                                                               \
+                LogError("failure in worker_thread_create(" MU_TOSTRING(MU_C2(H_FABRIC_HANDLE(IFABRIC_INTERFACE_NAME), _run_retries)) ", handle=%p)", handle);                              \
+            }                                                                                                                                                                               \
+            else if (worker_thread_open(handle->retryWorker) != 0)                                                                                                                          \
+            {                                                                                                                                                                               \
+                LogError("failure in worker_thread_open(handle->retryWorker=%p)", handle->retryWorker);                                                                                     \
+                worker_thread_destroy(handle->retryWorker);                                                                                                                                 \
+                handle->retryWorker = NULL;                                                                                                                                                 \
+            }                                                                                                                                                                               \
+            else                                                                                                                                                                            \
+            {                                                                                                                                                                               \
+                /*all ok*/                                                                                                                                                                  \
+            }                                                                                                                                                                               \
+        }                                                                                                                                                                                   \
+        if (handle->retryWorker == NULL)                                                                                                                                                    \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_085: [ If there are any failures then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/ \
+            result = MU_FAILURE;                                                                                                                                                            \
+        }                                                                                                                                                                                   \
+        else                                                                                                                                                                                \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_080: [ H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall set the timer wheel of the handle to timerWheel and return 0. ]*/  \
+            handle->timerWheel = timerWheel;                                                                                                                                                \
+            result = 0;                                                                                                                                                                     \
         }                                                                                                                                                                                   \
-        free(result);                                                                                                                                                                       \
-        result = NULL;                                                                                                                                                                      \
     }                                                                                                                                                                                       \
-allok:                                                                                                                                                                                      \
     return result;                                                                                                                                                                          \
 }                                                                                                                                                                                           \
 
@@ -444,8 +1301,34 @@ void H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME)(H_FABRIC_HANDLE(IFABRIC_INT
     }                                                                                                                                                                                       \
     else                                                                                                                                                                                    \
     {                                                                                                                                                                                       \
-        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_005: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall call ->Release() on the instance of IFABRIC_INTERFACE_NAME. ]*/                \
-        (void)handle->This->lpVtbl->Release(handle->This);                                                                                                                                  \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_005: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall release the instances of IFABRIC_INTERFACE_NAME by calling h_fabric_client_pool_deinit. ]*/ \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_030: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall deinitialize the single flight group of the handle by calling h_fabric_single_flight_deinit. ]*/\
+        h_fabric_single_flight_deinit(&handle->singleFlight);                                                                                                                               \
+        /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_091: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall wait until the hedged calls of the handle are done by calling InterlockedHL_WaitForValue. ]*/ \
+        /*the run of a hedged call that lost completes after its call returned*/                                                                                                            \
+        int32_t hedgedCalls;                                                                                                                                                                \
+        while ((hedgedCalls = interlocked_add(&handle->hedgedCalls, 0)) != 0)                                                                                                               \
+        {                                                                                                                                                                                   \
+            INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&handle->hedgedCalls, 0, UINT32_MAX);                                                                            \
+            if (wait_result != INTERLOCKED_HL_OK)                                                                                                                                           \
+            {                                                                                                                                                                               \
+                LogError("failure in InterlockedHL_WaitForValue(&handle->hedgedCalls=%p, 0, UINT32_MAX), hedgedCalls=%" PRId32 ", INTERLOCKED_HL_RESULT wait_result=%d",                    \
+                    &handle->hedgedCalls, hedgedCalls, (int)wait_result);                                                                                                                   \
+                /*look again*/                                                                                                                                                              \
+            }                                                                                                                                                                               \
+        }                                                                                                                                                                                   \
+        if (handle->hedgeConfig.percentile != 0)                                                                                                                                            \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_092: [ If hedging was set then H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall release the threadpool of the handle. ]*/          \
+            THANDLE_ASSIGN(THREADPOOL)(&handle->threadpool, NULL);                                                                                                                          \
+        }                                                                                                                                                                                   \
+        if (handle->retryWorker != NULL)                                                                                                                                                    \
+        {                                                                                                                                                                                   \
+            /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_01_086: [ If the handle has a retry worker then H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall stop it by calling worker_thread_close and worker_thread_destroy. ]*/ \
+            worker_thread_close(handle->retryWorker);                                                                                                                                       \
+            worker_thread_destroy(handle->retryWorker);                                                                                                                                     \
+        }                                                                                                                                                                                   \
+        h_fabric_client_pool_deinit(&handle->clients);                                                                                                                                      \
         /*Codes_SRS_H_FABRIC_MACRO_GENERATOR_02_006: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall free the allocated memory. ]*/                                                 \
         free(handle);                                                                                                                                                                       \
     }                                                                                                                                                                                       \
@@ -0,0 +1,46 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_PAGED_QUERY_ITERATOR_H
+#define H_FABRIC_PAGED_QUERY_ITERATOR_H
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+
+#include "hfabricqueryclient10.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*the query that is paged, and so the type of its query_description and of the items handed out*/
+#define H_FABRIC_PAGED_QUERY_KIND_VALUES \
+    H_FABRIC_PAGED_QUERY_KIND_APPLICATION_TYPE, /*PAGED_FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION, FABRIC_APPLICATION_TYPE_QUERY_RESULT_ITEM*/ \
+    H_FABRIC_PAGED_QUERY_KIND_DEPLOYED_APPLICATION, /*FABRIC_PAGED_DEPLOYED_APPLICATION_QUERY_DESCRIPTION, FABRIC_DEPLOYED_APPLICATION_QUERY_RESULT_ITEM*/ \
+    H_FABRIC_PAGED_QUERY_KIND_NODE, /*FABRIC_NODE_QUERY_DESCRIPTION, FABRIC_NODE_QUERY_RESULT_ITEM*/ \
+    H_FABRIC_PAGED_QUERY_KIND_SERVICE, /*FABRIC_SERVICE_QUERY_DESCRIPTION, FABRIC_SERVICE_QUERY_RESULT_ITEM*/ \
+    H_FABRIC_PAGED_QUERY_KIND_PARTITION, /*FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION, FABRIC_SERVICE_PARTITION_QUERY_RESULT_ITEM*/ \
+    H_FABRIC_PAGED_QUERY_KIND_REPLICA /*FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION, FABRIC_SERVICE_REPLICA_QUERY_RESULT_ITEM*/
+
+MU_DEFINE_ENUM(H_FABRIC_PAGED_QUERY_KIND, H_FABRIC_PAGED_QUERY_KIND_VALUES)
+
+    typedef struct H_FABRIC_PAGED_QUERY_ITERATOR_TAG* H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE;
+
+    MOCKABLE_FUNCTION(, H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE, h_fabric_paged_query_iterator_create, H_FABRIC_HANDLE(IFabricQueryClient10), client, THANDLE(THREADPOOL), threadpool, H_FABRIC_PAGED_QUERY_KIND, kind, const void*, query_description, DWORD, timeoutMilliseconds);
+    MOCKABLE_FUNCTION(, void, h_fabric_paged_query_iterator_destroy, H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE, iterator);
+
+    /*S_OK and *item is valid until the next call, S_FALSE when there are no more items, any other value is the error of the query*/
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_paged_query_iterator_next, H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE, iterator, const void**, item);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_PAGED_QUERY_ITERATOR_H*/
@@ -0,0 +1,62 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_QUERY_CACHE_H
+#define H_FABRIC_QUERY_CACHE_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+
+#include "hfabricqueryclient10.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*the queries that can be cached*/
+#define H_FABRIC_QUERY_CACHE_API_VALUES \
+    H_FABRIC_QUERY_CACHE_API_GET_NODE_LIST, \
+    H_FABRIC_QUERY_CACHE_API_GET_APPLICATION_LIST, \
+    H_FABRIC_QUERY_CACHE_API_GET_SERVICE_LIST, \
+    H_FABRIC_QUERY_CACHE_API_GET_PARTITION_LIST, \
+    H_FABRIC_QUERY_CACHE_API_GET_CLUSTER_LOAD_INFORMATION, \
+    H_FABRIC_QUERY_CACHE_API_GET_NODE_LOAD_INFORMATION, \
+    H_FABRIC_QUERY_CACHE_API_GET_PARTITION_LOAD_INFORMATION
+
+MU_DEFINE_ENUM(H_FABRIC_QUERY_CACHE_API, H_FABRIC_QUERY_CACHE_API_VALUES)
+
+    typedef struct H_FABRIC_QUERY_CACHE_TAG* H_FABRIC_QUERY_CACHE_HANDLE;
+
+    MOCKABLE_FUNCTION(, H_FABRIC_QUERY_CACHE_HANDLE, h_fabric_query_cache_create, H_FABRIC_HANDLE(IFabricQueryClient10), client, THANDLE(THREADPOOL), threadpool, uint32_t, shard_count, uint32_t, buckets_per_shard);
+    MOCKABLE_FUNCTION(, void, h_fabric_query_cache_destroy, H_FABRIC_QUERY_CACHE_HANDLE, cache);
+
+    /*ttl_ms 0 means the results of api are not cached. stale_ms is for how long past ttl_ms a result is still handed out while it is refreshed in the background*/
+    MOCKABLE_FUNCTION(, int, h_fabric_query_cache_configure, H_FABRIC_QUERY_CACHE_HANDLE, cache, H_FABRIC_QUERY_CACHE_API, api, uint32_t, ttl_ms, uint32_t, stale_ms);
+
+    /*same as the HFQC10_ APIs, the result is shared with the cache and with the other callers, it has to be released by the caller*/
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_query_cache_GetNodeList, H_FABRIC_QUERY_CACHE_HANDLE, cache, const FABRIC_NODE_QUERY_DESCRIPTION*, queryDescription, DWORD, timeoutMilliseconds, IFabricGetNodeListResult**, result);
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_query_cache_GetApplicationList, H_FABRIC_QUERY_CACHE_HANDLE, cache, const FABRIC_APPLICATION_QUERY_DESCRIPTION*, queryDescription, DWORD, timeoutMilliseconds, IFabricGetApplicationListResult**, result);
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_query_cache_GetServiceList, H_FABRIC_QUERY_CACHE_HANDLE, cache, const FABRIC_SERVICE_QUERY_DESCRIPTION*, queryDescription, DWORD, timeoutMilliseconds, IFabricGetServiceListResult**, result);
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_query_cache_GetPartitionList, H_FABRIC_QUERY_CACHE_HANDLE, cache, const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION*, queryDescription, DWORD, timeoutMilliseconds, IFabricGetPartitionListResult**, result);
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_query_cache_GetClusterLoadInformation, H_FABRIC_QUERY_CACHE_HANDLE, cache, DWORD, timeoutMilliseconds, IFabricGetClusterLoadInformationResult**, result);
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_query_cache_GetNodeLoadInformation, H_FABRIC_QUERY_CACHE_HANDLE, cache, const FABRIC_NODE_LOAD_INFORMATION_QUERY_DESCRIPTION*, queryDescription, DWORD, timeoutMilliseconds, IFabricGetNodeLoadInformationResult**, result);
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_query_cache_GetPartitionLoadInformation, H_FABRIC_QUERY_CACHE_HANDLE, cache, const FABRIC_PARTITION_LOAD_INFORMATION_QUERY_DESCRIPTION*, queryDescription, DWORD, timeoutMilliseconds, IFabricGetPartitionLoadInformationResult**, result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_QUERY_CACHE_H*/
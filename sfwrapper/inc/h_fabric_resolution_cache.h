@@ -0,0 +1,38 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_RESOLUTION_CACHE_H
+#define H_FABRIC_RESOLUTION_CACHE_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+
+#include "hfabricservicemanagementclient6.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    typedef struct H_FABRIC_RESOLUTION_CACHE_TAG* H_FABRIC_RESOLUTION_CACHE_HANDLE;
+
+    MOCKABLE_FUNCTION(, H_FABRIC_RESOLUTION_CACHE_HANDLE, h_fabric_resolution_cache_create, H_FABRIC_HANDLE(IFabricServiceManagementClient6), client, THANDLE(THREADPOOL), threadpool, uint32_t, shard_count, uint32_t, buckets_per_shard, uint32_t, idle_ms);
+    MOCKABLE_FUNCTION(, void, h_fabric_resolution_cache_destroy, H_FABRIC_RESOLUTION_CACHE_HANDLE, cache);
+
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_resolution_cache_resolve, H_FABRIC_RESOLUTION_CACHE_HANDLE, cache, FABRIC_URI, name, FABRIC_PARTITION_KEY_TYPE, partitionKeyType, const void*, partitionKey, DWORD, timeoutMilliseconds, IFabricResolvedServicePartitionResult**, resolveServicePartitionResult);
+    MOCKABLE_FUNCTION(, int, h_fabric_resolution_cache_invalidate, H_FABRIC_RESOLUTION_CACHE_HANDLE, cache, FABRIC_URI, name, FABRIC_PARTITION_KEY_TYPE, partitionKeyType, const void*, partitionKey);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_RESOLUTION_CACHE_H*/
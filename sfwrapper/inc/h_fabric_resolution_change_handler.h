@@ -0,0 +1,28 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_RESOLUTION_CHANGE_HANDLER_H
+#define H_FABRIC_RESOLUTION_CHANGE_HANDLER_H
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "umock_c/umock_c_prod.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    typedef void (*ON_RESOLUTION_CHANGE)(void* context, LONGLONG handlerId, IFabricResolvedServicePartitionResult* partition, HRESULT error);
+    typedef struct H_FABRIC_RESOLUTION_CHANGE_HANDLER_TAG* H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE;
+
+    MOCKABLE_FUNCTION(, H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE, h_fabric_resolution_change_handler_create, ON_RESOLUTION_CHANGE, on_resolution_change, void*, on_resolution_change_context);
+    MOCKABLE_FUNCTION(, void, h_fabric_resolution_change_handler_destroy, H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE, h_fabric_resolution_change_handler);
+    MOCKABLE_FUNCTION(, void, h_fabric_resolution_change_handler_close, H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE, h_fabric_resolution_change_handler);
+    MOCKABLE_FUNCTION(, void, h_fabric_resolution_change_handler_OnChange, H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE, h_fabric_resolution_change_handler, IFabricServiceManagementClient*, source, LONGLONG, handlerId, IFabricResolvedServicePartitionResult*, partition, HRESULT, error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_FABRIC_RESOLUTION_CHANGE_HANDLER_H */
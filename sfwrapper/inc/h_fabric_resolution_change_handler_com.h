@@ -0,0 +1,32 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_RESOLUTION_CHANGE_HANDLER_COM_H
+#define H_FABRIC_RESOLUTION_CHANGE_HANDLER_COM_H
+
+#include "windows.h"
+#include "unknwn.h"
+#include "fabricclient.h"
+#include "com_wrapper/com_wrapper.h"
+
+#include "h_fabric_resolution_change_handler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_INTERFACES \
+    COM_WRAPPER_INTERFACE(IUnknown, \
+        COM_WRAPPER_IUNKNOWN_APIS() \
+    ), \
+    COM_WRAPPER_INTERFACE(IFabricServicePartitionResolutionChangeHandler, \
+        COM_WRAPPER_IUNKNOWN_APIS(), \
+        COM_WRAPPER_FUNCTION_WRAPPER(void, h_fabric_resolution_change_handler_OnChange, IFabricServiceManagementClient*, source, LONGLONG, handlerId, IFabricResolvedServicePartitionResult*, partition, HRESULT, error) \
+    )
+
+    DECLARE_COM_WRAPPER_OBJECT(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE, H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_INTERFACES);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_FABRIC_RESOLUTION_CHANGE_HANDLER_COM_H */
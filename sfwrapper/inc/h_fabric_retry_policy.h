@@ -0,0 +1,65 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_RETRY_POLICY_H
+#define H_FABRIC_RETRY_POLICY_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#include <stdbool.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define H_FABRIC_RETRY_POLICY_TYPE_VALUES \
+    H_FABRIC_RETRY_POLICY_TYPE_FIXED, \
+    H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL, \
+    H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER, \
+    H_FABRIC_RETRY_POLICY_TYPE_CUSTOM
+
+MU_DEFINE_ENUM(H_FABRIC_RETRY_POLICY_TYPE, H_FABRIC_RETRY_POLICY_TYPE_VALUES)
+
+/*computes the delay before retry number "retry" (1 based) for a H_FABRIC_RETRY_POLICY_TYPE_CUSTOM policy*/
+typedef uint32_t (*H_FABRIC_RETRY_POLICY_COMPUTE_DELAY)(void* context, uint32_t retry, uint32_t previous_delay_ms);
+
+/*the retry policy is a value type, it is copied in the H_FABRIC_HANDLE at creation time*/
+typedef struct H_FABRIC_RETRY_POLICY_TAG
+{
+    H_FABRIC_RETRY_POLICY_TYPE type;
+    uint32_t max_tries; /*maximum number of calls, same meaning as nMaxRetries of H_FABRIC_HANDLE_CREATE*/
+    uint32_t base_delay_ms;
+    uint32_t max_delay_ms; /*cap for EXPONENTIAL and DECORRELATED_JITTER*/
+    uint32_t retry_budget_ms; /*maximum time spent sleeping between retries for one call, 0 means no budget*/
+    H_FABRIC_RETRY_POLICY_COMPUTE_DELAY compute_delay;
+    void* compute_delay_context;
+} H_FABRIC_RETRY_POLICY;
+
+/*per call state, lives on the stack of the H_FABRIC_API*/
+typedef struct H_FABRIC_RETRY_STATE_TAG
+{
+    uint32_t tries;
+    uint32_t previous_delay_ms;
+    uint32_t total_delay_ms;
+} H_FABRIC_RETRY_STATE;
+
+#define H_FABRIC_RETRY_STATE_INITIALIZER { 0, 0, 0 }
+
+    MOCKABLE_FUNCTION(, int, h_fabric_retry_policy_init_fixed, H_FABRIC_RETRY_POLICY*, policy, uint32_t, max_tries, uint32_t, delay_ms);
+    MOCKABLE_FUNCTION(, int, h_fabric_retry_policy_init_exponential, H_FABRIC_RETRY_POLICY*, policy, uint32_t, max_tries, uint32_t, base_delay_ms, uint32_t, max_delay_ms);
+    MOCKABLE_FUNCTION(, int, h_fabric_retry_policy_init_decorrelated_jitter, H_FABRIC_RETRY_POLICY*, policy, uint32_t, max_tries, uint32_t, base_delay_ms, uint32_t, max_delay_ms);
+    MOCKABLE_FUNCTION(, int, h_fabric_retry_policy_init_custom, H_FABRIC_RETRY_POLICY*, policy, uint32_t, max_tries, H_FABRIC_RETRY_POLICY_COMPUTE_DELAY, compute_delay, void*, compute_delay_context);
+    MOCKABLE_FUNCTION(, int, h_fabric_retry_policy_set_budget, H_FABRIC_RETRY_POLICY*, policy, uint32_t, retry_budget_ms);
+
+    MOCKABLE_FUNCTION(, bool, h_fabric_retry_policy_get_next_delay, const H_FABRIC_RETRY_POLICY*, policy, H_FABRIC_RETRY_STATE*, state, uint32_t, remaining_ms, uint32_t*, delay_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_RETRY_POLICY_H*/
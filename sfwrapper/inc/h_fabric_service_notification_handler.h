@@ -0,0 +1,28 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_SERVICE_NOTIFICATION_HANDLER_H
+#define H_FABRIC_SERVICE_NOTIFICATION_HANDLER_H
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "umock_c/umock_c_prod.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    typedef void (*ON_SERVICE_NOTIFICATION)(void* context, IFabricServiceNotification* notification);
+    typedef struct H_FABRIC_SERVICE_NOTIFICATION_HANDLER_TAG* H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE;
+
+    MOCKABLE_FUNCTION(, H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE, h_fabric_service_notification_handler_create, ON_SERVICE_NOTIFICATION, on_service_notification, void*, on_service_notification_context);
+    MOCKABLE_FUNCTION(, void, h_fabric_service_notification_handler_destroy, H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE, h_fabric_service_notification_handler);
+    MOCKABLE_FUNCTION(, void, h_fabric_service_notification_handler_close, H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE, h_fabric_service_notification_handler);
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_service_notification_handler_OnNotification, H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE, h_fabric_service_notification_handler, IFabricServiceNotification*, notification);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_FABRIC_SERVICE_NOTIFICATION_HANDLER_H */
@@ -0,0 +1,32 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_SERVICE_NOTIFICATION_HANDLER_COM_H
+#define H_FABRIC_SERVICE_NOTIFICATION_HANDLER_COM_H
+
+#include "windows.h"
+#include "unknwn.h"
+#include "fabricclient.h"
+#include "com_wrapper/com_wrapper.h"
+
+#include "h_fabric_service_notification_handler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE_INTERFACES \
+    COM_WRAPPER_INTERFACE(IUnknown, \
+        COM_WRAPPER_IUNKNOWN_APIS() \
+    ), \
+    COM_WRAPPER_INTERFACE(IFabricServiceNotificationEventHandler, \
+        COM_WRAPPER_IUNKNOWN_APIS(), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, h_fabric_service_notification_handler_OnNotification, IFabricServiceNotification*, notification) \
+    )
+
+    DECLARE_COM_WRAPPER_OBJECT(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE, H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE_INTERFACES);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_FABRIC_SERVICE_NOTIFICATION_HANDLER_COM_H */
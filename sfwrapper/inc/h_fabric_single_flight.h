@@ -0,0 +1,68 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef H_FABRIC_SINGLE_FLIGHT_H
+#define H_FABRIC_SINGLE_FLIGHT_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#include <cstddef>
+#include <cwchar>
+#else
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <wchar.h>
+#endif
+
+#include "windows.h"
+
+#include "c_pal/interlocked.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*keys that do not fit are not coalesced, the call goes straight to the cluster*/
+#define H_FABRIC_SINGLE_FLIGHT_KEY_MAX_SIZE 1024
+
+/*the key identifies the inputs of a call, 2 calls of the same API with the same key share the same result. It is built on the stack of the caller*/
+typedef struct H_FABRIC_SINGLE_FLIGHT_KEY_TAG
+{
+    bool can_coalesce; /*false if any input cannot be part of a key (for example an unknown extension in Reserved)*/
+    size_t size;
+    unsigned char bytes[H_FABRIC_SINGLE_FLIGHT_KEY_MAX_SIZE];
+} H_FABRIC_SINGLE_FLIGHT_KEY;
+
+/*an operation in flight, shared by the thread that executes it (the leader) and the threads waiting for its result*/
+typedef struct H_FABRIC_SINGLE_FLIGHT_CALL_TAG H_FABRIC_SINGLE_FLIGHT_CALL;
+
+/*the single flight group is embedded in the H_FABRIC_HANDLE*/
+typedef struct H_FABRIC_SINGLE_FLIGHT_TAG
+{
+    volatile_atomic int32_t lock; /*1 while a thread walks/changes calls*/
+    H_FABRIC_SINGLE_FLIGHT_CALL* calls; /*the operations in flight, protected by lock*/
+} H_FABRIC_SINGLE_FLIGHT;
+
+    MOCKABLE_FUNCTION(, void, h_fabric_single_flight_init, H_FABRIC_SINGLE_FLIGHT*, single_flight);
+    MOCKABLE_FUNCTION(, void, h_fabric_single_flight_deinit, H_FABRIC_SINGLE_FLIGHT*, single_flight);
+
+    MOCKABLE_FUNCTION(, void, h_fabric_single_flight_key_init, H_FABRIC_SINGLE_FLIGHT_KEY*, key);
+    MOCKABLE_FUNCTION(, void, h_fabric_single_flight_key_add, H_FABRIC_SINGLE_FLIGHT_KEY*, key, const void*, data, size_t, size);
+    MOCKABLE_FUNCTION(, void, h_fabric_single_flight_key_add_wstring, H_FABRIC_SINGLE_FLIGHT_KEY*, key, const wchar_t*, value);
+    MOCKABLE_FUNCTION(, void, h_fabric_single_flight_key_disable, H_FABRIC_SINGLE_FLIGHT_KEY*, key);
+
+    /*returns NULL when the call cannot be coalesced, the caller then executes it by itself*/
+    MOCKABLE_FUNCTION(, H_FABRIC_SINGLE_FLIGHT_CALL*, h_fabric_single_flight_join, H_FABRIC_SINGLE_FLIGHT*, single_flight, const char*, api_name, const H_FABRIC_SINGLE_FLIGHT_KEY*, key, bool*, is_leader);
+
+    /*called by the leader once the operation finished. result is not consumed, the call takes its own reference on it*/
+    MOCKABLE_FUNCTION(, void, h_fabric_single_flight_complete, H_FABRIC_SINGLE_FLIGHT*, single_flight, H_FABRIC_SINGLE_FLIGHT_CALL*, call, HRESULT, call_result, IUnknown*, result);
+
+    /*called by the other threads that joined the call. On success result is a new reference that has to be released by the caller*/
+    MOCKABLE_FUNCTION(, HRESULT, h_fabric_single_flight_wait, H_FABRIC_SINGLE_FLIGHT_CALL*, call, uint32_t, timeout_ms, IUnknown**, result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*H_FABRIC_SINGLE_FLIGHT_H*/
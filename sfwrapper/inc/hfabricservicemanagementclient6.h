@@ -146,6 +146,19 @@ extern "C" {
         )
     )
 
+    /*_async variant of FSMC6_ResolveServicePartition, see H_FABRIC_DECLARE_API_ASYNC*/
+
+    H_FABRIC_DECLARE_API_ASYNC(IFabricServiceManagementClient6, FSMC6_ResolveServicePartition,
+        IN_ARGS(
+            ARG(FABRIC_URI, name),
+            ARG(FABRIC_PARTITION_KEY_TYPE, partitionKeyType),
+            ARG(const void*, partitionKey),
+            ARG(IFabricResolvedServicePartitionResult*, previousResult),
+            ARG(DWORD, timeoutMilliseconds),
+            ARG(IFabricResolvedServicePartitionResult**, resolveServicePartitionResult)
+            )
+    )
+
 #ifdef __cplusplus
 }
 #endif
@@ -187,6 +187,246 @@ extern "C" {
         /* [in] */ DWORD timeoutMilliseconds,
         /* [retval][out] */ IFabricGetDeployedApplicationPagedListResult **result);
 
+    /*the _async functions start the operation and return, on_complete is called exactly once with the result when they return S_OK and never when they return a failure*/
+
+    HRESULT FQC10_GetNodeList_async(IFabricQueryClient10* This,
+        const FABRIC_NODE_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetNodeListResult** fabricGetNodeListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetApplicationTypeList_async(IFabricQueryClient10* This,
+        const FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetApplicationTypeListResult **fabricGetApplicationTypeListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetServiceTypeList_async(IFabricQueryClient10* This,
+        const FABRIC_SERVICE_TYPE_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetServiceTypeListResult **fabricGetServiceTypeListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetApplicationList_async(IFabricQueryClient10 * This,
+        const FABRIC_APPLICATION_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetApplicationListResult **fabricGetApplicationListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetServiceList_async(IFabricQueryClient10 * This,
+        const FABRIC_SERVICE_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetServiceListResult** fabricGetServiceListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetPartitionList_async(IFabricQueryClient10 * This,
+        const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetPartitionListResult** fabricGetPartitionListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetReplicaList_async(IFabricQueryClient10 * This,
+        const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetReplicaListResult** fabricGetReplicaListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetDeployedApplicationList_async(IFabricQueryClient10 * This,
+        const FABRIC_DEPLOYED_APPLICATION_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetDeployedApplicationListResult** fabricGetDeployedApplicationListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetDeployedServicePackageList_async(IFabricQueryClient10 * This,
+        const FABRIC_DEPLOYED_SERVICE_PACKAGE_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetDeployedServicePackageListResult** fabricGetDeployedServicePackageListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetDeployedServiceTypeList_async(IFabricQueryClient10 * This,
+        const FABRIC_DEPLOYED_SERVICE_TYPE_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetDeployedServiceTypeListResult** fabricGetDeployedServiceTypeListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetDeployedCodePackageList_async(IFabricQueryClient10 * This,
+        const FABRIC_DEPLOYED_CODE_PACKAGE_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetDeployedCodePackageListResult** fabricGetDeployedCodePackageListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetDeployedReplicaList_async(IFabricQueryClient10 * This,
+        const FABRIC_DEPLOYED_SERVICE_REPLICA_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetDeployedReplicaListResult** fabricGetDeployedReplicaListResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetDeployedReplicaDetail_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_DEPLOYED_SERVICE_REPLICA_DETAIL_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetDeployedServiceReplicaDetailResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetClusterLoadInformation_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetClusterLoadInformationResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetPartitionLoadInformation_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_PARTITION_LOAD_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetPartitionLoadInformationResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetProvisionedFabricCodeVersionList_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_PROVISIONED_CODE_VERSION_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetProvisionedCodeVersionListResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetProvisionedFabricConfigVersionList_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_PROVISIONED_CONFIG_VERSION_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetProvisionedConfigVersionListResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetNodeLoadInformation_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_NODE_LOAD_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetNodeLoadInformationResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetReplicaLoadInformation_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_REPLICA_LOAD_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetReplicaLoadInformationResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetServiceGroupMemberList_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_SERVICE_GROUP_MEMBER_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetServiceGroupMemberListResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetServiceGroupMemberTypeList_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_SERVICE_GROUP_MEMBER_TYPE_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetServiceGroupMemberTypeListResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetUnplacedReplicaInformation_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_UNPLACED_REPLICA_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetUnplacedReplicaInformationResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetNodeList2_async(IFabricQueryClient10* This,
+        const FABRIC_NODE_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetNodeListResult2** result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetApplicationList2_async(IFabricQueryClient10 * This,
+        const FABRIC_APPLICATION_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetApplicationListResult2 **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetServiceList2_async(IFabricQueryClient10 * This,
+        const FABRIC_SERVICE_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetServiceListResult2** result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetPartitionList2_async(IFabricQueryClient10 * This,
+        const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetPartitionListResult2** result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetReplicaList2_async(IFabricQueryClient10 * This,
+        const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION *queryDescription,
+        DWORD timeoutMilliseconds,
+        IFabricGetReplicaListResult2** result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetApplicationLoadInformation_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_APPLICATION_LOAD_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetApplicationLoadInformationResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetServiceName_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_SERVICE_NAME_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetServiceNameResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetApplicationName_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_APPLICATION_NAME_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetApplicationNameResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetApplicationTypePagedList_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const PAGED_FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetApplicationTypePagedListResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
+    HRESULT FQC10_GetDeployedApplicationPagedList_async(
+        IFabricQueryClient10 * This,
+        /* [in] */ const FABRIC_PAGED_DEPLOYED_APPLICATION_QUERY_DESCRIPTION *queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IFabricGetDeployedApplicationPagedListResult **result,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
     DECLARE_CREATE_IFABRICINSTANCE(IFabricQueryClient10);
 
 #ifdef __cplusplus
@@ -99,6 +99,18 @@ extern "C" {
         /* [in] */ const FABRIC_SERVICE_FROM_TEMPLATE_DESCRIPTION *serviceFromTemplateDescription,
         /* [in] */ DWORD timeoutMilliseconds);
 
+    /*the _async functions start the operation and return, on_complete is called exactly once with the result when they return S_OK and never when they return a failure*/
+
+    HRESULT FSMC6_ResolveServicePartition_async(IFabricServiceManagementClient6* client,
+        FABRIC_URI name,
+        FABRIC_PARTITION_KEY_TYPE partitionKeyType,
+        const void *partitionKey,
+        IFabricResolvedServicePartitionResult *previousResult,
+        DWORD timeoutMilliseconds,
+        IFabricResolvedServicePartitionResult **resolveServicePartitionResult,
+        SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+        void* on_complete_context);
+
     DECLARE_CREATE_IFABRICINSTANCE(IFabricServiceManagementClient6);
 
 #ifdef __cplusplus
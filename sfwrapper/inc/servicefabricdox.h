@@ -3,53 +3,281 @@
 #ifndef SERVICEFABRICDOX_H
 #define SERVICEFABRICDOX_H
 
+#include <cstdint>
+#include <cinttypes>
+#include <new>
+
 #include "winerror.h"
 
+#include "fabriccommon.h"
+
 #include "macro_utils/macro_utils.h"
 #include "c_logging/logger.h"
 
-#include "mycallback.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+
 #include "sf_c_util/hresult_to_string.h"
+#include "sf_c_util/timer_wheel.h"
 
-template<class I, typename Begin, typename End, typename TResult, typename... TArgs>
-HRESULT ServiceFabric_DoX(
+#include "servicefabricdox_cancellation.h"
+#include "sf_macros.h"
+
+/*time given to Service Fabric on top of timeoutMilliseconds to complete the operation on its own before ServiceFabric_DoX cancels it*/
+#ifndef SERVICEFABRIC_DOX_TIMEOUT_GRACE_MS
+#define SERVICEFABRIC_DOX_TIMEOUT_GRACE_MS 5000
+#endif
+
+static inline uint32_t ServiceFabric_DoX_GetWaitTimeout(DWORD timeoutMilliseconds)
+{
+    uint32_t result;
+    if (
+        (timeoutMilliseconds == INFINITE) ||
+        (timeoutMilliseconds >= UINT32_MAX - SERVICEFABRIC_DOX_TIMEOUT_GRACE_MS)
+        )
+    {
+        result = UINT32_MAX;
+    }
+    else
+    {
+        result = timeoutMilliseconds + SERVICEFABRIC_DOX_TIMEOUT_GRACE_MS;
+    }
+    return result;
+}
+
+/*ServiceFabric_DoX_Callback is reused by all the calls of a thread (see ServiceFabric_DoX_AcquireCallback), it is not allocated per call.
+The thread holds 1 reference and Service Fabric holds the others. When an operation missed its deadline its Invoke can still come, so the thread hands the callback over: it gives back its reference without reusing the callback, and whichever Release comes last (the thread's or Service Fabric's) frees it.
+Invoke only signals the completion, End is always called by ServiceFabric_DoX and never after it returned.*/
+class ServiceFabric_DoX_Callback : public IFabricAsyncOperationCallback
+{
+public:
+    ServiceFabric_DoX_Callback()
+    {
+        (void)interlocked_exchange(&refCount, 1);
+        (void)interlocked_exchange(&isCompleted, 0);
+    }
+
+    /*prepares the callback for the next operation of the thread. Only called when no Invoke of a previous operation can still come*/
+    void Reset(void)
+    {
+        (void)interlocked_exchange(&isCompleted, 0);
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override
+    {
+        HRESULT result;
+        if (ppvObject == NULL)
+        {
+            LogError("Invalid arguments: REFIID riid, void** ppvObject=%p", ppvObject);
+            result = E_POINTER;
+        }
+        else if (
+            IsEqualIID(riid, IID_IUnknown) ||
+            IsEqualIID(riid, IID_IFabricAsyncOperationCallback)
+            )
+        {
+            *ppvObject = static_cast<IFabricAsyncOperationCallback*>(this);
+            (void)AddRef();
+            result = S_OK;
+        }
+        else
+        {
+            *ppvObject = NULL;
+            result = E_NOINTERFACE;
+        }
+        return result;
+    }
+
+    ULONG STDMETHODCALLTYPE AddRef(void) override
+    {
+        return (ULONG)interlocked_increment(&refCount);
+    }
+
+    ULONG STDMETHODCALLTYPE Release(void) override
+    {
+        int32_t result = interlocked_decrement(&refCount);
+        if (result == 0)
+        {
+            delete this;
+        }
+        return (ULONG)result;
+    }
+
+    void STDMETHODCALLTYPE Invoke(IFabricAsyncOperationContext* context) override
+    {
+        if (context->CompletedSynchronously())
+        {
+            //spurious callback, result will be picked in the caller because it examines CompletedSynchronously too.
+        }
+        else
+        {
+            (void)interlocked_exchange(&isCompleted, 1);
+            wake_by_address_single(&isCompleted);
+        }
+    }
+
+    /*returns S_OK when Invoke was called, FABRIC_E_TIMEOUT when waitTimeoutMilliseconds elapsed first*/
+    HRESULT WaitForCompletion(uint32_t waitTimeoutMilliseconds)
+    {
+        HRESULT result;
+        INTERLOCKED_HL_RESULT waitResult = InterlockedHL_WaitForValue(&isCompleted, 1, waitTimeoutMilliseconds);
+        if (waitResult == INTERLOCKED_HL_OK)
+        {
+            result = S_OK;
+        }
+        else if (waitResult == INTERLOCKED_HL_TIMEOUT)
+        {
+            result = FABRIC_E_TIMEOUT;
+        }
+        else
+        {
+            LogError("failure in InterlockedHL_WaitForValue, INTERLOCKED_HL_RESULT waitResult=%d", (int)waitResult);
+            result = E_FAIL;
+        }
+        return result;
+    }
+
+    bool IsCompleted(void)
+    {
+        return interlocked_add(&isCompleted, 0) != 0;
+    }
+
+private:
+    ~ServiceFabric_DoX_Callback() = default;
+
+    volatile_atomic int32_t refCount;
+    volatile_atomic int32_t isCompleted;
+};
+
+/*the callback kept by a thread between its calls, released when the thread exits*/
+class ServiceFabric_DoX_ThreadCallback
+{
+public:
+    ~ServiceFabric_DoX_ThreadCallback()
+    {
+        if (callback != NULL)
+        {
+            (void)callback->Release();
+        }
+    }
+
+    ServiceFabric_DoX_Callback* callback = NULL;
+};
+
+inline ServiceFabric_DoX_ThreadCallback& ServiceFabric_DoX_GetThreadCallback(void)
+{
+    static thread_local ServiceFabric_DoX_ThreadCallback threadCallback;
+    return threadCallback;
+}
+
+/*takes the callback of the calling thread, allocating one only for the first call of the thread or after the previous one was handed over to Service Fabric.
+The callback is taken out of the thread while in use, so a nested call on the same thread gets its own*/
+inline ServiceFabric_DoX_Callback* ServiceFabric_DoX_AcquireCallback(void)
+{
+    ServiceFabric_DoX_ThreadCallback& threadCallback = ServiceFabric_DoX_GetThreadCallback();
+    ServiceFabric_DoX_Callback* result = threadCallback.callback;
+    if (result != NULL)
+    {
+        threadCallback.callback = NULL;
+        result->Reset();
+    }
+    else
+    {
+        result = new (std::nothrow) ServiceFabric_DoX_Callback();
+        if (result == NULL)
+        {
+            LogError("failure in new ServiceFabric_DoX_Callback");
+        }
+    }
+    return result;
+}
+
+/*canReuse is true when no Invoke can still come for the operation of the call: the callback goes back to the thread. Otherwise the thread hands it over and the last Release frees it*/
+inline void ServiceFabric_DoX_ReleaseCallback(ServiceFabric_DoX_Callback* callback, bool canReuse)
+{
+    ServiceFabric_DoX_ThreadCallback& threadCallback = ServiceFabric_DoX_GetThreadCallback();
+    if (canReuse && (threadCallback.callback == NULL))
+    {
+        threadCallback.callback = callback;
+    }
+    else
+    {
+        (void)callback->Release();
+    }
+}
+
+template<class I, typename Begin, typename EndCall, typename... TArgs>
+HRESULT ServiceFabric_DoX_Execute(
     I* client,
     Begin begin,
-    End end,
+    EndCall endCall,
     DWORD timeoutMilliseconds,
-    TResult output,
     TArgs... targs
-    )
+)
 {
     HRESULT result;
-    HANDLE ev;
-    if ((ev = CreateEvent(NULL, FALSE, FALSE, NULL)) == NULL)
+    ServiceFabric_DoX_Callback* callback = ServiceFabric_DoX_AcquireCallback();
+    if (callback == NULL)
+    {
+        LogError("failure in ServiceFabric_DoX_AcquireCallback");
+        result = E_OUTOFMEMORY;
+    }
+    /*the thread might have a cancellation (for example the runs of the hedged calls of H_FABRIC): once cancelled no operation begins, because the inputs might not be valid any more*/
+    else if (!servicefabric_dox_cancellation_begin_operation())
     {
-        result = HRESULT_FROM_WIN32(GetLastError());
-        LogLastError("failure in CreateEvent");
+        LogError("the cancellation of the thread was cancelled, the operation does not begin");
+        result = HRESULT_FROM_WIN32(ERROR_CANCELLED);
+        ServiceFabric_DoX_ReleaseCallback(callback, true);
     }
     else
     {
-        IFabricAsyncOperationCallback* callback = IFabricAsyncOperationCallback_do_nothing_create(ev);
-        if (callback == NULL)
+        /*false only while an Invoke for the operation can still come after ServiceFabric_DoX returns*/
+        bool canReuseCallback = true;
+        IFabricAsyncOperationContext* context;
+        result = (client->*begin)(targs..., timeoutMilliseconds, callback, &context);
+        if (FAILED(result))
         {
-            LogError("failure in IFabricAsyncOperationCallback_do_nothing_create");
-            result = E_FAIL;
+            LogHRESULTError(result, "failure in begin");
+            servicefabric_dox_cancellation_register_operation(NULL);
+            /*return as is*/
         }
         else
         {
-            IFabricAsyncOperationContext* context;
-            result = (client->*begin)(targs..., timeoutMilliseconds, callback, &context);
-            if (FAILED(result))
-            {
-                LogHRESULTError(result, "failure in begin");
-                /*return as is*/
-            }
-            else
+            if (!context->CompletedSynchronously())
             {
-                if (context->CompletedSynchronously())
+                /*the cancellation of the thread can now cancel the operation*/
+                servicefabric_dox_cancellation_register_operation(context);
+
+                /*Service Fabric is expected to complete the operation on its own at timeoutMilliseconds, do not wait forever if it does not*/
+                result = callback->WaitForCompletion(ServiceFabric_DoX_GetWaitTimeout(timeoutMilliseconds));
+                if (result == FABRIC_E_TIMEOUT)
+                {
+                    LogError("operation did not complete in timeoutMilliseconds=%" PRIu32 " + %" PRIu32 " ms, cancelling it", (uint32_t)timeoutMilliseconds, (uint32_t)SERVICEFABRIC_DOX_TIMEOUT_GRACE_MS);
+                    HRESULT cancelResult = context->Cancel();
+                    if (FAILED(cancelResult))
+                    {
+                        LogHRESULTError(cancelResult, "failure in Cancel");
+                    }
+
+                    /*no waiting for the callback: it is handed over to Service Fabric below and the late Invoke is harmless.
+                    Only when the operation completed by now (for example Cancel completed it inline) its outcome is collected, so that a successful output is owned by the caller and not leaked*/
+                    if (callback->IsCompleted())
+                    {
+                        HRESULT endResult = endCall(context);
+                        if (SUCCEEDED(endResult))
+                        {
+                            result = S_OK;
+                        }
+                        else
+                        {
+                            LogHRESULTError(endResult, "failure in end after cancel, returning FABRIC_E_TIMEOUT");
+                        }
+                    }
+                }
+                else if (SUCCEEDED(result))
                 {
-                    result = (client->*end)(context, output);
+                    result = endCall(context);
                     if (FAILED(result))
                     {
                         LogHRESULTError(result, "failure in end");
@@ -62,34 +290,51 @@ HRESULT ServiceFabric_DoX(
                 }
                 else
                 {
-                    if (WaitForSingleObject(ev, INFINITE) != WAIT_OBJECT_0)
-                    {
-                        LogLastError("failure in WaitForSingleObject");
-                        result = MU_FAILURE;
-                    }
-                    else
-                    {
-                        result = (client->*end)(context, output);
-                        if (FAILED(result))
-                        {
-                            LogHRESULTError(result, "failure in end");
-                            /*return as is*/
-                        }
-                        else
-                        {
-                            result = S_OK;
-                        }
-                    }
+                    /*return as is*/
                 }
-                (void)context->Release();
+
+                canReuseCallback = callback->IsCompleted();
+
+                servicefabric_dox_cancellation_unregister_operation();
             }
-            (void)callback->Release();
+            else
+            {
+                /*nothing to wait for, so nothing to cancel*/
+                servicefabric_dox_cancellation_register_operation(NULL);
+                result = endCall(context);
+                if (FAILED(result))
+                {
+                    LogHRESULTError(result, "failure in end");
+                    /*return as is*/
+                }
+                else
+                {
+                    result = S_OK;
+                }
+            }
+            (void)context->Release();
         }
-        (void)CloseHandle(ev);
+        ServiceFabric_DoX_ReleaseCallback(callback, canReuseCallback);
     }
     return result;
 }
 
+template<class I, typename Begin, typename End, typename TResult, typename... TArgs>
+HRESULT ServiceFabric_DoX(
+    I* client,
+    Begin begin,
+    End end,
+    DWORD timeoutMilliseconds,
+    TResult output,
+    TArgs... targs
+    )
+{
+    return ServiceFabric_DoX_Execute(client, begin,
+        [client, end, output](IFabricAsyncOperationContext* context) { return (client->*end)(context, output); },
+        timeoutMilliseconds,
+        targs...);
+}
+
 template<class I, typename Begin, typename End, typename... TArgs>
 HRESULT ServiceFabric_DoX_NoResult(
     I* client,
@@ -98,74 +343,269 @@ HRESULT ServiceFabric_DoX_NoResult(
     DWORD timeoutMilliseconds,
     TArgs... targs
 )
+{
+    return ServiceFabric_DoX_Execute(client, begin,
+        [client, end](IFabricAsyncOperationContext* context) { return (client->*end)(context); },
+        timeoutMilliseconds,
+        targs...);
+}
+
+/*ServiceFabric_DoX_AsyncCallback is the counterpart of ServiceFabric_DoX_Callback for the _async functions: nothing waits for it, so it calls end and on_complete from Invoke and frees itself when the last reference is given back*/
+/*instead of the grace timeout of ServiceFabric_DoX_Execute it can arm a deadline on a timer wheel: if Service Fabric does not complete the operation by then, the timer cancels it*/
+template<typename EndCall>
+class ServiceFabric_DoX_AsyncCallback : public IFabricAsyncOperationCallback
+{
+public:
+    ServiceFabric_DoX_AsyncCallback(EndCall endCall, SERVICEFABRIC_DOX_ON_COMPLETE on_complete, void* on_complete_context)
+        : endCall(endCall), on_complete(on_complete), on_complete_context(on_complete_context), deadlineTimerWheel(NULL), deadlineContext(NULL)
+    {
+        (void)interlocked_exchange(&refCount, 1);
+        (void)interlocked_exchange(&deadlineState, DEADLINE_NONE);
+        (void)interlocked_exchange(&deadlineExpired, 0);
+        timer_wheel_timer_init(&deadlineTimer);
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override
+    {
+        HRESULT result;
+        if (ppvObject == NULL)
+        {
+            LogError("Invalid arguments: REFIID riid, void** ppvObject=%p", ppvObject);
+            result = E_POINTER;
+        }
+        else if (
+            IsEqualIID(riid, IID_IUnknown) ||
+            IsEqualIID(riid, IID_IFabricAsyncOperationCallback)
+            )
+        {
+            *ppvObject = static_cast<IFabricAsyncOperationCallback*>(this);
+            (void)AddRef();
+            result = S_OK;
+        }
+        else
+        {
+            *ppvObject = NULL;
+            result = E_NOINTERFACE;
+        }
+        return result;
+    }
+
+    ULONG STDMETHODCALLTYPE AddRef(void) override
+    {
+        return (ULONG)interlocked_increment(&refCount);
+    }
+
+    ULONG STDMETHODCALLTYPE Release(void) override
+    {
+        int32_t result = interlocked_decrement(&refCount);
+        if (result == 0)
+        {
+            delete this;
+        }
+        return (ULONG)result;
+    }
+
+    void STDMETHODCALLTYPE Invoke(IFabricAsyncOperationContext* context) override
+    {
+        if (context->CompletedSynchronously())
+        {
+            //spurious callback, the operation is completed by ServiceFabric_DoX_ExecuteAsync because it examines CompletedSynchronously too.
+        }
+        else
+        {
+            Complete(context);
+        }
+    }
+
+    /*calls end and then on_complete with its result, exactly once per operation*/
+    void Complete(IFabricAsyncOperationContext* context)
+    {
+        HRESULT result;
+
+        if (interlocked_exchange(&deadlineState, DEADLINE_COMPLETED) == DEADLINE_ARMED)
+        {
+            DisarmDeadline();
+        }
+
+        result = endCall(context);
+        if (FAILED(result))
+        {
+            if (interlocked_add(&deadlineExpired, 0) != 0)
+            {
+                /*same as ServiceFabric_DoX_Execute: an operation cancelled because it missed its deadline timed out*/
+                LogHRESULTError(result, "failure in end after the deadline cancelled the operation, returning FABRIC_E_TIMEOUT");
+                result = FABRIC_E_TIMEOUT;
+            }
+            else
+            {
+                LogHRESULTError(result, "failure in end");
+                /*pass as is*/
+            }
+        }
+        else
+        {
+            result = S_OK;
+        }
+        on_complete(on_complete_context, result);
+    }
+
+    /*makes the timer wheel cancel the operation (context) if it did not complete in deadlineMs. The timer has its own references on the callback and on the operation.*/
+    void ArmDeadline(TIMER_WHEEL_HANDLE timer_wheel, uint32_t deadlineMs, IFabricAsyncOperationContext* context)
+    {
+        deadlineTimerWheel = timer_wheel;
+        deadlineContext = context;
+        (void)AddRef();
+        (void)deadlineContext->AddRef();
+        if (timer_wheel_schedule(deadlineTimerWheel, &deadlineTimer, deadlineMs, OnDeadline, this) != 0)
+        {
+            LogError("failure in timer_wheel_schedule(deadlineTimerWheel=%p, &deadlineTimer=%p, deadlineMs=%" PRIu32 ", OnDeadline, this=%p), the operation has no deadline",
+                deadlineTimerWheel, &deadlineTimer, deadlineMs, this);
+            ReleaseDeadlineReferences();
+        }
+        else
+        {
+            int32_t previousState = interlocked_compare_exchange(&deadlineState, DEADLINE_ARMED, DEADLINE_NONE);
+            if (previousState == DEADLINE_COMPLETED)
+            {
+                /*the operation completed before the deadline was armed*/
+                DisarmDeadline();
+            }
+            else
+            {
+                /*Complete disarms it, or the timer wheel was destroyed and the timer already gave back its references*/
+            }
+        }
+    }
+
+private:
+    static const int32_t DEADLINE_NONE = 0;
+    static const int32_t DEADLINE_ARMED = 1;
+    static const int32_t DEADLINE_COMPLETED = 2;
+    static const int32_t DEADLINE_DROPPED = 3; /*the timer wheel was destroyed before the deadline, there is nothing to disarm*/
+
+    void DisarmDeadline(void)
+    {
+        if (timer_wheel_cancel(deadlineTimerWheel, &deadlineTimer))
+        {
+            ReleaseDeadlineReferences();
+        }
+        else
+        {
+            /*OnDeadline runs (or ran), it gives back the references of the timer*/
+        }
+    }
+
+    void ReleaseDeadlineReferences(void)
+    {
+        (void)deadlineContext->Release();
+        (void)Release();
+    }
+
+    static void OnDeadline(void* context, bool is_cancelled)
+    {
+        ServiceFabric_DoX_AsyncCallback* callback = static_cast<ServiceFabric_DoX_AsyncCallback*>(context);
+        if (is_cancelled)
+        {
+            /*the timer wheel is destroyed, the operation goes on without a deadline and nobody can cancel the timer anymore*/
+            LogError("the timer wheel was destroyed before the deadline of the operation");
+            (void)interlocked_exchange(&callback->deadlineState, DEADLINE_DROPPED);
+        }
+        else
+        {
+            LogError("operation did not complete by its deadline, cancelling it");
+            (void)interlocked_exchange(&callback->deadlineExpired, 1);
+            /*Service Fabric completes the operation (and calls Invoke) once it is cancelled, cancelling an operation that already completed does nothing*/
+            HRESULT cancelResult = callback->deadlineContext->Cancel();
+            if (FAILED(cancelResult))
+            {
+                LogHRESULTError(cancelResult, "failure in Cancel");
+            }
+        }
+        callback->ReleaseDeadlineReferences();
+    }
+
+    volatile_atomic int32_t refCount;
+    EndCall endCall;
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete;
+    void* on_complete_context;
+    TIMER_WHEEL_HANDLE deadlineTimerWheel;
+    TIMER_WHEEL_TIMER deadlineTimer;
+    IFabricAsyncOperationContext* deadlineContext;
+    volatile_atomic int32_t deadlineState;
+    volatile_atomic int32_t deadlineExpired;
+};
+
+/*starts the operation and returns without waiting for it. When it returns a failure, on_complete is never called. When it returns S_OK, on_complete is called exactly once with the result of end (from this thread if the operation completed synchronously, from the Service Fabric thread that completed it otherwise)*/
+/*nothing waits, so there is no grace timeout like in ServiceFabric_DoX_Execute. When the calling thread has a current timer wheel (servicefabric_dox_cancellation_set_current_timer_wheel) the operation gets a deadline of timeoutMilliseconds + SERVICEFABRIC_DOX_TIMEOUT_GRACE_MS on it instead, otherwise it completes only when Service Fabric completes it*/
+template<class I, typename Begin, typename EndCall, typename... TArgs>
+HRESULT ServiceFabric_DoX_ExecuteAsync(
+    I* client,
+    Begin begin,
+    EndCall endCall,
+    DWORD timeoutMilliseconds,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context,
+    TArgs... targs
+)
 {
     HRESULT result;
-    HANDLE ev;
-    if ((ev = CreateEvent(NULL, FALSE, FALSE, NULL)) == NULL)
+    ServiceFabric_DoX_AsyncCallback<EndCall>* callback = new (std::nothrow) ServiceFabric_DoX_AsyncCallback<EndCall>(endCall, on_complete, on_complete_context);
+    if (callback == NULL)
     {
-        result = HRESULT_FROM_WIN32(GetLastError());
-        LogLastError("failure in CreateEvent");
+        LogError("failure in new ServiceFabric_DoX_AsyncCallback");
+        result = E_OUTOFMEMORY;
     }
     else
     {
-        IFabricAsyncOperationCallback* callback = IFabricAsyncOperationCallback_do_nothing_create(ev);
-        if (callback == NULL)
+        IFabricAsyncOperationContext* context;
+        result = (client->*begin)(targs..., timeoutMilliseconds, callback, &context);
+        if (FAILED(result))
         {
-            LogError("failure in IFabricAsyncOperationCallback_do_nothing_create");
-            result = E_FAIL;
+            LogHRESULTError(result, "failure in begin");
+            /*return as is*/
         }
         else
         {
-            IFabricAsyncOperationContext* context;
-            result = (client->*begin)(targs..., timeoutMilliseconds, callback, &context);
-            if (FAILED(result))
+            if (context->CompletedSynchronously())
             {
-                LogHRESULTError(result, "failure in begin");
-                /*return as is*/
+                callback->Complete(context);
             }
             else
             {
-                if (context->CompletedSynchronously())
+                /*Invoke completes it, the deadline makes sure it does even when Service Fabric does not complete the operation on its own*/
+                TIMER_WHEEL_HANDLE timer_wheel = servicefabric_dox_cancellation_get_current_timer_wheel();
+                uint32_t deadlineMs = ServiceFabric_DoX_GetWaitTimeout(timeoutMilliseconds);
+                if ((timer_wheel != NULL) && (deadlineMs != UINT32_MAX))
                 {
-                    result = (client->*end)(context);
-                    if (FAILED(result))
-                    {
-                        LogHRESULTError(result, "failure in end");
-                        /*return as is*/
-                    }
-                    else
-                    {
-                        result = S_OK;
-                    }
+                    callback->ArmDeadline(timer_wheel, deadlineMs, context);
                 }
-                else
-                {
-                    if (WaitForSingleObject(ev, INFINITE) != WAIT_OBJECT_0)
-                    {
-                        LogLastError("failure in WaitForSingleObject");
-                        result = MU_FAILURE;
-                    }
-                    else
-                    {
-                        result = (client->*end)(context);
-                        if (FAILED(result))
-                        {
-                            LogHRESULTError(result, "failure in end");
-                            /*return as is*/
-                        }
-                        else
-                        {
-                            result = S_OK;
-                        }
-                    }
-                }
-                (void)context->Release();
             }
-            (void)callback->Release();
+            (void)context->Release();
+            result = S_OK;
         }
-        (void)CloseHandle(ev);
+        (void)callback->Release();
     }
     return result;
 }
 
+template<class I, typename Begin, typename End, typename TResult, typename... TArgs>
+HRESULT ServiceFabric_DoX_Async(
+    I* client,
+    Begin begin,
+    End end,
+    DWORD timeoutMilliseconds,
+    TResult output,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context,
+    TArgs... targs
+    )
+{
+    return ServiceFabric_DoX_ExecuteAsync(client, begin,
+        [client, end, output](IFabricAsyncOperationContext* context) { return (client->*end)(context, output); },
+        timeoutMilliseconds,
+        on_complete,
+        on_complete_context,
+        targs...);
+}
+
 #endif /*SERVICEFABRICDOX_H*/
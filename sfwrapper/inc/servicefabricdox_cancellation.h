@@ -0,0 +1,64 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef SERVICEFABRICDOX_CANCELLATION_H
+#define SERVICEFABRICDOX_CANCELLATION_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#include <stdbool.h>
+#endif
+
+#include "windows.h"
+
+#include "fabriccommon.h"
+
+#include "c_pal/interlocked.h"
+
+#include "sf_c_util/timer_wheel.h"
+
+#include "umock_c/umock_c_prod.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*a cancellation lets a thread cancel the Service Fabric operation that another thread waits for in ServiceFabric_DoX.
+The thread that calls the sync APIs makes the cancellation current, ServiceFabric_DoX then registers in it the operation it waits for*/
+typedef struct SERVICEFABRIC_DOX_CANCELLATION_TAG
+{
+    volatile_atomic int32_t lock; /*1 while operation is changed or cancelled, and while an operation begins*/
+    volatile_atomic int32_t is_cancelled; /*woken when it becomes 1*/
+    IFabricAsyncOperationContext* operation; /*the operation ServiceFabric_DoX waits for, protected by lock*/
+} SERVICEFABRIC_DOX_CANCELLATION;
+
+    MOCKABLE_FUNCTION(, void, servicefabric_dox_cancellation_init, SERVICEFABRIC_DOX_CANCELLATION*, cancellation);
+
+    /*cancels the operation registered in cancellation (if any) and every operation registered after*/
+    MOCKABLE_FUNCTION(, void, servicefabric_dox_cancellation_cancel, SERVICEFABRIC_DOX_CANCELLATION*, cancellation);
+
+    /*sets the cancellation observed by the ServiceFabric_DoX calls of the calling thread, NULL for none*/
+    MOCKABLE_FUNCTION(, void, servicefabric_dox_cancellation_set_current, SERVICEFABRIC_DOX_CANCELLATION*, cancellation);
+    MOCKABLE_FUNCTION(, bool, servicefabric_dox_cancellation_is_current_cancelled);
+
+    /*sleeps milliseconds on the calling thread, returns false as soon as its current cancellation is cancelled*/
+    MOCKABLE_FUNCTION(, bool, servicefabric_dox_cancellation_sleep, uint32_t, milliseconds);
+
+    /*called by ServiceFabric_DoX before it begins the operation: false when the current cancellation was cancelled, the operation shall then not begin.
+    Otherwise the cancellation cannot be cancelled until servicefabric_dox_cancellation_register_operation, so once servicefabric_dox_cancellation_cancel returned no operation of the thread reads the inputs of its call any more*/
+    MOCKABLE_FUNCTION(, bool, servicefabric_dox_cancellation_begin_operation);
+
+    /*called by ServiceFabric_DoX after servicefabric_dox_cancellation_begin_operation returned true, with the operation it waits for or NULL when it does not wait (begin failed or completed synchronously)*/
+    MOCKABLE_FUNCTION(, void, servicefabric_dox_cancellation_register_operation, IFabricAsyncOperationContext*, operation);
+    /*called by ServiceFabric_DoX once it stopped waiting for the operation it registered*/
+    MOCKABLE_FUNCTION(, void, servicefabric_dox_cancellation_unregister_operation);
+
+    /*sets the timer wheel on which the ServiceFabric_DoX_ExecuteAsync calls of the calling thread arm the deadline of their operation, NULL for none (the operation then completes only when Service Fabric completes it)*/
+    MOCKABLE_FUNCTION(, void, servicefabric_dox_cancellation_set_current_timer_wheel, TIMER_WHEEL_HANDLE, timer_wheel);
+    MOCKABLE_FUNCTION(, TIMER_WHEEL_HANDLE, servicefabric_dox_cancellation_get_current_timer_wheel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*SERVICEFABRICDOX_CANCELLATION_H*/
@@ -16,6 +16,11 @@
 
 #include "sf_c_util/hresult_to_string.h"
 
+#include "h_fabric_client_factory.h"
+
+/*completion callback of the _async functions of the sync layer, result is what the sync function would have returned*/
+typedef void (*SERVICEFABRIC_DOX_ON_COMPLETE)(void* context, HRESULT result);
+
 #define CREATE_IFABRICINSTANCE_NAME(IFabricType) MU_C2(CREATE_, IFabricType)
 
 /*the below macro expands to something that is the implementation of this helper in a .c file*/
@@ -38,10 +43,10 @@ HRESULT CREATE_IFABRICINSTANCE_NAME(IFabricType)(IFabricType** fabricVariable)
         }                                                                                                                                                                                           \
                                                                                                                                                                                                     \
         /*re-create in place*/                                                                                                                                                                      \
-        hr = FabricCreateLocalClient(&MU_C2(IID_, IFabricType), fabricVariable); /*all IFabricWhateverSomethingClient are created with this call, passing a different interface IID*/               \
+        hr = h_fabric_client_factory_create_local_client(&MU_C2(IID_, IFabricType), fabricVariable); /*FabricCreateLocalClient unless a factory was set, passing a different interface IID*/        \
         if (FAILED(hr))                                                                                                                                                                             \
         {                                                                                                                                                                                           \
-            LogHRESULTError(hr, "failure in FabricCreateLocalClient");                                                                                                                              \
+            LogHRESULTError(hr, "failure in h_fabric_client_factory_create_local_client");                                                                                                          \
             /*return as is*/                                                                                                                                                                        \
         }                                                                                                                                                                                           \
         else                                                                                                                                                                                        \
@@ -0,0 +1,202 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+#include "c_pal/timer.h"
+
+#include "h_fabric_circuit_breaker.h"
+
+MU_DEFINE_ENUM_STRINGS(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_VALUES)
+MU_DEFINE_ENUM_STRINGS(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_VALUES)
+
+static int64_t get_now_ms(void)
+{
+    return (int64_t)timer_global_get_elapsed_ms();
+}
+
+/*these are the results after which H_FABRIC_API recreates the client, they say that the cluster could not be reached rather than that it refused the call*/
+static bool is_transient_failure(HRESULT hr)
+{
+    return (hr == E_ABORT) || (hr == FABRIC_E_OBJECT_CLOSED) || (hr == FABRIC_E_GATEWAY_NOT_REACHABLE) || (hr == FABRIC_E_TIMEOUT);
+}
+
+static void start_window(H_FABRIC_CIRCUIT_BREAKER* breaker, int64_t now)
+{
+    (void)interlocked_exchange(&breaker->calls, 0);
+    (void)interlocked_exchange(&breaker->failures, 0);
+    (void)interlocked_exchange_64(&breaker->window_start_ms, now);
+}
+
+void h_fabric_circuit_breaker_init(H_FABRIC_CIRCUIT_BREAKER* breaker, const H_FABRIC_CIRCUIT_BREAKER_CONFIG* config)
+{
+    if (
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_001: [ If breaker is NULL then h_fabric_circuit_breaker_init shall return. ]*/
+        (breaker == NULL) ||
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_002: [ If config is NULL then h_fabric_circuit_breaker_init shall return. ]*/
+        (config == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_CIRCUIT_BREAKER* breaker=%p, const H_FABRIC_CIRCUIT_BREAKER_CONFIG* config=%p", breaker, config);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_003: [ h_fabric_circuit_breaker_init shall copy config in breaker and set the state to H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED with no calls in the window. ]*/
+        breaker->config = *config;
+        (void)interlocked_exchange(&breaker->state, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED);
+        (void)interlocked_exchange_64(&breaker->opened_ms, 0);
+
+        if (config->failure_percent == 0)
+        {
+            start_window(breaker, 0);
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_004: [ If failure_percent of config is not 0 then h_fabric_circuit_breaker_init shall start the window at the current time by calling timer_global_get_elapsed_ms. ]*/
+            start_window(breaker, get_now_ms());
+        }
+    }
+}
+
+H_FABRIC_CIRCUIT_BREAKER_ENTRY h_fabric_circuit_breaker_enter(H_FABRIC_CIRCUIT_BREAKER* breaker)
+{
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY result;
+    if (breaker == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_005: [ If breaker is NULL then h_fabric_circuit_breaker_enter shall fail and return H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED. ]*/
+        LogError("Invalid arguments: H_FABRIC_CIRCUIT_BREAKER* breaker=%p", breaker);
+        result = H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED;
+    }
+    else if (breaker->config.failure_percent == 0)
+    {
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_006: [ If failure_percent of the configuration is 0 then h_fabric_circuit_breaker_enter shall return H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED. ]*/
+        result = H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED;
+    }
+    else
+    {
+        int32_t state = interlocked_add(&breaker->state, 0);
+        if (state == H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED)
+        {
+            /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_007: [ If the state is H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED then h_fabric_circuit_breaker_enter shall return H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED. ]*/
+            result = H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED;
+        }
+        else if (
+            (state == H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN) &&
+            (get_now_ms() - interlocked_add_64(&breaker->opened_ms, 0) >= breaker->config.open_ms) &&
+            (interlocked_compare_exchange(&breaker->state, H_FABRIC_CIRCUIT_BREAKER_STATE_HALF_OPEN, H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN) == H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN)
+            )
+        {
+            /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_008: [ If the state is H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN and at least open_ms passed since the breaker opened (timer_global_get_elapsed_ms) then h_fabric_circuit_breaker_enter shall switch the state to H_FABRIC_CIRCUIT_BREAKER_STATE_HALF_OPEN and return H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE. ]*/
+            /*only the thread that switched the state runs the probe*/
+            LogInfo("circuit breaker %p is half open, letting a probe call through", breaker);
+            result = H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_009: [ Otherwise h_fabric_circuit_breaker_enter shall return H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED. ]*/
+            result = H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED;
+        }
+    }
+    return result;
+}
+
+void h_fabric_circuit_breaker_exit(H_FABRIC_CIRCUIT_BREAKER* breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY entry, HRESULT hr)
+{
+    if (breaker == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_010: [ If breaker is NULL then h_fabric_circuit_breaker_exit shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_CIRCUIT_BREAKER* breaker=%p, H_FABRIC_CIRCUIT_BREAKER_ENTRY entry=%" PRI_MU_ENUM ", HRESULT hr=0x%lx",
+            breaker, MU_ENUM_VALUE(H_FABRIC_CIRCUIT_BREAKER_ENTRY, entry), (unsigned long)hr);
+    }
+    else if (
+        (breaker->config.failure_percent == 0) ||
+        (entry == H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED)
+        )
+    {
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_011: [ If failure_percent of the configuration is 0 or entry is H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED then h_fabric_circuit_breaker_exit shall return. ]*/
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_012: [ h_fabric_circuit_breaker_exit shall consider that the call failed if hr is E_ABORT, FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or FABRIC_E_TIMEOUT. ]*/
+        bool failed = is_transient_failure(hr);
+        int64_t now = get_now_ms();
+
+        if (entry == H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE)
+        {
+            if (failed)
+            {
+                /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_013: [ If entry is H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE and the call failed then h_fabric_circuit_breaker_exit shall record the current time as the time the breaker opened and switch the state to H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN. ]*/
+                LogWarning("circuit breaker %p probe failed with hr=0x%lx, opening again for %" PRIu32 " ms", breaker, (unsigned long)hr, breaker->config.open_ms);
+                (void)interlocked_exchange_64(&breaker->opened_ms, now);
+                (void)interlocked_exchange(&breaker->state, H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN);
+            }
+            else
+            {
+                /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_014: [ If entry is H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE and the call did not fail then h_fabric_circuit_breaker_exit shall start a new window at the current time and switch the state to H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED. ]*/
+                LogInfo("circuit breaker %p probe succeeded, closing", breaker);
+                start_window(breaker, now);
+                (void)interlocked_exchange(&breaker->state, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED);
+            }
+        }
+        else
+        {
+            int64_t window_start = interlocked_add_64(&breaker->window_start_ms, 0);
+            if (
+                (now - window_start >= breaker->config.window_ms) &&
+                (interlocked_compare_exchange_64(&breaker->window_start_ms, now, window_start) == window_start)
+                )
+            {
+                /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_015: [ If at least window_ms passed since the window started then h_fabric_circuit_breaker_exit shall start a new window at the current time. ]*/
+                /*the calls that complete while the counters are being reset might be counted in either window, the failure rate is an estimate anyway*/
+                start_window(breaker, now);
+            }
+
+            /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_016: [ h_fabric_circuit_breaker_exit shall increment the number of calls of the window and, if the call failed, the number of failures of the window. ]*/
+            int32_t calls = interlocked_increment(&breaker->calls);
+            int32_t failures = failed ? interlocked_increment(&breaker->failures) : interlocked_add(&breaker->failures, 0);
+
+            if (
+                /*calls that were let through before the breaker opened and complete after it do not move the time it opened*/
+                (interlocked_add(&breaker->state, 0) == H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED) &&
+                ((uint32_t)calls >= breaker->config.minimum_calls) &&
+                ((uint64_t)failures * 100 >= (uint64_t)breaker->config.failure_percent * (uint32_t)calls)
+                )
+            {
+                /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_017: [ If the window has at least minimum_calls calls and the percentage of failures is at least failure_percent then h_fabric_circuit_breaker_exit shall record the current time as the time the breaker opened and switch the state from H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED to H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN. ]*/
+                (void)interlocked_exchange_64(&breaker->opened_ms, now);
+                if (interlocked_compare_exchange(&breaker->state, H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED) == H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED)
+                {
+                    LogWarning("circuit breaker %p opened for %" PRIu32 " ms after %" PRId32 " failures in %" PRId32 " calls", breaker, breaker->config.open_ms, failures, calls);
+                }
+            }
+        }
+    }
+}
+
+H_FABRIC_CIRCUIT_BREAKER_STATE h_fabric_circuit_breaker_get_state(H_FABRIC_CIRCUIT_BREAKER* breaker)
+{
+    H_FABRIC_CIRCUIT_BREAKER_STATE result;
+    if (breaker == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_018: [ If breaker is NULL then h_fabric_circuit_breaker_get_state shall return H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED. ]*/
+        LogError("Invalid arguments: H_FABRIC_CIRCUIT_BREAKER* breaker=%p", breaker);
+        result = H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CIRCUIT_BREAKER_01_019: [ h_fabric_circuit_breaker_get_state shall return the state of breaker. ]*/
+        result = (H_FABRIC_CIRCUIT_BREAKER_STATE)interlocked_add(&breaker->state, 0);
+    }
+    return result;
+}
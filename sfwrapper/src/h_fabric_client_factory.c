@@ -0,0 +1,88 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stddef.h>
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+
+#include "sf_c_util/hresult_to_string.h"
+
+#include "h_fabric_client_factory.h"
+
+#ifdef H_FABRIC_CLIENT_FACTORY_SEAM
+/*H_FABRIC_CLIENT_FACTORY*, NULL when the clients come from FabricCreateLocalClient. Only ever replaced with interlocked_exchange_pointer*/
+static void* volatile_atomic current_factory = NULL;
+
+void h_fabric_client_factory_set(const H_FABRIC_CLIENT_FACTORY* factory)
+{
+    if (
+        (factory != NULL) &&
+        (factory->create_local_client == NULL)
+        )
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_FACTORY_01_001: [ If factory is not NULL and its create_local_client is NULL then h_fabric_client_factory_set shall return. ]*/
+        LogError("invalid arguments const H_FABRIC_CLIENT_FACTORY* factory=%p, factory->create_local_client=%p", factory, factory->create_local_client);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_FACTORY_01_002: [ h_fabric_client_factory_set shall make factory the factory of the process by calling interlocked_exchange_pointer. ]*/
+        /*Codes_SRS_H_FABRIC_CLIENT_FACTORY_01_003: [ If factory is NULL then the clients shall be created by FabricCreateLocalClient again. ]*/
+        (void)interlocked_exchange_pointer(&current_factory, (void*)factory);
+    }
+}
+#endif
+
+HRESULT h_fabric_client_factory_create_local_client(REFIID iid, void** fabricClient)
+{
+    HRESULT result;
+    if (
+        /*Codes_SRS_H_FABRIC_CLIENT_FACTORY_01_004: [ If iid is NULL then h_fabric_client_factory_create_local_client shall fail and return E_POINTER. ]*/
+        (iid == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_FACTORY_01_005: [ If fabricClient is NULL then h_fabric_client_factory_create_local_client shall fail and return E_POINTER. ]*/
+        (fabricClient == NULL)
+        )
+    {
+        LogError("invalid arguments REFIID iid=%p, void** fabricClient=%p", iid, fabricClient);
+        result = E_POINTER;
+    }
+    else
+    {
+#ifdef H_FABRIC_CLIENT_FACTORY_SEAM
+        /*Codes_SRS_H_FABRIC_CLIENT_FACTORY_01_006: [ h_fabric_client_factory_create_local_client shall read the factory of the process by calling interlocked_compare_exchange_pointer. ]*/
+        const H_FABRIC_CLIENT_FACTORY* factory = interlocked_compare_exchange_pointer(&current_factory, NULL, NULL);
+        if (factory == NULL)
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_FACTORY_01_007: [ If there is no factory then h_fabric_client_factory_create_local_client shall call FabricCreateLocalClient with iid and fabricClient and return its result. ]*/
+            result = FabricCreateLocalClient(iid, fabricClient);
+            if (FAILED(result))
+            {
+                LogHRESULTError(result, "failure in FabricCreateLocalClient(iid=%p, fabricClient=%p)", iid, fabricClient);
+            }
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_FACTORY_01_008: [ Otherwise h_fabric_client_factory_create_local_client shall call create_local_client of the factory with its context, iid and fabricClient and return its result. ]*/
+            result = factory->create_local_client(factory->context, iid, fabricClient);
+            if (FAILED(result))
+            {
+                LogHRESULTError(result, "failure in factory->create_local_client(factory->context=%p, iid=%p, fabricClient=%p)", factory->context, iid, fabricClient);
+            }
+        }
+#else
+        /*Codes_SRS_H_FABRIC_CLIENT_FACTORY_01_009: [ If H_FABRIC_CLIENT_FACTORY_SEAM is not defined then h_fabric_client_factory_create_local_client shall call FabricCreateLocalClient with iid and fabricClient and return its result. ]*/
+        result = FabricCreateLocalClient(iid, fabricClient);
+        if (FAILED(result))
+        {
+            LogHRESULTError(result, "failure in FabricCreateLocalClient(iid=%p, fabricClient=%p)", iid, fabricClient);
+        }
+#endif
+    }
+    return result;
+}
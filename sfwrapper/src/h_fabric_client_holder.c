@@ -0,0 +1,269 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+
+#include "sf_c_util/hresult_to_string.h"
+
+#include "h_fabric_client_holder.h"
+
+static H_FABRIC_CLIENT_GENERATION* generation_create(void* instance, uint32_t generation_number)
+{
+    H_FABRIC_CLIENT_GENERATION* result = malloc(sizeof(H_FABRIC_CLIENT_GENERATION));
+    if (result == NULL)
+    {
+        LogError("failure in malloc(sizeof(H_FABRIC_CLIENT_GENERATION)=%zu)", sizeof(H_FABRIC_CLIENT_GENERATION));
+        /*return as is*/
+    }
+    else
+    {
+        result->instance = instance;
+        result->generation = generation_number;
+        /*the reference of the holder*/
+        (void)interlocked_exchange(&result->ref_count, 1);
+    }
+    return result;
+}
+
+static void generation_dec_ref(H_FABRIC_CLIENT_HOLDER* holder, H_FABRIC_CLIENT_GENERATION* generation)
+{
+    if (interlocked_decrement(&generation->ref_count) == 0)
+    {
+        holder->release_instance(generation->instance);
+        free(generation);
+    }
+}
+
+static H_FABRIC_CLIENT_GENERATION* get_current(H_FABRIC_CLIENT_HOLDER* holder)
+{
+    return interlocked_compare_exchange_pointer(&holder->current, NULL, NULL);
+}
+
+int h_fabric_client_holder_init(H_FABRIC_CLIENT_HOLDER* holder, void* instance, H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE create_instance, H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE release_instance)
+{
+    int result;
+    if (
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_001: [ If holder is NULL then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+        (holder == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_002: [ If instance is NULL then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+        (instance == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_003: [ If create_instance is NULL then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+        (create_instance == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_004: [ If release_instance is NULL then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+        (release_instance == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_CLIENT_HOLDER* holder=%p, void* instance=%p, H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE create_instance=%p, H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE release_instance=%p",
+            holder, instance, create_instance, release_instance);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_005: [ h_fabric_client_holder_init shall allocate a H_FABRIC_CLIENT_GENERATION for instance with generation number 1 and a reference count of 1, owned by the holder. ]*/
+        H_FABRIC_CLIENT_GENERATION* generation = generation_create(instance, 1);
+        if (generation == NULL)
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_006: [ If there are any failures then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+            LogError("failure in generation_create(instance=%p, 1)", instance);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_007: [ h_fabric_client_holder_init shall make the generation the current generation of holder. ]*/
+            holder->create_instance = create_instance;
+            holder->release_instance = release_instance;
+            (void)interlocked_exchange(&holder->pins, 0);
+            (void)interlocked_exchange(&holder->is_recreating, 0);
+            (void)interlocked_exchange_pointer(&holder->current, generation);
+
+            /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_008: [ h_fabric_client_holder_init shall succeed and return 0. ]*/
+            result = 0;
+        }
+    }
+    return result;
+}
+
+void h_fabric_client_holder_deinit(H_FABRIC_CLIENT_HOLDER* holder)
+{
+    if (holder == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_009: [ If holder is NULL then h_fabric_client_holder_deinit shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_CLIENT_HOLDER* holder=%p", holder);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_010: [ h_fabric_client_holder_deinit shall give up the reference of the holder on the current generation, releasing the instance and freeing the generation when it was the last reference. ]*/
+        H_FABRIC_CLIENT_GENERATION* generation = interlocked_exchange_pointer(&holder->current, NULL);
+        if (generation != NULL)
+        {
+            generation_dec_ref(holder, generation);
+        }
+    }
+}
+
+H_FABRIC_CLIENT_GENERATION* h_fabric_client_holder_acquire(H_FABRIC_CLIENT_HOLDER* holder)
+{
+    H_FABRIC_CLIENT_GENERATION* result;
+    if (holder == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_011: [ If holder is NULL then h_fabric_client_holder_acquire shall fail and return NULL. ]*/
+        LogError("Invalid arguments: H_FABRIC_CLIENT_HOLDER* holder=%p", holder);
+        result = NULL;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_012: [ h_fabric_client_holder_acquire shall increment the number of pins of holder. ]*/
+        /*while pinned, the generation read below cannot lose the reference of the holder (h_fabric_client_holder_recreate waits for pins to drain before giving it up)*/
+        (void)interlocked_increment(&holder->pins);
+
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_013: [ h_fabric_client_holder_acquire shall read the current generation and increment its reference count. ]*/
+        result = get_current(holder);
+        (void)interlocked_increment(&result->ref_count);
+
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_014: [ h_fabric_client_holder_acquire shall decrement the number of pins and, if it reaches 0 while a recreate is in progress, wake the recreating thread. ]*/
+        if (
+            (interlocked_decrement(&holder->pins) == 0) &&
+            (interlocked_add(&holder->is_recreating, 0) != 0)
+            )
+        {
+            wake_by_address_single(&holder->pins);
+        }
+
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_015: [ h_fabric_client_holder_acquire shall return the generation. ]*/
+    }
+    return result;
+}
+
+void h_fabric_client_holder_release(H_FABRIC_CLIENT_HOLDER* holder, H_FABRIC_CLIENT_GENERATION* generation)
+{
+    if (
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_016: [ If holder is NULL then h_fabric_client_holder_release shall return. ]*/
+        (holder == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_017: [ If generation is NULL then h_fabric_client_holder_release shall return. ]*/
+        (generation == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_CLIENT_HOLDER* holder=%p, H_FABRIC_CLIENT_GENERATION* generation=%p", holder, generation);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_018: [ h_fabric_client_holder_release shall decrement the reference count of generation. ]*/
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_019: [ If the reference count reaches 0 then h_fabric_client_holder_release shall release the instance by calling release_instance and free the generation. ]*/
+        generation_dec_ref(holder, generation);
+    }
+}
+
+int h_fabric_client_holder_recreate(H_FABRIC_CLIENT_HOLDER* holder, H_FABRIC_CLIENT_GENERATION* failed_generation)
+{
+    int result;
+    if (
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_020: [ If holder is NULL then h_fabric_client_holder_recreate shall fail and return a non-zero value. ]*/
+        (holder == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_021: [ If failed_generation is NULL then h_fabric_client_holder_recreate shall fail and return a non-zero value. ]*/
+        (failed_generation == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_CLIENT_HOLDER* holder=%p, H_FABRIC_CLIENT_GENERATION* failed_generation=%p", holder, failed_generation);
+        result = MU_FAILURE;
+    }
+    /*the caller holds a reference on failed_generation, so its address cannot be reused by a newer generation while comparing*/
+    else if (get_current(holder) != failed_generation)
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_022: [ If failed_generation is not the current generation then h_fabric_client_holder_recreate shall succeed and return 0 (another thread already replaced it). ]*/
+        result = 0;
+    }
+    /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_023: [ h_fabric_client_holder_recreate shall switch is_recreating from 0 to 1. ]*/
+    else if (interlocked_compare_exchange(&holder->is_recreating, 1, 0) != 0)
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_024: [ If another thread is already recreating then h_fabric_client_holder_recreate shall wait for is_recreating to become 0 by calling InterlockedHL_WaitForValue. ]*/
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&holder->is_recreating, 0, UINT32_MAX);
+        if (wait_result != INTERLOCKED_HL_OK)
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_025: [ If waiting fails then h_fabric_client_holder_recreate shall fail and return a non-zero value. ]*/
+            LogError("failure in InterlockedHL_WaitForValue(&holder->is_recreating=%p, 0, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d", &holder->is_recreating, (int)wait_result);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_026: [ h_fabric_client_holder_recreate shall succeed and return 0 if the other thread replaced failed_generation, otherwise it shall fail and return a non-zero value. ]*/
+            result = (get_current(holder) != failed_generation) ? 0 : MU_FAILURE;
+        }
+    }
+    else
+    {
+        if (get_current(holder) != failed_generation)
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_022: [ If failed_generation is not the current generation then h_fabric_client_holder_recreate shall succeed and return 0 (another thread already replaced it). ]*/
+            /*another thread finished recreating between the check above and winning is_recreating*/
+            result = 0;
+        }
+        else
+        {
+            void* instance;
+            /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_027: [ h_fabric_client_holder_recreate shall create a new instance by calling create_instance. ]*/
+            HRESULT hr = holder->create_instance(&instance);
+            if (FAILED(hr))
+            {
+                /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_028: [ If there are any failures then h_fabric_client_holder_recreate shall keep failed_generation as the current generation, fail and return a non-zero value. ]*/
+                LogHRESULTError(hr, "failure in create_instance(&instance=%p)", &instance);
+                result = MU_FAILURE;
+            }
+            else
+            {
+                /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_029: [ h_fabric_client_holder_recreate shall allocate a H_FABRIC_CLIENT_GENERATION for the new instance with the generation number of failed_generation + 1. ]*/
+                H_FABRIC_CLIENT_GENERATION* generation = generation_create(instance, failed_generation->generation + 1);
+                if (generation == NULL)
+                {
+                    /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_028: [ If there are any failures then h_fabric_client_holder_recreate shall keep failed_generation as the current generation, fail and return a non-zero value. ]*/
+                    LogError("failure in generation_create(instance=%p, %" PRIu32 ")", instance, failed_generation->generation + 1);
+                    holder->release_instance(instance);
+                    result = MU_FAILURE;
+                }
+                else
+                {
+                    /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_030: [ h_fabric_client_holder_recreate shall make the new generation the current generation. ]*/
+                    (void)interlocked_exchange_pointer(&holder->current, generation);
+
+                    /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_031: [ h_fabric_client_holder_recreate shall wait for the number of pins of holder to reach 0 by calling InterlockedHL_WaitForValue. ]*/
+                    /*a thread pinned before the exchange might have read failed_generation and not referenced it yet*/
+                    INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&holder->pins, 0, UINT32_MAX);
+                    if (wait_result != INTERLOCKED_HL_OK)
+                    {
+                        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_032: [ If waiting for the pins fails then h_fabric_client_holder_recreate shall not give up the reference of the holder on failed_generation. ]*/
+                        /*leaking one instance is better than releasing it under a reader*/
+                        LogError("failure in InterlockedHL_WaitForValue(&holder->pins=%p, 0, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d, leaking generation %" PRIu32 "",
+                            &holder->pins, (int)wait_result, failed_generation->generation);
+                    }
+                    else
+                    {
+                        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_033: [ h_fabric_client_holder_recreate shall give up the reference of the holder on failed_generation. ]*/
+                        generation_dec_ref(holder, failed_generation);
+                    }
+
+                    LogInfo("recreated instance, generation %" PRIu32 " replaced by generation %" PRIu32 "", failed_generation->generation, generation->generation);
+
+                    /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_034: [ h_fabric_client_holder_recreate shall succeed and return 0. ]*/
+                    result = 0;
+                }
+            }
+        }
+
+        /*Codes_SRS_H_FABRIC_CLIENT_HOLDER_01_035: [ h_fabric_client_holder_recreate shall set is_recreating to 0 and wake all the threads waiting for it. ]*/
+        (void)interlocked_exchange(&holder->is_recreating, 0);
+        wake_by_address_all(&holder->is_recreating);
+    }
+    return result;
+}
@@ -0,0 +1,246 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+
+#include "sf_c_util/hresult_to_string.h"
+
+#include "h_fabric_client_holder.h"
+
+#include "h_fabric_client_pool.h"
+
+MU_DEFINE_ENUM_STRINGS(H_FABRIC_CLIENT_POOL_SELECTION, H_FABRIC_CLIENT_POOL_SELECTION_VALUES)
+
+/*thread ids are not spread evenly (on Windows they are multiples of 4), so they are scrambled before picking a client*/
+#define THREAD_ID_HASH_MULTIPLIER 2654435761U
+
+static uint32_t get_thread_affinity_index(uint32_t size)
+{
+    uint32_t hash = (uint32_t)GetCurrentThreadId() * THREAD_ID_HASH_MULTIPLIER;
+    /*takes the high bits of the hash, the low bits keep the pattern of the thread ids*/
+    return (uint32_t)(((uint64_t)hash * size) >> 32);
+}
+
+/*excluded is the index of an entry that is never picked, NO_EXCLUDED_INDEX when any entry can be picked. At least one entry is not excluded*/
+#define NO_EXCLUDED_INDEX UINT32_MAX
+
+/*moves where a thread starts looking for the least loaded client, so that idle clients take turns. Every thread has its own, the threads do not share any counter*/
+static __declspec(thread) uint32_t thread_start_offset;
+
+static uint32_t get_least_in_flight_index(H_FABRIC_CLIENT_POOL* pool, uint32_t excluded)
+{
+    uint32_t start = (get_thread_affinity_index(pool->size) + thread_start_offset++) % pool->size;
+    if (start == excluded)
+    {
+        start = (start + 1) % pool->size;
+    }
+    uint32_t result = start;
+    int32_t least_in_flight = ReadNoFence((volatile LONG*)&pool->entries[start].in_flight);
+
+    /*the counters keep changing while they are read, this is a hint and not an exact minimum. They are read with plain loads, an interlocked read would take every cache line exclusively*/
+    for (uint32_t i = 1; (i < pool->size) && (least_in_flight > 0); i++)
+    {
+        uint32_t index = (start + i) % pool->size;
+        if (index == excluded)
+        {
+            continue;
+        }
+        int32_t in_flight = ReadNoFence((volatile LONG*)&pool->entries[index].in_flight);
+        if (in_flight < least_in_flight)
+        {
+            least_in_flight = in_flight;
+            result = index;
+        }
+    }
+    return result;
+}
+
+int h_fabric_client_pool_init(H_FABRIC_CLIENT_POOL* pool, H_FABRIC_CLIENT_POOL_ENTRY* entries, uint32_t size, H_FABRIC_CLIENT_POOL_SELECTION selection, H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE create_instance, H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE release_instance)
+{
+    int result;
+    if (
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_001: [ If pool is NULL then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+        (pool == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_002: [ If entries is NULL then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+        (entries == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_003: [ If size is 0 then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+        (size == 0) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_004: [ If selection is not a valid H_FABRIC_CLIENT_POOL_SELECTION then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+        ((selection != H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY) && (selection != H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT)) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_005: [ If create_instance is NULL then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+        (create_instance == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_006: [ If release_instance is NULL then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+        (release_instance == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_CLIENT_POOL* pool=%p, H_FABRIC_CLIENT_POOL_ENTRY* entries=%p, uint32_t size=%" PRIu32 ", H_FABRIC_CLIENT_POOL_SELECTION selection=%" PRI_MU_ENUM ", H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE create_instance=%p, H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE release_instance=%p",
+            pool, entries, size, MU_ENUM_VALUE(H_FABRIC_CLIENT_POOL_SELECTION, selection), create_instance, release_instance);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        uint32_t i;
+        for (i = 0; i < size; i++)
+        {
+            void* instance;
+            /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_007: [ For each of the size entries, h_fabric_client_pool_init shall create an instance by calling create_instance. ]*/
+            HRESULT hr = create_instance(&instance);
+            if (FAILED(hr))
+            {
+                /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_010: [ If there are any failures then h_fabric_client_pool_init shall deinitialize the holders initialized so far, fail and return a non-zero value. ]*/
+                LogHRESULTError(hr, "failure in create_instance(&instance=%p) for client %" PRIu32 " of %" PRIu32 "", &instance, i, size);
+                break;
+            }
+
+            /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_008: [ h_fabric_client_pool_init shall hand the instance to the holder of the entry by calling h_fabric_client_holder_init. ]*/
+            if (h_fabric_client_holder_init(&entries[i].holder, instance, create_instance, release_instance) != 0)
+            {
+                /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_009: [ If h_fabric_client_holder_init fails then h_fabric_client_pool_init shall release the instance by calling release_instance. ]*/
+                /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_010: [ If there are any failures then h_fabric_client_pool_init shall deinitialize the holders initialized so far, fail and return a non-zero value. ]*/
+                LogError("failure in h_fabric_client_holder_init(&entries[%" PRIu32 "].holder=%p, instance=%p, ...)", i, &entries[i].holder, instance);
+                release_instance(instance);
+                break;
+            }
+
+            (void)interlocked_exchange(&entries[i].in_flight, 0);
+        }
+
+        if (i < size)
+        {
+            while (i > 0)
+            {
+                i--;
+                h_fabric_client_holder_deinit(&entries[i].holder);
+            }
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_011: [ h_fabric_client_pool_init shall store entries, size and selection in pool and succeed and return 0. ]*/
+            pool->entries = entries;
+            pool->size = size;
+            pool->selection = selection;
+            result = 0;
+        }
+    }
+    return result;
+}
+
+void h_fabric_client_pool_deinit(H_FABRIC_CLIENT_POOL* pool)
+{
+    if (pool == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_012: [ If pool is NULL then h_fabric_client_pool_deinit shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_CLIENT_POOL* pool=%p", pool);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_013: [ h_fabric_client_pool_deinit shall call h_fabric_client_holder_deinit for the holder of every entry. ]*/
+        for (uint32_t i = 0; i < pool->size; i++)
+        {
+            h_fabric_client_holder_deinit(&pool->entries[i].holder);
+        }
+    }
+}
+
+H_FABRIC_CLIENT_POOL_ENTRY* h_fabric_client_pool_acquire(H_FABRIC_CLIENT_POOL* pool)
+{
+    H_FABRIC_CLIENT_POOL_ENTRY* result;
+    if (pool == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_014: [ If pool is NULL then h_fabric_client_pool_acquire shall fail and return NULL. ]*/
+        LogError("Invalid arguments: H_FABRIC_CLIENT_POOL* pool=%p", pool);
+        result = NULL;
+    }
+    else
+    {
+        uint32_t index;
+        if (pool->size == 1)
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_015: [ If pool has only 1 entry then h_fabric_client_pool_acquire shall pick it. ]*/
+            index = 0;
+        }
+        else if (pool->selection == H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY)
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_016: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY then h_fabric_client_pool_acquire shall pick the entry given by a hash of the id of the calling thread. ]*/
+            index = get_thread_affinity_index(pool->size);
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_017: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT then h_fabric_client_pool_acquire shall pick the entry with the fewest calls in flight, looking at the entries starting with one given by a hash of the id of the calling thread, moved by one at every call of that thread. ]*/
+            index = get_least_in_flight_index(pool, NO_EXCLUDED_INDEX);
+        }
+
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_018: [ h_fabric_client_pool_acquire shall increment the number of calls in flight of the entry and return it. ]*/
+        result = &pool->entries[index];
+        (void)interlocked_increment(&result->in_flight);
+    }
+    return result;
+}
+
+H_FABRIC_CLIENT_POOL_ENTRY* h_fabric_client_pool_acquire_other(H_FABRIC_CLIENT_POOL* pool, H_FABRIC_CLIENT_POOL_ENTRY* other)
+{
+    H_FABRIC_CLIENT_POOL_ENTRY* result;
+    if (pool == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_022: [ If pool is NULL then h_fabric_client_pool_acquire_other shall fail and return NULL. ]*/
+        LogError("Invalid arguments: H_FABRIC_CLIENT_POOL* pool=%p, H_FABRIC_CLIENT_POOL_ENTRY* other=%p", pool, other);
+        result = NULL;
+    }
+    else if (other == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_023: [ If other is NULL then h_fabric_client_pool_acquire_other shall pick the entry the same way as h_fabric_client_pool_acquire. ]*/
+        result = h_fabric_client_pool_acquire(pool);
+    }
+    else
+    {
+        uint32_t index;
+        if (pool->size == 1)
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_024: [ If pool has only 1 entry then h_fabric_client_pool_acquire_other shall pick it. ]*/
+            index = 0;
+        }
+        else if (pool->selection == H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY)
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_025: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY then h_fabric_client_pool_acquire_other shall pick the entry after other. ]*/
+            index = ((uint32_t)(other - pool->entries) + 1) % pool->size;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_026: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT then h_fabric_client_pool_acquire_other shall pick the entry with the fewest calls in flight except other, looking at the entries starting with one given by a hash of the id of the calling thread, moved by one at every call of that thread. ]*/
+            index = get_least_in_flight_index(pool, (uint32_t)(other - pool->entries));
+        }
+
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_027: [ h_fabric_client_pool_acquire_other shall increment the number of calls in flight of the entry and return it. ]*/
+        result = &pool->entries[index];
+        (void)interlocked_increment(&result->in_flight);
+    }
+    return result;
+}
+
+void h_fabric_client_pool_release(H_FABRIC_CLIENT_POOL* pool, H_FABRIC_CLIENT_POOL_ENTRY* entry)
+{
+    if (
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_019: [ If pool is NULL then h_fabric_client_pool_release shall return. ]*/
+        (pool == NULL) ||
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_020: [ If entry is NULL then h_fabric_client_pool_release shall return. ]*/
+        (entry == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_CLIENT_POOL* pool=%p, H_FABRIC_CLIENT_POOL_ENTRY* entry=%p", pool, entry);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_CLIENT_POOL_01_021: [ h_fabric_client_pool_release shall decrement the number of calls in flight of entry. ]*/
+        (void)interlocked_decrement(&entry->in_flight);
+    }
+}
@@ -0,0 +1,775 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <wchar.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/srw_lock.h"
+#include "c_pal/sync.h"
+
+#include "com_wrapper/com_wrapper.h"
+
+#include "sf_c_util/hresult_to_string.h"
+
+#include "ifabricservicemanagementclient6sync.h"
+#include "h_fabric_service_notification_handler.h"
+#include "h_fabric_service_notification_handler_com.h"
+
+#include "h_fabric_endpoint_table.h"
+
+/*one partition as last notified by SF. Immutable once created, shared by all the snapshots that contain it*/
+typedef struct ENDPOINT_TABLE_PARTITION_TAG
+{
+    volatile_atomic int32_t ref_count; /*1 for every snapshot that contains the partition*/
+    FABRIC_PARTITION_ID partition_id;
+    IFabricServiceEndpointsVersion* version; /*NULL when SF did not produce a version*/
+    union
+    {
+        FABRIC_SINGLETON_PARTITION_INFORMATION singleton;
+        FABRIC_INT64_RANGE_PARTITION_INFORMATION int64_range;
+        FABRIC_NAMED_PARTITION_INFORMATION named;
+    } info;
+    FABRIC_RESOLVED_SERVICE_PARTITION partition; /*what readers get, all its pointers point inside this allocation*/
+    FABRIC_RESOLVED_SERVICE_ENDPOINT endpoints[]; /*followed by the service name, the endpoint addresses and the partition name*/
+} ENDPOINT_TABLE_PARTITION;
+
+typedef struct H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_TAG
+{
+    volatile_atomic int32_t ref_count; /*1 for the table while this is the current snapshot + 1 for every reader*/
+    uint64_t version; /*incremented by every published snapshot*/
+    uint32_t partition_count;
+    ENDPOINT_TABLE_PARTITION* partitions[]; /*sorted by service name, then by partition id*/
+} H_FABRIC_ENDPOINT_TABLE_SNAPSHOT;
+
+#define ENDPOINT_TABLE_CACHE_LINE_SIZE 64
+
+/*thread ids are not spread evenly (on Windows they are multiples of 4), so they are scrambled before picking a pin slot*/
+#define THREAD_ID_HASH_MULTIPLIER 2654435761U
+
+/*readers pin in the slot of their thread, so readers on different threads do not write the same cache line.
+The slots are padded to 2 cache lines: the table is only 16 bytes aligned, and with 2 lines the pins of 2 slots never share a cache line*/
+typedef struct ENDPOINT_TABLE_PIN_SLOT_TAG
+{
+    volatile_atomic int32_t pins[2]; /*number of readers between reading current and taking a reference on it, per generation*/
+    unsigned char padding[2 * ENDPOINT_TABLE_CACHE_LINE_SIZE - 2 * sizeof(int32_t)];
+} ENDPOINT_TABLE_PIN_SLOT;
+
+typedef struct H_FABRIC_ENDPOINT_TABLE_TAG
+{
+    ENDPOINT_TABLE_PIN_SLOT pin_slots[H_FABRIC_ENDPOINT_TABLE_PIN_SLOT_COUNT]; /*first, so that the padding of the last slot keeps the fields below off the pins*/
+    void* volatile_atomic current; /*H_FABRIC_ENDPOINT_TABLE_SNAPSHOT*, only ever replaced with interlocked_exchange_pointer*/
+    volatile_atomic int32_t pin_generation; /*index in pins where new readers pin, switched by every publish. Only written by publish, so readers keep it shared in their caches*/
+    SRW_LOCK_HANDLE writer_lock; /*serializes applying notifications, readers never take it*/
+    H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE handler; /*owned by notification_handler, kept to close it*/
+    IFabricServiceNotificationEventHandler* notification_handler;
+    IFabricServiceManagementClient6* client;
+} H_FABRIC_ENDPOINT_TABLE;
+
+static void partition_dec_ref(ENDPOINT_TABLE_PARTITION* partition)
+{
+    if (interlocked_decrement(&partition->ref_count) == 0)
+    {
+        if (partition->version != NULL)
+        {
+            (void)partition->version->lpVtbl->Release(partition->version);
+        }
+        free(partition);
+    }
+}
+
+static size_t string_length_or_zero(LPCWSTR s)
+{
+    return (s == NULL) ? 0 : wcslen(s);
+}
+
+static wchar_t* copy_string(wchar_t** destination, LPCWSTR source)
+{
+    wchar_t* result = *destination;
+    size_t length = string_length_or_zero(source);
+    if (length > 0)
+    {
+        (void)memcpy(result, source, length * sizeof(wchar_t));
+    }
+    result[length] = L'\0';
+    *destination += length + 1;
+    return result;
+}
+
+static ENDPOINT_TABLE_PARTITION* partition_create(const FABRIC_SERVICE_NOTIFICATION* notification, IFabricServiceEndpointsVersion* version)
+{
+    ENDPOINT_TABLE_PARTITION* result;
+    FABRIC_SERVICE_PARTITION_KIND kind = ((notification->PartitionInfo == NULL) || (notification->PartitionInfo->Value == NULL)) ? FABRIC_SERVICE_PARTITION_KIND_INVALID : notification->PartitionInfo->Kind;
+    LPCWSTR partition_name = (kind == FABRIC_SERVICE_PARTITION_KIND_NAMED) ? ((const FABRIC_NAMED_PARTITION_INFORMATION*)notification->PartitionInfo->Value)->Name : NULL;
+
+    size_t string_chars = string_length_or_zero(notification->ServiceName) + 1 + string_length_or_zero(partition_name) + 1;
+    for (ULONG i = 0; i < notification->EndpointCount; i++)
+    {
+        string_chars += string_length_or_zero(notification->Endpoints[i].Address) + 1;
+    }
+
+    result = malloc_flex(sizeof(ENDPOINT_TABLE_PARTITION) + (size_t)notification->EndpointCount * sizeof(FABRIC_RESOLVED_SERVICE_ENDPOINT), string_chars, sizeof(wchar_t));
+    if (result == NULL)
+    {
+        LogError("failure in malloc_flex(sizeof(ENDPOINT_TABLE_PARTITION)=%zu + EndpointCount=%lu * sizeof(FABRIC_RESOLVED_SERVICE_ENDPOINT)=%zu, string_chars=%zu, sizeof(wchar_t)=%zu)",
+            sizeof(ENDPOINT_TABLE_PARTITION), notification->EndpointCount, sizeof(FABRIC_RESOLVED_SERVICE_ENDPOINT), string_chars, sizeof(wchar_t));
+        /*return as is*/
+    }
+    else
+    {
+        wchar_t* strings = (wchar_t*)&result->endpoints[notification->EndpointCount];
+
+        (void)interlocked_exchange(&result->ref_count, 1);
+        result->partition_id = notification->PartitionId;
+        result->version = version;
+        if (version != NULL)
+        {
+            (void)version->lpVtbl->AddRef(version);
+        }
+
+        result->partition.ServiceName = copy_string(&strings, notification->ServiceName);
+        for (ULONG i = 0; i < notification->EndpointCount; i++)
+        {
+            result->endpoints[i].Address = copy_string(&strings, notification->Endpoints[i].Address);
+            result->endpoints[i].Role = notification->Endpoints[i].Role;
+            result->endpoints[i].Reserved = NULL;
+        }
+        result->partition.EndpointCount = notification->EndpointCount;
+        result->partition.Endpoints = result->endpoints;
+        result->partition.Reserved = NULL;
+
+        result->partition.Info.Kind = kind;
+        result->partition.Info.Value = &result->info;
+        switch (kind)
+        {
+            case FABRIC_SERVICE_PARTITION_KIND_SINGLETON:
+            {
+                result->info.singleton = *(const FABRIC_SINGLETON_PARTITION_INFORMATION*)notification->PartitionInfo->Value;
+                result->info.singleton.Reserved = NULL;
+                break;
+            }
+            case FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE:
+            {
+                result->info.int64_range = *(const FABRIC_INT64_RANGE_PARTITION_INFORMATION*)notification->PartitionInfo->Value;
+                result->info.int64_range.Reserved = NULL;
+                break;
+            }
+            case FABRIC_SERVICE_PARTITION_KIND_NAMED:
+            {
+                result->info.named = *(const FABRIC_NAMED_PARTITION_INFORMATION*)notification->PartitionInfo->Value;
+                result->info.named.Name = copy_string(&strings, partition_name);
+                result->info.named.Reserved = NULL;
+                break;
+            }
+            default:
+            {
+                /*nothing is known about the partition except its id, it can only be found by an enumeration of the snapshot*/
+                result->partition.Info.Kind = FABRIC_SERVICE_PARTITION_KIND_INVALID;
+                result->partition.Info.Value = NULL;
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+static int compare_partition(const ENDPOINT_TABLE_PARTITION* partition, FABRIC_URI name, const FABRIC_PARTITION_ID* partition_id)
+{
+    int result = wcscmp(partition->partition.ServiceName, name);
+    if ((result == 0) && (partition_id != NULL))
+    {
+        result = memcmp(&partition->partition_id, partition_id, sizeof(FABRIC_PARTITION_ID));
+    }
+    return result;
+}
+
+/*returns the index of the first partition that is not less than (name, partition_id). A NULL partition_id compares only the name*/
+static uint32_t lower_bound(const H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* snapshot, FABRIC_URI name, const FABRIC_PARTITION_ID* partition_id)
+{
+    uint32_t low = 0;
+    uint32_t high = snapshot->partition_count;
+    while (low < high)
+    {
+        uint32_t middle = low + (high - low) / 2;
+        if (compare_partition(snapshot->partitions[middle], name, partition_id) < 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* snapshot_create(uint64_t version, uint32_t partition_count)
+{
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* result = malloc_flex(sizeof(H_FABRIC_ENDPOINT_TABLE_SNAPSHOT), partition_count, sizeof(ENDPOINT_TABLE_PARTITION*));
+    if (result == NULL)
+    {
+        LogError("failure in malloc_flex(sizeof(H_FABRIC_ENDPOINT_TABLE_SNAPSHOT)=%zu, partition_count=%" PRIu32 ", sizeof(ENDPOINT_TABLE_PARTITION*)=%zu)",
+            sizeof(H_FABRIC_ENDPOINT_TABLE_SNAPSHOT), partition_count, sizeof(ENDPOINT_TABLE_PARTITION*));
+        /*return as is*/
+    }
+    else
+    {
+        /*the reference of the table*/
+        (void)interlocked_exchange(&result->ref_count, 1);
+        result->version = version;
+        result->partition_count = partition_count;
+    }
+    return result;
+}
+
+static void snapshot_dec_ref(H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* snapshot)
+{
+    if (interlocked_decrement(&snapshot->ref_count) == 0)
+    {
+        for (uint32_t i = 0; i < snapshot->partition_count; i++)
+        {
+            partition_dec_ref(snapshot->partitions[i]);
+        }
+        free(snapshot);
+    }
+}
+
+/*copies current into a new snapshot where the partition at index is replaced (is_replace), inserted (partition != NULL) or removed (partition == NULL).
+This is O(partition_count) per notification (pointers and ref counts, the partitions themselves are shared), which is fine for the thousands of partitions a filter usually covers*/
+static H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* snapshot_create_next(const H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* current, uint32_t index, bool is_replace, ENDPOINT_TABLE_PARTITION* partition)
+{
+    uint32_t partition_count = current->partition_count - (is_replace ? 1 : 0) + ((partition != NULL) ? 1 : 0);
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* result = snapshot_create(current->version + 1, partition_count);
+    if (result != NULL)
+    {
+        uint32_t j = 0;
+        for (uint32_t i = 0; i < index; i++)
+        {
+            (void)interlocked_increment(&current->partitions[i]->ref_count);
+            result->partitions[j++] = current->partitions[i];
+        }
+        if (partition != NULL)
+        {
+            /*the reference of partition is given to the new snapshot*/
+            result->partitions[j++] = partition;
+        }
+        for (uint32_t i = index + (is_replace ? 1 : 0); i < current->partition_count; i++)
+        {
+            (void)interlocked_increment(&current->partitions[i]->ref_count);
+            result->partitions[j++] = current->partitions[i];
+        }
+    }
+    return result;
+}
+
+/*current and pin_generation are read with plain acquire loads, an interlocked read would take their cache line exclusively on every reader*/
+static H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* get_current(H_FABRIC_ENDPOINT_TABLE* table)
+{
+    return ReadPointerAcquire((PVOID volatile*)&table->current);
+}
+
+static int32_t get_pin_generation(H_FABRIC_ENDPOINT_TABLE* table)
+{
+    return ReadAcquire((volatile LONG*)&table->pin_generation);
+}
+
+/*called with the writer lock held. Blocks the notification thread until the readers pinned in the previous generation are done, which is only the few instructions between reading current and referencing it*/
+static void publish(H_FABRIC_ENDPOINT_TABLE* table, H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* next)
+{
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* previous = interlocked_exchange_pointer(&table->current, next);
+
+    /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_031: [ After publishing the new snapshot, the notification shall switch the pin generation of the table, wait for the pins of the previous generation in every pin slot to reach 0 by calling InterlockedHL_WaitForValue and give up the reference of the table on the previous snapshot. ]*/
+    /*readers that pin from now on can only read next, so only the readers already pinned in the previous generation might have read previous and not referenced it yet.
+    There is a bounded number of those (new readers never join them), so the wait cannot be starved by a constant stream of readers*/
+    int32_t previous_generation = interlocked_add(&table->pin_generation, 0);
+    (void)interlocked_exchange(&table->pin_generation, 1 - previous_generation);
+
+    /*a slot nobody pinned in returns right away, without waiting*/
+    uint32_t i;
+    for (i = 0; i < H_FABRIC_ENDPOINT_TABLE_PIN_SLOT_COUNT; i++)
+    {
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&table->pin_slots[i].pins[previous_generation], 0, UINT32_MAX);
+        if (wait_result != INTERLOCKED_HL_OK)
+        {
+            LogError("failure in InterlockedHL_WaitForValue(&table->pin_slots[i=%" PRIu32 "].pins[previous_generation=%" PRId32 "]=%p, 0, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d",
+                i, previous_generation, &table->pin_slots[i].pins[previous_generation], (int)wait_result);
+            break;
+        }
+    }
+
+    if (i < H_FABRIC_ENDPOINT_TABLE_PIN_SLOT_COUNT)
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_032: [ If waiting for the pins of any pin slot fails then the notification shall not wait for the other pin slots and shall not give up the reference of the table on the previous snapshot. ]*/
+        /*leaking one snapshot is better than freeing it under a reader*/
+        LogError("leaking snapshot version %" PRIu64 "", previous->version);
+    }
+    else
+    {
+        snapshot_dec_ref(previous);
+    }
+}
+
+static ENDPOINT_TABLE_PIN_SLOT* get_pin_slot(H_FABRIC_ENDPOINT_TABLE* table)
+{
+    uint32_t hash = (uint32_t)GetCurrentThreadId() * THREAD_ID_HASH_MULTIPLIER;
+    /*takes the high bits of the hash, the low bits keep the pattern of the thread ids*/
+    return &table->pin_slots[((uint64_t)hash * H_FABRIC_ENDPOINT_TABLE_PIN_SLOT_COUNT) >> 32];
+}
+
+static void unpin(H_FABRIC_ENDPOINT_TABLE* table, ENDPOINT_TABLE_PIN_SLOT* slot, int32_t generation)
+{
+    /*only a notification that switched the generation away from generation waits for its pins*/
+    if (
+        (interlocked_decrement(&slot->pins[generation]) == 0) &&
+        (get_pin_generation(table) != generation)
+        )
+    {
+        wake_by_address_single(&slot->pins[generation]);
+    }
+}
+
+static bool is_older(IFabricServiceEndpointsVersion* version, IFabricServiceEndpointsVersion* known_version)
+{
+    bool result;
+    if ((version == NULL) || (known_version == NULL))
+    {
+        /*nothing to compare, the newest notification wins*/
+        result = false;
+    }
+    else
+    {
+        LONG compare_result;
+        HRESULT hr = version->lpVtbl->Compare(version, known_version, &compare_result);
+        if (FAILED(hr))
+        {
+            LogHRESULTError(hr, "failure in IFabricServiceEndpointsVersion::Compare(version=%p, known_version=%p)", version, known_version);
+            result = false;
+        }
+        else
+        {
+            result = (compare_result < 0);
+        }
+    }
+    return result;
+}
+
+static void apply_notification(H_FABRIC_ENDPOINT_TABLE* table, IFabricServiceNotification* notification)
+{
+    /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_023: [ The notification shall get the notification data by calling IFabricServiceNotification::get_Notification. ]*/
+    const FABRIC_SERVICE_NOTIFICATION* data = notification->lpVtbl->get_Notification(notification);
+    if ((data == NULL) || (data->ServiceName == NULL) || ((data->EndpointCount > 0) && (data->Endpoints == NULL)))
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_024: [ If the notification data is NULL or incomplete then the notification shall be ignored. ]*/
+        LogError("ignoring incomplete notification data=%p", data);
+    }
+    else
+    {
+        IFabricServiceEndpointsVersion* version;
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_025: [ The notification shall get the version of the endpoints by calling IFabricServiceNotification::GetVersion. ]*/
+        HRESULT hr = notification->lpVtbl->GetVersion(notification, &version);
+        if (FAILED(hr))
+        {
+            /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_026: [ If getting the version fails then the notification shall still be applied. ]*/
+            LogHRESULTError(hr, "failure in IFabricServiceNotification::GetVersion, applying the notification for %ls without a version", data->ServiceName);
+            version = NULL;
+        }
+
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_027: [ The notification shall be applied under the exclusive writer lock of the table. ]*/
+        srw_lock_acquire_exclusive(table->writer_lock);
+        {
+            H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* current = get_current(table);
+            uint32_t index = lower_bound(current, data->ServiceName, &data->PartitionId);
+            bool is_known = (index < current->partition_count) && (compare_partition(current->partitions[index], data->ServiceName, &data->PartitionId) == 0);
+
+            if (is_known && is_older(version, current->partitions[index]->version))
+            {
+                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_028: [ If the partition is in the table and the version of the notification is older than the version of the partition then the notification shall be ignored. ]*/
+                LogInfo("ignoring out of order notification for %ls", data->ServiceName);
+            }
+            else if (data->EndpointCount == 0)
+            {
+                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_029: [ If the notification has no endpoints then the notification shall publish a new snapshot without the partition (if it is in the table). ]*/
+                if (is_known)
+                {
+                    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* next = snapshot_create_next(current, index, true, NULL);
+                    if (next == NULL)
+                    {
+                        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_033: [ If there are any failures then the notification shall keep the current snapshot. ]*/
+                        LogError("failure in snapshot_create_next, removal of a partition of %ls is lost", data->ServiceName);
+                    }
+                    else
+                    {
+                        publish(table, next);
+                    }
+                }
+            }
+            else
+            {
+                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_030: [ Otherwise the notification shall copy the partition and its endpoints and publish a new snapshot where the copy replaces the partition or is inserted in service name and partition id order. ]*/
+                ENDPOINT_TABLE_PARTITION* partition = partition_create(data, version);
+                if (partition == NULL)
+                {
+                    /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_033: [ If there are any failures then the notification shall keep the current snapshot. ]*/
+                    LogError("failure in partition_create, notification for %ls is lost", data->ServiceName);
+                }
+                else
+                {
+                    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* next = snapshot_create_next(current, index, is_known, partition);
+                    if (next == NULL)
+                    {
+                        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_033: [ If there are any failures then the notification shall keep the current snapshot. ]*/
+                        LogError("failure in snapshot_create_next, notification for %ls is lost", data->ServiceName);
+                        partition_dec_ref(partition);
+                    }
+                    else
+                    {
+                        publish(table, next);
+                    }
+                }
+            }
+        }
+        srw_lock_release_exclusive(table->writer_lock);
+
+        if (version != NULL)
+        {
+            (void)version->lpVtbl->Release(version);
+        }
+    }
+}
+
+/*not called anymore once h_fabric_endpoint_table_destroy closed the handler*/
+static void on_service_notification(void* context, IFabricServiceNotification* notification)
+{
+    H_FABRIC_ENDPOINT_TABLE* table = context;
+    apply_notification(table, notification);
+}
+
+HRESULT h_fabric_endpoint_table_create_local_client(IFabricServiceNotificationEventHandler* notification_handler, IFabricServiceManagementClient6** client)
+{
+    HRESULT result;
+    if (
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_001: [ If notification_handler is NULL then h_fabric_endpoint_table_create_local_client shall fail and return E_INVALIDARG. ]*/
+        (notification_handler == NULL) ||
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_002: [ If client is NULL then h_fabric_endpoint_table_create_local_client shall fail and return E_INVALIDARG. ]*/
+        (client == NULL)
+        )
+    {
+        LogError("Invalid arguments: IFabricServiceNotificationEventHandler* notification_handler=%p, IFabricServiceManagementClient6** client=%p", notification_handler, client);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_003: [ h_fabric_endpoint_table_create_local_client shall create the client by calling FabricCreateLocalClient3 with notification_handler and return its result. ]*/
+        result = FabricCreateLocalClient3(notification_handler, NULL, &IID_IFabricServiceManagementClient6, (void**)client);
+        if (FAILED(result))
+        {
+            LogHRESULTError(result, "failure in FabricCreateLocalClient3(notification_handler=%p, NULL, &IID_IFabricServiceManagementClient6, client=%p)", notification_handler, client);
+        }
+    }
+    return result;
+}
+
+H_FABRIC_ENDPOINT_TABLE_HANDLE h_fabric_endpoint_table_create(H_FABRIC_ENDPOINT_TABLE_CREATE_CLIENT create_client)
+{
+    H_FABRIC_ENDPOINT_TABLE_HANDLE result;
+    if (create_client == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_004: [ If create_client is NULL then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+        LogError("Invalid arguments: H_FABRIC_ENDPOINT_TABLE_CREATE_CLIENT create_client=%p", create_client);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_005: [ h_fabric_endpoint_table_create shall allocate memory for the table. ]*/
+        result = malloc(sizeof(H_FABRIC_ENDPOINT_TABLE));
+        if (result == NULL)
+        {
+            /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_011: [ If there are any failures then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+            LogError("failure in malloc(sizeof(H_FABRIC_ENDPOINT_TABLE)=%zu)", sizeof(H_FABRIC_ENDPOINT_TABLE));
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_006: [ h_fabric_endpoint_table_create shall create the writer lock by calling srw_lock_create. ]*/
+            result->writer_lock = srw_lock_create(false, "h_fabric_endpoint_table");
+            if (result->writer_lock == NULL)
+            {
+                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_011: [ If there are any failures then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+                LogError("failure in srw_lock_create(false, \"h_fabric_endpoint_table\")");
+            }
+            else
+            {
+                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_007: [ h_fabric_endpoint_table_create shall create an empty snapshot with version 0 and make it the current snapshot. ]*/
+                H_FABRIC_ENDPOINT_TABLE_SNAPSHOT* snapshot = snapshot_create(0, 0);
+                if (snapshot == NULL)
+                {
+                    /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_011: [ If there are any failures then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+                    LogError("failure in snapshot_create(0, 0)");
+                }
+                else
+                {
+                    (void)interlocked_exchange_pointer(&result->current, snapshot);
+                    (void)interlocked_exchange(&result->pin_generation, 0);
+                    for (uint32_t i = 0; i < H_FABRIC_ENDPOINT_TABLE_PIN_SLOT_COUNT; i++)
+                    {
+                        (void)interlocked_exchange(&result->pin_slots[i].pins[0], 0);
+                        (void)interlocked_exchange(&result->pin_slots[i].pins[1], 0);
+                    }
+
+                    /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_008: [ h_fabric_endpoint_table_create shall create a notification handler by calling h_fabric_service_notification_handler_create and COM_WRAPPER_CREATE. ]*/
+                    result->handler = h_fabric_service_notification_handler_create(on_service_notification, result);
+                    if (result->handler == NULL)
+                    {
+                        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_011: [ If there are any failures then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+                        LogError("failure in h_fabric_service_notification_handler_create(on_service_notification=%p, result=%p)", on_service_notification, result);
+                    }
+                    else
+                    {
+                        result->notification_handler = COM_WRAPPER_CREATE(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE, IFabricServiceNotificationEventHandler, result->handler, h_fabric_service_notification_handler_destroy);
+                        if (result->notification_handler == NULL)
+                        {
+                            /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_011: [ If there are any failures then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+                            LogError("failure in COM_WRAPPER_CREATE");
+                            h_fabric_service_notification_handler_destroy(result->handler);
+                        }
+                        else
+                        {
+                            /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_009: [ h_fabric_endpoint_table_create shall create the client by calling create_client with the notification handler. ]*/
+                            HRESULT hr = create_client(result->notification_handler, &result->client);
+                            if (FAILED(hr))
+                            {
+                                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_011: [ If there are any failures then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+                                LogHRESULTError(hr, "failure in create_client(result->notification_handler=%p, &result->client=%p)", result->notification_handler, &result->client);
+                            }
+                            else
+                            {
+                                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_010: [ h_fabric_endpoint_table_create shall succeed and return a non-NULL handle. ]*/
+                                goto allok;
+                            }
+                            (void)result->notification_handler->lpVtbl->Release(result->notification_handler);
+                        }
+                    }
+                    snapshot_dec_ref(snapshot);
+                }
+                srw_lock_destroy(result->writer_lock);
+            }
+            free(result);
+        }
+    }
+    result = NULL;
+allok:;
+    return result;
+}
+
+void h_fabric_endpoint_table_destroy(H_FABRIC_ENDPOINT_TABLE_HANDLE table)
+{
+    if (table == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_012: [ If table is NULL then h_fabric_endpoint_table_destroy shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_ENDPOINT_TABLE_HANDLE table=%p", table);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_013: [ h_fabric_endpoint_table_destroy shall close the notification handler by calling h_fabric_service_notification_handler_close, so that the notifications that arrive from now on are ignored and the notifications in progress are finished. ]*/
+        /*SF can keep the handler (and call it) after the client is released, the handler must not reach the table once it is freed*/
+        h_fabric_service_notification_handler_close(table->handler);
+
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_014: [ h_fabric_endpoint_table_destroy shall release the client (which drops all the filters registered with it) and the notification handler. ]*/
+        (void)table->client->lpVtbl->Release(table->client);
+        (void)table->notification_handler->lpVtbl->Release(table->notification_handler);
+
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_015: [ h_fabric_endpoint_table_destroy shall give up the reference of the table on the current snapshot, destroy the writer lock and free the memory used by the table. ]*/
+        snapshot_dec_ref(get_current(table));
+        srw_lock_destroy(table->writer_lock);
+        free(table);
+    }
+}
+
+HRESULT h_fabric_endpoint_table_add_filter(H_FABRIC_ENDPOINT_TABLE_HANDLE table, FABRIC_URI name, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS flags, DWORD timeoutMilliseconds, LONGLONG* filterId)
+{
+    HRESULT result;
+    if (
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_016: [ If table is NULL then h_fabric_endpoint_table_add_filter shall fail and return E_INVALIDARG. ]*/
+        (table == NULL) ||
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_017: [ If name is NULL then h_fabric_endpoint_table_add_filter shall fail and return E_INVALIDARG. ]*/
+        (name == NULL) ||
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_018: [ If filterId is NULL then h_fabric_endpoint_table_add_filter shall fail and return E_INVALIDARG. ]*/
+        (filterId == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_ENDPOINT_TABLE_HANDLE table=%p, FABRIC_URI name=%ls, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS flags=%d, DWORD timeoutMilliseconds=%lu, LONGLONG* filterId=%p",
+            table, MU_WP_OR_NULL(name), (int)flags, timeoutMilliseconds, filterId);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        FABRIC_SERVICE_NOTIFICATION_FILTER_DESCRIPTION description;
+        description.Name = name;
+        description.Flags = flags;
+        description.Reserved = NULL;
+
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_019: [ h_fabric_endpoint_table_add_filter shall register the filter by calling FSMC6_RegisterServiceNotificationFilter on the client of the table and return its result. ]*/
+        result = FSMC6_RegisterServiceNotificationFilter(table->client, &description, timeoutMilliseconds, filterId);
+        if (FAILED(result))
+        {
+            LogHRESULTError(result, "failure in FSMC6_RegisterServiceNotificationFilter(table->client=%p, name=%ls, flags=%d, timeoutMilliseconds=%lu, filterId=%p)",
+                table->client, name, (int)flags, timeoutMilliseconds, filterId);
+        }
+    }
+    return result;
+}
+
+HRESULT h_fabric_endpoint_table_remove_filter(H_FABRIC_ENDPOINT_TABLE_HANDLE table, LONGLONG filterId, DWORD timeoutMilliseconds)
+{
+    HRESULT result;
+    if (table == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_020: [ If table is NULL then h_fabric_endpoint_table_remove_filter shall fail and return E_INVALIDARG. ]*/
+        LogError("Invalid arguments: H_FABRIC_ENDPOINT_TABLE_HANDLE table=%p, LONGLONG filterId=%" PRId64 ", DWORD timeoutMilliseconds=%lu", table, (int64_t)filterId, timeoutMilliseconds);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_021: [ h_fabric_endpoint_table_remove_filter shall unregister the filter by calling FSMC6_UnregisterServiceNotificationFilter on the client of the table and return its result. ]*/
+        /*the partitions already in the table stay there, they are not updated anymore*/
+        result = FSMC6_UnregisterServiceNotificationFilter(table->client, filterId, timeoutMilliseconds);
+        if (FAILED(result))
+        {
+            LogHRESULTError(result, "failure in FSMC6_UnregisterServiceNotificationFilter(table->client=%p, filterId=%" PRId64 ", timeoutMilliseconds=%lu)",
+                table->client, (int64_t)filterId, timeoutMilliseconds);
+        }
+    }
+    return result;
+}
+
+H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE h_fabric_endpoint_table_acquire_snapshot(H_FABRIC_ENDPOINT_TABLE_HANDLE table)
+{
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE result;
+    if (table == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_034: [ If table is NULL then h_fabric_endpoint_table_acquire_snapshot shall fail and return NULL. ]*/
+        LogError("Invalid arguments: H_FABRIC_ENDPOINT_TABLE_HANDLE table=%p", table);
+        result = NULL;
+    }
+    else
+    {
+        ENDPOINT_TABLE_PIN_SLOT* slot = get_pin_slot(table);
+        int32_t generation;
+        do
+        {
+            /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_035: [ h_fabric_endpoint_table_acquire_snapshot shall increment the number of pins of the current pin generation in the pin slot of the calling thread. ]*/
+            /*while pinned in the current generation, the snapshot read below cannot lose the reference of the table (publishing waits for the pins of its generation to drain before giving it up)*/
+            generation = get_pin_generation(table);
+            (void)interlocked_increment(&slot->pins[generation]);
+
+            if (get_pin_generation(table) != generation)
+            {
+                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_049: [ If the pin generation changed meanwhile then h_fabric_endpoint_table_acquire_snapshot shall decrement the number of pins it incremented and start over. ]*/
+                /*a notification might already wait for this generation to drain, do not read current under it*/
+                unpin(table, slot, generation);
+                result = NULL;
+            }
+            else
+            {
+                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_036: [ h_fabric_endpoint_table_acquire_snapshot shall read the current snapshot and increment its reference count. ]*/
+                /*this is the only write all the readers share, the snapshot has to outlive the next publish for as long as the reader holds it*/
+                result = get_current(table);
+                (void)interlocked_increment(&result->ref_count);
+
+                /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_037: [ h_fabric_endpoint_table_acquire_snapshot shall decrement the number of pins and, if it reaches 0 after the pin generation was switched, wake the publishing thread. ]*/
+                unpin(table, slot, generation);
+            }
+        } while (result == NULL);
+
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_038: [ h_fabric_endpoint_table_acquire_snapshot shall return the snapshot. ]*/
+    }
+    return result;
+}
+
+void h_fabric_endpoint_table_release_snapshot(H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot)
+{
+    if (snapshot == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_039: [ If snapshot is NULL then h_fabric_endpoint_table_release_snapshot shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot=%p", snapshot);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_040: [ h_fabric_endpoint_table_release_snapshot shall decrement the reference count of snapshot and, when it reaches 0, release the partitions of the snapshot and free it. ]*/
+        snapshot_dec_ref(snapshot);
+    }
+}
+
+uint64_t h_fabric_endpoint_table_snapshot_get_version(H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot)
+{
+    uint64_t result;
+    if (snapshot == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_041: [ If snapshot is NULL then h_fabric_endpoint_table_snapshot_get_version shall return 0. ]*/
+        LogError("Invalid arguments: H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot=%p", snapshot);
+        result = 0;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_042: [ h_fabric_endpoint_table_snapshot_get_version shall return the version of snapshot. ]*/
+        result = snapshot->version;
+    }
+    return result;
+}
+
+const FABRIC_RESOLVED_SERVICE_PARTITION* h_fabric_endpoint_table_snapshot_find(H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot, FABRIC_URI name, FABRIC_PARTITION_KEY_TYPE partitionKeyType, const void* partitionKey)
+{
+    const FABRIC_RESOLVED_SERVICE_PARTITION* result;
+    if (
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_043: [ If snapshot is NULL then h_fabric_endpoint_table_snapshot_find shall fail and return NULL. ]*/
+        (snapshot == NULL) ||
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_044: [ If name is NULL then h_fabric_endpoint_table_snapshot_find shall fail and return NULL. ]*/
+        (name == NULL) ||
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_045: [ If partitionKeyType is not FABRIC_PARTITION_KEY_TYPE_NONE, FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, or partitionKey is NULL for FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, then h_fabric_endpoint_table_snapshot_find shall fail and return NULL. ]*/
+        ((partitionKeyType != FABRIC_PARTITION_KEY_TYPE_NONE) && (partitionKeyType != FABRIC_PARTITION_KEY_TYPE_INT64) && (partitionKeyType != FABRIC_PARTITION_KEY_TYPE_STRING)) ||
+        ((partitionKeyType != FABRIC_PARTITION_KEY_TYPE_NONE) && (partitionKey == NULL))
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot=%p, FABRIC_URI name=%ls, FABRIC_PARTITION_KEY_TYPE partitionKeyType=%d, const void* partitionKey=%p",
+            snapshot, MU_WP_OR_NULL(name), (int)partitionKeyType, partitionKey);
+        result = NULL;
+    }
+    else
+    {
+        result = NULL;
+
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_046: [ h_fabric_endpoint_table_snapshot_find shall binary search the first partition of the service name in snapshot. ]*/
+        for (uint32_t i = lower_bound(snapshot, name, NULL); (i < snapshot->partition_count) && (compare_partition(snapshot->partitions[i], name, NULL) == 0); i++)
+        {
+            const FABRIC_RESOLVED_SERVICE_PARTITION* partition = &snapshot->partitions[i]->partition;
+            /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_047: [ h_fabric_endpoint_table_snapshot_find shall return the partition of the service that is a singleton partition for FABRIC_PARTITION_KEY_TYPE_NONE, the int64 range partition whose range contains *partitionKey for FABRIC_PARTITION_KEY_TYPE_INT64 or the named partition whose name is partitionKey for FABRIC_PARTITION_KEY_TYPE_STRING. ]*/
+            if (
+                ((partitionKeyType == FABRIC_PARTITION_KEY_TYPE_NONE) && (partition->Info.Kind == FABRIC_SERVICE_PARTITION_KIND_SINGLETON)) ||
+                ((partitionKeyType == FABRIC_PARTITION_KEY_TYPE_INT64) && (partition->Info.Kind == FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE) &&
+                    (snapshot->partitions[i]->info.int64_range.LowKey <= *(const LONGLONG*)partitionKey) && (*(const LONGLONG*)partitionKey <= snapshot->partitions[i]->info.int64_range.HighKey)) ||
+                ((partitionKeyType == FABRIC_PARTITION_KEY_TYPE_STRING) && (partition->Info.Kind == FABRIC_SERVICE_PARTITION_KIND_NAMED) &&
+                    (wcscmp(snapshot->partitions[i]->info.named.Name, partitionKey) == 0))
+                )
+            {
+                result = partition;
+                break;
+            }
+        }
+
+        /*Codes_SRS_H_FABRIC_ENDPOINT_TABLE_01_048: [ If there is no such partition then h_fabric_endpoint_table_snapshot_find shall return NULL. ]*/
+    }
+    return result;
+}
@@ -0,0 +1,520 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+#include "c_pal/timer.h"
+
+#include "sf_c_util/timer_wheel.h"
+
+#include "servicefabricdox_cancellation.h"
+
+#include "h_fabric_hedge.h"
+
+/*the first attempt, which runs on the calling thread, and the one started on the threadpool by the timer when the first did not complete in time*/
+#define HEDGE_MAX_ATTEMPTS 2
+
+#define HEDGE_NO_WINNER -1
+
+typedef struct H_FABRIC_HEDGE_CALL_TAG H_FABRIC_HEDGE_CALL;
+
+typedef struct HEDGE_ATTEMPT_TAG
+{
+    H_FABRIC_HEDGE_CALL* call;
+    int32_t index;
+    void* args; /*the copy of the arguments of this attempt*/
+    SERVICEFABRIC_DOX_CANCELLATION cancellation; /*current on the thread of the attempt*/
+    double start_ms;
+    HRESULT hr; /*written before completed is incremented*/
+    void* result; /*written before completed is incremented, only the winner keeps it*/
+} HEDGE_ATTEMPT;
+
+/*the calling thread holds a reference on the call, and so does the second attempt once it is started: the attempt that lost can outlive h_fabric_hedge_execute*/
+struct H_FABRIC_HEDGE_CALL_TAG
+{
+    H_FABRIC_HEDGE_LATENCY* latency;
+    H_FABRIC_HEDGE_ATTEMPT attempt_function;
+    H_FABRIC_HEDGE_ON_DONE on_done;
+    void* on_done_context;
+    THANDLE(THREADPOOL) threadpool; /*runs the second attempt*/
+    volatile_atomic int32_t refs;
+    void* volatile_atomic shared; /*the slot that the attempts share*/
+    volatile_atomic int32_t winner; /*index of the first attempt that succeeded, HEDGE_NO_WINNER until then*/
+    volatile_atomic int32_t completed; /*number of attempts that completed*/
+    volatile_atomic int32_t started; /*number of attempts started, written by the timer before is_timer_done*/
+    volatile_atomic int32_t is_timer_done; /*1 once the timer can no longer start the second attempt*/
+    TIMER_WHEEL_TIMER timer; /*starts the second attempt when the first one is slow*/
+    HEDGE_ATTEMPT attempts[HEDGE_MAX_ATTEMPTS];
+    uint64_t args[]; /*HEDGE_MAX_ATTEMPTS copies of the arguments, uint64_t keeps them aligned*/
+};
+
+/*latencies below 4 ms have a bucket each, above that every power of 2 is split in 4 buckets*/
+static uint32_t get_bucket(uint32_t latency_ms)
+{
+    uint32_t result;
+    if (latency_ms < 4)
+    {
+        result = latency_ms;
+    }
+    else
+    {
+        uint32_t exponent = 2;
+        while ((latency_ms >> (exponent + 1)) != 0)
+        {
+            exponent++;
+        }
+        result = (exponent - 1) * 4 + ((latency_ms >> (exponent - 2)) & 3);
+    }
+    return result;
+}
+
+/*the first latency that does not fit in the bucket*/
+static uint32_t get_bucket_upper_bound(uint32_t bucket)
+{
+    uint32_t result;
+    if (bucket < 4)
+    {
+        result = bucket + 1;
+    }
+    else
+    {
+        uint32_t exponent = bucket / 4 + 1;
+        uint64_t upper_bound = (uint64_t)(4 + bucket % 4 + 1) << (exponent - 2);
+        result = (upper_bound > UINT32_MAX) ? UINT32_MAX : (uint32_t)upper_bound;
+    }
+    return result;
+}
+
+static void record_latency_since(H_FABRIC_HEDGE_LATENCY* latency, double start_ms)
+{
+    double elapsed = timer_global_get_elapsed_ms() - start_ms;
+    h_fabric_hedge_latency_record(latency, (elapsed <= 0) ? 0 : (elapsed >= UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed);
+}
+
+static void release_result(void* result)
+{
+    IUnknown* unknown = result;
+    if (unknown != NULL)
+    {
+        (void)unknown->lpVtbl->Release(unknown);
+    }
+}
+
+static void run_attempt(HEDGE_ATTEMPT* attempt)
+{
+    H_FABRIC_HEDGE_CALL* call = attempt->call;
+
+    attempt->result = NULL;
+    attempt->hr = call->attempt_function(attempt->args, &call->shared, &attempt->result);
+    if (SUCCEEDED(attempt->hr))
+    {
+        /*Codes_SRS_H_FABRIC_HEDGE_01_022: [ An attempt that succeeds shall record its latency by calling timer_global_get_elapsed_ms and h_fabric_hedge_latency_record. ]*/
+        record_latency_since(call->latency, attempt->start_ms);
+
+        /*Codes_SRS_H_FABRIC_HEDGE_01_023: [ The first attempt that succeeds is the winner, an attempt that succeeds after the winner shall release its result. ]*/
+        if (interlocked_compare_exchange(&call->winner, attempt->index, HEDGE_NO_WINNER) != HEDGE_NO_WINNER)
+        {
+            release_result(attempt->result);
+            attempt->result = NULL;
+        }
+        else
+        {
+            for (int32_t i = 0; i < HEDGE_MAX_ATTEMPTS; i++)
+            {
+                if (i != attempt->index)
+                {
+                    /*Codes_SRS_H_FABRIC_HEDGE_01_028: [ The winner shall cancel the other attempt by calling servicefabric_dox_cancellation_cancel. ]*/
+                    /*an attempt that did not start yet is cancelled as well, it stops at its first Service Fabric operation. Once this returns the other attempt begins no Service Fabric operation, so it does not read the memory that args points to any more*/
+                    servicefabric_dox_cancellation_cancel(&call->attempts[i].cancellation);
+                }
+            }
+        }
+    }
+
+    (void)interlocked_increment(&call->completed);
+    wake_by_address_single(&call->completed);
+}
+
+static void call_release(H_FABRIC_HEDGE_CALL* call)
+{
+    if (interlocked_decrement(&call->refs) == 0)
+    {
+        H_FABRIC_HEDGE_ON_DONE on_done = call->on_done;
+        void* on_done_context = call->on_done_context;
+
+        /*Codes_SRS_H_FABRIC_HEDGE_01_032: [ The one that gives back the last reference on the call shall release its reference on threadpool, free the call and call on_done with on_done_context, when on_done is not NULL. ]*/
+        THANDLE_ASSIGN(THREADPOOL)(&call->threadpool, NULL);
+        free(call);
+        if (on_done != NULL)
+        {
+            on_done(on_done_context);
+        }
+    }
+}
+
+static void hedge_attempt_work(void* context)
+{
+    HEDGE_ATTEMPT* attempt = context;
+    H_FABRIC_HEDGE_CALL* call = attempt->call;
+
+    /*the Service Fabric operations of this thread can now be cancelled by the first attempt*/
+    servicefabric_dox_cancellation_set_current(&attempt->cancellation);
+    run_attempt(attempt);
+    servicefabric_dox_cancellation_set_current(NULL);
+
+    /*Codes_SRS_H_FABRIC_HEDGE_01_038: [ The second attempt shall give back its reference on the call once it completed. ]*/
+    call_release(call);
+}
+
+/*runs on the thread of the timer wheel, so it only schedules the second attempt*/
+static void on_hedge_timer(void* context, bool is_cancelled)
+{
+    H_FABRIC_HEDGE_CALL* call = context;
+
+    if (is_cancelled)
+    {
+        /*Codes_SRS_H_FABRIC_HEDGE_01_036: [ If the timer wheel is destroyed before the timer fired then h_fabric_hedge_execute shall wait for the first attempt only. ]*/
+        LogError("the timer wheel was destroyed, cannot hedge the call");
+    }
+    else if (
+        (interlocked_add(&call->completed, 0) == 0) &&
+        (interlocked_add(&call->winner, 0) == HEDGE_NO_WINNER)
+        )
+    {
+        /*Codes_SRS_H_FABRIC_HEDGE_01_025: [ When the timer fires before the first attempt completed, h_fabric_hedge_execute shall take a reference on the call and start a second attempt with its own copy of args on threadpool by calling threadpool_schedule_work. The work item makes the SERVICEFABRIC_DOX_CANCELLATION of the attempt current by calling servicefabric_dox_cancellation_set_current. ]*/
+        HEDGE_ATTEMPT* attempt = &call->attempts[1];
+        attempt->start_ms = timer_global_get_elapsed_ms();
+
+        /*the calling thread holds its reference until is_timer_done, so this is never the first one*/
+        (void)interlocked_increment(&call->refs);
+        (void)interlocked_increment(&call->started);
+        if (threadpool_schedule_work(call->threadpool, hedge_attempt_work, attempt) != 0)
+        {
+            /*Codes_SRS_H_FABRIC_HEDGE_01_026: [ If starting the second attempt fails then h_fabric_hedge_execute shall wait for the first attempt only. ]*/
+            LogError("failure in threadpool_schedule_work(call->threadpool=%p, hedge_attempt_work=%p, attempt=%p), cannot hedge the call",
+                call->threadpool, hedge_attempt_work, attempt);
+            (void)interlocked_decrement(&call->started);
+            (void)interlocked_decrement(&call->refs);
+        }
+    }
+
+    /*the calling thread might free the call right after this*/
+    (void)interlocked_exchange(&call->is_timer_done, 1);
+    wake_by_address_single(&call->is_timer_done);
+}
+
+/*runs the attempt on the calling thread, without hedging*/
+static HRESULT execute_without_hedging(H_FABRIC_HEDGE_LATENCY* latency, H_FABRIC_HEDGE_ATTEMPT attempt, void* args, void** result)
+{
+    void* volatile_atomic shared = NULL;
+    double start_ms = timer_global_get_elapsed_ms();
+    HRESULT hr = attempt(args, &shared, result);
+    if (SUCCEEDED(hr))
+    {
+        record_latency_since(latency, start_ms);
+    }
+    return hr;
+}
+
+/*after timer_wheel_cancel returned false the callback of the timer runs or is about to run, it uses the call until it sets is_timer_done*/
+static void wait_for_timer_done(H_FABRIC_HEDGE_CALL* call)
+{
+    while (interlocked_add(&call->is_timer_done, 0) == 0)
+    {
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&call->is_timer_done, 1, UINT32_MAX);
+        if (wait_result != INTERLOCKED_HL_OK)
+        {
+            LogError("failure in InterlockedHL_WaitForValue(&call->is_timer_done=%p, 1, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d",
+                &call->is_timer_done, (int)wait_result);
+            /*look again*/
+        }
+    }
+}
+
+static void wait_for_winner_or_all_completed(H_FABRIC_HEDGE_CALL* call)
+{
+    while (true)
+    {
+        int32_t completed = interlocked_add(&call->completed, 0);
+        if (
+            (interlocked_add(&call->winner, 0) != HEDGE_NO_WINNER) ||
+            (completed == interlocked_add(&call->started, 0))
+            )
+        {
+            break;
+        }
+
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForNotValue(&call->completed, completed, UINT32_MAX);
+        if (wait_result != INTERLOCKED_HL_OK)
+        {
+            LogError("failure in InterlockedHL_WaitForNotValue(&call->completed=%p, completed=%" PRId32 ", UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d",
+                &call->completed, completed, (int)wait_result);
+            /*look again*/
+        }
+    }
+}
+
+void h_fabric_hedge_latency_record(H_FABRIC_HEDGE_LATENCY* latency, uint32_t latency_ms)
+{
+    if (latency == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_HEDGE_01_001: [ If latency is NULL then h_fabric_hedge_latency_record shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_HEDGE_LATENCY* latency=%p, uint32_t latency_ms=%" PRIu32 "", latency, latency_ms);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_HEDGE_01_002: [ h_fabric_hedge_latency_record shall increment the count of the bucket of latency_ms. Latencies below 4 ms have a bucket each, above that every power of 2 is split in 4 buckets. ]*/
+        (void)interlocked_increment(&latency->buckets[get_bucket(latency_ms)]);
+
+        /*Codes_SRS_H_FABRIC_HEDGE_01_003: [ h_fabric_hedge_latency_record shall increment the number of samples of latency. ]*/
+        if (
+            (interlocked_increment(&latency->samples) >= H_FABRIC_HEDGE_LATENCY_DECAY_SAMPLES) &&
+            (interlocked_compare_exchange(&latency->is_decaying, 1, 0) == 0)
+            )
+        {
+            /*Codes_SRS_H_FABRIC_HEDGE_01_004: [ If the number of samples reached H_FABRIC_HEDGE_LATENCY_DECAY_SAMPLES and no other thread decays latency then h_fabric_hedge_latency_record shall halve the count of every bucket and subtract the counts removed from the number of samples. ]*/
+            int32_t removed = 0;
+            for (uint32_t i = 0; i < H_FABRIC_HEDGE_LATENCY_BUCKETS; i++)
+            {
+                int32_t half = interlocked_add(&latency->buckets[i], 0) / 2;
+                (void)interlocked_add(&latency->buckets[i], -half);
+                removed += half;
+            }
+            (void)interlocked_add(&latency->samples, -removed);
+            (void)interlocked_exchange(&latency->is_decaying, 0);
+        }
+    }
+}
+
+bool h_fabric_hedge_get_delay(const H_FABRIC_HEDGE_CONFIG* config, H_FABRIC_HEDGE_LATENCY* latency, uint32_t* delay_ms)
+{
+    bool result;
+    if (
+        /*Codes_SRS_H_FABRIC_HEDGE_01_005: [ If config is NULL then h_fabric_hedge_get_delay shall fail and return false. ]*/
+        (config == NULL) ||
+        /*Codes_SRS_H_FABRIC_HEDGE_01_006: [ If latency is NULL then h_fabric_hedge_get_delay shall fail and return false. ]*/
+        (latency == NULL) ||
+        /*Codes_SRS_H_FABRIC_HEDGE_01_007: [ If delay_ms is NULL then h_fabric_hedge_get_delay shall fail and return false. ]*/
+        (delay_ms == NULL)
+        )
+    {
+        LogError("Invalid arguments: const H_FABRIC_HEDGE_CONFIG* config=%p, H_FABRIC_HEDGE_LATENCY* latency=%p, uint32_t* delay_ms=%p", config, latency, delay_ms);
+        result = false;
+    }
+    else if (config->percentile == 0)
+    {
+        /*Codes_SRS_H_FABRIC_HEDGE_01_008: [ If percentile of config is 0 then h_fabric_hedge_get_delay shall return false. ]*/
+        result = false;
+    }
+    else
+    {
+        int32_t counts[H_FABRIC_HEDGE_LATENCY_BUCKETS];
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < H_FABRIC_HEDGE_LATENCY_BUCKETS; i++)
+        {
+            counts[i] = interlocked_add(&latency->buckets[i], 0);
+            total += (uint64_t)counts[i];
+        }
+
+        if (total < config->minimum_samples)
+        {
+            /*Codes_SRS_H_FABRIC_HEDGE_01_009: [ If the buckets of latency count fewer than minimum_samples latencies then h_fabric_hedge_get_delay shall return false. ]*/
+            result = false;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_HEDGE_01_010: [ h_fabric_hedge_get_delay shall set delay_ms to the upper bound of the bucket where percentile of the counted latencies falls, but not lower than minimum_delay_ms, and return true. ]*/
+            uint64_t target = (total * config->percentile + 99) / 100;
+            uint64_t seen = 0;
+            uint32_t bucket = 0;
+            for (; bucket < H_FABRIC_HEDGE_LATENCY_BUCKETS - 1; bucket++)
+            {
+                seen += (uint64_t)counts[bucket];
+                if (seen >= target)
+                {
+                    break;
+                }
+            }
+
+            uint32_t upper_bound = get_bucket_upper_bound(bucket);
+            *delay_ms = (upper_bound < config->minimum_delay_ms) ? config->minimum_delay_ms : upper_bound;
+            result = true;
+        }
+    }
+    return result;
+}
+
+HRESULT h_fabric_hedge_execute(const H_FABRIC_HEDGE_CONFIG* config, H_FABRIC_HEDGE_LATENCY* latency, TIMER_WHEEL_HANDLE timer_wheel, THANDLE(THREADPOOL) threadpool, H_FABRIC_HEDGE_ATTEMPT attempt, void* args, size_t args_size, H_FABRIC_HEDGE_ON_DONE on_done, void* on_done_context, void** result)
+{
+    HRESULT hr;
+    if (
+        /*Codes_SRS_H_FABRIC_HEDGE_01_011: [ If config is NULL then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+        (config == NULL) ||
+        /*Codes_SRS_H_FABRIC_HEDGE_01_012: [ If latency is NULL then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+        (latency == NULL) ||
+        /*Codes_SRS_H_FABRIC_HEDGE_01_013: [ If attempt is NULL then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+        (attempt == NULL) ||
+        /*Codes_SRS_H_FABRIC_HEDGE_01_014: [ If args is NULL or args_size is 0 then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+        (args == NULL) ||
+        (args_size == 0) ||
+        /*Codes_SRS_H_FABRIC_HEDGE_01_015: [ If result is NULL then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+        (result == NULL)
+        )
+    {
+        LogError("Invalid arguments: const H_FABRIC_HEDGE_CONFIG* config=%p, H_FABRIC_HEDGE_LATENCY* latency=%p, TIMER_WHEEL_HANDLE timer_wheel=%p, THANDLE(THREADPOOL) threadpool=%p, H_FABRIC_HEDGE_ATTEMPT attempt=%p, void* args=%p, size_t args_size=%zu, H_FABRIC_HEDGE_ON_DONE on_done=%p, void* on_done_context=%p, void** result=%p",
+            config, latency, timer_wheel, threadpool, attempt, args, args_size, on_done, on_done_context, result);
+        hr = E_INVALIDARG;
+    }
+    else if (config->percentile == 0)
+    {
+        /*Codes_SRS_H_FABRIC_HEDGE_01_016: [ If percentile of config is 0 then h_fabric_hedge_execute shall call attempt with args and result on the calling thread and return what attempt returns. ]*/
+        void* volatile_atomic shared = NULL;
+        hr = attempt(args, &shared, result);
+        /*Codes_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+        if (on_done != NULL)
+        {
+            on_done(on_done_context);
+        }
+    }
+    else if (
+        (timer_wheel == NULL) ||
+        (threadpool == NULL)
+        )
+    {
+        /*Codes_SRS_H_FABRIC_HEDGE_01_033: [ If timer_wheel or threadpool is NULL then h_fabric_hedge_execute shall call attempt with args and result on the calling thread, record its latency if it succeeded and return what attempt returns. ]*/
+        hr = execute_without_hedging(latency, attempt, args, result);
+        /*Codes_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+        if (on_done != NULL)
+        {
+            on_done(on_done_context);
+        }
+    }
+    else
+    {
+        uint32_t delay_ms;
+        H_FABRIC_HEDGE_CALL* call;
+        size_t args_words = (args_size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+        if (!h_fabric_hedge_get_delay(config, latency, &delay_ms))
+        {
+            /*Codes_SRS_H_FABRIC_HEDGE_01_017: [ If h_fabric_hedge_get_delay returns false then h_fabric_hedge_execute shall call attempt with args and result on the calling thread, record its latency if it succeeded and return what attempt returns. ]*/
+            hr = execute_without_hedging(latency, attempt, args, result);
+            /*Codes_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+            if (on_done != NULL)
+            {
+                on_done(on_done_context);
+            }
+        }
+        /*Codes_SRS_H_FABRIC_HEDGE_01_018: [ h_fabric_hedge_execute shall allocate a call holding HEDGE_MAX_ATTEMPTS copies of args and a reference on threadpool, with a reference for the calling thread. ]*/
+        else if ((call = malloc_flex(sizeof(H_FABRIC_HEDGE_CALL), HEDGE_MAX_ATTEMPTS * args_words, sizeof(uint64_t))) == NULL)
+        {
+            /*Codes_SRS_H_FABRIC_HEDGE_01_019: [ If allocating the call fails then h_fabric_hedge_execute shall call attempt with args and result on the calling thread, record its latency if it succeeded and return what attempt returns. ]*/
+            LogError("failure in malloc_flex(sizeof(H_FABRIC_HEDGE_CALL)=%zu, HEDGE_MAX_ATTEMPTS * args_words=%zu, sizeof(uint64_t)=%zu)",
+                sizeof(H_FABRIC_HEDGE_CALL), HEDGE_MAX_ATTEMPTS * args_words, sizeof(uint64_t));
+            hr = execute_without_hedging(latency, attempt, args, result);
+            /*Codes_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+            if (on_done != NULL)
+            {
+                on_done(on_done_context);
+            }
+        }
+        else
+        {
+            bool is_timer_scheduled;
+
+            call->latency = latency;
+            call->attempt_function = attempt;
+            call->on_done = on_done;
+            call->on_done_context = on_done_context;
+            THANDLE_INITIALIZE(THREADPOOL)(&call->threadpool, threadpool);
+            (void)interlocked_exchange(&call->refs, 1);
+            (void)interlocked_exchange_pointer(&call->shared, NULL);
+            (void)interlocked_exchange(&call->winner, HEDGE_NO_WINNER);
+            (void)interlocked_exchange(&call->completed, 0);
+            (void)interlocked_exchange(&call->started, 1);
+            (void)interlocked_exchange(&call->is_timer_done, 0);
+            for (int32_t i = 0; i < HEDGE_MAX_ATTEMPTS; i++)
+            {
+                HEDGE_ATTEMPT* hedge_attempt = &call->attempts[i];
+                hedge_attempt->call = call;
+                hedge_attempt->index = i;
+                hedge_attempt->args = &call->args[i * args_words];
+                (void)memcpy(hedge_attempt->args, args, args_size);
+                /*both cancellations exist before any attempt runs, so the winner can always cancel the other one*/
+                servicefabric_dox_cancellation_init(&hedge_attempt->cancellation);
+                hedge_attempt->hr = E_FAIL;
+                hedge_attempt->result = NULL;
+            }
+
+            /*Codes_SRS_H_FABRIC_HEDGE_01_020: [ h_fabric_hedge_execute shall arm a timer that starts the second attempt after delay_ms by calling timer_wheel_timer_init and timer_wheel_schedule. ]*/
+            timer_wheel_timer_init(&call->timer);
+            call->attempts[0].start_ms = timer_global_get_elapsed_ms();
+            if (timer_wheel_schedule(timer_wheel, &call->timer, delay_ms, on_hedge_timer, call) != 0)
+            {
+                /*Codes_SRS_H_FABRIC_HEDGE_01_021: [ If arming the timer fails then h_fabric_hedge_execute shall run the first attempt only. ]*/
+                LogError("failure in timer_wheel_schedule(timer_wheel=%p, &call->timer=%p, delay_ms=%" PRIu32 ", on_hedge_timer=%p, call=%p), cannot hedge the call",
+                    timer_wheel, &call->timer, delay_ms, on_hedge_timer, call);
+                is_timer_scheduled = false;
+            }
+            else
+            {
+                is_timer_scheduled = true;
+            }
+
+            /*Codes_SRS_H_FABRIC_HEDGE_01_024: [ h_fabric_hedge_execute shall run the first attempt on the calling thread, with the SERVICEFABRIC_DOX_CANCELLATION of the attempt made current by calling servicefabric_dox_cancellation_set_current. ]*/
+            servicefabric_dox_cancellation_set_current(&call->attempts[0].cancellation);
+            run_attempt(&call->attempts[0]);
+            servicefabric_dox_cancellation_set_current(NULL);
+
+            if (is_timer_scheduled)
+            {
+                /*Codes_SRS_H_FABRIC_HEDGE_01_034: [ Once the first attempt completed h_fabric_hedge_execute shall cancel the timer by calling timer_wheel_cancel. ]*/
+                if (!timer_wheel_cancel(timer_wheel, &call->timer))
+                {
+                    /*Codes_SRS_H_FABRIC_HEDGE_01_035: [ If timer_wheel_cancel returns false then h_fabric_hedge_execute shall wait for the callback of the timer to finish by calling InterlockedHL_WaitForValue. ]*/
+                    wait_for_timer_done(call);
+                }
+            }
+
+            /*Codes_SRS_H_FABRIC_HEDGE_01_027: [ h_fabric_hedge_execute shall wait until an attempt succeeded or all the started attempts completed. ]*/
+            /*the attempt that lost is not waited for: the first attempt already cancelled it, so it does not read the memory of the caller any more and it completes on its own*/
+            wait_for_winner_or_all_completed(call);
+
+            int32_t winner = interlocked_add(&call->winner, 0);
+            if (winner != HEDGE_NO_WINNER)
+            {
+                /*Codes_SRS_H_FABRIC_HEDGE_01_030: [ If an attempt succeeded then h_fabric_hedge_execute shall return its result in result and its HRESULT. ]*/
+                *result = call->attempts[winner].result;
+                hr = call->attempts[winner].hr;
+            }
+            else
+            {
+                /*Codes_SRS_H_FABRIC_HEDGE_01_031: [ If no attempt succeeded then h_fabric_hedge_execute shall return the HRESULT of the first attempt. ]*/
+                hr = call->attempts[0].hr;
+            }
+
+            /*Codes_SRS_H_FABRIC_HEDGE_01_029: [ h_fabric_hedge_execute shall give back the reference of the calling thread on the call without waiting for the attempt that lost. ]*/
+            call_release(call);
+        }
+    }
+    return hr;
+}
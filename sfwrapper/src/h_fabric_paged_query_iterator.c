@@ -0,0 +1,521 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+
+#include "sf_c_util/hresult_to_string.h"
+
+#include "hfabricqueryclient10.h"
+#include "servicefabricdox_cancellation.h"
+
+#include "h_fabric_paged_query_iterator.h"
+
+MU_DEFINE_ENUM_STRINGS(H_FABRIC_PAGED_QUERY_KIND, H_FABRIC_PAGED_QUERY_KIND_VALUES)
+
+typedef struct H_FABRIC_PAGED_QUERY_ITERATOR_TAG H_FABRIC_PAGED_QUERY_ITERATOR;
+
+/*what differs between the paged queries*/
+typedef struct PAGED_QUERY_TAG
+{
+    /*copies the query description of the caller in the iterator, making room for the continuation token*/
+    void (*init_description)(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, const void* query_description);
+    void (*set_continuation_token)(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, LPCWSTR continuation_token);
+    HRESULT (*get_page)(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, IUnknown** page);
+    void (*get_items)(IUnknown* page, ULONG* count, const void** items);
+    const FABRIC_PAGING_STATUS* (*get_paging_status)(IUnknown* page);
+    size_t item_size;
+} PAGED_QUERY;
+
+struct H_FABRIC_PAGED_QUERY_ITERATOR_TAG
+{
+    H_FABRIC_HANDLE(IFabricQueryClient10) client;
+    const PAGED_QUERY* query;
+    DWORD timeoutMilliseconds;
+
+    /*private copy of the query description of the caller, only the continuation token is ever changed. The strings still belong to the caller.*/
+    union
+    {
+        struct
+        {
+            PAGED_FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION description;
+        } application_type;
+        struct
+        {
+            FABRIC_PAGED_DEPLOYED_APPLICATION_QUERY_DESCRIPTION description;
+            FABRIC_QUERY_PAGING_DESCRIPTION paging;
+        } deployed_application;
+        struct
+        {
+            FABRIC_NODE_QUERY_DESCRIPTION description;
+            FABRIC_NODE_QUERY_DESCRIPTION_EX1 ex1;
+        } node;
+        struct
+        {
+            FABRIC_SERVICE_QUERY_DESCRIPTION description;
+            FABRIC_SERVICE_QUERY_DESCRIPTION_EX1 ex1;
+        } service;
+        struct
+        {
+            FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION description;
+            FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION_EX1 ex1;
+        } partition;
+        struct
+        {
+            FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION description;
+            FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION_EX1 ex1;
+            FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION_EX2 ex2;
+        } replica;
+    } description;
+
+    /*the page items are handed out from. The continuation token of the page being prefetched points inside it, so it is released only after the prefetch finished*/
+    IUnknown* page;
+    const unsigned char* items;
+    ULONG item_count;
+    ULONG item_index;
+
+    /*S_OK while there are more pages, S_FALSE once the last page was received, the error of the query once a page failed*/
+    HRESULT result;
+
+    /*the next page is fetched by a work item on the threadpool, with the cancellation current so that destroy does not wait for a page nobody needs*/
+    THANDLE(THREADPOOL) threadpool;
+    SERVICEFABRIC_DOX_CANCELLATION cancellation;
+    bool is_prefetching; /*a prefetch was scheduled and its page was not taken yet, only used by the calling thread*/
+    volatile_atomic int32_t is_prefetch_done; /*woken when it becomes 1*/
+    /*written by the work item before is_prefetch_done becomes 1, read only after it did*/
+    IUnknown* prefetched_page;
+    HRESULT prefetch_result;
+};
+
+/*defines the functions that only differ by types and names between the paged queries*/
+#define DEFINE_PAGED_QUERY_FUNCTIONS(name, result_interface, list_type, h_fabric_method, get_list)                                                         \
+static HRESULT MU_C2(name, _get_page)(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, IUnknown** page)                                                           \
+{                                                                                                                                                         \
+    return H_FABRIC_API(h_fabric_method)(iterator->client, &iterator->description.name.description, iterator->timeoutMilliseconds, (result_interface**)page); \
+}                                                                                                                                                         \
+                                                                                                                                                          \
+static void MU_C2(name, _get_items)(IUnknown* page, ULONG* count, const void** items)                                                                    \
+{                                                                                                                                                         \
+    const list_type* list = ((result_interface*)page)->lpVtbl->get_list((result_interface*)page);                                                         \
+    if (list == NULL)                                                                                                                                     \
+    {                                                                                                                                                     \
+        *count = 0;                                                                                                                                       \
+        *items = NULL;                                                                                                                                    \
+    }                                                                                                                                                     \
+    else                                                                                                                                                  \
+    {                                                                                                                                                     \
+        *count = list->Count;                                                                                                                             \
+        *items = list->Items;                                                                                                                             \
+    }                                                                                                                                                     \
+}                                                                                                                                                         \
+                                                                                                                                                          \
+static const FABRIC_PAGING_STATUS* MU_C2(name, _get_paging_status)(IUnknown* page)                                                                       \
+{                                                                                                                                                         \
+    return ((result_interface*)page)->lpVtbl->get_PagingStatus((result_interface*)page);                                                                  \
+}
+
+DEFINE_PAGED_QUERY_FUNCTIONS(application_type, IFabricGetApplicationTypePagedListResult, FABRIC_APPLICATION_TYPE_QUERY_RESULT_LIST, FQC10_GetApplicationTypePagedList, get_ApplicationTypePagedList)
+DEFINE_PAGED_QUERY_FUNCTIONS(deployed_application, IFabricGetDeployedApplicationPagedListResult, FABRIC_DEPLOYED_APPLICATION_QUERY_RESULT_LIST, FQC10_GetDeployedApplicationPagedList, get_DeployedApplicationPagedList)
+DEFINE_PAGED_QUERY_FUNCTIONS(node, IFabricGetNodeListResult2, FABRIC_NODE_QUERY_RESULT_LIST, FQC10_GetNodeList2, get_NodeList)
+DEFINE_PAGED_QUERY_FUNCTIONS(service, IFabricGetServiceListResult2, FABRIC_SERVICE_QUERY_RESULT_LIST, FQC10_GetServiceList2, get_ServiceList)
+DEFINE_PAGED_QUERY_FUNCTIONS(partition, IFabricGetPartitionListResult2, FABRIC_SERVICE_PARTITION_QUERY_RESULT_LIST, FQC10_GetPartitionList2, get_PartitionList)
+DEFINE_PAGED_QUERY_FUNCTIONS(replica, IFabricGetReplicaListResult2, FABRIC_SERVICE_REPLICA_QUERY_RESULT_LIST, FQC10_GetReplicaList2, get_ReplicaList)
+
+/*the continuation token lives in a different place for every query description*/
+
+static void application_type_init_description(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, const void* query_description)
+{
+    iterator->description.application_type.description = *(const PAGED_FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION*)query_description;
+}
+
+static void application_type_set_continuation_token(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, LPCWSTR continuation_token)
+{
+    iterator->description.application_type.description.ContinuationToken = continuation_token;
+}
+
+static void deployed_application_init_description(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, const void* query_description)
+{
+    const FABRIC_PAGED_DEPLOYED_APPLICATION_QUERY_DESCRIPTION* description = query_description;
+    iterator->description.deployed_application.description = *description;
+    if (description->PagingDescription == NULL)
+    {
+        (void)memset(&iterator->description.deployed_application.paging, 0, sizeof(iterator->description.deployed_application.paging));
+    }
+    else
+    {
+        iterator->description.deployed_application.paging = *description->PagingDescription;
+    }
+    iterator->description.deployed_application.description.PagingDescription = &iterator->description.deployed_application.paging;
+}
+
+static void deployed_application_set_continuation_token(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, LPCWSTR continuation_token)
+{
+    iterator->description.deployed_application.paging.ContinuationToken = continuation_token;
+}
+
+static void node_init_description(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, const void* query_description)
+{
+    const FABRIC_NODE_QUERY_DESCRIPTION* description = query_description;
+    iterator->description.node.description = *description;
+    if (description->Reserved == NULL)
+    {
+        (void)memset(&iterator->description.node.ex1, 0, sizeof(iterator->description.node.ex1));
+    }
+    else
+    {
+        /*the extensions after EX1 (if any) are still the ones of the caller*/
+        iterator->description.node.ex1 = *(const FABRIC_NODE_QUERY_DESCRIPTION_EX1*)description->Reserved;
+    }
+    iterator->description.node.description.Reserved = &iterator->description.node.ex1;
+}
+
+static void node_set_continuation_token(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, LPCWSTR continuation_token)
+{
+    iterator->description.node.ex1.ContinuationToken = continuation_token;
+}
+
+static void service_init_description(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, const void* query_description)
+{
+    const FABRIC_SERVICE_QUERY_DESCRIPTION* description = query_description;
+    iterator->description.service.description = *description;
+    if (description->Reserved == NULL)
+    {
+        (void)memset(&iterator->description.service.ex1, 0, sizeof(iterator->description.service.ex1));
+    }
+    else
+    {
+        iterator->description.service.ex1 = *(const FABRIC_SERVICE_QUERY_DESCRIPTION_EX1*)description->Reserved;
+    }
+    iterator->description.service.description.Reserved = &iterator->description.service.ex1;
+}
+
+static void service_set_continuation_token(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, LPCWSTR continuation_token)
+{
+    iterator->description.service.ex1.ContinuationToken = continuation_token;
+}
+
+static void partition_init_description(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, const void* query_description)
+{
+    const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION* description = query_description;
+    iterator->description.partition.description = *description;
+    if (description->Reserved == NULL)
+    {
+        (void)memset(&iterator->description.partition.ex1, 0, sizeof(iterator->description.partition.ex1));
+    }
+    else
+    {
+        iterator->description.partition.ex1 = *(const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION_EX1*)description->Reserved;
+    }
+    iterator->description.partition.description.Reserved = &iterator->description.partition.ex1;
+}
+
+static void partition_set_continuation_token(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, LPCWSTR continuation_token)
+{
+    iterator->description.partition.ex1.ContinuationToken = continuation_token;
+}
+
+static void replica_init_description(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, const void* query_description)
+{
+    const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION* description = query_description;
+    iterator->description.replica.description = *description;
+    if (description->Reserved == NULL)
+    {
+        /*0 is FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DEFAULT*/
+        (void)memset(&iterator->description.replica.ex1, 0, sizeof(iterator->description.replica.ex1));
+    }
+    else
+    {
+        iterator->description.replica.ex1 = *(const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION_EX1*)description->Reserved;
+    }
+    if (iterator->description.replica.ex1.Reserved == NULL)
+    {
+        (void)memset(&iterator->description.replica.ex2, 0, sizeof(iterator->description.replica.ex2));
+    }
+    else
+    {
+        iterator->description.replica.ex2 = *(const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION_EX2*)iterator->description.replica.ex1.Reserved;
+    }
+    iterator->description.replica.ex1.Reserved = &iterator->description.replica.ex2;
+    iterator->description.replica.description.Reserved = &iterator->description.replica.ex1;
+}
+
+static void replica_set_continuation_token(H_FABRIC_PAGED_QUERY_ITERATOR* iterator, LPCWSTR continuation_token)
+{
+    iterator->description.replica.ex2.ContinuationToken = continuation_token;
+}
+
+#define PAGED_QUERY_INITIALIZER(name, item_type) \
+    { MU_C2(name, _init_description), MU_C2(name, _set_continuation_token), MU_C2(name, _get_page), MU_C2(name, _get_items), MU_C2(name, _get_paging_status), sizeof(item_type) }
+
+/*indexed by H_FABRIC_PAGED_QUERY_KIND*/
+static const PAGED_QUERY paged_queries[] =
+{
+    PAGED_QUERY_INITIALIZER(application_type, FABRIC_APPLICATION_TYPE_QUERY_RESULT_ITEM),
+    PAGED_QUERY_INITIALIZER(deployed_application, FABRIC_DEPLOYED_APPLICATION_QUERY_RESULT_ITEM),
+    PAGED_QUERY_INITIALIZER(node, FABRIC_NODE_QUERY_RESULT_ITEM),
+    PAGED_QUERY_INITIALIZER(service, FABRIC_SERVICE_QUERY_RESULT_ITEM),
+    PAGED_QUERY_INITIALIZER(partition, FABRIC_SERVICE_PARTITION_QUERY_RESULT_ITEM),
+    PAGED_QUERY_INITIALIZER(replica, FABRIC_SERVICE_REPLICA_QUERY_RESULT_ITEM)
+};
+
+static void prefetch_work(void* context)
+{
+    H_FABRIC_PAGED_QUERY_ITERATOR* iterator = context;
+
+    /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_024: [ The work item shall make the SERVICEFABRIC_DOX_CANCELLATION of the iterator current by calling servicefabric_dox_cancellation_set_current while it fetches the page. ]*/
+    servicefabric_dox_cancellation_set_current(&iterator->cancellation);
+    iterator->prefetch_result = iterator->query->get_page(iterator, &iterator->prefetched_page);
+    servicefabric_dox_cancellation_set_current(NULL);
+
+    /*the calling thread might free the iterator right after this*/
+    (void)interlocked_exchange(&iterator->is_prefetch_done, 1);
+    wake_by_address_single(&iterator->is_prefetch_done);
+}
+
+static void start_prefetch(H_FABRIC_PAGED_QUERY_ITERATOR* iterator)
+{
+    (void)interlocked_exchange(&iterator->is_prefetch_done, 0);
+
+    /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_008: [ h_fabric_paged_query_iterator_create shall start fetching the first page on threadpool by calling threadpool_schedule_work. ]*/
+    /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_022: [ If the page has a continuation token then h_fabric_paged_query_iterator_next shall start fetching the next page with the continuation token on threadpool by calling threadpool_schedule_work. ]*/
+    if (threadpool_schedule_work(iterator->threadpool, prefetch_work, iterator) != 0)
+    {
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_009: [ If threadpool_schedule_work fails then the page shall be fetched synchronously when it is needed. ]*/
+        LogError("failure in threadpool_schedule_work(iterator->threadpool=%p, prefetch_work=%p, iterator=%p), the page will be fetched synchronously",
+            iterator->threadpool, prefetch_work, iterator);
+        iterator->is_prefetching = false;
+    }
+    else
+    {
+        iterator->is_prefetching = true;
+    }
+}
+
+/*the work item writes in the iterator until it sets is_prefetch_done*/
+static void wait_for_prefetch(H_FABRIC_PAGED_QUERY_ITERATOR* iterator)
+{
+    while (interlocked_add(&iterator->is_prefetch_done, 0) == 0)
+    {
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&iterator->is_prefetch_done, 1, UINT32_MAX);
+        if (wait_result != INTERLOCKED_HL_OK)
+        {
+            LogError("failure in InterlockedHL_WaitForValue(&iterator->is_prefetch_done=%p, 1, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d",
+                &iterator->is_prefetch_done, (int)wait_result);
+            /*look again*/
+        }
+    }
+    iterator->is_prefetching = false;
+}
+
+static void move_to_next_page(H_FABRIC_PAGED_QUERY_ITERATOR* iterator)
+{
+    IUnknown* next_page;
+    HRESULT page_result;
+
+    if (iterator->is_prefetching)
+    {
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_018: [ When all the items of the current page were handed out and there are more pages, h_fabric_paged_query_iterator_next shall wait for the next page by calling InterlockedHL_WaitForValue. ]*/
+        wait_for_prefetch(iterator);
+        page_result = iterator->prefetch_result;
+        next_page = iterator->prefetched_page;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_009: [ If threadpool_schedule_work fails then the page shall be fetched synchronously when it is needed. ]*/
+        page_result = iterator->query->get_page(iterator, &next_page);
+    }
+
+    /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_019: [ h_fabric_paged_query_iterator_next shall release the current page. ]*/
+    /*only now, the continuation token used for next_page was inside it*/
+    if (iterator->page != NULL)
+    {
+        (void)iterator->page->lpVtbl->Release(iterator->page);
+        iterator->page = NULL;
+    }
+    iterator->items = NULL;
+    iterator->item_count = 0;
+    iterator->item_index = 0;
+
+    if (FAILED(page_result))
+    {
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_020: [ If fetching the next page failed then h_fabric_paged_query_iterator_next shall return the error of the query on this call and all the next calls. ]*/
+        LogHRESULTError(page_result, "failure in getting the next page of %" PRI_MU_ENUM " query", MU_ENUM_VALUE(H_FABRIC_PAGED_QUERY_KIND, (H_FABRIC_PAGED_QUERY_KIND)(iterator->query - paged_queries)));
+        iterator->result = page_result;
+    }
+    else
+    {
+        const void* items;
+        iterator->page = next_page;
+
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_021: [ h_fabric_paged_query_iterator_next shall make the next page the current page. ]*/
+        iterator->query->get_items(next_page, &iterator->item_count, &items);
+        iterator->items = items;
+
+        const FABRIC_PAGING_STATUS* paging_status = iterator->query->get_paging_status(next_page);
+        if (
+            (paging_status == NULL) ||
+            (paging_status->ContinuationToken == NULL) ||
+            (paging_status->ContinuationToken[0] == L'\0')
+            )
+        {
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_023: [ If the page has no continuation token then it is the last page. ]*/
+            iterator->result = S_FALSE;
+        }
+        else
+        {
+            iterator->query->set_continuation_token(iterator, paging_status->ContinuationToken);
+            start_prefetch(iterator);
+        }
+    }
+}
+
+H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE h_fabric_paged_query_iterator_create(H_FABRIC_HANDLE(IFabricQueryClient10) client, THANDLE(THREADPOOL) threadpool, H_FABRIC_PAGED_QUERY_KIND kind, const void* query_description, DWORD timeoutMilliseconds)
+{
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE result;
+    if (
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_001: [ If client is NULL then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+        (client == NULL) ||
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_025: [ If threadpool is NULL then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+        (threadpool == NULL) ||
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_002: [ If kind is not a valid H_FABRIC_PAGED_QUERY_KIND then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+        ((int)kind < (int)H_FABRIC_PAGED_QUERY_KIND_APPLICATION_TYPE) ||
+        ((int)kind > (int)H_FABRIC_PAGED_QUERY_KIND_REPLICA) ||
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_003: [ If query_description is NULL then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+        (query_description == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_HANDLE(IFabricQueryClient10) client=%p, THANDLE(THREADPOOL) threadpool=%p, H_FABRIC_PAGED_QUERY_KIND kind=%" PRI_MU_ENUM ", const void* query_description=%p, DWORD timeoutMilliseconds=%lu",
+            client, threadpool, MU_ENUM_VALUE(H_FABRIC_PAGED_QUERY_KIND, kind), query_description, timeoutMilliseconds);
+        result = NULL;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_004: [ h_fabric_paged_query_iterator_create shall allocate memory for the iterator. ]*/
+        result = malloc(sizeof(H_FABRIC_PAGED_QUERY_ITERATOR));
+        if (result == NULL)
+        {
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_006: [ If there are any failures then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+            LogError("failure in malloc(sizeof(H_FABRIC_PAGED_QUERY_ITERATOR)=%zu)", sizeof(H_FABRIC_PAGED_QUERY_ITERATOR));
+        }
+        else
+        {
+            result->client = client;
+            result->query = &paged_queries[kind];
+            result->timeoutMilliseconds = timeoutMilliseconds;
+
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_005: [ h_fabric_paged_query_iterator_create shall copy query_description, so that the continuation token can be changed for every page. ]*/
+            /*the continuation token of the caller (if any) is kept for the first page, so an enumeration can be resumed*/
+            result->query->init_description(result, query_description);
+
+            result->page = NULL;
+            result->items = NULL;
+            result->item_count = 0;
+            result->item_index = 0;
+            result->result = S_OK;
+            result->prefetched_page = NULL;
+            result->prefetch_result = E_FAIL;
+
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_026: [ h_fabric_paged_query_iterator_create shall keep a reference on threadpool by calling THANDLE_INITIALIZE(THREADPOOL). ]*/
+            THANDLE_INITIALIZE(THREADPOOL)(&result->threadpool, threadpool);
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_027: [ h_fabric_paged_query_iterator_create shall initialize the SERVICEFABRIC_DOX_CANCELLATION of the iterator by calling servicefabric_dox_cancellation_init. ]*/
+            servicefabric_dox_cancellation_init(&result->cancellation);
+
+            start_prefetch(result);
+
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_007: [ h_fabric_paged_query_iterator_create shall succeed and return a non-NULL handle. ]*/
+        }
+    }
+    return result;
+}
+
+void h_fabric_paged_query_iterator_destroy(H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator)
+{
+    if (iterator == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_010: [ If iterator is NULL then h_fabric_paged_query_iterator_destroy shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator=%p", iterator);
+    }
+    else
+    {
+        if (iterator->is_prefetching)
+        {
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_028: [ If a page is being fetched then h_fabric_paged_query_iterator_destroy shall cancel it by calling servicefabric_dox_cancellation_cancel. ]*/
+            /*a prefetch that did not start yet stops at its first Service Fabric operation*/
+            servicefabric_dox_cancellation_cancel(&iterator->cancellation);
+
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_011: [ h_fabric_paged_query_iterator_destroy shall then wait for the work item by calling InterlockedHL_WaitForValue and release the page if it was fetched anyway. ]*/
+            wait_for_prefetch(iterator);
+            if (SUCCEEDED(iterator->prefetch_result))
+            {
+                (void)iterator->prefetched_page->lpVtbl->Release(iterator->prefetched_page);
+            }
+        }
+
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_012: [ h_fabric_paged_query_iterator_destroy shall release the current page, release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL and free the memory used by the iterator. ]*/
+        if (iterator->page != NULL)
+        {
+            (void)iterator->page->lpVtbl->Release(iterator->page);
+        }
+        THANDLE_ASSIGN(THREADPOOL)(&iterator->threadpool, NULL);
+        free(iterator);
+    }
+}
+
+HRESULT h_fabric_paged_query_iterator_next(H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator, const void** item)
+{
+    HRESULT result;
+    if (
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_013: [ If iterator is NULL then h_fabric_paged_query_iterator_next shall fail and return E_INVALIDARG. ]*/
+        (iterator == NULL) ||
+        /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_014: [ If item is NULL then h_fabric_paged_query_iterator_next shall fail and return E_INVALIDARG. ]*/
+        (item == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator=%p, const void** item=%p", iterator, item);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        /*pages can be empty and still have a continuation token*/
+        while (
+            (iterator->item_index == iterator->item_count) &&
+            (iterator->result == S_OK)
+            )
+        {
+            move_to_next_page(iterator);
+        }
+
+        if (iterator->item_index < iterator->item_count)
+        {
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_015: [ If the current page has items that were not handed out yet then h_fabric_paged_query_iterator_next shall set *item to the next one and return S_OK. ]*/
+            *item = iterator->items + (size_t)iterator->item_index * iterator->query->item_size;
+            iterator->item_index++;
+            result = S_OK;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_016: [ If all the items of the last page were handed out then h_fabric_paged_query_iterator_next shall return S_FALSE. ]*/
+            /*Codes_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_020: [ If fetching the next page failed then h_fabric_paged_query_iterator_next shall return the error of the query on this call and all the next calls. ]*/
+            result = iterator->result;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,1076 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <wchar.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/srw_lock.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+#include "c_pal/timer.h"
+
+#include "sf_c_util/hresult_to_string.h"
+
+#include "hfabricqueryclient10.h"
+
+#include "h_fabric_query_cache.h"
+
+MU_DEFINE_ENUM_STRINGS(H_FABRIC_QUERY_CACHE_API, H_FABRIC_QUERY_CACHE_API_VALUES)
+
+#define QUERY_CACHE_API_COUNT (H_FABRIC_QUERY_CACHE_API_GET_PARTITION_LOAD_INFORMATION + 1)
+
+#define QUERY_CACHE_ENTRY_STATE_VALUES \
+    QUERY_CACHE_ENTRY_STATE_EMPTY, /*there is no result yet*/ \
+    QUERY_CACHE_ENTRY_STATE_FETCHING, /*one thread is asking SF, everyone else waits for it*/ \
+    QUERY_CACHE_ENTRY_STATE_READY, /*there is a result, it is handed out as long as it is not too old*/ \
+    QUERY_CACHE_ENTRY_STATE_REFRESHING, /*there is a result and a newer one is being fetched by a work item on the threadpool*/ \
+    QUERY_CACHE_ENTRY_STATE_FAILED /*the last ask failed with last_error*/ \
+
+MU_DEFINE_ENUM(QUERY_CACHE_ENTRY_STATE, QUERY_CACHE_ENTRY_STATE_VALUES)
+
+/*the same function walks a query description to hash it, to copy it in the key, to compare it with a key and to rebuild it from a key*/
+#define QUERY_KEY_MODE_VALUES \
+    QUERY_KEY_MODE_MEASURE, \
+    QUERY_KEY_MODE_WRITE, \
+    QUERY_KEY_MODE_COMPARE, \
+    QUERY_KEY_MODE_READ \
+
+MU_DEFINE_ENUM(QUERY_KEY_MODE, QUERY_KEY_MODE_VALUES)
+
+/*the canonical form of a query: every field of the description and of its known extensions, strings by content, each field padded to 4 bytes*/
+typedef struct QUERY_KEY_TAG
+{
+    QUERY_KEY_MODE mode;
+    unsigned char* bytes; /*written by WRITE, compared by COMPARE, read by READ*/
+    size_t size; /*bytes walked so far*/
+    uint32_t hash; /*FNV-1a of the bytes walked so far*/
+    bool is_equal; /*COMPARE only*/
+    bool is_cacheable; /*false when the description has extensions the cache does not know*/
+} QUERY_KEY;
+
+/*where an entry rebuilds its own copy of the description, so that it can ask SF again after the caller is gone. The description is always the first field.*/
+typedef union QUERY_DESCRIPTION_STORAGE_TAG
+{
+    struct
+    {
+        FABRIC_NODE_QUERY_DESCRIPTION description;
+        FABRIC_NODE_QUERY_DESCRIPTION_EX1 ex1;
+        FABRIC_NODE_QUERY_DESCRIPTION_EX2 ex2;
+        FABRIC_NODE_QUERY_DESCRIPTION_EX3 ex3;
+    } node_list;
+    struct
+    {
+        FABRIC_APPLICATION_QUERY_DESCRIPTION description;
+        FABRIC_APPLICATION_QUERY_DESCRIPTION_EX1 ex1;
+        FABRIC_APPLICATION_QUERY_DESCRIPTION_EX2 ex2;
+        FABRIC_APPLICATION_QUERY_DESCRIPTION_EX3 ex3;
+        FABRIC_APPLICATION_QUERY_DESCRIPTION_EX4 ex4;
+    } application_list;
+    struct
+    {
+        FABRIC_SERVICE_QUERY_DESCRIPTION description;
+        FABRIC_SERVICE_QUERY_DESCRIPTION_EX1 ex1;
+        FABRIC_SERVICE_QUERY_DESCRIPTION_EX2 ex2;
+        FABRIC_SERVICE_QUERY_DESCRIPTION_EX3 ex3;
+    } service_list;
+    struct
+    {
+        FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION description;
+        FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION_EX1 ex1;
+    } partition_list;
+    struct
+    {
+        FABRIC_NODE_LOAD_INFORMATION_QUERY_DESCRIPTION description;
+    } node_load_information;
+    struct
+    {
+        FABRIC_PARTITION_LOAD_INFORMATION_QUERY_DESCRIPTION description;
+    } partition_load_information;
+} QUERY_DESCRIPTION_STORAGE;
+
+/*what differs between the cached queries*/
+typedef struct QUERY_CACHE_API_TAG
+{
+    /*description is the description of the caller (only read) or, for QUERY_KEY_MODE_READ, the description in storage*/
+    void (*visit_description)(QUERY_KEY* key, void* description, QUERY_DESCRIPTION_STORAGE* storage);
+    HRESULT (*query)(H_FABRIC_HANDLE(IFabricQueryClient10) client, const void* description, DWORD timeoutMilliseconds, IUnknown** result);
+} QUERY_CACHE_API;
+
+typedef struct H_FABRIC_QUERY_CACHE_TAG H_FABRIC_QUERY_CACHE;
+typedef struct QUERY_CACHE_SHARD_TAG QUERY_CACHE_SHARD;
+
+/*an entry is referenced by its bucket, by every query function call that did not find a result to hand out (a hit only uses it under the shared
+shard lock) and by its refresh until the refresh is done. An entry nobody but its bucket references can be evicted, the last reference frees it*/
+typedef struct QUERY_CACHE_ENTRY_TAG
+{
+    struct QUERY_CACHE_ENTRY_TAG* next; /*guarded by the shard lock*/
+    H_FABRIC_QUERY_CACHE* cache;
+    QUERY_CACHE_SHARD* shard;
+    H_FABRIC_QUERY_CACHE_API api;
+    uint32_t hash;
+    size_t key_size;
+
+    volatile_atomic int32_t ref_count;
+    volatile_atomic int32_t state; /*QUERY_CACHE_ENTRY_STATE*/
+    HRESULT last_error; /*written before state becomes FAILED*/
+
+    IUnknown* result; /*written under the exclusive shard lock, read under the shared shard lock*/
+    double fetched_at; /*same as result*/
+
+    DWORD refresh_timeout; /*written by the thread that switched the entry to REFRESHING, before the refresh is scheduled*/
+
+    QUERY_DESCRIPTION_STORAGE description; /*rebuilt from key, strings point inside key*/
+    uint32_t key[];
+} QUERY_CACHE_ENTRY;
+
+typedef struct QUERY_CACHE_API_CONFIGURATION_TAG
+{
+    volatile_atomic int32_t ttl_ms;
+    volatile_atomic int32_t stale_ms;
+} QUERY_CACHE_API_CONFIGURATION;
+
+struct QUERY_CACHE_SHARD_TAG
+{
+    SRW_LOCK_HANDLE lock;
+    QUERY_CACHE_ENTRY** buckets;
+};
+
+struct H_FABRIC_QUERY_CACHE_TAG
+{
+    H_FABRIC_HANDLE(IFabricQueryClient10) client;
+    QUERY_CACHE_API_CONFIGURATION configurations[QUERY_CACHE_API_COUNT]; /*read by every call, written only by h_fabric_query_cache_configure*/
+    uint32_t shard_count;
+    uint32_t buckets_per_shard;
+    QUERY_CACHE_ENTRY** all_buckets;
+
+    /*the refreshes run as work items on the threadpool, so the refreshes of different queries do not wait for each other*/
+    THANDLE(THREADPOOL) threadpool;
+    volatile_atomic int32_t pending_refreshes; /*refresh work items that did not finish yet*/
+    volatile_atomic int32_t is_destroying; /*refresh work items that did not start yet do not ask SF once this is set*/
+
+    QUERY_CACHE_SHARD shards[];
+};
+
+static void key_init(QUERY_KEY* key, QUERY_KEY_MODE mode, unsigned char* bytes)
+{
+    key->mode = mode;
+    key->bytes = bytes;
+    key->size = 0;
+    key->hash = 2166136261;
+    key->is_equal = true;
+    key->is_cacheable = true;
+}
+
+static void key_visit_bytes(QUERY_KEY* key, void* value, size_t size)
+{
+    static const unsigned char padding[sizeof(uint32_t)] = { 0 };
+    size_t padding_size = (sizeof(uint32_t) - (size % sizeof(uint32_t))) % sizeof(uint32_t);
+
+    switch (key->mode)
+    {
+        case QUERY_KEY_MODE_WRITE:
+        {
+            (void)memcpy(key->bytes + key->size, value, size);
+            (void)memcpy(key->bytes + key->size + size, padding, padding_size);
+            break;
+        }
+        case QUERY_KEY_MODE_COMPARE:
+        {
+            if (key->is_equal && (memcmp(key->bytes + key->size, value, size) != 0))
+            {
+                key->is_equal = false;
+            }
+            break;
+        }
+        case QUERY_KEY_MODE_READ:
+        {
+            (void)memcpy(value, key->bytes + key->size, size);
+            break;
+        }
+        default:
+        {
+            /*FNV-1a*/
+            const unsigned char* p = value;
+            for (size_t i = 0; i < size; i++)
+            {
+                key->hash ^= p[i];
+                key->hash *= 16777619;
+            }
+            for (size_t i = 0; i < padding_size; i++)
+            {
+                key->hash *= 16777619;
+            }
+            break;
+        }
+    }
+    key->size += size + padding_size;
+}
+
+static void key_visit_string(QUERY_KEY* key, LPCWSTR* value)
+{
+    uint32_t length = ((key->mode == QUERY_KEY_MODE_READ) || (*value == NULL)) ? 0 : (uint32_t)wcslen(*value) + 1;
+    key_visit_bytes(key, &length, sizeof(length));
+    if (key->mode == QUERY_KEY_MODE_READ)
+    {
+        /*the key is 4 bytes aligned, and so is every field in it*/
+        *value = (length == 0) ? NULL : (LPCWSTR)(key->bytes + key->size);
+        key->size += ((length * sizeof(wchar_t)) + sizeof(uint32_t) - 1) / sizeof(uint32_t) * sizeof(uint32_t);
+    }
+    else if (length != 0)
+    {
+        key_visit_bytes(key, (void*)*value, length * sizeof(wchar_t));
+    }
+    else
+    {
+        /*NULL, only the length is in the key*/
+    }
+}
+
+/*returns the extension Reserved points to (NULL if none). For READ, Reserved is made to point to storage when the extension was there*/
+static void* key_visit_extension(QUERY_KEY* key, void** reserved, void* storage)
+{
+    uint32_t is_present = ((key->mode == QUERY_KEY_MODE_READ) || (*reserved == NULL)) ? 0 : 1;
+    key_visit_bytes(key, &is_present, sizeof(is_present));
+    if (key->mode == QUERY_KEY_MODE_READ)
+    {
+        *reserved = (is_present != 0) ? storage : NULL;
+    }
+    return (is_present != 0) ? *reserved : NULL;
+}
+
+static void key_visit_no_extension(QUERY_KEY* key, const void* reserved)
+{
+    if (reserved != NULL)
+    {
+        /*an extension this code does not know about, so it cannot be part of the key*/
+        key->is_cacheable = false;
+    }
+}
+
+static void node_list_visit_description(QUERY_KEY* key, void* query_description, QUERY_DESCRIPTION_STORAGE* storage)
+{
+    FABRIC_NODE_QUERY_DESCRIPTION* description = query_description;
+    key_visit_string(key, &description->NodeNameFilter);
+    FABRIC_NODE_QUERY_DESCRIPTION_EX1* ex1 = key_visit_extension(key, &description->Reserved, &storage->node_list.ex1);
+    if (ex1 != NULL)
+    {
+        key_visit_string(key, &ex1->ContinuationToken);
+        FABRIC_NODE_QUERY_DESCRIPTION_EX2* ex2 = key_visit_extension(key, &ex1->Reserved, &storage->node_list.ex2);
+        if (ex2 != NULL)
+        {
+            key_visit_bytes(key, &ex2->NodeStatusFilter, sizeof(ex2->NodeStatusFilter));
+            FABRIC_NODE_QUERY_DESCRIPTION_EX3* ex3 = key_visit_extension(key, &ex2->Reserved, &storage->node_list.ex3);
+            if (ex3 != NULL)
+            {
+                key_visit_bytes(key, &ex3->MaxResults, sizeof(ex3->MaxResults));
+                key_visit_no_extension(key, ex3->Reserved);
+            }
+        }
+    }
+}
+
+static void application_list_visit_description(QUERY_KEY* key, void* query_description, QUERY_DESCRIPTION_STORAGE* storage)
+{
+    FABRIC_APPLICATION_QUERY_DESCRIPTION* description = query_description;
+    key_visit_string(key, &description->ApplicationNameFilter);
+    FABRIC_APPLICATION_QUERY_DESCRIPTION_EX1* ex1 = key_visit_extension(key, &description->Reserved, &storage->application_list.ex1);
+    if (ex1 != NULL)
+    {
+        key_visit_string(key, &ex1->ContinuationToken);
+        FABRIC_APPLICATION_QUERY_DESCRIPTION_EX2* ex2 = key_visit_extension(key, &ex1->Reserved, &storage->application_list.ex2);
+        if (ex2 != NULL)
+        {
+            key_visit_string(key, &ex2->ApplicationTypeNameFilter);
+            key_visit_bytes(key, &ex2->ExcludeApplicationParameters, sizeof(ex2->ExcludeApplicationParameters));
+            FABRIC_APPLICATION_QUERY_DESCRIPTION_EX3* ex3 = key_visit_extension(key, &ex2->Reserved, &storage->application_list.ex3);
+            if (ex3 != NULL)
+            {
+                key_visit_bytes(key, &ex3->ApplicationDefinitionKindFilter, sizeof(ex3->ApplicationDefinitionKindFilter));
+                FABRIC_APPLICATION_QUERY_DESCRIPTION_EX4* ex4 = key_visit_extension(key, &ex3->Reserved, &storage->application_list.ex4);
+                if (ex4 != NULL)
+                {
+                    key_visit_bytes(key, &ex4->MaxResults, sizeof(ex4->MaxResults));
+                    key_visit_no_extension(key, ex4->Reserved);
+                }
+            }
+        }
+    }
+}
+
+static void service_list_visit_description(QUERY_KEY* key, void* query_description, QUERY_DESCRIPTION_STORAGE* storage)
+{
+    FABRIC_SERVICE_QUERY_DESCRIPTION* description = query_description;
+    key_visit_string(key, &description->ApplicationName);
+    key_visit_string(key, &description->ServiceNameFilter);
+    FABRIC_SERVICE_QUERY_DESCRIPTION_EX1* ex1 = key_visit_extension(key, &description->Reserved, &storage->service_list.ex1);
+    if (ex1 != NULL)
+    {
+        key_visit_string(key, &ex1->ContinuationToken);
+        FABRIC_SERVICE_QUERY_DESCRIPTION_EX2* ex2 = key_visit_extension(key, &ex1->Reserved, &storage->service_list.ex2);
+        if (ex2 != NULL)
+        {
+            key_visit_string(key, &ex2->ServiceTypeNameFilter);
+            FABRIC_SERVICE_QUERY_DESCRIPTION_EX3* ex3 = key_visit_extension(key, &ex2->Reserved, &storage->service_list.ex3);
+            if (ex3 != NULL)
+            {
+                key_visit_bytes(key, &ex3->MaxResults, sizeof(ex3->MaxResults));
+                key_visit_no_extension(key, ex3->Reserved);
+            }
+        }
+    }
+}
+
+static void partition_list_visit_description(QUERY_KEY* key, void* query_description, QUERY_DESCRIPTION_STORAGE* storage)
+{
+    FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION* description = query_description;
+    key_visit_string(key, &description->ServiceName);
+    key_visit_bytes(key, &description->PartitionIdFilter, sizeof(description->PartitionIdFilter));
+    FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION_EX1* ex1 = key_visit_extension(key, &description->Reserved, &storage->partition_list.ex1);
+    if (ex1 != NULL)
+    {
+        key_visit_string(key, &ex1->ContinuationToken);
+        key_visit_no_extension(key, ex1->Reserved);
+    }
+}
+
+static void cluster_load_information_visit_description(QUERY_KEY* key, void* query_description, QUERY_DESCRIPTION_STORAGE* storage)
+{
+    /*there is no description, the API alone is the key*/
+    (void)key;
+    (void)query_description;
+    (void)storage;
+}
+
+static void node_load_information_visit_description(QUERY_KEY* key, void* query_description, QUERY_DESCRIPTION_STORAGE* storage)
+{
+    FABRIC_NODE_LOAD_INFORMATION_QUERY_DESCRIPTION* description = query_description;
+    (void)storage;
+    key_visit_string(key, &description->NodeName);
+    key_visit_no_extension(key, description->Reserved);
+}
+
+static void partition_load_information_visit_description(QUERY_KEY* key, void* query_description, QUERY_DESCRIPTION_STORAGE* storage)
+{
+    FABRIC_PARTITION_LOAD_INFORMATION_QUERY_DESCRIPTION* description = query_description;
+    (void)storage;
+    key_visit_bytes(key, &description->PartitionId, sizeof(description->PartitionId));
+    key_visit_no_extension(key, description->Reserved);
+}
+
+#define DEFINE_QUERY_CACHE_QUERY(name, h_fabric_method, description_type, result_interface)                                                         \
+static HRESULT MU_C2(name, _query)(H_FABRIC_HANDLE(IFabricQueryClient10) client, const void* description, DWORD timeoutMilliseconds, IUnknown** result) \
+{                                                                                                                                                  \
+    return H_FABRIC_API(h_fabric_method)(client, (const description_type*)description, timeoutMilliseconds, (result_interface**)result);           \
+}
+
+DEFINE_QUERY_CACHE_QUERY(node_list, FQC10_GetNodeList, FABRIC_NODE_QUERY_DESCRIPTION, IFabricGetNodeListResult)
+DEFINE_QUERY_CACHE_QUERY(application_list, FQC10_GetApplicationList, FABRIC_APPLICATION_QUERY_DESCRIPTION, IFabricGetApplicationListResult)
+DEFINE_QUERY_CACHE_QUERY(service_list, FQC10_GetServiceList, FABRIC_SERVICE_QUERY_DESCRIPTION, IFabricGetServiceListResult)
+DEFINE_QUERY_CACHE_QUERY(partition_list, FQC10_GetPartitionList, FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION, IFabricGetPartitionListResult)
+DEFINE_QUERY_CACHE_QUERY(node_load_information, FQC10_GetNodeLoadInformation, FABRIC_NODE_LOAD_INFORMATION_QUERY_DESCRIPTION, IFabricGetNodeLoadInformationResult)
+DEFINE_QUERY_CACHE_QUERY(partition_load_information, FQC10_GetPartitionLoadInformation, FABRIC_PARTITION_LOAD_INFORMATION_QUERY_DESCRIPTION, IFabricGetPartitionLoadInformationResult)
+
+static HRESULT cluster_load_information_query(H_FABRIC_HANDLE(IFabricQueryClient10) client, const void* description, DWORD timeoutMilliseconds, IUnknown** result)
+{
+    (void)description;
+    return H_FABRIC_API(FQC10_GetClusterLoadInformation)(client, timeoutMilliseconds, (IFabricGetClusterLoadInformationResult**)result);
+}
+
+#define QUERY_CACHE_API_INITIALIZER(name) \
+    { MU_C2(name, _visit_description), MU_C2(name, _query) }
+
+/*indexed by H_FABRIC_QUERY_CACHE_API*/
+static const QUERY_CACHE_API query_cache_apis[QUERY_CACHE_API_COUNT] =
+{
+    QUERY_CACHE_API_INITIALIZER(node_list),
+    QUERY_CACHE_API_INITIALIZER(application_list),
+    QUERY_CACHE_API_INITIALIZER(service_list),
+    QUERY_CACHE_API_INITIALIZER(partition_list),
+    QUERY_CACHE_API_INITIALIZER(cluster_load_information),
+    QUERY_CACHE_API_INITIALIZER(node_load_information),
+    QUERY_CACHE_API_INITIALIZER(partition_load_information)
+};
+
+/*storage is only needed for QUERY_KEY_MODE_READ*/
+static void key_visit_query(QUERY_KEY* key, H_FABRIC_QUERY_CACHE_API api, void* query_description, QUERY_DESCRIPTION_STORAGE* storage)
+{
+    QUERY_DESCRIPTION_STORAGE unused;
+    uint32_t api_value = (uint32_t)api;
+    key_visit_bytes(key, &api_value, sizeof(api_value));
+    query_cache_apis[api].visit_description(key, query_description, (storage == NULL) ? &unused : storage);
+}
+
+static QUERY_CACHE_SHARD* get_shard(H_FABRIC_QUERY_CACHE* cache, const QUERY_KEY* key)
+{
+    return &cache->shards[key->hash % cache->shard_count];
+}
+
+static QUERY_CACHE_ENTRY** get_bucket(H_FABRIC_QUERY_CACHE* cache, QUERY_CACHE_SHARD* shard, const QUERY_KEY* key)
+{
+    /*the low part of the hash picked the shard, the rest picks the bucket*/
+    return &shard->buckets[(key->hash / cache->shard_count) % cache->buckets_per_shard];
+}
+
+/*the configuration is read by every call. It is read with plain loads, an interlocked read would take its cache line exclusively*/
+static void get_configuration(H_FABRIC_QUERY_CACHE* cache, H_FABRIC_QUERY_CACHE_API api, int32_t* ttl_ms, int32_t* stale_ms)
+{
+    *ttl_ms = ReadNoFence((volatile LONG*)&cache->configurations[api].ttl_ms);
+    *stale_ms = ReadNoFence((volatile LONG*)&cache->configurations[api].stale_ms);
+}
+
+/*the shard lock is held by the caller*/
+static QUERY_CACHE_ENTRY* find_entry(QUERY_CACHE_ENTRY* bucket, H_FABRIC_QUERY_CACHE_API api, const void* queryDescription, const QUERY_KEY* key)
+{
+    QUERY_CACHE_ENTRY* entry;
+    for (entry = bucket; entry != NULL; entry = entry->next)
+    {
+        if (
+            (entry->hash == key->hash) &&
+            (entry->key_size == key->size) &&
+            (entry->api == api)
+            )
+        {
+            QUERY_KEY compare;
+            key_init(&compare, QUERY_KEY_MODE_COMPARE, (unsigned char*)entry->key);
+            key_visit_query(&compare, api, (void*)queryDescription, NULL);
+            if (compare.is_equal)
+            {
+                break;
+            }
+        }
+    }
+    return entry;
+}
+
+static QUERY_CACHE_ENTRY* entry_create(H_FABRIC_QUERY_CACHE* cache, QUERY_CACHE_SHARD* shard, H_FABRIC_QUERY_CACHE_API api, const void* queryDescription, const QUERY_KEY* key)
+{
+    QUERY_CACHE_ENTRY* result = malloc_flex(sizeof(QUERY_CACHE_ENTRY), key->size / sizeof(uint32_t), sizeof(uint32_t));
+    if (result == NULL)
+    {
+        LogError("failure in malloc_flex(sizeof(QUERY_CACHE_ENTRY)=%zu, %zu, sizeof(uint32_t)=%zu)", sizeof(QUERY_CACHE_ENTRY), key->size / sizeof(uint32_t), sizeof(uint32_t));
+        /*return as is*/
+    }
+    else
+    {
+        QUERY_KEY write;
+        QUERY_KEY read;
+
+        result->next = NULL;
+        result->cache = cache;
+        result->shard = shard;
+        result->api = api;
+        result->hash = key->hash;
+        result->key_size = key->size;
+        (void)interlocked_exchange(&result->ref_count, 1); /*the bucket*/
+        (void)interlocked_exchange(&result->state, QUERY_CACHE_ENTRY_STATE_EMPTY);
+        result->last_error = S_OK;
+        result->result = NULL;
+        result->fetched_at = 0;
+        result->refresh_timeout = 0;
+
+        key_init(&write, QUERY_KEY_MODE_WRITE, (unsigned char*)result->key);
+        key_visit_query(&write, api, (void*)queryDescription, NULL);
+
+        (void)memset(&result->description, 0, sizeof(result->description));
+        key_init(&read, QUERY_KEY_MODE_READ, (unsigned char*)result->key);
+        key_visit_query(&read, api, &result->description, &result->description);
+    }
+    return result;
+}
+
+/*only called by the thread that switched the entry to FETCHING, or by the refresh of the entry*/
+static HRESULT entry_fetch(QUERY_CACHE_ENTRY* entry, DWORD timeoutMilliseconds, IUnknown** fetched)
+{
+    H_FABRIC_QUERY_CACHE* cache = entry->cache;
+    HRESULT hr = query_cache_apis[entry->api].query(cache->client, &entry->description, timeoutMilliseconds, fetched);
+    if (FAILED(hr))
+    {
+        LogHRESULTError(hr, "failure in %" PRI_MU_ENUM " (cache->client=%p, ...)", MU_ENUM_VALUE(H_FABRIC_QUERY_CACHE_API, entry->api), cache->client);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_027: [ On success the new result shall replace the cached result under the exclusive shard lock, together with the time it was received (timer_global_get_elapsed_ms), and the previous result shall be released. ]*/
+        double now = timer_global_get_elapsed_ms();
+        IUnknown* previous;
+
+        srw_lock_acquire_exclusive(entry->shard->lock);
+        previous = entry->result;
+        entry->result = *fetched;
+        entry->fetched_at = now;
+        srw_lock_release_exclusive(entry->shard->lock);
+
+        if (previous != NULL)
+        {
+            (void)previous->lpVtbl->Release(previous);
+        }
+    }
+    return hr;
+}
+
+static void entry_dec_ref(QUERY_CACHE_ENTRY* entry)
+{
+    if (interlocked_decrement(&entry->ref_count) == 0)
+    {
+        if (entry->result != NULL)
+        {
+            (void)entry->result->lpVtbl->Release(entry->result);
+        }
+        free(entry);
+    }
+}
+
+/*the shard lock is held exclusively by the caller. An entry that only its bucket references is neither fetched, refreshed nor waited for*/
+static bool entry_is_evictable(H_FABRIC_QUERY_CACHE* cache, QUERY_CACHE_ENTRY* entry, double now)
+{
+    bool result;
+    int32_t ttl_ms;
+    int32_t stale_ms;
+    get_configuration(cache, entry->api, &ttl_ms, &stale_ms);
+    if (interlocked_add(&entry->ref_count, 0) != 1)
+    {
+        result = false;
+    }
+    else if (interlocked_add(&entry->state, 0) != QUERY_CACHE_ENTRY_STATE_READY)
+    {
+        /*EMPTY or FAILED, there is nothing to hand out*/
+        result = true;
+    }
+    else
+    {
+        result = (ttl_ms == 0) || (now - entry->fetched_at >= (double)ttl_ms + (double)stale_ms);
+    }
+    return result;
+}
+
+/*the shard lock is held exclusively by the caller, the evicted entries are chained in evicted (by next) to be freed once the lock is released*/
+static void bucket_evict(H_FABRIC_QUERY_CACHE* cache, QUERY_CACHE_ENTRY** bucket, double now, QUERY_CACHE_ENTRY** evicted)
+{
+    QUERY_CACHE_ENTRY** link = bucket;
+    while (*link != NULL)
+    {
+        QUERY_CACHE_ENTRY* entry = *link;
+        if (entry_is_evictable(cache, entry, now))
+        {
+            *link = entry->next;
+            entry->next = *evicted;
+            *evicted = entry;
+        }
+        else
+        {
+            link = &entry->next;
+        }
+    }
+}
+
+static void refresh_work(void* context)
+{
+    QUERY_CACHE_ENTRY* entry = context;
+    H_FABRIC_QUERY_CACHE* cache = entry->cache;
+
+    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_041: [ If the cache is being destroyed then refresh_work shall not refresh the entry. ]*/
+    if (interlocked_add(&cache->is_destroying, 0) == 0)
+    {
+        IUnknown* fetched;
+
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_028: [ The refresh shall call the HFQC10_ API of the query with the copy of the description kept by the entry. ]*/
+        HRESULT hr = entry_fetch(entry, entry->refresh_timeout, &fetched);
+        if (FAILED(hr))
+        {
+            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_029: [ If the refresh fails then the cached result shall be kept. ]*/
+            /*it is handed out until it is older than ttl_ms + stale_ms, and the next call in the stale window tries again*/
+        }
+    }
+
+    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_030: [ The refresh shall switch the entry back to READY and wake all the threads waiting for the entry. ]*/
+    (void)interlocked_exchange(&entry->state, QUERY_CACHE_ENTRY_STATE_READY);
+    wake_by_address_all(&entry->state);
+
+    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_047: [ refresh_work shall release the reference of the refresh on the entry and, if it was the last refresh in progress, wake h_fabric_query_cache_destroy. ]*/
+    entry_dec_ref(entry);
+    if (interlocked_decrement(&cache->pending_refreshes) == 0)
+    {
+        wake_by_address_single(&cache->pending_refreshes);
+    }
+}
+
+/*the caller switched the entry from READY to REFRESHING and took a reference on the entry for the refresh*/
+static void entry_start_refresh(QUERY_CACHE_ENTRY* entry, DWORD timeoutMilliseconds)
+{
+    H_FABRIC_QUERY_CACHE* cache = entry->cache;
+
+    entry->refresh_timeout = timeoutMilliseconds;
+
+    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_025: [ If the cached result is older than ttl_ms but not older than ttl_ms + stale_ms then the query functions shall also switch the entry from READY to REFRESHING, take a reference on the entry for the refresh and call threadpool_schedule_work with refresh_work. ]*/
+    (void)interlocked_increment(&cache->pending_refreshes);
+    if (threadpool_schedule_work(cache->threadpool, refresh_work, entry) != 0)
+    {
+        LogError("failure in threadpool_schedule_work(cache->threadpool=%p, refresh_work=%p, entry=%p)", cache->threadpool, refresh_work, entry);
+
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_026: [ If threadpool_schedule_work fails then the entry shall be switched back to READY and the reference taken for the refresh shall be released. ]*/
+        (void)interlocked_exchange(&entry->state, QUERY_CACHE_ENTRY_STATE_READY);
+        wake_by_address_all(&entry->state);
+        entry_dec_ref(entry);
+        if (interlocked_decrement(&cache->pending_refreshes) == 0)
+        {
+            wake_by_address_single(&cache->pending_refreshes);
+        }
+    }
+}
+
+static HRESULT query_cache_get(H_FABRIC_QUERY_CACHE_HANDLE cache, H_FABRIC_QUERY_CACHE_API api, const void* queryDescription, DWORD timeoutMilliseconds, IUnknown** result)
+{
+    HRESULT hr;
+    if (
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_017: [ If cache is NULL then the query functions shall fail and return E_INVALIDARG. ]*/
+        (cache == NULL) ||
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_018: [ If queryDescription is NULL then the query functions shall fail and return E_INVALIDARG. ]*/
+        ((queryDescription == NULL) && (api != H_FABRIC_QUERY_CACHE_API_GET_CLUSTER_LOAD_INFORMATION)) ||
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_019: [ If result is NULL then the query functions shall fail and return E_INVALIDARG. ]*/
+        (result == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_QUERY_CACHE_HANDLE cache=%p, H_FABRIC_QUERY_CACHE_API api=%" PRI_MU_ENUM ", const void* queryDescription=%p, DWORD timeoutMilliseconds=%lu, result=%p",
+            cache, MU_ENUM_VALUE(H_FABRIC_QUERY_CACHE_API, api), queryDescription, timeoutMilliseconds, result);
+        hr = E_INVALIDARG;
+    }
+    else
+    {
+        int32_t ttl_ms;
+        int32_t stale_ms;
+        QUERY_KEY key;
+
+        get_configuration(cache, api, &ttl_ms, &stale_ms);
+        key_init(&key, QUERY_KEY_MODE_MEASURE, NULL);
+        if (ttl_ms != 0)
+        {
+            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_021: [ The query functions shall compute the canonical key of the query: the API and every field of queryDescription and of the extensions it points to (strings by content). ]*/
+            key_visit_query(&key, api, (void*)queryDescription, NULL);
+        }
+
+        if (
+            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_020: [ If the API is not cached (ttl_ms is 0) then the query functions shall call the HFQC10_ API of the query with queryDescription and return its result. ]*/
+            (ttl_ms == 0) ||
+            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_022: [ If queryDescription points to extensions that the cache does not know then the query functions shall call the HFQC10_ API of the query with queryDescription and return its result. ]*/
+            (!key.is_cacheable)
+            )
+        {
+            hr = query_cache_apis[api].query(cache->client, queryDescription, timeoutMilliseconds, result);
+        }
+        else
+        {
+            QUERY_CACHE_SHARD* shard = get_shard(cache, &key);
+            QUERY_CACHE_ENTRY** bucket = get_bucket(cache, shard, &key);
+            QUERY_CACHE_ENTRY* entry;
+            double now = timer_global_get_elapsed_ms();
+            bool is_hit = false;
+            bool needs_refresh = false;
+
+            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_023: [ The query functions shall look up the entry of the key in its shard under the shared shard lock and, in the same shared section, hand out the cached result if the entry is READY or REFRESHING and its result is not older than ttl_ms + stale_ms. ]*/
+            srw_lock_acquire_shared(shard->lock);
+            entry = find_entry(*bucket, api, queryDescription, &key);
+            if (entry != NULL)
+            {
+                /*a plain load, a hit does not write the cache line of the entry*/
+                int32_t state = ReadAcquire((volatile LONG*)&entry->state);
+                double age = now - entry->fetched_at;
+                if (
+                    ((state == QUERY_CACHE_ENTRY_STATE_READY) || (state == QUERY_CACHE_ENTRY_STATE_REFRESHING)) &&
+                    (age < (double)ttl_ms + (double)stale_ms)
+                    )
+                {
+                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_024: [ If the cached result is not older than ttl_ms then the query functions shall AddRef it, return it in result and return S_OK. ]*/
+                    (void)entry->result->lpVtbl->AddRef(entry->result);
+                    *result = entry->result;
+                    is_hit = true;
+
+                    if (
+                        (age >= (double)ttl_ms) &&
+                        (state == QUERY_CACHE_ENTRY_STATE_READY) &&
+                        (interlocked_compare_exchange(&entry->state, QUERY_CACHE_ENTRY_STATE_REFRESHING, QUERY_CACHE_ENTRY_STATE_READY) == QUERY_CACHE_ENTRY_STATE_READY)
+                        )
+                    {
+                        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_025: [ If the cached result is older than ttl_ms but not older than ttl_ms + stale_ms then the query functions shall also switch the entry from READY to REFRESHING, take a reference on the entry for the refresh and call threadpool_schedule_work with refresh_work. ]*/
+                        /*taken under the shared shard lock, so the entry cannot be evicted before the refresh holds it*/
+                        (void)interlocked_increment(&entry->ref_count);
+                        needs_refresh = true;
+                    }
+                }
+                else
+                {
+                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_044: [ Otherwise the query functions shall take a reference on the entry, which the call holds until it returns. ]*/
+                    (void)interlocked_increment(&entry->ref_count);
+                }
+            }
+            srw_lock_release_shared(shard->lock);
+
+            if (is_hit)
+            {
+                if (needs_refresh)
+                {
+                    entry_start_refresh(entry, timeoutMilliseconds);
+                }
+                hr = S_OK;
+            }
+            else
+            {
+                if (entry == NULL)
+                {
+                    QUERY_CACHE_ENTRY* evicted = NULL;
+
+                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_045: [ If there is no entry, the query functions shall add an entry under the exclusive shard lock (unless another thread added it meanwhile). The entry keeps its own copy of the description. ]*/
+                    srw_lock_acquire_exclusive(shard->lock);
+                    entry = find_entry(*bucket, api, queryDescription, &key);
+                    if (entry == NULL)
+                    {
+                        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_040: [ Before adding an entry, the query functions shall evict from its bucket the entries that no other call and no refresh is using and that have nothing to hand out anymore: no result, or a result older than ttl_ms + stale_ms of their API, or an API that is not cached anymore. ]*/
+                        bucket_evict(cache, bucket, now, &evicted);
+
+                        entry = entry_create(cache, shard, api, queryDescription, &key);
+                        if (entry != NULL)
+                        {
+                            entry->next = *bucket;
+                            *bucket = entry;
+                        }
+                    }
+                    if (entry != NULL)
+                    {
+                        (void)interlocked_increment(&entry->ref_count);
+                    }
+                    srw_lock_release_exclusive(shard->lock);
+
+                    while (evicted != NULL)
+                    {
+                        QUERY_CACHE_ENTRY* next = evicted->next;
+                        entry_dec_ref(evicted);
+                        evicted = next;
+                    }
+                }
+
+                if (entry == NULL)
+                {
+                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_036: [ If there are any failures then the query functions shall fail and return an error. ]*/
+                    LogError("failure in entry_create for %" PRI_MU_ENUM "", MU_ENUM_VALUE(H_FABRIC_QUERY_CACHE_API, api));
+                    hr = E_OUTOFMEMORY;
+                }
+                else
+                {
+                    bool has_waited = false;
+                    bool is_fetching = false;
+                    for (;;)
+                    {
+                        int32_t state = interlocked_add(&entry->state, 0);
+                        if ((state == QUERY_CACHE_ENTRY_STATE_READY) || (state == QUERY_CACHE_ENTRY_STATE_REFRESHING))
+                        {
+                            double age;
+                            bool is_usable;
+
+                            now = timer_global_get_elapsed_ms();
+                            srw_lock_acquire_shared(shard->lock);
+                            age = now - entry->fetched_at;
+                            is_usable = (age < (double)ttl_ms + (double)stale_ms);
+                            if (is_usable)
+                            {
+                                /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_024: [ If the cached result is not older than ttl_ms then the query functions shall AddRef it, return it in result and return S_OK. ]*/
+                                (void)entry->result->lpVtbl->AddRef(entry->result);
+                                *result = entry->result;
+                            }
+                            srw_lock_release_shared(shard->lock);
+
+                            if (is_usable)
+                            {
+                                if (
+                                    (age >= (double)ttl_ms) &&
+                                    (state == QUERY_CACHE_ENTRY_STATE_READY) &&
+                                    (interlocked_compare_exchange(&entry->state, QUERY_CACHE_ENTRY_STATE_REFRESHING, QUERY_CACHE_ENTRY_STATE_READY) == QUERY_CACHE_ENTRY_STATE_READY)
+                                    )
+                                {
+                                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_025: [ If the cached result is older than ttl_ms but not older than ttl_ms + stale_ms then the query functions shall also switch the entry from READY to REFRESHING, take a reference on the entry for the refresh and call threadpool_schedule_work with refresh_work. ]*/
+                                    (void)interlocked_increment(&entry->ref_count);
+                                    entry_start_refresh(entry, timeoutMilliseconds);
+                                }
+                                hr = S_OK;
+                                break;
+                            }
+                            else if (state == QUERY_CACHE_ENTRY_STATE_READY)
+                            {
+                                /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_032: [ Otherwise the query functions shall switch the entry to FETCHING and call the HFQC10_ API of the query with the copy of the description kept by the entry. ]*/
+                                if (interlocked_compare_exchange(&entry->state, QUERY_CACHE_ENTRY_STATE_FETCHING, QUERY_CACHE_ENTRY_STATE_READY) == QUERY_CACHE_ENTRY_STATE_READY)
+                                {
+                                    is_fetching = true;
+                                    break;
+                                }
+                            }
+                            else
+                            {
+                                /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_033: [ If the cached result is too old (or there is none) and another thread is asking SF for the same query then the query functions shall wait for it by calling InterlockedHL_WaitForNotValue. ]*/
+                                INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForNotValue(&entry->state, QUERY_CACHE_ENTRY_STATE_REFRESHING, UINT32_MAX);
+                                if (wait_result != INTERLOCKED_HL_OK)
+                                {
+                                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_036: [ If there are any failures then the query functions shall fail and return an error. ]*/
+                                    LogError("failure in InterlockedHL_WaitForNotValue(&entry->state=%p, QUERY_CACHE_ENTRY_STATE_REFRESHING, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d",
+                                        &entry->state, (int)wait_result);
+                                    hr = E_FAIL;
+                                    break;
+                                }
+                            }
+                        }
+                        else if (state == QUERY_CACHE_ENTRY_STATE_FETCHING)
+                        {
+                            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_033: [ If the cached result is too old (or there is none) and another thread is asking SF for the same query then the query functions shall wait for it by calling InterlockedHL_WaitForNotValue. ]*/
+                            INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForNotValue(&entry->state, QUERY_CACHE_ENTRY_STATE_FETCHING, UINT32_MAX);
+                            if (wait_result != INTERLOCKED_HL_OK)
+                            {
+                                /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_036: [ If there are any failures then the query functions shall fail and return an error. ]*/
+                                LogError("failure in InterlockedHL_WaitForNotValue(&entry->state=%p, QUERY_CACHE_ENTRY_STATE_FETCHING, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d",
+                                    &entry->state, (int)wait_result);
+                                hr = E_FAIL;
+                                break;
+                            }
+                            has_waited = true;
+                        }
+                        else if ((state == QUERY_CACHE_ENTRY_STATE_FAILED) && has_waited)
+                        {
+                            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_035: [ If the thread that was waited for failed then the query functions shall return the same error without asking SF again. ]*/
+                            hr = entry->last_error;
+                            break;
+                        }
+                        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_032: [ Otherwise the query functions shall switch the entry to FETCHING and call the HFQC10_ API of the query with the copy of the description kept by the entry. ]*/
+                        else if (interlocked_compare_exchange(&entry->state, QUERY_CACHE_ENTRY_STATE_FETCHING, state) == state)
+                        {
+                            is_fetching = true;
+                            break;
+                        }
+                        else
+                        {
+                            /*someone else changed the state, look again*/
+                        }
+                    }
+
+                    if (is_fetching)
+                    {
+                        /*only the thread that switched the entry to FETCHING gets here, everyone else waits while the entry is FETCHING*/
+                        IUnknown* fetched;
+                        hr = entry_fetch(entry, timeoutMilliseconds, &fetched);
+                        if (FAILED(hr))
+                        {
+                            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_034: [ If the HFQC10_ API fails then the query functions shall record the error, switch the entry to FAILED and return the error. ]*/
+                            entry->last_error = hr;
+                            (void)interlocked_exchange(&entry->state, QUERY_CACHE_ENTRY_STATE_FAILED);
+                        }
+                        else
+                        {
+                            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_037: [ On success the query functions shall AddRef the new result, return it in result, switch the entry to READY and return S_OK. ]*/
+                            (void)fetched->lpVtbl->AddRef(fetched);
+                            *result = fetched;
+                            (void)interlocked_exchange(&entry->state, QUERY_CACHE_ENTRY_STATE_READY);
+                        }
+
+                        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_038: [ The query functions shall wake all the threads waiting for the entry. ]*/
+                        wake_by_address_all(&entry->state);
+                    }
+
+                    entry_dec_ref(entry);
+                }
+            }
+        }
+    }
+    return hr;
+}
+
+H_FABRIC_QUERY_CACHE_HANDLE h_fabric_query_cache_create(H_FABRIC_HANDLE(IFabricQueryClient10) client, THANDLE(THREADPOOL) threadpool, uint32_t shard_count, uint32_t buckets_per_shard)
+{
+    H_FABRIC_QUERY_CACHE_HANDLE result;
+    if (
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_001: [ If client is NULL then h_fabric_query_cache_create shall fail and return NULL. ]*/
+        (client == NULL) ||
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_046: [ If threadpool is NULL then h_fabric_query_cache_create shall fail and return NULL. ]*/
+        (threadpool == NULL) ||
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_002: [ If shard_count is 0 then h_fabric_query_cache_create shall fail and return NULL. ]*/
+        (shard_count == 0) ||
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_048: [ If buckets_per_shard is 0 then h_fabric_query_cache_create shall fail and return NULL. ]*/
+        (buckets_per_shard == 0)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_HANDLE(IFabricQueryClient10) client=%p, THANDLE(THREADPOOL) threadpool=%p, uint32_t shard_count=%" PRIu32 ", uint32_t buckets_per_shard=%" PRIu32 "",
+            client, threadpool, shard_count, buckets_per_shard);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_003: [ h_fabric_query_cache_create shall allocate memory for the cache and its shard_count shards. ]*/
+        result = malloc_flex(sizeof(H_FABRIC_QUERY_CACHE), shard_count, sizeof(QUERY_CACHE_SHARD));
+        if (result == NULL)
+        {
+            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_008: [ If there are any failures then h_fabric_query_cache_create shall fail and return NULL. ]*/
+            LogError("failure in malloc_flex(sizeof(H_FABRIC_QUERY_CACHE)=%zu, shard_count=%" PRIu32 ", sizeof(QUERY_CACHE_SHARD)=%zu)",
+                sizeof(H_FABRIC_QUERY_CACHE), shard_count, sizeof(QUERY_CACHE_SHARD));
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_004: [ h_fabric_query_cache_create shall allocate shard_count * buckets_per_shard empty buckets. ]*/
+            result->all_buckets = calloc((size_t)shard_count * buckets_per_shard, sizeof(QUERY_CACHE_ENTRY*));
+            if (result->all_buckets == NULL)
+            {
+                /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_008: [ If there are any failures then h_fabric_query_cache_create shall fail and return NULL. ]*/
+                LogError("failure in calloc(shard_count=%" PRIu32 " * buckets_per_shard=%" PRIu32 ", sizeof(QUERY_CACHE_ENTRY*)=%zu)",
+                    shard_count, buckets_per_shard, sizeof(QUERY_CACHE_ENTRY*));
+            }
+            else
+            {
+                uint32_t i;
+                for (i = 0; i < shard_count; i++)
+                {
+                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_005: [ h_fabric_query_cache_create shall create a lock for each shard by calling srw_lock_create. ]*/
+                    result->shards[i].lock = srw_lock_create(false, "h_fabric_query_cache");
+                    if (result->shards[i].lock == NULL)
+                    {
+                        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_008: [ If there are any failures then h_fabric_query_cache_create shall fail and return NULL. ]*/
+                        LogError("failure in srw_lock_create(false, \"h_fabric_query_cache\"), shard %" PRIu32 "", i);
+                        break;
+                    }
+                    result->shards[i].buckets = result->all_buckets + (size_t)i * buckets_per_shard;
+                }
+
+                if (i < shard_count)
+                {
+                    while (i > 0)
+                    {
+                        i--;
+                        srw_lock_destroy(result->shards[i].lock);
+                    }
+                }
+                else
+                {
+                    result->client = client;
+                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_042: [ h_fabric_query_cache_create shall keep a reference on threadpool by calling THANDLE_INITIALIZE(THREADPOOL). ]*/
+                    THANDLE_INITIALIZE(THREADPOOL)(&result->threadpool, threadpool);
+                    (void)interlocked_exchange(&result->pending_refreshes, 0);
+                    (void)interlocked_exchange(&result->is_destroying, 0);
+                    result->shard_count = shard_count;
+                    result->buckets_per_shard = buckets_per_shard;
+
+                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_006: [ h_fabric_query_cache_create shall not cache any API until it is configured. ]*/
+                    for (uint32_t j = 0; j < QUERY_CACHE_API_COUNT; j++)
+                    {
+                        (void)interlocked_exchange(&result->configurations[j].ttl_ms, 0);
+                        (void)interlocked_exchange(&result->configurations[j].stale_ms, 0);
+                    }
+
+                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_007: [ h_fabric_query_cache_create shall succeed and return a non-NULL handle. ]*/
+                    goto allok;
+                }
+                free(result->all_buckets);
+            }
+            free(result);
+        }
+    }
+    result = NULL;
+allok:;
+    return result;
+}
+
+void h_fabric_query_cache_destroy(H_FABRIC_QUERY_CACHE_HANDLE cache)
+{
+    if (cache == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_009: [ If cache is NULL then h_fabric_query_cache_destroy shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_QUERY_CACHE_HANDLE cache=%p", cache);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_043: [ h_fabric_query_cache_destroy shall mark the cache as being destroyed, so that the refreshes which did not start yet do not call the client. ]*/
+        (void)interlocked_exchange(&cache->is_destroying, 1);
+
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_010: [ h_fabric_query_cache_destroy shall wait for the scheduled refreshes to finish by calling InterlockedHL_WaitForValue. ]*/
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&cache->pending_refreshes, 0, UINT32_MAX);
+        if (wait_result != INTERLOCKED_HL_OK)
+        {
+            LogError("failure in InterlockedHL_WaitForValue(&cache->pending_refreshes=%p, 0, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d", &cache->pending_refreshes, (int)wait_result);
+        }
+
+        for (uint32_t i = 0; i < cache->shard_count; i++)
+        {
+            for (uint32_t j = 0; j < cache->buckets_per_shard; j++)
+            {
+                QUERY_CACHE_ENTRY* entry = cache->shards[i].buckets[j];
+                while (entry != NULL)
+                {
+                    QUERY_CACHE_ENTRY* next = entry->next;
+
+                    /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_011: [ For each entry, h_fabric_query_cache_destroy shall release the cached result and free the entry. ]*/
+                    entry_dec_ref(entry);
+                    entry = next;
+                }
+            }
+            /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_012: [ h_fabric_query_cache_destroy shall destroy the shard locks, release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL and free the memory used by the cache. ]*/
+            srw_lock_destroy(cache->shards[i].lock);
+        }
+        THANDLE_ASSIGN(THREADPOOL)(&cache->threadpool, NULL);
+        free(cache->all_buckets);
+        free(cache);
+    }
+}
+
+int h_fabric_query_cache_configure(H_FABRIC_QUERY_CACHE_HANDLE cache, H_FABRIC_QUERY_CACHE_API api, uint32_t ttl_ms, uint32_t stale_ms)
+{
+    int result;
+    if (
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_013: [ If cache is NULL then h_fabric_query_cache_configure shall fail and return a non-zero value. ]*/
+        (cache == NULL) ||
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_014: [ If api is not a valid H_FABRIC_QUERY_CACHE_API then h_fabric_query_cache_configure shall fail and return a non-zero value. ]*/
+        ((int)api < (int)H_FABRIC_QUERY_CACHE_API_GET_NODE_LIST) ||
+        ((int)api > (int)H_FABRIC_QUERY_CACHE_API_GET_PARTITION_LOAD_INFORMATION) ||
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_039: [ If ttl_ms or stale_ms is greater than INT32_MAX then h_fabric_query_cache_configure shall fail and return a non-zero value. ]*/
+        (ttl_ms > INT32_MAX) ||
+        (stale_ms > INT32_MAX)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_QUERY_CACHE_HANDLE cache=%p, H_FABRIC_QUERY_CACHE_API api=%" PRI_MU_ENUM ", uint32_t ttl_ms=%" PRIu32 ", uint32_t stale_ms=%" PRIu32 "",
+            cache, MU_ENUM_VALUE(H_FABRIC_QUERY_CACHE_API, api), ttl_ms, stale_ms);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_015: [ h_fabric_query_cache_configure shall set ttl_ms and stale_ms for api. The next calls of the query functions shall use them. ]*/
+        (void)interlocked_exchange(&cache->configurations[api].stale_ms, (int32_t)stale_ms);
+        (void)interlocked_exchange(&cache->configurations[api].ttl_ms, (int32_t)ttl_ms);
+
+        /*Codes_SRS_H_FABRIC_QUERY_CACHE_01_016: [ h_fabric_query_cache_configure shall succeed and return 0. ]*/
+        result = 0;
+    }
+    return result;
+}
+
+#define DEFINE_QUERY_CACHE_FUNCTION(api, h_fabric_method_name, description_type, result_interface)                                                                                   \
+HRESULT MU_C2(h_fabric_query_cache_, h_fabric_method_name)(H_FABRIC_QUERY_CACHE_HANDLE cache, const description_type* queryDescription, DWORD timeoutMilliseconds, result_interface** result) \
+{                                                                                                                                                                                  \
+    return query_cache_get(cache, api, queryDescription, timeoutMilliseconds, (IUnknown**)result);                                                                                 \
+}
+
+DEFINE_QUERY_CACHE_FUNCTION(H_FABRIC_QUERY_CACHE_API_GET_NODE_LIST, GetNodeList, FABRIC_NODE_QUERY_DESCRIPTION, IFabricGetNodeListResult)
+DEFINE_QUERY_CACHE_FUNCTION(H_FABRIC_QUERY_CACHE_API_GET_APPLICATION_LIST, GetApplicationList, FABRIC_APPLICATION_QUERY_DESCRIPTION, IFabricGetApplicationListResult)
+DEFINE_QUERY_CACHE_FUNCTION(H_FABRIC_QUERY_CACHE_API_GET_SERVICE_LIST, GetServiceList, FABRIC_SERVICE_QUERY_DESCRIPTION, IFabricGetServiceListResult)
+DEFINE_QUERY_CACHE_FUNCTION(H_FABRIC_QUERY_CACHE_API_GET_PARTITION_LIST, GetPartitionList, FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION, IFabricGetPartitionListResult)
+DEFINE_QUERY_CACHE_FUNCTION(H_FABRIC_QUERY_CACHE_API_GET_NODE_LOAD_INFORMATION, GetNodeLoadInformation, FABRIC_NODE_LOAD_INFORMATION_QUERY_DESCRIPTION, IFabricGetNodeLoadInformationResult)
+DEFINE_QUERY_CACHE_FUNCTION(H_FABRIC_QUERY_CACHE_API_GET_PARTITION_LOAD_INFORMATION, GetPartitionLoadInformation, FABRIC_PARTITION_LOAD_INFORMATION_QUERY_DESCRIPTION, IFabricGetPartitionLoadInformationResult)
+
+HRESULT h_fabric_query_cache_GetClusterLoadInformation(H_FABRIC_QUERY_CACHE_HANDLE cache, DWORD timeoutMilliseconds, IFabricGetClusterLoadInformationResult** result)
+{
+    return query_cache_get(cache, H_FABRIC_QUERY_CACHE_API_GET_CLUSTER_LOAD_INFORMATION, NULL, timeoutMilliseconds, (IUnknown**)result);
+}
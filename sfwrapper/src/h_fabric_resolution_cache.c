@@ -0,0 +1,858 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <wchar.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/srw_lock.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+#include "c_pal/timer.h"
+
+#include "com_wrapper/com_wrapper.h"
+
+#include "sf_c_util/hresult_to_string.h"
+
+#include "hfabricservicemanagementclient6.h"
+#include "h_fabric_resolution_change_handler.h"
+#include "h_fabric_resolution_change_handler_com.h"
+
+#include "h_fabric_resolution_cache.h"
+
+#define RESOLUTION_CACHE_ENTRY_STATE_VALUES \
+    RESOLUTION_CACHE_ENTRY_STATE_STALE, /*there is no result, or the result cannot be handed out without asking SF again*/ \
+    RESOLUTION_CACHE_ENTRY_STATE_RESOLVING, /*one thread is asking SF, everyone else waits for it*/ \
+    RESOLUTION_CACHE_ENTRY_STATE_RESOLVED, /*the result is current and is being watched for changes*/ \
+    RESOLUTION_CACHE_ENTRY_STATE_FAILED /*the last ask failed with last_error*/ \
+
+MU_DEFINE_ENUM(RESOLUTION_CACHE_ENTRY_STATE, RESOLUTION_CACHE_ENTRY_STATE_VALUES)
+
+/*after registering a change handler failed the entry is not registered again for this long, doubling with every failure*/
+#define RESOLUTION_CACHE_WATCH_BACKOFF_MIN_MS 1000
+#define RESOLUTION_CACHE_WATCH_BACKOFF_MAX_MS 60000
+
+typedef struct RESOLUTION_CACHE_KEY_TAG
+{
+    FABRIC_URI name;
+    FABRIC_PARTITION_KEY_TYPE partition_key_type;
+    LONGLONG int64_key;
+    LPCWSTR string_key;
+    uint32_t hash;
+} RESOLUTION_CACHE_KEY;
+
+/*an entry is referenced by its bucket and by every h_fabric_resolution_cache_resolve call that did not find it RESOLVED (a hit only uses it under
+the shared shard lock). An entry nobody but its bucket references can be evicted, the last reference unregisters and closes its change handler and frees it*/
+typedef struct RESOLUTION_CACHE_ENTRY_TAG
+{
+    struct RESOLUTION_CACHE_ENTRY_TAG* next; /*guarded by the shard lock*/
+    uint32_t hash;
+    volatile_atomic int32_t ref_count;
+    volatile_atomic int32_t is_used; /*set by every resolve, cleared by the eviction that notices it*/
+    double last_used_ms; /*guarded by the exclusive shard lock, no older than the last resolve*/
+
+    FABRIC_PARTITION_KEY_TYPE partition_key_type;
+    LONGLONG int64_key;
+    wchar_t* string_key; /*points after name in the same allocation, NULL when the key is not a string*/
+
+    volatile_atomic int32_t state; /*RESOLUTION_CACHE_ENTRY_STATE*/
+    volatile_atomic int32_t changes; /*incremented by every change notification*/
+    HRESULT last_error; /*written before state becomes FAILED*/
+
+    IFabricResolvedServicePartitionResult* result; /*written only by the resolving thread under the exclusive shard lock, read under the shared shard lock*/
+    IFabricServicePartitionResolutionChangeHandler* change_handler; /*NULL until registered, touched only by the resolving thread*/
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler; /*owned by change_handler, kept to close it before the entry is freed*/
+    LONGLONG change_handler_id;
+    uint32_t watch_backoff_ms; /*0 until registering fails, touched only by the resolving thread*/
+    double watch_retry_ms; /*registering is not tried again before this time, touched only by the resolving thread*/
+
+    wchar_t name[];
+} RESOLUTION_CACHE_ENTRY;
+
+typedef struct RESOLUTION_CACHE_SHARD_TAG
+{
+    SRW_LOCK_HANDLE lock;
+    RESOLUTION_CACHE_ENTRY** buckets;
+} RESOLUTION_CACHE_SHARD;
+
+typedef struct H_FABRIC_RESOLUTION_CACHE_TAG
+{
+    H_FABRIC_HANDLE(IFabricServiceManagementClient6) client;
+    THANDLE(THREADPOOL) threadpool; /*releases the evicted entries*/
+    void* volatile_atomic evicted; /*RESOLUTION_CACHE_ENTRY chain (by next) of the evicted entries not released yet*/
+    volatile_atomic int32_t pending_releases; /*work items releasing evicted entries that did not finish yet*/
+    uint32_t idle_ms;
+    uint32_t shard_count;
+    uint32_t buckets_per_shard;
+    RESOLUTION_CACHE_ENTRY** all_buckets;
+    RESOLUTION_CACHE_SHARD shards[];
+} H_FABRIC_RESOLUTION_CACHE;
+
+/*FNV-1a*/
+static uint32_t hash_bytes(uint32_t hash, const void* bytes, size_t size)
+{
+    const unsigned char* p = bytes;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= p[i];
+        hash *= 16777619;
+    }
+    return hash;
+}
+
+static int key_init(RESOLUTION_CACHE_KEY* key, FABRIC_URI name, FABRIC_PARTITION_KEY_TYPE partitionKeyType, const void* partitionKey)
+{
+    int result;
+    uint32_t hash = hash_bytes(2166136261, name, wcslen(name) * sizeof(wchar_t));
+    hash = hash_bytes(hash, &partitionKeyType, sizeof(partitionKeyType));
+
+    key->name = name;
+    key->partition_key_type = partitionKeyType;
+    key->int64_key = 0;
+    key->string_key = NULL;
+
+    switch (partitionKeyType)
+    {
+        case FABRIC_PARTITION_KEY_TYPE_NONE:
+        {
+            result = 0;
+            break;
+        }
+        case FABRIC_PARTITION_KEY_TYPE_INT64:
+        {
+            if (partitionKey == NULL)
+            {
+                result = MU_FAILURE;
+            }
+            else
+            {
+                key->int64_key = *(const LONGLONG*)partitionKey;
+                hash = hash_bytes(hash, &key->int64_key, sizeof(key->int64_key));
+                result = 0;
+            }
+            break;
+        }
+        case FABRIC_PARTITION_KEY_TYPE_STRING:
+        {
+            if (partitionKey == NULL)
+            {
+                result = MU_FAILURE;
+            }
+            else
+            {
+                key->string_key = partitionKey;
+                hash = hash_bytes(hash, key->string_key, wcslen(key->string_key) * sizeof(wchar_t));
+                result = 0;
+            }
+            break;
+        }
+        default:
+        {
+            result = MU_FAILURE;
+            break;
+        }
+    }
+
+    key->hash = hash;
+    return result;
+}
+
+static RESOLUTION_CACHE_SHARD* get_shard(H_FABRIC_RESOLUTION_CACHE* cache, const RESOLUTION_CACHE_KEY* key)
+{
+    return &cache->shards[key->hash % cache->shard_count];
+}
+
+static RESOLUTION_CACHE_ENTRY** get_bucket(H_FABRIC_RESOLUTION_CACHE* cache, RESOLUTION_CACHE_SHARD* shard, const RESOLUTION_CACHE_KEY* key)
+{
+    return &shard->buckets[(key->hash / cache->shard_count) % cache->buckets_per_shard];
+}
+
+/*the shard lock is held by the caller*/
+static RESOLUTION_CACHE_ENTRY* find_entry(RESOLUTION_CACHE_ENTRY* bucket, const RESOLUTION_CACHE_KEY* key)
+{
+    RESOLUTION_CACHE_ENTRY* entry;
+    for (entry = bucket; entry != NULL; entry = entry->next)
+    {
+        if (
+            (entry->hash == key->hash) &&
+            (entry->partition_key_type == key->partition_key_type) &&
+            (entry->int64_key == key->int64_key) &&
+            (wcscmp(entry->name, key->name) == 0) &&
+            ((entry->string_key == NULL) || (wcscmp(entry->string_key, key->string_key) == 0))
+            )
+        {
+            break;
+        }
+    }
+    return entry;
+}
+
+static RESOLUTION_CACHE_ENTRY* entry_create(const RESOLUTION_CACHE_KEY* key, double now)
+{
+    RESOLUTION_CACHE_ENTRY* result;
+    size_t name_length = wcslen(key->name) + 1;
+    size_t string_key_length = (key->string_key == NULL) ? 0 : wcslen(key->string_key) + 1;
+
+    result = malloc_flex(sizeof(RESOLUTION_CACHE_ENTRY), name_length + string_key_length, sizeof(wchar_t));
+    if (result == NULL)
+    {
+        LogError("failure in malloc_flex(sizeof(RESOLUTION_CACHE_ENTRY)=%zu, %zu + %zu, sizeof(wchar_t)=%zu)", sizeof(RESOLUTION_CACHE_ENTRY), name_length, string_key_length, sizeof(wchar_t));
+        /*return as is*/
+    }
+    else
+    {
+        result->next = NULL;
+        result->hash = key->hash;
+        (void)interlocked_exchange(&result->ref_count, 1); /*the bucket*/
+        (void)interlocked_exchange(&result->is_used, 0);
+        result->last_used_ms = now;
+        result->partition_key_type = key->partition_key_type;
+        result->int64_key = key->int64_key;
+        (void)memcpy(result->name, key->name, name_length * sizeof(wchar_t));
+        if (key->string_key == NULL)
+        {
+            result->string_key = NULL;
+        }
+        else
+        {
+            result->string_key = result->name + name_length;
+            (void)memcpy(result->string_key, key->string_key, string_key_length * sizeof(wchar_t));
+        }
+        (void)interlocked_exchange(&result->state, RESOLUTION_CACHE_ENTRY_STATE_STALE);
+        (void)interlocked_exchange(&result->changes, 0);
+        result->last_error = S_OK;
+        result->result = NULL;
+        result->change_handler = NULL;
+        result->handler = NULL;
+        result->change_handler_id = 0;
+        result->watch_backoff_ms = 0;
+        result->watch_retry_ms = 0;
+    }
+    return result;
+}
+
+static const void* entry_get_partition_key(RESOLUTION_CACHE_ENTRY* entry)
+{
+    const void* result;
+    switch (entry->partition_key_type)
+    {
+        case FABRIC_PARTITION_KEY_TYPE_INT64:
+        {
+            result = &entry->int64_key;
+            break;
+        }
+        case FABRIC_PARTITION_KEY_TYPE_STRING:
+        {
+            result = entry->string_key;
+            break;
+        }
+        default:
+        {
+            result = NULL;
+            break;
+        }
+    }
+    return result;
+}
+
+static void on_resolution_change(void* context, LONGLONG handlerId, IFabricResolvedServicePartitionResult* partition, HRESULT error)
+{
+    RESOLUTION_CACHE_ENTRY* entry = context;
+    (void)handlerId;
+    (void)partition;
+    (void)error;
+
+    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_030: [ When the resolution of a partition changes, h_fabric_resolution_cache shall increment the number of changes of the entry and switch it from RESOLVED to STALE. ]*/
+    (void)interlocked_increment(&entry->changes);
+    (void)interlocked_compare_exchange(&entry->state, RESOLUTION_CACHE_ENTRY_STATE_STALE, RESOLUTION_CACHE_ENTRY_STATE_RESOLVED);
+}
+
+static int entry_watch(H_FABRIC_RESOLUTION_CACHE* cache, RESOLUTION_CACHE_ENTRY* entry)
+{
+    int result;
+    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_019: [ Otherwise, if the entry is not watched for changes yet, h_fabric_resolution_cache_resolve shall create a change handler by calling h_fabric_resolution_change_handler_create and COM_WRAPPER_CREATE. ]*/
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler = h_fabric_resolution_change_handler_create(on_resolution_change, entry);
+    if (handler == NULL)
+    {
+        LogError("failure in h_fabric_resolution_change_handler_create(on_resolution_change=%p, entry=%p)", on_resolution_change, entry);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        IFabricServicePartitionResolutionChangeHandler* change_handler = COM_WRAPPER_CREATE(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE, IFabricServicePartitionResolutionChangeHandler, handler, h_fabric_resolution_change_handler_destroy);
+        if (change_handler == NULL)
+        {
+            LogError("failure in COM_WRAPPER_CREATE");
+            h_fabric_resolution_change_handler_destroy(handler);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_020: [ h_fabric_resolution_cache_resolve shall register the change handler by calling H_FABRIC_API(FSMC6_RegisterServicePartitionResolutionChangeHandler). ]*/
+            HRESULT hr = H_FABRIC_API(FSMC6_RegisterServicePartitionResolutionChangeHandler)(cache->client, entry->name, entry->partition_key_type, entry_get_partition_key(entry), change_handler, &entry->change_handler_id);
+            if (FAILED(hr))
+            {
+                LogHRESULTError(hr, "failure in H_FABRIC_API(FSMC6_RegisterServicePartitionResolutionChangeHandler)(cache->client=%p, name=%ls, ...)", cache->client, entry->name);
+                (void)change_handler->lpVtbl->Release(change_handler);
+                result = MU_FAILURE;
+            }
+            else
+            {
+                entry->change_handler = change_handler;
+                entry->handler = handler;
+                result = 0;
+            }
+        }
+    }
+    return result;
+}
+
+/*only called by the thread that switched the entry to RESOLVING*/
+static HRESULT entry_resolve(H_FABRIC_RESOLUTION_CACHE* cache, RESOLUTION_CACHE_SHARD* shard, RESOLUTION_CACHE_ENTRY* entry, DWORD timeoutMilliseconds, IFabricResolvedServicePartitionResult** resolveServicePartitionResult)
+{
+    HRESULT hr;
+
+    bool is_watched;
+    if (entry->change_handler != NULL)
+    {
+        is_watched = true;
+    }
+    else
+    {
+        double now = timer_global_get_elapsed_ms();
+        if (now < entry->watch_retry_ms)
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_051: [ If the entry is not watched for changes yet and registering its change handler failed less than the backoff of the entry ago (measured by timer_global_get_elapsed_ms), h_fabric_resolution_cache_resolve shall not register it. ]*/
+            is_watched = false;
+        }
+        else if (entry_watch(cache, entry) != 0)
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_021: [ If registering the change handler fails then h_fabric_resolution_cache_resolve shall still resolve the partition, but the result shall not be served from the cache. ]*/
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_052: [ If registering the change handler fails then h_fabric_resolution_cache_resolve shall double the backoff of the entry (starting at 1 second, up to 1 minute). ]*/
+            entry->watch_backoff_ms =
+                (entry->watch_backoff_ms == 0) ? RESOLUTION_CACHE_WATCH_BACKOFF_MIN_MS :
+                (entry->watch_backoff_ms >= RESOLUTION_CACHE_WATCH_BACKOFF_MAX_MS / 2) ? RESOLUTION_CACHE_WATCH_BACKOFF_MAX_MS :
+                entry->watch_backoff_ms * 2;
+            entry->watch_retry_ms = now + entry->watch_backoff_ms;
+            is_watched = false;
+        }
+        else
+        {
+            is_watched = true;
+        }
+    }
+    int32_t changes = interlocked_add(&entry->changes, 0);
+
+    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_022: [ h_fabric_resolution_cache_resolve shall call H_FABRIC_API(FSMC6_ResolveServicePartition) passing the result cached so far (if any) as previousResult. ]*/
+    IFabricResolvedServicePartitionResult* previous = entry->result;
+    IFabricResolvedServicePartitionResult* resolved;
+    hr = H_FABRIC_API(FSMC6_ResolveServicePartition)(cache->client, entry->name, entry->partition_key_type, entry_get_partition_key(entry), previous, timeoutMilliseconds, &resolved);
+    if (FAILED(hr))
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_023: [ If H_FABRIC_API(FSMC6_ResolveServicePartition) fails then h_fabric_resolution_cache_resolve shall record the error, switch the entry to FAILED and return the error. ]*/
+        LogHRESULTError(hr, "failure in H_FABRIC_API(FSMC6_ResolveServicePartition)(cache->client=%p, name=%ls, ...)", cache->client, entry->name);
+        entry->last_error = hr;
+        (void)interlocked_exchange(&entry->state, RESOLUTION_CACHE_ENTRY_STATE_FAILED);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_024: [ h_fabric_resolution_cache_resolve shall replace the cached result with the new one under the exclusive shard lock and release the previous result. ]*/
+        srw_lock_acquire_exclusive(shard->lock);
+        entry->result = resolved;
+        srw_lock_release_exclusive(shard->lock);
+
+        if (previous != NULL)
+        {
+            (void)previous->lpVtbl->Release(previous);
+        }
+
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_025: [ h_fabric_resolution_cache_resolve shall AddRef the new result and return it in resolveServicePartitionResult. ]*/
+        (void)resolved->lpVtbl->AddRef(resolved);
+        *resolveServicePartitionResult = resolved;
+
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_026: [ If the entry is watched for changes and no change was notified while resolving, h_fabric_resolution_cache_resolve shall switch the entry to RESOLVED, otherwise to STALE. ]*/
+        (void)interlocked_exchange(&entry->state,
+            (is_watched && (interlocked_add(&entry->changes, 0) == changes)) ? RESOLUTION_CACHE_ENTRY_STATE_RESOLVED : RESOLUTION_CACHE_ENTRY_STATE_STALE);
+    }
+
+    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_027: [ h_fabric_resolution_cache_resolve shall wake all the threads waiting for the entry. ]*/
+    wake_by_address_all(&entry->state);
+
+    return hr;
+}
+
+static void entry_get_result(RESOLUTION_CACHE_SHARD* shard, RESOLUTION_CACHE_ENTRY* entry, IFabricResolvedServicePartitionResult** resolveServicePartitionResult)
+{
+    srw_lock_acquire_shared(shard->lock);
+    (void)entry->result->lpVtbl->AddRef(entry->result);
+    *resolveServicePartitionResult = entry->result;
+    srw_lock_release_shared(shard->lock);
+}
+
+static void entry_destroy(H_FABRIC_RESOLUTION_CACHE* cache, RESOLUTION_CACHE_ENTRY* entry)
+{
+    if (entry->change_handler != NULL)
+    {
+        HRESULT hr = H_FABRIC_API(FSMC6_UnregisterServicePartitionResolutionChangeHandler)(cache->client, entry->change_handler_id);
+        if (FAILED(hr))
+        {
+            LogHRESULTError(hr, "failure in H_FABRIC_API(FSMC6_UnregisterServicePartitionResolutionChangeHandler)(cache->client=%p, entry->change_handler_id=%" PRId64 ")", cache->client, (int64_t)entry->change_handler_id);
+        }
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_039: [ h_fabric_resolution_cache_destroy shall close the change handler of each entry by calling h_fabric_resolution_change_handler_close before freeing the entry. ]*/
+        /*a notification that SF started delivering before the unregister is waited for here, later ones are ignored*/
+        h_fabric_resolution_change_handler_close(entry->handler);
+        (void)entry->change_handler->lpVtbl->Release(entry->change_handler);
+    }
+
+    if (entry->result != NULL)
+    {
+        (void)entry->result->lpVtbl->Release(entry->result);
+    }
+
+    free(entry);
+}
+
+static void entry_dec_ref(H_FABRIC_RESOLUTION_CACHE* cache, RESOLUTION_CACHE_ENTRY* entry)
+{
+    if (interlocked_decrement(&entry->ref_count) == 0)
+    {
+        entry_destroy(cache, entry);
+    }
+}
+
+/*the shard lock is held exclusively by the caller. An entry that only its bucket references is neither resolved nor waited for*/
+static bool entry_is_evictable(H_FABRIC_RESOLUTION_CACHE* cache, RESOLUTION_CACHE_ENTRY* entry, double now)
+{
+    bool result;
+    if (interlocked_add(&entry->ref_count, 0) != 1)
+    {
+        result = false;
+    }
+    else if (entry->result == NULL)
+    {
+        /*never resolved or only failed, there is nothing to hand out*/
+        result = true;
+    }
+    else if (interlocked_exchange(&entry->is_used, 0) != 0)
+    {
+        /*resolved since the last look, it was in use at least until now*/
+        entry->last_used_ms = now;
+        result = false;
+    }
+    else
+    {
+        result = (now - entry->last_used_ms >= (double)cache->idle_ms);
+    }
+    return result;
+}
+
+/*the shard lock is held exclusively by the caller, the evicted entries are chained in evicted (by next) to be released once the lock is released*/
+static void bucket_evict(H_FABRIC_RESOLUTION_CACHE* cache, RESOLUTION_CACHE_ENTRY** bucket, double now, RESOLUTION_CACHE_ENTRY** evicted)
+{
+    RESOLUTION_CACHE_ENTRY** link = bucket;
+    while (*link != NULL)
+    {
+        RESOLUTION_CACHE_ENTRY* entry = *link;
+        if (entry_is_evictable(cache, entry, now))
+        {
+            *link = entry->next;
+            entry->next = *evicted;
+            *evicted = entry;
+        }
+        else
+        {
+            link = &entry->next;
+        }
+    }
+}
+
+/*releases the evicted entries of the cache, only their chain (taken as a whole) references them*/
+static void release_evicted_entries(H_FABRIC_RESOLUTION_CACHE* cache)
+{
+    RESOLUTION_CACHE_ENTRY* entry = interlocked_exchange_pointer(&cache->evicted, NULL);
+    while (entry != NULL)
+    {
+        RESOLUTION_CACHE_ENTRY* next = entry->next;
+        entry_dec_ref(cache, entry);
+        entry = next;
+    }
+}
+
+static void release_evicted_entries_work(void* context)
+{
+    H_FABRIC_RESOLUTION_CACHE* cache = context;
+
+    release_evicted_entries(cache);
+
+    if (interlocked_decrement(&cache->pending_releases) == 0)
+    {
+        wake_by_address_single(&cache->pending_releases);
+    }
+}
+
+/*unregistering a change handler goes to the naming gateway, so the thread that evicted the entries on its resolve path hands them to threadpool*/
+static void release_evicted_entries_async(H_FABRIC_RESOLUTION_CACHE* cache, RESOLUTION_CACHE_ENTRY* evicted)
+{
+    RESOLUTION_CACHE_ENTRY* last = evicted;
+    while (last->next != NULL)
+    {
+        last = last->next;
+    }
+
+    void* head;
+    do
+    {
+        head = interlocked_compare_exchange_pointer(&cache->evicted, NULL, NULL);
+        last->next = head;
+    } while (interlocked_compare_exchange_pointer(&cache->evicted, evicted, head) != head);
+
+    (void)interlocked_increment(&cache->pending_releases);
+    if (threadpool_schedule_work(cache->threadpool, release_evicted_entries_work, cache) != 0)
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_049: [ If threadpool_schedule_work fails then h_fabric_resolution_cache_resolve shall leave the evicted entries to the next work item or to h_fabric_resolution_cache_destroy. ]*/
+        LogError("failure in threadpool_schedule_work(cache->threadpool=%p, release_evicted_entries_work=%p, cache=%p), the evicted entries are released later",
+            cache->threadpool, release_evicted_entries_work, cache);
+        (void)interlocked_decrement(&cache->pending_releases);
+    }
+}
+
+H_FABRIC_RESOLUTION_CACHE_HANDLE h_fabric_resolution_cache_create(H_FABRIC_HANDLE(IFabricServiceManagementClient6) client, THANDLE(THREADPOOL) threadpool, uint32_t shard_count, uint32_t buckets_per_shard, uint32_t idle_ms)
+{
+    H_FABRIC_RESOLUTION_CACHE_HANDLE result;
+    if (
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_001: [ If client is NULL then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+        (client == NULL) ||
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_044: [ If threadpool is NULL then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+        (threadpool == NULL) ||
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_002: [ If shard_count is 0 then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+        (shard_count == 0) ||
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_003: [ If buckets_per_shard is 0 then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+        (buckets_per_shard == 0) ||
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_040: [ If idle_ms is 0 then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+        (idle_ms == 0)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_HANDLE(IFabricServiceManagementClient6) client=%p, THANDLE(THREADPOOL) threadpool=%p, uint32_t shard_count=%" PRIu32 ", uint32_t buckets_per_shard=%" PRIu32 ", uint32_t idle_ms=%" PRIu32 "",
+            client, threadpool, shard_count, buckets_per_shard, idle_ms);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_004: [ h_fabric_resolution_cache_create shall allocate memory for the cache and its shard_count shards. ]*/
+        result = malloc_flex(sizeof(H_FABRIC_RESOLUTION_CACHE), shard_count, sizeof(RESOLUTION_CACHE_SHARD));
+        if (result == NULL)
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_008: [ If there are any failures then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+            LogError("failure in malloc_flex(sizeof(H_FABRIC_RESOLUTION_CACHE)=%zu, shard_count=%" PRIu32 ", sizeof(RESOLUTION_CACHE_SHARD)=%zu)",
+                sizeof(H_FABRIC_RESOLUTION_CACHE), shard_count, sizeof(RESOLUTION_CACHE_SHARD));
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_005: [ h_fabric_resolution_cache_create shall allocate shard_count * buckets_per_shard empty buckets. ]*/
+            result->all_buckets = calloc((size_t)shard_count * buckets_per_shard, sizeof(RESOLUTION_CACHE_ENTRY*));
+            if (result->all_buckets == NULL)
+            {
+                /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_008: [ If there are any failures then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+                LogError("failure in calloc(shard_count=%" PRIu32 " * buckets_per_shard=%" PRIu32 ", sizeof(RESOLUTION_CACHE_ENTRY*)=%zu)",
+                    shard_count, buckets_per_shard, sizeof(RESOLUTION_CACHE_ENTRY*));
+            }
+            else
+            {
+                uint32_t i;
+                for (i = 0; i < shard_count; i++)
+                {
+                    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_006: [ h_fabric_resolution_cache_create shall create a lock for each shard by calling srw_lock_create. ]*/
+                    result->shards[i].lock = srw_lock_create(false, "h_fabric_resolution_cache");
+                    if (result->shards[i].lock == NULL)
+                    {
+                        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_008: [ If there are any failures then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+                        LogError("failure in srw_lock_create(false, \"h_fabric_resolution_cache\"), shard %" PRIu32 "", i);
+                        break;
+                    }
+                    result->shards[i].buckets = result->all_buckets + (size_t)i * buckets_per_shard;
+                }
+
+                if (i < shard_count)
+                {
+                    while (i > 0)
+                    {
+                        i--;
+                        srw_lock_destroy(result->shards[i].lock);
+                    }
+                }
+                else
+                {
+                    result->client = client;
+                    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_045: [ h_fabric_resolution_cache_create shall keep a reference on threadpool by calling THANDLE_INITIALIZE(THREADPOOL). ]*/
+                    THANDLE_INITIALIZE(THREADPOOL)(&result->threadpool, threadpool);
+                    (void)interlocked_exchange_pointer(&result->evicted, NULL);
+                    (void)interlocked_exchange(&result->pending_releases, 0);
+                    result->idle_ms = idle_ms;
+                    result->shard_count = shard_count;
+                    result->buckets_per_shard = buckets_per_shard;
+
+                    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_007: [ h_fabric_resolution_cache_create shall succeed and return a non-NULL handle. ]*/
+                    goto allok;
+                }
+                free(result->all_buckets);
+            }
+            free(result);
+        }
+    }
+    result = NULL;
+allok:;
+    return result;
+}
+
+void h_fabric_resolution_cache_destroy(H_FABRIC_RESOLUTION_CACHE_HANDLE cache)
+{
+    if (cache == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_009: [ If cache is NULL then h_fabric_resolution_cache_destroy shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_RESOLUTION_CACHE_HANDLE cache=%p", cache);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_046: [ h_fabric_resolution_cache_destroy shall wait for the work items releasing evicted entries to finish by calling InterlockedHL_WaitForValue. ]*/
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&cache->pending_releases, 0, UINT32_MAX);
+        if (wait_result != INTERLOCKED_HL_OK)
+        {
+            LogError("failure in InterlockedHL_WaitForValue(&cache->pending_releases=%p, 0, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d", &cache->pending_releases, (int)wait_result);
+        }
+
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_047: [ h_fabric_resolution_cache_destroy shall release the evicted entries that no work item released (because scheduling it failed) like the entries of the buckets. ]*/
+        release_evicted_entries(cache);
+
+        for (uint32_t i = 0; i < cache->shard_count; i++)
+        {
+            for (uint32_t j = 0; j < cache->buckets_per_shard; j++)
+            {
+                RESOLUTION_CACHE_ENTRY* entry = cache->shards[i].buckets[j];
+                while (entry != NULL)
+                {
+                    RESOLUTION_CACHE_ENTRY* next = entry->next;
+                    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_010: [ For each entry, h_fabric_resolution_cache_destroy shall unregister its change handler by calling H_FABRIC_API(FSMC6_UnregisterServicePartitionResolutionChangeHandler) and release it. ]*/
+                    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_011: [ For each entry, h_fabric_resolution_cache_destroy shall release the cached result and free the entry. ]*/
+                    /*no call is in progress, the bucket holds the last reference*/
+                    entry_dec_ref(cache, entry);
+                    entry = next;
+                }
+            }
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_012: [ h_fabric_resolution_cache_destroy shall destroy the shard locks and free the memory used by the cache. ]*/
+            srw_lock_destroy(cache->shards[i].lock);
+        }
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_048: [ h_fabric_resolution_cache_destroy shall release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL. ]*/
+        THANDLE_ASSIGN(THREADPOOL)(&cache->threadpool, NULL);
+        free(cache->all_buckets);
+        free(cache);
+    }
+}
+
+HRESULT h_fabric_resolution_cache_resolve(H_FABRIC_RESOLUTION_CACHE_HANDLE cache, FABRIC_URI name, FABRIC_PARTITION_KEY_TYPE partitionKeyType, const void* partitionKey, DWORD timeoutMilliseconds, IFabricResolvedServicePartitionResult** resolveServicePartitionResult)
+{
+    HRESULT result;
+    RESOLUTION_CACHE_KEY key;
+    if (
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_013: [ If cache is NULL then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+        (cache == NULL) ||
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_014: [ If name is NULL then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+        (name == NULL) ||
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_015: [ If resolveServicePartitionResult is NULL then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+        (resolveServicePartitionResult == NULL) ||
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_016: [ If partitionKeyType is not FABRIC_PARTITION_KEY_TYPE_NONE, FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, or partitionKey is NULL for FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+        (key_init(&key, name, partitionKeyType, partitionKey) != 0)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_RESOLUTION_CACHE_HANDLE cache=%p, FABRIC_URI name=%ls, FABRIC_PARTITION_KEY_TYPE partitionKeyType=%d, const void* partitionKey=%p, DWORD timeoutMilliseconds=%lu, IFabricResolvedServicePartitionResult** resolveServicePartitionResult=%p",
+            cache, MU_WP_OR_NULL(name), (int)partitionKeyType, partitionKey, timeoutMilliseconds, resolveServicePartitionResult);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        RESOLUTION_CACHE_SHARD* shard = get_shard(cache, &key);
+        RESOLUTION_CACHE_ENTRY** bucket = get_bucket(cache, shard, &key);
+        RESOLUTION_CACHE_ENTRY* entry;
+        bool is_hit = false;
+
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_017: [ h_fabric_resolution_cache_resolve shall look up the entry for name and partitionKey in its shard under the shared shard lock and, if the entry is RESOLVED, AddRef the cached result, return it in resolveServicePartitionResult and return S_OK. ]*/
+        srw_lock_acquire_shared(shard->lock);
+        entry = find_entry(*bucket, &key);
+        if (entry != NULL)
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_041: [ h_fabric_resolution_cache_resolve shall mark the entry as used. ]*/
+            /*only the first resolve after an eviction looked at the entry writes its cache line, the others only load it*/
+            if (ReadAcquire((volatile LONG*)&entry->is_used) == 0)
+            {
+                (void)interlocked_exchange(&entry->is_used, 1);
+            }
+
+            if (ReadAcquire((volatile LONG*)&entry->state) == RESOLUTION_CACHE_ENTRY_STATE_RESOLVED)
+            {
+                (void)entry->result->lpVtbl->AddRef(entry->result);
+                *resolveServicePartitionResult = entry->result;
+                is_hit = true;
+            }
+            else
+            {
+                /*the call holds a reference to the entry until it returns*/
+                (void)interlocked_increment(&entry->ref_count);
+            }
+        }
+        srw_lock_release_shared(shard->lock);
+
+        if (is_hit)
+        {
+            result = S_OK;
+        }
+        else
+        {
+            if (entry == NULL)
+            {
+                RESOLUTION_CACHE_ENTRY* evicted = NULL;
+                double now = timer_global_get_elapsed_ms();
+
+                /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_018: [ If there is no entry, h_fabric_resolution_cache_resolve shall add a STALE entry for name and partitionKey under the exclusive shard lock (unless another thread added it meanwhile). ]*/
+                srw_lock_acquire_exclusive(shard->lock);
+                entry = find_entry(*bucket, &key);
+                if (entry == NULL)
+                {
+                    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_042: [ Before adding an entry, h_fabric_resolution_cache_resolve shall evict from its bucket the entries that no other call is using and that have no result or were not resolved for idle_ms. ]*/
+                    bucket_evict(cache, bucket, now, &evicted);
+
+                    entry = entry_create(&key, now);
+                    if (entry != NULL)
+                    {
+                        entry->next = *bucket;
+                        *bucket = entry;
+                    }
+                }
+                if (entry != NULL)
+                {
+                    (void)interlocked_increment(&entry->ref_count);
+                }
+                srw_lock_release_exclusive(shard->lock);
+
+                if (evicted != NULL)
+                {
+                    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_043: [ Once the exclusive shard lock is released, h_fabric_resolution_cache_resolve shall add the evicted entries to the evicted entries of the cache and call threadpool_schedule_work with a work item that unregisters and closes the change handlers of the evicted entries, releases their results and frees them. ]*/
+                    release_evicted_entries_async(cache, evicted);
+                }
+            }
+
+            if (entry == NULL)
+            {
+                /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_031: [ If there are any failures then h_fabric_resolution_cache_resolve shall fail and return an error. ]*/
+                LogError("failure in entry_create for name=%ls", name);
+                result = E_OUTOFMEMORY;
+            }
+            else
+            {
+                bool has_waited = false;
+                for (;;)
+                {
+                    int32_t state = interlocked_add(&entry->state, 0);
+                    if (state == RESOLUTION_CACHE_ENTRY_STATE_RESOLVED)
+                    {
+                        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_029: [ If the entry became RESOLVED then h_fabric_resolution_cache_resolve shall AddRef the cached result, return it in resolveServicePartitionResult and return S_OK. ]*/
+                        entry_get_result(shard, entry, resolveServicePartitionResult);
+                        result = S_OK;
+                        break;
+                    }
+                    else if (state == RESOLUTION_CACHE_ENTRY_STATE_RESOLVING)
+                    {
+                        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_028: [ If another thread is resolving the entry then h_fabric_resolution_cache_resolve shall wait for it by calling InterlockedHL_WaitForNotValue. ]*/
+                        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForNotValue(&entry->state, RESOLUTION_CACHE_ENTRY_STATE_RESOLVING, UINT32_MAX);
+                        if (wait_result != INTERLOCKED_HL_OK)
+                        {
+                            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_031: [ If there are any failures then h_fabric_resolution_cache_resolve shall fail and return an error. ]*/
+                            LogError("failure in InterlockedHL_WaitForNotValue(&entry->state=%p, RESOLUTION_CACHE_ENTRY_STATE_RESOLVING, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d", &entry->state, (int)wait_result);
+                            result = E_FAIL;
+                            break;
+                        }
+                        has_waited = true;
+                    }
+                    else if ((state == RESOLUTION_CACHE_ENTRY_STATE_FAILED) && has_waited)
+                    {
+                        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_032: [ If the thread that was waited for failed then h_fabric_resolution_cache_resolve shall return the same error without asking SF again. ]*/
+                        result = entry->last_error;
+                        break;
+                    }
+                    else if ((state == RESOLUTION_CACHE_ENTRY_STATE_STALE) && has_waited)
+                    {
+                        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_050: [ If the thread that was waited for succeeded but left the entry STALE (it is not watched, or it changed meanwhile) then h_fabric_resolution_cache_resolve shall AddRef the result of that thread, return it in resolveServicePartitionResult and return S_OK without asking SF again. ]*/
+                        /*only a successful resolve leaves RESOLVING for STALE, so there is a result*/
+                        entry_get_result(shard, entry, resolveServicePartitionResult);
+                        result = S_OK;
+                        break;
+                    }
+                    /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_033: [ Otherwise h_fabric_resolution_cache_resolve shall switch the entry to RESOLVING. ]*/
+                    else if (interlocked_compare_exchange(&entry->state, RESOLUTION_CACHE_ENTRY_STATE_RESOLVING, state) == state)
+                    {
+                        /*this thread resolves on behalf of everyone asking for this partition*/
+                        result = entry_resolve(cache, shard, entry, timeoutMilliseconds, resolveServicePartitionResult);
+                        break;
+                    }
+                    else
+                    {
+                        /*someone else changed the state, look again*/
+                    }
+                }
+
+                entry_dec_ref(cache, entry);
+            }
+        }
+    }
+    return result;
+}
+
+int h_fabric_resolution_cache_invalidate(H_FABRIC_RESOLUTION_CACHE_HANDLE cache, FABRIC_URI name, FABRIC_PARTITION_KEY_TYPE partitionKeyType, const void* partitionKey)
+{
+    int result;
+    RESOLUTION_CACHE_KEY key;
+    if (
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_034: [ If cache is NULL then h_fabric_resolution_cache_invalidate shall fail and return a non-zero value. ]*/
+        (cache == NULL) ||
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_035: [ If name is NULL then h_fabric_resolution_cache_invalidate shall fail and return a non-zero value. ]*/
+        (name == NULL) ||
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_036: [ If partitionKeyType or partitionKey are invalid then h_fabric_resolution_cache_invalidate shall fail and return a non-zero value. ]*/
+        (key_init(&key, name, partitionKeyType, partitionKey) != 0)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_RESOLUTION_CACHE_HANDLE cache=%p, FABRIC_URI name=%ls, FABRIC_PARTITION_KEY_TYPE partitionKeyType=%d, const void* partitionKey=%p",
+            cache, MU_WP_OR_NULL(name), (int)partitionKeyType, partitionKey);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        RESOLUTION_CACHE_SHARD* shard = get_shard(cache, &key);
+        RESOLUTION_CACHE_ENTRY* entry;
+
+        srw_lock_acquire_shared(shard->lock);
+        entry = find_entry(*get_bucket(cache, shard, &key), &key);
+        if (entry != NULL)
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_037: [ If the entry for name and partitionKey is RESOLVED then h_fabric_resolution_cache_invalidate shall switch it to STALE, so that the next h_fabric_resolution_cache_resolve asks SF again passing the cached result as previousResult. ]*/
+            (void)interlocked_compare_exchange(&entry->state, RESOLUTION_CACHE_ENTRY_STATE_STALE, RESOLUTION_CACHE_ENTRY_STATE_RESOLVED);
+        }
+        srw_lock_release_shared(shard->lock);
+
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CACHE_01_038: [ h_fabric_resolution_cache_invalidate shall succeed and return 0. ]*/
+        result = 0;
+    }
+    return result;
+}
@@ -0,0 +1,162 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+
+#include "c_util/sm.h"
+
+#include "h_fabric_resolution_change_handler.h"
+
+typedef struct H_FABRIC_RESOLUTION_CHANGE_HANDLER_TAG
+{
+    ON_RESOLUTION_CHANGE on_resolution_change;
+    void* on_resolution_change_context;
+    SM_HANDLE sm; /*closed once h_fabric_resolution_change_handler_close was called, on_resolution_change_context might be gone*/
+} H_FABRIC_RESOLUTION_CHANGE_HANDLER;
+
+H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE h_fabric_resolution_change_handler_create(ON_RESOLUTION_CHANGE on_resolution_change, void* on_resolution_change_context)
+{
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE result;
+
+    /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_002: [ on_resolution_change_context shall be allowed to be NULL. ]*/
+
+    if (on_resolution_change == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_001: [ If on_resolution_change is NULL, h_fabric_resolution_change_handler_create shall fail and return NULL. ]*/
+        LogError("Invalid arguments: ON_RESOLUTION_CHANGE on_resolution_change=%p, void* on_resolution_change_context=%p",
+            on_resolution_change, on_resolution_change_context);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_003: [ Otherwise, h_fabric_resolution_change_handler_create shall allocate a new change handler instance and on success return a non-NULL pointer to it. ]*/
+        result = malloc(sizeof(H_FABRIC_RESOLUTION_CHANGE_HANDLER));
+        if (result == NULL)
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_004: [ If any error occurs, h_fabric_resolution_change_handler_create shall fail and return NULL. ]*/
+            LogError("failure in malloc(sizeof(H_FABRIC_RESOLUTION_CHANGE_HANDLER)=%zu)", sizeof(H_FABRIC_RESOLUTION_CHANGE_HANDLER));
+        }
+        else
+        {
+            result->on_resolution_change = on_resolution_change;
+            result->on_resolution_change_context = on_resolution_change_context;
+
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_014: [ h_fabric_resolution_change_handler_create shall create a state machine by calling sm_create. ]*/
+            result->sm = sm_create("h_fabric_resolution_change_handler");
+            if (result->sm == NULL)
+            {
+                /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_004: [ If any error occurs, h_fabric_resolution_change_handler_create shall fail and return NULL. ]*/
+                LogError("failure in sm_create(\"h_fabric_resolution_change_handler\")");
+            }
+            else
+            {
+                /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_015: [ h_fabric_resolution_change_handler_create shall open the state machine by calling sm_open_begin and sm_open_end. ]*/
+                SM_RESULT open_result = sm_open_begin(result->sm);
+                if (open_result != SM_EXEC_GRANTED)
+                {
+                    /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_004: [ If any error occurs, h_fabric_resolution_change_handler_create shall fail and return NULL. ]*/
+                    LogError("failure in sm_open_begin(result->sm=%p), SM_RESULT open_result=%" PRI_MU_ENUM "",
+                        result->sm, MU_ENUM_VALUE(SM_RESULT, open_result));
+                }
+                else
+                {
+                    sm_open_end(result->sm, true);
+
+                    goto all_ok;
+                }
+                sm_destroy(result->sm);
+            }
+            free(result);
+        }
+    }
+
+    result = NULL;
+
+all_ok:
+    return result;
+}
+
+void h_fabric_resolution_change_handler_destroy(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE h_fabric_resolution_change_handler)
+{
+    if (h_fabric_resolution_change_handler == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_005: [ If h_fabric_resolution_change_handler is NULL, h_fabric_resolution_change_handler_destroy shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE h_fabric_resolution_change_handler=%p", h_fabric_resolution_change_handler);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_016: [ Otherwise, h_fabric_resolution_change_handler_destroy shall destroy the state machine by calling sm_destroy. ]*/
+        sm_destroy(h_fabric_resolution_change_handler->sm);
+
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_006: [ h_fabric_resolution_change_handler_destroy shall free the memory allocated in h_fabric_resolution_change_handler_create. ]*/
+        free(h_fabric_resolution_change_handler);
+    }
+}
+
+void h_fabric_resolution_change_handler_close(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE h_fabric_resolution_change_handler)
+{
+    if (h_fabric_resolution_change_handler == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_009: [ If h_fabric_resolution_change_handler is NULL, h_fabric_resolution_change_handler_close shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE h_fabric_resolution_change_handler=%p", h_fabric_resolution_change_handler);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_010: [ Otherwise, h_fabric_resolution_change_handler_close shall make the changes that arrive from now on not call on_resolution_change and wait for the calls to on_resolution_change in progress to finish by calling sm_close_begin. ]*/
+        SM_RESULT close_result = sm_close_begin(h_fabric_resolution_change_handler->sm);
+        if (close_result != SM_EXEC_GRANTED)
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_017: [ If sm_close_begin does not return SM_EXEC_GRANTED then h_fabric_resolution_change_handler_close shall return. ]*/
+            LogError("failure in sm_close_begin(h_fabric_resolution_change_handler->sm=%p), SM_RESULT close_result=%" PRI_MU_ENUM ", already closed",
+                h_fabric_resolution_change_handler->sm, MU_ENUM_VALUE(SM_RESULT, close_result));
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_018: [ h_fabric_resolution_change_handler_close shall call sm_close_end. ]*/
+            /*the state machine is not opened again, so the changes stay refused*/
+            sm_close_end(h_fabric_resolution_change_handler->sm);
+        }
+    }
+}
+
+void h_fabric_resolution_change_handler_OnChange(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE h_fabric_resolution_change_handler, IFabricServiceManagementClient* source, LONGLONG handlerId, IFabricResolvedServicePartitionResult* partition, HRESULT error)
+{
+    if (h_fabric_resolution_change_handler == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_007: [ If h_fabric_resolution_change_handler is NULL, h_fabric_resolution_change_handler_OnChange shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE h_fabric_resolution_change_handler=%p, IFabricServiceManagementClient* source=%p, LONGLONG handlerId=%lld, IFabricResolvedServicePartitionResult* partition=%p, HRESULT error=0x%08x",
+            h_fabric_resolution_change_handler, source, handlerId, partition, error);
+    }
+    else
+    {
+        (void)source;
+
+        /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_019: [ h_fabric_resolution_change_handler_OnChange shall call sm_exec_begin. ]*/
+        SM_RESULT exec_result = sm_exec_begin(h_fabric_resolution_change_handler->sm);
+        if (exec_result != SM_EXEC_GRANTED)
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_012: [ If sm_exec_begin does not return SM_EXEC_GRANTED (the handler was closed) then h_fabric_resolution_change_handler_OnChange shall not call on_resolution_change. ]*/
+            LogInfo("ignoring change of handlerId=%" PRId64 ", h_fabric_resolution_change_handler=%p is closed, SM_RESULT exec_result=%" PRI_MU_ENUM "",
+                (int64_t)handlerId, h_fabric_resolution_change_handler, MU_ENUM_VALUE(SM_RESULT, exec_result));
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_008: [ Otherwise h_fabric_resolution_change_handler_OnChange shall call on_resolution_change and pass as arguments on_resolution_change_context, handlerId, partition and error. ]*/
+            h_fabric_resolution_change_handler->on_resolution_change(h_fabric_resolution_change_handler->on_resolution_change_context, handlerId, partition, error);
+
+            /*Codes_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_020: [ h_fabric_resolution_change_handler_OnChange shall call sm_exec_end after on_resolution_change returns. ]*/
+            sm_exec_end(h_fabric_resolution_change_handler->sm);
+        }
+    }
+}
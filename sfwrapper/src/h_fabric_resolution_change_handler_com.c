@@ -0,0 +1,7 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "com_wrapper/com_wrapper.h"
+#include "h_fabric_resolution_change_handler.h"
+#include "h_fabric_resolution_change_handler_com.h"
+
+DEFINE_COM_WRAPPER_OBJECT(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE, H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_INTERFACES);
@@ -0,0 +1,303 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#define _CRT_RAND_S
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "h_fabric_retry_policy.h"
+
+MU_DEFINE_ENUM_STRINGS(H_FABRIC_RETRY_POLICY_TYPE, H_FABRIC_RETRY_POLICY_TYPE_VALUES)
+
+static void retry_policy_init(H_FABRIC_RETRY_POLICY* policy, H_FABRIC_RETRY_POLICY_TYPE type, uint32_t max_tries, uint32_t base_delay_ms, uint32_t max_delay_ms)
+{
+    policy->type = type;
+    policy->max_tries = max_tries;
+    policy->base_delay_ms = base_delay_ms;
+    policy->max_delay_ms = max_delay_ms;
+    policy->retry_budget_ms = 0;
+    policy->compute_delay = NULL;
+    policy->compute_delay_context = NULL;
+}
+
+/*returns a random number in [low, high]. rand_s is used instead of rand: it is thread safe and seeded by the OS, so processes and threads that failed together do not draw the same delays*/
+static uint32_t random_between(uint32_t low, uint32_t high)
+{
+    uint32_t result;
+    if (high <= low)
+    {
+        result = low;
+    }
+    else
+    {
+        unsigned int r;
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_044: [ For H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER h_fabric_retry_policy_get_next_delay shall get the random value by calling rand_s. ]*/
+        if (rand_s(&r) != 0)
+        {
+            /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_045: [ If rand_s fails then the delay shall be base_delay_ms. ]*/
+            LogError("failure in rand_s, using the lowest delay low=%" PRIu32 "", low);
+            result = low;
+        }
+        else
+        {
+            result = low + (uint32_t)(r % ((uint64_t)high - low + 1));
+        }
+    }
+    return result;
+}
+
+static uint32_t compute_exponential_delay(const H_FABRIC_RETRY_POLICY* policy, uint32_t retry)
+{
+    uint32_t result;
+    uint32_t shift = retry - 1;
+    if (
+        (shift >= 32) ||
+        (policy->base_delay_ms > (policy->max_delay_ms >> shift))
+        )
+    {
+        result = policy->max_delay_ms;
+    }
+    else
+    {
+        result = policy->base_delay_ms << shift;
+    }
+    return result;
+}
+
+static uint32_t compute_decorrelated_jitter_delay(const H_FABRIC_RETRY_POLICY* policy, uint32_t previous_delay_ms)
+{
+    uint32_t previous = (previous_delay_ms < policy->base_delay_ms) ? policy->base_delay_ms : previous_delay_ms;
+    uint32_t high = (previous > UINT32_MAX / 3) ? UINT32_MAX : previous * 3;
+    uint32_t result = random_between(policy->base_delay_ms, high);
+    if (result > policy->max_delay_ms)
+    {
+        result = policy->max_delay_ms;
+    }
+    return result;
+}
+
+int h_fabric_retry_policy_init_fixed(H_FABRIC_RETRY_POLICY* policy, uint32_t max_tries, uint32_t delay_ms)
+{
+    int result;
+    if (policy == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_001: [ If policy is NULL then h_fabric_retry_policy_init_fixed shall fail and return a non-zero value. ]*/
+        LogError("Invalid arguments: H_FABRIC_RETRY_POLICY* policy=%p, uint32_t max_tries=%" PRIu32 ", uint32_t delay_ms=%" PRIu32 "",
+            policy, max_tries, delay_ms);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_002: [ h_fabric_retry_policy_init_fixed shall initialize policy as a H_FABRIC_RETRY_POLICY_TYPE_FIXED policy with max_tries, delay_ms as base and maximum delay and no retry budget. ]*/
+        retry_policy_init(policy, H_FABRIC_RETRY_POLICY_TYPE_FIXED, max_tries, delay_ms, delay_ms);
+
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_003: [ h_fabric_retry_policy_init_fixed shall succeed and return 0. ]*/
+        result = 0;
+    }
+    return result;
+}
+
+int h_fabric_retry_policy_init_exponential(H_FABRIC_RETRY_POLICY* policy, uint32_t max_tries, uint32_t base_delay_ms, uint32_t max_delay_ms)
+{
+    int result;
+    if (
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_004: [ If policy is NULL then h_fabric_retry_policy_init_exponential shall fail and return a non-zero value. ]*/
+        (policy == NULL) ||
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_005: [ If max_delay_ms is less than base_delay_ms then h_fabric_retry_policy_init_exponential shall fail and return a non-zero value. ]*/
+        (max_delay_ms < base_delay_ms)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_RETRY_POLICY* policy=%p, uint32_t max_tries=%" PRIu32 ", uint32_t base_delay_ms=%" PRIu32 ", uint32_t max_delay_ms=%" PRIu32 "",
+            policy, max_tries, base_delay_ms, max_delay_ms);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_006: [ h_fabric_retry_policy_init_exponential shall initialize policy as a H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL policy with max_tries, base_delay_ms, max_delay_ms and no retry budget. ]*/
+        retry_policy_init(policy, H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL, max_tries, base_delay_ms, max_delay_ms);
+
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_007: [ h_fabric_retry_policy_init_exponential shall succeed and return 0. ]*/
+        result = 0;
+    }
+    return result;
+}
+
+int h_fabric_retry_policy_init_decorrelated_jitter(H_FABRIC_RETRY_POLICY* policy, uint32_t max_tries, uint32_t base_delay_ms, uint32_t max_delay_ms)
+{
+    int result;
+    if (
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_008: [ If policy is NULL then h_fabric_retry_policy_init_decorrelated_jitter shall fail and return a non-zero value. ]*/
+        (policy == NULL) ||
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_009: [ If max_delay_ms is less than base_delay_ms then h_fabric_retry_policy_init_decorrelated_jitter shall fail and return a non-zero value. ]*/
+        (max_delay_ms < base_delay_ms)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_RETRY_POLICY* policy=%p, uint32_t max_tries=%" PRIu32 ", uint32_t base_delay_ms=%" PRIu32 ", uint32_t max_delay_ms=%" PRIu32 "",
+            policy, max_tries, base_delay_ms, max_delay_ms);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_010: [ h_fabric_retry_policy_init_decorrelated_jitter shall initialize policy as a H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER policy with max_tries, base_delay_ms, max_delay_ms and no retry budget. ]*/
+        retry_policy_init(policy, H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER, max_tries, base_delay_ms, max_delay_ms);
+
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_011: [ h_fabric_retry_policy_init_decorrelated_jitter shall succeed and return 0. ]*/
+        result = 0;
+    }
+    return result;
+}
+
+int h_fabric_retry_policy_init_custom(H_FABRIC_RETRY_POLICY* policy, uint32_t max_tries, H_FABRIC_RETRY_POLICY_COMPUTE_DELAY compute_delay, void* compute_delay_context)
+{
+    int result;
+    if (
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_012: [ If policy is NULL then h_fabric_retry_policy_init_custom shall fail and return a non-zero value. ]*/
+        (policy == NULL) ||
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_013: [ If compute_delay is NULL then h_fabric_retry_policy_init_custom shall fail and return a non-zero value. ]*/
+        (compute_delay == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_RETRY_POLICY* policy=%p, uint32_t max_tries=%" PRIu32 ", H_FABRIC_RETRY_POLICY_COMPUTE_DELAY compute_delay=%p, void* compute_delay_context=%p",
+            policy, max_tries, compute_delay, compute_delay_context);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_014: [ h_fabric_retry_policy_init_custom shall initialize policy as a H_FABRIC_RETRY_POLICY_TYPE_CUSTOM policy with max_tries, compute_delay, compute_delay_context and no retry budget. ]*/
+        retry_policy_init(policy, H_FABRIC_RETRY_POLICY_TYPE_CUSTOM, max_tries, 0, UINT32_MAX);
+        policy->compute_delay = compute_delay;
+        policy->compute_delay_context = compute_delay_context;
+
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_015: [ h_fabric_retry_policy_init_custom shall succeed and return 0. ]*/
+        result = 0;
+    }
+    return result;
+}
+
+int h_fabric_retry_policy_set_budget(H_FABRIC_RETRY_POLICY* policy, uint32_t retry_budget_ms)
+{
+    int result;
+    if (policy == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_016: [ If policy is NULL then h_fabric_retry_policy_set_budget shall fail and return a non-zero value. ]*/
+        LogError("Invalid arguments: H_FABRIC_RETRY_POLICY* policy=%p, uint32_t retry_budget_ms=%" PRIu32 "",
+            policy, retry_budget_ms);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_017: [ h_fabric_retry_policy_set_budget shall set the retry budget of policy to retry_budget_ms and return 0. ]*/
+        policy->retry_budget_ms = retry_budget_ms;
+        result = 0;
+    }
+    return result;
+}
+
+bool h_fabric_retry_policy_get_next_delay(const H_FABRIC_RETRY_POLICY* policy, H_FABRIC_RETRY_STATE* state, uint32_t remaining_ms, uint32_t* delay_ms)
+{
+    bool result;
+    if (
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_018: [ If policy is NULL then h_fabric_retry_policy_get_next_delay shall fail and return false. ]*/
+        (policy == NULL) ||
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_019: [ If state is NULL then h_fabric_retry_policy_get_next_delay shall fail and return false. ]*/
+        (state == NULL) ||
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_020: [ If delay_ms is NULL then h_fabric_retry_policy_get_next_delay shall fail and return false. ]*/
+        (delay_ms == NULL)
+        )
+    {
+        LogError("Invalid arguments: const H_FABRIC_RETRY_POLICY* policy=%p, H_FABRIC_RETRY_STATE* state=%p, uint32_t remaining_ms=%" PRIu32 ", uint32_t* delay_ms=%p",
+            policy, state, remaining_ms, delay_ms);
+        result = false;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_021: [ h_fabric_retry_policy_get_next_delay shall increment the number of tries in state. ]*/
+        state->tries++;
+
+        if (state->tries >= policy->max_tries)
+        {
+            /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_022: [ If the number of tries in state reached max_tries then h_fabric_retry_policy_get_next_delay shall return false. ]*/
+            result = false;
+        }
+        else if (remaining_ms == 0)
+        {
+            /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_023: [ If remaining_ms is 0 then h_fabric_retry_policy_get_next_delay shall return false. ]*/
+            result = false;
+        }
+        else if (
+            (policy->retry_budget_ms != 0) &&
+            (state->total_delay_ms >= policy->retry_budget_ms)
+            )
+        {
+            /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_024: [ If policy has a retry budget and the total delay in state reached it then h_fabric_retry_policy_get_next_delay shall return false. ]*/
+            LogInfo("retry budget of %" PRIu32 " ms exhausted after %" PRIu32 " tries", policy->retry_budget_ms, state->tries);
+            result = false;
+        }
+        else
+        {
+            uint32_t delay;
+            switch (policy->type)
+            {
+                default:
+                {
+                    LogError("unknown H_FABRIC_RETRY_POLICY_TYPE type=%" PRI_MU_ENUM "", MU_ENUM_VALUE(H_FABRIC_RETRY_POLICY_TYPE, policy->type));
+                    delay = policy->base_delay_ms;
+                    break;
+                }
+                case H_FABRIC_RETRY_POLICY_TYPE_FIXED:
+                {
+                    /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_025: [ For H_FABRIC_RETRY_POLICY_TYPE_FIXED the delay shall be base_delay_ms. ]*/
+                    delay = policy->base_delay_ms;
+                    break;
+                }
+                case H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL:
+                {
+                    /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_026: [ For H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL the delay shall be base_delay_ms * 2^(tries - 1), capped at max_delay_ms. ]*/
+                    delay = compute_exponential_delay(policy, state->tries);
+                    break;
+                }
+                case H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER:
+                {
+                    /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_027: [ For H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER the delay shall be a random value between base_delay_ms and 3 times the previous delay (base_delay_ms for the first retry), capped at max_delay_ms. ]*/
+                    delay = compute_decorrelated_jitter_delay(policy, state->previous_delay_ms);
+                    break;
+                }
+                case H_FABRIC_RETRY_POLICY_TYPE_CUSTOM:
+                {
+                    /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_028: [ For H_FABRIC_RETRY_POLICY_TYPE_CUSTOM the delay shall be the value returned by compute_delay called with compute_delay_context, the number of tries in state and the previous delay. ]*/
+                    delay = policy->compute_delay(policy->compute_delay_context, state->tries, state->previous_delay_ms);
+                    break;
+                }
+            }
+
+            /*the next delay is computed from the unclamped one so that clamping does not reset the backoff*/
+            state->previous_delay_ms = delay;
+
+            /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_029: [ If policy has a retry budget then h_fabric_retry_policy_get_next_delay shall clamp the delay to what is left of the budget. ]*/
+            if (
+                (policy->retry_budget_ms != 0) &&
+                (delay > policy->retry_budget_ms - state->total_delay_ms)
+                )
+            {
+                delay = policy->retry_budget_ms - state->total_delay_ms;
+            }
+
+            /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_030: [ h_fabric_retry_policy_get_next_delay shall clamp the delay to remaining_ms. ]*/
+            if (delay > remaining_ms)
+            {
+                delay = remaining_ms;
+            }
+
+            /*Codes_SRS_H_FABRIC_RETRY_POLICY_01_031: [ h_fabric_retry_policy_get_next_delay shall add the delay to the total delay in state, set delay_ms to the delay and return true. ]*/
+            state->total_delay_ms = (delay > UINT32_MAX - state->total_delay_ms) ? UINT32_MAX : state->total_delay_ms + delay;
+            *delay_ms = delay;
+            result = true;
+        }
+    }
+    return result;
+}
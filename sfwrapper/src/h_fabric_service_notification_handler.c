@@ -0,0 +1,169 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+
+#include "c_util/sm.h"
+
+#include "h_fabric_service_notification_handler.h"
+
+typedef struct H_FABRIC_SERVICE_NOTIFICATION_HANDLER_TAG
+{
+    ON_SERVICE_NOTIFICATION on_service_notification;
+    void* on_service_notification_context;
+    SM_HANDLE sm; /*closed once h_fabric_service_notification_handler_close was called, on_service_notification_context might be gone*/
+} H_FABRIC_SERVICE_NOTIFICATION_HANDLER;
+
+H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE h_fabric_service_notification_handler_create(ON_SERVICE_NOTIFICATION on_service_notification, void* on_service_notification_context)
+{
+    H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE result;
+
+    /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_002: [ on_service_notification_context shall be allowed to be NULL. ]*/
+
+    if (on_service_notification == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_001: [ If on_service_notification is NULL, h_fabric_service_notification_handler_create shall fail and return NULL. ]*/
+        LogError("Invalid arguments: ON_SERVICE_NOTIFICATION on_service_notification=%p, void* on_service_notification_context=%p",
+            on_service_notification, on_service_notification_context);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_003: [ Otherwise, h_fabric_service_notification_handler_create shall allocate a new notification handler instance and on success return a non-NULL pointer to it. ]*/
+        result = malloc(sizeof(H_FABRIC_SERVICE_NOTIFICATION_HANDLER));
+        if (result == NULL)
+        {
+            /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_004: [ If any error occurs, h_fabric_service_notification_handler_create shall fail and return NULL. ]*/
+            LogError("failure in malloc(sizeof(H_FABRIC_SERVICE_NOTIFICATION_HANDLER)=%zu)", sizeof(H_FABRIC_SERVICE_NOTIFICATION_HANDLER));
+        }
+        else
+        {
+            result->on_service_notification = on_service_notification;
+            result->on_service_notification_context = on_service_notification_context;
+
+            /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_016: [ h_fabric_service_notification_handler_create shall create a state machine by calling sm_create. ]*/
+            result->sm = sm_create("h_fabric_service_notification_handler");
+            if (result->sm == NULL)
+            {
+                /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_004: [ If any error occurs, h_fabric_service_notification_handler_create shall fail and return NULL. ]*/
+                LogError("failure in sm_create(\"h_fabric_service_notification_handler\")");
+            }
+            else
+            {
+                /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_017: [ h_fabric_service_notification_handler_create shall open the state machine by calling sm_open_begin and sm_open_end. ]*/
+                SM_RESULT open_result = sm_open_begin(result->sm);
+                if (open_result != SM_EXEC_GRANTED)
+                {
+                    /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_004: [ If any error occurs, h_fabric_service_notification_handler_create shall fail and return NULL. ]*/
+                    LogError("failure in sm_open_begin(result->sm=%p), SM_RESULT open_result=%" PRI_MU_ENUM "",
+                        result->sm, MU_ENUM_VALUE(SM_RESULT, open_result));
+                }
+                else
+                {
+                    sm_open_end(result->sm, true);
+
+                    goto all_ok;
+                }
+                sm_destroy(result->sm);
+            }
+            free(result);
+        }
+    }
+
+    result = NULL;
+
+all_ok:
+    return result;
+}
+
+void h_fabric_service_notification_handler_destroy(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE h_fabric_service_notification_handler)
+{
+    if (h_fabric_service_notification_handler == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_005: [ If h_fabric_service_notification_handler is NULL, h_fabric_service_notification_handler_destroy shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE h_fabric_service_notification_handler=%p", h_fabric_service_notification_handler);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_018: [ Otherwise, h_fabric_service_notification_handler_destroy shall destroy the state machine by calling sm_destroy. ]*/
+        sm_destroy(h_fabric_service_notification_handler->sm);
+
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_006: [ h_fabric_service_notification_handler_destroy shall free the memory allocated in h_fabric_service_notification_handler_create. ]*/
+        free(h_fabric_service_notification_handler);
+    }
+}
+
+void h_fabric_service_notification_handler_close(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE h_fabric_service_notification_handler)
+{
+    if (h_fabric_service_notification_handler == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_011: [ If h_fabric_service_notification_handler is NULL, h_fabric_service_notification_handler_close shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE h_fabric_service_notification_handler=%p", h_fabric_service_notification_handler);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_012: [ Otherwise, h_fabric_service_notification_handler_close shall make the notifications that arrive from now on not call on_service_notification and wait for the calls to on_service_notification in progress to finish by calling sm_close_begin. ]*/
+        SM_RESULT close_result = sm_close_begin(h_fabric_service_notification_handler->sm);
+        if (close_result != SM_EXEC_GRANTED)
+        {
+            /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_020: [ If sm_close_begin does not return SM_EXEC_GRANTED then h_fabric_service_notification_handler_close shall return. ]*/
+            LogError("failure in sm_close_begin(h_fabric_service_notification_handler->sm=%p), SM_RESULT close_result=%" PRI_MU_ENUM ", already closed",
+                h_fabric_service_notification_handler->sm, MU_ENUM_VALUE(SM_RESULT, close_result));
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_019: [ h_fabric_service_notification_handler_close shall call sm_close_end. ]*/
+            /*the state machine is not opened again, so the notifications stay refused*/
+            sm_close_end(h_fabric_service_notification_handler->sm);
+        }
+    }
+}
+
+HRESULT h_fabric_service_notification_handler_OnNotification(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE h_fabric_service_notification_handler, IFabricServiceNotification* notification)
+{
+    HRESULT result;
+    if (
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_007: [ If h_fabric_service_notification_handler is NULL, h_fabric_service_notification_handler_OnNotification shall fail and return E_INVALIDARG. ]*/
+        (h_fabric_service_notification_handler == NULL) ||
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_008: [ If notification is NULL, h_fabric_service_notification_handler_OnNotification shall fail and return E_INVALIDARG. ]*/
+        (notification == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE h_fabric_service_notification_handler=%p, IFabricServiceNotification* notification=%p",
+            h_fabric_service_notification_handler, notification);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_021: [ h_fabric_service_notification_handler_OnNotification shall call sm_exec_begin. ]*/
+        SM_RESULT exec_result = sm_exec_begin(h_fabric_service_notification_handler->sm);
+        if (exec_result != SM_EXEC_GRANTED)
+        {
+            /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_014: [ If sm_exec_begin does not return SM_EXEC_GRANTED (the handler was closed) then h_fabric_service_notification_handler_OnNotification shall not call on_service_notification. ]*/
+            LogInfo("ignoring notification=%p, h_fabric_service_notification_handler=%p is closed, SM_RESULT exec_result=%" PRI_MU_ENUM "",
+                notification, h_fabric_service_notification_handler, MU_ENUM_VALUE(SM_RESULT, exec_result));
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_009: [ Otherwise h_fabric_service_notification_handler_OnNotification shall call on_service_notification and pass as arguments on_service_notification_context and notification. ]*/
+            h_fabric_service_notification_handler->on_service_notification(h_fabric_service_notification_handler->on_service_notification_context, notification);
+
+            /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_022: [ h_fabric_service_notification_handler_OnNotification shall call sm_exec_end after on_service_notification returns. ]*/
+            sm_exec_end(h_fabric_service_notification_handler->sm);
+        }
+
+        /*Codes_SRS_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_01_010: [ h_fabric_service_notification_handler_OnNotification shall succeed and return S_OK. ]*/
+        result = S_OK;
+    }
+    return result;
+}
@@ -0,0 +1,7 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "com_wrapper/com_wrapper.h"
+#include "h_fabric_service_notification_handler.h"
+#include "h_fabric_service_notification_handler_com.h"
+
+DEFINE_COM_WRAPPER_OBJECT(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE, H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE_INTERFACES);
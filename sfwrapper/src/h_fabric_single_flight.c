@@ -0,0 +1,378 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <wchar.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+
+#include "h_fabric_single_flight.h"
+
+#define SINGLE_FLIGHT_CALL_STATE_VALUES \
+    SINGLE_FLIGHT_CALL_STATE_RUNNING, /*the leader is executing the operation*/ \
+    SINGLE_FLIGHT_CALL_STATE_DONE /*call_result and result can be read*/ \
+
+MU_DEFINE_ENUM(SINGLE_FLIGHT_CALL_STATE, SINGLE_FLIGHT_CALL_STATE_VALUES)
+
+/*markers that keep a NULL string apart from an empty one in the key*/
+#define KEY_WSTRING_NULL ((unsigned char)0)
+#define KEY_WSTRING_NOT_NULL ((unsigned char)1)
+
+struct H_FABRIC_SINGLE_FLIGHT_CALL_TAG
+{
+    struct H_FABRIC_SINGLE_FLIGHT_CALL_TAG* next; /*guarded by the lock of the single flight group, only meaningful while the call is in flight*/
+    const char* api_name;
+    volatile_atomic int32_t ref_count; /*1 for the leader + 1 for every thread that joined and did not get the result yet*/
+    volatile_atomic int32_t state; /*SINGLE_FLIGHT_CALL_STATE*/
+    HRESULT call_result; /*written by the leader before state becomes DONE*/
+    IUnknown* result; /*written by the leader before state becomes DONE, the call owns 1 reference on it*/
+    size_t key_size;
+    unsigned char key[];
+};
+
+static void single_flight_lock(H_FABRIC_SINGLE_FLIGHT* single_flight)
+{
+    while (interlocked_compare_exchange(&single_flight->lock, 1, 0) != 0)
+    {
+        /*the lock is only held while the list of calls is walked or changed*/
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&single_flight->lock, 0, UINT32_MAX);
+        if (wait_result != INTERLOCKED_HL_OK)
+        {
+            LogError("failure in InterlockedHL_WaitForValue(&single_flight->lock=%p, 0, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d", &single_flight->lock, (int)wait_result);
+            /*try again*/
+        }
+    }
+}
+
+static void single_flight_unlock(H_FABRIC_SINGLE_FLIGHT* single_flight)
+{
+    (void)interlocked_exchange(&single_flight->lock, 0);
+    wake_by_address_single(&single_flight->lock);
+}
+
+static void call_dec_ref(H_FABRIC_SINGLE_FLIGHT_CALL* call)
+{
+    if (interlocked_decrement(&call->ref_count) == 0)
+    {
+        if (call->result != NULL)
+        {
+            (void)call->result->lpVtbl->Release(call->result);
+        }
+        free(call);
+    }
+}
+
+void h_fabric_single_flight_init(H_FABRIC_SINGLE_FLIGHT* single_flight)
+{
+    if (single_flight == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_001: [ If single_flight is NULL then h_fabric_single_flight_init shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT* single_flight=%p", single_flight);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_002: [ h_fabric_single_flight_init shall initialize single_flight with no calls in flight. ]*/
+        (void)interlocked_exchange(&single_flight->lock, 0);
+        single_flight->calls = NULL;
+    }
+}
+
+void h_fabric_single_flight_deinit(H_FABRIC_SINGLE_FLIGHT* single_flight)
+{
+    if (single_flight == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_003: [ If single_flight is NULL then h_fabric_single_flight_deinit shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT* single_flight=%p", single_flight);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_004: [ If there are calls in flight then h_fabric_single_flight_deinit shall log an error and leave them to the threads that own them. ]*/
+        if (single_flight->calls != NULL)
+        {
+            LogError("h_fabric_single_flight_deinit(single_flight=%p) called while calls are in flight, first call=%p (api_name=%s)", single_flight, single_flight->calls, single_flight->calls->api_name);
+        }
+        single_flight->calls = NULL;
+    }
+}
+
+void h_fabric_single_flight_key_init(H_FABRIC_SINGLE_FLIGHT_KEY* key)
+{
+    if (key == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_005: [ If key is NULL then h_fabric_single_flight_key_init shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT_KEY* key=%p", key);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_006: [ h_fabric_single_flight_key_init shall initialize key as an empty key that can be coalesced. ]*/
+        key->can_coalesce = true;
+        key->size = 0;
+    }
+}
+
+void h_fabric_single_flight_key_add(H_FABRIC_SINGLE_FLIGHT_KEY* key, const void* data, size_t size)
+{
+    if (key == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_007: [ If key is NULL then h_fabric_single_flight_key_add shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT_KEY* key=%p, const void* data=%p, size_t size=%zu", key, data, size);
+    }
+    else if (
+        (data == NULL) &&
+        (size != 0)
+        )
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_008: [ If data is NULL and size is not 0 then h_fabric_single_flight_key_add shall mark key as not coalescable. ]*/
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT_KEY* key=%p, const void* data=%p, size_t size=%zu", key, data, size);
+        key->can_coalesce = false;
+    }
+    else if (size > H_FABRIC_SINGLE_FLIGHT_KEY_MAX_SIZE - key->size)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_009: [ If the key would grow past H_FABRIC_SINGLE_FLIGHT_KEY_MAX_SIZE bytes then h_fabric_single_flight_key_add shall mark key as not coalescable. ]*/
+        key->can_coalesce = false;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_010: [ h_fabric_single_flight_key_add shall append the size bytes at data to key. ]*/
+        if (size != 0)
+        {
+            (void)memcpy(key->bytes + key->size, data, size);
+            key->size += size;
+        }
+    }
+}
+
+void h_fabric_single_flight_key_add_wstring(H_FABRIC_SINGLE_FLIGHT_KEY* key, const wchar_t* value)
+{
+    if (key == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_011: [ If key is NULL then h_fabric_single_flight_key_add_wstring shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT_KEY* key=%p, const wchar_t* value=%ls", key, MU_WP_OR_NULL(value));
+    }
+    else if (value == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_012: [ If value is NULL then h_fabric_single_flight_key_add_wstring shall append a marker for NULL to key. ]*/
+        unsigned char marker = KEY_WSTRING_NULL;
+        h_fabric_single_flight_key_add(key, &marker, sizeof(marker));
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_013: [ Otherwise h_fabric_single_flight_key_add_wstring shall append a marker for non-NULL, the length of value and the characters of value to key. ]*/
+        unsigned char marker = KEY_WSTRING_NOT_NULL;
+        size_t length = wcslen(value);
+        h_fabric_single_flight_key_add(key, &marker, sizeof(marker));
+        h_fabric_single_flight_key_add(key, &length, sizeof(length));
+        if (length > (H_FABRIC_SINGLE_FLIGHT_KEY_MAX_SIZE / sizeof(wchar_t)))
+        {
+            key->can_coalesce = false;
+        }
+        else
+        {
+            h_fabric_single_flight_key_add(key, value, length * sizeof(wchar_t));
+        }
+    }
+}
+
+void h_fabric_single_flight_key_disable(H_FABRIC_SINGLE_FLIGHT_KEY* key)
+{
+    if (key == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_014: [ If key is NULL then h_fabric_single_flight_key_disable shall return. ]*/
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT_KEY* key=%p", key);
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_015: [ h_fabric_single_flight_key_disable shall mark key as not coalescable. ]*/
+        key->can_coalesce = false;
+    }
+}
+
+H_FABRIC_SINGLE_FLIGHT_CALL* h_fabric_single_flight_join(H_FABRIC_SINGLE_FLIGHT* single_flight, const char* api_name, const H_FABRIC_SINGLE_FLIGHT_KEY* key, bool* is_leader)
+{
+    H_FABRIC_SINGLE_FLIGHT_CALL* result;
+    if (
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_016: [ If single_flight is NULL then h_fabric_single_flight_join shall fail and return NULL. ]*/
+        (single_flight == NULL) ||
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_017: [ If api_name is NULL then h_fabric_single_flight_join shall fail and return NULL. ]*/
+        (api_name == NULL) ||
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_018: [ If key is NULL then h_fabric_single_flight_join shall fail and return NULL. ]*/
+        (key == NULL) ||
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_019: [ If is_leader is NULL then h_fabric_single_flight_join shall fail and return NULL. ]*/
+        (is_leader == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT* single_flight=%p, const char* api_name=%s, const H_FABRIC_SINGLE_FLIGHT_KEY* key=%p, bool* is_leader=%p",
+            single_flight, MU_P_OR_NULL(api_name), key, is_leader);
+        result = NULL;
+    }
+    else if (!key->can_coalesce)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_020: [ If key is marked as not coalescable then h_fabric_single_flight_join shall return NULL. ]*/
+        result = NULL;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_021: [ h_fabric_single_flight_join shall look for a call in flight of api_name with the same key. ]*/
+        single_flight_lock(single_flight);
+
+        for (result = single_flight->calls; result != NULL; result = result->next)
+        {
+            if (
+                (result->key_size == key->size) &&
+                (strcmp(result->api_name, api_name) == 0) &&
+                (memcmp(result->key, key->bytes, key->size) == 0)
+                )
+            {
+                break;
+            }
+        }
+
+        if (result != NULL)
+        {
+            /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_022: [ If such a call exists then h_fabric_single_flight_join shall take a reference on it, set is_leader to false and return it. ]*/
+            (void)interlocked_increment(&result->ref_count);
+            *is_leader = false;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_023: [ Otherwise h_fabric_single_flight_join shall allocate a new call holding a copy of key and a reference for the caller, add it to the calls in flight, set is_leader to true and return it. ]*/
+            result = malloc_flex(sizeof(H_FABRIC_SINGLE_FLIGHT_CALL), key->size, sizeof(unsigned char));
+            if (result == NULL)
+            {
+                /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_024: [ If there are any failures then h_fabric_single_flight_join shall return NULL. ]*/
+                LogError("failure in malloc_flex(sizeof(H_FABRIC_SINGLE_FLIGHT_CALL)=%zu, key->size=%zu, sizeof(unsigned char)=%zu)", sizeof(H_FABRIC_SINGLE_FLIGHT_CALL), key->size, sizeof(unsigned char));
+                /*return as is*/
+            }
+            else
+            {
+                result->api_name = api_name;
+                (void)interlocked_exchange(&result->ref_count, 1);
+                (void)interlocked_exchange(&result->state, SINGLE_FLIGHT_CALL_STATE_RUNNING);
+                result->call_result = E_FAIL;
+                result->result = NULL;
+                result->key_size = key->size;
+                (void)memcpy(result->key, key->bytes, key->size);
+
+                result->next = single_flight->calls;
+                single_flight->calls = result;
+                *is_leader = true;
+            }
+        }
+
+        single_flight_unlock(single_flight);
+    }
+    return result;
+}
+
+void h_fabric_single_flight_complete(H_FABRIC_SINGLE_FLIGHT* single_flight, H_FABRIC_SINGLE_FLIGHT_CALL* call, HRESULT call_result, IUnknown* result)
+{
+    if (
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_025: [ If single_flight is NULL then h_fabric_single_flight_complete shall return. ]*/
+        (single_flight == NULL) ||
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_026: [ If call is NULL then h_fabric_single_flight_complete shall return. ]*/
+        (call == NULL)
+        )
+    {
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT* single_flight=%p, H_FABRIC_SINGLE_FLIGHT_CALL* call=%p, HRESULT call_result=%" PRI_HRESULT ", IUnknown* result=%p",
+            single_flight, call, MU_HRESULT_VALUE(call_result), result);
+    }
+    else
+    {
+        H_FABRIC_SINGLE_FLIGHT_CALL** current;
+
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_027: [ h_fabric_single_flight_complete shall remove call from the calls in flight so that the calls that start from now on execute again. ]*/
+        single_flight_lock(single_flight);
+        for (current = &single_flight->calls; *current != NULL; current = &(*current)->next)
+        {
+            if (*current == call)
+            {
+                *current = call->next;
+                break;
+            }
+        }
+        single_flight_unlock(single_flight);
+
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_028: [ h_fabric_single_flight_complete shall store call_result and, if result is not NULL, take a reference on result. ]*/
+        call->call_result = call_result;
+        if (result != NULL)
+        {
+            (void)result->lpVtbl->AddRef(result);
+            call->result = result;
+        }
+
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_029: [ h_fabric_single_flight_complete shall mark call as done and wake up the threads waiting for it by calling wake_by_address_all. ]*/
+        (void)interlocked_exchange(&call->state, SINGLE_FLIGHT_CALL_STATE_DONE);
+        wake_by_address_all(&call->state);
+
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_030: [ h_fabric_single_flight_complete shall give back the reference of the leader on call. ]*/
+        call_dec_ref(call);
+    }
+}
+
+HRESULT h_fabric_single_flight_wait(H_FABRIC_SINGLE_FLIGHT_CALL* call, uint32_t timeout_ms, IUnknown** result)
+{
+    HRESULT hr;
+    if (call == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_031: [ If call is NULL then h_fabric_single_flight_wait shall fail and return E_INVALIDARG. ]*/
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT_CALL* call=%p, uint32_t timeout_ms=%" PRIu32 ", IUnknown** result=%p", call, timeout_ms, result);
+        hr = E_INVALIDARG;
+    }
+    else if (result == NULL)
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_032: [ If result is NULL then h_fabric_single_flight_wait shall give back the reference of the caller on call, fail and return E_INVALIDARG. ]*/
+        LogError("Invalid arguments: H_FABRIC_SINGLE_FLIGHT_CALL* call=%p, uint32_t timeout_ms=%" PRIu32 ", IUnknown** result=%p", call, timeout_ms, result);
+        call_dec_ref(call);
+        hr = E_INVALIDARG;
+    }
+    else
+    {
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_033: [ h_fabric_single_flight_wait shall wait at most timeout_ms for call to be done by calling InterlockedHL_WaitForValue. ]*/
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&call->state, SINGLE_FLIGHT_CALL_STATE_DONE, timeout_ms);
+        if (wait_result == INTERLOCKED_HL_TIMEOUT)
+        {
+            /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_034: [ If the wait times out then h_fabric_single_flight_wait shall return FABRIC_E_TIMEOUT. ]*/
+            LogError("call=%p (api_name=%s) did not finish in timeout_ms=%" PRIu32 "", call, call->api_name, timeout_ms);
+            hr = FABRIC_E_TIMEOUT;
+        }
+        else if (wait_result != INTERLOCKED_HL_OK)
+        {
+            /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_035: [ If the wait fails then h_fabric_single_flight_wait shall return E_FAIL. ]*/
+            LogError("failure in InterlockedHL_WaitForValue(&call->state=%p, SINGLE_FLIGHT_CALL_STATE_DONE, timeout_ms=%" PRIu32 "), INTERLOCKED_HL_RESULT wait_result=%d", &call->state, timeout_ms, (int)wait_result);
+            hr = E_FAIL;
+        }
+        else
+        {
+            /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_036: [ h_fabric_single_flight_wait shall return the call_result stored by the leader. ]*/
+            hr = call->call_result;
+            if (SUCCEEDED(hr))
+            {
+                /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_037: [ If call_result is a success code then h_fabric_single_flight_wait shall take a new reference on the result stored by the leader and return it in result. ]*/
+                if (call->result != NULL)
+                {
+                    (void)call->result->lpVtbl->AddRef(call->result);
+                }
+                *result = call->result;
+            }
+        }
+
+        /*Codes_SRS_H_FABRIC_SINGLE_FLIGHT_01_038: [ h_fabric_single_flight_wait shall give back the reference of the caller on call. ]*/
+        call_dec_ref(call);
+    }
+    return hr;
+}
@@ -44,12 +44,22 @@ H_FABRIC_DEFINE_API(IFabricServiceManagementClient6, FSMC6_DeleteService,
     )
 )
 
-H_FABRIC_DEFINE_API(IFabricServiceManagementClient6, FSMC6_GetServiceDescription,
+/*2 GetServiceDescription calls are the same when they ask for the same service*/
+static void service_description_key(H_FABRIC_SINGLE_FLIGHT_KEY* key, FABRIC_URI name, DWORD timeoutMilliseconds, IFabricServiceDescriptionResult** result)
+{
+    (void)timeoutMilliseconds;
+    (void)result;
+    h_fabric_single_flight_key_add_wstring(key, name);
+}
+
+H_FABRIC_DEFINE_API_SINGLE_FLIGHT(IFabricServiceManagementClient6, FSMC6_GetServiceDescription,
     IN_ARGS(
         ARG(FABRIC_URI, name),
         ARG(DWORD, timeoutMilliseconds),
         ARG(IFabricServiceDescriptionResult**, result)
-    )
+    ),
+    service_description_key,
+    result
 )
 
 // The below APIs do not have a timeoutMillisecond.
@@ -69,7 +79,7 @@ H_FABRIC_DEFINE_API_NO_SF_TIMEOUT(IFabricServiceManagementClient6, FSMC6_Unregis
     )
 )
 
-H_FABRIC_DEFINE_API(IFabricServiceManagementClient6, FSMC6_ResolveServicePartition,
+H_FABRIC_DEFINE_API_HEDGED(IFabricServiceManagementClient6, FSMC6_ResolveServicePartition,
     IN_ARGS(
         ARG(FABRIC_URI, name),
         ARG(FABRIC_PARTITION_KEY_TYPE, partitionKeyType),
@@ -77,7 +87,8 @@ H_FABRIC_DEFINE_API(IFabricServiceManagementClient6, FSMC6_ResolveServicePartiti
         ARG(IFabricResolvedServicePartitionResult*, previousResult),
         ARG(DWORD, timeoutMilliseconds),
         ARG(IFabricResolvedServicePartitionResult**, resolveServicePartitionResult)
-    )
+    ),
+    resolveServicePartitionResult
 )
 
 H_FABRIC_DEFINE_API(IFabricServiceManagementClient6, FSMC6_GetServiceManifest,
@@ -140,3 +151,14 @@ H_FABRIC_DEFINE_API(IFabricServiceManagementClient6, FSMC6_CreateServiceFromTemp
         ARG(DWORD, timeoutMilliseconds)
     )
 )
+
+H_FABRIC_DEFINE_API_ASYNC(IFabricServiceManagementClient6, FSMC6_ResolveServicePartition,
+    IN_ARGS(
+        ARG(FABRIC_URI, name),
+        ARG(FABRIC_PARTITION_KEY_TYPE, partitionKeyType),
+        ARG(const void*, partitionKey),
+        ARG(IFabricResolvedServicePartitionResult*, previousResult),
+        ARG(DWORD, timeoutMilliseconds),
+        ARG(IFabricResolvedServicePartitionResult**, resolveServicePartitionResult)
+        )
+)
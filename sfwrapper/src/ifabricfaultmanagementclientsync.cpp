@@ -8,7 +8,6 @@
 #include "fabricclient.h"
 
 #include "sf_c_util/hresult_to_string.h"
-#include "mycallback.h"
 #include "servicefabricdox.h"
 
 #include "ifabricfaultmanagementclientsync.h"
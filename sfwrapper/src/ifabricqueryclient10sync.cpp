@@ -8,7 +8,6 @@
 #include "fabricclient.h"
 
 #include "sf_c_util/hresult_to_string.h"
-#include "mycallback.h"
 #include "servicefabricdox.h"
 
 #include "ifabricqueryclient10sync.h"
@@ -400,3 +399,497 @@ HRESULT FQC10_GetDeployedApplicationPagedList(
         queryDescription
     );
 }
+
+HRESULT FQC10_GetNodeList_async(IFabricQueryClient10* This,
+    const FABRIC_NODE_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetNodeListResult** fabricGetNodeListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetNodeList, &IFabricQueryClient10::EndGetNodeList,
+        timeoutMilliseconds,
+        fabricGetNodeListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetApplicationTypeList_async(
+    IFabricQueryClient10* This,
+    const FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetApplicationTypeListResult **fabricGetApplicationTypeListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetApplicationTypeList, &IFabricQueryClient10::EndGetApplicationTypeList,
+        timeoutMilliseconds,
+        fabricGetApplicationTypeListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetServiceTypeList_async(IFabricQueryClient10* This,
+    const FABRIC_SERVICE_TYPE_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetServiceTypeListResult **fabricGetServiceTypeListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetServiceTypeList, &IFabricQueryClient10::EndGetServiceTypeList,
+        timeoutMilliseconds,
+        fabricGetServiceTypeListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetApplicationList_async(IFabricQueryClient10 * This,
+    const FABRIC_APPLICATION_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetApplicationListResult **fabricGetApplicationListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetApplicationList, &IFabricQueryClient10::EndGetApplicationList,
+        timeoutMilliseconds,
+        fabricGetApplicationListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetServiceList_async(IFabricQueryClient10 * This,
+    const FABRIC_SERVICE_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetServiceListResult** fabricGetServiceListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetServiceList, &IFabricQueryClient10::EndGetServiceList,
+        timeoutMilliseconds,
+        fabricGetServiceListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetPartitionList_async(IFabricQueryClient10 * This,
+    const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetPartitionListResult** fabricGetPartitionListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetPartitionList, &IFabricQueryClient10::EndGetPartitionList,
+        timeoutMilliseconds,
+        fabricGetPartitionListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetReplicaList_async(IFabricQueryClient10 * This,
+    const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetReplicaListResult** fabricGetReplicaListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetReplicaList, &IFabricQueryClient10::EndGetReplicaList,
+        timeoutMilliseconds,
+        fabricGetReplicaListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetDeployedApplicationList_async(IFabricQueryClient10 * This,
+    const FABRIC_DEPLOYED_APPLICATION_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetDeployedApplicationListResult** fabricGetDeployedApplicationListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetDeployedApplicationList, &IFabricQueryClient10::EndGetDeployedApplicationList,
+        timeoutMilliseconds,
+        fabricGetDeployedApplicationListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetDeployedServicePackageList_async(IFabricQueryClient10 * This,
+    const FABRIC_DEPLOYED_SERVICE_PACKAGE_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetDeployedServicePackageListResult** fabricGetDeployedServicePackageListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetDeployedServicePackageList, &IFabricQueryClient10::EndGetDeployedServicePackageList,
+        timeoutMilliseconds,
+        fabricGetDeployedServicePackageListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetDeployedServiceTypeList_async(IFabricQueryClient10 * This,
+    const FABRIC_DEPLOYED_SERVICE_TYPE_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetDeployedServiceTypeListResult** fabricGetDeployedServiceTypeListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetDeployedServiceTypeList, &IFabricQueryClient10::EndGetDeployedServiceTypeList,
+        timeoutMilliseconds,
+        fabricGetDeployedServiceTypeListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetDeployedCodePackageList_async(IFabricQueryClient10 * This,
+    const FABRIC_DEPLOYED_CODE_PACKAGE_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetDeployedCodePackageListResult** fabricGetDeployedCodePackageListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetDeployedCodePackageList, &IFabricQueryClient10::EndGetDeployedCodePackageList,
+        timeoutMilliseconds,
+        fabricGetDeployedCodePackageListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetDeployedReplicaList_async(IFabricQueryClient10 * This,
+    const FABRIC_DEPLOYED_SERVICE_REPLICA_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetDeployedReplicaListResult** fabricGetDeployedReplicaListResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetDeployedReplicaList, &IFabricQueryClient10::EndGetDeployedReplicaList,
+        timeoutMilliseconds,
+        fabricGetDeployedReplicaListResult,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetDeployedReplicaDetail_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_DEPLOYED_SERVICE_REPLICA_DETAIL_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetDeployedServiceReplicaDetailResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetDeployedReplicaDetail, &IFabricQueryClient10::EndGetDeployedReplicaDetail,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetClusterLoadInformation_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetClusterLoadInformationResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetClusterLoadInformation, &IFabricQueryClient10::EndGetClusterLoadInformation,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context);
+}
+
+HRESULT FQC10_GetPartitionLoadInformation_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_PARTITION_LOAD_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetPartitionLoadInformationResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetPartitionLoadInformation, &IFabricQueryClient10::EndGetPartitionLoadInformation,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetProvisionedFabricCodeVersionList_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_PROVISIONED_CODE_VERSION_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetProvisionedCodeVersionListResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetProvisionedFabricCodeVersionList, &IFabricQueryClient10::EndGetProvisionedFabricCodeVersionList,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetProvisionedFabricConfigVersionList_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_PROVISIONED_CONFIG_VERSION_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetProvisionedConfigVersionListResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetProvisionedFabricConfigVersionList, &IFabricQueryClient10::EndGetProvisionedFabricConfigVersionList,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetNodeLoadInformation_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_NODE_LOAD_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetNodeLoadInformationResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetNodeLoadInformation, &IFabricQueryClient10::EndGetNodeLoadInformation,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetReplicaLoadInformation_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_REPLICA_LOAD_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetReplicaLoadInformationResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetReplicaLoadInformation, &IFabricQueryClient10::EndGetReplicaLoadInformation,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetServiceGroupMemberList_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_SERVICE_GROUP_MEMBER_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetServiceGroupMemberListResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetServiceGroupMemberList, &IFabricQueryClient10::EndGetServiceGroupMemberList,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetServiceGroupMemberTypeList_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_SERVICE_GROUP_MEMBER_TYPE_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetServiceGroupMemberTypeListResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetServiceGroupMemberTypeList, &IFabricQueryClient10::EndGetServiceGroupMemberTypeList,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetUnplacedReplicaInformation_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_UNPLACED_REPLICA_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetUnplacedReplicaInformationResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetUnplacedReplicaInformation, &IFabricQueryClient10::EndGetUnplacedReplicaInformation,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetNodeList2_async(IFabricQueryClient10* This,
+    const FABRIC_NODE_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetNodeListResult2** result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetNodeList, &IFabricQueryClient10::EndGetNodeList2,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetApplicationList2_async(IFabricQueryClient10 * This,
+    const FABRIC_APPLICATION_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetApplicationListResult2 **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetApplicationList, &IFabricQueryClient10::EndGetApplicationList2,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetServiceList2_async(IFabricQueryClient10 * This,
+    const FABRIC_SERVICE_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetServiceListResult2** result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetServiceList, &IFabricQueryClient10::EndGetServiceList2,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetPartitionList2_async(IFabricQueryClient10 * This,
+    const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetPartitionListResult2** result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetPartitionList, &IFabricQueryClient10::EndGetPartitionList2,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetReplicaList2_async(IFabricQueryClient10 * This,
+    const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION *queryDescription,
+    DWORD timeoutMilliseconds,
+    IFabricGetReplicaListResult2** result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetReplicaList, &IFabricQueryClient10::EndGetReplicaList2,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetApplicationLoadInformation_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_APPLICATION_LOAD_INFORMATION_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetApplicationLoadInformationResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetApplicationLoadInformation, &IFabricQueryClient10::EndGetApplicationLoadInformation,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetServiceName_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_SERVICE_NAME_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetServiceNameResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetServiceName, &IFabricQueryClient10::EndGetServiceName,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetApplicationName_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_APPLICATION_NAME_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetApplicationNameResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetApplicationName, &IFabricQueryClient10::EndGetApplicationName,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetApplicationTypePagedList_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const PAGED_FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetApplicationTypePagedListResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetApplicationTypePagedList, &IFabricQueryClient10::EndGetApplicationTypePagedList,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
+
+HRESULT FQC10_GetDeployedApplicationPagedList_async(
+    IFabricQueryClient10 * This,
+    /* [in] */ const FABRIC_PAGED_DEPLOYED_APPLICATION_QUERY_DESCRIPTION *queryDescription,
+    /* [in] */ DWORD timeoutMilliseconds,
+    /* [retval][out] */ IFabricGetDeployedApplicationPagedListResult **result,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(This, &IFabricQueryClient10::BeginGetDeployedApplicationPagedList, &IFabricQueryClient10::EndGetDeployedApplicationPagedList,
+        timeoutMilliseconds,
+        result,
+        on_complete,
+        on_complete_context,
+        queryDescription);
+}
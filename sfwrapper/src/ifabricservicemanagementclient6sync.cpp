@@ -8,7 +8,6 @@
 #include "fabricclient.h"
 
 #include "sf_c_util/hresult_to_string.h"
-#include "mycallback.h"
 #include "servicefabricdox.h"
 
 #include "ifabricservicemanagementclient6sync.h"
@@ -187,3 +186,24 @@ HRESULT FSMC6_CreateServiceFromTemplate2(
         serviceFromTemplateDescription
     );
 }
+
+HRESULT FSMC6_ResolveServicePartition_async(IFabricServiceManagementClient6* client,
+    FABRIC_URI name,
+    FABRIC_PARTITION_KEY_TYPE partitionKeyType,
+    const void *partitionKey,
+    IFabricResolvedServicePartitionResult *previousResult,
+    DWORD timeoutMilliseconds,
+    IFabricResolvedServicePartitionResult **resolveServicePartitionResult,
+    SERVICEFABRIC_DOX_ON_COMPLETE on_complete,
+    void* on_complete_context)
+{
+    return ServiceFabric_DoX_Async(client, &IFabricServiceManagementClient6::BeginResolveServicePartition, &IFabricServiceManagementClient6::EndResolveServicePartition,
+        timeoutMilliseconds,
+        resolveServicePartitionResult,
+        on_complete,
+        on_complete_context,
+        name,
+        partitionKeyType,
+        partitionKey,
+        previousResult);
+}
@@ -0,0 +1,188 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <cstdint>
+#include <cinttypes>
+
+#include "windows.h"
+
+#include "fabriccommon.h"
+
+#include "macro_utils/macro_utils.h"
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/threadapi.h"
+
+#include "sf_c_util/hresult_to_string.h"
+
+#include "servicefabricdox_cancellation.h"
+
+/*the cancellation made current by the calling thread, see servicefabric_dox_cancellation_set_current*/
+static thread_local SERVICEFABRIC_DOX_CANCELLATION* current_cancellation = NULL;
+
+/*the timer wheel of the deadlines of the asynchronous operations started by the calling thread, see servicefabric_dox_cancellation_set_current_timer_wheel*/
+static thread_local TIMER_WHEEL_HANDLE current_timer_wheel = NULL;
+
+static void cancellation_lock(SERVICEFABRIC_DOX_CANCELLATION* cancellation)
+{
+    while (interlocked_compare_exchange(&cancellation->lock, 1, 0) != 0)
+    {
+        /*the lock is only held while the operation is changed, cancelled or begins*/
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&cancellation->lock, 0, UINT32_MAX);
+        if (wait_result != INTERLOCKED_HL_OK)
+        {
+            LogError("failure in InterlockedHL_WaitForValue(&cancellation->lock=%p, 0, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d", &cancellation->lock, (int)wait_result);
+            /*try again*/
+        }
+    }
+}
+
+static void cancellation_unlock(SERVICEFABRIC_DOX_CANCELLATION* cancellation)
+{
+    (void)interlocked_exchange(&cancellation->lock, 0);
+    wake_by_address_single(&cancellation->lock);
+}
+
+static void cancel_operation(IFabricAsyncOperationContext* operation)
+{
+    /*Service Fabric completes the operation (and calls the callback of ServiceFabric_DoX) once it is cancelled*/
+    HRESULT hr = operation->Cancel();
+    if (FAILED(hr))
+    {
+        LogHRESULTError(hr, "failure in Cancel, the operation will complete on its own");
+    }
+}
+
+void servicefabric_dox_cancellation_init(SERVICEFABRIC_DOX_CANCELLATION* cancellation)
+{
+    if (cancellation == NULL)
+    {
+        LogError("Invalid arguments: SERVICEFABRIC_DOX_CANCELLATION* cancellation=%p", cancellation);
+    }
+    else
+    {
+        (void)interlocked_exchange(&cancellation->lock, 0);
+        (void)interlocked_exchange(&cancellation->is_cancelled, 0);
+        cancellation->operation = NULL;
+    }
+}
+
+void servicefabric_dox_cancellation_cancel(SERVICEFABRIC_DOX_CANCELLATION* cancellation)
+{
+    if (cancellation == NULL)
+    {
+        LogError("Invalid arguments: SERVICEFABRIC_DOX_CANCELLATION* cancellation=%p", cancellation);
+    }
+    else
+    {
+        /*waits for an operation that is beginning, after this no operation begins*/
+        cancellation_lock(cancellation);
+        (void)interlocked_exchange(&cancellation->is_cancelled, 1);
+        wake_by_address_all(&cancellation->is_cancelled);
+        if (cancellation->operation != NULL)
+        {
+            cancel_operation(cancellation->operation);
+        }
+        cancellation_unlock(cancellation);
+    }
+}
+
+void servicefabric_dox_cancellation_set_current(SERVICEFABRIC_DOX_CANCELLATION* cancellation)
+{
+    current_cancellation = cancellation;
+}
+
+bool servicefabric_dox_cancellation_is_current_cancelled(void)
+{
+    return
+        (current_cancellation != NULL) &&
+        (interlocked_add(&current_cancellation->is_cancelled, 0) != 0);
+}
+
+bool servicefabric_dox_cancellation_sleep(uint32_t milliseconds)
+{
+    bool result;
+    if (current_cancellation == NULL)
+    {
+        /*nobody can cancel the sleep of this thread*/
+        ThreadAPI_Sleep(milliseconds);
+        result = true;
+    }
+    else
+    {
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&current_cancellation->is_cancelled, 1, milliseconds);
+        if (wait_result == INTERLOCKED_HL_ERROR)
+        {
+            LogError("failure in InterlockedHL_WaitForValue(&current_cancellation->is_cancelled=%p, 1, milliseconds=%" PRIu32 "), sleeping without cancellation", &current_cancellation->is_cancelled, milliseconds);
+            ThreadAPI_Sleep(milliseconds);
+        }
+        result = (interlocked_add(&current_cancellation->is_cancelled, 0) == 0);
+    }
+    return result;
+}
+
+bool servicefabric_dox_cancellation_begin_operation(void)
+{
+    bool result;
+    if (current_cancellation == NULL)
+    {
+        /*nobody can cancel the operations of this thread*/
+        result = true;
+    }
+    else
+    {
+        /*released by servicefabric_dox_cancellation_register_operation*/
+        cancellation_lock(current_cancellation);
+        if (interlocked_add(&current_cancellation->is_cancelled, 0) != 0)
+        {
+            cancellation_unlock(current_cancellation);
+            result = false;
+        }
+        else
+        {
+            result = true;
+        }
+    }
+    return result;
+}
+
+void servicefabric_dox_cancellation_register_operation(IFabricAsyncOperationContext* operation)
+{
+    if (current_cancellation == NULL)
+    {
+        /*nobody can cancel the operations of this thread*/
+    }
+    else
+    {
+        /*the lock is held since servicefabric_dox_cancellation_begin_operation, so the cancellation was not cancelled while the operation began*/
+        current_cancellation->operation = operation;
+        cancellation_unlock(current_cancellation);
+    }
+}
+
+void servicefabric_dox_cancellation_unregister_operation(void)
+{
+    if (current_cancellation == NULL)
+    {
+        /*nothing was registered*/
+    }
+    else
+    {
+        /*after this the operation can be released by ServiceFabric_DoX*/
+        cancellation_lock(current_cancellation);
+        current_cancellation->operation = NULL;
+        cancellation_unlock(current_cancellation);
+    }
+}
+
+void servicefabric_dox_cancellation_set_current_timer_wheel(TIMER_WHEEL_HANDLE timer_wheel)
+{
+    current_timer_wheel = timer_wheel;
+}
+
+TIMER_WHEEL_HANDLE servicefabric_dox_cancellation_get_current_timer_wheel(void)
+{
+    return current_timer_wheel;
+}
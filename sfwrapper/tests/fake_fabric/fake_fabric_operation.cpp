@@ -0,0 +1,375 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <cstdint>
+#include <cinttypes>
+#include <new>
+
+#include "windows.h"
+
+#include "fabriccommon.h"
+
+#include "macro_utils/macro_utils.h"
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/threadapi.h"
+
+#include "sf_c_util/hresult_to_string.h"
+#include "sf_c_util/timer_wheel.h"
+
+#include "fake_fabric_runtime.h"
+#include "fake_fabric_operation.h"
+
+FakeFabricOperation::FakeFabricOperation(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, IFabricAsyncOperationCallback* callback) :
+    runtime(runtime),
+    operation(operation),
+    callback(callback),
+    completedSynchronously(FALSE),
+    timedOut(false),
+    endResult(S_OK),
+    output(NULL),
+    value(0),
+    callbackThread(NULL)
+{
+    (void)interlocked_exchange(&refCount, 1);
+    (void)interlocked_exchange(&isCompleted, 0);
+    (void)interlocked_exchange(&isCancelled, 0);
+    timer_wheel_timer_init(&timer);
+    if (callback != NULL)
+    {
+        (void)callback->AddRef();
+    }
+}
+
+FakeFabricOperation::~FakeFabricOperation()
+{
+    if (output != NULL)
+    {
+        (void)output->Release();
+    }
+    if (callback != NULL)
+    {
+        (void)callback->Release();
+    }
+}
+
+HRESULT FakeFabricOperation::Begin(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, const void* description, DWORD timeoutMilliseconds, FAKE_FABRIC_CREATE_DEFAULT_RESULT create_default_result,
+    IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context)
+{
+    HRESULT result;
+    if (context == NULL)
+    {
+        LogError("invalid arguments FAKE_FABRIC_OPERATION operation=%" PRI_MU_ENUM ", IFabricAsyncOperationContext** context=%p", MU_ENUM_VALUE(FAKE_FABRIC_OPERATION, operation), context);
+        result = E_POINTER;
+    }
+    else
+    {
+        FAKE_FABRIC_RUNTIME_COUNTERS* counters = fake_fabric_runtime_get_counters(runtime, operation);
+        (void)interlocked_increment_64(&counters->begun);
+
+        FAKE_FABRIC_DRAW draw;
+        fake_fabric_runtime_draw(runtime, operation, timeoutMilliseconds, &draw);
+        if (FAILED(draw.begin_result))
+        {
+            /*an injected failure, nothing started*/
+            (void)interlocked_increment_64(&counters->failed_at_begin);
+            result = draw.begin_result;
+        }
+        else
+        {
+            FakeFabricOperation* fakeOperation = new (std::nothrow) FakeFabricOperation(runtime, operation, callback);
+            if (fakeOperation == NULL)
+            {
+                LogError("failure in new FakeFabricOperation");
+                result = E_OUTOFMEMORY;
+            }
+            else
+            {
+                fakeOperation->completedSynchronously = draw.completes_synchronously ? TRUE : FALSE;
+                fakeOperation->timedOut = draw.timed_out;
+                fakeOperation->endResult = draw.end_result;
+                fakeOperation->callbackThread = draw.callback_thread;
+
+                if (SUCCEEDED(fakeOperation->endResult))
+                {
+                    if (create_default_result != NULL)
+                    {
+                        HRESULT hr = fake_fabric_runtime_create_result(runtime, operation, description, create_default_result, &fakeOperation->output);
+                        if (FAILED(hr))
+                        {
+                            LogHRESULTError(hr, "failure in fake_fabric_runtime_create_result(runtime=%p, operation=%" PRI_MU_ENUM ", description=%p)", runtime, MU_ENUM_VALUE(FAKE_FABRIC_OPERATION, operation), description);
+                            fakeOperation->endResult = hr;
+                        }
+                    }
+                    else if (operation == FAKE_FABRIC_OPERATION_REGISTER_SERVICE_NOTIFICATION_FILTER)
+                    {
+                        fakeOperation->value = fake_fabric_runtime_next_id(runtime);
+                    }
+                    else
+                    {
+                        /*nothing to produce*/
+                    }
+                }
+
+                (void)interlocked_increment_64(&counters->in_flight);
+                fake_fabric_runtime_operation_started(runtime);
+
+                /*the reference taken at construction is the one of the caller*/
+                *context = fakeOperation;
+
+                if (fakeOperation->completedSynchronously)
+                {
+                    /*the latency is spent on the calling thread, same as a Service Fabric call that completes synchronously does its work on the calling thread*/
+                    if (draw.latency_ms > 0)
+                    {
+                        ThreadAPI_Sleep(draw.latency_ms);
+                    }
+                    fakeOperation->Complete();
+                }
+                else
+                {
+                    /*the timer has its own reference, given back by OnTimer*/
+                    (void)fakeOperation->AddRef();
+                    if (timer_wheel_schedule(fakeOperation->callbackThread, &fakeOperation->timer, draw.latency_ms, OnTimer, fakeOperation) != 0)
+                    {
+                        LogError("failure in timer_wheel_schedule(callbackThread=%p, &timer=%p, latency_ms=%" PRIu32 "), completing on the calling thread", fakeOperation->callbackThread, &fakeOperation->timer, draw.latency_ms);
+                        fakeOperation->Complete();
+                        (void)fakeOperation->Release();
+                    }
+                }
+                result = S_OK;
+            }
+        }
+    }
+    return result;
+}
+
+HRESULT FakeFabricOperation::End(IFabricAsyncOperationContext* context)
+{
+    HRESULT result;
+    if (context == NULL)
+    {
+        LogError("invalid arguments IFabricAsyncOperationContext* context=%p", context);
+        result = E_POINTER;
+    }
+    else
+    {
+        FakeFabricOperation* fakeOperation = static_cast<FakeFabricOperation*>(context);
+        result = fakeOperation->WaitForCompletion();
+        if (SUCCEEDED(result))
+        {
+            result = fakeOperation->endResult;
+        }
+    }
+    return result;
+}
+
+HRESULT FakeFabricOperation::End(IFabricAsyncOperationContext* context, LONGLONG* value)
+{
+    HRESULT result;
+    if (value == NULL)
+    {
+        LogError("invalid arguments IFabricAsyncOperationContext* context=%p, LONGLONG* value=%p", context, value);
+        result = E_POINTER;
+    }
+    else
+    {
+        result = End(context);
+        if (SUCCEEDED(result))
+        {
+            *value = static_cast<FakeFabricOperation*>(context)->value;
+        }
+    }
+    return result;
+}
+
+HRESULT FakeFabricOperation::EndWithOutput(IFabricAsyncOperationContext* context, IUnknown** output)
+{
+    HRESULT result = End(context);
+    if (SUCCEEDED(result))
+    {
+        FakeFabricOperation* fakeOperation = static_cast<FakeFabricOperation*>(context);
+        if (fakeOperation->output == NULL)
+        {
+            LogError("operation=%" PRI_MU_ENUM " succeeded without producing anything", MU_ENUM_VALUE(FAKE_FABRIC_OPERATION, fakeOperation->operation));
+            result = E_FAIL;
+        }
+        else
+        {
+            (void)fakeOperation->output->AddRef();
+            *output = fakeOperation->output;
+        }
+    }
+    return result;
+}
+
+void FakeFabricOperation::OnTimer(void* context, bool is_cancelled)
+{
+    FakeFabricOperation* fakeOperation = static_cast<FakeFabricOperation*>(context);
+    /*when the callback thread is destroyed the operation completes right away, nobody would complete it otherwise*/
+    (void)is_cancelled;
+    fakeOperation->Complete();
+    /*the reference of the timer*/
+    (void)fakeOperation->Release();
+}
+
+HRESULT FakeFabricOperation::WaitForCompletion(void)
+{
+    HRESULT result;
+    /*same as Service Fabric, End blocks until the operation completes*/
+    INTERLOCKED_HL_RESULT waitResult = InterlockedHL_WaitForValue(&isCompleted, 1, UINT32_MAX);
+    if (waitResult != INTERLOCKED_HL_OK)
+    {
+        LogError("failure in InterlockedHL_WaitForValue(&isCompleted=%p, 1, UINT32_MAX), INTERLOCKED_HL_RESULT waitResult=%d", &isCompleted, (int)waitResult);
+        result = E_FAIL;
+    }
+    else
+    {
+        result = S_OK;
+    }
+    return result;
+}
+
+void FakeFabricOperation::Complete(void)
+{
+    FAKE_FABRIC_RUNTIME_COUNTERS* counters = fake_fabric_runtime_get_counters(runtime, operation);
+
+    (void)interlocked_exchange(&isCompleted, 1);
+    wake_by_address_all(&isCompleted);
+
+    if (callback != NULL)
+    {
+        callback->Invoke(this);
+    }
+
+    (void)interlocked_increment_64(completedSynchronously ? &counters->completed_synchronously : &counters->completed_asynchronously);
+    if (interlocked_add(&isCancelled, 0) != 0)
+    {
+        /*already counted by Cancel*/
+    }
+    else if (timedOut)
+    {
+        (void)interlocked_increment_64(&counters->timed_out);
+    }
+    else if (FAILED(endResult))
+    {
+        (void)interlocked_increment_64(&counters->failed_at_end);
+    }
+    else
+    {
+        /*nothing else to count*/
+    }
+    (void)interlocked_decrement_64(&counters->in_flight);
+
+    /*last, the runtime can be destroyed after this*/
+    fake_fabric_runtime_operation_ended(runtime);
+}
+
+HRESULT STDMETHODCALLTYPE FakeFabricOperation::QueryInterface(REFIID riid, void** ppvObject)
+{
+    HRESULT result;
+    if (ppvObject == NULL)
+    {
+        LogError("Invalid arguments: REFIID riid, void** ppvObject=%p", ppvObject);
+        result = E_POINTER;
+    }
+    else if (
+        IsEqualIID(riid, IID_IUnknown) ||
+        IsEqualIID(riid, IID_IFabricAsyncOperationContext)
+        )
+    {
+        *ppvObject = static_cast<IFabricAsyncOperationContext*>(this);
+        (void)AddRef();
+        result = S_OK;
+    }
+    else
+    {
+        *ppvObject = NULL;
+        result = E_NOINTERFACE;
+    }
+    return result;
+}
+
+ULONG STDMETHODCALLTYPE FakeFabricOperation::AddRef(void)
+{
+    return (ULONG)interlocked_increment(&refCount);
+}
+
+ULONG STDMETHODCALLTYPE FakeFabricOperation::Release(void)
+{
+    int32_t result = interlocked_decrement(&refCount);
+    if (result == 0)
+    {
+        delete this;
+    }
+    return (ULONG)result;
+}
+
+BOOLEAN STDMETHODCALLTYPE FakeFabricOperation::IsCompleted(void)
+{
+    return (interlocked_add(&isCompleted, 0) != 0) ? TRUE : FALSE;
+}
+
+BOOLEAN STDMETHODCALLTYPE FakeFabricOperation::CompletedSynchronously(void)
+{
+    return completedSynchronously;
+}
+
+HRESULT STDMETHODCALLTYPE FakeFabricOperation::get_Callback(IFabricAsyncOperationCallback** result)
+{
+    HRESULT hr;
+    if (result == NULL)
+    {
+        LogError("invalid arguments IFabricAsyncOperationCallback** result=%p", result);
+        hr = E_POINTER;
+    }
+    else
+    {
+        if (callback != NULL)
+        {
+            (void)callback->AddRef();
+        }
+        *result = callback;
+        hr = S_OK;
+    }
+    return hr;
+}
+
+HRESULT STDMETHODCALLTYPE FakeFabricOperation::Cancel(void)
+{
+    /*only an operation still waiting for its latency on a callback thread can be cancelled, and only once*/
+    if (
+        (callbackThread != NULL) &&
+        (interlocked_compare_exchange(&isCancelled, 1, 0) == 0)
+        )
+    {
+        if (!timer_wheel_cancel(callbackThread, &timer))
+        {
+            /*too late, OnTimer runs or already ran*/
+            (void)interlocked_exchange(&isCancelled, 0);
+        }
+        else
+        {
+            FAKE_FABRIC_RUNTIME_COUNTERS* counters = fake_fabric_runtime_get_counters(runtime, operation);
+            (void)interlocked_increment_64(&counters->cancelled);
+
+            endResult = E_ABORT;
+            if (output != NULL)
+            {
+                (void)output->Release();
+                output = NULL;
+            }
+
+            /*same as Service Fabric, the callback of a cancelled operation still runs, and not on the thread that cancels*/
+            if (timer_wheel_schedule(callbackThread, &timer, 0, OnTimer, this) != 0)
+            {
+                LogError("failure in timer_wheel_schedule(callbackThread=%p, &timer=%p, 0), completing on the calling thread", callbackThread, &timer);
+                OnTimer(this);
+            }
+        }
+    }
+    /*Cancel is best effort, same as Service Fabric*/
+    return S_OK;
+}
@@ -0,0 +1,161 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef FAKE_FABRIC_OPERATION_H
+#define FAKE_FABRIC_OPERATION_H
+
+#include <cstdint>
+
+#include "windows.h"
+
+#include "fabriccommon.h"
+
+#include "c_pal/interlocked.h"
+
+#include "sf_c_util/timer_wheel.h"
+
+#include "fake_fabric_runtime.h"
+
+/*this header is shared by the pieces of the fake, it is not meant to be included by tests*/
+
+/*what the runtime drew for one call of Begin*/
+typedef struct FAKE_FABRIC_DRAW_TAG
+{
+    HRESULT begin_result; /*a failure makes Begin return it*/
+    HRESULT end_result; /*a failure makes End return it*/
+    bool timed_out; /*end_result is FABRIC_E_TIMEOUT because the latency was longer than timeoutMilliseconds*/
+    bool completes_synchronously;
+    uint32_t latency_ms;
+    TIMER_WHEEL_HANDLE callback_thread; /*where an asynchronous completion runs*/
+} FAKE_FABRIC_DRAW;
+
+typedef struct FAKE_FABRIC_RUNTIME_COUNTERS_TAG
+{
+    volatile_atomic int64_t begun;
+    volatile_atomic int64_t failed_at_begin;
+    volatile_atomic int64_t completed_synchronously;
+    volatile_atomic int64_t completed_asynchronously;
+    volatile_atomic int64_t failed_at_end;
+    volatile_atomic int64_t timed_out;
+    volatile_atomic int64_t cancelled;
+    volatile_atomic int64_t in_flight;
+} FAKE_FABRIC_RUNTIME_COUNTERS;
+
+/*creates the empty result of an operation, description is the first argument of Begin*/
+typedef HRESULT (*FAKE_FABRIC_CREATE_DEFAULT_RESULT)(FAKE_FABRIC_RUNTIME_HANDLE runtime, const void* description, IUnknown** result);
+
+/*implemented by fake_fabric_runtime.cpp for the other pieces of the fake*/
+void fake_fabric_runtime_draw(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, DWORD timeoutMilliseconds, FAKE_FABRIC_DRAW* draw);
+HRESULT fake_fabric_runtime_create_result(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, const void* description, FAKE_FABRIC_CREATE_DEFAULT_RESULT create_default_result, IUnknown** result);
+FAKE_FABRIC_RUNTIME_COUNTERS* fake_fabric_runtime_get_counters(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation);
+void fake_fabric_runtime_operation_started(FAKE_FABRIC_RUNTIME_HANDLE runtime);
+void fake_fabric_runtime_operation_ended(FAKE_FABRIC_RUNTIME_HANDLE runtime);
+/*unique and increasing for the life of the runtime: filter ids, handler ids, versions of resolved partitions*/
+LONGLONG fake_fabric_runtime_next_id(FAKE_FABRIC_RUNTIME_HANDLE runtime);
+
+/*implemented by the fake clients*/
+HRESULT fake_fabric_query_client_create(FAKE_FABRIC_RUNTIME_HANDLE runtime, IFabricQueryClient10** client);
+HRESULT fake_fabric_service_management_client_create(FAKE_FABRIC_RUNTIME_HANDLE runtime, IFabricServiceManagementClient6** client);
+
+/*the IFabricAsyncOperationContext of every Begin of the fake clients*/
+class FakeFabricOperation final : public IFabricAsyncOperationContext
+{
+public:
+    /*draws what happens to the operation, creates its output and completes it before returning (synchronous completion) or on a callback thread of the runtime*/
+    static HRESULT Begin(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, const void* description, DWORD timeoutMilliseconds, FAKE_FABRIC_CREATE_DEFAULT_RESULT create_default_result,
+        IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context);
+
+    /*End of the operations that do not produce anything*/
+    static HRESULT End(IFabricAsyncOperationContext* context);
+
+    /*End of the operations that produce a COM object, every call of End gives out a new reference on it*/
+    template<typename TResult>
+    static HRESULT End(IFabricAsyncOperationContext* context, TResult** result)
+    {
+        HRESULT hr;
+        if (result == NULL)
+        {
+            hr = E_POINTER;
+        }
+        else
+        {
+            IUnknown* output;
+            hr = EndWithOutput(context, &output);
+            if (SUCCEEDED(hr))
+            {
+                *result = static_cast<TResult*>(output);
+            }
+        }
+        return hr;
+    }
+
+    /*End of RegisterServiceNotificationFilter*/
+    static HRESULT End(IFabricAsyncOperationContext* context, LONGLONG* value);
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override;
+    ULONG STDMETHODCALLTYPE AddRef(void) override;
+    ULONG STDMETHODCALLTYPE Release(void) override;
+
+    BOOLEAN STDMETHODCALLTYPE IsCompleted(void) override;
+    BOOLEAN STDMETHODCALLTYPE CompletedSynchronously(void) override;
+    HRESULT STDMETHODCALLTYPE get_Callback(IFabricAsyncOperationCallback** callback) override;
+    HRESULT STDMETHODCALLTYPE Cancel(void) override;
+
+private:
+    FakeFabricOperation(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, IFabricAsyncOperationCallback* callback);
+    ~FakeFabricOperation();
+
+    static HRESULT EndWithOutput(IFabricAsyncOperationContext* context, IUnknown** output);
+    static void OnTimer(void* context, bool is_cancelled);
+
+    HRESULT WaitForCompletion(void);
+    void Complete(void);
+
+    volatile_atomic int32_t refCount;
+    volatile_atomic int32_t isCompleted;
+    volatile_atomic int32_t isCancelled;
+    FAKE_FABRIC_RUNTIME_HANDLE runtime;
+    FAKE_FABRIC_OPERATION operation;
+    IFabricAsyncOperationCallback* callback;
+    BOOLEAN completedSynchronously;
+    bool timedOut;
+    HRESULT endResult; /*written before the operation completes, read after*/
+    IUnknown* output; /*1 reference owned by the operation, NULL when the operation does not produce a COM object or failed*/
+    LONGLONG value;
+    TIMER_WHEEL_HANDLE callbackThread;
+    TIMER_WHEEL_TIMER timer;
+};
+
+#define FAKE_FABRIC_EXPAND(...) __VA_ARGS__
+
+/*the Begin/End pair of an operation of a fake client. BEGIN_ARGS are the arguments of Begin before timeoutMilliseconds, in parentheses. DESCRIPTION is what create_result gets, CREATE_DEFAULT_RESULT makes the empty result*/
+#define FAKE_FABRIC_DEFINE_OPERATION(OPERATION, METHOD, RESULT_INTERFACE, CREATE_DEFAULT_RESULT, DESCRIPTION, BEGIN_ARGS)              \
+    HRESULT STDMETHODCALLTYPE MU_C2(Begin, METHOD)(FAKE_FABRIC_EXPAND BEGIN_ARGS, DWORD timeoutMilliseconds,                            \
+        IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context) override                                       \
+    {                                                                                                                                   \
+        return FakeFabricOperation::Begin(runtime, OPERATION, DESCRIPTION, timeoutMilliseconds, CREATE_DEFAULT_RESULT, callback, context); \
+    }                                                                                                                                   \
+    HRESULT STDMETHODCALLTYPE MU_C2(End, METHOD)(IFabricAsyncOperationContext* context, RESULT_INTERFACE** result) override             \
+    {                                                                                                                                   \
+        return FakeFabricOperation::End(context, result);                                                                               \
+    }                                                                                                                                   \
+
+/*same as FAKE_FABRIC_DEFINE_OPERATION, for the operations that do not produce anything*/
+#define FAKE_FABRIC_DEFINE_OPERATION_NO_RESULT(OPERATION, METHOD, DESCRIPTION, BEGIN_ARGS)                                              \
+    HRESULT STDMETHODCALLTYPE MU_C2(Begin, METHOD)(FAKE_FABRIC_EXPAND BEGIN_ARGS, DWORD timeoutMilliseconds,                            \
+        IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context) override                                       \
+    {                                                                                                                                   \
+        return FakeFabricOperation::Begin(runtime, OPERATION, DESCRIPTION, timeoutMilliseconds, NULL, callback, context);              \
+    }                                                                                                                                   \
+    HRESULT STDMETHODCALLTYPE MU_C2(End, METHOD)(IFabricAsyncOperationContext* context) override                                       \
+    {                                                                                                                                   \
+        return FakeFabricOperation::End(context);                                                                                       \
+    }                                                                                                                                   \
+
+/*an End method that shares its Begin with another End method (for example EndGetNodeList2 and BeginGetNodeList)*/
+#define FAKE_FABRIC_DEFINE_END(METHOD, RESULT_INTERFACE)                                                                                \
+    HRESULT STDMETHODCALLTYPE MU_C2(End, METHOD)(IFabricAsyncOperationContext* context, RESULT_INTERFACE** result) override             \
+    {                                                                                                                                   \
+        return FakeFabricOperation::End(context, result);                                                                               \
+    }                                                                                                                                   \
+
+#endif /*FAKE_FABRIC_OPERATION_H*/
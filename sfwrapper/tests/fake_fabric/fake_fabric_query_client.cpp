@@ -0,0 +1,189 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <cstdint>
+#include <new>
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+
+#include "fake_fabric_runtime.h"
+#include "fake_fabric_operation.h"
+#include "fake_fabric_results.h"
+
+/*every query of IFabricQueryClient10 is an operation of the runtime, see fake_fabric_runtime.h*/
+class FakeFabricQueryClient final : public IFabricQueryClient10
+{
+public:
+    explicit FakeFabricQueryClient(FAKE_FABRIC_RUNTIME_HANDLE runtime) :
+        runtime(runtime)
+    {
+        (void)interlocked_exchange(&refCount, 1);
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override
+    {
+        HRESULT result;
+        if (ppvObject == NULL)
+        {
+            LogError("Invalid arguments: REFIID riid, void** ppvObject=%p", ppvObject);
+            result = E_POINTER;
+        }
+        else if (
+            IsEqualIID(riid, IID_IUnknown) ||
+            IsEqualIID(riid, IID_IFabricQueryClient) ||
+            IsEqualIID(riid, IID_IFabricQueryClient2) ||
+            IsEqualIID(riid, IID_IFabricQueryClient3) ||
+            IsEqualIID(riid, IID_IFabricQueryClient4) ||
+            IsEqualIID(riid, IID_IFabricQueryClient5) ||
+            IsEqualIID(riid, IID_IFabricQueryClient6) ||
+            IsEqualIID(riid, IID_IFabricQueryClient7) ||
+            IsEqualIID(riid, IID_IFabricQueryClient8) ||
+            IsEqualIID(riid, IID_IFabricQueryClient9) ||
+            IsEqualIID(riid, IID_IFabricQueryClient10)
+            )
+        {
+            *ppvObject = static_cast<IFabricQueryClient10*>(this);
+            (void)AddRef();
+            result = S_OK;
+        }
+        else
+        {
+            *ppvObject = NULL;
+            result = E_NOINTERFACE;
+        }
+        return result;
+    }
+
+    ULONG STDMETHODCALLTYPE AddRef(void) override
+    {
+        return (ULONG)interlocked_increment(&refCount);
+    }
+
+    ULONG STDMETHODCALLTYPE Release(void) override
+    {
+        int32_t result = interlocked_decrement(&refCount);
+        if (result == 0)
+        {
+            delete this;
+        }
+        return (ULONG)result;
+    }
+
+    /*IFabricQueryClient*/
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_NODE_LIST, GetNodeList, IFabricGetNodeListResult, FakeIFabricGetNodeListResult2::Create, queryDescription,
+        (const FABRIC_NODE_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_APPLICATION_TYPE_LIST, GetApplicationTypeList, IFabricGetApplicationTypeListResult, FakeIFabricGetApplicationTypeListResult::Create, queryDescription,
+        (const FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_SERVICE_TYPE_LIST, GetServiceTypeList, IFabricGetServiceTypeListResult, FakeIFabricGetServiceTypeListResult::Create, queryDescription,
+        (const FABRIC_SERVICE_TYPE_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_APPLICATION_LIST, GetApplicationList, IFabricGetApplicationListResult, FakeIFabricGetApplicationListResult2::Create, queryDescription,
+        (const FABRIC_APPLICATION_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_SERVICE_LIST, GetServiceList, IFabricGetServiceListResult, FakeIFabricGetServiceListResult2::Create, queryDescription,
+        (const FABRIC_SERVICE_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_PARTITION_LIST, GetPartitionList, IFabricGetPartitionListResult, FakeIFabricGetPartitionListResult2::Create, queryDescription,
+        (const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_REPLICA_LIST, GetReplicaList, IFabricGetReplicaListResult, FakeIFabricGetReplicaListResult2::Create, queryDescription,
+        (const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_DEPLOYED_APPLICATION_LIST, GetDeployedApplicationList, IFabricGetDeployedApplicationListResult, FakeIFabricGetDeployedApplicationListResult::Create, queryDescription,
+        (const FABRIC_DEPLOYED_APPLICATION_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_DEPLOYED_SERVICE_PACKAGE_LIST, GetDeployedServicePackageList, IFabricGetDeployedServicePackageListResult, FakeIFabricGetDeployedServicePackageListResult::Create, queryDescription,
+        (const FABRIC_DEPLOYED_SERVICE_PACKAGE_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_DEPLOYED_SERVICE_TYPE_LIST, GetDeployedServiceTypeList, IFabricGetDeployedServiceTypeListResult, FakeIFabricGetDeployedServiceTypeListResult::Create, queryDescription,
+        (const FABRIC_DEPLOYED_SERVICE_TYPE_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_DEPLOYED_CODE_PACKAGE_LIST, GetDeployedCodePackageList, IFabricGetDeployedCodePackageListResult, FakeIFabricGetDeployedCodePackageListResult::Create, queryDescription,
+        (const FABRIC_DEPLOYED_CODE_PACKAGE_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_DEPLOYED_REPLICA_LIST, GetDeployedReplicaList, IFabricGetDeployedReplicaListResult, FakeIFabricGetDeployedReplicaListResult::Create, queryDescription,
+        (const FABRIC_DEPLOYED_SERVICE_REPLICA_QUERY_DESCRIPTION* queryDescription))
+
+    /*IFabricQueryClient2*/
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_DEPLOYED_REPLICA_DETAIL, GetDeployedReplicaDetail, IFabricGetDeployedServiceReplicaDetailResult, FakeIFabricGetDeployedServiceReplicaDetailResult::Create, queryDescription,
+        (const FABRIC_DEPLOYED_SERVICE_REPLICA_DETAIL_QUERY_DESCRIPTION* queryDescription))
+
+    /*no description, so not FAKE_FABRIC_DEFINE_OPERATION*/
+    HRESULT STDMETHODCALLTYPE BeginGetClusterLoadInformation(DWORD timeoutMilliseconds, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context) override
+    {
+        return FakeFabricOperation::Begin(runtime, FAKE_FABRIC_OPERATION_GET_CLUSTER_LOAD_INFORMATION, NULL, timeoutMilliseconds, FakeIFabricGetClusterLoadInformationResult::Create, callback, context);
+    }
+
+    HRESULT STDMETHODCALLTYPE EndGetClusterLoadInformation(IFabricAsyncOperationContext* context, IFabricGetClusterLoadInformationResult** result) override
+    {
+        return FakeFabricOperation::End(context, result);
+    }
+
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_PARTITION_LOAD_INFORMATION, GetPartitionLoadInformation, IFabricGetPartitionLoadInformationResult, FakeIFabricGetPartitionLoadInformationResult::Create, queryDescription,
+        (const FABRIC_PARTITION_LOAD_INFORMATION_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_PROVISIONED_FABRIC_CODE_VERSION_LIST, GetProvisionedFabricCodeVersionList, IFabricGetProvisionedCodeVersionListResult, FakeIFabricGetProvisionedCodeVersionListResult::Create, queryDescription,
+        (const FABRIC_PROVISIONED_CODE_VERSION_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_PROVISIONED_FABRIC_CONFIG_VERSION_LIST, GetProvisionedFabricConfigVersionList, IFabricGetProvisionedConfigVersionListResult, FakeIFabricGetProvisionedConfigVersionListResult::Create, queryDescription,
+        (const FABRIC_PROVISIONED_CONFIG_VERSION_QUERY_DESCRIPTION* queryDescription))
+
+    /*IFabricQueryClient3*/
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_NODE_LOAD_INFORMATION, GetNodeLoadInformation, IFabricGetNodeLoadInformationResult, FakeIFabricGetNodeLoadInformationResult::Create, queryDescription,
+        (const FABRIC_NODE_LOAD_INFORMATION_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_REPLICA_LOAD_INFORMATION, GetReplicaLoadInformation, IFabricGetReplicaLoadInformationResult, FakeIFabricGetReplicaLoadInformationResult::Create, queryDescription,
+        (const FABRIC_REPLICA_LOAD_INFORMATION_QUERY_DESCRIPTION* queryDescription))
+
+    /*IFabricQueryClient4*/
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_SERVICE_GROUP_MEMBER_LIST, GetServiceGroupMemberList, IFabricGetServiceGroupMemberListResult, FakeIFabricGetServiceGroupMemberListResult::Create, queryDescription,
+        (const FABRIC_SERVICE_GROUP_MEMBER_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_SERVICE_GROUP_MEMBER_TYPE_LIST, GetServiceGroupMemberTypeList, IFabricGetServiceGroupMemberTypeListResult, FakeIFabricGetServiceGroupMemberTypeListResult::Create, queryDescription,
+        (const FABRIC_SERVICE_GROUP_MEMBER_TYPE_QUERY_DESCRIPTION* queryDescription))
+
+    /*IFabricQueryClient5*/
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_UNPLACED_REPLICA_INFORMATION, GetUnplacedReplicaInformation, IFabricGetUnplacedReplicaInformationResult, FakeIFabricGetUnplacedReplicaInformationResult::Create, queryDescription,
+        (const FABRIC_UNPLACED_REPLICA_INFORMATION_QUERY_DESCRIPTION* queryDescription))
+
+    /*IFabricQueryClient6, the Begin methods are the ones of IFabricQueryClient*/
+    FAKE_FABRIC_DEFINE_END(GetNodeList2, IFabricGetNodeListResult2)
+    FAKE_FABRIC_DEFINE_END(GetApplicationList2, IFabricGetApplicationListResult2)
+    FAKE_FABRIC_DEFINE_END(GetServiceList2, IFabricGetServiceListResult2)
+    FAKE_FABRIC_DEFINE_END(GetPartitionList2, IFabricGetPartitionListResult2)
+    FAKE_FABRIC_DEFINE_END(GetReplicaList2, IFabricGetReplicaListResult2)
+
+    /*IFabricQueryClient7*/
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_APPLICATION_LOAD_INFORMATION, GetApplicationLoadInformation, IFabricGetApplicationLoadInformationResult, FakeIFabricGetApplicationLoadInformationResult::Create, queryDescription,
+        (const FABRIC_APPLICATION_LOAD_INFORMATION_QUERY_DESCRIPTION* queryDescription))
+
+    /*IFabricQueryClient8*/
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_SERVICE_NAME, GetServiceName, IFabricGetServiceNameResult, FakeIFabricGetServiceNameResult::Create, queryDescription,
+        (const FABRIC_SERVICE_NAME_QUERY_DESCRIPTION* queryDescription))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_APPLICATION_NAME, GetApplicationName, IFabricGetApplicationNameResult, FakeIFabricGetApplicationNameResult::Create, queryDescription,
+        (const FABRIC_APPLICATION_NAME_QUERY_DESCRIPTION* queryDescription))
+
+    /*IFabricQueryClient9*/
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_APPLICATION_TYPE_PAGED_LIST, GetApplicationTypePagedList, IFabricGetApplicationTypePagedListResult, FakeIFabricGetApplicationTypePagedListResult::Create, queryDescription,
+        (const PAGED_FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION* queryDescription))
+
+    /*IFabricQueryClient10*/
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_DEPLOYED_APPLICATION_PAGED_LIST, GetDeployedApplicationPagedList, IFabricGetDeployedApplicationPagedListResult, FakeIFabricGetDeployedApplicationPagedListResult::Create, queryDescription,
+        (const FABRIC_PAGED_DEPLOYED_APPLICATION_QUERY_DESCRIPTION* queryDescription))
+
+private:
+    ~FakeFabricQueryClient() = default;
+
+    volatile_atomic int32_t refCount;
+    FAKE_FABRIC_RUNTIME_HANDLE runtime;
+};
+
+HRESULT fake_fabric_query_client_create(FAKE_FABRIC_RUNTIME_HANDLE runtime, IFabricQueryClient10** client)
+{
+    HRESULT result;
+    FakeFabricQueryClient* queryClient = new (std::nothrow) FakeFabricQueryClient(runtime);
+    if (queryClient == NULL)
+    {
+        LogError("failure in new FakeFabricQueryClient");
+        result = E_OUTOFMEMORY;
+    }
+    else
+    {
+        *client = queryClient;
+        result = S_OK;
+    }
+    return result;
+}
@@ -0,0 +1,150 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <new>
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+
+#include "com_wrapper/com_wrapper.h"
+
+#include "sf_c_util/fabric_string_result.h"
+#include "sf_c_util/fabric_string_result_com.h"
+
+#include "fake_fabric_runtime.h"
+#include "fake_fabric_operation.h"
+#include "fake_fabric_results.h"
+
+HRESULT fake_fabric_service_manifest_result_create(FAKE_FABRIC_RUNTIME_HANDLE runtime, const void* description, IUnknown** result)
+{
+    HRESULT hr;
+    (void)runtime;
+    (void)description;
+
+    FABRIC_STRING_RESULT_HANDLE fabric_string_result = fabric_string_result_create(L"");
+    if (fabric_string_result == NULL)
+    {
+        LogError("failure in fabric_string_result_create(L\"\")");
+        hr = E_OUTOFMEMORY;
+    }
+    else
+    {
+        IFabricStringResult* stringResult = COM_WRAPPER_CREATE(FABRIC_STRING_RESULT_HANDLE, IFabricStringResult, fabric_string_result, fabric_string_result_destroy);
+        if (stringResult == NULL)
+        {
+            LogError("failure in COM_WRAPPER_CREATE");
+            fabric_string_result_destroy(fabric_string_result);
+            hr = E_OUTOFMEMORY;
+        }
+        else
+        {
+            *result = stringResult;
+            hr = S_OK;
+        }
+    }
+    return hr;
+}
+
+FakeIFabricResolvedServicePartitionResult::FakeIFabricResolvedServicePartitionResult(wchar_t* name, LONGLONG version) :
+    name(name),
+    version(version)
+{
+    (void)interlocked_exchange(&refCount, 1);
+
+    /*the partition id stays GUID_NULL, a singleton partition has only 1 id anyway*/
+    endpoint.Address = name;
+    endpoint.Role = FABRIC_SERVICE_ROLE_STATELESS;
+
+    partition.Info.Kind = FABRIC_SERVICE_PARTITION_KIND_SINGLETON;
+    partition.Info.Value = &singleton;
+    partition.EndpointCount = 1;
+    partition.Endpoints = &endpoint;
+    partition.ServiceName = name;
+}
+
+FakeIFabricResolvedServicePartitionResult::~FakeIFabricResolvedServicePartitionResult()
+{
+    free(name);
+}
+
+HRESULT FakeIFabricResolvedServicePartitionResult::Create(FAKE_FABRIC_RUNTIME_HANDLE runtime, const void* description, IUnknown** result)
+{
+    HRESULT hr;
+    const wchar_t* serviceName = (description == NULL) ? L"" : static_cast<const wchar_t*>(description);
+    size_t length = wcslen(serviceName);
+    wchar_t* nameCopy = static_cast<wchar_t*>(malloc((length + 1) * sizeof(wchar_t)));
+    if (nameCopy == NULL)
+    {
+        LogError("failure in malloc((length=%zu + 1) * sizeof(wchar_t))", length);
+        hr = E_OUTOFMEMORY;
+    }
+    else
+    {
+        (void)memcpy(nameCopy, serviceName, (length + 1) * sizeof(wchar_t));
+
+        FakeIFabricResolvedServicePartitionResult* resolved = new (std::nothrow) FakeIFabricResolvedServicePartitionResult(nameCopy, fake_fabric_runtime_next_id(runtime));
+        if (resolved == NULL)
+        {
+            LogError("failure in new FakeIFabricResolvedServicePartitionResult");
+            free(nameCopy);
+            hr = E_OUTOFMEMORY;
+        }
+        else
+        {
+            *result = resolved;
+            hr = S_OK;
+        }
+    }
+    return hr;
+}
+
+const FABRIC_RESOLVED_SERVICE_PARTITION* STDMETHODCALLTYPE FakeIFabricResolvedServicePartitionResult::get_Partition(void)
+{
+    return &partition;
+}
+
+HRESULT STDMETHODCALLTYPE FakeIFabricResolvedServicePartitionResult::GetEndpoint(const FABRIC_RESOLVED_SERVICE_ENDPOINT** result)
+{
+    HRESULT hr;
+    if (result == NULL)
+    {
+        LogError("invalid arguments const FABRIC_RESOLVED_SERVICE_ENDPOINT** result=%p", result);
+        hr = E_POINTER;
+    }
+    else
+    {
+        *result = &endpoint;
+        hr = S_OK;
+    }
+    return hr;
+}
+
+HRESULT STDMETHODCALLTYPE FakeIFabricResolvedServicePartitionResult::CompareVersion(IFabricResolvedServicePartitionResult* other, LONG* compareResult)
+{
+    HRESULT hr;
+    if (
+        (other == NULL) ||
+        (compareResult == NULL)
+        )
+    {
+        LogError("invalid arguments IFabricResolvedServicePartitionResult* other=%p, LONG* compareResult=%p", other, compareResult);
+        hr = E_POINTER;
+    }
+    else
+    {
+        /*only results of the fake are ever compared with results of the fake*/
+        LONGLONG otherVersion = static_cast<FakeIFabricResolvedServicePartitionResult*>(other)->version;
+        *compareResult = (version < otherVersion) ? -1 : ((version > otherVersion) ? 1 : 0);
+        hr = S_OK;
+    }
+    return hr;
+}
@@ -0,0 +1,206 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef FAKE_FABRIC_RESULTS_H
+#define FAKE_FABRIC_RESULTS_H
+
+#include <cstdint>
+#include <new>
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+
+#include "fake_fabric_runtime.h"
+
+/*the empty results of the fake clients. Every class has a static Create with the signature of FAKE_FABRIC_CREATE_DEFAULT_RESULT*/
+
+/*IUnknown of a result that answers to IID_IUnknown, IID_1 and IID_2 (same as IID_1 when there is only 1 interface)*/
+#define FAKE_FABRIC_RESULT_IUNKNOWN(RESULT_INTERFACE, IID_1, IID_2)                                                                     \
+public:                                                                                                                                 \
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override                                                    \
+    {                                                                                                                                   \
+        HRESULT result;                                                                                                                 \
+        if (ppvObject == NULL)                                                                                                          \
+        {                                                                                                                               \
+            LogError("Invalid arguments: REFIID riid, void** ppvObject=%p", ppvObject);                                                \
+            result = E_POINTER;                                                                                                         \
+        }                                                                                                                               \
+        else if (                                                                                                                       \
+            IsEqualIID(riid, IID_IUnknown) ||                                                                                           \
+            IsEqualIID(riid, IID_1) ||                                                                                                  \
+            IsEqualIID(riid, IID_2)                                                                                                     \
+            )                                                                                                                           \
+        {                                                                                                                               \
+            *ppvObject = static_cast<RESULT_INTERFACE*>(this);                                                                          \
+            (void)AddRef();                                                                                                             \
+            result = S_OK;                                                                                                              \
+        }                                                                                                                               \
+        else                                                                                                                            \
+        {                                                                                                                               \
+            *ppvObject = NULL;                                                                                                          \
+            result = E_NOINTERFACE;                                                                                                     \
+        }                                                                                                                               \
+        return result;                                                                                                                  \
+    }                                                                                                                                   \
+    ULONG STDMETHODCALLTYPE AddRef(void) override                                                                                       \
+    {                                                                                                                                   \
+        return (ULONG)interlocked_increment(&refCount);                                                                                 \
+    }                                                                                                                                   \
+    ULONG STDMETHODCALLTYPE Release(void) override                                                                                      \
+    {                                                                                                                                   \
+        int32_t result = interlocked_decrement(&refCount);                                                                              \
+        if (result == 0)                                                                                                                \
+        {                                                                                                                               \
+            delete this;                                                                                                                \
+        }                                                                                                                               \
+        return (ULONG)result;                                                                                                           \
+    }                                                                                                                                   \
+private:                                                                                                                                \
+    volatile_atomic int32_t refCount;                                                                                                   \
+
+/*Create of a result that has nothing but a value, description is ignored*/
+#define FAKE_FABRIC_RESULT_CREATE(CLASS_NAME)                                                                                           \
+public:                                                                                                                                 \
+    static HRESULT Create(FAKE_FABRIC_RUNTIME_HANDLE runtime, const void* description, IUnknown** result)                               \
+    {                                                                                                                                   \
+        HRESULT hr;                                                                                                                     \
+        (void)runtime;                                                                                                                  \
+        (void)description;                                                                                                              \
+        CLASS_NAME* fakeResult = new (std::nothrow) CLASS_NAME();                                                                       \
+        if (fakeResult == NULL)                                                                                                         \
+        {                                                                                                                               \
+            LogError("failure in new " MU_TOSTRING(CLASS_NAME));                                                                        \
+            hr = E_OUTOFMEMORY;                                                                                                         \
+        }                                                                                                                               \
+        else                                                                                                                            \
+        {                                                                                                                               \
+            *result = fakeResult;                                                                                                       \
+            hr = S_OK;                                                                                                                  \
+        }                                                                                                                               \
+        return hr;                                                                                                                      \
+    }                                                                                                                                   \
+private:                                                                                                                                \
+    CLASS_NAME()                                                                                                                        \
+    {                                                                                                                                   \
+        (void)interlocked_exchange(&refCount, 1);                                                                                       \
+    }                                                                                                                                   \
+
+/*a result with 1 getter of a zeroed VALUE_TYPE (0 items)*/
+#define FAKE_FABRIC_DEFINE_RESULT(RESULT_INTERFACE, GETTER, VALUE_TYPE)                                                                 \
+    class MU_C2(Fake, RESULT_INTERFACE) final : public RESULT_INTERFACE                                                                 \
+    {                                                                                                                                   \
+        FAKE_FABRIC_RESULT_IUNKNOWN(RESULT_INTERFACE, MU_C2(IID_, RESULT_INTERFACE), MU_C2(IID_, RESULT_INTERFACE))                     \
+        FAKE_FABRIC_RESULT_CREATE(MU_C2(Fake, RESULT_INTERFACE))                                                                        \
+    public:                                                                                                                             \
+        const VALUE_TYPE* STDMETHODCALLTYPE GETTER(void) override                                                                       \
+        {                                                                                                                               \
+            return &value;                                                                                                              \
+        }                                                                                                                               \
+    private:                                                                                                                            \
+        VALUE_TYPE value = {};                                                                                                          \
+    };                                                                                                                                  \
+
+/*a paged result (0 items, no continuation token: the last page)*/
+#define FAKE_FABRIC_DEFINE_PAGED_RESULT(RESULT_INTERFACE, GETTER, VALUE_TYPE)                                                           \
+    class MU_C2(Fake, RESULT_INTERFACE) final : public RESULT_INTERFACE                                                                 \
+    {                                                                                                                                   \
+        FAKE_FABRIC_RESULT_IUNKNOWN(RESULT_INTERFACE, MU_C2(IID_, RESULT_INTERFACE), MU_C2(IID_, RESULT_INTERFACE))                     \
+        FAKE_FABRIC_RESULT_CREATE(MU_C2(Fake, RESULT_INTERFACE))                                                                        \
+    public:                                                                                                                             \
+        const VALUE_TYPE* STDMETHODCALLTYPE GETTER(void) override                                                                       \
+        {                                                                                                                               \
+            return &value;                                                                                                              \
+        }                                                                                                                               \
+        const FABRIC_PAGING_STATUS* STDMETHODCALLTYPE get_PagingStatus(void) override                                                   \
+        {                                                                                                                               \
+            return &pagingStatus;                                                                                                       \
+        }                                                                                                                               \
+    private:                                                                                                                            \
+        VALUE_TYPE value = {};                                                                                                          \
+        FABRIC_PAGING_STATUS pagingStatus = {};                                                                                         \
+    };                                                                                                                                  \
+
+/*a paged result that is also the result of the older, not paged, End method (BASE_INTERFACE)*/
+#define FAKE_FABRIC_DEFINE_RESULT2(RESULT_INTERFACE, BASE_INTERFACE, GETTER, VALUE_TYPE)                                                \
+    class MU_C2(Fake, RESULT_INTERFACE) final : public RESULT_INTERFACE                                                                 \
+    {                                                                                                                                   \
+        FAKE_FABRIC_RESULT_IUNKNOWN(RESULT_INTERFACE, MU_C2(IID_, RESULT_INTERFACE), MU_C2(IID_, BASE_INTERFACE))                       \
+        FAKE_FABRIC_RESULT_CREATE(MU_C2(Fake, RESULT_INTERFACE))                                                                        \
+    public:                                                                                                                             \
+        const VALUE_TYPE* STDMETHODCALLTYPE GETTER(void) override                                                                       \
+        {                                                                                                                               \
+            return &value;                                                                                                              \
+        }                                                                                                                               \
+        const FABRIC_PAGING_STATUS* STDMETHODCALLTYPE get_PagingStatus(void) override                                                   \
+        {                                                                                                                               \
+            return &pagingStatus;                                                                                                       \
+        }                                                                                                                               \
+    private:                                                                                                                            \
+        VALUE_TYPE value = {};                                                                                                          \
+        FABRIC_PAGING_STATUS pagingStatus = {};                                                                                         \
+    };                                                                                                                                  \
+
+/*IFabricQueryClient10*/
+FAKE_FABRIC_DEFINE_RESULT2(IFabricGetNodeListResult2, IFabricGetNodeListResult, get_NodeList, FABRIC_NODE_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetApplicationTypeListResult, get_ApplicationTypeList, FABRIC_APPLICATION_TYPE_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetServiceTypeListResult, get_ServiceTypeList, FABRIC_SERVICE_TYPE_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT2(IFabricGetApplicationListResult2, IFabricGetApplicationListResult, get_ApplicationList, FABRIC_APPLICATION_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT2(IFabricGetServiceListResult2, IFabricGetServiceListResult, get_ServiceList, FABRIC_SERVICE_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT2(IFabricGetPartitionListResult2, IFabricGetPartitionListResult, get_PartitionList, FABRIC_SERVICE_PARTITION_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT2(IFabricGetReplicaListResult2, IFabricGetReplicaListResult, get_ReplicaList, FABRIC_SERVICE_REPLICA_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetDeployedApplicationListResult, get_DeployedApplicationList, FABRIC_DEPLOYED_APPLICATION_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetDeployedServicePackageListResult, get_DeployedServicePackageList, FABRIC_DEPLOYED_SERVICE_PACKAGE_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetDeployedServiceTypeListResult, get_DeployedServiceTypeList, FABRIC_DEPLOYED_SERVICE_TYPE_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetDeployedCodePackageListResult, get_DeployedCodePackageList, FABRIC_DEPLOYED_CODE_PACKAGE_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetDeployedReplicaListResult, get_DeployedReplicaList, FABRIC_DEPLOYED_SERVICE_REPLICA_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetDeployedServiceReplicaDetailResult, get_ReplicaDetail, FABRIC_DEPLOYED_SERVICE_REPLICA_DETAIL_QUERY_RESULT_ITEM)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetClusterLoadInformationResult, get_ClusterLoadInformation, FABRIC_CLUSTER_LOAD_INFORMATION)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetPartitionLoadInformationResult, get_PartitionLoadInformation, FABRIC_PARTITION_LOAD_INFORMATION)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetProvisionedCodeVersionListResult, get_ProvisionedCodeVersionList, FABRIC_PROVISIONED_CODE_VERSION_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetProvisionedConfigVersionListResult, get_ProvisionedConfigVersionList, FABRIC_PROVISIONED_CONFIG_VERSION_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetNodeLoadInformationResult, get_NodeLoadInformation, FABRIC_NODE_LOAD_INFORMATION)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetReplicaLoadInformationResult, get_ReplicaLoadInformation, FABRIC_REPLICA_LOAD_INFORMATION)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetServiceGroupMemberListResult, get_ServiceGroupMemberList, FABRIC_SERVICE_GROUP_MEMBER_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetServiceGroupMemberTypeListResult, get_ServiceGroupMemberTypeList, FABRIC_SERVICE_GROUP_MEMBER_TYPE_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetUnplacedReplicaInformationResult, get_UnplacedReplicaInformation, FABRIC_UNPLACED_REPLICA_INFORMATION)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetApplicationLoadInformationResult, get_ApplicationLoadInformation, FABRIC_APPLICATION_LOAD_INFORMATION)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetServiceNameResult, get_ServiceName, FABRIC_SERVICE_NAME_QUERY_RESULT)
+FAKE_FABRIC_DEFINE_RESULT(IFabricGetApplicationNameResult, get_ApplicationName, FABRIC_APPLICATION_NAME_QUERY_RESULT)
+FAKE_FABRIC_DEFINE_PAGED_RESULT(IFabricGetApplicationTypePagedListResult, get_ApplicationTypePagedList, FABRIC_APPLICATION_TYPE_QUERY_RESULT_LIST)
+FAKE_FABRIC_DEFINE_PAGED_RESULT(IFabricGetDeployedApplicationPagedListResult, get_DeployedApplicationPagedList, FABRIC_DEPLOYED_APPLICATION_QUERY_RESULT_LIST)
+
+/*IFabricServiceManagementClient6*/
+FAKE_FABRIC_DEFINE_RESULT(IFabricServiceDescriptionResult, get_Description, FABRIC_SERVICE_DESCRIPTION)
+
+/*the service manifest: an empty IFabricStringResult (a fabric_string_result)*/
+HRESULT fake_fabric_service_manifest_result_create(FAKE_FABRIC_RUNTIME_HANDLE runtime, const void* description, IUnknown** result);
+
+/*a singleton partition of the service that was resolved (description is its name) with 1 stateless endpoint whose address is the name of the service.
+Every resolution produces a newer version than the previous ones, CompareVersion orders them the same way Service Fabric does*/
+class FakeIFabricResolvedServicePartitionResult final : public IFabricResolvedServicePartitionResult
+{
+    FAKE_FABRIC_RESULT_IUNKNOWN(IFabricResolvedServicePartitionResult, IID_IFabricResolvedServicePartitionResult, IID_IFabricResolvedServicePartitionResult)
+public:
+    static HRESULT Create(FAKE_FABRIC_RUNTIME_HANDLE runtime, const void* description, IUnknown** result);
+
+    const FABRIC_RESOLVED_SERVICE_PARTITION* STDMETHODCALLTYPE get_Partition(void) override;
+    HRESULT STDMETHODCALLTYPE GetEndpoint(const FABRIC_RESOLVED_SERVICE_ENDPOINT** endpoint) override;
+    HRESULT STDMETHODCALLTYPE CompareVersion(IFabricResolvedServicePartitionResult* other, LONG* compareResult) override;
+
+private:
+    FakeIFabricResolvedServicePartitionResult(wchar_t* name, LONGLONG version);
+    ~FakeIFabricResolvedServicePartitionResult();
+
+    wchar_t* name;
+    LONGLONG version;
+    FABRIC_SINGLETON_PARTITION_INFORMATION singleton = {};
+    FABRIC_RESOLVED_SERVICE_ENDPOINT endpoint = {};
+    FABRIC_RESOLVED_SERVICE_PARTITION partition = {};
+};
+
+#endif /*FAKE_FABRIC_RESULTS_H*/
@@ -0,0 +1,575 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <cstdlib>
+#include <cstdint>
+#include <cinttypes>
+#include <cmath>
+#include <cstring>
+
+#include "windows.h"
+
+#include "fabricclient.h"
+#include "fabricruntime.h"
+
+#include "macro_utils/macro_utils.h"
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/srw_lock.h"
+
+#include "com_wrapper/com_wrapper.h"
+
+#include "sf_c_util/hresult_to_string.h"
+#include "sf_c_util/timer_wheel.h"
+#include "sf_c_util/fc_activation_context.h"
+#include "sf_c_util/fc_activation_context_com.h"
+
+#include "h_fabric_client_factory.h"
+
+#include "fake_fabric_runtime.h"
+#include "fake_fabric_operation.h"
+
+MU_DEFINE_ENUM_STRINGS(FAKE_FABRIC_OPERATION, FAKE_FABRIC_OPERATION_VALUES)
+MU_DEFINE_ENUM_STRINGS(FAKE_FABRIC_LATENCY_DISTRIBUTION, FAKE_FABRIC_LATENCY_DISTRIBUTION_VALUES)
+MU_DEFINE_ENUM_STRINGS(FAKE_FABRIC_FAILURE_POINT, FAKE_FABRIC_FAILURE_POINT_VALUES)
+
+#define FAKE_FABRIC_GOLDEN_GAMMA 0x9E3779B97F4A7C15ULL
+
+typedef struct FAKE_FABRIC_RUNTIME_TAG
+{
+    FAKE_FABRIC_RUNTIME_CONFIG config;
+
+    SRW_LOCK_HANDLE behaviors_lock; /*shared by the draws, exclusive when a behavior changes*/
+    FAKE_FABRIC_OPERATION_BEHAVIOR behaviors[FAKE_FABRIC_OPERATION_COUNT];
+
+    FAKE_FABRIC_RUNTIME_COUNTERS counters[FAKE_FABRIC_OPERATION_COUNT];
+
+    uint32_t callback_thread_count;
+    TIMER_WHEEL_HANDLE* callback_threads; /*each wheel is 1 thread, the asynchronous completions go round robin over them*/
+    volatile_atomic int64_t next_callback_thread;
+
+    volatile_atomic int64_t draw_count;
+    volatile_atomic int64_t next_id;
+    volatile_atomic int32_t pending; /*operations that did not complete yet, destroy waits for 0*/
+
+    H_FABRIC_CLIENT_FACTORY factory;
+} FAKE_FABRIC_RUNTIME;
+
+/*splitmix64: small, fast and good enough to draw latencies and failures*/
+static uint64_t next_random(uint64_t* state)
+{
+    uint64_t z = (*state += FAKE_FABRIC_GOLDEN_GAMMA);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static bool draw_per_million(uint64_t* state, uint32_t per_million)
+{
+    return (next_random(state) % FAKE_FABRIC_PER_MILLION) < per_million;
+}
+
+static uint32_t draw_latency(uint64_t* state, const FAKE_FABRIC_LATENCY* latency)
+{
+    uint32_t result;
+    switch (latency->distribution)
+    {
+        default:
+        case FAKE_FABRIC_LATENCY_DISTRIBUTION_FIXED:
+        {
+            result = latency->min_ms;
+            break;
+        }
+        case FAKE_FABRIC_LATENCY_DISTRIBUTION_UNIFORM:
+        {
+            result = latency->min_ms + (uint32_t)(next_random(state) % ((uint64_t)latency->max_ms - latency->min_ms + 1));
+            break;
+        }
+        case FAKE_FABRIC_LATENCY_DISTRIBUTION_EXPONENTIAL:
+        {
+            /*53 random bits make a double in [0, 1)*/
+            double uniform = (double)(next_random(state) >> 11) * (1.0 / 9007199254740992.0);
+            double tail = -(double)latency->mean_ms * log(1.0 - uniform);
+            result = (tail >= (double)(latency->max_ms - latency->min_ms)) ? latency->max_ms : latency->min_ms + (uint32_t)tail;
+            break;
+        }
+    }
+    return result;
+}
+
+static int validate_behavior(const FAKE_FABRIC_OPERATION_BEHAVIOR* behavior)
+{
+    int result;
+    if (
+        (behavior->latency.distribution > FAKE_FABRIC_LATENCY_DISTRIBUTION_EXPONENTIAL) ||
+        (behavior->latency.min_ms > behavior->latency.max_ms && behavior->latency.distribution != FAKE_FABRIC_LATENCY_DISTRIBUTION_FIXED) ||
+        (behavior->completed_synchronously_per_million > FAKE_FABRIC_PER_MILLION) ||
+        (behavior->failure_count > FAKE_FABRIC_MAX_FAILURES)
+        )
+    {
+        LogError("invalid behavior: latency={distribution=%" PRI_MU_ENUM ", min_ms=%" PRIu32 ", max_ms=%" PRIu32 ", mean_ms=%" PRIu32 "}, completed_synchronously_per_million=%" PRIu32 ", failure_count=%" PRIu32 "",
+            MU_ENUM_VALUE(FAKE_FABRIC_LATENCY_DISTRIBUTION, behavior->latency.distribution), behavior->latency.min_ms, behavior->latency.max_ms, behavior->latency.mean_ms,
+            behavior->completed_synchronously_per_million, behavior->failure_count);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        uint32_t i;
+        for (i = 0; i < behavior->failure_count; i++)
+        {
+            const FAKE_FABRIC_FAILURE* failure = &behavior->failures[i];
+            if (
+                (SUCCEEDED(failure->error)) ||
+                (failure->per_million > FAKE_FABRIC_PER_MILLION) ||
+                (failure->point > FAKE_FABRIC_FAILURE_POINT_END)
+                )
+            {
+                LogError("invalid failure %" PRIu32 ": error=%" PRI_HRESULT ", per_million=%" PRIu32 ", point=%" PRI_MU_ENUM "",
+                    i, MU_HRESULT_VALUE(failure->error), failure->per_million, MU_ENUM_VALUE(FAKE_FABRIC_FAILURE_POINT, failure->point));
+                break;
+            }
+        }
+        result = (i == behavior->failure_count) ? 0 : MU_FAILURE;
+    }
+    return result;
+}
+
+static HRESULT fake_fabric_runtime_create_local_client(void* context, REFIID iid, void** fabricClient)
+{
+    HRESULT result;
+    FAKE_FABRIC_RUNTIME_HANDLE runtime = static_cast<FAKE_FABRIC_RUNTIME_HANDLE>(context);
+
+    /*any version of the query client, then any version of the service management client*/
+    IFabricQueryClient10* queryClient;
+    result = fake_fabric_query_client_create(runtime, &queryClient);
+    if (SUCCEEDED(result))
+    {
+        result = queryClient->QueryInterface(iid, fabricClient);
+        (void)queryClient->Release();
+        if (result == E_NOINTERFACE)
+        {
+            IFabricServiceManagementClient6* serviceManagementClient;
+            result = fake_fabric_service_management_client_create(runtime, &serviceManagementClient);
+            if (SUCCEEDED(result))
+            {
+                result = serviceManagementClient->QueryInterface(iid, fabricClient);
+                (void)serviceManagementClient->Release();
+            }
+        }
+    }
+    return result;
+}
+
+void fake_fabric_runtime_config_init(FAKE_FABRIC_RUNTIME_CONFIG* config)
+{
+    if (config == NULL)
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_CONFIG* config=%p", config);
+    }
+    else
+    {
+        (void)memset(config, 0, sizeof(*config));
+        config->behavior.latency.distribution = FAKE_FABRIC_LATENCY_DISTRIBUTION_FIXED;
+        config->behavior.completed_synchronously_per_million = FAKE_FABRIC_PER_MILLION;
+        config->callback_thread_count = 1;
+        config->tick_ms = 1;
+    }
+}
+
+FAKE_FABRIC_RUNTIME_HANDLE fake_fabric_runtime_create(const FAKE_FABRIC_RUNTIME_CONFIG* config)
+{
+    FAKE_FABRIC_RUNTIME_HANDLE result;
+    if (
+        (config == NULL) ||
+        (config->callback_thread_count == 0) ||
+        (config->tick_ms == 0) ||
+        (validate_behavior(&config->behavior) != 0)
+        )
+    {
+        LogError("invalid arguments const FAKE_FABRIC_RUNTIME_CONFIG* config=%p, config->callback_thread_count=%" PRIu32 ", config->tick_ms=%" PRIu32 "",
+            config, (config == NULL) ? 0 : config->callback_thread_count, (config == NULL) ? 0 : config->tick_ms);
+    }
+    else
+    {
+        result = static_cast<FAKE_FABRIC_RUNTIME_HANDLE>(malloc(sizeof(FAKE_FABRIC_RUNTIME)));
+        if (result == NULL)
+        {
+            LogError("failure in malloc(sizeof(FAKE_FABRIC_RUNTIME)=%zu)", sizeof(FAKE_FABRIC_RUNTIME));
+        }
+        else
+        {
+            result->config = *config;
+            for (uint32_t i = 0; i < FAKE_FABRIC_OPERATION_COUNT; i++)
+            {
+                result->behaviors[i] = config->behavior;
+                (void)interlocked_exchange_64(&result->counters[i].begun, 0);
+                (void)interlocked_exchange_64(&result->counters[i].failed_at_begin, 0);
+                (void)interlocked_exchange_64(&result->counters[i].completed_synchronously, 0);
+                (void)interlocked_exchange_64(&result->counters[i].completed_asynchronously, 0);
+                (void)interlocked_exchange_64(&result->counters[i].failed_at_end, 0);
+                (void)interlocked_exchange_64(&result->counters[i].timed_out, 0);
+                (void)interlocked_exchange_64(&result->counters[i].cancelled, 0);
+                (void)interlocked_exchange_64(&result->counters[i].in_flight, 0);
+            }
+            (void)interlocked_exchange_64(&result->next_callback_thread, 0);
+            (void)interlocked_exchange_64(&result->draw_count, 0);
+            (void)interlocked_exchange_64(&result->next_id, 0);
+            (void)interlocked_exchange(&result->pending, 0);
+            result->factory.create_local_client = fake_fabric_runtime_create_local_client;
+            result->factory.context = result;
+
+            result->behaviors_lock = srw_lock_create(false, "fake_fabric_runtime");
+            if (result->behaviors_lock == NULL)
+            {
+                LogError("failure in srw_lock_create(false, \"fake_fabric_runtime\")");
+            }
+            else
+            {
+                result->callback_threads = static_cast<TIMER_WHEEL_HANDLE*>(malloc(sizeof(TIMER_WHEEL_HANDLE) * config->callback_thread_count));
+                if (result->callback_threads == NULL)
+                {
+                    LogError("failure in malloc(sizeof(TIMER_WHEEL_HANDLE)=%zu * config->callback_thread_count=%" PRIu32 ")", sizeof(TIMER_WHEEL_HANDLE), config->callback_thread_count);
+                }
+                else
+                {
+                    for (result->callback_thread_count = 0; result->callback_thread_count < config->callback_thread_count; result->callback_thread_count++)
+                    {
+                        result->callback_threads[result->callback_thread_count] = timer_wheel_create(config->tick_ms);
+                        if (result->callback_threads[result->callback_thread_count] == NULL)
+                        {
+                            LogError("failure in timer_wheel_create(config->tick_ms=%" PRIu32 ")", config->tick_ms);
+                            break;
+                        }
+                    }
+
+                    if (result->callback_thread_count == config->callback_thread_count)
+                    {
+                        goto all_ok;
+                    }
+
+                    while (result->callback_thread_count > 0)
+                    {
+                        result->callback_thread_count--;
+                        timer_wheel_destroy(result->callback_threads[result->callback_thread_count]);
+                    }
+                    free(result->callback_threads);
+                }
+                srw_lock_destroy(result->behaviors_lock);
+            }
+            free(result);
+        }
+    }
+
+    result = NULL;
+
+all_ok:
+    return result;
+}
+
+void fake_fabric_runtime_destroy(FAKE_FABRIC_RUNTIME_HANDLE runtime)
+{
+    if (runtime == NULL)
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_HANDLE runtime=%p", runtime);
+    }
+    else
+    {
+        /*the operations in flight complete on their own (or when cancelled), the callback threads have to outlive them*/
+        int32_t pending;
+        while ((pending = interlocked_add(&runtime->pending, 0)) != 0)
+        {
+            INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&runtime->pending, 0, UINT32_MAX);
+            if (wait_result != INTERLOCKED_HL_OK)
+            {
+                LogError("failure in InterlockedHL_WaitForValue(&runtime->pending=%p, 0, UINT32_MAX), INTERLOCKED_HL_RESULT wait_result=%d, pending=%" PRId32 "", &runtime->pending, (int)wait_result, pending);
+                /*try again*/
+            }
+        }
+
+        for (uint32_t i = 0; i < runtime->callback_thread_count; i++)
+        {
+            timer_wheel_destroy(runtime->callback_threads[i]);
+        }
+        free(runtime->callback_threads);
+        srw_lock_destroy(runtime->behaviors_lock);
+        free(runtime);
+    }
+}
+
+int fake_fabric_runtime_set_operation_behavior(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, const FAKE_FABRIC_OPERATION_BEHAVIOR* behavior)
+{
+    int result;
+    if (
+        (runtime == NULL) ||
+        ((uint32_t)operation >= FAKE_FABRIC_OPERATION_COUNT) ||
+        (behavior == NULL) ||
+        (validate_behavior(behavior) != 0)
+        )
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_HANDLE runtime=%p, FAKE_FABRIC_OPERATION operation=%" PRI_MU_ENUM ", const FAKE_FABRIC_OPERATION_BEHAVIOR* behavior=%p",
+            runtime, MU_ENUM_VALUE(FAKE_FABRIC_OPERATION, operation), behavior);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        srw_lock_acquire_exclusive(runtime->behaviors_lock);
+        runtime->behaviors[operation] = *behavior;
+        srw_lock_release_exclusive(runtime->behaviors_lock);
+        result = 0;
+    }
+    return result;
+}
+
+void fake_fabric_runtime_draw(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, DWORD timeoutMilliseconds, FAKE_FABRIC_DRAW* draw)
+{
+    FAKE_FABRIC_OPERATION_BEHAVIOR behavior;
+    srw_lock_acquire_shared(runtime->behaviors_lock);
+    behavior = runtime->behaviors[operation];
+    srw_lock_release_shared(runtime->behaviors_lock);
+
+    /*every draw has a generator of its own, seeded from the seed of the runtime and the number of the draw*/
+    uint64_t state = runtime->config.seed + (uint64_t)interlocked_increment_64(&runtime->draw_count) * FAKE_FABRIC_GOLDEN_GAMMA;
+
+    draw->begin_result = S_OK;
+    draw->end_result = S_OK;
+    draw->timed_out = false;
+    draw->completes_synchronously = true;
+    draw->latency_ms = 0;
+    draw->callback_thread = NULL;
+
+    for (uint32_t i = 0; i < behavior.failure_count; i++)
+    {
+        if (draw_per_million(&state, behavior.failures[i].per_million))
+        {
+            if (behavior.failures[i].point == FAKE_FABRIC_FAILURE_POINT_BEGIN)
+            {
+                draw->begin_result = behavior.failures[i].error;
+            }
+            else
+            {
+                draw->end_result = behavior.failures[i].error;
+            }
+            break;
+        }
+    }
+
+    if (SUCCEEDED(draw->begin_result))
+    {
+        draw->latency_ms = draw_latency(&state, &behavior.latency);
+        if (
+            (timeoutMilliseconds != INFINITE) &&
+            (draw->latency_ms > timeoutMilliseconds)
+            )
+        {
+            /*the operation would still be running when its time is up*/
+            draw->latency_ms = timeoutMilliseconds;
+            draw->end_result = FABRIC_E_TIMEOUT;
+            draw->timed_out = true;
+        }
+
+        draw->completes_synchronously = draw_per_million(&state, behavior.completed_synchronously_per_million);
+        if (!draw->completes_synchronously)
+        {
+            draw->callback_thread = runtime->callback_threads[(uint64_t)interlocked_increment_64(&runtime->next_callback_thread) % runtime->callback_thread_count];
+        }
+    }
+}
+
+HRESULT fake_fabric_runtime_create_result(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, const void* description, FAKE_FABRIC_CREATE_DEFAULT_RESULT create_default_result, IUnknown** result)
+{
+    HRESULT hr;
+    void* userResult = NULL;
+    if (runtime->config.create_result == NULL)
+    {
+        hr = create_default_result(runtime, description, result);
+    }
+    else
+    {
+        hr = runtime->config.create_result(runtime->config.create_result_context, operation, description, &userResult);
+        if (FAILED(hr))
+        {
+            /*End of the operation returns it*/
+        }
+        else if (userResult == NULL)
+        {
+            hr = create_default_result(runtime, description, result);
+        }
+        else
+        {
+            *result = static_cast<IUnknown*>(userResult);
+        }
+    }
+    return hr;
+}
+
+FAKE_FABRIC_RUNTIME_COUNTERS* fake_fabric_runtime_get_counters(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation)
+{
+    return &runtime->counters[operation];
+}
+
+void fake_fabric_runtime_operation_started(FAKE_FABRIC_RUNTIME_HANDLE runtime)
+{
+    (void)interlocked_increment(&runtime->pending);
+}
+
+void fake_fabric_runtime_operation_ended(FAKE_FABRIC_RUNTIME_HANDLE runtime)
+{
+    if (interlocked_decrement(&runtime->pending) == 0)
+    {
+        wake_by_address_single(&runtime->pending);
+    }
+}
+
+LONGLONG fake_fabric_runtime_next_id(FAKE_FABRIC_RUNTIME_HANDLE runtime)
+{
+    return (LONGLONG)interlocked_increment_64(&runtime->next_id);
+}
+
+HRESULT fake_fabric_runtime_create_query_client(FAKE_FABRIC_RUNTIME_HANDLE runtime, IFabricQueryClient10** client)
+{
+    HRESULT result;
+    if (
+        (runtime == NULL) ||
+        (client == NULL)
+        )
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_HANDLE runtime=%p, IFabricQueryClient10** client=%p", runtime, client);
+        result = E_POINTER;
+    }
+    else
+    {
+        result = fake_fabric_query_client_create(runtime, client);
+    }
+    return result;
+}
+
+HRESULT fake_fabric_runtime_create_service_management_client(FAKE_FABRIC_RUNTIME_HANDLE runtime, IFabricServiceManagementClient6** client)
+{
+    HRESULT result;
+    if (
+        (runtime == NULL) ||
+        (client == NULL)
+        )
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_HANDLE runtime=%p, IFabricServiceManagementClient6** client=%p", runtime, client);
+        result = E_POINTER;
+    }
+    else
+    {
+        result = fake_fabric_service_management_client_create(runtime, client);
+    }
+    return result;
+}
+
+HRESULT fake_fabric_runtime_create_activation_context(FAKE_FABRIC_RUNTIME_HANDLE runtime, int argc, char** argv, IFabricCodePackageActivationContext** activation_context)
+{
+    HRESULT result;
+    if (
+        (runtime == NULL) ||
+        (activation_context == NULL)
+        )
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_HANDLE runtime=%p, int argc=%d, char** argv=%p, IFabricCodePackageActivationContext** activation_context=%p", runtime, argc, argv, activation_context);
+        result = E_POINTER;
+    }
+    else
+    {
+        int argc_consumed;
+        FC_ACTIVATION_CONTEXT_HANDLE fc_activation_context = fc_activation_context_create(argc, argv, &argc_consumed);
+        if (fc_activation_context == NULL)
+        {
+            LogError("failure in fc_activation_context_create(argc=%d, argv=%p, &argc_consumed=%p)", argc, argv, &argc_consumed);
+            result = E_FAIL;
+        }
+        else
+        {
+            *activation_context = COM_WRAPPER_CREATE(FC_ACTIVATION_CONTEXT_HANDLE, IFabricCodePackageActivationContext, fc_activation_context, fc_activation_context_destroy);
+            if (*activation_context == NULL)
+            {
+                LogError("failure in COM_WRAPPER_CREATE");
+                fc_activation_context_destroy(fc_activation_context);
+                result = E_OUTOFMEMORY;
+            }
+            else
+            {
+                result = S_OK;
+            }
+        }
+    }
+    return result;
+}
+
+void fake_fabric_runtime_install(FAKE_FABRIC_RUNTIME_HANDLE runtime)
+{
+    if (runtime == NULL)
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_HANDLE runtime=%p", runtime);
+    }
+    else
+    {
+        h_fabric_client_factory_set(&runtime->factory);
+    }
+}
+
+void fake_fabric_runtime_uninstall(FAKE_FABRIC_RUNTIME_HANDLE runtime)
+{
+    if (runtime == NULL)
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_HANDLE runtime=%p", runtime);
+    }
+    else
+    {
+        h_fabric_client_factory_set(NULL);
+    }
+}
+
+static void add_counters(FAKE_FABRIC_RUNTIME_STATS* stats, FAKE_FABRIC_RUNTIME_COUNTERS* counters)
+{
+    stats->begun += interlocked_add_64(&counters->begun, 0);
+    stats->failed_at_begin += interlocked_add_64(&counters->failed_at_begin, 0);
+    stats->completed_synchronously += interlocked_add_64(&counters->completed_synchronously, 0);
+    stats->completed_asynchronously += interlocked_add_64(&counters->completed_asynchronously, 0);
+    stats->failed_at_end += interlocked_add_64(&counters->failed_at_end, 0);
+    stats->timed_out += interlocked_add_64(&counters->timed_out, 0);
+    stats->cancelled += interlocked_add_64(&counters->cancelled, 0);
+    stats->in_flight += interlocked_add_64(&counters->in_flight, 0);
+}
+
+void fake_fabric_runtime_get_stats(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_RUNTIME_STATS* stats)
+{
+    if (
+        (runtime == NULL) ||
+        (stats == NULL)
+        )
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_HANDLE runtime=%p, FAKE_FABRIC_RUNTIME_STATS* stats=%p", runtime, stats);
+    }
+    else
+    {
+        (void)memset(stats, 0, sizeof(*stats));
+        for (uint32_t i = 0; i < FAKE_FABRIC_OPERATION_COUNT; i++)
+        {
+            add_counters(stats, &runtime->counters[i]);
+        }
+    }
+}
+
+void fake_fabric_runtime_get_operation_stats(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, FAKE_FABRIC_RUNTIME_STATS* stats)
+{
+    if (
+        (runtime == NULL) ||
+        ((uint32_t)operation >= FAKE_FABRIC_OPERATION_COUNT) ||
+        (stats == NULL)
+        )
+    {
+        LogError("invalid arguments FAKE_FABRIC_RUNTIME_HANDLE runtime=%p, FAKE_FABRIC_OPERATION operation=%" PRI_MU_ENUM ", FAKE_FABRIC_RUNTIME_STATS* stats=%p",
+            runtime, MU_ENUM_VALUE(FAKE_FABRIC_OPERATION, operation), stats);
+    }
+    else
+    {
+        (void)memset(stats, 0, sizeof(*stats));
+        add_counters(stats, &runtime->counters[operation]);
+    }
+}
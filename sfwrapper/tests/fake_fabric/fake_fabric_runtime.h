@@ -0,0 +1,182 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#ifndef FAKE_FABRIC_RUNTIME_H
+#define FAKE_FABRIC_RUNTIME_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "windows.h"
+
+#include "fabricclient.h"
+#include "fabricruntime.h"
+
+#include "macro_utils/macro_utils.h"
+
+/*fake_fabric_runtime is an in-process fake of the parts of Service Fabric that sfwrapper talks to: IFabricQueryClient10, IFabricServiceManagementClient6 and IFabricCodePackageActivationContext.
+It exists so that the retry logic, the caches and the _async APIs of H_FABRIC can be load tested and benchmarked without a cluster.
+
+Every Begin of the fake clients is an operation that:
+- fails right away (Begin returns the error) or when it completes (End returns the error) with the FABRIC_E_* errors configured for it, each with its own probability
+- takes a latency drawn from the configured distribution
+- completes synchronously (the latency is spent on the calling thread, CompletedSynchronously is TRUE) or asynchronously (the callback runs on one of the callback threads of the runtime) in the configured ratio
+- completes with FABRIC_E_TIMEOUT after timeoutMilliseconds when its latency is longer, and with E_ABORT when it is cancelled
+The outputs are empty results (0 items, last page) unless the configuration has a create_result function.
+BeginGetNodeList, BeginGetApplicationList, BeginGetServiceList, BeginGetPartitionList and BeginGetReplicaList serve both End methods (for example EndGetNodeList and EndGetNodeList2),
+so they are 1 operation each and their results implement the newer interface (IFabricGetNodeListResult2...).
+
+The activation context has no asynchronous methods, it is served from memory by fc_activation_context (same as the real one is served from the memory of the code package).
+
+Use fake_fabric_runtime_install to make the H_FABRIC handles created afterwards (H_FABRIC_HANDLE_CREATE and friends) use the fake clients.*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FAKE_FABRIC_OPERATION_VALUES \
+    FAKE_FABRIC_OPERATION_GET_NODE_LIST, \
+    FAKE_FABRIC_OPERATION_GET_APPLICATION_TYPE_LIST, \
+    FAKE_FABRIC_OPERATION_GET_SERVICE_TYPE_LIST, \
+    FAKE_FABRIC_OPERATION_GET_APPLICATION_LIST, \
+    FAKE_FABRIC_OPERATION_GET_SERVICE_LIST, \
+    FAKE_FABRIC_OPERATION_GET_PARTITION_LIST, \
+    FAKE_FABRIC_OPERATION_GET_REPLICA_LIST, \
+    FAKE_FABRIC_OPERATION_GET_DEPLOYED_APPLICATION_LIST, \
+    FAKE_FABRIC_OPERATION_GET_DEPLOYED_SERVICE_PACKAGE_LIST, \
+    FAKE_FABRIC_OPERATION_GET_DEPLOYED_SERVICE_TYPE_LIST, \
+    FAKE_FABRIC_OPERATION_GET_DEPLOYED_CODE_PACKAGE_LIST, \
+    FAKE_FABRIC_OPERATION_GET_DEPLOYED_REPLICA_LIST, \
+    FAKE_FABRIC_OPERATION_GET_DEPLOYED_REPLICA_DETAIL, \
+    FAKE_FABRIC_OPERATION_GET_CLUSTER_LOAD_INFORMATION, \
+    FAKE_FABRIC_OPERATION_GET_PARTITION_LOAD_INFORMATION, \
+    FAKE_FABRIC_OPERATION_GET_PROVISIONED_FABRIC_CODE_VERSION_LIST, \
+    FAKE_FABRIC_OPERATION_GET_PROVISIONED_FABRIC_CONFIG_VERSION_LIST, \
+    FAKE_FABRIC_OPERATION_GET_NODE_LOAD_INFORMATION, \
+    FAKE_FABRIC_OPERATION_GET_REPLICA_LOAD_INFORMATION, \
+    FAKE_FABRIC_OPERATION_GET_SERVICE_GROUP_MEMBER_LIST, \
+    FAKE_FABRIC_OPERATION_GET_SERVICE_GROUP_MEMBER_TYPE_LIST, \
+    FAKE_FABRIC_OPERATION_GET_UNPLACED_REPLICA_INFORMATION, \
+    FAKE_FABRIC_OPERATION_GET_APPLICATION_LOAD_INFORMATION, \
+    FAKE_FABRIC_OPERATION_GET_SERVICE_NAME, \
+    FAKE_FABRIC_OPERATION_GET_APPLICATION_NAME, \
+    FAKE_FABRIC_OPERATION_GET_APPLICATION_TYPE_PAGED_LIST, \
+    FAKE_FABRIC_OPERATION_GET_DEPLOYED_APPLICATION_PAGED_LIST, \
+    FAKE_FABRIC_OPERATION_CREATE_SERVICE, \
+    FAKE_FABRIC_OPERATION_CREATE_SERVICE_FROM_TEMPLATE, \
+    FAKE_FABRIC_OPERATION_DELETE_SERVICE, \
+    FAKE_FABRIC_OPERATION_GET_SERVICE_DESCRIPTION, \
+    FAKE_FABRIC_OPERATION_RESOLVE_SERVICE_PARTITION, \
+    FAKE_FABRIC_OPERATION_GET_SERVICE_MANIFEST, \
+    FAKE_FABRIC_OPERATION_UPDATE_SERVICE, \
+    FAKE_FABRIC_OPERATION_REMOVE_REPLICA, \
+    FAKE_FABRIC_OPERATION_RESTART_REPLICA, \
+    FAKE_FABRIC_OPERATION_REGISTER_SERVICE_NOTIFICATION_FILTER, \
+    FAKE_FABRIC_OPERATION_UNREGISTER_SERVICE_NOTIFICATION_FILTER, \
+    FAKE_FABRIC_OPERATION_DELETE_SERVICE2, \
+    FAKE_FABRIC_OPERATION_CREATE_SERVICE_FROM_TEMPLATE2
+
+MU_DEFINE_ENUM(FAKE_FABRIC_OPERATION, FAKE_FABRIC_OPERATION_VALUES)
+
+#define FAKE_FABRIC_OPERATION_COUNT MU_COUNT_ARG(FAKE_FABRIC_OPERATION_VALUES)
+
+/*FIXED always takes min_ms, UNIFORM anything in [min_ms, max_ms], EXPONENTIAL min_ms plus an exponential tail of mean mean_ms, cut at max_ms*/
+#define FAKE_FABRIC_LATENCY_DISTRIBUTION_VALUES \
+    FAKE_FABRIC_LATENCY_DISTRIBUTION_FIXED, \
+    FAKE_FABRIC_LATENCY_DISTRIBUTION_UNIFORM, \
+    FAKE_FABRIC_LATENCY_DISTRIBUTION_EXPONENTIAL
+
+MU_DEFINE_ENUM(FAKE_FABRIC_LATENCY_DISTRIBUTION, FAKE_FABRIC_LATENCY_DISTRIBUTION_VALUES)
+
+/*BEGIN makes Begin return the error, END lets the operation run its latency and makes End return the error*/
+#define FAKE_FABRIC_FAILURE_POINT_VALUES \
+    FAKE_FABRIC_FAILURE_POINT_BEGIN, \
+    FAKE_FABRIC_FAILURE_POINT_END
+
+MU_DEFINE_ENUM(FAKE_FABRIC_FAILURE_POINT, FAKE_FABRIC_FAILURE_POINT_VALUES)
+
+#define FAKE_FABRIC_MAX_FAILURES 8
+
+#define FAKE_FABRIC_PER_MILLION 1000000
+
+typedef struct FAKE_FABRIC_LATENCY_TAG
+{
+    FAKE_FABRIC_LATENCY_DISTRIBUTION distribution;
+    uint32_t min_ms;
+    uint32_t max_ms;
+    uint32_t mean_ms;
+} FAKE_FABRIC_LATENCY;
+
+typedef struct FAKE_FABRIC_FAILURE_TAG
+{
+    HRESULT error; /*usually a FABRIC_E_* error*/
+    uint32_t per_million; /*how many operations out of FAKE_FABRIC_PER_MILLION fail with error*/
+    FAKE_FABRIC_FAILURE_POINT point;
+} FAKE_FABRIC_FAILURE;
+
+typedef struct FAKE_FABRIC_OPERATION_BEHAVIOR_TAG
+{
+    FAKE_FABRIC_LATENCY latency;
+    uint32_t completed_synchronously_per_million; /*the rest completes on the callback threads*/
+    uint32_t failure_count;
+    FAKE_FABRIC_FAILURE failures[FAKE_FABRIC_MAX_FAILURES]; /*checked in order, the first one drawn wins*/
+} FAKE_FABRIC_OPERATION_BEHAVIOR;
+
+/*produces the output of a successful operation. description is the first argument of the Begin method (the query description, the name of the service...), NULL when there is none.
+result is the COM object that End hands out (for example an IFabricGetNodeListResult2*, see above). Setting *result to NULL and returning S_OK makes the operation use the empty result of the fake.
+A failure makes End of the operation return the failure. Only called for the operations that produce a COM object*/
+typedef HRESULT (*FAKE_FABRIC_CREATE_RESULT)(void* context, FAKE_FABRIC_OPERATION operation, const void* description, void** result);
+
+typedef struct FAKE_FABRIC_RUNTIME_CONFIG_TAG
+{
+    FAKE_FABRIC_OPERATION_BEHAVIOR behavior; /*of all the operations, until changed with fake_fabric_runtime_set_operation_behavior*/
+    uint32_t callback_thread_count; /*the asynchronous completions are spread over these threads*/
+    uint32_t tick_ms; /*resolution of the latency of asynchronous completions*/
+    uint64_t seed; /*same seed, same sequence of draws (the order in which threads draw is up to the scheduler)*/
+    FAKE_FABRIC_CREATE_RESULT create_result;
+    void* create_result_context;
+} FAKE_FABRIC_RUNTIME_CONFIG;
+
+typedef struct FAKE_FABRIC_RUNTIME_STATS_TAG
+{
+    int64_t begun; /*calls of Begin, including the ones that failed*/
+    int64_t failed_at_begin;
+    int64_t completed_synchronously;
+    int64_t completed_asynchronously;
+    int64_t failed_at_end; /*injected failures and failures of create_result*/
+    int64_t timed_out;
+    int64_t cancelled;
+    int64_t in_flight; /*operations that did not call their callback yet*/
+} FAKE_FABRIC_RUNTIME_STATS;
+
+typedef struct FAKE_FABRIC_RUNTIME_TAG* FAKE_FABRIC_RUNTIME_HANDLE;
+
+    /*fills config with: no latency, all operations complete synchronously, no failures, 1 callback thread, ticks of 1 ms*/
+    void fake_fabric_runtime_config_init(FAKE_FABRIC_RUNTIME_CONFIG* config);
+
+    FAKE_FABRIC_RUNTIME_HANDLE fake_fabric_runtime_create(const FAKE_FABRIC_RUNTIME_CONFIG* config);
+    /*waits for the operations in flight to complete, the clients created by the runtime cannot be used afterwards*/
+    void fake_fabric_runtime_destroy(FAKE_FABRIC_RUNTIME_HANDLE runtime);
+
+    /*can be called while operations are running (for example to simulate an outage for a while)*/
+    int fake_fabric_runtime_set_operation_behavior(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, const FAKE_FABRIC_OPERATION_BEHAVIOR* behavior);
+
+    HRESULT fake_fabric_runtime_create_query_client(FAKE_FABRIC_RUNTIME_HANDLE runtime, IFabricQueryClient10** client);
+    HRESULT fake_fabric_runtime_create_service_management_client(FAKE_FABRIC_RUNTIME_HANDLE runtime, IFabricServiceManagementClient6** client);
+    /*argc/argv as produced by IFabricCodePackageActivationContext_to_ARGC_ARGV*/
+    HRESULT fake_fabric_runtime_create_activation_context(FAKE_FABRIC_RUNTIME_HANDLE runtime, int argc, char** argv, IFabricCodePackageActivationContext** activation_context);
+
+    /*makes h_fabric_client_factory_create_local_client (and so every H_FABRIC handle created afterwards) create the clients of runtime, until fake_fabric_runtime_uninstall*/
+    void fake_fabric_runtime_install(FAKE_FABRIC_RUNTIME_HANDLE runtime);
+    void fake_fabric_runtime_uninstall(FAKE_FABRIC_RUNTIME_HANDLE runtime);
+
+    void fake_fabric_runtime_get_stats(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_RUNTIME_STATS* stats);
+    void fake_fabric_runtime_get_operation_stats(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, FAKE_FABRIC_RUNTIME_STATS* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*FAKE_FABRIC_RUNTIME_H*/
@@ -0,0 +1,230 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include <cstdint>
+#include <new>
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+
+#include "fake_fabric_runtime.h"
+#include "fake_fabric_operation.h"
+#include "fake_fabric_results.h"
+
+/*every Begin of IFabricServiceManagementClient6 is an operation of the runtime, see fake_fabric_runtime.h.
+The resolution change handlers are registered synchronously (same as Service Fabric) and never called: the partitions of the fake do not move*/
+class FakeFabricServiceManagementClient final : public IFabricServiceManagementClient6
+{
+public:
+    explicit FakeFabricServiceManagementClient(FAKE_FABRIC_RUNTIME_HANDLE runtime) :
+        runtime(runtime)
+    {
+        (void)interlocked_exchange(&refCount, 1);
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override
+    {
+        HRESULT result;
+        if (ppvObject == NULL)
+        {
+            LogError("Invalid arguments: REFIID riid, void** ppvObject=%p", ppvObject);
+            result = E_POINTER;
+        }
+        else if (
+            IsEqualIID(riid, IID_IUnknown) ||
+            IsEqualIID(riid, IID_IFabricServiceManagementClient) ||
+            IsEqualIID(riid, IID_IFabricServiceManagementClient2) ||
+            IsEqualIID(riid, IID_IFabricServiceManagementClient3) ||
+            IsEqualIID(riid, IID_IFabricServiceManagementClient4) ||
+            IsEqualIID(riid, IID_IFabricServiceManagementClient5) ||
+            IsEqualIID(riid, IID_IFabricServiceManagementClient6)
+            )
+        {
+            *ppvObject = static_cast<IFabricServiceManagementClient6*>(this);
+            (void)AddRef();
+            result = S_OK;
+        }
+        else
+        {
+            *ppvObject = NULL;
+            result = E_NOINTERFACE;
+        }
+        return result;
+    }
+
+    ULONG STDMETHODCALLTYPE AddRef(void) override
+    {
+        return (ULONG)interlocked_increment(&refCount);
+    }
+
+    ULONG STDMETHODCALLTYPE Release(void) override
+    {
+        int32_t result = interlocked_decrement(&refCount);
+        if (result == 0)
+        {
+            delete this;
+        }
+        return (ULONG)result;
+    }
+
+    /*IFabricServiceManagementClient*/
+    FAKE_FABRIC_DEFINE_OPERATION_NO_RESULT(FAKE_FABRIC_OPERATION_CREATE_SERVICE, CreateService, description,
+        (const FABRIC_SERVICE_DESCRIPTION* description))
+
+    /*the operations with more than 1 argument are written out, their description is the argument that names what they work on*/
+    HRESULT STDMETHODCALLTYPE BeginCreateServiceFromTemplate(FABRIC_URI applicationName, FABRIC_URI serviceName, LPCWSTR serviceTypeName, ULONG InitializationDataSize, BYTE* InitializationData, DWORD timeoutMilliseconds,
+        IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context) override
+    {
+        (void)applicationName;
+        (void)serviceTypeName;
+        (void)InitializationDataSize;
+        (void)InitializationData;
+        return FakeFabricOperation::Begin(runtime, FAKE_FABRIC_OPERATION_CREATE_SERVICE_FROM_TEMPLATE, serviceName, timeoutMilliseconds, NULL, callback, context);
+    }
+
+    HRESULT STDMETHODCALLTYPE EndCreateServiceFromTemplate(IFabricAsyncOperationContext* context) override
+    {
+        return FakeFabricOperation::End(context);
+    }
+
+    FAKE_FABRIC_DEFINE_OPERATION_NO_RESULT(FAKE_FABRIC_OPERATION_DELETE_SERVICE, DeleteService, name,
+        (FABRIC_URI name))
+    FAKE_FABRIC_DEFINE_OPERATION(FAKE_FABRIC_OPERATION_GET_SERVICE_DESCRIPTION, GetServiceDescription, IFabricServiceDescriptionResult, FakeIFabricServiceDescriptionResult::Create, name,
+        (FABRIC_URI name))
+
+    HRESULT STDMETHODCALLTYPE RegisterServicePartitionResolutionChangeHandler(FABRIC_URI name, FABRIC_PARTITION_KEY_TYPE keyType, const void* partitionKey, IFabricServicePartitionResolutionChangeHandler* callback, LONGLONG* callbackHandle) override
+    {
+        HRESULT result;
+        (void)keyType;
+        (void)partitionKey;
+        if (
+            (name == NULL) ||
+            (callback == NULL) ||
+            (callbackHandle == NULL)
+            )
+        {
+            LogError("invalid arguments FABRIC_URI name=%ls, IFabricServicePartitionResolutionChangeHandler* callback=%p, LONGLONG* callbackHandle=%p", MU_WP_OR_NULL(name), callback, callbackHandle);
+            result = E_POINTER;
+        }
+        else
+        {
+            *callbackHandle = fake_fabric_runtime_next_id(runtime);
+            result = S_OK;
+        }
+        return result;
+    }
+
+    HRESULT STDMETHODCALLTYPE UnregisterServicePartitionResolutionChangeHandler(LONGLONG callbackHandle) override
+    {
+        (void)callbackHandle;
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE BeginResolveServicePartition(FABRIC_URI name, FABRIC_PARTITION_KEY_TYPE partitionKeyType, const void* partitionKey, IFabricResolvedServicePartitionResult* previousResult, DWORD timeoutMilliseconds,
+        IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context) override
+    {
+        /*every partition key resolves to the same singleton partition, and the previous result does not matter: every resolution is a newer version*/
+        (void)partitionKeyType;
+        (void)partitionKey;
+        (void)previousResult;
+        return FakeFabricOperation::Begin(runtime, FAKE_FABRIC_OPERATION_RESOLVE_SERVICE_PARTITION, name, timeoutMilliseconds, FakeIFabricResolvedServicePartitionResult::Create, callback, context);
+    }
+
+    HRESULT STDMETHODCALLTYPE EndResolveServicePartition(IFabricAsyncOperationContext* context, IFabricResolvedServicePartitionResult** result) override
+    {
+        return FakeFabricOperation::End(context, result);
+    }
+
+    /*IFabricServiceManagementClient2*/
+    HRESULT STDMETHODCALLTYPE BeginGetServiceManifest(LPCWSTR applicationTypeName, LPCWSTR applicationTypeVersion, LPCWSTR serviceManifestName, DWORD timeoutMilliseconds,
+        IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context) override
+    {
+        (void)applicationTypeName;
+        (void)applicationTypeVersion;
+        return FakeFabricOperation::Begin(runtime, FAKE_FABRIC_OPERATION_GET_SERVICE_MANIFEST, serviceManifestName, timeoutMilliseconds, fake_fabric_service_manifest_result_create, callback, context);
+    }
+
+    HRESULT STDMETHODCALLTYPE EndGetServiceManifest(IFabricAsyncOperationContext* context, IFabricStringResult** result) override
+    {
+        return FakeFabricOperation::End(context, result);
+    }
+
+    HRESULT STDMETHODCALLTYPE BeginUpdateService(FABRIC_URI name, const FABRIC_SERVICE_UPDATE_DESCRIPTION* serviceUpdateDescription, DWORD timeoutMilliseconds,
+        IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context) override
+    {
+        (void)serviceUpdateDescription;
+        return FakeFabricOperation::Begin(runtime, FAKE_FABRIC_OPERATION_UPDATE_SERVICE, name, timeoutMilliseconds, NULL, callback, context);
+    }
+
+    HRESULT STDMETHODCALLTYPE EndUpdateService(IFabricAsyncOperationContext* context) override
+    {
+        return FakeFabricOperation::End(context);
+    }
+
+    /*IFabricServiceManagementClient3*/
+    FAKE_FABRIC_DEFINE_OPERATION_NO_RESULT(FAKE_FABRIC_OPERATION_REMOVE_REPLICA, RemoveReplica, description,
+        (const FABRIC_REMOVE_REPLICA_DESCRIPTION* description))
+    FAKE_FABRIC_DEFINE_OPERATION_NO_RESULT(FAKE_FABRIC_OPERATION_RESTART_REPLICA, RestartReplica, description,
+        (const FABRIC_RESTART_REPLICA_DESCRIPTION* description))
+
+    /*IFabricServiceManagementClient4, the filter id is the LONGLONG produced by the operation*/
+    HRESULT STDMETHODCALLTYPE BeginRegisterServiceNotificationFilter(const FABRIC_SERVICE_NOTIFICATION_FILTER_DESCRIPTION* description, DWORD timeoutMilliseconds,
+        IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context) override
+    {
+        return FakeFabricOperation::Begin(runtime, FAKE_FABRIC_OPERATION_REGISTER_SERVICE_NOTIFICATION_FILTER, description, timeoutMilliseconds, NULL, callback, context);
+    }
+
+    HRESULT STDMETHODCALLTYPE EndRegisterServiceNotificationFilter(IFabricAsyncOperationContext* context, LONGLONG* filterId) override
+    {
+        return FakeFabricOperation::End(context, filterId);
+    }
+
+    /*the filter id is not a pointer, so there is no description*/
+    HRESULT STDMETHODCALLTYPE BeginUnregisterServiceNotificationFilter(LONGLONG filterId, DWORD timeoutMilliseconds,
+        IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context) override
+    {
+        (void)filterId;
+        return FakeFabricOperation::Begin(runtime, FAKE_FABRIC_OPERATION_UNREGISTER_SERVICE_NOTIFICATION_FILTER, NULL, timeoutMilliseconds, NULL, callback, context);
+    }
+
+    HRESULT STDMETHODCALLTYPE EndUnregisterServiceNotificationFilter(IFabricAsyncOperationContext* context) override
+    {
+        return FakeFabricOperation::End(context);
+    }
+
+    /*IFabricServiceManagementClient5*/
+    FAKE_FABRIC_DEFINE_OPERATION_NO_RESULT(FAKE_FABRIC_OPERATION_DELETE_SERVICE2, DeleteService2, deleteDescription,
+        (const FABRIC_DELETE_SERVICE_DESCRIPTION* deleteDescription))
+
+    /*IFabricServiceManagementClient6*/
+    FAKE_FABRIC_DEFINE_OPERATION_NO_RESULT(FAKE_FABRIC_OPERATION_CREATE_SERVICE_FROM_TEMPLATE2, CreateServiceFromTemplate2, serviceFromTemplateDescription,
+        (const FABRIC_SERVICE_FROM_TEMPLATE_DESCRIPTION* serviceFromTemplateDescription))
+
+private:
+    ~FakeFabricServiceManagementClient() = default;
+
+    volatile_atomic int32_t refCount;
+    FAKE_FABRIC_RUNTIME_HANDLE runtime;
+};
+
+HRESULT fake_fabric_service_management_client_create(FAKE_FABRIC_RUNTIME_HANDLE runtime, IFabricServiceManagementClient6** client)
+{
+    HRESULT result;
+    FakeFabricServiceManagementClient* serviceManagementClient = new (std::nothrow) FakeFabricServiceManagementClient(runtime);
+    if (serviceManagementClient == NULL)
+    {
+        LogError("failure in new FakeFabricServiceManagementClient");
+        result = E_OUTOFMEMORY;
+    }
+    else
+    {
+        *client = serviceManagementClient;
+        result = S_OK;
+    }
+    return result;
+}
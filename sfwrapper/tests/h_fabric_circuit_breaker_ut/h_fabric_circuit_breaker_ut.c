@@ -0,0 +1,560 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umocktypes_windows.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+#include "c_pal/timer.h"
+#undef ENABLE_MOCKS
+
+#include "h_fabric_circuit_breaker.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_VALUES);
+IMPLEMENT_UMOCK_C_ENUM_TYPE(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_VALUES);
+
+#define TEST_FAILURE_PERCENT 50
+#define TEST_MINIMUM_CALLS 4
+#define TEST_WINDOW_MS 1000
+#define TEST_OPEN_MS 5000
+
+static const H_FABRIC_CIRCUIT_BREAKER_CONFIG test_config = { TEST_FAILURE_PERCENT, TEST_MINIMUM_CALLS, TEST_WINDOW_MS, TEST_OPEN_MS };
+static const H_FABRIC_CIRCUIT_BREAKER_CONFIG test_disabled_config = { 0, 0, 0, 0 };
+
+/*the time as seen by the breaker*/
+static double test_now;
+
+static double hook_timer_global_get_elapsed_ms(void)
+{
+    return test_now;
+}
+
+static void breaker_init(H_FABRIC_CIRCUIT_BREAKER* breaker)
+{
+    h_fabric_circuit_breaker_init(breaker, &test_config);
+    umock_c_reset_all_calls();
+}
+
+/*reports calls that all failed with a transient error until the breaker opens*/
+static void breaker_init_open(H_FABRIC_CIRCUIT_BREAKER* breaker)
+{
+    h_fabric_circuit_breaker_init(breaker, &test_config);
+    for (uint32_t i = 0; i < TEST_MINIMUM_CALLS; i++)
+    {
+        h_fabric_circuit_breaker_exit(breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, FABRIC_E_GATEWAY_NOT_REACHABLE);
+    }
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN, h_fabric_circuit_breaker_get_state(breaker));
+    umock_c_reset_all_calls();
+}
+
+static void breaker_init_half_open(H_FABRIC_CIRCUIT_BREAKER* breaker)
+{
+    breaker_init_open(breaker);
+    test_now += TEST_OPEN_MS;
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE, h_fabric_circuit_breaker_enter(breaker));
+    umock_c_reset_all_calls();
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types());
+
+    REGISTER_TYPE(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE);
+    REGISTER_TYPE(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY);
+
+    REGISTER_GLOBAL_MOCK_HOOK(timer_global_get_elapsed_ms, hook_timer_global_get_elapsed_ms);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    test_now = 10000;
+    umock_c_reset_all_calls();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+}
+
+/* h_fabric_circuit_breaker_init */
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_001: [ If breaker is NULL then h_fabric_circuit_breaker_init shall return. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_init_with_NULL_breaker_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_circuit_breaker_init(NULL, &test_config);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_002: [ If config is NULL then h_fabric_circuit_breaker_init shall return. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_init_with_NULL_config_returns)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+
+    ///act
+    h_fabric_circuit_breaker_init(&breaker, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_003: [ h_fabric_circuit_breaker_init shall copy config in breaker and set the state to H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED with no calls in the window. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_init_with_failure_percent_0_does_not_read_the_time)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+
+    ///act
+    h_fabric_circuit_breaker_init(&breaker, &test_disabled_config);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint32_t, 0, breaker.config.failure_percent);
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED, h_fabric_circuit_breaker_get_state(&breaker));
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.calls);
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.failures);
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_003: [ h_fabric_circuit_breaker_init shall copy config in breaker and set the state to H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED with no calls in the window. ]*/
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_004: [ If failure_percent of config is not 0 then h_fabric_circuit_breaker_init shall start the window at the current time by calling timer_global_get_elapsed_ms. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_init_succeeds)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    h_fabric_circuit_breaker_init(&breaker, &test_config);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint32_t, TEST_FAILURE_PERCENT, breaker.config.failure_percent);
+    ASSERT_ARE_EQUAL(uint32_t, TEST_MINIMUM_CALLS, breaker.config.minimum_calls);
+    ASSERT_ARE_EQUAL(uint32_t, TEST_WINDOW_MS, breaker.config.window_ms);
+    ASSERT_ARE_EQUAL(uint32_t, TEST_OPEN_MS, breaker.config.open_ms);
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED, h_fabric_circuit_breaker_get_state(&breaker));
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.calls);
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.failures);
+    ASSERT_ARE_EQUAL(int64_t, 10000, breaker.window_start_ms);
+}
+
+/* h_fabric_circuit_breaker_enter */
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_005: [ If breaker is NULL then h_fabric_circuit_breaker_enter shall fail and return H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_enter_with_NULL_breaker_fails)
+{
+    ///arrange
+
+    ///act
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY result = h_fabric_circuit_breaker_enter(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_006: [ If failure_percent of the configuration is 0 then h_fabric_circuit_breaker_enter shall return H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_enter_with_failure_percent_0_returns_ALLOWED)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    h_fabric_circuit_breaker_init(&breaker, &test_disabled_config);
+
+    ///act
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY result = h_fabric_circuit_breaker_enter(&breaker);
+
+    ///assert
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_007: [ If the state is H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED then h_fabric_circuit_breaker_enter shall return H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_enter_when_CLOSED_returns_ALLOWED)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init(&breaker);
+
+    ///act
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY result = h_fabric_circuit_breaker_enter(&breaker);
+
+    ///assert
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_009: [ Otherwise h_fabric_circuit_breaker_enter shall return H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_enter_when_OPEN_before_open_ms_returns_REJECTED)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init_open(&breaker);
+    test_now += TEST_OPEN_MS - 1;
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY result = h_fabric_circuit_breaker_enter(&breaker);
+
+    ///assert
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN, h_fabric_circuit_breaker_get_state(&breaker));
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_008: [ If the state is H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN and at least open_ms passed since the breaker opened (timer_global_get_elapsed_ms) then h_fabric_circuit_breaker_enter shall switch the state to H_FABRIC_CIRCUIT_BREAKER_STATE_HALF_OPEN and return H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_enter_when_OPEN_after_open_ms_returns_PROBE)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init_open(&breaker);
+    test_now += TEST_OPEN_MS;
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY result = h_fabric_circuit_breaker_enter(&breaker);
+
+    ///assert
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_HALF_OPEN, h_fabric_circuit_breaker_get_state(&breaker));
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_009: [ Otherwise h_fabric_circuit_breaker_enter shall return H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_enter_when_HALF_OPEN_returns_REJECTED)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init_half_open(&breaker);
+
+    ///act
+    H_FABRIC_CIRCUIT_BREAKER_ENTRY result = h_fabric_circuit_breaker_enter(&breaker);
+
+    ///assert
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_ENTRY, H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_HALF_OPEN, h_fabric_circuit_breaker_get_state(&breaker));
+}
+
+/* h_fabric_circuit_breaker_exit */
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_010: [ If breaker is NULL then h_fabric_circuit_breaker_exit shall return. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_with_NULL_breaker_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_circuit_breaker_exit(NULL, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, S_OK);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_011: [ If failure_percent of the configuration is 0 or entry is H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED then h_fabric_circuit_breaker_exit shall return. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_with_failure_percent_0_returns)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    h_fabric_circuit_breaker_init(&breaker, &test_disabled_config);
+
+    ///act
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, FABRIC_E_TIMEOUT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.calls);
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.failures);
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_011: [ If failure_percent of the configuration is 0 or entry is H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED then h_fabric_circuit_breaker_exit shall return. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_with_REJECTED_returns)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init(&breaker);
+
+    ///act
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_REJECTED, H_FABRIC_E_CIRCUIT_BREAKER_OPEN);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.calls);
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.failures);
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_012: [ h_fabric_circuit_breaker_exit shall consider that the call failed if hr is E_ABORT, FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or FABRIC_E_TIMEOUT. ]*/
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_016: [ h_fabric_circuit_breaker_exit shall increment the number of calls of the window and, if the call failed, the number of failures of the window. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_counts_the_transient_failures)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    HRESULT transient[] = { E_ABORT, FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT };
+    H_FABRIC_CIRCUIT_BREAKER_CONFIG config = test_config;
+    config.minimum_calls = 100; /*does not open*/
+    h_fabric_circuit_breaker_init(&breaker, &config);
+    umock_c_reset_all_calls();
+
+    for (uint32_t i = 0; i < sizeof(transient) / sizeof(transient[0]); i++)
+    {
+        STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    }
+
+    ///act
+    for (uint32_t i = 0; i < sizeof(transient) / sizeof(transient[0]); i++)
+    {
+        h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, transient[i]);
+    }
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int32_t, 4, breaker.calls);
+    ASSERT_ARE_EQUAL(int32_t, 4, breaker.failures);
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_012: [ h_fabric_circuit_breaker_exit shall consider that the call failed if hr is E_ABORT, FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or FABRIC_E_TIMEOUT. ]*/
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_016: [ h_fabric_circuit_breaker_exit shall increment the number of calls of the window and, if the call failed, the number of failures of the window. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_does_not_count_other_errors_as_failures)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    HRESULT not_transient[] = { S_OK, E_INVALIDARG, FABRIC_E_SERVICE_DOES_NOT_EXIST, E_OUTOFMEMORY };
+    breaker_init(&breaker);
+
+    for (uint32_t i = 0; i < sizeof(not_transient) / sizeof(not_transient[0]); i++)
+    {
+        STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    }
+
+    ///act
+    for (uint32_t i = 0; i < sizeof(not_transient) / sizeof(not_transient[0]); i++)
+    {
+        h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, not_transient[i]);
+    }
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int32_t, 4, breaker.calls);
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.failures);
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED, h_fabric_circuit_breaker_get_state(&breaker));
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_017: [ If the window has at least minimum_calls calls and the percentage of failures is at least failure_percent then h_fabric_circuit_breaker_exit shall record the current time as the time the breaker opened and switch the state from H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED to H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_does_not_open_before_minimum_calls)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init(&breaker);
+
+    for (uint32_t i = 0; i < TEST_MINIMUM_CALLS - 1; i++)
+    {
+        STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    }
+
+    ///act
+    for (uint32_t i = 0; i < TEST_MINIMUM_CALLS - 1; i++)
+    {
+        h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, FABRIC_E_TIMEOUT);
+    }
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED, h_fabric_circuit_breaker_get_state(&breaker));
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_017: [ If the window has at least minimum_calls calls and the percentage of failures is at least failure_percent then h_fabric_circuit_breaker_exit shall record the current time as the time the breaker opened and switch the state from H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED to H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_does_not_open_below_failure_percent)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init(&breaker);
+
+    /*1 failure out of 4 calls is 25%*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, S_OK);
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, S_OK);
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, FABRIC_E_TIMEOUT);
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, S_OK);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED, h_fabric_circuit_breaker_get_state(&breaker));
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_017: [ If the window has at least minimum_calls calls and the percentage of failures is at least failure_percent then h_fabric_circuit_breaker_exit shall record the current time as the time the breaker opened and switch the state from H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED to H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_opens_at_failure_percent)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init(&breaker);
+
+    /*2 failures out of 4 calls is 50%*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, S_OK);
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, E_ABORT);
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, S_OK);
+    test_now += 10;
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, FABRIC_E_OBJECT_CLOSED);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN, h_fabric_circuit_breaker_get_state(&breaker));
+    ASSERT_ARE_EQUAL(int64_t, 10010, breaker.opened_ms);
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_017: [ If the window has at least minimum_calls calls and the percentage of failures is at least failure_percent then h_fabric_circuit_breaker_exit shall record the current time as the time the breaker opened and switch the state from H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED to H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_of_a_call_allowed_before_the_breaker_opened_does_not_move_the_time_it_opened)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init_open(&breaker);
+    test_now += 10;
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, FABRIC_E_TIMEOUT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN, h_fabric_circuit_breaker_get_state(&breaker));
+    ASSERT_ARE_EQUAL(int64_t, 10000, breaker.opened_ms);
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_015: [ If at least window_ms passed since the window started then h_fabric_circuit_breaker_exit shall start a new window at the current time. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_after_window_ms_starts_a_new_window)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init(&breaker);
+    for (uint32_t i = 0; i < TEST_MINIMUM_CALLS - 1; i++)
+    {
+        h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, FABRIC_E_TIMEOUT);
+    }
+    umock_c_reset_all_calls();
+    test_now += TEST_WINDOW_MS;
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_ALLOWED, FABRIC_E_TIMEOUT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED, h_fabric_circuit_breaker_get_state(&breaker));
+    ASSERT_ARE_EQUAL(int32_t, 1, breaker.calls);
+    ASSERT_ARE_EQUAL(int32_t, 1, breaker.failures);
+    ASSERT_ARE_EQUAL(int64_t, 10000 + TEST_WINDOW_MS, breaker.window_start_ms);
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_013: [ If entry is H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE and the call failed then h_fabric_circuit_breaker_exit shall record the current time as the time the breaker opened and switch the state to H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_of_a_failed_PROBE_opens_again)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init_half_open(&breaker);
+    test_now += 20;
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE, FABRIC_E_GATEWAY_NOT_REACHABLE);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN, h_fabric_circuit_breaker_get_state(&breaker));
+    ASSERT_ARE_EQUAL(int64_t, 10000 + TEST_OPEN_MS + 20, breaker.opened_ms);
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_014: [ If entry is H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE and the call did not fail then h_fabric_circuit_breaker_exit shall start a new window at the current time and switch the state to H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_exit_of_a_successful_PROBE_closes)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init_half_open(&breaker);
+    test_now += 20;
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    h_fabric_circuit_breaker_exit(&breaker, H_FABRIC_CIRCUIT_BREAKER_ENTRY_PROBE, S_OK);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED, h_fabric_circuit_breaker_get_state(&breaker));
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.calls);
+    ASSERT_ARE_EQUAL(int32_t, 0, breaker.failures);
+    ASSERT_ARE_EQUAL(int64_t, 10000 + TEST_OPEN_MS + 20, breaker.window_start_ms);
+}
+
+/* h_fabric_circuit_breaker_get_state */
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_018: [ If breaker is NULL then h_fabric_circuit_breaker_get_state shall return H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_get_state_with_NULL_breaker_returns_CLOSED)
+{
+    ///arrange
+
+    ///act
+    H_FABRIC_CIRCUIT_BREAKER_STATE result = h_fabric_circuit_breaker_get_state(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_CLOSED, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CIRCUIT_BREAKER_01_019: [ h_fabric_circuit_breaker_get_state shall return the state of breaker. ]*/
+TEST_FUNCTION(h_fabric_circuit_breaker_get_state_returns_the_state)
+{
+    ///arrange
+    H_FABRIC_CIRCUIT_BREAKER breaker;
+    breaker_init_open(&breaker);
+
+    ///act
+    H_FABRIC_CIRCUIT_BREAKER_STATE result = h_fabric_circuit_breaker_get_state(&breaker);
+
+    ///assert
+    ASSERT_ARE_EQUAL(H_FABRIC_CIRCUIT_BREAKER_STATE, H_FABRIC_CIRCUIT_BREAKER_STATE_OPEN, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
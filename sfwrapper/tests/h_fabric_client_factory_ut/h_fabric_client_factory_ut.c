@@ -0,0 +1,206 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_windows.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+/*FabricCreateLocalClient is not mockable by its header*/
+MOCKABLE_FUNCTION(, HRESULT, FabricCreateLocalClient, REFIID, iid, void**, fabricClient);
+
+MOCKABLE_FUNCTION(, HRESULT, test_create_local_client, void*, context, REFIID, iid, void**, fabricClient);
+
+#undef ENABLE_MOCKS
+
+#include "h_fabric_client_factory.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+static const H_FABRIC_CLIENT_FACTORY test_factory = { test_create_local_client, (void*)0x4242 };
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types(), "umocktypes_windows_register_types");
+
+    REGISTER_GLOBAL_MOCK_RETURNS(FabricCreateLocalClient, S_OK, FABRIC_E_CONNECTION_DENIED);
+    REGISTER_GLOBAL_MOCK_RETURNS(test_create_local_client, S_OK, E_OUTOFMEMORY);
+
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(REFIID, void*);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    h_fabric_client_factory_set(NULL);
+    umock_c_reset_all_calls();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    h_fabric_client_factory_set(NULL);
+}
+
+/*h_fabric_client_factory_create_local_client*/
+
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_004: [ If iid is NULL then h_fabric_client_factory_create_local_client shall fail and return E_POINTER. ]*/
+TEST_FUNCTION(h_fabric_client_factory_create_local_client_with_iid_NULL_fails)
+{
+    ///arrange
+    void* client;
+
+    ///act
+    HRESULT result = h_fabric_client_factory_create_local_client(NULL, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, E_POINTER, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_005: [ If fabricClient is NULL then h_fabric_client_factory_create_local_client shall fail and return E_POINTER. ]*/
+TEST_FUNCTION(h_fabric_client_factory_create_local_client_with_fabricClient_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    HRESULT result = h_fabric_client_factory_create_local_client(&IID_IFabricQueryClient10, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, E_POINTER, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_006: [ h_fabric_client_factory_create_local_client shall read the factory of the process by calling interlocked_compare_exchange_pointer. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_007: [ If there is no factory then h_fabric_client_factory_create_local_client shall call FabricCreateLocalClient with iid and fabricClient and return its result. ]*/
+TEST_FUNCTION(h_fabric_client_factory_create_local_client_without_factory_calls_FabricCreateLocalClient)
+{
+    ///arrange
+    void* client;
+
+    STRICT_EXPECTED_CALL(FabricCreateLocalClient(&IID_IFabricQueryClient10, &client));
+
+    ///act
+    HRESULT result = h_fabric_client_factory_create_local_client(&IID_IFabricQueryClient10, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, S_OK, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_007: [ If there is no factory then h_fabric_client_factory_create_local_client shall call FabricCreateLocalClient with iid and fabricClient and return its result. ]*/
+TEST_FUNCTION(h_fabric_client_factory_create_local_client_without_factory_returns_the_error_of_FabricCreateLocalClient)
+{
+    ///arrange
+    void* client;
+
+    STRICT_EXPECTED_CALL(FabricCreateLocalClient(&IID_IFabricQueryClient10, &client))
+        .SetReturn(FABRIC_E_CONNECTION_DENIED);
+
+    ///act
+    HRESULT result = h_fabric_client_factory_create_local_client(&IID_IFabricQueryClient10, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, FABRIC_E_CONNECTION_DENIED, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*h_fabric_client_factory_set*/
+
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_002: [ h_fabric_client_factory_set shall make factory the factory of the process by calling interlocked_exchange_pointer. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_008: [ Otherwise h_fabric_client_factory_create_local_client shall call create_local_client of the factory with its context, iid and fabricClient and return its result. ]*/
+TEST_FUNCTION(h_fabric_client_factory_create_local_client_with_a_factory_calls_the_factory)
+{
+    ///arrange
+    void* client;
+    h_fabric_client_factory_set(&test_factory);
+
+    STRICT_EXPECTED_CALL(test_create_local_client((void*)0x4242, &IID_IFabricServiceManagementClient6, &client));
+
+    ///act
+    HRESULT result = h_fabric_client_factory_create_local_client(&IID_IFabricServiceManagementClient6, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, S_OK, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_008: [ Otherwise h_fabric_client_factory_create_local_client shall call create_local_client of the factory with its context, iid and fabricClient and return its result. ]*/
+TEST_FUNCTION(h_fabric_client_factory_create_local_client_with_a_factory_returns_the_error_of_the_factory)
+{
+    ///arrange
+    void* client;
+    h_fabric_client_factory_set(&test_factory);
+
+    STRICT_EXPECTED_CALL(test_create_local_client((void*)0x4242, &IID_IFabricServiceManagementClient6, &client))
+        .SetReturn(E_OUTOFMEMORY);
+
+    ///act
+    HRESULT result = h_fabric_client_factory_create_local_client(&IID_IFabricServiceManagementClient6, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, E_OUTOFMEMORY, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_003: [ If factory is NULL then the clients shall be created by FabricCreateLocalClient again. ]*/
+TEST_FUNCTION(h_fabric_client_factory_set_with_NULL_goes_back_to_FabricCreateLocalClient)
+{
+    ///arrange
+    void* client;
+    h_fabric_client_factory_set(&test_factory);
+    h_fabric_client_factory_set(NULL);
+
+    STRICT_EXPECTED_CALL(FabricCreateLocalClient(&IID_IFabricQueryClient10, &client));
+
+    ///act
+    HRESULT result = h_fabric_client_factory_create_local_client(&IID_IFabricQueryClient10, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, S_OK, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_FACTORY_01_001: [ If factory is not NULL and its create_local_client is NULL then h_fabric_client_factory_set shall return. ]*/
+TEST_FUNCTION(h_fabric_client_factory_set_with_create_local_client_NULL_keeps_the_current_factory)
+{
+    ///arrange
+    void* client;
+    H_FABRIC_CLIENT_FACTORY invalid_factory = { NULL, NULL };
+    h_fabric_client_factory_set(&test_factory);
+
+    STRICT_EXPECTED_CALL(test_create_local_client((void*)0x4242, &IID_IFabricQueryClient10, &client));
+
+    ///act
+    h_fabric_client_factory_set(&invalid_factory);
+    HRESULT result = h_fabric_client_factory_create_local_client(&IID_IFabricQueryClient10, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, S_OK, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
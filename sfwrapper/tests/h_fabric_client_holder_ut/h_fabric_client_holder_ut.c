@@ -0,0 +1,646 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#ifdef __cplusplus
+#include <cstdlib>
+#include <cstdint>
+#else
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#endif
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umocktypes_windows.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+#include "c_pal/sync.h"
+
+#define ENABLE_MOCKS
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked_hl.h"
+
+MOCKABLE_FUNCTION(, HRESULT, test_create_instance, void**, instance);
+MOCKABLE_FUNCTION(, void, test_release_instance, void*, instance);
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "h_fabric_client_holder.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT_VALUES);
+
+#define TEST_INSTANCE ((void*)0x4242)
+#define TEST_NEW_INSTANCE ((void*)0x4343)
+
+static HRESULT hook_test_create_instance(void** instance)
+{
+    *instance = TEST_NEW_INSTANCE;
+    return S_OK;
+}
+
+/*the generation that "another thread" makes current while this thread waits in h_fabric_client_holder_recreate*/
+static H_FABRIC_CLIENT_HOLDER* other_thread_holder;
+static H_FABRIC_CLIENT_GENERATION* other_thread_generation;
+
+static INTERLOCKED_HL_RESULT hook_InterlockedHL_WaitForValue_other_thread_recreates(int32_t volatile_atomic* address_to_check, int32_t value_to_wait, uint32_t milliseconds)
+{
+    (void)value_to_wait;
+    (void)milliseconds;
+    (void)interlocked_exchange_pointer(&other_thread_holder->current, other_thread_generation);
+    (void)interlocked_exchange(address_to_check, 0);
+    return INTERLOCKED_HL_OK;
+}
+
+static void holder_init(H_FABRIC_CLIENT_HOLDER* holder)
+{
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_client_holder_init(holder, TEST_INSTANCE, test_create_instance, test_release_instance));
+    umock_c_reset_all_calls();
+}
+
+static void holder_deinit(H_FABRIC_CLIENT_HOLDER* holder)
+{
+    h_fabric_client_holder_deinit(holder);
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types());
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(malloc, NULL);
+
+    REGISTER_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT);
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE, void*);
+
+    REGISTER_GLOBAL_MOCK_RETURNS(InterlockedHL_WaitForValue, INTERLOCKED_HL_OK, INTERLOCKED_HL_ERROR);
+    REGISTER_GLOBAL_MOCK_HOOK(test_create_instance, hook_test_create_instance);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    umock_c_reset_all_calls();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+}
+
+/* h_fabric_client_holder_init */
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_001: [ If holder is NULL then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_init_with_NULL_holder_fails)
+{
+    ///arrange
+
+    ///act
+    int result = h_fabric_client_holder_init(NULL, TEST_INSTANCE, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_002: [ If instance is NULL then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_init_with_NULL_instance_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+
+    ///act
+    int result = h_fabric_client_holder_init(&holder, NULL, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_003: [ If create_instance is NULL then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_init_with_NULL_create_instance_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+
+    ///act
+    int result = h_fabric_client_holder_init(&holder, TEST_INSTANCE, NULL, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_004: [ If release_instance is NULL then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_init_with_NULL_release_instance_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+
+    ///act
+    int result = h_fabric_client_holder_init(&holder, TEST_INSTANCE, test_create_instance, NULL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_005: [ h_fabric_client_holder_init shall allocate a H_FABRIC_CLIENT_GENERATION for instance with generation number 1 and a reference count of 1, owned by the holder. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_007: [ h_fabric_client_holder_init shall make the generation the current generation of holder. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_008: [ h_fabric_client_holder_init shall succeed and return 0. ]*/
+TEST_FUNCTION(h_fabric_client_holder_init_succeeds)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+
+    ///act
+    int result = h_fabric_client_holder_init(&holder, TEST_INSTANCE, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    H_FABRIC_CLIENT_GENERATION* current = holder.current;
+    ASSERT_IS_NOT_NULL(current);
+    ASSERT_ARE_EQUAL(void_ptr, TEST_INSTANCE, current->instance);
+    ASSERT_ARE_EQUAL(uint32_t, 1, current->generation);
+    ASSERT_ARE_EQUAL(int32_t, 1, current->ref_count);
+    ASSERT_ARE_EQUAL(int32_t, 0, holder.pins);
+    ASSERT_ARE_EQUAL(int32_t, 0, holder.is_recreating);
+
+    ///clean
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_006: [ If there are any failures then h_fabric_client_holder_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_init_fails_when_malloc_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG))
+        .SetReturn(NULL);
+
+    ///act
+    int result = h_fabric_client_holder_init(&holder, TEST_INSTANCE, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_client_holder_deinit */
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_009: [ If holder is NULL then h_fabric_client_holder_deinit shall return. ]*/
+TEST_FUNCTION(h_fabric_client_holder_deinit_with_NULL_holder_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_client_holder_deinit(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_010: [ h_fabric_client_holder_deinit shall give up the reference of the holder on the current generation, releasing the instance and freeing the generation when it was the last reference. ]*/
+TEST_FUNCTION(h_fabric_client_holder_deinit_releases_the_instance)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+
+    STRICT_EXPECTED_CALL(test_release_instance(TEST_INSTANCE));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    h_fabric_client_holder_deinit(&holder);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_client_holder_acquire */
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_011: [ If holder is NULL then h_fabric_client_holder_acquire shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_client_holder_acquire_with_NULL_holder_fails)
+{
+    ///arrange
+
+    ///act
+    H_FABRIC_CLIENT_GENERATION* result = h_fabric_client_holder_acquire(NULL);
+
+    ///assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_012: [ h_fabric_client_holder_acquire shall increment the number of pins of holder. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_013: [ h_fabric_client_holder_acquire shall read the current generation and increment its reference count. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_014: [ h_fabric_client_holder_acquire shall decrement the number of pins and, if it reaches 0 while a recreate is in progress, wake the recreating thread. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_015: [ h_fabric_client_holder_acquire shall return the generation. ]*/
+TEST_FUNCTION(h_fabric_client_holder_acquire_returns_the_current_generation_with_a_reference)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+
+    ///act
+    H_FABRIC_CLIENT_GENERATION* result = h_fabric_client_holder_acquire(&holder);
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, holder.current, result);
+    ASSERT_ARE_EQUAL(void_ptr, TEST_INSTANCE, result->instance);
+    ASSERT_ARE_EQUAL(int32_t, 2, result->ref_count);
+    ASSERT_ARE_EQUAL(int32_t, 0, holder.pins);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_client_holder_release(&holder, result);
+    holder_deinit(&holder);
+}
+
+/* h_fabric_client_holder_release */
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_016: [ If holder is NULL then h_fabric_client_holder_release shall return. ]*/
+TEST_FUNCTION(h_fabric_client_holder_release_with_NULL_holder_returns)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+
+    ///act
+    h_fabric_client_holder_release(NULL, generation);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int32_t, 2, generation->ref_count);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_client_holder_release(&holder, generation);
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_017: [ If generation is NULL then h_fabric_client_holder_release shall return. ]*/
+TEST_FUNCTION(h_fabric_client_holder_release_with_NULL_generation_returns)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+
+    ///act
+    h_fabric_client_holder_release(&holder, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_018: [ h_fabric_client_holder_release shall decrement the reference count of generation. ]*/
+TEST_FUNCTION(h_fabric_client_holder_release_of_the_current_generation_keeps_the_instance)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+
+    ///act
+    h_fabric_client_holder_release(&holder, generation);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int32_t, 1, generation->ref_count);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_018: [ h_fabric_client_holder_release shall decrement the reference count of generation. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_019: [ If the reference count reaches 0 then h_fabric_client_holder_release shall release the instance by calling release_instance and free the generation. ]*/
+TEST_FUNCTION(h_fabric_client_holder_release_of_the_last_reference_on_a_replaced_generation_releases_the_instance)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_client_holder_recreate(&holder, generation));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(test_release_instance(TEST_INSTANCE));
+    STRICT_EXPECTED_CALL(free(generation));
+
+    ///act
+    h_fabric_client_holder_release(&holder, generation);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    holder_deinit(&holder);
+}
+
+/* h_fabric_client_holder_recreate */
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_020: [ If holder is NULL then h_fabric_client_holder_recreate shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_with_NULL_holder_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+
+    ///act
+    int result = h_fabric_client_holder_recreate(NULL, generation);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_client_holder_release(&holder, generation);
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_021: [ If failed_generation is NULL then h_fabric_client_holder_recreate shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_with_NULL_failed_generation_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+
+    ///act
+    int result = h_fabric_client_holder_recreate(&holder, NULL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_023: [ h_fabric_client_holder_recreate shall switch is_recreating from 0 to 1. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_027: [ h_fabric_client_holder_recreate shall create a new instance by calling create_instance. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_029: [ h_fabric_client_holder_recreate shall allocate a H_FABRIC_CLIENT_GENERATION for the new instance with the generation number of failed_generation + 1. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_030: [ h_fabric_client_holder_recreate shall make the new generation the current generation. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_031: [ h_fabric_client_holder_recreate shall wait for the number of pins of holder to reach 0 by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_033: [ h_fabric_client_holder_recreate shall give up the reference of the holder on failed_generation. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_034: [ h_fabric_client_holder_recreate shall succeed and return 0. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_035: [ h_fabric_client_holder_recreate shall set is_recreating to 0 and wake all the threads waiting for it. ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_succeeds)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(&holder.pins, 0, UINT32_MAX));
+
+    ///act
+    int result = h_fabric_client_holder_recreate(&holder, generation);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    H_FABRIC_CLIENT_GENERATION* current = holder.current;
+    ASSERT_ARE_NOT_EQUAL(void_ptr, generation, current);
+    ASSERT_ARE_EQUAL(void_ptr, TEST_NEW_INSTANCE, current->instance);
+    ASSERT_ARE_EQUAL(uint32_t, 2, current->generation);
+    ASSERT_ARE_EQUAL(int32_t, 1, current->ref_count);
+    ASSERT_ARE_EQUAL(int32_t, 1, generation->ref_count); /*only the caller is left*/
+    ASSERT_ARE_EQUAL(int32_t, 0, holder.is_recreating);
+
+    ///clean
+    h_fabric_client_holder_release(&holder, generation);
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_022: [ If failed_generation is not the current generation then h_fabric_client_holder_recreate shall succeed and return 0 (another thread already replaced it). ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_with_a_replaced_generation_does_not_recreate_again)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation_1 = h_fabric_client_holder_acquire(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation_2 = h_fabric_client_holder_acquire(&holder);
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_client_holder_recreate(&holder, generation_1));
+    umock_c_reset_all_calls();
+
+    ///act
+    int result = h_fabric_client_holder_recreate(&holder, generation_2); /*same failed generation, reported by a second thread*/
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    H_FABRIC_CLIENT_GENERATION* current = holder.current;
+    ASSERT_ARE_EQUAL(uint32_t, 2, current->generation);
+
+    ///clean
+    h_fabric_client_holder_release(&holder, generation_1);
+    h_fabric_client_holder_release(&holder, generation_2);
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_024: [ If another thread is already recreating then h_fabric_client_holder_recreate shall wait for is_recreating to become 0 by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_026: [ h_fabric_client_holder_recreate shall succeed and return 0 if the other thread replaced failed_generation, otherwise it shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_waits_for_the_thread_that_recreates)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    H_FABRIC_CLIENT_GENERATION new_generation;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+
+    new_generation.instance = TEST_NEW_INSTANCE;
+    new_generation.generation = 2;
+    (void)interlocked_exchange(&new_generation.ref_count, 1);
+    other_thread_holder = &holder;
+    other_thread_generation = &new_generation;
+    (void)interlocked_exchange(&holder.is_recreating, 1); /*some other thread is recreating*/
+
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForValue, hook_InterlockedHL_WaitForValue_other_thread_recreates);
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(&holder.is_recreating, 0, UINT32_MAX));
+
+    ///act
+    int result = h_fabric_client_holder_recreate(&holder, generation);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(void_ptr, &new_generation, holder.current);
+
+    ///clean
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForValue, NULL);
+    (void)interlocked_exchange_pointer(&holder.current, generation); /*new_generation lives on the stack*/
+    h_fabric_client_holder_release(&holder, generation);
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_024: [ If another thread is already recreating then h_fabric_client_holder_recreate shall wait for is_recreating to become 0 by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_026: [ h_fabric_client_holder_recreate shall succeed and return 0 if the other thread replaced failed_generation, otherwise it shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_fails_when_the_thread_that_recreates_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+    (void)interlocked_exchange(&holder.is_recreating, 1); /*some other thread is recreating, and it is going to fail*/
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(&holder.is_recreating, 0, UINT32_MAX));
+
+    ///act
+    int result = h_fabric_client_holder_recreate(&holder, generation);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(void_ptr, generation, holder.current);
+
+    ///clean
+    (void)interlocked_exchange(&holder.is_recreating, 0);
+    h_fabric_client_holder_release(&holder, generation);
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_025: [ If waiting fails then h_fabric_client_holder_recreate shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_fails_when_waiting_for_the_thread_that_recreates_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+    (void)interlocked_exchange(&holder.is_recreating, 1);
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(&holder.is_recreating, 0, UINT32_MAX))
+        .SetReturn(INTERLOCKED_HL_ERROR);
+
+    ///act
+    int result = h_fabric_client_holder_recreate(&holder, generation);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    (void)interlocked_exchange(&holder.is_recreating, 0);
+    h_fabric_client_holder_release(&holder, generation);
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_028: [ If there are any failures then h_fabric_client_holder_recreate shall keep failed_generation as the current generation, fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_fails_when_create_instance_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG))
+        .SetReturn(E_FAIL);
+
+    ///act
+    int result = h_fabric_client_holder_recreate(&holder, generation);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(void_ptr, generation, holder.current);
+    ASSERT_ARE_EQUAL(int32_t, 2, generation->ref_count);
+    ASSERT_ARE_EQUAL(int32_t, 0, holder.is_recreating);
+
+    ///clean
+    h_fabric_client_holder_release(&holder, generation);
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_028: [ If there are any failures then h_fabric_client_holder_recreate shall keep failed_generation as the current generation, fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_fails_when_malloc_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG))
+        .SetReturn(NULL);
+    STRICT_EXPECTED_CALL(test_release_instance(TEST_NEW_INSTANCE));
+
+    ///act
+    int result = h_fabric_client_holder_recreate(&holder, generation);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(void_ptr, generation, holder.current);
+    ASSERT_ARE_EQUAL(int32_t, 0, holder.is_recreating);
+
+    ///clean
+    h_fabric_client_holder_release(&holder, generation);
+    holder_deinit(&holder);
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_HOLDER_01_032: [ If waiting for the pins fails then h_fabric_client_holder_recreate shall not give up the reference of the holder on failed_generation. ]*/
+TEST_FUNCTION(h_fabric_client_holder_recreate_keeps_the_failed_generation_when_waiting_for_pins_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_HOLDER holder;
+    holder_init(&holder);
+    H_FABRIC_CLIENT_GENERATION* generation = h_fabric_client_holder_acquire(&holder);
+
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(&holder.pins, 0, UINT32_MAX))
+        .SetReturn(INTERLOCKED_HL_ERROR);
+
+    ///act
+    int result = h_fabric_client_holder_recreate(&holder, generation);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_NOT_EQUAL(void_ptr, generation, holder.current);
+    ASSERT_ARE_EQUAL(int32_t, 2, generation->ref_count);
+
+    ///clean
+    h_fabric_client_holder_release(&holder, generation);
+    h_fabric_client_holder_release(&holder, generation); /*the reference that was leaked*/
+    holder_deinit(&holder);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,269 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+#include "testrunnerswitcher.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/threadapi.h"
+#include "c_pal/timer.h"
+
+#include "sf_macros.h"
+#include "h_fabric_macro_generator.h"
+
+TEST_DEFINE_ENUM_TYPE(THREADAPI_RESULT, THREADAPI_RESULT_VALUES);
+
+/*this measures how the calls of many threads sharing one H_FABRIC_HANDLE scale with the number of clients in the handle.
+The client is a local fake: every instance serializes part of each call on a lock of its own, the same way a real IFabric client serializes part of the work of its calls*/
+
+#define FAKE_SERIALIZED_WORK 2000 /*spins done while holding the lock of the instance*/
+#define FAKE_PARALLEL_WORK 2000 /*spins done outside of the lock of the instance*/
+#define CALLS_PER_THREAD 20000
+#define MAX_THREADS 16
+#define MIN_POOLED_SPEEDUP 1.5 /*half of the work of a call is serialized by the client, so 1 client caps the calls at about 2 threads worth of work and 4 clients shall at least do better than that*/
+
+typedef struct IFabricPerfClient IFabricPerfClient;
+
+typedef struct IFabricPerfClientVtbl
+{
+    ULONG(STDMETHODCALLTYPE* Release)(
+        IFabricPerfClient* This);
+
+    HRESULT(STDMETHODCALLTYPE* DoPerfQuery)(
+        IFabricPerfClient* This,
+        /* [in] */ DWORD timeoutMilliseconds
+        );
+} IFabricPerfClientVtbl;
+
+struct IFabricPerfClient
+{
+    CONST_VTBL struct IFabricPerfClientVtbl* lpVtbl;
+    volatile_atomic int32_t lock;
+    volatile_atomic int32_t sink; /*keeps the spins from being optimized away*/
+};
+
+static void spin(IFabricPerfClient* This, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        (void)interlocked_add(&This->sink, 0);
+    }
+}
+
+static ULONG STDMETHODCALLTYPE fake_Release(IFabricPerfClient* This)
+{
+    free(This);
+    return 0;
+}
+
+static HRESULT STDMETHODCALLTYPE fake_DoPerfQuery(IFabricPerfClient* This, DWORD timeoutMilliseconds)
+{
+    (void)timeoutMilliseconds;
+
+    while (interlocked_compare_exchange(&This->lock, 1, 0) != 0)
+    {
+        /*spin*/
+    }
+    spin(This, FAKE_SERIALIZED_WORK);
+    (void)interlocked_exchange(&This->lock, 0);
+
+    spin(This, FAKE_PARALLEL_WORK);
+    return S_OK;
+}
+
+static IFabricPerfClientVtbl fake_vtbl =
+{
+    fake_Release,
+    fake_DoPerfQuery
+};
+
+/*the "sync" wrapper and the creation function, as the H_FABRIC macros expect them*/
+static HRESULT DoPerfQuery(IFabricPerfClient* This, DWORD timeoutMilliseconds)
+{
+    return This->lpVtbl->DoPerfQuery(This, timeoutMilliseconds);
+}
+
+HRESULT CREATE_IFABRICINSTANCE_NAME(IFabricPerfClient)(IFabricPerfClient** fabricVariable)
+{
+    HRESULT result;
+    IFabricPerfClient* instance = malloc(sizeof(IFabricPerfClient));
+    if (instance == NULL)
+    {
+        result = E_OUTOFMEMORY;
+    }
+    else
+    {
+        instance->lpVtbl = &fake_vtbl;
+        (void)interlocked_exchange(&instance->lock, 0);
+        (void)interlocked_exchange(&instance->sink, 0);
+        *fabricVariable = instance;
+        result = S_OK;
+    }
+    return result;
+}
+
+H_FABRIC_DEFINE_TYPEDEF(IFabricPerfClient);
+
+H_FABRIC_DECLARE_CREATE(IFabricPerfClient);
+H_FABRIC_DECLARE_DESTROY(IFabricPerfClient);
+
+H_FABRIC_DECLARE_API(IFabricPerfClient, DoPerfQuery,
+    IN_ARGS(
+        ARG(DWORD, timeoutMilliseconds)
+    )
+)
+
+H_FABRIC_DEFINE_STRUCT_TYPE(IFabricPerfClient);
+
+H_FABRIC_DEFINE_CREATE(IFabricPerfClient);
+H_FABRIC_DEFINE_DESTROY(IFabricPerfClient);
+
+H_FABRIC_DEFINE_API(IFabricPerfClient, DoPerfQuery,
+    IN_ARGS(
+        ARG(DWORD, timeoutMilliseconds)
+    )
+)
+
+typedef struct PERF_THREAD_CONTEXT_TAG
+{
+    H_FABRIC_HANDLE(IFabricPerfClient) handle;
+    volatile_atomic int32_t* start;
+    uint32_t failures;
+} PERF_THREAD_CONTEXT;
+
+static int perf_thread(void* context)
+{
+    PERF_THREAD_CONTEXT* thread_context = context;
+
+    while (interlocked_add(thread_context->start, 0) == 0)
+    {
+        /*all the threads start together*/
+    }
+
+    for (uint32_t i = 0; i < CALLS_PER_THREAD; i++)
+    {
+        if (FAILED(H_FABRIC_API(DoPerfQuery)(thread_context->handle, 10000)))
+        {
+            thread_context->failures++;
+        }
+    }
+    return 0;
+}
+
+/*returns the calls/second of thread_count threads sharing a handle of client_count clients*/
+static double measure(uint32_t thread_count, uint32_t client_count, H_FABRIC_CLIENT_POOL_SELECTION selection)
+{
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 1, 0));
+    H_FABRIC_HANDLE(IFabricPerfClient) handle = H_FABRIC_HANDLE_CREATE_POOLED(IFabricPerfClient)(client_count, selection, &retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+
+    volatile_atomic int32_t start;
+    (void)interlocked_exchange(&start, 0);
+
+    THREAD_HANDLE threads[MAX_THREADS];
+    PERF_THREAD_CONTEXT contexts[MAX_THREADS];
+    for (uint32_t i = 0; i < thread_count; i++)
+    {
+        contexts[i].handle = handle;
+        contexts[i].start = &start;
+        contexts[i].failures = 0;
+        ASSERT_ARE_EQUAL(THREADAPI_RESULT, THREADAPI_OK, ThreadAPI_Create(&threads[i], perf_thread, &contexts[i]));
+    }
+
+    double start_time = timer_global_get_elapsed_ms();
+    (void)interlocked_exchange(&start, 1);
+
+    for (uint32_t i = 0; i < thread_count; i++)
+    {
+        int thread_return;
+        ASSERT_ARE_EQUAL(THREADAPI_RESULT, THREADAPI_OK, ThreadAPI_Join(threads[i], &thread_return));
+        ASSERT_ARE_EQUAL(uint32_t, 0, contexts[i].failures);
+    }
+    double elapsed = timer_global_get_elapsed_ms() - start_time;
+
+    H_FABRIC_HANDLE_DESTROY(IFabricPerfClient)(handle);
+
+    return (double)thread_count * CALLS_PER_THREAD * 1000.0 / (elapsed > 0 ? elapsed : 1);
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, gballoc_hl_init(NULL, NULL));
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+}
+
+TEST_FUNCTION(h_fabric_client_pool_throughput_scales_with_the_number_of_threads)
+{
+    ///arrange
+    uint32_t thread_counts[] = { 1, 2, 4, 8, MAX_THREADS };
+
+    ///act
+    ///assert
+    LogInfo("%-8s %-16s %-24s %-24s", "threads", "1 client", "N clients (affinity)", "N clients (least in flight)");
+    for (uint32_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++)
+    {
+        uint32_t thread_count = thread_counts[i];
+        double single_client = measure(thread_count, 1, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY);
+        double pooled_affinity = measure(thread_count, thread_count, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY);
+        double pooled_least_in_flight = measure(thread_count, thread_count, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+        LogInfo("%-8" PRIu32 " %-16.0f %-24.0f %-24.0f (calls/s), speedup over 1 client: %.2fx (affinity), %.2fx (least in flight)",
+            thread_count, single_client, pooled_affinity, pooled_least_in_flight, pooled_affinity / single_client, pooled_least_in_flight / single_client);
+    }
+}
+
+TEST_FUNCTION(h_fabric_client_pool_throughput_scales_with_the_number_of_clients)
+{
+    ///arrange
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    uint32_t thread_count = (system_info.dwNumberOfProcessors < MAX_THREADS) ? system_info.dwNumberOfProcessors : MAX_THREADS;
+    uint32_t client_counts[] = { 1, 2, 4, 8, MAX_THREADS };
+    double throughputs[sizeof(client_counts) / sizeof(client_counts[0])];
+
+    ///act
+    LogInfo("%" PRIu32 " threads", thread_count);
+    LogInfo("%-8s %-16s %-16s", "clients", "calls/s", "speedup");
+    for (uint32_t i = 0; i < sizeof(client_counts) / sizeof(client_counts[0]); i++)
+    {
+        throughputs[i] = measure(thread_count, client_counts[i], H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+        LogInfo("%-8" PRIu32 " %-16.0f %.2fx", client_counts[i], throughputs[i], throughputs[i] / throughputs[0]);
+    }
+
+    ///assert
+    if (thread_count < 4)
+    {
+        LogInfo("only %" PRIu32 " processors, the speedup of 4 clients is not checked", thread_count);
+    }
+    else
+    {
+        /*client_counts[2] is 4*/
+        ASSERT_IS_TRUE(throughputs[2] > MIN_POOLED_SPEEDUP * throughputs[0]);
+    }
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
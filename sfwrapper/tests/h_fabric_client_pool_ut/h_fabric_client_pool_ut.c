@@ -0,0 +1,576 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umocktypes_windows.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+
+#include "h_fabric_client_holder.h"
+
+MOCKABLE_FUNCTION(, HRESULT, test_create_instance, void**, instance);
+MOCKABLE_FUNCTION(, void, test_release_instance, void*, instance);
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "h_fabric_client_pool.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(H_FABRIC_CLIENT_POOL_SELECTION, H_FABRIC_CLIENT_POOL_SELECTION_VALUES);
+
+#define TEST_INSTANCE ((void*)0x4242)
+#define TEST_POOL_SIZE 3
+
+static H_FABRIC_CLIENT_POOL_ENTRY test_entries[TEST_POOL_SIZE];
+
+static HRESULT hook_test_create_instance(void** instance)
+{
+    *instance = TEST_INSTANCE;
+    return S_OK;
+}
+
+static void pool_init(H_FABRIC_CLIENT_POOL* pool, uint32_t size, H_FABRIC_CLIENT_POOL_SELECTION selection)
+{
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_client_pool_init(pool, test_entries, size, selection, test_create_instance, test_release_instance));
+    umock_c_reset_all_calls();
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types());
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+
+    REGISTER_TYPE(H_FABRIC_CLIENT_POOL_SELECTION, H_FABRIC_CLIENT_POOL_SELECTION);
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_CLIENT_HOLDER_CREATE_INSTANCE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_CLIENT_HOLDER_RELEASE_INSTANCE, void*);
+
+    REGISTER_GLOBAL_MOCK_RETURNS(h_fabric_client_holder_init, 0, MU_FAILURE);
+    REGISTER_GLOBAL_MOCK_HOOK(test_create_instance, hook_test_create_instance);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    (void)memset(test_entries, 0, sizeof(test_entries));
+    umock_c_reset_all_calls();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+}
+
+/* h_fabric_client_pool_init */
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_001: [ If pool is NULL then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_with_NULL_pool_fails)
+{
+    ///arrange
+
+    ///act
+    int result = h_fabric_client_pool_init(NULL, test_entries, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_002: [ If entries is NULL then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_with_NULL_entries_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+
+    ///act
+    int result = h_fabric_client_pool_init(&pool, NULL, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_003: [ If size is 0 then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_with_size_0_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+
+    ///act
+    int result = h_fabric_client_pool_init(&pool, test_entries, 0, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_004: [ If selection is not a valid H_FABRIC_CLIENT_POOL_SELECTION then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_with_invalid_selection_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+
+    ///act
+    int result = h_fabric_client_pool_init(&pool, test_entries, TEST_POOL_SIZE, (H_FABRIC_CLIENT_POOL_SELECTION)(H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT + 1), test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_005: [ If create_instance is NULL then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_with_NULL_create_instance_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+
+    ///act
+    int result = h_fabric_client_pool_init(&pool, test_entries, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, NULL, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_006: [ If release_instance is NULL then h_fabric_client_pool_init shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_with_NULL_release_instance_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+
+    ///act
+    int result = h_fabric_client_pool_init(&pool, test_entries, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, test_create_instance, NULL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_007: [ For each of the size entries, h_fabric_client_pool_init shall create an instance by calling create_instance. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_008: [ h_fabric_client_pool_init shall hand the instance to the holder of the entry by calling h_fabric_client_holder_init. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_011: [ h_fabric_client_pool_init shall store entries, size and selection in pool and succeed and return 0. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_succeeds)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    for (uint32_t i = 0; i < TEST_POOL_SIZE; i++)
+    {
+        STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG));
+        STRICT_EXPECTED_CALL(h_fabric_client_holder_init(&test_entries[i].holder, TEST_INSTANCE, test_create_instance, test_release_instance));
+    }
+
+    ///act
+    int result = h_fabric_client_pool_init(&pool, test_entries, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(void_ptr, test_entries, pool.entries);
+    ASSERT_ARE_EQUAL(uint32_t, TEST_POOL_SIZE, pool.size);
+    ASSERT_ARE_EQUAL(H_FABRIC_CLIENT_POOL_SELECTION, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT, pool.selection);
+    for (uint32_t i = 0; i < TEST_POOL_SIZE; i++)
+    {
+        ASSERT_ARE_EQUAL(int32_t, 0, test_entries[i].in_flight);
+    }
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_010: [ If there are any failures then h_fabric_client_pool_init shall deinitialize the holders initialized so far, fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_when_create_instance_fails_deinits_the_holders_initialized_so_far)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_client_holder_init(&test_entries[0].holder, TEST_INSTANCE, test_create_instance, test_release_instance));
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_client_holder_init(&test_entries[1].holder, TEST_INSTANCE, test_create_instance, test_release_instance));
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(h_fabric_client_holder_deinit(&test_entries[1].holder));
+    STRICT_EXPECTED_CALL(h_fabric_client_holder_deinit(&test_entries[0].holder));
+
+    ///act
+    int result = h_fabric_client_pool_init(&pool, test_entries, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_009: [ If h_fabric_client_holder_init fails then h_fabric_client_pool_init shall release the instance by calling release_instance. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_010: [ If there are any failures then h_fabric_client_pool_init shall deinitialize the holders initialized so far, fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_when_h_fabric_client_holder_init_fails_releases_the_instance)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_client_holder_init(&test_entries[0].holder, TEST_INSTANCE, test_create_instance, test_release_instance));
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_client_holder_init(&test_entries[1].holder, TEST_INSTANCE, test_create_instance, test_release_instance))
+        .SetReturn(MU_FAILURE);
+    STRICT_EXPECTED_CALL(test_release_instance(TEST_INSTANCE));
+    STRICT_EXPECTED_CALL(h_fabric_client_holder_deinit(&test_entries[0].holder));
+
+    ///act
+    int result = h_fabric_client_pool_init(&pool, test_entries, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_010: [ If there are any failures then h_fabric_client_pool_init shall deinitialize the holders initialized so far, fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_client_pool_init_when_the_first_create_instance_fails_fails)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    STRICT_EXPECTED_CALL(test_create_instance(IGNORED_ARG))
+        .SetReturn(E_FAIL);
+
+    ///act
+    int result = h_fabric_client_pool_init(&pool, test_entries, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, test_create_instance, test_release_instance);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_client_pool_deinit */
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_012: [ If pool is NULL then h_fabric_client_pool_deinit shall return. ]*/
+TEST_FUNCTION(h_fabric_client_pool_deinit_with_NULL_pool_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_client_pool_deinit(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_013: [ h_fabric_client_pool_deinit shall call h_fabric_client_holder_deinit for the holder of every entry. ]*/
+TEST_FUNCTION(h_fabric_client_pool_deinit_deinits_all_the_holders)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY);
+    for (uint32_t i = 0; i < TEST_POOL_SIZE; i++)
+    {
+        STRICT_EXPECTED_CALL(h_fabric_client_holder_deinit(&test_entries[i].holder));
+    }
+
+    ///act
+    h_fabric_client_pool_deinit(&pool);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_client_pool_acquire */
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_014: [ If pool is NULL then h_fabric_client_pool_acquire shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_with_NULL_pool_fails)
+{
+    ///arrange
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result = h_fabric_client_pool_acquire(NULL);
+
+    ///assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_015: [ If pool has only 1 entry then h_fabric_client_pool_acquire shall pick it. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_018: [ h_fabric_client_pool_acquire shall increment the number of calls in flight of the entry and return it. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_with_1_entry_returns_it)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, 1, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result1 = h_fabric_client_pool_acquire(&pool);
+    H_FABRIC_CLIENT_POOL_ENTRY* result2 = h_fabric_client_pool_acquire(&pool);
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, &test_entries[0], result1);
+    ASSERT_ARE_EQUAL(void_ptr, &test_entries[0], result2);
+    ASSERT_ARE_EQUAL(int32_t, 2, test_entries[0].in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_016: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY then h_fabric_client_pool_acquire shall pick the entry given by a hash of the id of the calling thread. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_018: [ h_fabric_client_pool_acquire shall increment the number of calls in flight of the entry and return it. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_with_THREAD_AFFINITY_returns_the_same_entry_to_the_same_thread)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY);
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result1 = h_fabric_client_pool_acquire(&pool);
+    H_FABRIC_CLIENT_POOL_ENTRY* result2 = h_fabric_client_pool_acquire(&pool);
+
+    ///assert
+    ASSERT_IS_TRUE((result1 >= &test_entries[0]) && (result1 < &test_entries[TEST_POOL_SIZE]));
+    ASSERT_ARE_EQUAL(void_ptr, result1, result2);
+    ASSERT_ARE_EQUAL(int32_t, 2, result1->in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_017: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT then h_fabric_client_pool_acquire shall pick the entry with the fewest calls in flight, looking at the entries starting with one given by a hash of the id of the calling thread, moved by one at every call of that thread. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_018: [ h_fabric_client_pool_acquire shall increment the number of calls in flight of the entry and return it. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_with_LEAST_IN_FLIGHT_spreads_the_calls_over_all_the_entries)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+
+    ///act
+    for (uint32_t i = 0; i < TEST_POOL_SIZE; i++)
+    {
+        (void)h_fabric_client_pool_acquire(&pool);
+    }
+
+    ///assert
+    for (uint32_t i = 0; i < TEST_POOL_SIZE; i++)
+    {
+        ASSERT_ARE_EQUAL(int32_t, 1, test_entries[i].in_flight);
+    }
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_017: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT then h_fabric_client_pool_acquire shall pick the entry with the fewest calls in flight, looking at the entries starting with one given by a hash of the id of the calling thread, moved by one at every call of that thread. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_with_LEAST_IN_FLIGHT_picks_the_entry_with_the_fewest_calls)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+    (void)interlocked_exchange(&test_entries[0].in_flight, 3);
+    (void)interlocked_exchange(&test_entries[1].in_flight, 5);
+    (void)interlocked_exchange(&test_entries[2].in_flight, 2);
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result = h_fabric_client_pool_acquire(&pool);
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, &test_entries[2], result);
+    ASSERT_ARE_EQUAL(int32_t, 3, test_entries[2].in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_client_pool_acquire_other */
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_022: [ If pool is NULL then h_fabric_client_pool_acquire_other shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_other_with_NULL_pool_fails)
+{
+    ///arrange
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result = h_fabric_client_pool_acquire_other(NULL, &test_entries[0]);
+
+    ///assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_023: [ If other is NULL then h_fabric_client_pool_acquire_other shall pick the entry the same way as h_fabric_client_pool_acquire. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_other_with_NULL_other_picks_like_h_fabric_client_pool_acquire)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+    (void)interlocked_exchange(&test_entries[0].in_flight, 3);
+    (void)interlocked_exchange(&test_entries[1].in_flight, 5);
+    (void)interlocked_exchange(&test_entries[2].in_flight, 2);
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result = h_fabric_client_pool_acquire_other(&pool, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, &test_entries[2], result);
+    ASSERT_ARE_EQUAL(int32_t, 3, test_entries[2].in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_024: [ If pool has only 1 entry then h_fabric_client_pool_acquire_other shall pick it. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_027: [ h_fabric_client_pool_acquire_other shall increment the number of calls in flight of the entry and return it. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_other_with_1_entry_returns_it)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, 1, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+    H_FABRIC_CLIENT_POOL_ENTRY* other = h_fabric_client_pool_acquire(&pool);
+    umock_c_reset_all_calls();
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result = h_fabric_client_pool_acquire_other(&pool, other);
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, &test_entries[0], result);
+    ASSERT_ARE_EQUAL(int32_t, 2, test_entries[0].in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_025: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY then h_fabric_client_pool_acquire_other shall pick the entry after other. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_027: [ h_fabric_client_pool_acquire_other shall increment the number of calls in flight of the entry and return it. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_other_with_THREAD_AFFINITY_returns_the_entry_after_other)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY);
+    H_FABRIC_CLIENT_POOL_ENTRY* other = h_fabric_client_pool_acquire(&pool);
+    umock_c_reset_all_calls();
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result = h_fabric_client_pool_acquire_other(&pool, other);
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, &test_entries[((other - test_entries) + 1) % TEST_POOL_SIZE], result);
+    ASSERT_ARE_EQUAL(int32_t, 1, other->in_flight);
+    ASSERT_ARE_EQUAL(int32_t, 1, result->in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_025: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY then h_fabric_client_pool_acquire_other shall pick the entry after other. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_other_with_THREAD_AFFINITY_and_the_last_entry_returns_the_first_entry)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY);
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result = h_fabric_client_pool_acquire_other(&pool, &test_entries[TEST_POOL_SIZE - 1]);
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, &test_entries[0], result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_026: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT then h_fabric_client_pool_acquire_other shall pick the entry with the fewest calls in flight except other, looking at the entries starting with one given by a hash of the id of the calling thread, moved by one at every call of that thread. ]*/
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_027: [ h_fabric_client_pool_acquire_other shall increment the number of calls in flight of the entry and return it. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_other_with_LEAST_IN_FLIGHT_skips_other_when_it_has_the_fewest_calls)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+    (void)interlocked_exchange(&test_entries[0].in_flight, 3);
+    (void)interlocked_exchange(&test_entries[1].in_flight, 2);
+    (void)interlocked_exchange(&test_entries[2].in_flight, 5);
+
+    ///act
+    H_FABRIC_CLIENT_POOL_ENTRY* result = h_fabric_client_pool_acquire_other(&pool, &test_entries[1]);
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, &test_entries[0], result);
+    ASSERT_ARE_EQUAL(int32_t, 4, test_entries[0].in_flight);
+    ASSERT_ARE_EQUAL(int32_t, 2, test_entries[1].in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_026: [ If selection is H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT then h_fabric_client_pool_acquire_other shall pick the entry with the fewest calls in flight except other, looking at the entries starting with one given by a hash of the id of the calling thread, moved by one at every call of that thread. ]*/
+TEST_FUNCTION(h_fabric_client_pool_acquire_other_with_LEAST_IN_FLIGHT_never_returns_other)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+
+    ///act
+    for (uint32_t i = 0; i < 2 * TEST_POOL_SIZE; i++)
+    {
+        (void)h_fabric_client_pool_acquire_other(&pool, &test_entries[0]);
+    }
+
+    ///assert
+    ASSERT_ARE_EQUAL(int32_t, 0, test_entries[0].in_flight);
+    ASSERT_ARE_EQUAL(int32_t, TEST_POOL_SIZE, test_entries[1].in_flight);
+    ASSERT_ARE_EQUAL(int32_t, TEST_POOL_SIZE, test_entries[2].in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_client_pool_release */
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_019: [ If pool is NULL then h_fabric_client_pool_release shall return. ]*/
+TEST_FUNCTION(h_fabric_client_pool_release_with_NULL_pool_returns)
+{
+    ///arrange
+    (void)interlocked_exchange(&test_entries[0].in_flight, 1);
+
+    ///act
+    h_fabric_client_pool_release(NULL, &test_entries[0]);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int32_t, 1, test_entries[0].in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_020: [ If entry is NULL then h_fabric_client_pool_release shall return. ]*/
+TEST_FUNCTION(h_fabric_client_pool_release_with_NULL_entry_returns)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+
+    ///act
+    h_fabric_client_pool_release(&pool, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_CLIENT_POOL_01_021: [ h_fabric_client_pool_release shall decrement the number of calls in flight of entry. ]*/
+TEST_FUNCTION(h_fabric_client_pool_release_decrements_the_calls_in_flight)
+{
+    ///arrange
+    H_FABRIC_CLIENT_POOL pool;
+    pool_init(&pool, TEST_POOL_SIZE, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT);
+    H_FABRIC_CLIENT_POOL_ENTRY* entry = h_fabric_client_pool_acquire(&pool);
+    umock_c_reset_all_calls();
+
+    ///act
+    h_fabric_client_pool_release(&pool, entry);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int32_t, 0, entry->in_flight);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,1265 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <wchar.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_bool.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_wcharptr.h"
+#include "umock_c/umocktypes_windows.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/srw_lock.h"
+#include "c_pal/sync.h"
+
+#define GBALLOC_HL_REDIRECT_H
+#include "h_fabric_service_notification_handler.h"
+#include "com_wrapper/com_wrapper.h"
+#include "h_fabric_service_notification_handler_com.h"
+#include "../../src/h_fabric_service_notification_handler_com.c"
+#undef GBALLOC_HL_REDIRECT_H
+
+#include "c_pal/gballoc_hl_redirect.h"
+
+/*the sync wrappers and FabricCreateLocalClient3 are not mockable by their headers*/
+MOCKABLE_FUNCTION(, HRESULT, FSMC6_RegisterServiceNotificationFilter, IFabricServiceManagementClient6*, client, const FABRIC_SERVICE_NOTIFICATION_FILTER_DESCRIPTION*, description, DWORD, timeoutMilliseconds, LONGLONG*, filterId);
+MOCKABLE_FUNCTION(, HRESULT, FSMC6_UnregisterServiceNotificationFilter, IFabricServiceManagementClient6*, client, LONGLONG, filterId, DWORD, timeoutMilliseconds);
+MOCKABLE_FUNCTION(, HRESULT, FabricCreateLocalClient3, IFabricServiceNotificationEventHandler*, notificationHandler, IFabricClientConnectionEventHandler*, connectionHandler, REFIID, iid, void**, fabricClient);
+
+MOCKABLE_FUNCTION(, HRESULT, test_create_client, IFabricServiceNotificationEventHandler*, notification_handler, IFabricServiceManagementClient6**, client);
+MOCKABLE_FUNCTION(, ULONG, test_client_Release, IFabricServiceManagementClient6*, This);
+
+MOCKABLE_FUNCTION(, const FABRIC_SERVICE_NOTIFICATION*, test_notification_get_Notification, IFabricServiceNotification*, This);
+MOCKABLE_FUNCTION(, HRESULT, test_notification_GetVersion, IFabricServiceNotification*, This, IFabricServiceEndpointsVersion**, result);
+
+MOCKABLE_FUNCTION(, HRESULT, test_version_Compare, IFabricServiceEndpointsVersion*, This, IFabricServiceEndpointsVersion*, other, LONG*, compareResult);
+MOCKABLE_FUNCTION(, ULONG, test_version_AddRef, IFabricServiceEndpointsVersion*, This);
+MOCKABLE_FUNCTION(, ULONG, test_version_Release, IFabricServiceEndpointsVersion*, This);
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "h_fabric_endpoint_table.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT_VALUES);
+
+#define TEST_SERVICE_NAME L"fabric:/app/svc"
+#define TEST_OTHER_SERVICE_NAME L"fabric:/app/other"
+#define TEST_TIMEOUT 1000
+
+static SRW_LOCK_HANDLE test_lock = (SRW_LOCK_HANDLE)0x4243;
+static H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE test_handler = (H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE)0x4244;
+
+/*fake client, only Release is ever called by the table, everything else goes through the FSMC6_ mocks*/
+static IFabricServiceManagementClient6Vtbl test_client_vtbl =
+{
+    .Release = test_client_Release
+};
+static IFabricServiceManagementClient6 test_client = { &test_client_vtbl };
+static IFabricServiceManagementClient6* test_client_ptr = &test_client;
+
+static IFabricServiceNotificationVtbl test_notification_vtbl =
+{
+    .get_Notification = test_notification_get_Notification,
+    .GetVersion = test_notification_GetVersion
+};
+static IFabricServiceNotification test_notification = { &test_notification_vtbl };
+
+static IFabricServiceEndpointsVersionVtbl test_version_vtbl =
+{
+    .AddRef = test_version_AddRef,
+    .Release = test_version_Release,
+    .Compare = test_version_Compare
+};
+static IFabricServiceEndpointsVersion test_version_1 = { &test_version_vtbl };
+static IFabricServiceEndpointsVersion test_version_2 = { &test_version_vtbl };
+
+static const FABRIC_PARTITION_ID test_partition_id_1 = { 0x11111111, 0x1111, 0x1111, { 1, 1, 1, 1, 1, 1, 1, 1 } };
+static const FABRIC_PARTITION_ID test_partition_id_2 = { 0x22222222, 0x2222, 0x2222, { 2, 2, 2, 2, 2, 2, 2, 2 } };
+
+/*what the fake notification carries, set by each test*/
+static FABRIC_SERVICE_NOTIFICATION test_notification_data;
+static FABRIC_SERVICE_PARTITION_INFORMATION test_partition_info;
+static FABRIC_SINGLETON_PARTITION_INFORMATION test_singleton_info;
+static FABRIC_INT64_RANGE_PARTITION_INFORMATION test_int64_range_info;
+static FABRIC_NAMED_PARTITION_INFORMATION test_named_info;
+static FABRIC_RESOLVED_SERVICE_ENDPOINT test_endpoints[2];
+static IFabricServiceEndpointsVersion* test_notification_version;
+static LONG test_compare_result;
+
+static ON_SERVICE_NOTIFICATION captured_on_service_notification;
+static void* captured_on_service_notification_context;
+
+static const FABRIC_SERVICE_NOTIFICATION* hook_test_notification_get_Notification(IFabricServiceNotification* This)
+{
+    (void)This;
+    return &test_notification_data;
+}
+
+static HRESULT hook_test_notification_GetVersion(IFabricServiceNotification* This, IFabricServiceEndpointsVersion** result)
+{
+    (void)This;
+    *result = test_notification_version;
+    return S_OK;
+}
+
+static HRESULT hook_test_version_Compare(IFabricServiceEndpointsVersion* This, IFabricServiceEndpointsVersion* other, LONG* compareResult)
+{
+    (void)This;
+    (void)other;
+    *compareResult = test_compare_result;
+    return S_OK;
+}
+
+static void set_notification(FABRIC_URI name, const FABRIC_PARTITION_ID* partition_id, FABRIC_SERVICE_PARTITION_KIND kind, ULONG endpoint_count, IFabricServiceEndpointsVersion* version)
+{
+    test_notification_data.ServiceName = name;
+    test_notification_data.PartitionId = *partition_id;
+    test_notification_data.EndpointCount = endpoint_count;
+    test_notification_data.Endpoints = (endpoint_count == 0) ? NULL : test_endpoints;
+    test_notification_data.PartitionInfo = &test_partition_info;
+    test_notification_data.Reserved = NULL;
+
+    test_partition_info.Kind = kind;
+    switch (kind)
+    {
+        case FABRIC_SERVICE_PARTITION_KIND_SINGLETON:
+            test_singleton_info.Id = *partition_id;
+            test_partition_info.Value = &test_singleton_info;
+            break;
+        case FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE:
+            test_int64_range_info.Id = *partition_id;
+            test_int64_range_info.LowKey = 0;
+            test_int64_range_info.HighKey = 99;
+            test_partition_info.Value = &test_int64_range_info;
+            break;
+        case FABRIC_SERVICE_PARTITION_KIND_NAMED:
+            test_named_info.Id = *partition_id;
+            test_named_info.Name = L"east";
+            test_partition_info.Value = &test_named_info;
+            break;
+        default:
+            test_partition_info.Value = NULL;
+            break;
+    }
+
+    test_endpoints[0].Address = L"tcp://10.0.0.1:1000";
+    test_endpoints[0].Role = FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY;
+    test_endpoints[1].Address = L"tcp://10.0.0.2:1000";
+    test_endpoints[1].Role = FABRIC_SERVICE_ROLE_STATEFUL_SECONDARY;
+
+    test_notification_version = version;
+}
+
+static void setup_create_expectations(void)
+{
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_endpoint_table"));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 0, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_service_notification_handler_create(IGNORED_ARG, IGNORED_ARG))
+        .CaptureArgumentValue_on_service_notification(&captured_on_service_notification)
+        .CaptureArgumentValue_on_service_notification_context(&captured_on_service_notification_context);
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE_IFabricServiceNotificationEventHandler(test_handler, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_create_client(IGNORED_ARG, IGNORED_ARG))
+        .CopyOutArgumentBuffer_client(&test_client_ptr, sizeof(test_client_ptr));
+}
+
+static H_FABRIC_ENDPOINT_TABLE_HANDLE test_create_table(void)
+{
+    setup_create_expectations();
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = h_fabric_endpoint_table_create(test_create_client);
+    ASSERT_IS_NOT_NULL(table);
+    umock_c_reset_all_calls();
+    return table;
+}
+
+static void setup_wait_for_pins_expectations(void)
+{
+    for (uint32_t i = 0; i < H_FABRIC_ENDPOINT_TABLE_PIN_SLOT_COUNT; i++)
+    {
+        STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX))
+            .CallCannotFail();
+    }
+}
+
+static void test_notify(void)
+{
+    captured_on_service_notification(captured_on_service_notification_context, &test_notification);
+}
+
+static void test_notify_and_reset(void)
+{
+    test_notify();
+    umock_c_reset_all_calls();
+}
+
+static uint64_t test_get_version(H_FABRIC_ENDPOINT_TABLE_HANDLE table)
+{
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+    uint64_t result = h_fabric_endpoint_table_snapshot_get_version(snapshot);
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    return result;
+}
+
+static H_FABRIC_ENDPOINT_TABLE_HANDLE table_read_while_publishing;
+static uint64_t version_read_while_publishing;
+
+/*a reader arrives while the notification waits for the pins to drain*/
+static INTERLOCKED_HL_RESULT hook_InterlockedHL_WaitForValue_reader_arrives(int32_t volatile_atomic* address_to_check, int32_t value_to_wait, uint32_t milliseconds)
+{
+    (void)address_to_check;
+    (void)value_to_wait;
+    (void)milliseconds;
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table_read_while_publishing);
+    version_read_while_publishing = h_fabric_endpoint_table_snapshot_get_version(snapshot);
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    return INTERLOCKED_HL_OK;
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types(), "umocktypes_bool_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types(), "umocktypes_charptr_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types(), "umocktypes_stdint_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_wcharptr_register_types(), "umocktypes_wcharptr_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types(), "umocktypes_windows_register_types");
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(malloc_flex, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(srw_lock_create, test_lock, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(h_fabric_service_notification_handler_create, test_handler, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(test_create_client, S_OK, E_FAIL);
+    REGISTER_GLOBAL_MOCK_RETURNS(FabricCreateLocalClient3, S_OK, FABRIC_E_CONNECTION_DENIED);
+    REGISTER_GLOBAL_MOCK_RETURNS(FSMC6_RegisterServiceNotificationFilter, S_OK, FABRIC_E_TIMEOUT);
+    REGISTER_GLOBAL_MOCK_RETURNS(FSMC6_UnregisterServiceNotificationFilter, S_OK, FABRIC_E_TIMEOUT);
+    REGISTER_GLOBAL_MOCK_RETURNS(InterlockedHL_WaitForValue, INTERLOCKED_HL_OK, INTERLOCKED_HL_ERROR);
+    REGISTER_GLOBAL_MOCK_RETURN(test_client_Release, 0);
+    REGISTER_GLOBAL_MOCK_HOOK(test_notification_get_Notification, hook_test_notification_get_Notification);
+    REGISTER_GLOBAL_MOCK_HOOK(test_notification_GetVersion, hook_test_notification_GetVersion);
+    REGISTER_GLOBAL_MOCK_HOOK(test_version_Compare, hook_test_version_Compare);
+    REGISTER_GLOBAL_MOCK_RETURN(test_version_AddRef, 2);
+    REGISTER_GLOBAL_MOCK_RETURN(test_version_Release, 1);
+
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(LONGLONG, long long);
+    REGISTER_UMOCK_ALIAS_TYPE(LONG, long);
+    REGISTER_UMOCK_ALIAS_TYPE(REFIID, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(SRW_LOCK_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(ON_SERVICE_NOTIFICATION, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE_DESTROY_FUNC, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricServiceNotificationEventHandler*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricClientConnectionEventHandler*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricServiceManagementClient6*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricServiceManagementClient6**, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricServiceNotification*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricServiceEndpointsVersion*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricServiceEndpointsVersion**, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(const FABRIC_SERVICE_NOTIFICATION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(const FABRIC_SERVICE_NOTIFICATION_FILTER_DESCRIPTION*, void*);
+
+    REGISTER_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForValue, NULL);
+
+    captured_on_service_notification = NULL;
+    captured_on_service_notification_context = NULL;
+    test_compare_result = 1;
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 2, NULL);
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/*h_fabric_endpoint_table_create_local_client*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_001: [ If notification_handler is NULL then h_fabric_endpoint_table_create_local_client shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_create_local_client_with_notification_handler_NULL_fails)
+{
+    ///arrange
+    IFabricServiceManagementClient6* client;
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_create_local_client(NULL, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, E_INVALIDARG, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_002: [ If client is NULL then h_fabric_endpoint_table_create_local_client shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_create_local_client_with_client_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_create_local_client((IFabricServiceNotificationEventHandler*)0x4245, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, E_INVALIDARG, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_003: [ h_fabric_endpoint_table_create_local_client shall create the client by calling FabricCreateLocalClient3 with notification_handler and return its result. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_create_local_client_calls_FabricCreateLocalClient3)
+{
+    ///arrange
+    IFabricServiceManagementClient6* client;
+
+    STRICT_EXPECTED_CALL(FabricCreateLocalClient3((IFabricServiceNotificationEventHandler*)0x4245, NULL, &IID_IFabricServiceManagementClient6, (void**)&client));
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_create_local_client((IFabricServiceNotificationEventHandler*)0x4245, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, S_OK, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_003: [ h_fabric_endpoint_table_create_local_client shall create the client by calling FabricCreateLocalClient3 with notification_handler and return its result. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_create_local_client_returns_the_error_of_FabricCreateLocalClient3)
+{
+    ///arrange
+    IFabricServiceManagementClient6* client;
+
+    STRICT_EXPECTED_CALL(FabricCreateLocalClient3((IFabricServiceNotificationEventHandler*)0x4245, NULL, &IID_IFabricServiceManagementClient6, (void**)&client))
+        .SetReturn(FABRIC_E_CONNECTION_DENIED);
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_create_local_client((IFabricServiceNotificationEventHandler*)0x4245, &client);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, FABRIC_E_CONNECTION_DENIED, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*h_fabric_endpoint_table_create*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_004: [ If create_client is NULL then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_create_with_create_client_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = h_fabric_endpoint_table_create(NULL);
+
+    ///assert
+    ASSERT_IS_NULL(table);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_005: [ h_fabric_endpoint_table_create shall allocate memory for the table. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_006: [ h_fabric_endpoint_table_create shall create the writer lock by calling srw_lock_create. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_007: [ h_fabric_endpoint_table_create shall create an empty snapshot with version 0 and make it the current snapshot. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_008: [ h_fabric_endpoint_table_create shall create a notification handler by calling h_fabric_service_notification_handler_create and COM_WRAPPER_CREATE. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_009: [ h_fabric_endpoint_table_create shall create the client by calling create_client with the notification handler. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_010: [ h_fabric_endpoint_table_create shall succeed and return a non-NULL handle. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_create_succeeds)
+{
+    ///arrange
+    setup_create_expectations();
+
+    ///act
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = h_fabric_endpoint_table_create(test_create_client);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(table);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(captured_on_service_notification);
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_get_version(table));
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_011: [ If there are any failures then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+TEST_FUNCTION(when_underlying_calls_fail_h_fabric_endpoint_table_create_also_fails)
+{
+    ///arrange
+    setup_create_expectations();
+
+    umock_c_negative_tests_snapshot();
+
+    for (size_t i = 0; i < umock_c_negative_tests_call_count(); i++)
+    {
+        if (umock_c_negative_tests_can_call_fail(i))
+        {
+            umock_c_negative_tests_reset();
+            umock_c_negative_tests_fail_call(i);
+
+            ///act
+            H_FABRIC_ENDPOINT_TABLE_HANDLE table = h_fabric_endpoint_table_create(test_create_client);
+
+            ///assert
+            ASSERT_IS_NULL(table, "On failed call %zu", i);
+        }
+    }
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_011: [ If there are any failures then h_fabric_endpoint_table_create shall fail and return NULL. ]*/
+TEST_FUNCTION(when_create_client_fails_h_fabric_endpoint_table_create_releases_the_notification_handler)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_endpoint_table"));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 0, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_service_notification_handler_create(IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE_IFabricServiceNotificationEventHandler(test_handler, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_create_client(IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE_IFabricServiceNotificationEventHandler_Release(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_service_notification_handler_destroy(test_handler));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // snapshot
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // table
+
+    ///act
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = h_fabric_endpoint_table_create(test_create_client);
+
+    ///assert
+    ASSERT_IS_NULL(table);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*h_fabric_endpoint_table_destroy*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_012: [ If table is NULL then h_fabric_endpoint_table_destroy shall return. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_destroy_with_table_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_endpoint_table_destroy(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_013: [ h_fabric_endpoint_table_destroy shall close the notification handler by calling h_fabric_service_notification_handler_close, so that the notifications that arrive from now on are ignored and the notifications in progress are finished. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_014: [ h_fabric_endpoint_table_destroy shall release the client (which drops all the filters registered with it) and the notification handler. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_015: [ h_fabric_endpoint_table_destroy shall give up the reference of the table on the current snapshot, destroy the writer lock and free the memory used by the table. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_destroy_releases_everything)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+
+    STRICT_EXPECTED_CALL(h_fabric_service_notification_handler_close(test_handler));
+    STRICT_EXPECTED_CALL(test_client_Release(&test_client));
+    STRICT_EXPECTED_CALL(H_FABRIC_SERVICE_NOTIFICATION_HANDLER_HANDLE_IFabricServiceNotificationEventHandler_Release(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_service_notification_handler_destroy(test_handler));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // snapshot
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(free(table));
+
+    ///act
+    h_fabric_endpoint_table_destroy(table);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_015: [ h_fabric_endpoint_table_destroy shall give up the reference of the table on the current snapshot, destroy the writer lock and free the memory used by the table. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_destroy_keeps_an_acquired_snapshot_alive)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    test_notify_and_reset();
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+
+    ///act
+    h_fabric_endpoint_table_destroy(table);
+
+    ///assert
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+    ASSERT_IS_NOT_NULL(partition);
+    ASSERT_ARE_EQUAL(uint32_t, 2, partition->EndpointCount);
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+}
+
+/*h_fabric_endpoint_table_add_filter*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_016: [ If table is NULL then h_fabric_endpoint_table_add_filter shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_add_filter_with_table_NULL_fails)
+{
+    ///arrange
+    LONGLONG filterId;
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_add_filter(NULL, TEST_SERVICE_NAME, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE, TEST_TIMEOUT, &filterId);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, E_INVALIDARG, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_017: [ If name is NULL then h_fabric_endpoint_table_add_filter shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_add_filter_with_name_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    LONGLONG filterId;
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_add_filter(table, NULL, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE, TEST_TIMEOUT, &filterId);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, E_INVALIDARG, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_018: [ If filterId is NULL then h_fabric_endpoint_table_add_filter shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_add_filter_with_filterId_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_add_filter(table, TEST_SERVICE_NAME, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE, TEST_TIMEOUT, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, E_INVALIDARG, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_019: [ h_fabric_endpoint_table_add_filter shall register the filter by calling FSMC6_RegisterServiceNotificationFilter on the client of the table and return its result. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_add_filter_registers_the_filter)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    LONGLONG filterId;
+
+    STRICT_EXPECTED_CALL(FSMC6_RegisterServiceNotificationFilter(&test_client, IGNORED_ARG, TEST_TIMEOUT, &filterId));
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_add_filter(table, TEST_SERVICE_NAME, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NAME_PREFIX, TEST_TIMEOUT, &filterId);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, S_OK, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_019: [ h_fabric_endpoint_table_add_filter shall register the filter by calling FSMC6_RegisterServiceNotificationFilter on the client of the table and return its result. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_add_filter_returns_the_error_of_FSMC6_RegisterServiceNotificationFilter)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    LONGLONG filterId;
+
+    STRICT_EXPECTED_CALL(FSMC6_RegisterServiceNotificationFilter(&test_client, IGNORED_ARG, TEST_TIMEOUT, &filterId))
+        .SetReturn(FABRIC_E_TIMEOUT);
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_add_filter(table, TEST_SERVICE_NAME, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE, TEST_TIMEOUT, &filterId);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, FABRIC_E_TIMEOUT, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*h_fabric_endpoint_table_remove_filter*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_020: [ If table is NULL then h_fabric_endpoint_table_remove_filter shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_remove_filter_with_table_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_remove_filter(NULL, 42, TEST_TIMEOUT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, E_INVALIDARG, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_021: [ h_fabric_endpoint_table_remove_filter shall unregister the filter by calling FSMC6_UnregisterServiceNotificationFilter on the client of the table and return its result. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_remove_filter_unregisters_the_filter)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+
+    STRICT_EXPECTED_CALL(FSMC6_UnregisterServiceNotificationFilter(&test_client, 42, TEST_TIMEOUT));
+
+    ///act
+    HRESULT result = h_fabric_endpoint_table_remove_filter(table, 42, TEST_TIMEOUT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(long, S_OK, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*on_service_notification*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_023: [ The notification shall get the notification data by calling IFabricServiceNotification::get_Notification. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_025: [ The notification shall get the version of the endpoints by calling IFabricServiceNotification::GetVersion. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_027: [ The notification shall be applied under the exclusive writer lock of the table. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_030: [ Otherwise the notification shall copy the partition and its endpoints and publish a new snapshot where the copy replaces the partition or is inserted in service name and partition id order. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_031: [ After publishing the new snapshot, the notification shall switch the pin generation of the table, wait for the pins of the previous generation in every pin slot to reach 0 by calling InterlockedHL_WaitForValue and give up the reference of the table on the previous snapshot. ]*/
+TEST_FUNCTION(on_service_notification_publishes_a_snapshot_with_the_partition)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 2, &test_version_1);
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification));
+    STRICT_EXPECTED_CALL(test_notification_GetVersion(&test_notification, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(test_version_AddRef(&test_version_1));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    setup_wait_for_pins_expectations();
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // previous snapshot
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_version_Release(&test_version_1));
+
+    ///act
+    test_notify();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+    ASSERT_ARE_EQUAL(uint64_t, 1, h_fabric_endpoint_table_snapshot_get_version(snapshot));
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+    ASSERT_IS_NOT_NULL(partition);
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_SERVICE_NAME, partition->ServiceName);
+    ASSERT_ARE_EQUAL(int, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, partition->Info.Kind);
+    ASSERT_ARE_EQUAL(uint32_t, 2, partition->EndpointCount);
+    ASSERT_ARE_EQUAL(wchar_ptr, L"tcp://10.0.0.1:1000", partition->Endpoints[0].Address);
+    ASSERT_ARE_EQUAL(int, FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY, partition->Endpoints[0].Role);
+    ASSERT_ARE_EQUAL(wchar_ptr, L"tcp://10.0.0.2:1000", partition->Endpoints[1].Address);
+    ASSERT_ARE_EQUAL(int, FABRIC_SERVICE_ROLE_STATEFUL_SECONDARY, partition->Endpoints[1].Role);
+    ASSERT_ARE_NOT_EQUAL(void_ptr, test_endpoints[0].Address, partition->Endpoints[0].Address);
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_030: [ Otherwise the notification shall copy the partition and its endpoints and publish a new snapshot where the copy replaces the partition or is inserted in service name and partition id order. ]*/
+TEST_FUNCTION(on_service_notification_keeps_partitions_of_several_services)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE, 1, NULL);
+    test_notify();
+    set_notification(TEST_OTHER_SERVICE_NAME, &test_partition_id_2, FABRIC_SERVICE_PARTITION_KIND_NAMED, 2, NULL);
+    umock_c_reset_all_calls();
+
+    ///act
+    test_notify();
+
+    ///assert
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+    ASSERT_ARE_EQUAL(uint64_t, 2, h_fabric_endpoint_table_snapshot_get_version(snapshot));
+    LONGLONG key = 42;
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key);
+    ASSERT_IS_NOT_NULL(partition);
+    ASSERT_ARE_EQUAL(uint32_t, 1, partition->EndpointCount);
+    partition = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_OTHER_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_STRING, L"east");
+    ASSERT_IS_NOT_NULL(partition);
+    ASSERT_ARE_EQUAL(uint32_t, 2, partition->EndpointCount);
+    ASSERT_ARE_EQUAL(wchar_ptr, L"east", ((const FABRIC_NAMED_PARTITION_INFORMATION*)partition->Info.Value)->Name);
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_030: [ Otherwise the notification shall copy the partition and its endpoints and publish a new snapshot where the copy replaces the partition or is inserted in service name and partition id order. ]*/
+TEST_FUNCTION(on_service_notification_with_a_newer_version_replaces_the_partition)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 2, &test_version_1);
+    test_notify();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 1, &test_version_2);
+    test_compare_result = 1;
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification));
+    STRICT_EXPECTED_CALL(test_notification_GetVersion(&test_notification, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_version_Compare(&test_version_2, &test_version_1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(test_version_AddRef(&test_version_2));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    setup_wait_for_pins_expectations();
+    STRICT_EXPECTED_CALL(test_version_Release(&test_version_1)); // replaced partition
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // replaced partition
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // previous snapshot
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_version_Release(&test_version_2));
+
+    ///act
+    test_notify();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+    ASSERT_ARE_EQUAL(uint64_t, 2, h_fabric_endpoint_table_snapshot_get_version(snapshot));
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+    ASSERT_IS_NOT_NULL(partition);
+    ASSERT_ARE_EQUAL(uint32_t, 1, partition->EndpointCount);
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_028: [ If the partition is in the table and the version of the notification is older than the version of the partition then the notification shall be ignored. ]*/
+TEST_FUNCTION(on_service_notification_with_an_older_version_is_ignored)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 2, &test_version_1);
+    test_notify();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 1, &test_version_2);
+    test_compare_result = -1;
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification));
+    STRICT_EXPECTED_CALL(test_notification_GetVersion(&test_notification, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_version_Compare(&test_version_2, &test_version_1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_version_Release(&test_version_2));
+
+    ///act
+    test_notify();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+    ASSERT_ARE_EQUAL(uint64_t, 1, h_fabric_endpoint_table_snapshot_get_version(snapshot));
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+    ASSERT_IS_NOT_NULL(partition);
+    ASSERT_ARE_EQUAL(uint32_t, 2, partition->EndpointCount);
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_029: [ If the notification has no endpoints then the notification shall publish a new snapshot without the partition (if it is in the table). ]*/
+TEST_FUNCTION(on_service_notification_without_endpoints_removes_the_partition)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    test_notify();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 0, NULL);
+    umock_c_reset_all_calls();
+
+    ///act
+    test_notify();
+
+    ///assert
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+    ASSERT_ARE_EQUAL(uint64_t, 2, h_fabric_endpoint_table_snapshot_get_version(snapshot));
+    ASSERT_IS_NULL(h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL));
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_029: [ If the notification has no endpoints then the notification shall publish a new snapshot without the partition (if it is in the table). ]*/
+TEST_FUNCTION(on_service_notification_without_endpoints_for_an_unknown_partition_does_not_publish)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 0, NULL);
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification));
+    STRICT_EXPECTED_CALL(test_notification_GetVersion(&test_notification, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    ///act
+    test_notify();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_get_version(table));
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_024: [ If the notification data is NULL or incomplete then the notification shall be ignored. ]*/
+TEST_FUNCTION(on_service_notification_with_NULL_data_is_ignored)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification))
+        .SetReturn(NULL);
+
+    ///act
+    test_notify();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_get_version(table));
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_026: [ If getting the version fails then the notification shall still be applied. ]*/
+TEST_FUNCTION(on_service_notification_when_GetVersion_fails_still_applies_the_notification)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification));
+    STRICT_EXPECTED_CALL(test_notification_GetVersion(&test_notification, IGNORED_ARG))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    setup_wait_for_pins_expectations();
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // previous snapshot
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    ///act
+    test_notify();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_get_version(table));
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_033: [ If there are any failures then the notification shall keep the current snapshot. ]*/
+TEST_FUNCTION(when_underlying_calls_fail_on_service_notification_keeps_the_current_snapshot)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification));
+    STRICT_EXPECTED_CALL(test_notification_GetVersion(&test_notification, IGNORED_ARG))
+        .CallCannotFail();
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    setup_wait_for_pins_expectations();
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // previous snapshot
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    umock_c_negative_tests_snapshot();
+
+    for (size_t i = 0; i < umock_c_negative_tests_call_count(); i++)
+    {
+        if (umock_c_negative_tests_can_call_fail(i))
+        {
+            umock_c_negative_tests_reset();
+            umock_c_negative_tests_fail_call(i);
+
+            ///act
+            test_notify();
+
+            ///assert
+            ASSERT_ARE_EQUAL(uint64_t, 0, test_get_version(table), "On failed call %zu", i);
+        }
+    }
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_032: [ If waiting for the pins of any pin slot fails then the notification shall not wait for the other pin slots and shall not give up the reference of the table on the previous snapshot. ]*/
+TEST_FUNCTION(when_waiting_for_the_pins_fails_on_service_notification_does_not_free_the_previous_snapshot)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification));
+    STRICT_EXPECTED_CALL(test_notification_GetVersion(&test_notification, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX))
+        .SetReturn(INTERLOCKED_HL_ERROR);
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    ///act
+    test_notify();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_get_version(table));
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_032: [ If waiting for the pins of any pin slot fails then the notification shall not wait for the other pin slots and shall not give up the reference of the table on the previous snapshot. ]*/
+TEST_FUNCTION(when_waiting_for_the_pins_of_the_second_slot_fails_on_service_notification_does_not_wait_for_the_other_slots)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification));
+    STRICT_EXPECTED_CALL(test_notification_GetVersion(&test_notification, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX))
+        .SetReturn(INTERLOCKED_HL_ERROR);
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    ///act
+    test_notify();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_get_version(table));
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*h_fabric_endpoint_table_acquire_snapshot*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_034: [ If table is NULL then h_fabric_endpoint_table_acquire_snapshot shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_acquire_snapshot_with_table_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(NULL);
+
+    ///assert
+    ASSERT_IS_NULL(snapshot);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_035: [ h_fabric_endpoint_table_acquire_snapshot shall increment the number of pins of the current pin generation in the pin slot of the calling thread. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_036: [ h_fabric_endpoint_table_acquire_snapshot shall read the current snapshot and increment its reference count. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_037: [ h_fabric_endpoint_table_acquire_snapshot shall decrement the number of pins and, if it reaches 0 after the pin generation was switched, wake the publishing thread. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_038: [ h_fabric_endpoint_table_acquire_snapshot shall return the snapshot. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_acquire_snapshot_does_not_lock)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+
+    ///act
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(snapshot);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_036: [ h_fabric_endpoint_table_acquire_snapshot shall read the current snapshot and increment its reference count. ]*/
+TEST_FUNCTION(a_snapshot_acquired_before_a_notification_does_not_change)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE before = h_fabric_endpoint_table_acquire_snapshot(table);
+
+    ///act
+    test_notify();
+
+    ///assert
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE after = h_fabric_endpoint_table_acquire_snapshot(table);
+    ASSERT_ARE_EQUAL(uint64_t, 0, h_fabric_endpoint_table_snapshot_get_version(before));
+    ASSERT_IS_NULL(h_fabric_endpoint_table_snapshot_find(before, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL));
+    ASSERT_ARE_EQUAL(uint64_t, 1, h_fabric_endpoint_table_snapshot_get_version(after));
+    ASSERT_IS_NOT_NULL(h_fabric_endpoint_table_snapshot_find(after, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL));
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(before);
+    h_fabric_endpoint_table_release_snapshot(after);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_031: [ After publishing the new snapshot, the notification shall switch the pin generation of the table, wait for the pins of the previous generation in every pin slot to reach 0 by calling InterlockedHL_WaitForValue and give up the reference of the table on the previous snapshot. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_035: [ h_fabric_endpoint_table_acquire_snapshot shall increment the number of pins of the current pin generation in the pin slot of the calling thread. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_037: [ h_fabric_endpoint_table_acquire_snapshot shall decrement the number of pins and, if it reaches 0 after the pin generation was switched, wake the publishing thread. ]*/
+TEST_FUNCTION(a_reader_arriving_while_a_notification_waits_for_the_pins_is_not_waited_for)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    table_read_while_publishing = table;
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForValue, hook_InterlockedHL_WaitForValue_reader_arrives);
+
+    STRICT_EXPECTED_CALL(test_notification_get_Notification(&test_notification));
+    STRICT_EXPECTED_CALL(test_notification_GetVersion(&test_notification, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    setup_wait_for_pins_expectations();
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // previous snapshot
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    ///act
+    test_notify();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    /*the reader got the new snapshot and was pinned in the new generation, so it did not wake the notification waiting for the previous one*/
+    ASSERT_ARE_EQUAL(uint64_t, 1, version_read_while_publishing);
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_035: [ h_fabric_endpoint_table_acquire_snapshot shall increment the number of pins of the current pin generation in the pin slot of the calling thread. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_acquire_snapshot_after_several_notifications_gets_the_last_snapshot)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    test_notify();
+    set_notification(TEST_OTHER_SERVICE_NAME, &test_partition_id_2, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 1, NULL);
+    test_notify();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 0, NULL);
+    test_notify_and_reset();
+
+    ///act
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint64_t, 3, h_fabric_endpoint_table_snapshot_get_version(snapshot));
+    ASSERT_IS_NULL(h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL));
+    ASSERT_IS_NOT_NULL(h_fabric_endpoint_table_snapshot_find(snapshot, TEST_OTHER_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL));
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*h_fabric_endpoint_table_release_snapshot*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_039: [ If snapshot is NULL then h_fabric_endpoint_table_release_snapshot shall return. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_release_snapshot_with_snapshot_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_endpoint_table_release_snapshot(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_040: [ h_fabric_endpoint_table_release_snapshot shall decrement the reference count of snapshot and, when it reaches 0, release the partitions of the snapshot and free it. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_release_snapshot_frees_a_snapshot_that_is_not_current_anymore)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 2, &test_version_1);
+    test_notify();
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 0, NULL);
+    test_notify_and_reset();
+
+    STRICT_EXPECTED_CALL(test_version_Release(&test_version_1));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // partition
+    STRICT_EXPECTED_CALL(free(snapshot));
+
+    ///act
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*h_fabric_endpoint_table_snapshot_get_version*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_041: [ If snapshot is NULL then h_fabric_endpoint_table_snapshot_get_version shall return 0. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_snapshot_get_version_with_snapshot_NULL_returns_0)
+{
+    ///arrange
+
+    ///act
+    uint64_t version = h_fabric_endpoint_table_snapshot_get_version(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(uint64_t, 0, version);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_042: [ h_fabric_endpoint_table_snapshot_get_version shall return the version of snapshot. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_snapshot_get_version_counts_the_published_snapshots)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    test_notify();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_2, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 1, NULL);
+    test_notify();
+    set_notification(TEST_OTHER_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_SINGLETON, 1, NULL);
+    test_notify_and_reset();
+
+    ///act
+    uint64_t version = test_get_version(table);
+
+    ///assert
+    ASSERT_ARE_EQUAL(uint64_t, 3, version);
+
+    ///clean
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*h_fabric_endpoint_table_snapshot_find*/
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_043: [ If snapshot is NULL then h_fabric_endpoint_table_snapshot_find shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_snapshot_find_with_snapshot_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition = h_fabric_endpoint_table_snapshot_find(NULL, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+
+    ///assert
+    ASSERT_IS_NULL(partition);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_044: [ If name is NULL then h_fabric_endpoint_table_snapshot_find shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_snapshot_find_with_name_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    test_notify();
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+
+    ///act
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition = h_fabric_endpoint_table_snapshot_find(snapshot, NULL, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+
+    ///assert
+    ASSERT_IS_NULL(partition);
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_045: [ If partitionKeyType is not FABRIC_PARTITION_KEY_TYPE_NONE, FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, or partitionKey is NULL for FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, then h_fabric_endpoint_table_snapshot_find shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_snapshot_find_with_invalid_partition_key_fails)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE, 1, NULL);
+    test_notify();
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+
+    ///act
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition_1 = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, NULL);
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition_2 = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_STRING, NULL);
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition_3 = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INVALID, NULL);
+
+    ///assert
+    ASSERT_IS_NULL(partition_1);
+    ASSERT_IS_NULL(partition_2);
+    ASSERT_IS_NULL(partition_3);
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_046: [ h_fabric_endpoint_table_snapshot_find shall binary search the first partition of the service name in snapshot. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_047: [ h_fabric_endpoint_table_snapshot_find shall return the partition of the service that is a singleton partition for FABRIC_PARTITION_KEY_TYPE_NONE, the int64 range partition whose range contains *partitionKey for FABRIC_PARTITION_KEY_TYPE_INT64 or the named partition whose name is partitionKey for FABRIC_PARTITION_KEY_TYPE_STRING. ]*/
+/*Tests_SRS_H_FABRIC_ENDPOINT_TABLE_01_048: [ If there is no such partition then h_fabric_endpoint_table_snapshot_find shall return NULL. ]*/
+TEST_FUNCTION(h_fabric_endpoint_table_snapshot_find_honors_the_int64_range)
+{
+    ///arrange
+    H_FABRIC_ENDPOINT_TABLE_HANDLE table = test_create_table();
+    set_notification(TEST_SERVICE_NAME, &test_partition_id_1, FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE, 1, NULL);
+    test_notify();
+    H_FABRIC_ENDPOINT_TABLE_SNAPSHOT_HANDLE snapshot = h_fabric_endpoint_table_acquire_snapshot(table);
+    LONGLONG low = 0;
+    LONGLONG high = 99;
+    LONGLONG outside = 100;
+
+    ///act
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition_low = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &low);
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition_high = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &high);
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition_outside = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &outside);
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition_singleton = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+    const FABRIC_RESOLVED_SERVICE_PARTITION* partition_other = h_fabric_endpoint_table_snapshot_find(snapshot, TEST_OTHER_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &low);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(partition_low);
+    ASSERT_ARE_EQUAL(void_ptr, partition_low, partition_high);
+    ASSERT_IS_NULL(partition_outside);
+    ASSERT_IS_NULL(partition_singleton);
+    ASSERT_IS_NULL(partition_other);
+
+    ///clean
+    h_fabric_endpoint_table_release_snapshot(snapshot);
+    h_fabric_endpoint_table_destroy(table);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,378 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "windows.h"
+
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+#include "testrunnerswitcher.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/execution_engine.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadapi.h"
+#include "c_pal/threadpool.h"
+#include "c_pal/timer.h"
+
+#include "sf_c_util/timer_wheel.h"
+
+#include "h_fabric_retry_policy.h"
+#include "hfabricqueryclient10.h"
+#include "hfabricservicemanagementclient6.h"
+#include "h_fabric_query_cache.h"
+#include "h_fabric_resolution_cache.h"
+
+#include "fake_fabric_runtime.h"
+
+TEST_DEFINE_ENUM_TYPE(THREADAPI_RESULT, THREADAPI_RESULT_VALUES);
+TEST_DEFINE_ENUM_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT_VALUES);
+
+/*this loads the retry logic, the _async APIs and the caches of sfwrapper against fake_fabric_runtime: a Service Fabric that answers in 1..5 ms,
+completes 1 call out of 4 synchronously and fails about 3% of the calls with errors that H_FABRIC retries. Every call is expected to succeed in the end*/
+
+#define THREAD_COUNT 8
+#define CALLS_PER_THREAD 500
+#define CACHED_CALLS_PER_THREAD 20000
+#define ASYNC_CALLS 4000
+#define SERVICE_COUNT 16
+#define MAX_TRIES 10
+#define CALL_TIMEOUT_MS 10000
+
+static const wchar_t* service_names[SERVICE_COUNT] =
+{
+    L"fabric:/perf/service0", L"fabric:/perf/service1", L"fabric:/perf/service2", L"fabric:/perf/service3",
+    L"fabric:/perf/service4", L"fabric:/perf/service5", L"fabric:/perf/service6", L"fabric:/perf/service7",
+    L"fabric:/perf/service8", L"fabric:/perf/service9", L"fabric:/perf/service10", L"fabric:/perf/service11",
+    L"fabric:/perf/service12", L"fabric:/perf/service13", L"fabric:/perf/service14", L"fabric:/perf/service15"
+};
+
+static const FABRIC_NODE_QUERY_DESCRIPTION node_query_description = { 0 };
+
+static FAKE_FABRIC_RUNTIME_HANDLE create_and_install_runtime(void)
+{
+    FAKE_FABRIC_RUNTIME_CONFIG config;
+    fake_fabric_runtime_config_init(&config);
+    config.behavior.latency.distribution = FAKE_FABRIC_LATENCY_DISTRIBUTION_UNIFORM;
+    config.behavior.latency.min_ms = 1;
+    config.behavior.latency.max_ms = 5;
+    config.behavior.completed_synchronously_per_million = FAKE_FABRIC_PER_MILLION / 4;
+    config.behavior.failure_count = 2;
+    config.behavior.failures[0].error = FABRIC_E_GATEWAY_NOT_REACHABLE;
+    config.behavior.failures[0].per_million = 10000;
+    config.behavior.failures[0].point = FAKE_FABRIC_FAILURE_POINT_BEGIN;
+    config.behavior.failures[1].error = FABRIC_E_OBJECT_CLOSED;
+    config.behavior.failures[1].per_million = 20000;
+    config.behavior.failures[1].point = FAKE_FABRIC_FAILURE_POINT_END;
+    config.callback_thread_count = 4;
+    config.seed = 42;
+
+    FAKE_FABRIC_RUNTIME_HANDLE runtime = fake_fabric_runtime_create(&config);
+    ASSERT_IS_NOT_NULL(runtime);
+    fake_fabric_runtime_install(runtime);
+    return runtime;
+}
+
+static void uninstall_and_destroy_runtime(FAKE_FABRIC_RUNTIME_HANDLE runtime, FAKE_FABRIC_OPERATION operation, uint32_t calls, double elapsed)
+{
+    FAKE_FABRIC_RUNTIME_STATS stats;
+    fake_fabric_runtime_get_operation_stats(runtime, operation, &stats);
+    LogInfo("%" PRIu32 " calls of %" PRI_MU_ENUM " in %.0f ms (%.0f calls/s): begun=%" PRId64 ", failed_at_begin=%" PRId64 ", failed_at_end=%" PRId64 ", completed_synchronously=%" PRId64 ", completed_asynchronously=%" PRId64 ", timed_out=%" PRId64,
+        calls, MU_ENUM_VALUE(FAKE_FABRIC_OPERATION, operation), elapsed, (double)calls * 1000.0 / (elapsed > 0 ? elapsed : 1),
+        stats.begun, stats.failed_at_begin, stats.failed_at_end, stats.completed_synchronously, stats.completed_asynchronously, stats.timed_out);
+    ASSERT_ARE_EQUAL(int64_t, 0, stats.in_flight);
+
+    fake_fabric_runtime_uninstall(runtime);
+    fake_fabric_runtime_destroy(runtime);
+}
+
+typedef struct PERF_THREAD_CONTEXT_TAG
+{
+    H_FABRIC_HANDLE(IFabricQueryClient10) query_client;
+    H_FABRIC_QUERY_CACHE_HANDLE query_cache;
+    H_FABRIC_RESOLUTION_CACHE_HANDLE resolution_cache;
+    uint32_t index;
+    volatile_atomic int32_t* start;
+    uint32_t failures;
+} PERF_THREAD_CONTEXT;
+
+static void wait_for_start(PERF_THREAD_CONTEXT* thread_context)
+{
+    while (interlocked_add(thread_context->start, 0) == 0)
+    {
+        /*all the threads start together*/
+    }
+}
+
+static int get_node_list_thread(void* context)
+{
+    PERF_THREAD_CONTEXT* thread_context = context;
+    wait_for_start(thread_context);
+
+    for (uint32_t i = 0; i < CALLS_PER_THREAD; i++)
+    {
+        IFabricGetNodeListResult* result;
+        if (FAILED(H_FABRIC_API(FQC10_GetNodeList)(thread_context->query_client, &node_query_description, CALL_TIMEOUT_MS, &result)))
+        {
+            thread_context->failures++;
+        }
+        else
+        {
+            (void)result->lpVtbl->Release(result);
+        }
+    }
+    return 0;
+}
+
+static int cached_get_node_list_thread(void* context)
+{
+    PERF_THREAD_CONTEXT* thread_context = context;
+    wait_for_start(thread_context);
+
+    for (uint32_t i = 0; i < CACHED_CALLS_PER_THREAD; i++)
+    {
+        IFabricGetNodeListResult* result;
+        if (FAILED(h_fabric_query_cache_GetNodeList(thread_context->query_cache, &node_query_description, CALL_TIMEOUT_MS, &result)))
+        {
+            thread_context->failures++;
+        }
+        else
+        {
+            (void)result->lpVtbl->Release(result);
+        }
+    }
+    return 0;
+}
+
+static int cached_resolve_thread(void* context)
+{
+    PERF_THREAD_CONTEXT* thread_context = context;
+    wait_for_start(thread_context);
+
+    for (uint32_t i = 0; i < CACHED_CALLS_PER_THREAD; i++)
+    {
+        IFabricResolvedServicePartitionResult* result;
+        if (FAILED(h_fabric_resolution_cache_resolve(thread_context->resolution_cache, service_names[(thread_context->index + i) % SERVICE_COUNT], FABRIC_PARTITION_KEY_TYPE_NONE, NULL, CALL_TIMEOUT_MS, &result)))
+        {
+            thread_context->failures++;
+        }
+        else
+        {
+            (void)result->lpVtbl->Release(result);
+        }
+    }
+    return 0;
+}
+
+/*runs THREAD_COUNT threads of thread_function and returns the time it took*/
+static double run_threads(THREAD_START_FUNC thread_function, PERF_THREAD_CONTEXT* template_context)
+{
+    volatile_atomic int32_t start;
+    (void)interlocked_exchange(&start, 0);
+
+    THREAD_HANDLE threads[THREAD_COUNT];
+    PERF_THREAD_CONTEXT contexts[THREAD_COUNT];
+    for (uint32_t i = 0; i < THREAD_COUNT; i++)
+    {
+        contexts[i] = *template_context;
+        contexts[i].index = i;
+        contexts[i].start = &start;
+        contexts[i].failures = 0;
+        ASSERT_ARE_EQUAL(THREADAPI_RESULT, THREADAPI_OK, ThreadAPI_Create(&threads[i], thread_function, &contexts[i]));
+    }
+
+    double start_time = timer_global_get_elapsed_ms();
+    (void)interlocked_exchange(&start, 1);
+
+    for (uint32_t i = 0; i < THREAD_COUNT; i++)
+    {
+        int thread_return;
+        ASSERT_ARE_EQUAL(THREADAPI_RESULT, THREADAPI_OK, ThreadAPI_Join(threads[i], &thread_return));
+        ASSERT_ARE_EQUAL(uint32_t, 0, contexts[i].failures);
+    }
+    return timer_global_get_elapsed_ms() - start_time;
+}
+
+static H_FABRIC_HANDLE(IFabricQueryClient10) create_query_client(TIMER_WHEEL_HANDLE timer_wheel)
+{
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, MAX_TRIES, 1));
+    H_FABRIC_HANDLE(IFabricQueryClient10) handle = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFabricQueryClient10)(&retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+    if (timer_wheel != NULL)
+    {
+        ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricQueryClient10)(handle, timer_wheel));
+    }
+    return handle;
+}
+
+typedef struct ASYNC_CALL_TAG
+{
+    IFabricGetNodeListResult* result;
+    HRESULT hr;
+    volatile_atomic int32_t* completed;
+} ASYNC_CALL;
+
+static void on_get_node_list_complete(void* context, HRESULT result)
+{
+    ASYNC_CALL* call = context;
+    call->hr = result;
+    if (interlocked_increment(call->completed) == ASYNC_CALLS)
+    {
+        wake_by_address_single(call->completed);
+    }
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, gballoc_hl_init(NULL, NULL));
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+}
+
+TEST_FUNCTION(h_fabric_api_retries_the_failures_of_the_fake_runtime)
+{
+    ///arrange
+    FAKE_FABRIC_RUNTIME_HANDLE runtime = create_and_install_runtime();
+    PERF_THREAD_CONTEXT context = { 0 };
+    context.query_client = create_query_client(NULL);
+
+    ///act
+    double elapsed = run_threads(get_node_list_thread, &context);
+
+    ///assert
+    FAKE_FABRIC_RUNTIME_STATS stats;
+    fake_fabric_runtime_get_operation_stats(runtime, FAKE_FABRIC_OPERATION_GET_NODE_LIST, &stats);
+    ASSERT_IS_TRUE(stats.failed_at_begin + stats.failed_at_end > 0);
+    ASSERT_ARE_EQUAL(int64_t, (int64_t)THREAD_COUNT * CALLS_PER_THREAD + stats.failed_at_begin + stats.failed_at_end, stats.begun);
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricQueryClient10)(context.query_client);
+    uninstall_and_destroy_runtime(runtime, FAKE_FABRIC_OPERATION_GET_NODE_LIST, THREAD_COUNT * CALLS_PER_THREAD, elapsed);
+}
+
+TEST_FUNCTION(h_fabric_api_async_completes_all_the_calls_started_together)
+{
+    ///arrange
+    FAKE_FABRIC_RUNTIME_HANDLE runtime = create_and_install_runtime();
+    TIMER_WHEEL_HANDLE timer_wheel = timer_wheel_create(1);
+    ASSERT_IS_NOT_NULL(timer_wheel);
+    H_FABRIC_HANDLE(IFabricQueryClient10) query_client = create_query_client(timer_wheel);
+    ASYNC_CALL* calls = malloc(sizeof(ASYNC_CALL) * ASYNC_CALLS);
+    ASSERT_IS_NOT_NULL(calls);
+    volatile_atomic int32_t completed;
+    (void)interlocked_exchange(&completed, 0);
+
+    ///act
+    double start_time = timer_global_get_elapsed_ms();
+    for (uint32_t i = 0; i < ASYNC_CALLS; i++)
+    {
+        calls[i].result = NULL;
+        calls[i].hr = E_FAIL;
+        calls[i].completed = &completed;
+        ASSERT_ARE_EQUAL(HRESULT, S_OK, H_FABRIC_API_ASYNC(FQC10_GetNodeList)(query_client, &node_query_description, CALL_TIMEOUT_MS, &calls[i].result, on_get_node_list_complete, &calls[i]));
+    }
+    ASSERT_ARE_EQUAL(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_OK, InterlockedHL_WaitForValue(&completed, ASYNC_CALLS, CALL_TIMEOUT_MS));
+    double elapsed = timer_global_get_elapsed_ms() - start_time;
+
+    ///assert
+    for (uint32_t i = 0; i < ASYNC_CALLS; i++)
+    {
+        ASSERT_ARE_EQUAL(HRESULT, S_OK, calls[i].hr);
+        ASSERT_IS_NOT_NULL(calls[i].result);
+        (void)calls[i].result->lpVtbl->Release(calls[i].result);
+    }
+
+    ///clean
+    free(calls);
+    H_FABRIC_HANDLE_DESTROY(IFabricQueryClient10)(query_client);
+    timer_wheel_destroy(timer_wheel);
+    uninstall_and_destroy_runtime(runtime, FAKE_FABRIC_OPERATION_GET_NODE_LIST, ASYNC_CALLS, elapsed);
+}
+
+TEST_FUNCTION(h_fabric_query_cache_serves_most_calls_without_the_fake_runtime)
+{
+    ///arrange
+    FAKE_FABRIC_RUNTIME_HANDLE runtime = create_and_install_runtime();
+    PERF_THREAD_CONTEXT context = { 0 };
+    context.query_client = create_query_client(NULL);
+    EXECUTION_ENGINE_HANDLE execution_engine = execution_engine_create(NULL);
+    ASSERT_IS_NOT_NULL(execution_engine);
+    THANDLE(THREADPOOL) threadpool = threadpool_create(execution_engine);
+    ASSERT_IS_NOT_NULL(threadpool);
+    context.query_cache = h_fabric_query_cache_create(context.query_client, threadpool, 4, 16);
+    ASSERT_IS_NOT_NULL(context.query_cache);
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_query_cache_configure(context.query_cache, H_FABRIC_QUERY_CACHE_API_GET_NODE_LIST, 100, 1000));
+
+    ///act
+    double elapsed = run_threads(cached_get_node_list_thread, &context);
+
+    ///assert
+    FAKE_FABRIC_RUNTIME_STATS stats;
+    fake_fabric_runtime_get_operation_stats(runtime, FAKE_FABRIC_OPERATION_GET_NODE_LIST, &stats);
+    ASSERT_IS_TRUE(stats.begun < (int64_t)THREAD_COUNT * CACHED_CALLS_PER_THREAD / 10);
+
+    ///clean
+    h_fabric_query_cache_destroy(context.query_cache);
+    THANDLE_ASSIGN(THREADPOOL)(&threadpool, NULL);
+    execution_engine_dec_ref(execution_engine);
+    H_FABRIC_HANDLE_DESTROY(IFabricQueryClient10)(context.query_client);
+    uninstall_and_destroy_runtime(runtime, FAKE_FABRIC_OPERATION_GET_NODE_LIST, THREAD_COUNT * CACHED_CALLS_PER_THREAD, elapsed);
+}
+
+TEST_FUNCTION(h_fabric_resolution_cache_resolves_each_service_about_once)
+{
+    ///arrange
+    FAKE_FABRIC_RUNTIME_HANDLE runtime = create_and_install_runtime();
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, MAX_TRIES, 1));
+    H_FABRIC_HANDLE(IFabricServiceManagementClient6) service_management_client = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFabricServiceManagementClient6)(&retryPolicy);
+    ASSERT_IS_NOT_NULL(service_management_client);
+    EXECUTION_ENGINE_HANDLE execution_engine = execution_engine_create(NULL);
+    ASSERT_IS_NOT_NULL(execution_engine);
+    THANDLE(THREADPOOL) threadpool = threadpool_create(execution_engine);
+    ASSERT_IS_NOT_NULL(threadpool);
+    PERF_THREAD_CONTEXT context = { 0 };
+    context.resolution_cache = h_fabric_resolution_cache_create(service_management_client, threadpool, 4, 16, 60000);
+    ASSERT_IS_NOT_NULL(context.resolution_cache);
+
+    ///act
+    double elapsed = run_threads(cached_resolve_thread, &context);
+
+    ///assert
+    FAKE_FABRIC_RUNTIME_STATS stats;
+    fake_fabric_runtime_get_operation_stats(runtime, FAKE_FABRIC_OPERATION_RESOLVE_SERVICE_PARTITION, &stats);
+    ASSERT_IS_TRUE(stats.begun < (int64_t)THREAD_COUNT * CACHED_CALLS_PER_THREAD / 10);
+
+    ///clean
+    h_fabric_resolution_cache_destroy(context.resolution_cache);
+    THANDLE_ASSIGN(THREADPOOL)(&threadpool, NULL);
+    execution_engine_dec_ref(execution_engine);
+    H_FABRIC_HANDLE_DESTROY(IFabricServiceManagementClient6)(service_management_client);
+    uninstall_and_destroy_runtime(runtime, FAKE_FABRIC_OPERATION_RESOLVE_SERVICE_PARTITION, THREAD_COUNT * CACHED_CALLS_PER_THREAD, elapsed);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
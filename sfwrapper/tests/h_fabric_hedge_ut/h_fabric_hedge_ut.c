@@ -0,0 +1,1288 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabriccommon.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_bool.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_windows.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+#include "c_pal/timer.h"
+
+#include "sf_c_util/timer_wheel.h"
+
+#include "servicefabricdox_cancellation.h"
+
+MOCKABLE_FUNCTION(, HRESULT, test_attempt, void*, args, void* volatile_atomic*, shared, void**, result);
+MOCKABLE_FUNCTION(, void, test_on_done, void*, context);
+MOCKABLE_FUNCTION(, ULONG, test_result_AddRef, IUnknown*, This);
+MOCKABLE_FUNCTION(, ULONG, test_result_Release, IUnknown*, This);
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "h_fabric_hedge.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT_VALUES);
+
+#define TEST_LATENCY_MS 10 /*the latency of all the calls recorded by test_record_latencies*/
+#define TEST_DELAY_MS 12 /*upper bound of the bucket of TEST_LATENCY_MS*/
+#define TEST_MINIMUM_SAMPLES 100
+#define TEST_START_TIME 1000
+
+#define TEST_TIMER_WHEEL ((TIMER_WHEEL_HANDLE)0x4243)
+#define TEST_THREADPOOL ((THANDLE(THREADPOOL))0x4241)
+#define TEST_ON_DONE_CONTEXT ((void*)0x4244)
+
+/*the arguments of a call, every attempt receives a copy*/
+typedef struct TEST_ARGS_TAG
+{
+    uint32_t value;
+    const char* name;
+} TEST_ARGS;
+
+static TEST_ARGS test_args = { 42, "test" };
+
+/*fake results, only AddRef and Release are ever called*/
+static IUnknownVtbl test_result_vtbl =
+{
+    .AddRef = test_result_AddRef,
+    .Release = test_result_Release
+};
+static IUnknown test_result_1 = { &test_result_vtbl };
+static IUnknown test_result_2 = { &test_result_vtbl };
+static IUnknown* test_result_1_ptr = &test_result_1;
+static IUnknown* test_result_2_ptr = &test_result_2;
+
+static H_FABRIC_HEDGE_CONFIG test_config;
+static H_FABRIC_HEDGE_LATENCY test_latency;
+
+/*the work item of the second attempt runs when it is scheduled (if test_work_runs_when_scheduled), when the hedge waits for it or when the test runs it after h_fabric_hedge_execute returned*/
+static THREADPOOL_WORK_FUNCTION captured_work_function;
+static void* captured_work_context;
+static bool captured_work_has_run;
+static uint32_t captured_work_count;
+static bool test_work_runs_when_scheduled;
+
+/*when the timer that starts the second attempt fires*/
+typedef enum TEST_TIMER_FIRES_TAG
+{
+    TEST_TIMER_NEVER_FIRES, /*timer_wheel_cancel removes it*/
+    TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS, /*the first attempt is slow*/
+    TEST_TIMER_FIRES_WHEN_CANCELLED, /*the timer fires while timer_wheel_cancel is called*/
+    TEST_TIMER_FIRES_WHEN_WAITED_FOR /*timer_wheel_cancel is too late, the timer fires while the hedge waits for it*/
+} TEST_TIMER_FIRES;
+
+static TEST_TIMER_FIRES test_timer_fires;
+static bool test_timer_has_fired;
+static bool test_timer_is_cancelled; /*the timer wheel is destroyed before the timer expires*/
+static TIMER_WHEEL_CALLBACK captured_timer_callback;
+static void* captured_timer_callback_context;
+
+/*what every InterlockedHL_WaitForNotValue does: run the work item (or not) and return*/
+#define TEST_MAX_WAITS 4
+static bool test_wait_runs_work[TEST_MAX_WAITS];
+static INTERLOCKED_HL_RESULT test_wait_returns[TEST_MAX_WAITS];
+static uint32_t test_wait_count;
+
+/*what every InterlockedHL_WaitForValue returns, the timer fires when it returns INTERLOCKED_HL_OK*/
+#define TEST_MAX_TIMER_WAITS 2
+static INTERLOCKED_HL_RESULT test_timer_wait_returns[TEST_MAX_TIMER_WAITS];
+static uint32_t test_timer_wait_count;
+
+static void test_run_captured_work(void)
+{
+    if (!captured_work_has_run)
+    {
+        captured_work_has_run = true;
+        captured_work_function(captured_work_context);
+    }
+}
+
+static void test_fire_timer(void)
+{
+    if (!test_timer_has_fired)
+    {
+        test_timer_has_fired = true;
+        captured_timer_callback(captured_timer_callback_context, test_timer_is_cancelled);
+    }
+}
+
+static int hook_threadpool_schedule_work(THANDLE(THREADPOOL) threadpool, THREADPOOL_WORK_FUNCTION work_function, void* work_function_context)
+{
+    (void)threadpool;
+    ASSERT_ARE_EQUAL(uint32_t, 0, captured_work_count);
+    captured_work_function = work_function;
+    captured_work_context = work_function_context;
+    captured_work_has_run = false;
+    captured_work_count++;
+    if (test_work_runs_when_scheduled)
+    {
+        test_run_captured_work();
+    }
+    return 0;
+}
+
+static INTERLOCKED_HL_RESULT hook_InterlockedHL_WaitForNotValue(int32_t volatile_atomic* address_to_check, int32_t value_to_wait, uint32_t timeout_ms)
+{
+    (void)address_to_check;
+    (void)value_to_wait;
+    (void)timeout_ms;
+    ASSERT_IS_TRUE(test_wait_count < TEST_MAX_WAITS);
+    INTERLOCKED_HL_RESULT result = test_wait_returns[test_wait_count];
+    if (test_wait_runs_work[test_wait_count])
+    {
+        test_run_captured_work();
+    }
+    test_wait_count++;
+    return result;
+}
+
+static INTERLOCKED_HL_RESULT hook_InterlockedHL_WaitForValue(int32_t volatile_atomic* address_to_check, int32_t value_to_wait, uint32_t timeout_ms)
+{
+    (void)address_to_check;
+    (void)value_to_wait;
+    (void)timeout_ms;
+    ASSERT_IS_TRUE(test_timer_wait_count < TEST_MAX_TIMER_WAITS);
+    INTERLOCKED_HL_RESULT result = test_timer_wait_returns[test_timer_wait_count];
+    if (result == INTERLOCKED_HL_OK)
+    {
+        test_fire_timer();
+    }
+    test_timer_wait_count++;
+    return result;
+}
+
+static int hook_timer_wheel_schedule(TIMER_WHEEL_HANDLE timer_wheel, TIMER_WHEEL_TIMER* timer, uint32_t delay_ms, TIMER_WHEEL_CALLBACK callback, void* callback_context)
+{
+    (void)timer_wheel;
+    (void)timer;
+    (void)delay_ms;
+    captured_timer_callback = callback;
+    captured_timer_callback_context = callback_context;
+    return 0;
+}
+
+static bool hook_timer_wheel_cancel(TIMER_WHEEL_HANDLE timer_wheel, TIMER_WHEEL_TIMER* timer)
+{
+    (void)timer_wheel;
+    (void)timer;
+    if (test_timer_fires == TEST_TIMER_FIRES_WHEN_CANCELLED)
+    {
+        test_fire_timer();
+    }
+    /*false when the callback ran or is about to run*/
+    return (test_timer_fires == TEST_TIMER_NEVER_FIRES);
+}
+
+static void hook_servicefabric_dox_cancellation_set_current(SERVICEFABRIC_DOX_CANCELLATION* cancellation)
+{
+    if (
+        (cancellation != NULL) &&
+        (test_timer_fires == TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS)
+        )
+    {
+        test_fire_timer();
+    }
+}
+
+static void test_set_wait(uint32_t index, bool runs_work, INTERLOCKED_HL_RESULT returns)
+{
+    test_wait_runs_work[index] = runs_work;
+    test_wait_returns[index] = returns;
+}
+
+/*enough latencies of TEST_LATENCY_MS that the calls are hedged after TEST_DELAY_MS*/
+static void test_record_latencies(void)
+{
+    for (uint32_t i = 0; i < TEST_MINIMUM_SAMPLES; i++)
+    {
+        h_fabric_hedge_latency_record(&test_latency, TEST_LATENCY_MS);
+    }
+}
+
+/*the calls of h_fabric_hedge_execute up to the start of the first attempt, included*/
+static void setup_start_expectations(void)
+{
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(uint64_t)));
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(IGNORED_ARG, TEST_THREADPOOL));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_wheel_timer_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, TEST_DELAY_MS, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(IGNORED_ARG));
+}
+
+/*the calls of the callback of the timer when it starts the second attempt*/
+static void setup_timer_starts_second_attempt_expectations(void)
+{
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME);
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+}
+
+/*the calls of an attempt that returns hr and result, is_late is true when the other attempt already won*/
+static void setup_run_attempt_expectations(HRESULT hr, IUnknown** result, bool is_late)
+{
+    if (result == NULL)
+    {
+        STRICT_EXPECTED_CALL(test_attempt(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
+            .ValidateArgumentBuffer(1, &test_args, sizeof(test_args))
+            .SetReturn(hr);
+    }
+    else
+    {
+        STRICT_EXPECTED_CALL(test_attempt(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
+            .ValidateArgumentBuffer(1, &test_args, sizeof(test_args))
+            .CopyOutArgumentBuffer_result(result, sizeof(*result))
+            .SetReturn(hr);
+    }
+    if (SUCCEEDED(hr))
+    {
+        STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+            .SetReturn(TEST_START_TIME + TEST_LATENCY_MS);
+        if (is_late)
+        {
+            STRICT_EXPECTED_CALL(test_result_Release(*result));
+        }
+        else
+        {
+            STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_cancel(IGNORED_ARG)); /*the winner cancels the other attempt*/
+        }
+    }
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+}
+
+/*the calls made when the last reference on the call is given back*/
+static void setup_call_freed_expectations(void)
+{
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_on_done(TEST_ON_DONE_CONTEXT));
+}
+
+/*the calls made by the work item of the second attempt, is_last is true when the calling thread already gave back its reference on the call*/
+static void setup_attempt_work_expectations(HRESULT hr, IUnknown** result, bool is_late, bool is_last)
+{
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(IGNORED_ARG));
+    setup_run_attempt_expectations(hr, result, is_late);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    if (is_last)
+    {
+        setup_call_freed_expectations();
+    }
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types(), "umocktypes_bool_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types(), "umocktypes_stdint_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types(), "umocktypes_windows_register_types");
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(malloc_flex, NULL);
+    REGISTER_GLOBAL_MOCK_HOOK(threadpool_schedule_work, hook_threadpool_schedule_work);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(threadpool_schedule_work, MU_FAILURE);
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForNotValue, hook_InterlockedHL_WaitForNotValue);
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForValue, hook_InterlockedHL_WaitForValue);
+    REGISTER_GLOBAL_MOCK_HOOK(timer_wheel_schedule, hook_timer_wheel_schedule);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(timer_wheel_schedule, MU_FAILURE);
+    REGISTER_GLOBAL_MOCK_HOOK(timer_wheel_cancel, hook_timer_wheel_cancel);
+    REGISTER_GLOBAL_MOCK_HOOK(servicefabric_dox_cancellation_set_current, hook_servicefabric_dox_cancellation_set_current);
+    REGISTER_GLOBAL_MOCK_RETURNS(test_attempt, S_OK, FABRIC_E_TIMEOUT);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_AddRef, 2);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_Release, 1);
+
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(THANDLE(THREADPOOL), void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THREADPOOL_WORK_FUNCTION, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(SERVICEFABRIC_DOX_CANCELLATION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TIMER_WHEEL_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TIMER_WHEEL_TIMER*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TIMER_WHEEL_CALLBACK, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricAsyncOperationContext*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IUnknown*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(void**, void*);
+
+    REGISTER_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+
+    test_config.percentile = 50;
+    test_config.minimum_samples = TEST_MINIMUM_SAMPLES;
+    test_config.minimum_delay_ms = 1;
+    (void)memset((void*)&test_latency, 0, sizeof(test_latency));
+
+    captured_work_count = 0;
+    test_work_runs_when_scheduled = false;
+    test_timer_fires = TEST_TIMER_NEVER_FIRES;
+    test_timer_has_fired = false;
+    test_timer_is_cancelled = false;
+    test_wait_count = 0;
+    for (uint32_t i = 0; i < TEST_MAX_WAITS; i++)
+    {
+        test_set_wait(i, false, INTERLOCKED_HL_OK);
+    }
+    test_timer_wait_count = 0;
+    for (uint32_t i = 0; i < TEST_MAX_TIMER_WAITS; i++)
+    {
+        test_timer_wait_returns[i] = INTERLOCKED_HL_OK;
+    }
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/* h_fabric_hedge_latency_record */
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_001: [ If latency is NULL then h_fabric_hedge_latency_record shall return. ]*/
+TEST_FUNCTION(h_fabric_hedge_latency_record_with_latency_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_hedge_latency_record(NULL, TEST_LATENCY_MS);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_002: [ h_fabric_hedge_latency_record shall increment the count of the bucket of latency_ms. Latencies below 4 ms have a bucket each, above that every power of 2 is split in 4 buckets. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_003: [ h_fabric_hedge_latency_record shall increment the number of samples of latency. ]*/
+TEST_FUNCTION(h_fabric_hedge_latency_record_counts_the_latency_in_its_bucket)
+{
+    ///arrange
+
+    ///act
+    h_fabric_hedge_latency_record(&test_latency, 0);
+    h_fabric_hedge_latency_record(&test_latency, 3);
+    h_fabric_hedge_latency_record(&test_latency, 4);
+    h_fabric_hedge_latency_record(&test_latency, 9);
+    h_fabric_hedge_latency_record(&test_latency, TEST_LATENCY_MS);
+    h_fabric_hedge_latency_record(&test_latency, 11);
+    h_fabric_hedge_latency_record(&test_latency, UINT32_MAX);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int32_t, 7, test_latency.samples);
+    ASSERT_ARE_EQUAL(int32_t, 1, test_latency.buckets[0]);
+    ASSERT_ARE_EQUAL(int32_t, 1, test_latency.buckets[3]);
+    ASSERT_ARE_EQUAL(int32_t, 1, test_latency.buckets[4]); /*[4, 5)*/
+    ASSERT_ARE_EQUAL(int32_t, 1, test_latency.buckets[8]); /*[8, 10)*/
+    ASSERT_ARE_EQUAL(int32_t, 2, test_latency.buckets[9]); /*[10, 12)*/
+    ASSERT_ARE_EQUAL(int32_t, 1, test_latency.buckets[123]); /*[0xE0000000, UINT32_MAX], the last bucket a uint32_t reaches*/
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_004: [ If the number of samples reached H_FABRIC_HEDGE_LATENCY_DECAY_SAMPLES and no other thread decays latency then h_fabric_hedge_latency_record shall halve the count of every bucket and subtract the counts removed from the number of samples. ]*/
+TEST_FUNCTION(h_fabric_hedge_latency_record_halves_the_counts_after_H_FABRIC_HEDGE_LATENCY_DECAY_SAMPLES)
+{
+    ///arrange
+    for (uint32_t i = 0; i < H_FABRIC_HEDGE_LATENCY_DECAY_SAMPLES - 2; i++)
+    {
+        h_fabric_hedge_latency_record(&test_latency, 1);
+    }
+    h_fabric_hedge_latency_record(&test_latency, TEST_LATENCY_MS);
+    ASSERT_ARE_EQUAL(int32_t, H_FABRIC_HEDGE_LATENCY_DECAY_SAMPLES - 1, test_latency.samples);
+
+    ///act
+    h_fabric_hedge_latency_record(&test_latency, TEST_LATENCY_MS);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int32_t, (H_FABRIC_HEDGE_LATENCY_DECAY_SAMPLES - 2) / 2, test_latency.buckets[1]);
+    ASSERT_ARE_EQUAL(int32_t, 1, test_latency.buckets[9]);
+    ASSERT_ARE_EQUAL(int32_t, (H_FABRIC_HEDGE_LATENCY_DECAY_SAMPLES - 2) / 2 + 1, test_latency.samples);
+    ASSERT_ARE_EQUAL(int32_t, 0, test_latency.is_decaying);
+}
+
+/* h_fabric_hedge_get_delay */
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_005: [ If config is NULL then h_fabric_hedge_get_delay shall fail and return false. ]*/
+TEST_FUNCTION(h_fabric_hedge_get_delay_with_config_NULL_fails)
+{
+    ///arrange
+    uint32_t delay_ms;
+    test_record_latencies();
+
+    ///act
+    bool result = h_fabric_hedge_get_delay(NULL, &test_latency, &delay_ms);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_006: [ If latency is NULL then h_fabric_hedge_get_delay shall fail and return false. ]*/
+TEST_FUNCTION(h_fabric_hedge_get_delay_with_latency_NULL_fails)
+{
+    ///arrange
+    uint32_t delay_ms;
+
+    ///act
+    bool result = h_fabric_hedge_get_delay(&test_config, NULL, &delay_ms);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_007: [ If delay_ms is NULL then h_fabric_hedge_get_delay shall fail and return false. ]*/
+TEST_FUNCTION(h_fabric_hedge_get_delay_with_delay_ms_NULL_fails)
+{
+    ///arrange
+    test_record_latencies();
+
+    ///act
+    bool result = h_fabric_hedge_get_delay(&test_config, &test_latency, NULL);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_008: [ If percentile of config is 0 then h_fabric_hedge_get_delay shall return false. ]*/
+TEST_FUNCTION(h_fabric_hedge_get_delay_with_percentile_0_returns_false)
+{
+    ///arrange
+    uint32_t delay_ms;
+    test_record_latencies();
+    test_config.percentile = 0;
+
+    ///act
+    bool result = h_fabric_hedge_get_delay(&test_config, &test_latency, &delay_ms);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_009: [ If the buckets of latency count fewer than minimum_samples latencies then h_fabric_hedge_get_delay shall return false. ]*/
+TEST_FUNCTION(h_fabric_hedge_get_delay_with_too_few_latencies_returns_false)
+{
+    ///arrange
+    uint32_t delay_ms;
+    for (uint32_t i = 0; i < TEST_MINIMUM_SAMPLES - 1; i++)
+    {
+        h_fabric_hedge_latency_record(&test_latency, TEST_LATENCY_MS);
+    }
+
+    ///act
+    bool result = h_fabric_hedge_get_delay(&test_config, &test_latency, &delay_ms);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_010: [ h_fabric_hedge_get_delay shall set delay_ms to the upper bound of the bucket where percentile of the counted latencies falls, but not lower than minimum_delay_ms, and return true. ]*/
+TEST_FUNCTION(h_fabric_hedge_get_delay_returns_the_upper_bound_of_the_bucket)
+{
+    ///arrange
+    uint32_t delay_ms;
+    test_record_latencies();
+
+    ///act
+    bool result = h_fabric_hedge_get_delay(&test_config, &test_latency, &delay_ms);
+
+    ///assert
+    ASSERT_IS_TRUE(result);
+    ASSERT_ARE_EQUAL(uint32_t, TEST_DELAY_MS, delay_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_010: [ h_fabric_hedge_get_delay shall set delay_ms to the upper bound of the bucket where percentile of the counted latencies falls, but not lower than minimum_delay_ms, and return true. ]*/
+TEST_FUNCTION(h_fabric_hedge_get_delay_follows_the_percentile)
+{
+    ///arrange
+    uint32_t delay_p50;
+    uint32_t delay_p90;
+    uint32_t delay_p99;
+    for (uint32_t i = 0; i < 90; i++)
+    {
+        h_fabric_hedge_latency_record(&test_latency, 1);
+    }
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        h_fabric_hedge_latency_record(&test_latency, 1000);
+    }
+
+    ///act
+    test_config.percentile = 50;
+    bool result_p50 = h_fabric_hedge_get_delay(&test_config, &test_latency, &delay_p50);
+    test_config.percentile = 90;
+    bool result_p90 = h_fabric_hedge_get_delay(&test_config, &test_latency, &delay_p90);
+    test_config.percentile = 99;
+    bool result_p99 = h_fabric_hedge_get_delay(&test_config, &test_latency, &delay_p99);
+
+    ///assert
+    ASSERT_IS_TRUE(result_p50);
+    ASSERT_IS_TRUE(result_p90);
+    ASSERT_IS_TRUE(result_p99);
+    ASSERT_ARE_EQUAL(uint32_t, 2, delay_p50);
+    ASSERT_ARE_EQUAL(uint32_t, 2, delay_p90);
+    ASSERT_ARE_EQUAL(uint32_t, 1024, delay_p99); /*1000 is in [896, 1024)*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_010: [ h_fabric_hedge_get_delay shall set delay_ms to the upper bound of the bucket where percentile of the counted latencies falls, but not lower than minimum_delay_ms, and return true. ]*/
+TEST_FUNCTION(h_fabric_hedge_get_delay_returns_at_least_minimum_delay_ms)
+{
+    ///arrange
+    uint32_t delay_ms;
+    test_record_latencies();
+    test_config.minimum_delay_ms = 100;
+
+    ///act
+    bool result = h_fabric_hedge_get_delay(&test_config, &test_latency, &delay_ms);
+
+    ///assert
+    ASSERT_IS_TRUE(result);
+    ASSERT_ARE_EQUAL(uint32_t, 100, delay_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_hedge_execute */
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_011: [ If config is NULL then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_config_NULL_fails)
+{
+    ///arrange
+    void* result;
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(NULL, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_012: [ If latency is NULL then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_latency_NULL_fails)
+{
+    ///arrange
+    void* result;
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, NULL, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_013: [ If attempt is NULL then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_attempt_NULL_fails)
+{
+    ///arrange
+    void* result;
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, NULL, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_014: [ If args is NULL or args_size is 0 then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_args_NULL_fails)
+{
+    ///arrange
+    void* result;
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, NULL, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_014: [ If args is NULL or args_size is 0 then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_args_size_0_fails)
+{
+    ///arrange
+    void* result;
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, 0, test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_015: [ If result is NULL then h_fabric_hedge_execute shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_result_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_016: [ If percentile of config is 0 then h_fabric_hedge_execute shall call attempt with args and result on the calling thread and return what attempt returns. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_percentile_0_calls_attempt_on_the_calling_thread)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_config.percentile = 0;
+
+    STRICT_EXPECTED_CALL(test_attempt(&test_args, IGNORED_ARG, &result))
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    STRICT_EXPECTED_CALL(test_on_done(TEST_ON_DONE_CONTEXT));
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(int32_t, TEST_MINIMUM_SAMPLES, test_latency.samples); /*nothing recorded*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_on_done_NULL_succeeds)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_config.percentile = 0;
+
+    STRICT_EXPECTED_CALL(test_attempt(&test_args, IGNORED_ARG, &result))
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), NULL, NULL, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_033: [ If timer_wheel or threadpool is NULL then h_fabric_hedge_execute shall call attempt with args and result on the calling thread, record its latency if it succeeded and return what attempt returns. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_timer_wheel_NULL_calls_attempt_on_the_calling_thread_and_records_the_latency)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME);
+    STRICT_EXPECTED_CALL(test_attempt(&test_args, IGNORED_ARG, &result))
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME + TEST_LATENCY_MS);
+    STRICT_EXPECTED_CALL(test_on_done(TEST_ON_DONE_CONTEXT));
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, NULL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(int32_t, TEST_MINIMUM_SAMPLES + 1, test_latency.samples);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_033: [ If timer_wheel or threadpool is NULL then h_fabric_hedge_execute shall call attempt with args and result on the calling thread, record its latency if it succeeded and return what attempt returns. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_threadpool_NULL_calls_attempt_on_the_calling_thread_and_records_the_latency)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME);
+    STRICT_EXPECTED_CALL(test_attempt(&test_args, IGNORED_ARG, &result))
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME + TEST_LATENCY_MS);
+    STRICT_EXPECTED_CALL(test_on_done(TEST_ON_DONE_CONTEXT));
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, NULL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(int32_t, TEST_MINIMUM_SAMPLES + 1, test_latency.samples);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_017: [ If h_fabric_hedge_get_delay returns false then h_fabric_hedge_execute shall call attempt with args and result on the calling thread, record its latency if it succeeded and return what attempt returns. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_too_few_latencies_calls_attempt_on_the_calling_thread_and_records_the_latency)
+{
+    ///arrange
+    void* result;
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME);
+    STRICT_EXPECTED_CALL(test_attempt(&test_args, IGNORED_ARG, &result))
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME + TEST_LATENCY_MS);
+    STRICT_EXPECTED_CALL(test_on_done(TEST_ON_DONE_CONTEXT));
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(int32_t, 1, test_latency.samples);
+    ASSERT_ARE_EQUAL(int32_t, 1, test_latency.buckets[9]);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_017: [ If h_fabric_hedge_get_delay returns false then h_fabric_hedge_execute shall call attempt with args and result on the calling thread, record its latency if it succeeded and return what attempt returns. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_too_few_latencies_does_not_record_the_latency_of_a_failure)
+{
+    ///arrange
+    void* result;
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME);
+    STRICT_EXPECTED_CALL(test_attempt(&test_args, IGNORED_ARG, &result))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    STRICT_EXPECTED_CALL(test_on_done(TEST_ON_DONE_CONTEXT));
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_TIMEOUT, hr);
+    ASSERT_ARE_EQUAL(int32_t, 0, test_latency.samples);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_019: [ If allocating the call fails then h_fabric_hedge_execute shall call attempt with args and result on the calling thread, record its latency if it succeeded and return what attempt returns. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_037: [ When the call is not hedged h_fabric_hedge_execute shall call on_done with on_done_context before returning, when on_done is not NULL. ]*/
+TEST_FUNCTION(when_malloc_flex_fails_h_fabric_hedge_execute_calls_attempt_on_the_calling_thread)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(uint64_t)))
+        .SetReturn(NULL);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME);
+    STRICT_EXPECTED_CALL(test_attempt(&test_args, IGNORED_ARG, &result))
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME + TEST_LATENCY_MS);
+    STRICT_EXPECTED_CALL(test_on_done(TEST_ON_DONE_CONTEXT));
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_018: [ h_fabric_hedge_execute shall allocate a call holding HEDGE_MAX_ATTEMPTS copies of args and a reference on threadpool, with a reference for the calling thread. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_020: [ h_fabric_hedge_execute shall arm a timer that starts the second attempt after delay_ms by calling timer_wheel_timer_init and timer_wheel_schedule. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_024: [ h_fabric_hedge_execute shall run the first attempt on the calling thread, with the SERVICEFABRIC_DOX_CANCELLATION of the attempt made current by calling servicefabric_dox_cancellation_set_current. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_022: [ An attempt that succeeds shall record its latency by calling timer_global_get_elapsed_ms and h_fabric_hedge_latency_record. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_028: [ The winner shall cancel the other attempt by calling servicefabric_dox_cancellation_cancel. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_034: [ Once the first attempt completed h_fabric_hedge_execute shall cancel the timer by calling timer_wheel_cancel. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_030: [ If an attempt succeeded then h_fabric_hedge_execute shall return its result in result and its HRESULT. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_029: [ h_fabric_hedge_execute shall give back the reference of the calling thread on the call without waiting for the attempt that lost. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_032: [ The one that gives back the last reference on the call shall release its reference on threadpool, free the call and call on_done with on_done_context, when on_done is not NULL. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_when_the_first_attempt_completes_in_time_does_not_schedule_any_work)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+
+    setup_start_expectations();
+    setup_run_attempt_expectations(S_OK, &test_result_1_ptr, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(uint32_t, 0, captured_work_count);
+    ASSERT_ARE_EQUAL(int32_t, TEST_MINIMUM_SAMPLES + 1, test_latency.samples);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_032: [ The one that gives back the last reference on the call shall release its reference on threadpool, free the call and call on_done with on_done_context, when on_done is not NULL. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_with_on_done_NULL_frees_the_call)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+
+    setup_start_expectations();
+    setup_run_attempt_expectations(S_OK, &test_result_1_ptr, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), NULL, NULL, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_031: [ If no attempt succeeded then h_fabric_hedge_execute shall return the HRESULT of the first attempt. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_when_the_first_attempt_fails_in_time_returns_its_failure)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+
+    setup_start_expectations();
+    setup_run_attempt_expectations(FABRIC_E_SERVICE_DOES_NOT_EXIST, NULL, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_SERVICE_DOES_NOT_EXIST, hr);
+    ASSERT_ARE_EQUAL(int32_t, TEST_MINIMUM_SAMPLES, test_latency.samples);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_021: [ If arming the timer fails then h_fabric_hedge_execute shall run the first attempt only. ]*/
+TEST_FUNCTION(when_timer_wheel_schedule_fails_h_fabric_hedge_execute_runs_the_first_attempt_only)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(uint64_t)));
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(IGNORED_ARG, TEST_THREADPOOL));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_wheel_timer_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, TEST_DELAY_MS, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(MU_FAILURE);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(IGNORED_ARG));
+    setup_run_attempt_expectations(S_OK, &test_result_1_ptr, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(uint32_t, 0, captured_work_count);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_025: [ When the timer fires before the first attempt completed, h_fabric_hedge_execute shall take a reference on the call and start a second attempt with its own copy of args on threadpool by calling threadpool_schedule_work. The work item makes the SERVICEFABRIC_DOX_CANCELLATION of the attempt current by calling servicefabric_dox_cancellation_set_current. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_028: [ The winner shall cancel the other attempt by calling servicefabric_dox_cancellation_cancel. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_038: [ The second attempt shall give back its reference on the call once it completed. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_030: [ If an attempt succeeded then h_fabric_hedge_execute shall return its result in result and its HRESULT. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_032: [ The one that gives back the last reference on the call shall release its reference on threadpool, free the call and call on_done with on_done_context, when on_done is not NULL. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_when_the_first_attempt_is_slow_returns_the_result_of_the_second_and_cancels_the_first)
+{
+    ///arrange
+    void* result;
+    void* volatile_atomic* shared_of_second;
+    void* volatile_atomic* shared_of_first;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS;
+    test_work_runs_when_scheduled = true;
+
+    setup_start_expectations();
+    setup_timer_starts_second_attempt_expectations();
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_attempt(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
+        .ValidateArgumentBuffer(1, &test_args, sizeof(test_args))
+        .CaptureArgumentValue_shared(&shared_of_second)
+        .CopyOutArgumentBuffer_result(&test_result_2_ptr, sizeof(test_result_2_ptr));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME + TEST_LATENCY_MS);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_cancel(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG)); /*the callback of the timer is done*/
+    STRICT_EXPECTED_CALL(test_attempt(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG)) /*the first attempt was cancelled*/
+        .ValidateArgumentBuffer(1, &test_args, sizeof(test_args))
+        .CaptureArgumentValue_shared(&shared_of_first)
+        .SetReturn(HRESULT_FROM_WIN32(ERROR_CANCELLED));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(uint32_t, 1, captured_work_count);
+    ASSERT_ARE_EQUAL(void_ptr, (void*)shared_of_first, (void*)shared_of_second); /*the attempts share the slot of the call*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_029: [ h_fabric_hedge_execute shall give back the reference of the calling thread on the call without waiting for the attempt that lost. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_038: [ The second attempt shall give back its reference on the call once it completed. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_032: [ The one that gives back the last reference on the call shall release its reference on threadpool, free the call and call on_done with on_done_context, when on_done is not NULL. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_returns_the_result_of_the_first_attempt_without_waiting_for_the_second)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS;
+
+    setup_start_expectations();
+    setup_timer_starts_second_attempt_expectations();
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG)); /*the callback of the timer is done*/
+    setup_run_attempt_expectations(S_OK, &test_result_1_ptr, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///act
+    umock_c_reset_all_calls();
+    setup_attempt_work_expectations(HRESULT_FROM_WIN32(ERROR_CANCELLED), NULL, false, true); /*the second attempt was cancelled and completes later*/
+    test_run_captured_work();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_023: [ The first attempt that succeeds is the winner, an attempt that succeeds after the winner shall release its result. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_releases_the_result_of_an_attempt_that_succeeds_after_the_winner)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS;
+    test_work_runs_when_scheduled = true;
+
+    setup_start_expectations();
+    setup_timer_starts_second_attempt_expectations();
+    setup_attempt_work_expectations(S_OK, &test_result_2_ptr, false, false);
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    setup_run_attempt_expectations(S_OK, &test_result_1_ptr, true); /*the first attempt completed before it could be cancelled*/
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_023: [ The first attempt that succeeds is the winner, an attempt that succeeds after the winner shall release its result. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_releases_the_result_of_a_second_attempt_that_succeeds_after_h_fabric_hedge_execute_returned)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS;
+
+    setup_start_expectations();
+    setup_timer_starts_second_attempt_expectations();
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    setup_run_attempt_expectations(S_OK, &test_result_1_ptr, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    setup_attempt_work_expectations(S_OK, &test_result_2_ptr, true, true); /*the cancel came after the operation of the second attempt completed*/
+
+    ///act
+    test_run_captured_work();
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_027: [ h_fabric_hedge_execute shall wait until an attempt succeeded or all the started attempts completed. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_030: [ If an attempt succeeded then h_fabric_hedge_execute shall return its result in result and its HRESULT. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_when_the_first_attempt_fails_waits_for_the_second)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS;
+    test_set_wait(0, true, INTERLOCKED_HL_OK);
+
+    setup_start_expectations();
+    setup_timer_starts_second_attempt_expectations();
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    setup_run_attempt_expectations(FABRIC_E_TIMEOUT, NULL, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForNotValue(IGNORED_ARG, 1, UINT32_MAX));
+    setup_attempt_work_expectations(S_OK, &test_result_2_ptr, false, false);
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_027: [ h_fabric_hedge_execute shall wait until an attempt succeeded or all the started attempts completed. ]*/
+/*Tests_SRS_H_FABRIC_HEDGE_01_031: [ If no attempt succeeded then h_fabric_hedge_execute shall return the HRESULT of the first attempt. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_when_both_attempts_fail_returns_the_failure_of_the_first)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS;
+    test_set_wait(0, true, INTERLOCKED_HL_OK);
+
+    setup_start_expectations();
+    setup_timer_starts_second_attempt_expectations();
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    setup_run_attempt_expectations(FABRIC_E_SERVICE_DOES_NOT_EXIST, NULL, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForNotValue(IGNORED_ARG, 1, UINT32_MAX));
+    setup_attempt_work_expectations(FABRIC_E_TIMEOUT, NULL, false, false);
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_SERVICE_DOES_NOT_EXIST, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_027: [ h_fabric_hedge_execute shall wait until an attempt succeeded or all the started attempts completed. ]*/
+TEST_FUNCTION(when_waiting_for_the_attempts_fails_h_fabric_hedge_execute_waits_again)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS;
+    test_set_wait(0, false, INTERLOCKED_HL_ERROR);
+    test_set_wait(1, true, INTERLOCKED_HL_OK);
+
+    setup_start_expectations();
+    setup_timer_starts_second_attempt_expectations();
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    setup_run_attempt_expectations(FABRIC_E_TIMEOUT, NULL, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForNotValue(IGNORED_ARG, 1, UINT32_MAX));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForNotValue(IGNORED_ARG, 1, UINT32_MAX));
+    setup_attempt_work_expectations(S_OK, &test_result_2_ptr, false, false);
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_026: [ If starting the second attempt fails then h_fabric_hedge_execute shall wait for the first attempt only. ]*/
+TEST_FUNCTION(when_starting_the_second_attempt_fails_h_fabric_hedge_execute_waits_for_the_first)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS;
+
+    setup_start_expectations();
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TEST_START_TIME);
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(MU_FAILURE);
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    setup_run_attempt_expectations(S_OK, &test_result_1_ptr, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_036: [ If the timer wheel is destroyed before the timer fired then h_fabric_hedge_execute shall wait for the first attempt only. ]*/
+TEST_FUNCTION(when_the_timer_wheel_is_destroyed_before_the_timer_fired_h_fabric_hedge_execute_waits_for_the_first)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_THE_FIRST_ATTEMPT_STARTS;
+    test_timer_is_cancelled = true;
+
+    setup_start_expectations();
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG)); /*the callback of the timer only says it is done*/
+    setup_run_attempt_expectations(S_OK, &test_result_1_ptr, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(uint32_t, 0, captured_work_count);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_025: [ When the timer fires before the first attempt completed, h_fabric_hedge_execute shall take a reference on the call and start a second attempt with its own copy of args on threadpool by calling threadpool_schedule_work. The work item makes the SERVICEFABRIC_DOX_CANCELLATION of the attempt current by calling servicefabric_dox_cancellation_set_current. ]*/
+TEST_FUNCTION(h_fabric_hedge_execute_does_not_start_the_second_attempt_when_the_timer_fires_after_the_first_attempt_completed)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_CANCELLED;
+
+    setup_start_expectations();
+    setup_run_attempt_expectations(FABRIC_E_SERVICE_DOES_NOT_EXIST, NULL, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG)); /*the callback of the timer only says it is done*/
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_SERVICE_DOES_NOT_EXIST, hr);
+    ASSERT_ARE_EQUAL(uint32_t, 0, captured_work_count);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_HEDGE_01_035: [ If timer_wheel_cancel returns false then h_fabric_hedge_execute shall wait for the callback of the timer to finish by calling InterlockedHL_WaitForValue. ]*/
+TEST_FUNCTION(when_timer_wheel_cancel_returns_false_h_fabric_hedge_execute_waits_for_the_callback_of_the_timer)
+{
+    ///arrange
+    void* result;
+    test_record_latencies();
+    test_timer_fires = TEST_TIMER_FIRES_WHEN_WAITED_FOR;
+    test_timer_wait_returns[0] = INTERLOCKED_HL_ERROR;
+
+    setup_start_expectations();
+    setup_run_attempt_expectations(S_OK, &test_result_1_ptr, false);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, UINT32_MAX));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, UINT32_MAX));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    setup_call_freed_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_hedge_execute(&test_config, &test_latency, TEST_TIMER_WHEEL, TEST_THREADPOOL, test_attempt, &test_args, sizeof(test_args), test_on_done, TEST_ON_DONE_CONTEXT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(uint32_t, 0, captured_work_count);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -14,6 +14,7 @@
 #include "testrunnerswitcher.h"
 #include "umock_c/umock_c.h"
 #include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_bool.h"
 #include "umock_c/umocktypes_charptr.h"
 #include "umock_c/umocktypes_windows.h"
 #include "umock_c/umock_c_negative_tests.h"
@@ -27,11 +28,19 @@
 #include "c_pal/gballoc_hl.h"
 #include "c_pal/gballoc_hl_redirect.h"
 #include "c_pal/timer.h"
+#include "c_pal/thandle.h"
 #include "c_pal/threadapi.h"
+#include "c_pal/threadpool.h"
+
+#include "sf_c_util/timer_wheel.h"
+#include "c_util/worker_thread.h"
 
 #include "ifabriczzzz_sync.h"
 
 MOCKABLE_FUNCTION(, ULONG, DoNothingRelease, IFabricZZZZ*, h);
+MOCKABLE_FUNCTION(, void, test_on_complete, void*, context, HRESULT, result);
+MOCKABLE_FUNCTION(, ULONG, test_result_AddRef, IUnknown*, This);
+MOCKABLE_FUNCTION(, ULONG, test_result_Release, IUnknown*, This);
 
 #undef ENABLE_MOCKS
 
@@ -45,6 +54,11 @@ static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
     ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
 }
 
+IMPLEMENT_UMOCK_C_ENUM_TYPE(THREADAPI_RESULT, THREADAPI_RESULT_VALUES);
+/*worker_thread is mocked, so its enum strings (used in the logs of the _async APIs) are not linked in*/
+MU_DEFINE_ENUM_STRINGS(WORKER_THREAD_SCHEDULE_PROCESS_RESULT, WORKER_THREAD_SCHEDULE_PROCESS_RESULT_VALUES)
+IMPLEMENT_UMOCK_C_ENUM_TYPE(WORKER_THREAD_SCHEDULE_PROCESS_RESULT, WORKER_THREAD_SCHEDULE_PROCESS_RESULT_VALUES);
+
 static ULONG DoNothingRelease_hook(IFabricZZZZ* h)
 {
     real_gballoc_hl_free(h); /*no ref counting*/
@@ -57,8 +71,19 @@ static IFabricZZZZVtbl vtbl =
     DoSomethingAwesome,
     DoSomethingAwesomeNoSFTimeout,
     DoSomethingWithPossibleFailures,
-    DoSomethingWithPossibleFailuresNoSFTimeout
+    DoSomethingWithPossibleFailuresNoSFTimeout,
+    DoSomethingShared,
+    DoSomethingHedged
+};
+
+/*fake result of DoSomethingShared and DoSomethingHedged, only AddRef and Release are ever called*/
+static IUnknownVtbl test_result_vtbl =
+{
+    .AddRef = test_result_AddRef,
+    .Release = test_result_Release
 };
+static IUnknown test_result = { &test_result_vtbl };
+static IUnknown* test_result_ptr = &test_result;
 
 /*sort of "reals"*/
 static HRESULT MU_C2(real_, CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ))(IFabricZZZZ** fabricVariable)
@@ -71,6 +96,181 @@ static HRESULT MU_C2(real_, CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ))(IFabricZZZ
 #define TIME_START_OF_TIME 2000 /*time starts at 2 second*/
 #define TIME_MS_BETWEEN_RETRIES 100 /*APIs have a timeout of 1 second, this includes all retries and individual timeouts*/
 #define TIME_TIMEOUT 1000 /*timeout for hte call is 1000*/
+#define TIME_CIRCUIT_BREAKER_OPEN 5000 /*the circuit breaker stays open 5 seconds*/
+
+/*a handle that makes 1 try per call and opens its circuit breaker once 2 calls failed*/
+static H_FABRIC_HANDLE(IFabricZZZZ) create_handle_with_circuit_breaker(void)
+{
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 1, TIME_MS_BETWEEN_RETRIES));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFabricZZZZ)(&retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFabricZZZZ)(handle, 100, 2, 60000, TIME_CIRCUIT_BREAKER_OPEN));
+    umock_c_reset_all_calls();
+    return handle;
+}
+
+/*expected calls of a H_FABRIC_API(DoSomethingAwesome) that fails with FABRIC_E_GATEWAY_NOT_REACHABLE at time now, while the circuit breaker is closed*/
+static void setup_DoSomethingAwesome_fails(double now)
+{
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(now);
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .SetReturn(FABRIC_E_GATEWAY_NOT_REACHABLE);
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(now + 10);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_exit*/
+        .SetReturn(now + 10);
+}
+
+/*opens the circuit breaker of handle at TIME_START_OF_TIME + 110*/
+static void open_circuit_breaker(H_FABRIC_HANDLE(IFabricZZZZ) handle)
+{
+    setup_DoSomethingAwesome_fails(TIME_START_OF_TIME);
+    setup_DoSomethingAwesome_fails(TIME_START_OF_TIME + 100);
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_GATEWAY_NOT_REACHABLE, H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT));
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_GATEWAY_NOT_REACHABLE, H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+}
+
+#define TEST_TIMER_WHEEL ((TIMER_WHEEL_HANDLE)0x4243)
+#define TEST_OTHER_TIMER_WHEEL ((TIMER_WHEEL_HANDLE)0x4247)
+#define TEST_ON_COMPLETE_CONTEXT ((void*)0x4244)
+
+/*what the _async APIs hand to the sync layer and to the timer wheel, the tests call them to complete the tries and fire the timers*/
+static SERVICEFABRIC_DOX_ON_COMPLETE captured_on_complete;
+static void* captured_on_complete_context;
+static TIMER_WHEEL_CALLBACK captured_timer_callback;
+static void* captured_timer_callback_context;
+static TIMER_WHEEL_HANDLE captured_current_timer_wheel;
+
+static HRESULT hook_DoSomethingAwesome_async(IFabricZZZZ* This, const char* queryDescription, DWORD timeoutMilliseconds, SERVICEFABRIC_DOX_ON_COMPLETE on_complete, void* on_complete_context)
+{
+    (void)This;
+    (void)queryDescription;
+    (void)timeoutMilliseconds;
+    captured_on_complete = on_complete;
+    captured_on_complete_context = on_complete_context;
+    captured_current_timer_wheel = servicefabric_dox_cancellation_get_current_timer_wheel();
+    return S_OK;
+}
+
+static HRESULT hook_DoSomethingWithPossibleFailures_async(IFabricZZZZ* This, const char* queryDescription, DWORD timeoutMilliseconds, SERVICEFABRIC_DOX_ON_COMPLETE on_complete, void* on_complete_context)
+{
+    return hook_DoSomethingAwesome_async(This, queryDescription, timeoutMilliseconds, on_complete, on_complete_context);
+}
+
+static int hook_timer_wheel_schedule(TIMER_WHEEL_HANDLE timer_wheel, TIMER_WHEEL_TIMER* timer, uint32_t delay_ms, TIMER_WHEEL_CALLBACK callback, void* callback_context)
+{
+    (void)timer_wheel;
+    (void)timer;
+    (void)delay_ms;
+    captured_timer_callback = callback;
+    captured_timer_callback_context = callback_context;
+    return 0;
+}
+
+#define TEST_RETRY_WORKER ((WORKER_THREAD_HANDLE)0x4246)
+
+/*the retry worker of the handle runs as soon as something is queued on it*/
+static WORKER_FUNC captured_retry_worker_func;
+static void* captured_retry_worker_context;
+
+static WORKER_THREAD_HANDLE hook_worker_thread_create(WORKER_FUNC worker_func, void* worker_func_context)
+{
+    captured_retry_worker_func = worker_func;
+    captured_retry_worker_context = worker_func_context;
+    return TEST_RETRY_WORKER;
+}
+
+static WORKER_THREAD_SCHEDULE_PROCESS_RESULT hook_worker_thread_schedule_process(WORKER_THREAD_HANDLE worker_thread)
+{
+    (void)worker_thread;
+    captured_retry_worker_func(captured_retry_worker_context);
+    return WORKER_THREAD_SCHEDULE_PROCESS_OK;
+}
+
+/*the instances that H_FABRIC_API(DoSomethingHedged) calls DoSomethingHedged on, the first call fires the timer that starts the second run (if there is one)*/
+static IFabricZZZZ* hedged_instances[2];
+static uint32_t hedged_instance_count;
+
+static HRESULT hook_DoSomethingHedged(IFabricZZZZ* This, const char* queryDescription, DWORD timeoutMilliseconds, IUnknown** result)
+{
+    (void)queryDescription;
+    (void)timeoutMilliseconds;
+    ASSERT_IS_TRUE(hedged_instance_count < 2);
+    hedged_instances[hedged_instance_count] = This;
+    hedged_instance_count++;
+    if ((hedged_instance_count == 1) && (captured_timer_callback != NULL))
+    {
+        captured_timer_callback(captured_timer_callback_context, false);
+    }
+    *result = &test_result;
+    return S_OK;
+}
+
+#define TEST_THREADPOOL ((THANDLE(THREADPOOL))0x4248)
+#define TEST_OTHER_THREADPOOL ((THANDLE(THREADPOOL))0x4249)
+
+/*THANDLE(THREADPOOL) is mocked, the handle still needs to hold the threadpool it is given*/
+static void hook_THANDLE_INITIALIZE_THREADPOOL(THANDLE(THREADPOOL)* t1, THANDLE(THREADPOOL) t2)
+{
+    *(THREADPOOL const**)t1 = t2;
+}
+
+static void hook_THANDLE_ASSIGN_THREADPOOL(THANDLE(THREADPOOL)* t1, THANDLE(THREADPOOL) t2)
+{
+    *(THREADPOOL const**)t1 = t2;
+}
+
+/*the work item runs before threadpool_schedule_work returns*/
+static int hook_threadpool_schedule_work(THANDLE(THREADPOOL) threadpool, THREADPOOL_WORK_FUNCTION work_function, void* work_function_context)
+{
+    (void)threadpool;
+    work_function(work_function_context);
+    return 0;
+}
+
+/*the second time H_FABRIC_API reads the time (after its first try failed, before it sleeps) the cancellation of the calling thread is cancelled*/
+static SERVICEFABRIC_DOX_CANCELLATION* test_cancellation_to_cancel;
+static uint32_t test_elapsed_ms_calls;
+
+static double hook_timer_global_get_elapsed_ms_cancels(void)
+{
+    test_elapsed_ms_calls++;
+    if (test_elapsed_ms_calls == 2)
+    {
+        servicefabric_dox_cancellation_cancel(test_cancellation_to_cancel);
+    }
+    return TIME_START_OF_TIME + 10 * (test_elapsed_ms_calls - 1);
+}
+
+/*a handle whose retry policy makes up to tries tries, TIME_MS_BETWEEN_RETRIES apart, with a timer wheel for the _async APIs*/
+static H_FABRIC_HANDLE(IFabricZZZZ) create_handle_with_timer_wheel(uint32_t tries)
+{
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, tries, TIME_MS_BETWEEN_RETRIES));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFabricZZZZ)(&retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricZZZZ)(handle, TEST_TIMER_WHEEL));
+    umock_c_reset_all_calls();
+    return handle;
+}
+
+/*expected calls of H_FABRIC_API_ASYNC(DoSomethingAwesome) up to the start of its first try*/
+static void setup_DoSomethingAwesome_async_starts(void)
+{
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(timer_wheel_timer_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoSomethingAwesome_async(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG, IGNORED_ARG));
+}
 
 BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
 
@@ -81,6 +281,7 @@ TEST_SUITE_INITIALIZE(suite_init)
     ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
 
     ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types());
     ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types());
     ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types());
 
@@ -91,6 +292,37 @@ TEST_SUITE_INITIALIZE(suite_init)
     REGISTER_GLOBAL_MOCK_RETURNS(DoSomethingAwesomeNoSFTimeout, S_OK, E_FAIL);
     REGISTER_GLOBAL_MOCK_RETURNS(DoSomethingWithPossibleFailures, S_OK, E_FAIL);
     REGISTER_GLOBAL_MOCK_RETURNS(DoSomethingWithPossibleFailuresNoSFTimeout, S_OK, E_FAIL);
+    REGISTER_GLOBAL_MOCK_RETURNS(DoSomethingShared, S_OK, E_FAIL);
+    REGISTER_GLOBAL_MOCK_RETURNS(DoSomethingHedged, S_OK, E_FAIL);
+    REGISTER_GLOBAL_MOCK_HOOK(DoSomethingAwesome_async, hook_DoSomethingAwesome_async);
+    REGISTER_GLOBAL_MOCK_HOOK(DoSomethingWithPossibleFailures_async, hook_DoSomethingWithPossibleFailures_async);
+    REGISTER_GLOBAL_MOCK_HOOK(timer_wheel_schedule, hook_timer_wheel_schedule);
+    REGISTER_GLOBAL_MOCK_HOOK(THANDLE_INITIALIZE(THREADPOOL), hook_THANDLE_INITIALIZE_THREADPOOL);
+    REGISTER_GLOBAL_MOCK_HOOK(THANDLE_ASSIGN(THREADPOOL), hook_THANDLE_ASSIGN_THREADPOOL);
+    REGISTER_GLOBAL_MOCK_HOOK(threadpool_schedule_work, hook_threadpool_schedule_work);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(threadpool_schedule_work, MU_FAILURE);
+    REGISTER_GLOBAL_MOCK_HOOK(worker_thread_create, hook_worker_thread_create);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(worker_thread_create, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(worker_thread_open, 0, MU_FAILURE);
+    REGISTER_GLOBAL_MOCK_HOOK(worker_thread_schedule_process, hook_worker_thread_schedule_process);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(worker_thread_schedule_process, WORKER_THREAD_SCHEDULE_PROCESS_ERROR);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_AddRef, 2);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_Release, 1);
+
+    REGISTER_UMOCK_ALIAS_TYPE(IUnknown*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IUnknown**, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(SERVICEFABRIC_DOX_ON_COMPLETE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TIMER_WHEEL_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TIMER_WHEEL_CALLBACK, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TIMER_WHEEL_TIMER*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THREAD_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THREAD_START_FUNC, void*);
+    REGISTER_TYPE(THREADAPI_RESULT, THREADAPI_RESULT);
+    REGISTER_UMOCK_ALIAS_TYPE(THANDLE(THREADPOOL), void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THREADPOOL_WORK_FUNCTION, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(WORKER_THREAD_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(WORKER_FUNC, void*);
+    REGISTER_TYPE(WORKER_THREAD_SCHEDULE_PROCESS_RESULT, WORKER_THREAD_SCHEDULE_PROCESS_RESULT);
 
     REGISTER_GLOBAL_MOCK_HOOK(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ), MU_C2(real_, CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)));
 
@@ -115,13 +347,17 @@ TEST_FUNCTION_CLEANUP(method_cleanup)
     umock_c_negative_tests_deinit();
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_001: [ H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall allocate memory to hold nMaxRetries, msBetweenRetries and an instance of IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_002: [ H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME by calling CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME). ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_001: [ H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall initialize a fixed delay retry policy of nMaxRetries tries and msBetweenRetries by calling h_fabric_retry_policy_init_fixed. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_002: [ H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall create the handle by calling H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFABRIC_INTERFACE_NAME). ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_013: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall allocate memory to hold a copy of retryPolicy and clientCount clients. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_014: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall create clientCount instances of IFABRIC_INTERFACE_NAME by calling CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME). ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_020: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall hand the instances of IFABRIC_INTERFACE_NAME to the client pool of the handle by calling h_fabric_client_pool_init with clientCount and selection. ]*/
 TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_IFABRIC_INTERFACE_NAME_succeeds)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
 
     ///act
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0,0);
@@ -135,10 +371,11 @@ TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_IFABRIC_INTERFACE_NAME_succeeds)
 }
 
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_003: [ If there are any failures then H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_015: [ If there are any failures then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/
 TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_IFABRIC_INTERFACE_NAME_fails_when_CREATE_IFABRICINSTANCE_NAME_IFabricZZZZ_fails)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG))
         .SetReturn(E_FAIL);
     STRICT_EXPECTED_CALL(free(IGNORED_ARG));
@@ -154,11 +391,33 @@ TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_IFABRIC_INTERFACE_NAME_fails_when_CREATE_IF
 }
 
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_003: [ If there are any failures then H_FABRIC_HANDLE_CREATE(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_015: [ If there are any failures then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/
 TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_IFABRIC_INTERFACE_NAME_fails_when_malloc_fails)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG))
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG))
+        .SetReturn(NULL);
+
+    ///act
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0);
+
+    ///assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_015: [ If there are any failures then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_IFABRIC_INTERFACE_NAME_fails_when_h_fabric_client_holder_init_fails)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG)) /*the generation of the client holder*/
         .SetReturn(NULL);
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
 
     ///act
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0);
@@ -182,18 +441,20 @@ TEST_FUNCTION(H_FABRIC_HANDLE_DESTROY_IFABRIC_INTERFACE_NAME_with_handle_NULL_re
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_005: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall call ->Release() on the instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_005: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall release the instances of IFABRIC_INTERFACE_NAME by calling h_fabric_client_pool_deinit. ]*/
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_006: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall free the allocated memory. ]*/
 TEST_FUNCTION(H_FABRIC_HANDLE_DESTROY_IFABRIC_INTERFACE_NAME_succeeds)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
 
     STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
     STRICT_EXPECTED_CALL(free(result));
 
     ///act
@@ -203,6 +464,48 @@ TEST_FUNCTION(H_FABRIC_HANDLE_DESTROY_IFABRIC_INTERFACE_NAME_succeeds)
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 }
 
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_086: [ If the handle has a retry worker then H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall stop it by calling worker_thread_close and worker_thread_destroy. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_DESTROY_IFABRIC_INTERFACE_NAME_stops_the_retry_worker)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(1);
+
+    STRICT_EXPECTED_CALL(worker_thread_close(TEST_RETRY_WORKER));
+    STRICT_EXPECTED_CALL(worker_thread_destroy(TEST_RETRY_WORKER));
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(handle));
+
+    ///act
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_091: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall wait until the hedged calls of the handle are done by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_092: [ If hedging was set then H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall release the threadpool of the handle. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_DESTROY_IFABRIC_INTERFACE_NAME_releases_the_threadpool_of_a_hedged_handle)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 95, 20, 10, TEST_THREADPOOL));
+    umock_c_reset_all_calls();
+
+    /*no hedged call is going, so there is nothing to wait for*/
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(&handle->threadpool, NULL));
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(handle));
+
+    ///act
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_007: [ If handle is NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return NULL. ]*/
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_with_handle_NULL_fails)
 {
@@ -218,12 +521,15 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_with_handle_NULL_fails)
 
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall record the start time of the request by calling timer_global_get_elapsed_ms. ]*/
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_009: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall call IFABRIC_METHOD_NAME on the instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_016: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall take a reference on the current instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_acquire. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_017: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once IFABRIC_METHOD_NAME returned. ]*/
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_010: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0); /*0 retries, 0 ms timeout*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -241,15 +547,16 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds)
     H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall release the existing instance and shall retry using new newly created IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep msBetweenRetries. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the new instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay by calling servicefabric_dox_cancellation_sleep. ]*/
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_010: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_ABORT)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -259,10 +566,12 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_ABO
         .SetReturn(E_ABORT);
     /*because of E_ABORT the object is recreated*/
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + 100);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT));
 
     ///act
@@ -276,15 +585,16 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_ABO
     H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall release the existing instance and shall retry using new newly created IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep msBetweenRetries. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the new instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay by calling servicefabric_dox_cancellation_sleep. ]*/
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_010: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_GATEWAY_NOT_REACHABLE)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -294,10 +604,12 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRI
         .SetReturn(FABRIC_E_GATEWAY_NOT_REACHABLE);
     /*because of E_ABORT the object is recreated*/
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + 100);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT));
 
     ///act
@@ -311,15 +623,16 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRI
     H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall release the existing instance and shall retry using new newly created IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep msBetweenRetries. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the new instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay by calling servicefabric_dox_cancellation_sleep. ]*/
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_010: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_TIMEOUT)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -329,10 +642,12 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRI
         .SetReturn(FABRIC_E_TIMEOUT);
     /*because of E_ABORT the object is recreated*/
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + 100);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT));
 
     ///act
@@ -346,15 +661,16 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRI
     H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall release the existing instance and shall retry using new newly created IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep msBetweenRetries. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_013: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the new instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay by calling servicefabric_dox_cancellation_sleep. ]*/
 /*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_010: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_OBJECT_CLOSED)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -364,10 +680,12 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRI
         .SetReturn(FABRIC_E_OBJECT_CLOSED);
     /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + 100);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT));
 
     ///act
@@ -385,8 +703,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRI
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_OBJECT_CLOSED_and_object_creation_fails_reuses_old_object)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -397,9 +716,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRI
     /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG))
         .SetReturn(E_FAIL); /*... and re-creation fails so old object is used anyway*/
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + 100);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT));
 
     ///act
@@ -417,8 +736,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRI
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_FAIL)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -427,9 +747,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_FAI
     STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
         .SetReturn(E_FAIL);
     /*because of E_FAIL the object is NOT recreated*/
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + 100);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT));
 
     ///act
@@ -443,12 +763,13 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_FAI
     H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_017: [ If the total number of retries exceeds nMaxRetries then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_017: [ If h_fabric_retry_policy_get_next_delay returns false then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_after_2_tries)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(2, TIME_MS_BETWEEN_RETRIES); /*2 tries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -460,10 +781,16 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_af
             .SetReturn(FABRIC_E_OBJECT_CLOSED);
         /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
         STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+        STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
         STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-        STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+        STRICT_EXPECTED_CALL(free(IGNORED_ARG));
         STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
             .SetReturn(TIME_START_OF_TIME + 100);
+        if (retries < 2)
+        {
+            /*no sleep after the last try*/
+            STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+        }
     }
 
     ///act
@@ -481,8 +808,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_af
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_after_1_tries_because_timeout)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(2, TIME_MS_BETWEEN_RETRIES); /*2 tries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -493,10 +821,12 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_af
         .SetReturn(FABRIC_E_OBJECT_CLOSED);
     /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + TIME_TIMEOUT);
+    /*timeout is reached, no sleep*/
 
 
     ///act
@@ -514,8 +844,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_af
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_GATEWAY_NOT_REACHABLE_after_1_retry)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES); /*2 tries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -526,10 +857,12 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_GATEWAY_NOT_REAC
         .SetReturn(FABRIC_E_GATEWAY_NOT_REACHABLE);
     /*because of FABRIC_E_GATEWAY_NOT_REACHABLE the object is recreated*/
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + TIME_TIMEOUT);
+    /*timeout is reached, no sleep*/
 
 
     ///act
@@ -547,8 +880,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_GATEWAY_NOT_REAC
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_after_2_tries_because_timeout)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 tries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -559,9 +893,13 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_af
         STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
             .SetReturn(E_ACCESSDENIED);
         /*because of E_ACCESSDENIED the object is reused*/
-        STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
         STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
-            .SetReturn(TIME_START_OF_TIME + retries * 600); /*retries *600 will record 1600 and 2200 as current time. 2200 exceeds 2000 which is the limit*/
+            .SetReturn(TIME_START_OF_TIME + retries * 600); /*retries *600 will record 2600 and 3200 as current time. 3200 exceeds 3000 which is the limit*/
+        if (retries < 2)
+        {
+            /*no sleep once the timeout is reached*/
+            STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+        }
     }
 
     ///act
@@ -579,8 +917,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_af
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_after_1_retry_with_FABRIC_E_INVALID_ADDRESS_which_is_permanent_failure)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -589,9 +928,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_after_1_retry_with_FABRIC
     STRICT_EXPECTED_CALL(DoSomethingWithPossibleFailures(IGNORED_ARG, "a", TIME_TIMEOUT))
         .SetReturn(E_ACCESSDENIED);
     /*because of E_ACCESSDENIED retry as-is*/
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + 100);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     /*does not cause retry*/
     STRICT_EXPECTED_CALL(DoSomethingWithPossibleFailures(IGNORED_ARG, "a", TIME_TIMEOUT))
         .SetReturn(FABRIC_E_INVALID_ADDRESS);
@@ -611,8 +950,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_after_1_retry_with_FABRIC
 TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_after_1_retry_with_FABRIC_E_INVALID_NAME_URI_which_is_permanent_failure)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
@@ -621,9 +961,9 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_after_1_retry_with_FABRIC
     STRICT_EXPECTED_CALL(DoSomethingWithPossibleFailures(IGNORED_ARG, "a", TIME_TIMEOUT))
         .SetReturn(E_ACCESSDENIED);
     /*because of E_ACCESSDENIED retry as-is*/
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
         .SetReturn(TIME_START_OF_TIME + 100);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
     /*does not cause retry*/
     STRICT_EXPECTED_CALL(DoSomethingWithPossibleFailures(IGNORED_ARG, "a", TIME_TIMEOUT))
         .SetReturn(FABRIC_E_INVALID_NAME_URI);
@@ -639,247 +979,1861 @@ TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_after_1_retry_with_FABRIC
     H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/* H_FABRIC_DEFINE_API_NO_SF_TIMEOUT */
-
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_001: [ If handle is NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return NULL. ]*/
-TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_with_handle_NULL_fails_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_010: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall call h_fabric_retry_policy_get_next_delay with the retry policy of the handle and the time left until timeoutMilliseconds. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay by calling servicefabric_dox_cancellation_sleep. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_does_not_sleep_past_timeoutMilliseconds)
 {
     ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + TIME_TIMEOUT - 30); /*only 30 ms are left*/
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(30));
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT));
 
     ///act
-    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(NULL, "a");
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesome)(result, "a", TIME_TIMEOUT);
 
     ///assert
-    ASSERT_IS_TRUE(FAILED(hr));
+    ASSERT_IS_TRUE(SUCCEEDED(hr));
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_002: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall call IFABRIC_METHOD_NAME on the instance of IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_003: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
-TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+/* H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY */
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_012: [ If retryPolicy is NULL then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY_with_NULL_retryPolicy_fails)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0); /*0 retries*/
-    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
-
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
 
     ///act
-    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFabricZZZZ)(NULL);
 
     ///assert
-    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_IS_NULL(result);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
-
-    ///clean
-    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_004: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_006: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall release the existing instance and shall retry using new newly created IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep msBetweenRetries. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_003: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
-TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_ABORT_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_013: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall allocate memory to hold a copy of retryPolicy and clientCount clients. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_014: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall create clientCount instances of IFABRIC_INTERFACE_NAME by calling CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME). ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_035: [ H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFABRIC_INTERFACE_NAME) shall create a handle with 1 client by calling H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) and return it. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay by calling servicefabric_dox_cancellation_sleep. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY_with_exponential_policy_backs_off)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_exponential(&retryPolicy, 4, 50, 150));
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFabricZZZZ)(&retryPolicy);
+    ASSERT_IS_NOT_NULL(result);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
-        .SetReturn(E_ABORT);
-    /*because of E_ABORT the object is recreated*/
-    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(50));
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 50);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(100));
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 150);
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(150)); /*capped*/
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 300);
+    /*4 tries were made, no sleep*/
 
     ///act
-    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesome)(result, "a", TIME_TIMEOUT);
 
     ///assert
-    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_ARE_EQUAL(HRESULT, E_FAIL, hr);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
     ///clean
     H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_004: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_006: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall release the existing instance and shall retry using new newly created IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep msBetweenRetries. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_003: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
-TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_GATEWAY_NOT_REACHABLE_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+/* H_FABRIC_HANDLE_CREATE_POOLED */
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_036: [ If clientCount is 0 then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_POOLED_with_clientCount_0_fails)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 3, TIME_MS_BETWEEN_RETRIES));
+
+    ///act
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE_POOLED(IFabricZZZZ)(0, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT, &retryPolicy);
+
+    ///assert
+    ASSERT_IS_NULL(result);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
 
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
-        .SetReturn(FABRIC_E_GATEWAY_NOT_REACHABLE);
-    /*because of E_ABORT the object is recreated*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_012: [ If retryPolicy is NULL then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_POOLED_with_NULL_retryPolicy_fails)
+{
+    ///arrange
+
+    ///act
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE_POOLED(IFabricZZZZ)(2, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT, NULL);
+
+    ///assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_013: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall allocate memory to hold a copy of retryPolicy and clientCount clients. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_014: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall create clientCount instances of IFABRIC_INTERFACE_NAME by calling CREATE_IFABRICINSTANCE_NAME(IFABRIC_INTERFACE_NAME). ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_020: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall hand the instances of IFABRIC_INTERFACE_NAME to the client pool of the handle by calling h_fabric_client_pool_init with clientCount and selection. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_029: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall initialize the single flight group of the handle by calling h_fabric_single_flight_init. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_POOLED_with_2_clients_succeeds)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 3, TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 2, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
 
     ///act
-    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE_POOLED(IFabricZZZZ)(2, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT, &retryPolicy);
 
     ///assert
-    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_IS_NOT_NULL(result);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
     ///clean
     H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_004: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall create a new instance of IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_006: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall release the existing instance and shall retry using new newly created IFABRIC_INTERFACE_NAME. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep msBetweenRetries. ]*/
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_003: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
-TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_OBJECT_CLOSED_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_015: [ If there are any failures then H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall fail and return NULL. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_POOLED_fails_when_creating_the_second_client_fails)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 3, TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 2, IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG)); /*the first client*/
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE_POOLED(IFabricZZZZ)(2, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT, &retryPolicy);
+
+    ///assert
+    ASSERT_IS_NULL(result);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
 
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_005: [ H_FABRIC_HANDLE_DESTROY(IFABRIC_INTERFACE_NAME) shall release the instances of IFABRIC_INTERFACE_NAME by calling h_fabric_client_pool_deinit. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_DESTROY_releases_all_the_clients_of_a_pooled_handle)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 3, TIME_MS_BETWEEN_RETRIES));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE_POOLED(IFabricZZZZ)(2, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, &retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_031: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall pick the client of the handle that runs the call by calling h_fabric_client_pool_acquire. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_032: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the client by calling h_fabric_client_pool_release once it stopped retrying. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_011: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_with_FABRIC_E_OBJECT_CLOSED_recreates_only_the_client_that_failed)
+{
+    ///arrange
+    IFabricZZZZ* first_call_client;
+    IFabricZZZZ* first_call_retry_client;
+    IFabricZZZZ* second_call_client;
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 3, TIME_MS_BETWEEN_RETRIES));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE_POOLED(IFabricZZZZ)(2, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT, &retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .CaptureArgumentValue_This(&first_call_client)
         .SetReturn(FABRIC_E_OBJECT_CLOSED);
-    /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
+    /*only the client used by the call is recreated*/
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 100);
     STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .CaptureArgumentValue_This(&first_call_retry_client);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 200);
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "b", TIME_TIMEOUT))
+        .CaptureArgumentValue_This(&second_call_client);
 
     ///act
-    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+    HRESULT hr1 = H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT);
+    HRESULT hr2 = H_FABRIC_API(DoSomethingAwesome)(handle, "b", TIME_TIMEOUT);
 
     ///assert
-    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_IS_TRUE(SUCCEEDED(hr1));
+    ASSERT_IS_TRUE(SUCCEEDED(hr2));
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    /*the second call started when the first call had given back its client, so it went to the other client of the pool*/
+    ASSERT_ARE_NOT_EQUAL(void_ptr, first_call_retry_client, second_call_client);
+    ASSERT_ARE_NOT_EQUAL(void_ptr, first_call_retry_client, first_call_client);
 
     ///clean
-    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_005: [ If creating the new instance of IFABRIC_INTERFACE_NAME fails then H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the existing IFABRIC_INTERFACE_NAME. ]*/
-TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_OBJECT_CLOSED_and_object_creation_fails_reuses_old_object_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_033: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall pick the client of the handle that runs the call by calling h_fabric_client_pool_acquire. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_034: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the client by calling h_fabric_client_pool_release once it stopped retrying. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_spreads_the_calls_over_the_clients_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
-    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    IFabricZZZZ* first_call_client;
+    IFabricZZZZ* second_call_client;
+    IFabricZZZZ* third_call_client;
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 3, TIME_MS_BETWEEN_RETRIES));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE_POOLED(IFabricZZZZ)(2, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT, &retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
 
     STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
-        .SetReturn(FABRIC_E_OBJECT_CLOSED);
-    /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
-    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG))
-        .SetReturn(E_FAIL); /*... and re-creation fails so old object is used anyway*/
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+        .CaptureArgumentValue_This(&first_call_client);
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "b"))
+        .CaptureArgumentValue_This(&second_call_client);
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "c"))
+        .CaptureArgumentValue_This(&third_call_client);
 
     ///act
-    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+    HRESULT hr1 = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(handle, "a");
+    HRESULT hr2 = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(handle, "b");
+    HRESULT hr3 = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(handle, "c");
 
     ///assert
-    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_IS_TRUE(SUCCEEDED(hr1));
+    ASSERT_IS_TRUE(SUCCEEDED(hr2));
+    ASSERT_IS_TRUE(SUCCEEDED(hr3));
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    /*idle clients take turns*/
+    ASSERT_ARE_NOT_EQUAL(void_ptr, first_call_client, second_call_client);
+    ASSERT_ARE_EQUAL(void_ptr, first_call_client, third_call_client);
 
     ///clean
-    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_007: [ If the result is any other value except FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry. ]*/
-TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_FAIL_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+/* circuit breaker */
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_037: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall initialize the circuit breaker of the handle as disabled by calling h_fabric_circuit_breaker_init, and create the handle with no hedging and no timer wheel. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_CREATE_POOLED_creates_the_handle_without_circuit_breaker)
 {
     ///arrange
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 3, TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 2, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
     STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+
+    ///act
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE_POOLED(IFabricZZZZ)(2, H_FABRIC_CLIENT_POOL_SELECTION_LEAST_IN_FLIGHT, &retryPolicy);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(result);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint32_t, 0, result->circuitBreaker.config.failure_percent);
+    ASSERT_ARE_EQUAL(uint32_t, 0, result->hedgeConfig.percentile);
+    ASSERT_IS_NULL(result->timerWheel);
 
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
-        .SetReturn(E_FAIL);
-    /*because of E_FAIL the object is NOT recreated*/
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
-    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+}
+
+/* H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER */
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_069: [ If handle is NULL then H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER_with_NULL_handle_fails)
+{
+    ///arrange
 
     ///act
-    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+    int result = H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFabricZZZZ)(NULL, 50, 10, 1000, TIME_CIRCUIT_BREAKER_OPEN);
 
     ///assert
-    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_070: [ If failurePercent is 0 or greater than 100 then H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_071: [ If minimumCalls is 0 then H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_072: [ If windowMs is 0 then H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER_with_invalid_configuration_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+
+    ///act
+    int result1 = H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFabricZZZZ)(handle, 0, 10, 1000, TIME_CIRCUIT_BREAKER_OPEN);
+    int result2 = H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFabricZZZZ)(handle, 101, 10, 1000, TIME_CIRCUIT_BREAKER_OPEN);
+    int result3 = H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFabricZZZZ)(handle, 50, 0, 1000, TIME_CIRCUIT_BREAKER_OPEN);
+    int result4 = H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFabricZZZZ)(handle, 50, 10, 0, TIME_CIRCUIT_BREAKER_OPEN);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result1);
+    ASSERT_ARE_NOT_EQUAL(int, 0, result2);
+    ASSERT_ARE_NOT_EQUAL(int, 0, result3);
+    ASSERT_ARE_NOT_EQUAL(int, 0, result4);
+    ASSERT_ARE_EQUAL(uint32_t, 0, handle->circuitBreaker.config.failure_percent);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
     ///clean
-    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_009: [ If the total number of retries exceeds nMaxRetries then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/
-TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_after_2_tries_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_073: [ H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFABRIC_INTERFACE_NAME) shall initialize the circuit breaker of the handle with failurePercent, minimumCalls, windowMs and openMs by calling h_fabric_circuit_breaker_init and return 0. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER_starts_the_window_of_the_circuit_breaker)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(2, TIME_MS_BETWEEN_RETRIES); /*2 tries, 0.1 s between retries*/
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+
+    ///act
+    int result = H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFabricZZZZ)(handle, 50, 10, 1000, TIME_CIRCUIT_BREAKER_OPEN);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(uint32_t, 50, handle->circuitBreaker.config.failure_percent);
+    ASSERT_ARE_EQUAL(uint32_t, 10, handle->circuitBreaker.config.minimum_calls);
+    ASSERT_ARE_EQUAL(uint32_t, 1000, handle->circuitBreaker.config.window_ms);
+    ASSERT_ARE_EQUAL(uint32_t, TIME_CIRCUIT_BREAKER_OPEN, handle->circuitBreaker.config.open_ms);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
-    for (int retries = 1; retries <= 2; retries++)
-    {
-        STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
-            .SetReturn(FABRIC_E_OBJECT_CLOSED);
-        /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
-        STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-        STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
-        STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
-    }
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/* H_FABRIC_HANDLE_SET_HEDGING */
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_074: [ If handle is NULL then H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_HEDGING_with_NULL_handle_fails)
+{
+    ///arrange
 
     ///act
-    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+    int result = H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(NULL, 95, 20, 10, TEST_THREADPOOL);
 
     ///assert
-    ASSERT_IS_TRUE(hr == FABRIC_E_OBJECT_CLOSED);
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_075: [ If percentile is 0 or greater than 100 then H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_076: [ If minimumSamples is 0 then H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_088: [ If threadpool is NULL then H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_HEDGING_with_invalid_configuration_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+
+    ///act
+    int result1 = H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 0, 20, 10, TEST_THREADPOOL);
+    int result2 = H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 101, 20, 10, TEST_THREADPOOL);
+    int result3 = H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 95, 0, 10, TEST_THREADPOOL);
+    int result4 = H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 95, 20, 10, NULL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result1);
+    ASSERT_ARE_NOT_EQUAL(int, 0, result2);
+    ASSERT_ARE_NOT_EQUAL(int, 0, result3);
+    ASSERT_ARE_NOT_EQUAL(int, 0, result4);
+    ASSERT_ARE_EQUAL(uint32_t, 0, handle->hedgeConfig.percentile);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
     ///clean
-    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
 }
 
-/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_42_002: [ If the result is any value from permanent_failures then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return. ]*/
-TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_after_1_retry_with_FABRIC_E_NAME_NOT_EMPTY_which_is_permanent_failure_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_089: [ H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall keep a reference on threadpool, which runs the second runs of the hedged calls. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_077: [ H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall set the hedging configuration of the handle to percentile, minimumSamples and minimumDelayMs and return 0. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_HEDGING_succeeds)
 {
     ///arrange
-    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
-    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
-    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(&handle->threadpool, TEST_THREADPOOL));
+
+    ///act
+    int result = H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 95, 20, 10, TEST_THREADPOOL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(uint32_t, 95, handle->hedgeConfig.percentile);
+    ASSERT_ARE_EQUAL(uint32_t, 20, handle->hedgeConfig.minimum_samples);
+    ASSERT_ARE_EQUAL(uint32_t, 10, handle->hedgeConfig.minimum_delay_ms);
+    ASSERT_ARE_EQUAL(void_ptr, TEST_THREADPOOL, handle->threadpool);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
-    STRICT_EXPECTED_CALL(DoSomethingWithPossibleFailuresNoSFTimeout(IGNORED_ARG, "a"))
-        .SetReturn(E_ACCESSDENIED);
-    /*because of E_ACCESSDENIED retry as-is*/
-    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
-    /*does not cause retry*/
-    STRICT_EXPECTED_CALL(DoSomethingWithPossibleFailuresNoSFTimeout(IGNORED_ARG, "a"))
-        .SetReturn(FABRIC_E_NAME_NOT_EMPTY);
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_089: [ H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall keep a reference on threadpool, which runs the second runs of the hedged calls. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_077: [ H_FABRIC_HANDLE_SET_HEDGING(IFABRIC_INTERFACE_NAME) shall set the hedging configuration of the handle to percentile, minimumSamples and minimumDelayMs and return 0. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_HEDGING_twice_replaces_the_threadpool)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 95, 20, 10, TEST_THREADPOOL));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(&handle->threadpool, TEST_OTHER_THREADPOOL));
 
     ///act
-    HRESULT hr = H_FABRIC_API(DoSomethingWithPossibleFailuresNoSFTimeout)(result, "a");
+    int result = H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 90, 30, 20, TEST_OTHER_THREADPOOL);
 
     ///assert
-    ASSERT_IS_TRUE(hr == FABRIC_E_NAME_NOT_EMPTY);
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(uint32_t, 90, handle->hedgeConfig.percentile);
+    ASSERT_ARE_EQUAL(uint32_t, 30, handle->hedgeConfig.minimum_samples);
+    ASSERT_ARE_EQUAL(uint32_t, 20, handle->hedgeConfig.minimum_delay_ms);
+    ASSERT_ARE_EQUAL(void_ptr, TEST_OTHER_THREADPOOL, handle->threadpool);
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 
     ///clean
-    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/* H_FABRIC_HANDLE_SET_TIMER_WHEEL */
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_078: [ If handle is NULL then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_TIMER_WHEEL_with_NULL_handle_fails)
+{
+    ///arrange
+
+    ///act
+    int result = H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricZZZZ)(NULL, TEST_TIMER_WHEEL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_079: [ If timerWheel is NULL then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_TIMER_WHEEL_with_NULL_timerWheel_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+
+    ///act
+    int result = H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricZZZZ)(handle, NULL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_IS_NULL(handle->timerWheel);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_084: [ If the handle has no retry worker yet then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall create it by calling worker_thread_create and start it by calling worker_thread_open. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_080: [ H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall set the timer wheel of the handle to timerWheel and return 0. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_TIMER_WHEEL_succeeds)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+    STRICT_EXPECTED_CALL(worker_thread_create(IGNORED_ARG, handle));
+    STRICT_EXPECTED_CALL(worker_thread_open(TEST_RETRY_WORKER));
+
+    ///act
+    int result = H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricZZZZ)(handle, TEST_TIMER_WHEEL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(void_ptr, TEST_TIMER_WHEEL, handle->timerWheel);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_084: [ If the handle has no retry worker yet then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall create it by calling worker_thread_create and start it by calling worker_thread_open. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_TIMER_WHEEL_a_second_time_keeps_the_retry_worker)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(1);
+
+    ///act
+    int result = H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricZZZZ)(handle, TEST_OTHER_TIMER_WHEEL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(void_ptr, TEST_OTHER_TIMER_WHEEL, handle->timerWheel);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_085: [ If there are any failures then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_TIMER_WHEEL_fails_when_starting_the_retry_worker_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+    STRICT_EXPECTED_CALL(worker_thread_create(IGNORED_ARG, handle));
+    STRICT_EXPECTED_CALL(worker_thread_open(TEST_RETRY_WORKER))
+        .SetReturn(MU_FAILURE);
+    STRICT_EXPECTED_CALL(worker_thread_destroy(TEST_RETRY_WORKER));
+
+    ///act
+    int result = H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricZZZZ)(handle, TEST_TIMER_WHEEL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_IS_NULL(handle->timerWheel);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_085: [ If there are any failures then H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFABRIC_INTERFACE_NAME) shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(H_FABRIC_HANDLE_SET_TIMER_WHEEL_fails_when_creating_the_retry_worker_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(1, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_IS_NOT_NULL(handle);
+    umock_c_reset_all_calls();
+    STRICT_EXPECTED_CALL(worker_thread_create(IGNORED_ARG, handle))
+        .SetReturn(NULL);
+
+    ///act
+    int result = H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricZZZZ)(handle, TEST_TIMER_WHEEL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_IS_NULL(handle->timerWheel);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_038: [ If the circuit breaker of the handle rejects the call (h_fabric_circuit_breaker_enter) then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return H_FABRIC_E_CIRCUIT_BREAKER_OPEN without calling IFABRIC_METHOD_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_039: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall report the result of the call to the circuit breaker of the handle by calling h_fabric_circuit_breaker_exit. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_fails_fast_once_the_circuit_breaker_opened)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_circuit_breaker();
+    setup_DoSomethingAwesome_fails(TIME_START_OF_TIME);
+    setup_DoSomethingAwesome_fails(TIME_START_OF_TIME + 100);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_enter*/
+        .SetReturn(TIME_START_OF_TIME + 200);
+
+    ///act
+    HRESULT hr1 = H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT);
+    HRESULT hr2 = H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT);
+    HRESULT hr3 = H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_GATEWAY_NOT_REACHABLE, hr1);
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_GATEWAY_NOT_REACHABLE, hr2);
+    ASSERT_ARE_EQUAL(HRESULT, H_FABRIC_E_CIRCUIT_BREAKER_OPEN, hr3);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_039: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall report the result of the call to the circuit breaker of the handle by calling h_fabric_circuit_breaker_exit. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_closes_the_circuit_breaker_when_the_probe_succeeds)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_circuit_breaker();
+    open_circuit_breaker(handle);
+
+    /*the probe*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_enter*/
+        .SetReturn(TIME_START_OF_TIME + 110 + TIME_CIRCUIT_BREAKER_OPEN);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 110 + TIME_CIRCUIT_BREAKER_OPEN);
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_exit*/
+        .SetReturn(TIME_START_OF_TIME + 120 + TIME_CIRCUIT_BREAKER_OPEN);
+    /*the breaker is closed, the next call goes through*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 200 + TIME_CIRCUIT_BREAKER_OPEN);
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "b", TIME_TIMEOUT));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_exit*/
+        .SetReturn(TIME_START_OF_TIME + 210 + TIME_CIRCUIT_BREAKER_OPEN);
+
+    ///act
+    HRESULT hr1 = H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT);
+    HRESULT hr2 = H_FABRIC_API(DoSomethingAwesome)(handle, "b", TIME_TIMEOUT);
+
+    ///assert
+    ASSERT_IS_TRUE(SUCCEEDED(hr1));
+    ASSERT_IS_TRUE(SUCCEEDED(hr2));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_038: [ If the circuit breaker of the handle rejects the call (h_fabric_circuit_breaker_enter) then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return H_FABRIC_E_CIRCUIT_BREAKER_OPEN without calling IFABRIC_METHOD_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_039: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall report the result of the call to the circuit breaker of the handle by calling h_fabric_circuit_breaker_exit. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_reopens_the_circuit_breaker_when_the_probe_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_circuit_breaker();
+    open_circuit_breaker(handle);
+
+    /*the probe*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_enter*/
+        .SetReturn(TIME_START_OF_TIME + 110 + TIME_CIRCUIT_BREAKER_OPEN);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 110 + TIME_CIRCUIT_BREAKER_OPEN);
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 120 + TIME_CIRCUIT_BREAKER_OPEN);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_exit*/
+        .SetReturn(TIME_START_OF_TIME + 120 + TIME_CIRCUIT_BREAKER_OPEN);
+    /*the breaker is open again for TIME_CIRCUIT_BREAKER_OPEN*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_enter*/
+        .SetReturn(TIME_START_OF_TIME + 119 + 2 * TIME_CIRCUIT_BREAKER_OPEN);
+
+    ///act
+    HRESULT hr1 = H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT);
+    HRESULT hr2 = H_FABRIC_API(DoSomethingAwesome)(handle, "b", TIME_TIMEOUT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_TIMEOUT, hr1);
+    ASSERT_ARE_EQUAL(HRESULT, H_FABRIC_E_CIRCUIT_BREAKER_OPEN, hr2);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_040: [ If the circuit breaker of the handle rejects the call (h_fabric_circuit_breaker_enter) then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return H_FABRIC_E_CIRCUIT_BREAKER_OPEN without calling IFABRIC_METHOD_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_041: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall report the result of the call to the circuit breaker of the handle by calling h_fabric_circuit_breaker_exit. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_fails_fast_once_the_circuit_breaker_opened_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_circuit_breaker();
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
+            .SetReturn(E_ABORT);
+        STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+        STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+        STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+        STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+        STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_exit*/
+            .SetReturn(TIME_START_OF_TIME + i * 100);
+    }
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_enter*/
+        .SetReturn(TIME_START_OF_TIME + 200);
+
+    ///act
+    HRESULT hr1 = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(handle, "a");
+    HRESULT hr2 = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(handle, "a");
+    HRESULT hr3 = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(handle, "a");
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_ABORT, hr1);
+    ASSERT_ARE_EQUAL(HRESULT, E_ABORT, hr2);
+    ASSERT_ARE_EQUAL(HRESULT, H_FABRIC_E_CIRCUIT_BREAKER_OPEN, hr3);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/* H_FABRIC_DEFINE_API_NO_SF_TIMEOUT */
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_001: [ If handle is NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return NULL. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_with_handle_NULL_fails_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(NULL, "a");
+
+    ///assert
+    ASSERT_IS_TRUE(FAILED(hr));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_002: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall call IFABRIC_METHOD_NAME on the instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_003: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_018: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall take a reference on the current instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_acquire. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_019: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once IFABRIC_METHOD_NAME returned. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0); /*0 retries*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+
+    ///assert
+    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_004: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_006: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the new instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_003: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_ABORT_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
+        .SetReturn(E_ABORT);
+    /*because of E_ABORT the object is recreated*/
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+
+    ///assert
+    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_004: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_006: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the new instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_003: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_GATEWAY_NOT_REACHABLE_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
+        .SetReturn(FABRIC_E_GATEWAY_NOT_REACHABLE);
+    /*because of E_ABORT the object is recreated*/
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+
+    ///assert
+    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_004: [ If the result is FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall replace the instance of IFABRIC_INTERFACE_NAME that failed by calling h_fabric_client_holder_recreate. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_006: [ Otherwise H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the new instance of IFABRIC_INTERFACE_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_008: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_003: [ If the call succeeds then H_FABRIC_API(IFABRIC_METHOD_NAME) shall succeed and return. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_OBJECT_CLOSED_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
+        .SetReturn(FABRIC_E_OBJECT_CLOSED);
+    /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+
+    ///assert
+    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_005: [ If creating the new instance of IFABRIC_INTERFACE_NAME fails then H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry using the existing IFABRIC_INTERFACE_NAME. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_FABRIC_E_OBJECT_CLOSED_and_object_creation_fails_reuses_old_object_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
+        .SetReturn(FABRIC_E_OBJECT_CLOSED);
+    /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG))
+        .SetReturn(E_FAIL); /*... and re-creation fails so old object is used anyway*/
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+
+    ///assert
+    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_007: [ If the result is any other value except FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE or E_ABORT then H_FABRIC_API(IFABRIC_METHOD_NAME) shall retry. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_FAIL_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
+        .SetReturn(E_FAIL);
+    /*because of E_FAIL the object is NOT recreated*/
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+
+    ///assert
+    ASSERT_IS_TRUE(SUCCEEDED(hr));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_009: [ If h_fabric_retry_policy_get_next_delay returns false then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the last error code. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_FABRIC_E_OBJECT_CLOSED_after_2_tries_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(2, TIME_MS_BETWEEN_RETRIES); /*2 tries, 0.1 s between retries*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    for (int retries = 1; retries <= 2; retries++)
+    {
+        STRICT_EXPECTED_CALL(DoSomethingAwesomeNoSFTimeout(IGNORED_ARG, "a"))
+            .SetReturn(FABRIC_E_OBJECT_CLOSED);
+        /*because of FABRIC_E_OBJECT_CLOSED the object is recreated*/
+        STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+        STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+        STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+        STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+        if (retries < 2)
+        {
+            /*no sleep after the last try*/
+            STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+        }
+    }
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesomeNoSFTimeout)(result, "a");
+
+    ///assert
+    ASSERT_IS_TRUE(hr == FABRIC_E_OBJECT_CLOSED);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_42_002: [ If the result is any value from permanent_failures then H_FABRIC_API(IFABRIC_METHOD_NAME) shall return. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_after_1_retry_with_FABRIC_E_NAME_NOT_EMPTY_which_is_permanent_failure_for_H_FABRIC_DEFINE_API_NO_SF_TIMEOUT)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) result = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES); /*3 retries, 0.1 s between retries*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(DoSomethingWithPossibleFailuresNoSFTimeout(IGNORED_ARG, "a"))
+        .SetReturn(E_ACCESSDENIED);
+    /*because of E_ACCESSDENIED retry as-is*/
+    STRICT_EXPECTED_CALL(ThreadAPI_Sleep(TIME_MS_BETWEEN_RETRIES));
+    /*does not cause retry*/
+    STRICT_EXPECTED_CALL(DoSomethingWithPossibleFailuresNoSFTimeout(IGNORED_ARG, "a"))
+        .SetReturn(FABRIC_E_NAME_NOT_EMPTY);
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingWithPossibleFailuresNoSFTimeout)(result, "a");
+
+    ///assert
+    ASSERT_IS_TRUE(hr == FABRIC_E_NAME_NOT_EMPTY);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(result);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_021: [ If handle is NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return E_POINTER. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_with_handle_NULL_fails_for_H_FABRIC_DEFINE_API_SINGLE_FLIGHT)
+{
+    ///arrange
+    IUnknown* result;
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingShared)(NULL, "a", TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, E_POINTER, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_022: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall build the key of the call by calling h_fabric_single_flight_key_init and key_function. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_023: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall join the call in flight of IFABRIC_METHOD_NAME with the same key by calling h_fabric_single_flight_join. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_025: [ If the caller is the leader then H_FABRIC_API(IFABRIC_METHOD_NAME) shall execute the call with retries and timeout. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_026: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall share the result of the call with the callers that joined it by calling h_fabric_single_flight_complete. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_029: [ H_FABRIC_HANDLE_CREATE_POOLED(IFABRIC_INTERFACE_NAME) shall initialize the single flight group of the handle by calling h_fabric_single_flight_init. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_as_leader_succeeds_for_H_FABRIC_DEFINE_API_SINGLE_FLIGHT)
+{
+    ///arrange
+    IUnknown* result;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG)); /*the call in flight, the key is "a"*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(DoSomethingShared(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(&test_result_ptr, sizeof(test_result_ptr));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result)); /*the call holds the result for the threads that joined*/
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result)); /*nobody joined*/
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingShared)(handle, "a", TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_026: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall share the result of the call with the callers that joined it by calling h_fabric_single_flight_complete. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_as_leader_shares_failures_for_H_FABRIC_DEFINE_API_SINGLE_FLIGHT)
+{
+    ///arrange
+    IUnknown* result;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(DoSomethingShared(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_SERVICE_DOES_NOT_EXIST);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_TIMEOUT);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingShared)(handle, "a", TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, FABRIC_E_SERVICE_DOES_NOT_EXIST, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_024: [ If h_fabric_single_flight_join returns NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall execute the call with retries and timeout by itself. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_executes_by_itself_when_the_key_cannot_be_coalesced_for_H_FABRIC_DEFINE_API_SINGLE_FLIGHT)
+{
+    ///arrange
+    IUnknown* result;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(DoSomethingShared(IGNORED_ARG, NULL, TIME_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(&test_result_ptr, sizeof(test_result_ptr));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingShared)(handle, NULL, TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_024: [ If h_fabric_single_flight_join returns NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall execute the call with retries and timeout by itself. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_executes_by_itself_when_joining_fails_for_H_FABRIC_DEFINE_API_SINGLE_FLIGHT)
+{
+    ///arrange
+    IUnknown* result;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG))
+        .SetReturn(NULL);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(DoSomethingShared(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(&test_result_ptr, sizeof(test_result_ptr));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingShared)(handle, "a", TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_043: [ If handle is NULL then H_FABRIC_API(IFABRIC_METHOD_NAME) shall fail and return E_POINTER. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_with_handle_NULL_fails_for_H_FABRIC_DEFINE_API_HEDGED)
+{
+    ///arrange
+    IUnknown* result;
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingHedged)(NULL, "a", TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, E_POINTER, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_044: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall execute the call with retries and timeout by calling h_fabric_hedge_execute with the hedging configuration, the timer wheel and the threadpool of the handle and the latencies of IFABRIC_METHOD_NAME. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_045: [ On success H_FABRIC_API(IFABRIC_METHOD_NAME) shall return the result of the call that succeeded first in result_name. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_without_hedging_succeeds_for_H_FABRIC_DEFINE_API_HEDGED)
+{
+    ///arrange
+    IUnknown* result;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    /*hedging is off by default, the call runs on the calling thread*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(DoSomethingHedged(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(&test_result_ptr, sizeof(test_result_ptr));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingHedged)(handle, "a", TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_044: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall execute the call with retries and timeout by calling h_fabric_hedge_execute with the hedging configuration, the timer wheel and the threadpool of the handle and the latencies of IFABRIC_METHOD_NAME. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_with_hedging_and_few_latencies_records_the_latency_for_H_FABRIC_DEFINE_API_HEDGED)
+{
+    ///arrange
+    IUnknown* result;
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 1, TIME_MS_BETWEEN_RETRIES));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFabricZZZZ)(&retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 95, UINT32_MAX, 10, TEST_THREADPOOL));
+    umock_c_reset_all_calls();
+
+    /*no latency of DoSomethingHedged can ever be enough, the call runs on the calling thread*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_hedge_execute*/
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(DoSomethingHedged(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(&test_result_ptr, sizeof(test_result_ptr));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*the latency of the call is recorded*/
+        .SetReturn(TIME_START_OF_TIME + 10);
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingHedged)(handle, "a", TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_044: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall execute the call with retries and timeout by calling h_fabric_hedge_execute with the hedging configuration, the timer wheel and the threadpool of the handle and the latencies of IFABRIC_METHOD_NAME. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_returns_the_failure_for_H_FABRIC_DEFINE_API_HEDGED)
+{
+    ///arrange
+    IUnknown* result = NULL;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(0, 0);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(DoSomethingHedged(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_SERVICE_DOES_NOT_EXIST);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_TIMEOUT);
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingHedged)(handle, "a", TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, FABRIC_E_SERVICE_DOES_NOT_EXIST, hr);
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_065: [ Every run of the call shall pick its client by calling h_fabric_client_pool_acquire_other with the client published by the first run, and the first run shall publish its client. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_090: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall count the call in the hedged calls of the handle until h_fabric_hedge_execute calls its on_done, which can be after H_FABRIC_API(IFABRIC_METHOD_NAME) returned. ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_runs_the_second_run_on_another_client_for_H_FABRIC_DEFINE_API_HEDGED)
+{
+    ///arrange
+    IUnknown* result;
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 1, TIME_MS_BETWEEN_RETRIES));
+    REGISTER_GLOBAL_MOCK_HOOK(DoSomethingHedged, hook_DoSomethingHedged);
+    captured_timer_callback = NULL;
+
+    /*a handle without timer wheel does not hedge, its call records the latency that the hedged call needs*/
+    H_FABRIC_HANDLE(IFabricZZZZ) handleWithoutTimerWheel = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFabricZZZZ)(&retryPolicy);
+    ASSERT_IS_NOT_NULL(handleWithoutTimerWheel);
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handleWithoutTimerWheel, 95, 1, 10, TEST_THREADPOOL));
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API(DoSomethingHedged)(handleWithoutTimerWheel, "a", TIME_TIMEOUT, &result));
+    ASSERT_IS_NULL(captured_timer_callback);
+
+    /*both runs happen on the calling thread, with THREAD_AFFINITY h_fabric_client_pool_acquire would give them the same client*/
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE_POOLED(IFabricZZZZ)(2, H_FABRIC_CLIENT_POOL_SELECTION_THREAD_AFFINITY, &retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_HEDGING(IFabricZZZZ)(handle, 95, 1, 10, TEST_THREADPOOL));
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricZZZZ)(handle, TEST_TIMER_WHEEL));
+    hedged_instance_count = 0;
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(IGNORED_ARG, TEST_THREADPOOL));
+    STRICT_EXPECTED_CALL(timer_wheel_timer_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*the first run*/
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(DoSomethingHedged(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*the timer fires while the first run is slow*/
+        .SetReturn(TIME_START_OF_TIME + 20);
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*the second run*/
+        .SetReturn(TIME_START_OF_TIME + 20);
+    STRICT_EXPECTED_CALL(DoSomethingHedged(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*the second run wins*/
+        .SetReturn(TIME_START_OF_TIME + 30);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*the first run completes late*/
+        .SetReturn(TIME_START_OF_TIME + 40);
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result));
+    STRICT_EXPECTED_CALL(timer_wheel_cancel(TEST_TIMER_WHEEL, IGNORED_ARG))
+        .SetReturn(false);
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingHedged)(handle, "a", TIME_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result, result);
+    ASSERT_ARE_EQUAL(uint32_t, 2, hedged_instance_count);
+    ASSERT_ARE_NOT_EQUAL(void_ptr, hedged_instances[0], hedged_instances[1]);
+    ASSERT_ARE_EQUAL(int32_t, 0, interlocked_add(&handle->hedgedCalls, 0)); /*both runs are done*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    REGISTER_GLOBAL_MOCK_HOOK(DoSomethingHedged, NULL);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handleWithoutTimerWheel);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_042: [ If the call failed and the cancellation of the calling thread was cancelled (servicefabric_dox_cancellation_is_current_cancelled) then H_FABRIC_API(IFABRIC_METHOD_NAME) shall stop retrying and return HRESULT_FROM_WIN32(ERROR_CANCELLED). ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_stops_retrying_when_cancelled)
+{
+    ///arrange
+    SERVICEFABRIC_DOX_CANCELLATION cancellation;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(10, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    /*this thread runs the attempt of a hedged call that lost*/
+    servicefabric_dox_cancellation_init(&cancellation);
+    servicefabric_dox_cancellation_set_current(&cancellation);
+    servicefabric_dox_cancellation_cancel(&cancellation);
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .SetReturn(E_ABORT);
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, HRESULT_FROM_WIN32(ERROR_CANCELLED), hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    servicefabric_dox_cancellation_set_current(NULL);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_02_015: [ H_FABRIC_API(IFABRIC_METHOD_NAME) shall sleep the delay returned by h_fabric_retry_policy_get_next_delay by calling servicefabric_dox_cancellation_sleep. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_087: [ If the cancellation of the calling thread is cancelled while H_FABRIC_API(IFABRIC_METHOD_NAME) sleeps then H_FABRIC_API(IFABRIC_METHOD_NAME) shall stop retrying and return HRESULT_FROM_WIN32(ERROR_CANCELLED). ]*/
+TEST_FUNCTION(H_FABRIC_API_IFABRIC_METHOD_NAME_stops_retrying_when_cancelled_while_it_sleeps)
+{
+    ///arrange
+    SERVICEFABRIC_DOX_CANCELLATION cancellation;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(10, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    /*this thread runs the attempt of a hedged call, the other attempt wins after the first try failed*/
+    servicefabric_dox_cancellation_init(&cancellation);
+    servicefabric_dox_cancellation_set_current(&cancellation);
+    test_cancellation_to_cancel = &cancellation;
+    test_elapsed_ms_calls = 0;
+    REGISTER_GLOBAL_MOCK_HOOK(timer_global_get_elapsed_ms, hook_timer_global_get_elapsed_ms_cancels);
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(DoSomethingAwesome(IGNORED_ARG, "a", TIME_TIMEOUT))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()); /*cancels*/
+
+    ///act
+    HRESULT hr = H_FABRIC_API(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, HRESULT_FROM_WIN32(ERROR_CANCELLED), hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls()); /*no ThreadAPI_Sleep and no second try*/
+
+    ///clean
+    REGISTER_GLOBAL_MOCK_HOOK(timer_global_get_elapsed_ms, NULL);
+    servicefabric_dox_cancellation_set_current(NULL);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_046: [ If handle is NULL then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall fail and return E_POINTER. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_with_handle_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    HRESULT hr = H_FABRIC_API_ASYNC(DoSomethingAwesome)(NULL, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, E_POINTER, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_047: [ If on_complete is NULL then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_with_on_complete_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+
+    ///act
+    HRESULT hr = H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, NULL, TEST_ON_COMPLETE_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_048: [ If the handle has no timer wheel then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall fail and return HRESULT_FROM_WIN32(ERROR_INVALID_STATE). ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_without_timer_wheel_fails)
+{
+    ///arrange
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE(IFabricZZZZ)(3, TIME_MS_BETWEEN_RETRIES);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///act
+    HRESULT hr = H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, HRESULT_FROM_WIN32(ERROR_INVALID_STATE), hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_049: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall allocate the state of the call. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_050: [ If allocating the state of the call fails then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall fail and return E_OUTOFMEMORY. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_when_malloc_fails_it_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG))
+        .SetReturn(NULL);
+
+    ///act
+    HRESULT hr = H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, E_OUTOFMEMORY, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_051: [ If the circuit breaker of the handle rejects the call (h_fabric_circuit_breaker_enter) then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall free the state of the call, fail and return H_FABRIC_E_CIRCUIT_BREAKER_OPEN. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_fails_fast_once_the_circuit_breaker_opened)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY retryPolicy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&retryPolicy, 1, TIME_MS_BETWEEN_RETRIES));
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = H_FABRIC_HANDLE_CREATE_WITH_RETRY_POLICY(IFabricZZZZ)(&retryPolicy);
+    ASSERT_IS_NOT_NULL(handle);
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_CIRCUIT_BREAKER(IFabricZZZZ)(handle, 100, 2, 60000, TIME_CIRCUIT_BREAKER_OPEN));
+    ASSERT_ARE_EQUAL(int, 0, H_FABRIC_HANDLE_SET_TIMER_WHEEL(IFabricZZZZ)(handle, TEST_TIMER_WHEEL));
+    umock_c_reset_all_calls();
+    open_circuit_breaker(handle);
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms()) /*h_fabric_circuit_breaker_enter*/
+        .SetReturn(TIME_START_OF_TIME + 200);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, H_FABRIC_E_CIRCUIT_BREAKER_OPEN, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_052: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall copy the inputs in the state of the call, record the start time by calling timer_global_get_elapsed_ms, initialize the timer of the call by calling timer_wheel_timer_init and pick the client that runs the call by calling h_fabric_client_pool_acquire. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_053: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall start the first try and return S_OK, on_complete is called when the call completes. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_054: [ To start a try H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall take a reference on the current instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_acquire and call MU_C2(IFABRIC_METHOD_NAME, _async) on it. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_starts_the_first_try_and_returns)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+
+    ///act
+    HRESULT hr = H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    captured_on_complete(captured_on_complete_context, S_OK);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_064: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall make the timer wheel of the handle current by calling servicefabric_dox_cancellation_set_current_timer_wheel while it calls MU_C2(IFABRIC_METHOD_NAME, _async), so the try gets a deadline, and restore the previous one afterwards. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_starts_the_try_with_the_timer_wheel_of_the_handle_current)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    captured_current_timer_wheel = NULL;
+    setup_DoSomethingAwesome_async_starts();
+
+    ///act
+    HRESULT hr = H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(void_ptr, TEST_TIMER_WHEEL, captured_current_timer_wheel);
+    ASSERT_IS_NULL(servicefabric_dox_cancellation_get_current_timer_wheel());
+
+    ///clean
+    captured_on_complete(captured_on_complete_context, S_OK);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_057: [ If the try succeeded or completed with any value from permanent_failures then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall complete the call with that result. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_058: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall give back the reference on the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_release once the try completed, unless it keeps it to re-create the instance. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_063: [ Once it stopped retrying, H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall give back the client by calling h_fabric_client_pool_release, report the result to the circuit breaker of the handle by calling h_fabric_circuit_breaker_exit, free the state of the call and call on_complete with on_complete_context and the result. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_completes_when_the_try_succeeds)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_on_complete(TEST_ON_COMPLETE_CONTEXT, S_OK));
+
+    ///act
+    captured_on_complete(captured_on_complete_context, S_OK);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_060: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall call h_fabric_retry_policy_get_next_delay with the retry policy of the handle and the time left until timeoutMilliseconds, and if it returns false complete the call with the last error code. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_061: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall start the next try once the delay elapsed by calling timer_wheel_schedule with the timer wheel of the handle. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_succeeds_after_1_retry_with_E_FAIL)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    /*no thread sleeps: the retry is a timer*/
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 10);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, TIME_MS_BETWEEN_RETRIES, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(worker_thread_schedule_process(TEST_RETRY_WORKER));
+    STRICT_EXPECTED_CALL(DoSomethingAwesome_async(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_on_complete(TEST_ON_COMPLETE_CONTEXT, S_OK));
+
+    ///act
+    captured_on_complete(captured_on_complete_context, E_FAIL);
+    captured_timer_callback(captured_timer_callback_context, false);
+    captured_on_complete(captured_on_complete_context, S_OK);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_055: [ If MU_C2(IFABRIC_METHOD_NAME, _async) fails then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall handle it as a try that completed with that result. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_retries_when_starting_the_try_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(timer_wheel_timer_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoSomethingAwesome_async(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(E_FAIL);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, TIME_MS_BETWEEN_RETRIES, IGNORED_ARG, IGNORED_ARG));
+
+    ///act
+    HRESULT hr = H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    captured_timer_callback(captured_timer_callback_context, false);
+    captured_on_complete(captured_on_complete_context, S_OK);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_056: [ If the try completed with FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall keep the reference on the instance of IFABRIC_INTERFACE_NAME and retry. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_with_FABRIC_E_OBJECT_CLOSED_retries_without_recreating_the_instance_on_the_completion_thread)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 10);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, TIME_MS_BETWEEN_RETRIES, IGNORED_ARG, IGNORED_ARG));
+
+    ///act
+    captured_on_complete(captured_on_complete_context, FABRIC_E_OBJECT_CLOSED);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    captured_timer_callback(captured_timer_callback_context, false);
+    captured_on_complete(captured_on_complete_context, S_OK);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_081: [ When the delay before the next try elapsed (or the timer wheel was destroyed), H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall only queue the call on the retry worker of the handle and call worker_thread_schedule_process, the retry worker continues the call. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_066: [ When the delay before the next try elapsed, if the previous try completed with FABRIC_E_OBJECT_CLOSED, FABRIC_E_GATEWAY_NOT_REACHABLE, FABRIC_E_TIMEOUT or E_ABORT then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall re-create the instance of IFABRIC_INTERFACE_NAME by calling h_fabric_client_holder_recreate and give back the reference on the instance that failed by calling h_fabric_client_holder_release before starting the try. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_with_FABRIC_E_OBJECT_CLOSED_recreates_the_instance_on_the_retry_worker)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 10);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, TIME_MS_BETWEEN_RETRIES, IGNORED_ARG, IGNORED_ARG));
+    captured_on_complete(captured_on_complete_context, FABRIC_E_OBJECT_CLOSED);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(worker_thread_schedule_process(TEST_RETRY_WORKER));
+    STRICT_EXPECTED_CALL(CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ)(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoNothingRelease(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoSomethingAwesome_async(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG, IGNORED_ARG));
+
+    ///act
+    captured_timer_callback(captured_timer_callback_context, false);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    captured_on_complete(captured_on_complete_context, S_OK);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_068: [ If the timer wheel of the handle is destroyed before the next try started then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall complete the call with the last error code. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_completes_with_the_last_error_when_the_timer_wheel_is_destroyed_before_the_next_try)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 10);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, TIME_MS_BETWEEN_RETRIES, IGNORED_ARG, IGNORED_ARG));
+    captured_on_complete(captured_on_complete_context, FABRIC_E_OBJECT_CLOSED);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    /*no try starts and the instance is not re-created*/
+    STRICT_EXPECTED_CALL(worker_thread_schedule_process(TEST_RETRY_WORKER));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_on_complete(TEST_ON_COMPLETE_CONTEXT, FABRIC_E_OBJECT_CLOSED));
+
+    ///act
+    captured_timer_callback(captured_timer_callback_context, true);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_082: [ If worker_thread_schedule_process fails then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall run the queued calls of the handle on the thread of the timer wheel. ]*/
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_083: [ The retry worker of the handle shall take all the queued calls out of the queue of the handle, continue them in the order they were queued and look at the queue again, until it is empty. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_starts_the_next_try_on_the_timer_thread_when_the_retry_worker_cannot_be_scheduled)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 10);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, TIME_MS_BETWEEN_RETRIES, IGNORED_ARG, IGNORED_ARG));
+    captured_on_complete(captured_on_complete_context, E_FAIL);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(worker_thread_schedule_process(TEST_RETRY_WORKER))
+        .SetReturn(WORKER_THREAD_SCHEDULE_PROCESS_ERROR);
+    STRICT_EXPECTED_CALL(DoSomethingAwesome_async(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG, IGNORED_ARG));
+
+    ///act
+    captured_timer_callback(captured_timer_callback_context, false);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(handle->retryQueue);
+
+    ///clean
+    captured_on_complete(captured_on_complete_context, S_OK);
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_067: [ If the instance that failed was not re-created yet then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall give back the reference on it by calling h_fabric_client_holder_release without re-creating it. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_with_FABRIC_E_OBJECT_CLOSED_after_timeoutMilliseconds_completes_without_recreating_the_instance)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + TIME_TIMEOUT);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_on_complete(TEST_ON_COMPLETE_CONTEXT, FABRIC_E_OBJECT_CLOSED));
+
+    ///act
+    captured_on_complete(captured_on_complete_context, FABRIC_E_OBJECT_CLOSED);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_057: [ If the try succeeded or completed with any value from permanent_failures then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall complete the call with that result. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_completes_with_a_permanent_failure_without_retrying)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME);
+    STRICT_EXPECTED_CALL(timer_wheel_timer_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(DoSomethingWithPossibleFailures_async(IGNORED_ARG, "a", TIME_TIMEOUT, IGNORED_ARG, IGNORED_ARG));
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingWithPossibleFailures)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_on_complete(TEST_ON_COMPLETE_CONTEXT, FABRIC_E_INVALID_ADDRESS));
+
+    ///act
+    captured_on_complete(captured_on_complete_context, FABRIC_E_INVALID_ADDRESS);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_059: [ If the total time spent retrying exceeds timeoutMilliseconds then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall complete the call with the last error code. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_completes_with_the_last_error_after_timeoutMilliseconds)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + TIME_TIMEOUT);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_on_complete(TEST_ON_COMPLETE_CONTEXT, E_FAIL));
+
+    ///act
+    captured_on_complete(captured_on_complete_context, E_FAIL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_060: [ H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall call h_fabric_retry_policy_get_next_delay with the retry policy of the handle and the time left until timeoutMilliseconds, and if it returns false complete the call with the last error code. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_completes_with_the_last_error_when_the_retry_policy_stops)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(1);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 10);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_on_complete(TEST_ON_COMPLETE_CONTEXT, E_FAIL));
+
+    ///act
+    captured_on_complete(captured_on_complete_context, E_FAIL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
+}
+
+/*Tests_SRS_H_FABRIC_MACRO_GENERATOR_01_062: [ If timer_wheel_schedule fails then H_FABRIC_API_ASYNC(IFABRIC_METHOD_NAME) shall complete the call with the last error code. ]*/
+TEST_FUNCTION(H_FABRIC_API_ASYNC_IFABRIC_METHOD_NAME_completes_with_the_last_error_when_timer_wheel_schedule_fails)
+{
+    ///arrange
+    H_FABRIC_HANDLE(IFabricZZZZ) handle = create_handle_with_timer_wheel(3);
+    setup_DoSomethingAwesome_async_starts();
+    ASSERT_ARE_EQUAL(int, S_OK, H_FABRIC_API_ASYNC(DoSomethingAwesome)(handle, "a", TIME_TIMEOUT, test_on_complete, TEST_ON_COMPLETE_CONTEXT));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .SetReturn(TIME_START_OF_TIME + 10);
+    STRICT_EXPECTED_CALL(timer_wheel_schedule(TEST_TIMER_WHEEL, IGNORED_ARG, TIME_MS_BETWEEN_RETRIES, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(MU_FAILURE);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_on_complete(TEST_ON_COMPLETE_CONTEXT, E_FAIL));
+
+    ///act
+    captured_on_complete(captured_on_complete_context, E_FAIL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    H_FABRIC_HANDLE_DESTROY(IFabricZZZZ)(handle);
 }
 
 END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
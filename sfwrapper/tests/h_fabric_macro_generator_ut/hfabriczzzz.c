@@ -1,5 +1,7 @@
 // Copyright (c) Microsoft. All rights reserved.
 
+#include <string.h>
+
 #include "windows.h"
 
 #include "ifabriczzzz.h"
@@ -39,3 +41,52 @@ H_FABRIC_DEFINE_API_NO_SF_TIMEOUT_WITH_RESULTS(IFabricZZZZ, DoSomethingWithPossi
     ),
     RESULTS(FABRIC_E_NAME_NOT_EMPTY)
 )
+
+/*NULL queryDescription is something that cannot be coalesced*/
+static void DoSomethingShared_key(H_FABRIC_SINGLE_FLIGHT_KEY* key, const char* queryDescription, DWORD timeoutMilliseconds, IUnknown** result)
+{
+    (void)timeoutMilliseconds;
+    (void)result;
+    if (queryDescription == NULL)
+    {
+        h_fabric_single_flight_key_disable(key);
+    }
+    else
+    {
+        h_fabric_single_flight_key_add(key, queryDescription, strlen(queryDescription));
+    }
+}
+
+H_FABRIC_DEFINE_API_SINGLE_FLIGHT(IFabricZZZZ, DoSomethingShared,
+    IN_ARGS(
+        ARG(const char*, queryDescription),
+        ARG(DWORD, timeoutMilliseconds),
+        ARG(IUnknown**, result)
+    ),
+    DoSomethingShared_key,
+    result
+)
+
+H_FABRIC_DEFINE_API_HEDGED(IFabricZZZZ, DoSomethingHedged,
+    IN_ARGS(
+        ARG(const char*, queryDescription),
+        ARG(DWORD, timeoutMilliseconds),
+        ARG(IUnknown**, result)
+    ),
+    result
+)
+
+H_FABRIC_DEFINE_API_ASYNC(IFabricZZZZ, DoSomethingAwesome,
+    IN_ARGS(
+        ARG(const char*, queryDescription),
+        ARG(DWORD, timeoutMilliseconds)
+    )
+)
+
+H_FABRIC_DEFINE_API_ASYNC_WITH_RESULTS(IFabricZZZZ, DoSomethingWithPossibleFailures,
+    IN_ARGS(
+        ARG(const char*, queryDescription),
+        ARG(DWORD, timeoutMilliseconds)
+    ),
+    RESULTS(FABRIC_E_INVALID_ADDRESS, FABRIC_E_INVALID_NAME_URI)
+)
@@ -49,6 +49,36 @@ extern "C" {
         )
     )
 
+    H_FABRIC_DECLARE_API(IFabricZZZZ, DoSomethingShared,
+        IN_ARGS(
+            ARG(const char*, queryDescription),
+            ARG(DWORD, timeoutMilliseconds),
+            ARG(IUnknown**, result)
+        )
+    )
+
+    H_FABRIC_DECLARE_API(IFabricZZZZ, DoSomethingHedged,
+        IN_ARGS(
+            ARG(const char*, queryDescription),
+            ARG(DWORD, timeoutMilliseconds),
+            ARG(IUnknown**, result)
+        )
+    )
+
+    H_FABRIC_DECLARE_API_ASYNC(IFabricZZZZ, DoSomethingAwesome,
+        IN_ARGS(
+            ARG(const char*, queryDescription),
+            ARG(DWORD, timeoutMilliseconds)
+        )
+    )
+
+    H_FABRIC_DECLARE_API_ASYNC(IFabricZZZZ, DoSomethingWithPossibleFailures,
+        IN_ARGS(
+            ARG(const char*, queryDescription),
+            ARG(DWORD, timeoutMilliseconds)
+        )
+    )
+
 #ifdef __cplusplus
 }
 #endif
@@ -35,6 +35,20 @@ typedef struct IFabricZZZZVtbl
         /* [in] */ const char* queryDescription
         );
 
+    HRESULT(STDMETHODCALLTYPE* DoSomethingShared)(
+        IFabricZZZZ* This,
+        /* [in] */ const char* queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IUnknown** result
+        );
+
+    HRESULT(STDMETHODCALLTYPE* DoSomethingHedged)(
+        IFabricZZZZ* This,
+        /* [in] */ const char* queryDescription,
+        /* [in] */ DWORD timeoutMilliseconds,
+        /* [retval][out] */ IUnknown** result
+        );
+
 } IFabricZZZZVtbl;
 
 struct IFabricZZZZ
@@ -36,6 +36,37 @@ extern "C" {
         /* [in] */ const char*, queryDescription
         );
 
+    MOCKABLE_FUNCTION(, HRESULT, DoSomethingShared,
+        IFabricZZZZ*, This,
+        /* [in] */ const char*, queryDescription,
+        /* [in] */ DWORD, timeoutMilliseconds,
+        /* [retval][out] */ IUnknown**, result
+        );
+
+    MOCKABLE_FUNCTION(, HRESULT, DoSomethingHedged,
+        IFabricZZZZ*, This,
+        /* [in] */ const char*, queryDescription,
+        /* [in] */ DWORD, timeoutMilliseconds,
+        /* [retval][out] */ IUnknown**, result
+        );
+
+    /*the _async functions of the sync layer, they are not methods of the COM interface*/
+    MOCKABLE_FUNCTION(, HRESULT, DoSomethingAwesome_async,
+        IFabricZZZZ*, This,
+        /* [in] */ const char*, queryDescription,
+        /* [in] */ DWORD, timeoutMilliseconds,
+        SERVICEFABRIC_DOX_ON_COMPLETE, on_complete,
+        void*, on_complete_context
+        );
+
+    MOCKABLE_FUNCTION(, HRESULT, DoSomethingWithPossibleFailures_async,
+        IFabricZZZZ*, This,
+        /* [in] */ const char*, queryDescription,
+        /* [in] */ DWORD, timeoutMilliseconds,
+        SERVICEFABRIC_DOX_ON_COMPLETE, on_complete,
+        void*, on_complete_context
+        );
+
     MOCKABLE_FUNCTION(, HRESULT, CREATE_IFABRICINSTANCE_NAME(IFabricZZZZ), IFabricZZZZ**, fabricVariable);
 
 #ifdef __cplusplus
@@ -0,0 +1,1036 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <wchar.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umocktypes_wcharptr.h"
+#include "umock_c/umocktypes_windows.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+
+#include "hfabricqueryclient10.h"
+#include "servicefabricdox_cancellation.h"
+
+MOCKABLE_FUNCTION(, ULONG, test_application_type_page_Release, IFabricGetApplicationTypePagedListResult*, This);
+MOCKABLE_FUNCTION(, ULONG, test_deployed_application_page_Release, IFabricGetDeployedApplicationPagedListResult*, This);
+MOCKABLE_FUNCTION(, ULONG, test_node_page_Release, IFabricGetNodeListResult2*, This);
+MOCKABLE_FUNCTION(, ULONG, test_service_page_Release, IFabricGetServiceListResult2*, This);
+MOCKABLE_FUNCTION(, ULONG, test_partition_page_Release, IFabricGetPartitionListResult2*, This);
+MOCKABLE_FUNCTION(, ULONG, test_replica_page_Release, IFabricGetReplicaListResult2*, This);
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "h_fabric_paged_query_iterator.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT_VALUES);
+
+#define TEST_TIMEOUT 1000
+#define TEST_TOKEN_1 L"token_1"
+#define TEST_TOKEN_2 L"token_2"
+
+static H_FABRIC_HANDLE(IFabricQueryClient10) test_client = (H_FABRIC_HANDLE(IFabricQueryClient10))0x4242;
+#define TEST_THREADPOOL ((THANDLE(THREADPOOL))0x4243)
+
+/*a fake page of every query: the COM object first, then what it hands out. Only Release is a mock, the getters just return the data*/
+#define DEFINE_TEST_PAGE(name, result_interface, list_type, item_type, get_list)                              \
+typedef struct MU_C3(TEST_, name, _PAGE_TAG)                                                                  \
+{                                                                                                             \
+    result_interface page;                                                                                    \
+    list_type list;                                                                                           \
+    item_type items[2];                                                                                       \
+    FABRIC_PAGING_STATUS paging_status;                                                                       \
+} MU_C3(TEST_, name, _PAGE);                                                                                  \
+                                                                                                              \
+static const list_type* MU_C3(test_, name, _page_get_list)(result_interface* This)                            \
+{                                                                                                             \
+    return &((MU_C3(TEST_, name, _PAGE)*)This)->list;                                                         \
+}                                                                                                             \
+                                                                                                              \
+static const FABRIC_PAGING_STATUS* MU_C3(test_, name, _page_get_PagingStatus)(result_interface* This)         \
+{                                                                                                             \
+    return &((MU_C3(TEST_, name, _PAGE)*)This)->paging_status;                                                \
+}                                                                                                             \
+                                                                                                              \
+static MU_C2(result_interface, Vtbl) MU_C3(test_, name, _page_vtbl) =                                         \
+{                                                                                                             \
+    .Release = MU_C3(test_, name, _page_Release),                                                             \
+    .get_list = MU_C3(test_, name, _page_get_list),                                                           \
+    .get_PagingStatus = MU_C3(test_, name, _page_get_PagingStatus)                                            \
+};                                                                                                            \
+                                                                                                              \
+static void MU_C3(test_, name, _page_init)(MU_C3(TEST_, name, _PAGE)* test_page, ULONG count, LPCWSTR token)  \
+{                                                                                                             \
+    (void)memset(test_page, 0, sizeof(*test_page));                                                           \
+    test_page->page.lpVtbl = &MU_C3(test_, name, _page_vtbl);                                                 \
+    test_page->list.Count = count;                                                                            \
+    test_page->list.Items = test_page->items;                                                                 \
+    test_page->paging_status.ContinuationToken = token;                                                       \
+}
+
+DEFINE_TEST_PAGE(application_type, IFabricGetApplicationTypePagedListResult, FABRIC_APPLICATION_TYPE_QUERY_RESULT_LIST, FABRIC_APPLICATION_TYPE_QUERY_RESULT_ITEM, get_ApplicationTypePagedList)
+DEFINE_TEST_PAGE(deployed_application, IFabricGetDeployedApplicationPagedListResult, FABRIC_DEPLOYED_APPLICATION_QUERY_RESULT_LIST, FABRIC_DEPLOYED_APPLICATION_QUERY_RESULT_ITEM, get_DeployedApplicationPagedList)
+DEFINE_TEST_PAGE(node, IFabricGetNodeListResult2, FABRIC_NODE_QUERY_RESULT_LIST, FABRIC_NODE_QUERY_RESULT_ITEM, get_NodeList)
+DEFINE_TEST_PAGE(service, IFabricGetServiceListResult2, FABRIC_SERVICE_QUERY_RESULT_LIST, FABRIC_SERVICE_QUERY_RESULT_ITEM, get_ServiceList)
+DEFINE_TEST_PAGE(partition, IFabricGetPartitionListResult2, FABRIC_SERVICE_PARTITION_QUERY_RESULT_LIST, FABRIC_SERVICE_PARTITION_QUERY_RESULT_ITEM, get_PartitionList)
+DEFINE_TEST_PAGE(replica, IFabricGetReplicaListResult2, FABRIC_SERVICE_REPLICA_QUERY_RESULT_LIST, FABRIC_SERVICE_REPLICA_QUERY_RESULT_ITEM, get_ReplicaList)
+
+/*the pages the query hooks hand out in order, and the continuation token each call was made with*/
+static void* test_pages[3];
+static size_t test_page_index;
+static LPCWSTR test_seen_tokens[3];
+static DWORD test_seen_replica_status_filter;
+static LONG test_seen_max_results;
+
+/*THANDLE(THREADPOOL) is mocked, the iterator still needs to hold the threadpool it is given*/
+static void hook_THANDLE_INITIALIZE_THREADPOOL(THANDLE(THREADPOOL)* t1, THANDLE(THREADPOOL) t2)
+{
+    *(THREADPOOL const**)t1 = t2;
+}
+
+static void hook_THANDLE_ASSIGN_THREADPOOL(THANDLE(THREADPOOL)* t1, THANDLE(THREADPOOL) t2)
+{
+    *(THREADPOOL const**)t1 = t2;
+}
+
+/*the scheduled prefetch runs when the test runs it or when the iterator waits for it, that is when the page is needed*/
+static THREADPOOL_WORK_FUNCTION captured_work_function;
+static void* captured_work_function_context;
+
+static void test_run_prefetch_work(void)
+{
+    THREADPOOL_WORK_FUNCTION work_function = captured_work_function;
+    captured_work_function = NULL;
+    work_function(captured_work_function_context);
+}
+
+static int hook_threadpool_schedule_work(THANDLE(THREADPOOL) threadpool, THREADPOOL_WORK_FUNCTION work_function, void* work_function_context)
+{
+    (void)threadpool;
+    captured_work_function = work_function;
+    captured_work_function_context = work_function_context;
+    return 0;
+}
+
+static INTERLOCKED_HL_RESULT hook_InterlockedHL_WaitForValue_runs_the_prefetch(int32_t volatile_atomic* address_to_check, int32_t value_to_wait, uint32_t timeout_ms)
+{
+    (void)address_to_check;
+    (void)value_to_wait;
+    (void)timeout_ms;
+    if (captured_work_function != NULL)
+    {
+        test_run_prefetch_work();
+    }
+    return INTERLOCKED_HL_OK;
+}
+
+static HRESULT hook_HFQC10_GetApplicationTypePagedList(H_FABRIC_HANDLE(IFabricQueryClient10) handle, const PAGED_FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION* queryDescription, DWORD timeoutMilliseconds, IFabricGetApplicationTypePagedListResult** result)
+{
+    (void)handle;
+    (void)timeoutMilliseconds;
+    test_seen_tokens[test_page_index] = queryDescription->ContinuationToken;
+    test_seen_max_results = queryDescription->MaxResults;
+    *result = test_pages[test_page_index++];
+    return S_OK;
+}
+
+static HRESULT hook_HFQC10_GetDeployedApplicationPagedList(H_FABRIC_HANDLE(IFabricQueryClient10) handle, const FABRIC_PAGED_DEPLOYED_APPLICATION_QUERY_DESCRIPTION* queryDescription, DWORD timeoutMilliseconds, IFabricGetDeployedApplicationPagedListResult** result)
+{
+    (void)handle;
+    (void)timeoutMilliseconds;
+    test_seen_tokens[test_page_index] = queryDescription->PagingDescription->ContinuationToken;
+    test_seen_max_results = queryDescription->PagingDescription->MaxResults;
+    *result = test_pages[test_page_index++];
+    return S_OK;
+}
+
+static HRESULT hook_HFQC10_GetNodeList2(H_FABRIC_HANDLE(IFabricQueryClient10) handle, const FABRIC_NODE_QUERY_DESCRIPTION* queryDescription, DWORD timeoutMilliseconds, IFabricGetNodeListResult2** result)
+{
+    (void)handle;
+    (void)timeoutMilliseconds;
+    test_seen_tokens[test_page_index] = ((const FABRIC_NODE_QUERY_DESCRIPTION_EX1*)queryDescription->Reserved)->ContinuationToken;
+    *result = test_pages[test_page_index++];
+    return S_OK;
+}
+
+static HRESULT hook_HFQC10_GetServiceList2(H_FABRIC_HANDLE(IFabricQueryClient10) handle, const FABRIC_SERVICE_QUERY_DESCRIPTION* queryDescription, DWORD timeoutMilliseconds, IFabricGetServiceListResult2** result)
+{
+    (void)handle;
+    (void)timeoutMilliseconds;
+    test_seen_tokens[test_page_index] = ((const FABRIC_SERVICE_QUERY_DESCRIPTION_EX1*)queryDescription->Reserved)->ContinuationToken;
+    *result = test_pages[test_page_index++];
+    return S_OK;
+}
+
+static HRESULT hook_HFQC10_GetPartitionList2(H_FABRIC_HANDLE(IFabricQueryClient10) handle, const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION* queryDescription, DWORD timeoutMilliseconds, IFabricGetPartitionListResult2** result)
+{
+    (void)handle;
+    (void)timeoutMilliseconds;
+    test_seen_tokens[test_page_index] = ((const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION_EX1*)queryDescription->Reserved)->ContinuationToken;
+    *result = test_pages[test_page_index++];
+    return S_OK;
+}
+
+static HRESULT hook_HFQC10_GetReplicaList2(H_FABRIC_HANDLE(IFabricQueryClient10) handle, const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION* queryDescription, DWORD timeoutMilliseconds, IFabricGetReplicaListResult2** result)
+{
+    (void)handle;
+    (void)timeoutMilliseconds;
+    const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION_EX1* ex1 = queryDescription->Reserved;
+    test_seen_replica_status_filter = ex1->ReplicaStatusFilter;
+    test_seen_tokens[test_page_index] = ((const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION_EX2*)ex1->Reserved)->ContinuationToken;
+    *result = test_pages[test_page_index++];
+    return S_OK;
+}
+
+static FABRIC_NODE_QUERY_DESCRIPTION test_node_description;
+static TEST_node_PAGE test_node_page_1;
+static TEST_node_PAGE test_node_page_2;
+
+static H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE test_create_node_iterator(void)
+{
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_NODE, &test_node_description, TEST_TIMEOUT);
+    ASSERT_IS_NOT_NULL(iterator);
+    umock_c_reset_all_calls();
+    return iterator;
+}
+
+static void setup_create_iterator_expectations(void)
+{
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(IGNORED_ARG, TEST_THREADPOOL));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG));
+}
+
+/*the prefetch work item: the page is fetched with the cancellation of the iterator current*/
+static void setup_prefetch_work_expectations(void)
+{
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList2(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+}
+
+/*next when the current page is exhausted: the prefetch is waited for, the current page released, and the page after it prefetched*/
+static void setup_move_to_node_page_expectations(TEST_node_PAGE* previous, TEST_node_PAGE* next)
+{
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, UINT32_MAX));
+    setup_prefetch_work_expectations();
+    if (previous != NULL)
+    {
+        STRICT_EXPECTED_CALL(test_node_page_Release(&previous->page));
+    }
+    if (next->paging_status.ContinuationToken != NULL)
+    {
+        STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG));
+    }
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types(), "umocktypes_charptr_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_wcharptr_register_types(), "umocktypes_wcharptr_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types(), "umocktypes_windows_register_types");
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_HOOK(THANDLE_INITIALIZE(THREADPOOL), hook_THANDLE_INITIALIZE_THREADPOOL);
+    REGISTER_GLOBAL_MOCK_HOOK(THANDLE_ASSIGN(THREADPOOL), hook_THANDLE_ASSIGN_THREADPOOL);
+    REGISTER_GLOBAL_MOCK_HOOK(threadpool_schedule_work, hook_threadpool_schedule_work);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(threadpool_schedule_work, MU_FAILURE);
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForValue, hook_InterlockedHL_WaitForValue_runs_the_prefetch);
+    REGISTER_GLOBAL_MOCK_HOOK(HFQC10_GetApplicationTypePagedList, hook_HFQC10_GetApplicationTypePagedList);
+    REGISTER_GLOBAL_MOCK_HOOK(HFQC10_GetDeployedApplicationPagedList, hook_HFQC10_GetDeployedApplicationPagedList);
+    REGISTER_GLOBAL_MOCK_HOOK(HFQC10_GetNodeList2, hook_HFQC10_GetNodeList2);
+    REGISTER_GLOBAL_MOCK_HOOK(HFQC10_GetServiceList2, hook_HFQC10_GetServiceList2);
+    REGISTER_GLOBAL_MOCK_HOOK(HFQC10_GetPartitionList2, hook_HFQC10_GetPartitionList2);
+    REGISTER_GLOBAL_MOCK_HOOK(HFQC10_GetReplicaList2, hook_HFQC10_GetReplicaList2);
+    REGISTER_GLOBAL_MOCK_RETURN(test_application_type_page_Release, 0);
+    REGISTER_GLOBAL_MOCK_RETURN(test_deployed_application_page_Release, 0);
+    REGISTER_GLOBAL_MOCK_RETURN(test_node_page_Release, 0);
+    REGISTER_GLOBAL_MOCK_RETURN(test_service_page_Release, 0);
+    REGISTER_GLOBAL_MOCK_RETURN(test_partition_page_Release, 0);
+    REGISTER_GLOBAL_MOCK_RETURN(test_replica_page_Release, 0);
+
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(THANDLE(THREADPOOL), void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THREADPOOL_WORK_FUNCTION, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(SERVICEFABRIC_DOX_CANCELLATION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TIMER_WHEEL_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricAsyncOperationContext*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_HANDLE(IFabricQueryClient10), void*);
+    REGISTER_UMOCK_ALIAS_TYPE(const PAGED_FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(const FABRIC_PAGED_DEPLOYED_APPLICATION_QUERY_DESCRIPTION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(const FABRIC_NODE_QUERY_DESCRIPTION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(const FABRIC_SERVICE_QUERY_DESCRIPTION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(const FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(const FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetApplicationTypePagedListResult*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetApplicationTypePagedListResult**, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetDeployedApplicationPagedListResult*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetDeployedApplicationPagedListResult**, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetNodeListResult2*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetNodeListResult2**, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetServiceListResult2*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetServiceListResult2**, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetPartitionListResult2*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetPartitionListResult2**, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetReplicaListResult2*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetReplicaListResult2**, void*);
+
+    REGISTER_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+
+    (void)memset(&test_node_description, 0, sizeof(test_node_description));
+    test_node_page_init(&test_node_page_1, 2, TEST_TOKEN_1);
+    test_node_page_init(&test_node_page_2, 1, NULL);
+    test_pages[0] = &test_node_page_1;
+    test_pages[1] = &test_node_page_2;
+    test_pages[2] = NULL;
+    test_page_index = 0;
+    (void)memset(test_seen_tokens, 0, sizeof(test_seen_tokens));
+    captured_work_function = NULL;
+    captured_work_function_context = NULL;
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/* h_fabric_paged_query_iterator_create */
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_001: [ If client is NULL then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_create_with_NULL_client_fails)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+
+    ///act
+    iterator = h_fabric_paged_query_iterator_create(NULL, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_NODE, &test_node_description, TEST_TIMEOUT);
+
+    ///assert
+    ASSERT_IS_NULL(iterator);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_025: [ If threadpool is NULL then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_create_with_NULL_threadpool_fails)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+
+    ///act
+    iterator = h_fabric_paged_query_iterator_create(test_client, NULL, H_FABRIC_PAGED_QUERY_KIND_NODE, &test_node_description, TEST_TIMEOUT);
+
+    ///assert
+    ASSERT_IS_NULL(iterator);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_002: [ If kind is not a valid H_FABRIC_PAGED_QUERY_KIND then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_create_with_invalid_kind_fails)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+
+    ///act
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, (H_FABRIC_PAGED_QUERY_KIND)(H_FABRIC_PAGED_QUERY_KIND_REPLICA + 1), &test_node_description, TEST_TIMEOUT);
+
+    ///assert
+    ASSERT_IS_NULL(iterator);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_003: [ If query_description is NULL then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_create_with_NULL_query_description_fails)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+
+    ///act
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_NODE, NULL, TEST_TIMEOUT);
+
+    ///assert
+    ASSERT_IS_NULL(iterator);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_004: [ h_fabric_paged_query_iterator_create shall allocate memory for the iterator. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_005: [ h_fabric_paged_query_iterator_create shall copy query_description, so that the continuation token can be changed for every page. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_026: [ h_fabric_paged_query_iterator_create shall keep a reference on threadpool by calling THANDLE_INITIALIZE(THREADPOOL). ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_027: [ h_fabric_paged_query_iterator_create shall initialize the SERVICEFABRIC_DOX_CANCELLATION of the iterator by calling servicefabric_dox_cancellation_init. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_008: [ h_fabric_paged_query_iterator_create shall start fetching the first page on threadpool by calling threadpool_schedule_work. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_007: [ h_fabric_paged_query_iterator_create shall succeed and return a non-NULL handle. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_create_succeeds)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+
+    setup_create_iterator_expectations();
+
+    ///act
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_NODE, &test_node_description, TEST_TIMEOUT);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(iterator);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(test_node_description.Reserved); /*the description of the caller is not changed*/
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_006: [ If there are any failures then h_fabric_paged_query_iterator_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_create_fails_when_malloc_fails)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG))
+        .SetReturn(NULL);
+
+    ///act
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_NODE, &test_node_description, TEST_TIMEOUT);
+
+    ///assert
+    ASSERT_IS_NULL(iterator);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_009: [ If threadpool_schedule_work fails then the page shall be fetched synchronously when it is needed. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_create_succeeds_when_threadpool_schedule_work_fails_and_next_fetches_synchronously)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+    const void* item;
+    HRESULT result;
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(IGNORED_ARG, TEST_THREADPOOL));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_init(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(MU_FAILURE);
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList2(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG));
+
+    ///act
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_NODE, &test_node_description, TEST_TIMEOUT);
+    result = h_fabric_paged_query_iterator_next(iterator, &item);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(iterator);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, result);
+    ASSERT_ARE_EQUAL(void_ptr, &test_node_page_1.items[0], item);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/* h_fabric_paged_query_iterator_destroy */
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_010: [ If iterator is NULL then h_fabric_paged_query_iterator_destroy shall return. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_destroy_with_NULL_iterator_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_paged_query_iterator_destroy(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_028: [ If a page is being fetched then h_fabric_paged_query_iterator_destroy shall cancel it by calling servicefabric_dox_cancellation_cancel. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_024: [ The work item shall make the SERVICEFABRIC_DOX_CANCELLATION of the iterator current by calling servicefabric_dox_cancellation_set_current while it fetches the page. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_011: [ h_fabric_paged_query_iterator_destroy shall then wait for the work item by calling InterlockedHL_WaitForValue and release the page if it was fetched anyway. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_012: [ h_fabric_paged_query_iterator_destroy shall release the current page, release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL and free the memory used by the iterator. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_destroy_cancels_the_page_being_fetched_and_waits_for_the_work_item)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_cancel(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, UINT32_MAX));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList2(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(HRESULT_FROM_WIN32(ERROR_CANCELLED));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(iterator));
+
+    ///act
+    h_fabric_paged_query_iterator_destroy(iterator);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_028: [ If a page is being fetched then h_fabric_paged_query_iterator_destroy shall cancel it by calling servicefabric_dox_cancellation_cancel. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_011: [ h_fabric_paged_query_iterator_destroy shall then wait for the work item by calling InterlockedHL_WaitForValue and release the page if it was fetched anyway. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_012: [ h_fabric_paged_query_iterator_destroy shall release the current page, release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL and free the memory used by the iterator. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_destroy_releases_a_page_that_was_fetched_before_the_cancel)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_cancel(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, UINT32_MAX));
+    setup_prefetch_work_expectations();
+    STRICT_EXPECTED_CALL(test_node_page_Release(&test_node_page_1.page));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(iterator));
+
+    ///act
+    h_fabric_paged_query_iterator_destroy(iterator);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_011: [ h_fabric_paged_query_iterator_destroy shall then wait for the work item by calling InterlockedHL_WaitForValue and release the page if it was fetched anyway. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_destroy_does_not_wait_for_a_work_item_that_already_finished)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    test_run_prefetch_work();
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_cancel(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_node_page_Release(&test_node_page_1.page));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(iterator));
+
+    ///act
+    h_fabric_paged_query_iterator_destroy(iterator);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_011: [ h_fabric_paged_query_iterator_destroy shall then wait for the work item by calling InterlockedHL_WaitForValue and release the page if it was fetched anyway. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_012: [ h_fabric_paged_query_iterator_destroy shall release the current page, release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL and free the memory used by the iterator. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_destroy_releases_the_current_page_and_the_page_being_fetched)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_cancel(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, UINT32_MAX));
+    setup_prefetch_work_expectations();
+    STRICT_EXPECTED_CALL(test_node_page_Release(&test_node_page_2.page));
+    STRICT_EXPECTED_CALL(test_node_page_Release(&test_node_page_1.page));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(iterator));
+
+    ///act
+    h_fabric_paged_query_iterator_destroy(iterator);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_012: [ h_fabric_paged_query_iterator_destroy shall release the current page, release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL and free the memory used by the iterator. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_destroy_after_the_last_page_releases_it)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(test_node_page_Release(&test_node_page_2.page));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(iterator));
+
+    ///act
+    h_fabric_paged_query_iterator_destroy(iterator);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_paged_query_iterator_next */
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_013: [ If iterator is NULL then h_fabric_paged_query_iterator_next shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_with_NULL_iterator_fails)
+{
+    ///arrange
+    const void* item;
+    HRESULT result;
+
+    ///act
+    result = h_fabric_paged_query_iterator_next(NULL, &item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_014: [ If item is NULL then h_fabric_paged_query_iterator_next shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_with_NULL_item_fails)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    HRESULT result;
+
+    ///act
+    result = h_fabric_paged_query_iterator_next(iterator, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_018: [ When all the items of the current page were handed out and there are more pages, h_fabric_paged_query_iterator_next shall wait for the next page by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_021: [ h_fabric_paged_query_iterator_next shall make the next page the current page. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_022: [ If the page has a continuation token then h_fabric_paged_query_iterator_next shall start fetching the next page with the continuation token on threadpool by calling threadpool_schedule_work. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_015: [ If the current page has items that were not handed out yet then h_fabric_paged_query_iterator_next shall set *item to the next one and return S_OK. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_returns_the_first_item_and_prefetches_the_next_page)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    HRESULT result;
+
+    setup_move_to_node_page_expectations(NULL, &test_node_page_1);
+
+    ///act
+    result = h_fabric_paged_query_iterator_next(iterator, &item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, result);
+    ASSERT_ARE_EQUAL(void_ptr, &test_node_page_1.items[0], item);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(test_seen_tokens[0]);
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_015: [ If the current page has items that were not handed out yet then h_fabric_paged_query_iterator_next shall set *item to the next one and return S_OK. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_returns_the_second_item_of_the_page_without_any_call)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    HRESULT result;
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    umock_c_reset_all_calls();
+
+    ///act
+    result = h_fabric_paged_query_iterator_next(iterator, &item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, result);
+    ASSERT_ARE_EQUAL(void_ptr, &test_node_page_1.items[1], item);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_018: [ When all the items of the current page were handed out and there are more pages, h_fabric_paged_query_iterator_next shall wait for the next page by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_019: [ h_fabric_paged_query_iterator_next shall release the current page. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_021: [ h_fabric_paged_query_iterator_next shall make the next page the current page. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_023: [ If the page has no continuation token then it is the last page. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_moves_to_the_next_page_with_the_continuation_token)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    HRESULT result;
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    umock_c_reset_all_calls();
+
+    setup_move_to_node_page_expectations(&test_node_page_1, &test_node_page_2);
+
+    ///act
+    result = h_fabric_paged_query_iterator_next(iterator, &item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, result);
+    ASSERT_ARE_EQUAL(void_ptr, &test_node_page_2.items[0], item);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_TOKEN_1, test_seen_tokens[1]);
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_016: [ If all the items of the last page were handed out then h_fabric_paged_query_iterator_next shall return S_FALSE. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_after_the_last_item_returns_S_FALSE)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    HRESULT result_1;
+    HRESULT result_2;
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    umock_c_reset_all_calls();
+
+    ///act
+    result_1 = h_fabric_paged_query_iterator_next(iterator, &item);
+    result_2 = h_fabric_paged_query_iterator_next(iterator, &item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_FALSE, result_1);
+    ASSERT_ARE_EQUAL(HRESULT, S_FALSE, result_2);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_023: [ If the page has no continuation token then it is the last page. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_016: [ If all the items of the last page were handed out then h_fabric_paged_query_iterator_next shall return S_FALSE. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_with_an_empty_continuation_token_stops_after_the_page)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    HRESULT result;
+    test_node_page_init(&test_node_page_1, 1, L"");
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, UINT32_MAX));
+    setup_prefetch_work_expectations();
+
+    ///act
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    result = h_fabric_paged_query_iterator_next(iterator, &item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_FALSE, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_022: [ If the page has a continuation token then h_fabric_paged_query_iterator_next shall start fetching the next page with the continuation token on threadpool by calling threadpool_schedule_work. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_skips_an_empty_page_that_has_a_continuation_token)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    HRESULT result;
+    test_node_page_init(&test_node_page_1, 0, TEST_TOKEN_1);
+
+    setup_move_to_node_page_expectations(NULL, &test_node_page_1);
+    setup_move_to_node_page_expectations(&test_node_page_1, &test_node_page_2);
+
+    ///act
+    result = h_fabric_paged_query_iterator_next(iterator, &item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, result);
+    ASSERT_ARE_EQUAL(void_ptr, &test_node_page_2.items[0], item);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_020: [ If fetching the next page failed then h_fabric_paged_query_iterator_next shall return the error of the query on this call and all the next calls. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_returns_the_error_of_the_first_page)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    HRESULT result_1;
+    HRESULT result_2;
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, UINT32_MAX));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList2(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+
+    ///act
+    result_1 = h_fabric_paged_query_iterator_next(iterator, &item);
+    result_2 = h_fabric_paged_query_iterator_next(iterator, &item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_TIMEOUT, result_1);
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_TIMEOUT, result_2);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_019: [ h_fabric_paged_query_iterator_next shall release the current page. ]*/
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_020: [ If fetching the next page failed then h_fabric_paged_query_iterator_next shall return the error of the query on this call and all the next calls. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_next_returns_the_error_of_the_next_page_and_releases_the_current_page)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator = test_create_node_iterator();
+    const void* item;
+    HRESULT result;
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, UINT32_MAX));
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList2(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_GATEWAY_NOT_REACHABLE);
+    STRICT_EXPECTED_CALL(servicefabric_dox_cancellation_set_current(NULL));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_node_page_Release(&test_node_page_1.page));
+
+    ///act
+    result = h_fabric_paged_query_iterator_next(iterator, &item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_GATEWAY_NOT_REACHABLE, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_005: [ h_fabric_paged_query_iterator_create shall copy query_description, so that the continuation token can be changed for every page. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_uses_the_continuation_token_of_the_caller_for_the_first_page)
+{
+    ///arrange
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+    FABRIC_NODE_QUERY_DESCRIPTION_EX1 ex1 = { TEST_TOKEN_2, NULL };
+    const void* item;
+    test_node_description.Reserved = &ex1;
+    iterator = test_create_node_iterator();
+
+    ///act
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+
+    ///assert
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_TOKEN_2, test_seen_tokens[0]);
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_TOKEN_1, test_seen_tokens[1]);
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_TOKEN_2, ex1.ContinuationToken); /*the description of the caller is not changed*/
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_005: [ h_fabric_paged_query_iterator_create shall copy query_description, so that the continuation token can be changed for every page. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_over_application_types_pages_with_the_continuation_token)
+{
+    ///arrange
+    PAGED_FABRIC_APPLICATION_TYPE_QUERY_DESCRIPTION description = { 0 };
+    TEST_application_type_PAGE page_1;
+    TEST_application_type_PAGE page_2;
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+    const void* item;
+    description.MaxResults = 10;
+    test_application_type_page_init(&page_1, 1, TEST_TOKEN_1);
+    test_application_type_page_init(&page_2, 1, NULL);
+    test_pages[0] = &page_1;
+    test_pages[1] = &page_2;
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_APPLICATION_TYPE, &description, TEST_TIMEOUT);
+    ASSERT_IS_NOT_NULL(iterator);
+
+    ///act
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(void_ptr, &page_1.items[0], item);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(void_ptr, &page_2.items[0], item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_FALSE, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_IS_NULL(test_seen_tokens[0]);
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_TOKEN_1, test_seen_tokens[1]);
+    ASSERT_ARE_EQUAL(long, 10, test_seen_max_results);
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_005: [ h_fabric_paged_query_iterator_create shall copy query_description, so that the continuation token can be changed for every page. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_over_deployed_applications_pages_with_the_continuation_token)
+{
+    ///arrange
+    FABRIC_QUERY_PAGING_DESCRIPTION paging = { NULL, 10, NULL };
+    FABRIC_PAGED_DEPLOYED_APPLICATION_QUERY_DESCRIPTION description = { L"node_1", NULL, FALSE, &paging, NULL };
+    TEST_deployed_application_PAGE page_1;
+    TEST_deployed_application_PAGE page_2;
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+    const void* item;
+    test_deployed_application_page_init(&page_1, 1, TEST_TOKEN_1);
+    test_deployed_application_page_init(&page_2, 1, NULL);
+    test_pages[0] = &page_1;
+    test_pages[1] = &page_2;
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_DEPLOYED_APPLICATION, &description, TEST_TIMEOUT);
+    ASSERT_IS_NOT_NULL(iterator);
+
+    ///act
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(void_ptr, &page_2.items[0], item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_FALSE, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_IS_NULL(test_seen_tokens[0]);
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_TOKEN_1, test_seen_tokens[1]);
+    ASSERT_ARE_EQUAL(long, 10, test_seen_max_results);
+    ASSERT_IS_NULL(paging.ContinuationToken); /*the description of the caller is not changed*/
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_005: [ h_fabric_paged_query_iterator_create shall copy query_description, so that the continuation token can be changed for every page. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_over_services_pages_with_the_continuation_token)
+{
+    ///arrange
+    FABRIC_SERVICE_QUERY_DESCRIPTION description = { L"fabric:/app", NULL, NULL };
+    TEST_service_PAGE page_1;
+    TEST_service_PAGE page_2;
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+    const void* item;
+    test_service_page_init(&page_1, 1, TEST_TOKEN_1);
+    test_service_page_init(&page_2, 1, NULL);
+    test_pages[0] = &page_1;
+    test_pages[1] = &page_2;
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_SERVICE, &description, TEST_TIMEOUT);
+    ASSERT_IS_NOT_NULL(iterator);
+
+    ///act
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(void_ptr, &page_2.items[0], item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_FALSE, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_IS_NULL(test_seen_tokens[0]);
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_TOKEN_1, test_seen_tokens[1]);
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_005: [ h_fabric_paged_query_iterator_create shall copy query_description, so that the continuation token can be changed for every page. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_over_partitions_pages_with_the_continuation_token)
+{
+    ///arrange
+    FABRIC_SERVICE_PARTITION_QUERY_DESCRIPTION description = { L"fabric:/app/svc", { 0 }, NULL };
+    TEST_partition_PAGE page_1;
+    TEST_partition_PAGE page_2;
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+    const void* item;
+    test_partition_page_init(&page_1, 1, TEST_TOKEN_1);
+    test_partition_page_init(&page_2, 1, NULL);
+    test_pages[0] = &page_1;
+    test_pages[1] = &page_2;
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_PARTITION, &description, TEST_TIMEOUT);
+    ASSERT_IS_NOT_NULL(iterator);
+
+    ///act
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(void_ptr, &page_2.items[0], item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_FALSE, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_IS_NULL(test_seen_tokens[0]);
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_TOKEN_1, test_seen_tokens[1]);
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+/*Tests_SRS_H_FABRIC_PAGED_QUERY_ITERATOR_01_005: [ h_fabric_paged_query_iterator_create shall copy query_description, so that the continuation token can be changed for every page. ]*/
+TEST_FUNCTION(h_fabric_paged_query_iterator_over_replicas_pages_with_the_continuation_token_and_keeps_the_status_filter)
+{
+    ///arrange
+    FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION_EX1 ex1 = { FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_READY, NULL };
+    FABRIC_SERVICE_REPLICA_QUERY_DESCRIPTION description = { { 0 }, 0, &ex1 };
+    TEST_replica_PAGE page_1;
+    TEST_replica_PAGE page_2;
+    H_FABRIC_PAGED_QUERY_ITERATOR_HANDLE iterator;
+    const void* item;
+    test_replica_page_init(&page_1, 1, TEST_TOKEN_1);
+    test_replica_page_init(&page_2, 1, NULL);
+    test_pages[0] = &page_1;
+    test_pages[1] = &page_2;
+    iterator = h_fabric_paged_query_iterator_create(test_client, TEST_THREADPOOL, H_FABRIC_PAGED_QUERY_KIND_REPLICA, &description, TEST_TIMEOUT);
+    ASSERT_IS_NOT_NULL(iterator);
+
+    ///act
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_ARE_EQUAL(void_ptr, &page_2.items[0], item);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_FALSE, h_fabric_paged_query_iterator_next(iterator, &item));
+    ASSERT_IS_NULL(test_seen_tokens[0]);
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_TOKEN_1, test_seen_tokens[1]);
+    ASSERT_ARE_EQUAL(uint32_t, FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_READY, test_seen_replica_status_filter);
+    ASSERT_IS_NULL(ex1.Reserved); /*the description of the caller is not changed*/
+
+    ///clean
+    h_fabric_paged_query_iterator_destroy(iterator);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,1420 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <wchar.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_bool.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_wcharptr.h"
+#include "umock_c/umocktypes_windows.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/srw_lock.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+#include "c_pal/timer.h"
+
+#include "hfabricqueryclient10.h"
+
+MOCKABLE_FUNCTION(, ULONG, test_result_AddRef, IFabricGetNodeListResult*, This);
+MOCKABLE_FUNCTION(, ULONG, test_result_Release, IFabricGetNodeListResult*, This);
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "h_fabric_query_cache.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT_VALUES);
+
+#define TEST_TIMEOUT 1000
+#define TEST_TTL_MS 100
+#define TEST_STALE_MS 50
+#define TEST_NODE_NAME L"node_1"
+#define TEST_OTHER_NODE_NAME L"node_2"
+
+static H_FABRIC_HANDLE(IFabricQueryClient10) test_client = (H_FABRIC_HANDLE(IFabricQueryClient10))0x4242;
+static SRW_LOCK_HANDLE test_lock = (SRW_LOCK_HANDLE)0x4243;
+#define TEST_THREADPOOL ((THANDLE(THREADPOOL))0x4245)
+
+/*fake node lists, only AddRef and Release are ever called by the cache*/
+static IFabricGetNodeListResultVtbl test_result_vtbl =
+{
+    .AddRef = test_result_AddRef,
+    .Release = test_result_Release
+};
+static IFabricGetNodeListResult test_result_1 = { &test_result_vtbl };
+static IFabricGetNodeListResult test_result_2 = { &test_result_vtbl };
+static IFabricGetNodeListResult* test_result_1_ptr = &test_result_1;
+static IFabricGetNodeListResult* test_result_2_ptr = &test_result_2;
+
+static FABRIC_NODE_QUERY_DESCRIPTION test_description;
+
+/*the time as seen by the cache*/
+static double test_now;
+
+static double hook_timer_global_get_elapsed_ms(void)
+{
+    return test_now;
+}
+
+/*THANDLE(THREADPOOL) is mocked, the cache still needs to hold the threadpool it is given*/
+static void hook_THANDLE_INITIALIZE_THREADPOOL(THANDLE(THREADPOOL)* t1, THANDLE(THREADPOOL) t2)
+{
+    *(THREADPOOL const**)t1 = t2;
+}
+
+static void hook_THANDLE_ASSIGN_THREADPOOL(THANDLE(THREADPOOL)* t1, THANDLE(THREADPOOL) t2)
+{
+    *(THREADPOOL const**)t1 = t2;
+}
+
+/*the scheduled refresh runs when the test runs it, when a caller waits for it or when the cache waits for it in h_fabric_query_cache_destroy*/
+static THREADPOOL_WORK_FUNCTION captured_work_function;
+static void* captured_work_function_context;
+
+static void test_run_refresh_work(void)
+{
+    THREADPOOL_WORK_FUNCTION work_function = captured_work_function;
+    captured_work_function = NULL;
+    work_function(captured_work_function_context);
+}
+
+static int hook_threadpool_schedule_work(THANDLE(THREADPOOL) threadpool, THREADPOOL_WORK_FUNCTION work_function, void* work_function_context)
+{
+    (void)threadpool;
+    captured_work_function = work_function;
+    captured_work_function_context = work_function_context;
+    return 0;
+}
+
+static INTERLOCKED_HL_RESULT hook_InterlockedHL_WaitForNotValue_runs_the_refresh(int32_t volatile_atomic* address_to_check, int32_t value_to_wait, uint32_t timeout_ms)
+{
+    (void)address_to_check;
+    (void)value_to_wait;
+    (void)timeout_ms;
+    test_run_refresh_work();
+    return INTERLOCKED_HL_OK;
+}
+
+static INTERLOCKED_HL_RESULT hook_InterlockedHL_WaitForValue_runs_the_scheduled_refresh(int32_t volatile_atomic* address_to_check, int32_t value_to_wait, uint32_t timeout_ms)
+{
+    (void)address_to_check;
+    (void)value_to_wait;
+    (void)timeout_ms;
+    if (captured_work_function != NULL)
+    {
+        test_run_refresh_work();
+    }
+    return INTERLOCKED_HL_OK;
+}
+
+static H_FABRIC_QUERY_CACHE_HANDLE nested_cache;
+static HRESULT nested_result;
+
+static HRESULT hook_HFQC10_GetNodeList_with_nested_query(H_FABRIC_HANDLE(IFabricQueryClient10) handle, const FABRIC_NODE_QUERY_DESCRIPTION* queryDescription, DWORD timeoutMilliseconds, IFabricGetNodeListResult** result)
+{
+    (void)handle;
+    IFabricGetNodeListResult* nested;
+    /*a second caller asks for the same query while the first one is asking SF*/
+    nested_result = h_fabric_query_cache_GetNodeList(nested_cache, queryDescription, timeoutMilliseconds, &nested);
+    *result = &test_result_1;
+    return S_OK;
+}
+
+static H_FABRIC_QUERY_CACHE_HANDLE test_create_cache_with_buckets(uint32_t buckets_per_shard)
+{
+    H_FABRIC_QUERY_CACHE_HANDLE cache = h_fabric_query_cache_create(test_client, TEST_THREADPOOL, 1, buckets_per_shard);
+    ASSERT_IS_NOT_NULL(cache);
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_query_cache_configure(cache, H_FABRIC_QUERY_CACHE_API_GET_NODE_LIST, TEST_TTL_MS, TEST_STALE_MS));
+    umock_c_reset_all_calls();
+    return cache;
+}
+
+static H_FABRIC_QUERY_CACHE_HANDLE test_create_cache(void)
+{
+    return test_create_cache_with_buckets(4);
+}
+
+static void setup_create_cache_expectations(void)
+{
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(calloc(1 * 4, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_query_cache"));
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(IGNORED_ARG, TEST_THREADPOOL));
+}
+
+/*a lookup that does not hand out a result*/
+static void setup_lookup_expectations(bool is_new)
+{
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    if (is_new)
+    {
+        STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+        STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(uint32_t)));
+        STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    }
+}
+
+static void setup_store_expectations(IFabricGetNodeListResult* previous)
+{
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    if (previous != NULL)
+    {
+        STRICT_EXPECTED_CALL(test_result_Release(previous));
+    }
+}
+
+static void setup_fetch_expectations(IFabricGetNodeListResult* previous, IFabricGetNodeListResult** fetched)
+{
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(fetched, sizeof(*fetched));
+    setup_store_expectations(previous);
+    STRICT_EXPECTED_CALL(test_result_AddRef(*fetched));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+}
+
+/*a look at the result of the entry: a hit is served by the lookup itself, a call that holds the entry looks again*/
+static void setup_read_expectations(IFabricGetNodeListResult* cached)
+{
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    if (cached != NULL)
+    {
+        STRICT_EXPECTED_CALL(test_result_AddRef(cached));
+    }
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+}
+
+static void setup_start_refresh_expectations(void)
+{
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG));
+}
+
+/*the refresh is the only one in progress, so it wakes h_fabric_query_cache_destroy when it is done*/
+static void setup_refresh_done_expectations(void)
+{
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+}
+
+static void setup_refresh_work_expectations(IFabricGetNodeListResult* previous, IFabricGetNodeListResult** fetched)
+{
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(fetched, sizeof(*fetched));
+    setup_store_expectations(previous);
+    setup_refresh_done_expectations();
+}
+
+static void test_get_node_list(H_FABRIC_QUERY_CACHE_HANDLE cache, IFabricGetNodeListResult** fetched)
+{
+    IFabricGetNodeListResult* result;
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(fetched, sizeof(*fetched));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+}
+
+/*the entry of test_description gets a result at time 0 and a refresh of it is scheduled at TEST_TTL_MS*/
+static void test_start_refresh(H_FABRIC_QUERY_CACHE_HANDLE cache)
+{
+    IFabricGetNodeListResult* result;
+    test_get_node_list(cache, &test_result_1_ptr);
+    test_now = TEST_TTL_MS;
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+}
+
+static void setup_destroy_with_one_entry_expectations(bool has_scheduled_refresh, IFabricGetNodeListResult* cached)
+{
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX));
+    if (has_scheduled_refresh)
+    {
+        /*the refresh runs while h_fabric_query_cache_destroy waits for it, and does not ask SF*/
+        setup_refresh_done_expectations();
+    }
+    if (cached != NULL)
+    {
+        STRICT_EXPECTED_CALL(test_result_Release(cached));
+    }
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // entry
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // buckets
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // cache
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types(), "umocktypes_bool_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types(), "umocktypes_charptr_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types(), "umocktypes_stdint_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_wcharptr_register_types(), "umocktypes_wcharptr_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types(), "umocktypes_windows_register_types");
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(malloc_flex, NULL);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(calloc, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(srw_lock_create, test_lock, NULL);
+    REGISTER_GLOBAL_MOCK_HOOK(timer_global_get_elapsed_ms, hook_timer_global_get_elapsed_ms);
+    REGISTER_GLOBAL_MOCK_HOOK(THANDLE_INITIALIZE(THREADPOOL), hook_THANDLE_INITIALIZE_THREADPOOL);
+    REGISTER_GLOBAL_MOCK_HOOK(THANDLE_ASSIGN(THREADPOOL), hook_THANDLE_ASSIGN_THREADPOOL);
+    REGISTER_GLOBAL_MOCK_HOOK(threadpool_schedule_work, hook_threadpool_schedule_work);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(threadpool_schedule_work, MU_FAILURE);
+    REGISTER_GLOBAL_MOCK_RETURNS(InterlockedHL_WaitForNotValue, INTERLOCKED_HL_OK, INTERLOCKED_HL_ERROR);
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForValue, hook_InterlockedHL_WaitForValue_runs_the_scheduled_refresh);
+    REGISTER_GLOBAL_MOCK_RETURNS(HFQC10_GetNodeList, S_OK, FABRIC_E_TIMEOUT);
+    REGISTER_GLOBAL_MOCK_RETURNS(HFQC10_GetClusterLoadInformation, S_OK, FABRIC_E_TIMEOUT);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_AddRef, 2);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_Release, 1);
+
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(SRW_LOCK_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THANDLE(THREADPOOL), void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THREADPOOL_WORK_FUNCTION, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_HANDLE(IFabricQueryClient10), void*);
+    REGISTER_UMOCK_ALIAS_TYPE(const FABRIC_NODE_QUERY_DESCRIPTION*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetNodeListResult*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetNodeListResult**, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricGetClusterLoadInformationResult**, void*);
+
+    REGISTER_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+
+    (void)memset(&test_description, 0, sizeof(test_description));
+    test_description.NodeNameFilter = TEST_NODE_NAME;
+    test_now = 0;
+    captured_work_function = NULL;
+    captured_work_function_context = NULL;
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/*h_fabric_query_cache_create*/
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_001: [ If client is NULL then h_fabric_query_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_query_cache_create_with_client_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache;
+
+    ///act
+    cache = h_fabric_query_cache_create(NULL, TEST_THREADPOOL, 1, 4);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_046: [ If threadpool is NULL then h_fabric_query_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_query_cache_create_with_threadpool_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache;
+
+    ///act
+    cache = h_fabric_query_cache_create(test_client, NULL, 1, 4);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_002: [ If shard_count is 0 then h_fabric_query_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_query_cache_create_with_shard_count_0_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache;
+
+    ///act
+    cache = h_fabric_query_cache_create(test_client, TEST_THREADPOOL, 0, 4);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_048: [ If buckets_per_shard is 0 then h_fabric_query_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_query_cache_create_with_buckets_per_shard_0_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache;
+
+    ///act
+    cache = h_fabric_query_cache_create(test_client, TEST_THREADPOOL, 1, 0);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_003: [ h_fabric_query_cache_create shall allocate memory for the cache and its shard_count shards. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_004: [ h_fabric_query_cache_create shall allocate shard_count * buckets_per_shard empty buckets. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_005: [ h_fabric_query_cache_create shall create a lock for each shard by calling srw_lock_create. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_042: [ h_fabric_query_cache_create shall keep a reference on threadpool by calling THANDLE_INITIALIZE(THREADPOOL). ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_007: [ h_fabric_query_cache_create shall succeed and return a non-NULL handle. ]*/
+TEST_FUNCTION(h_fabric_query_cache_create_succeeds)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache;
+    setup_create_cache_expectations();
+
+    ///act
+    cache = h_fabric_query_cache_create(test_client, TEST_THREADPOOL, 1, 4);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_005: [ h_fabric_query_cache_create shall create a lock for each shard by calling srw_lock_create. ]*/
+TEST_FUNCTION(h_fabric_query_cache_create_with_3_shards_creates_3_locks)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 3, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(calloc(3 * 2, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_query_cache"));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_query_cache"));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_query_cache"));
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(IGNORED_ARG, TEST_THREADPOOL));
+
+    ///act
+    cache = h_fabric_query_cache_create(test_client, TEST_THREADPOOL, 3, 2);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_008: [ If there are any failures then h_fabric_query_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(when_the_second_srw_lock_create_fails_h_fabric_query_cache_create_destroys_the_first_lock)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 2, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(calloc(2 * 4, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_query_cache"));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_query_cache"))
+        .SetReturn(NULL);
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    cache = h_fabric_query_cache_create(test_client, TEST_THREADPOOL, 2, 4);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_008: [ If there are any failures then h_fabric_query_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(when_underlying_calls_fail_h_fabric_query_cache_create_also_fails)
+{
+    ///arrange
+    setup_create_cache_expectations();
+
+    umock_c_negative_tests_snapshot();
+
+    for (size_t i = 0; i < umock_c_negative_tests_call_count(); i++)
+    {
+        if (umock_c_negative_tests_can_call_fail(i))
+        {
+            umock_c_negative_tests_reset();
+            umock_c_negative_tests_fail_call(i);
+
+            ///act
+            H_FABRIC_QUERY_CACHE_HANDLE cache = h_fabric_query_cache_create(test_client, TEST_THREADPOOL, 1, 4);
+
+            ///assert
+            ASSERT_IS_NULL(cache, "On failed call %zu", i);
+        }
+    }
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_006: [ h_fabric_query_cache_create shall not cache any API until it is configured. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_020: [ If the API is not cached (ttl_ms is 0) then the query functions shall call the HFQC10_ API of the query with queryDescription and return its result. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_before_configure_calls_SF_with_the_description_of_the_caller)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = h_fabric_query_cache_create(test_client, TEST_THREADPOOL, 1, 4);
+    IFabricGetNodeListResult* result;
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, &test_description, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*h_fabric_query_cache_destroy*/
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_009: [ If cache is NULL then h_fabric_query_cache_destroy shall return. ]*/
+TEST_FUNCTION(h_fabric_query_cache_destroy_with_cache_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_query_cache_destroy(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_010: [ h_fabric_query_cache_destroy shall wait for the scheduled refreshes to finish by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_012: [ h_fabric_query_cache_destroy shall destroy the shard locks, release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL and free the memory used by the cache. ]*/
+TEST_FUNCTION(h_fabric_query_cache_destroy_of_an_empty_cache_frees_everything)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX));
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(cache));
+
+    ///act
+    h_fabric_query_cache_destroy(cache);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_012: [ h_fabric_query_cache_destroy shall destroy the shard locks, release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL and free the memory used by the cache. ]*/
+TEST_FUNCTION(h_fabric_query_cache_destroy_of_a_cache_with_2_shards_destroys_2_locks)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = h_fabric_query_cache_create(test_client, TEST_THREADPOOL, 2, 4);
+    ASSERT_IS_NOT_NULL(cache);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX));
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(cache));
+
+    ///act
+    h_fabric_query_cache_destroy(cache);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_011: [ For each entry, h_fabric_query_cache_destroy shall release the cached result and free the entry. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_012: [ h_fabric_query_cache_destroy shall destroy the shard locks, release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL and free the memory used by the cache. ]*/
+TEST_FUNCTION(h_fabric_query_cache_destroy_releases_the_cached_results)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    test_get_node_list(cache, &test_result_1_ptr);
+
+    setup_destroy_with_one_entry_expectations(false, &test_result_1);
+
+    ///act
+    h_fabric_query_cache_destroy(cache);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_043: [ h_fabric_query_cache_destroy shall mark the cache as being destroyed, so that the refreshes which did not start yet do not call the client. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_010: [ h_fabric_query_cache_destroy shall wait for the scheduled refreshes to finish by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_041: [ If the cache is being destroyed then refresh_work shall not refresh the entry. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_047: [ refresh_work shall release the reference of the refresh on the entry and, if it was the last refresh in progress, wake h_fabric_query_cache_destroy. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_011: [ For each entry, h_fabric_query_cache_destroy shall release the cached result and free the entry. ]*/
+TEST_FUNCTION(h_fabric_query_cache_destroy_gives_up_the_refreshes_that_did_not_start)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    test_start_refresh(cache);
+
+    setup_destroy_with_one_entry_expectations(true, &test_result_1);
+
+    ///act
+    h_fabric_query_cache_destroy(cache);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*h_fabric_query_cache_configure*/
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_013: [ If cache is NULL then h_fabric_query_cache_configure shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_query_cache_configure_with_cache_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    int result = h_fabric_query_cache_configure(NULL, H_FABRIC_QUERY_CACHE_API_GET_NODE_LIST, TEST_TTL_MS, TEST_STALE_MS);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_014: [ If api is not a valid H_FABRIC_QUERY_CACHE_API then h_fabric_query_cache_configure shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_query_cache_configure_with_invalid_api_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+
+    ///act
+    int result = h_fabric_query_cache_configure(cache, (H_FABRIC_QUERY_CACHE_API)(H_FABRIC_QUERY_CACHE_API_GET_PARTITION_LOAD_INFORMATION + 1), TEST_TTL_MS, TEST_STALE_MS);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_039: [ If ttl_ms or stale_ms is greater than INT32_MAX then h_fabric_query_cache_configure shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_query_cache_configure_with_ttl_ms_too_big_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+
+    ///act
+    int result = h_fabric_query_cache_configure(cache, H_FABRIC_QUERY_CACHE_API_GET_NODE_LIST, (uint32_t)INT32_MAX + 1, TEST_STALE_MS);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_039: [ If ttl_ms or stale_ms is greater than INT32_MAX then h_fabric_query_cache_configure shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_query_cache_configure_with_stale_ms_too_big_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+
+    ///act
+    int result = h_fabric_query_cache_configure(cache, H_FABRIC_QUERY_CACHE_API_GET_NODE_LIST, TEST_TTL_MS, UINT32_MAX);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_015: [ h_fabric_query_cache_configure shall set ttl_ms and stale_ms for api. The next calls of the query functions shall use them. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_016: [ h_fabric_query_cache_configure shall succeed and return 0. ]*/
+TEST_FUNCTION(h_fabric_query_cache_configure_with_ttl_ms_0_stops_caching)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_get_node_list(cache, &test_result_1_ptr);
+
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, &test_description, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(&test_result_2_ptr, sizeof(test_result_2_ptr));
+
+    ///act
+    int configure_result = h_fabric_query_cache_configure(cache, H_FABRIC_QUERY_CACHE_API_GET_NODE_LIST, 0, 0);
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, configure_result);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*query functions*/
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_017: [ If cache is NULL then the query functions shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_with_cache_NULL_fails)
+{
+    ///arrange
+    IFabricGetNodeListResult* result;
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(NULL, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_018: [ If queryDescription is NULL then the query functions shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_with_queryDescription_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_019: [ If result is NULL then the query functions shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_with_result_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_020: [ If the API is not cached (ttl_ms is 0) then the query functions shall call the HFQC10_ API of the query with queryDescription and return its result. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetClusterLoadInformation_when_not_cached_calls_SF)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetClusterLoadInformationResult* result;
+
+    STRICT_EXPECTED_CALL(HFQC10_GetClusterLoadInformation(test_client, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_TIMEOUT);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetClusterLoadInformation(cache, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_TIMEOUT, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_021: [ The query functions shall compute the canonical key of the query: the API and every field of queryDescription and of the extensions it points to (strings by content). ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_045: [ If there is no entry, the query functions shall add an entry under the exclusive shard lock (unless another thread added it meanwhile). The entry keeps its own copy of the description. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_032: [ Otherwise the query functions shall switch the entry to FETCHING and call the HFQC10_ API of the query with the copy of the description kept by the entry. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_027: [ On success the new result shall replace the cached result under the exclusive shard lock, together with the time it was received (timer_global_get_elapsed_ms), and the previous result shall be released. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_037: [ On success the query functions shall AddRef the new result, return it in result, switch the entry to READY and return S_OK. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_038: [ The query functions shall wake all the threads waiting for the entry. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_on_a_miss_asks_SF_with_a_copy_of_the_description)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    const FABRIC_NODE_QUERY_DESCRIPTION* seen_description = NULL;
+    setup_lookup_expectations(true);
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .CaptureArgumentValue_queryDescription(&seen_description)
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    setup_store_expectations(NULL);
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_1));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(seen_description);
+    ASSERT_ARE_NOT_EQUAL(void_ptr, &test_description, seen_description);
+    ASSERT_ARE_NOT_EQUAL(void_ptr, TEST_NODE_NAME, seen_description->NodeNameFilter);
+    ASSERT_ARE_EQUAL(wchar_ptr, TEST_NODE_NAME, seen_description->NodeNameFilter);
+    ASSERT_IS_NULL(seen_description->Reserved);
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_023: [ The query functions shall look up the entry of the key in its shard under the shared shard lock and, in the same shared section, hand out the cached result if the entry is READY or REFRESHING and its result is not older than ttl_ms + stale_ms. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_024: [ If the cached result is not older than ttl_ms then the query functions shall AddRef it, return it in result and return S_OK. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_within_ttl_ms_returns_the_cached_result_without_asking_SF)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_get_node_list(cache, &test_result_1_ptr);
+    test_now = TEST_TTL_MS - 1;
+
+    setup_read_expectations(&test_result_1);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_021: [ The query functions shall compute the canonical key of the query: the API and every field of queryDescription and of the extensions it points to (strings by content). ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_with_the_same_strings_at_another_address_hits)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    wchar_t node_name_1[] = L"node";
+    wchar_t node_name_2[] = L"node"; /*same value, different address*/
+    wchar_t token_1[] = L"token";
+    wchar_t token_2[] = L"token";
+    FABRIC_NODE_QUERY_DESCRIPTION_EX1 ex1_1 = { token_1, NULL };
+    FABRIC_NODE_QUERY_DESCRIPTION_EX1 ex1_2 = { token_2, NULL };
+    FABRIC_NODE_QUERY_DESCRIPTION description_2 = { node_name_2, &ex1_2 };
+    test_description.NodeNameFilter = node_name_1;
+    test_description.Reserved = &ex1_1;
+    test_get_node_list(cache, &test_result_1_ptr);
+
+    setup_read_expectations(&test_result_1);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &description_2, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_021: [ The query functions shall compute the canonical key of the query: the API and every field of queryDescription and of the extensions it points to (strings by content). ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_045: [ If there is no entry, the query functions shall add an entry under the exclusive shard lock (unless another thread added it meanwhile). The entry keeps its own copy of the description. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_keeps_different_extensions_apart)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    const FABRIC_NODE_QUERY_DESCRIPTION* seen_description = NULL;
+    FABRIC_NODE_QUERY_DESCRIPTION_EX1 ex1 = { NULL, NULL };
+    FABRIC_NODE_QUERY_DESCRIPTION_EX2 ex2 = { FABRIC_QUERY_NODE_STATUS_FILTER_UP, NULL };
+    FABRIC_NODE_QUERY_DESCRIPTION description_2 = { TEST_NODE_NAME, &ex1 };
+    ex1.Reserved = &ex2;
+    test_get_node_list(cache, &test_result_1_ptr);
+
+    setup_lookup_expectations(true);
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .CaptureArgumentValue_queryDescription(&seen_description)
+        .CopyOutArgumentBuffer_result(&test_result_2_ptr, sizeof(test_result_2_ptr));
+    setup_store_expectations(NULL);
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_2));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &description_2, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(seen_description->Reserved);
+    ASSERT_IS_NULL(((const FABRIC_NODE_QUERY_DESCRIPTION_EX1*)seen_description->Reserved)->ContinuationToken);
+    ASSERT_IS_NOT_NULL(((const FABRIC_NODE_QUERY_DESCRIPTION_EX1*)seen_description->Reserved)->Reserved);
+    ASSERT_ARE_EQUAL(uint32_t, FABRIC_QUERY_NODE_STATUS_FILTER_UP, ((const FABRIC_NODE_QUERY_DESCRIPTION_EX2*)((const FABRIC_NODE_QUERY_DESCRIPTION_EX1*)seen_description->Reserved)->Reserved)->NodeStatusFilter);
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_022: [ If queryDescription points to extensions that the cache does not know then the query functions shall call the HFQC10_ API of the query with queryDescription and return its result. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_with_an_unknown_extension_calls_SF_with_the_description_of_the_caller)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    int unknown_extension = 42;
+    FABRIC_NODE_QUERY_DESCRIPTION_EX1 ex1 = { NULL, NULL };
+    FABRIC_NODE_QUERY_DESCRIPTION_EX2 ex2 = { FABRIC_QUERY_NODE_STATUS_FILTER_DEFAULT, NULL };
+    FABRIC_NODE_QUERY_DESCRIPTION_EX3 ex3 = { 10, &unknown_extension };
+    ex1.Reserved = &ex2;
+    ex2.Reserved = &ex3;
+    test_description.Reserved = &ex1;
+
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, &test_description, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_024: [ If the cached result is not older than ttl_ms then the query functions shall AddRef it, return it in result and return S_OK. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_025: [ If the cached result is older than ttl_ms but not older than ttl_ms + stale_ms then the query functions shall also switch the entry from READY to REFRESHING, take a reference on the entry for the refresh and call threadpool_schedule_work with refresh_work. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_in_the_stale_window_returns_the_cached_result_and_starts_a_refresh)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_get_node_list(cache, &test_result_1_ptr);
+    test_now = TEST_TTL_MS;
+
+    setup_read_expectations(&test_result_1);
+    setup_start_refresh_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_025: [ If the cached result is older than ttl_ms but not older than ttl_ms + stale_ms then the query functions shall also switch the entry from READY to REFRESHING, take a reference on the entry for the refresh and call threadpool_schedule_work with refresh_work. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_while_refreshing_does_not_start_another_refresh)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_start_refresh(cache);
+    test_now = TEST_TTL_MS + TEST_STALE_MS - 1;
+
+    setup_read_expectations(&test_result_1);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_028: [ The refresh shall call the HFQC10_ API of the query with the copy of the description kept by the entry. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_027: [ On success the new result shall replace the cached result under the exclusive shard lock, together with the time it was received (timer_global_get_elapsed_ms), and the previous result shall be released. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_030: [ The refresh shall switch the entry back to READY and wake all the threads waiting for the entry. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_047: [ refresh_work shall release the reference of the refresh on the entry and, if it was the last refresh in progress, wake h_fabric_query_cache_destroy. ]*/
+TEST_FUNCTION(the_refresh_replaces_the_cached_result)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_start_refresh(cache);
+
+    setup_refresh_work_expectations(&test_result_1, &test_result_2_ptr);
+
+    ///act
+    test_run_refresh_work();
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+    test_now = TEST_TTL_MS + TEST_STALE_MS;
+    setup_read_expectations(&test_result_2);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result));
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_029: [ If the refresh fails then the cached result shall be kept. ]*/
+TEST_FUNCTION(when_the_refresh_fails_the_cached_result_is_kept_and_the_next_call_refreshes_again)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_start_refresh(cache);
+
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    setup_refresh_done_expectations();
+    test_run_refresh_work();
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    setup_read_expectations(&test_result_1);
+    setup_start_refresh_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_026: [ If threadpool_schedule_work fails then the entry shall be switched back to READY and the reference taken for the refresh shall be released. ]*/
+TEST_FUNCTION(when_threadpool_schedule_work_fails_the_entry_is_switched_back_to_READY)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_get_node_list(cache, &test_result_1_ptr);
+    test_now = TEST_TTL_MS;
+
+    setup_read_expectations(&test_result_1);
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(MU_FAILURE);
+    setup_refresh_done_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_026: [ If threadpool_schedule_work fails then the entry shall be switched back to READY and the reference taken for the refresh shall be released. ]*/
+TEST_FUNCTION(when_threadpool_schedule_work_fails_the_next_call_in_the_stale_window_tries_again)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_get_node_list(cache, &test_result_1_ptr);
+    test_now = TEST_TTL_MS;
+
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(MU_FAILURE);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result));
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    umock_c_reset_all_calls();
+
+    setup_read_expectations(&test_result_1);
+    setup_start_refresh_expectations();
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_044: [ Otherwise the query functions shall take a reference on the entry, which the call holds until it returns. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_032: [ Otherwise the query functions shall switch the entry to FETCHING and call the HFQC10_ API of the query with the copy of the description kept by the entry. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_027: [ On success the new result shall replace the cached result under the exclusive shard lock, together with the time it was received (timer_global_get_elapsed_ms), and the previous result shall be released. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_past_the_stale_window_asks_SF_and_waits_for_the_answer)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_get_node_list(cache, &test_result_1_ptr);
+    test_now = TEST_TTL_MS + TEST_STALE_MS;
+
+    setup_lookup_expectations(false);
+    setup_read_expectations(NULL);
+    setup_fetch_expectations(&test_result_1, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_033: [ If the cached result is too old (or there is none) and another thread is asking SF for the same query then the query functions shall wait for it by calling InterlockedHL_WaitForNotValue. ]*/
+TEST_FUNCTION(h_fabric_query_cache_GetNodeList_past_the_stale_window_waits_for_the_refresh_in_progress)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    test_start_refresh(cache);
+    test_now = TEST_TTL_MS + TEST_STALE_MS;
+
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForNotValue, hook_InterlockedHL_WaitForNotValue_runs_the_refresh);
+    setup_lookup_expectations(false);
+    setup_read_expectations(NULL);
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForNotValue(IGNORED_ARG, IGNORED_ARG, UINT32_MAX));
+    setup_refresh_work_expectations(&test_result_1, &test_result_2_ptr);
+    setup_read_expectations(&test_result_2);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForNotValue, NULL);
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_034: [ If the HFQC10_ API fails then the query functions shall record the error, switch the entry to FAILED and return the error. ]*/
+TEST_FUNCTION(when_HFQC10_GetNodeList_fails_h_fabric_query_cache_GetNodeList_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+
+    setup_lookup_expectations(true);
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_TIMEOUT, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    setup_destroy_with_one_entry_expectations(false, NULL);
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_032: [ Otherwise the query functions shall switch the entry to FETCHING and call the HFQC10_ API of the query with the copy of the description kept by the entry. ]*/
+TEST_FUNCTION(after_HFQC10_GetNodeList_failed_h_fabric_query_cache_GetNodeList_asks_SF_again)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_TIMEOUT, h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    setup_lookup_expectations(false);
+    setup_fetch_expectations(NULL, &test_result_1_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_036: [ If there are any failures then the query functions shall fail and return an error. ]*/
+TEST_FUNCTION(when_adding_the_entry_fails_h_fabric_query_cache_GetNodeList_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(uint32_t)))
+        .SetReturn(NULL);
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_OUTOFMEMORY, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_033: [ If the cached result is too old (or there is none) and another thread is asking SF for the same query then the query functions shall wait for it by calling InterlockedHL_WaitForNotValue. ]*/
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_036: [ If there are any failures then the query functions shall fail and return an error. ]*/
+TEST_FUNCTION(when_waiting_for_the_fetching_thread_fails_h_fabric_query_cache_GetNodeList_fails)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache();
+    IFabricGetNodeListResult* result;
+    nested_cache = cache;
+    nested_result = S_OK;
+
+    REGISTER_GLOBAL_MOCK_HOOK(HFQC10_GetNodeList, hook_HFQC10_GetNodeList_with_nested_query);
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForNotValue(IGNORED_ARG, IGNORED_ARG, UINT32_MAX))
+        .SetReturn(INTERLOCKED_HL_ERROR);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(HRESULT, E_FAIL, nested_result);
+
+    ///clean
+    REGISTER_GLOBAL_MOCK_HOOK(HFQC10_GetNodeList, NULL);
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_040: [ Before adding an entry, the query functions shall evict from its bucket the entries that no other call and no refresh is using and that have nothing to hand out anymore: no result, or a result older than ttl_ms + stale_ms of their API, or an API that is not cached anymore. ]*/
+TEST_FUNCTION(adding_an_entry_evicts_an_idle_entry_of_the_bucket_past_the_stale_window)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache_with_buckets(1);
+    IFabricGetNodeListResult* result;
+    FABRIC_NODE_QUERY_DESCRIPTION other_description = { TEST_OTHER_NODE_NAME, NULL };
+    test_get_node_list(cache, &test_result_1_ptr);
+    test_now = TEST_TTL_MS + TEST_STALE_MS;
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(uint32_t)));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result_1));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // evicted entry
+    setup_fetch_expectations(NULL, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &other_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+    /*the evicted query gets a new entry*/
+    setup_lookup_expectations(true);
+    setup_fetch_expectations(NULL, &test_result_1_ptr);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result));
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_040: [ Before adding an entry, the query functions shall evict from its bucket the entries that no other call and no refresh is using and that have nothing to hand out anymore: no result, or a result older than ttl_ms + stale_ms of their API, or an API that is not cached anymore. ]*/
+TEST_FUNCTION(adding_an_entry_evicts_a_FAILED_entry_of_the_bucket)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache_with_buckets(1);
+    IFabricGetNodeListResult* result;
+    FABRIC_NODE_QUERY_DESCRIPTION other_description = { TEST_OTHER_NODE_NAME, NULL };
+    STRICT_EXPECTED_CALL(HFQC10_GetNodeList(test_client, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_TIMEOUT, h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(uint32_t)));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // evicted entry, it has no result
+    setup_fetch_expectations(NULL, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &other_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_040: [ Before adding an entry, the query functions shall evict from its bucket the entries that no other call and no refresh is using and that have nothing to hand out anymore: no result, or a result older than ttl_ms + stale_ms of their API, or an API that is not cached anymore. ]*/
+TEST_FUNCTION(adding_an_entry_keeps_an_entry_of_the_bucket_that_can_still_be_handed_out)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache_with_buckets(1);
+    IFabricGetNodeListResult* result;
+    FABRIC_NODE_QUERY_DESCRIPTION other_description = { TEST_OTHER_NODE_NAME, NULL };
+    test_get_node_list(cache, &test_result_1_ptr);
+    test_now = TEST_TTL_MS - 1;
+
+    setup_lookup_expectations(true);
+    setup_fetch_expectations(NULL, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &other_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+    setup_read_expectations(&test_result_1);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result));
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_040: [ Before adding an entry, the query functions shall evict from its bucket the entries that no other call and no refresh is using and that have nothing to hand out anymore: no result, or a result older than ttl_ms + stale_ms of their API, or an API that is not cached anymore. ]*/
+TEST_FUNCTION(adding_an_entry_keeps_an_old_entry_of_the_bucket_that_has_a_refresh_scheduled)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache_with_buckets(1);
+    IFabricGetNodeListResult* result;
+    FABRIC_NODE_QUERY_DESCRIPTION other_description = { TEST_OTHER_NODE_NAME, NULL };
+    test_start_refresh(cache);
+    test_now = TEST_TTL_MS + TEST_STALE_MS;
+
+    setup_lookup_expectations(true);
+    setup_fetch_expectations(NULL, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &other_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_QUERY_CACHE_01_040: [ Before adding an entry, the query functions shall evict from its bucket the entries that no other call and no refresh is using and that have nothing to hand out anymore: no result, or a result older than ttl_ms + stale_ms of their API, or an API that is not cached anymore. ]*/
+TEST_FUNCTION(adding_an_entry_evicts_the_entries_of_an_API_that_is_not_cached_anymore)
+{
+    ///arrange
+    H_FABRIC_QUERY_CACHE_HANDLE cache = test_create_cache_with_buckets(1);
+    IFabricGetClusterLoadInformationResult* cluster_load;
+    IFabricGetNodeListResult* result;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_query_cache_configure(cache, H_FABRIC_QUERY_CACHE_API_GET_CLUSTER_LOAD_INFORMATION, TEST_TTL_MS, TEST_STALE_MS));
+    STRICT_EXPECTED_CALL(HFQC10_GetClusterLoadInformation(test_client, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_result(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_query_cache_GetClusterLoadInformation(cache, TEST_TIMEOUT, &cluster_load));
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_query_cache_configure(cache, H_FABRIC_QUERY_CACHE_API_GET_CLUSTER_LOAD_INFORMATION, 0, 0));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(uint32_t)));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result_1));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // evicted entry
+    setup_fetch_expectations(NULL, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_query_cache_GetNodeList(cache, &test_description, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_query_cache_destroy(cache);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
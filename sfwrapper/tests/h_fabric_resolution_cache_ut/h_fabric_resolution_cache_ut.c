@@ -0,0 +1,1451 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+#include "fabricclient.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_bool.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_wcharptr.h"
+#include "umock_c/umocktypes_windows.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/srw_lock.h"
+#include "c_pal/sync.h"
+#include "c_pal/thandle.h"
+#include "c_pal/threadpool.h"
+#include "c_pal/timer.h"
+
+#include "hfabricservicemanagementclient6.h"
+
+#define GBALLOC_HL_REDIRECT_H
+#include "h_fabric_resolution_change_handler.h"
+#include "com_wrapper/com_wrapper.h"
+#include "h_fabric_resolution_change_handler_com.h"
+#include "../../src/h_fabric_resolution_change_handler_com.c"
+#undef GBALLOC_HL_REDIRECT_H
+
+#include "c_pal/gballoc_hl_redirect.h"
+
+MOCKABLE_FUNCTION(, ULONG, test_result_AddRef, IFabricResolvedServicePartitionResult*, This);
+MOCKABLE_FUNCTION(, ULONG, test_result_Release, IFabricResolvedServicePartitionResult*, This);
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "h_fabric_resolution_cache.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT_VALUES);
+
+#define TEST_SERVICE_NAME L"fabric:/app/svc"
+#define TEST_TIMEOUT 1000
+#define TEST_IDLE_MS 60000
+
+static H_FABRIC_HANDLE(IFabricServiceManagementClient6) test_client = (H_FABRIC_HANDLE(IFabricServiceManagementClient6))0x4242;
+static SRW_LOCK_HANDLE test_lock = (SRW_LOCK_HANDLE)0x4243;
+static H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE test_change_handler = (H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE)0x4244;
+#define TEST_THREADPOOL ((THANDLE(THREADPOOL))0x4245)
+
+/*fake resolved partitions, only AddRef and Release are ever called by the cache*/
+static IFabricResolvedServicePartitionResultVtbl test_result_vtbl =
+{
+    .AddRef = test_result_AddRef,
+    .Release = test_result_Release
+};
+static IFabricResolvedServicePartitionResult test_result_1 = { &test_result_vtbl };
+static IFabricResolvedServicePartitionResult test_result_2 = { &test_result_vtbl };
+static IFabricResolvedServicePartitionResult* test_result_1_ptr = &test_result_1;
+static IFabricResolvedServicePartitionResult* test_result_2_ptr = &test_result_2;
+
+/*the time as seen by the cache*/
+static double test_now;
+
+static double hook_timer_global_get_elapsed_ms(void)
+{
+    return test_now;
+}
+
+/*THANDLE(THREADPOOL) is mocked, the cache still needs to hold the threadpool it is given*/
+static void hook_THANDLE_INITIALIZE_THREADPOOL(THANDLE(THREADPOOL)* t1, THANDLE(THREADPOOL) t2)
+{
+    *(THREADPOOL const**)t1 = t2;
+}
+
+static void hook_THANDLE_ASSIGN_THREADPOOL(THANDLE(THREADPOOL)* t1, THANDLE(THREADPOOL) t2)
+{
+    *(THREADPOOL const**)t1 = t2;
+}
+
+/*the work item runs before threadpool_schedule_work returns*/
+static int hook_threadpool_schedule_work(THANDLE(THREADPOOL) threadpool, THREADPOOL_WORK_FUNCTION work_function, void* work_function_context)
+{
+    (void)threadpool;
+    work_function(work_function_context);
+    return 0;
+}
+
+/*the resolving thread finishes (leaving its result STALE) while the nested resolve waits for it. 0 is RESOLUTION_CACHE_ENTRY_STATE_STALE*/
+static INTERLOCKED_HL_RESULT hook_InterlockedHL_WaitForNotValue_resolving_thread_leaves_the_entry_stale(int32_t volatile_atomic* address_to_check, int32_t value_to_wait, uint32_t timeout_ms)
+{
+    (void)value_to_wait;
+    (void)timeout_ms;
+    (void)interlocked_exchange(address_to_check, 0);
+    return INTERLOCKED_HL_OK;
+}
+
+static ON_RESOLUTION_CHANGE captured_on_resolution_change;
+static void* captured_on_resolution_change_context;
+
+static H_FABRIC_RESOLUTION_CACHE_HANDLE nested_cache;
+static HRESULT nested_result;
+
+static HRESULT hook_HFSMC6_ResolveServicePartition_with_nested_resolve(H_FABRIC_HANDLE(IFabricServiceManagementClient6) h_fabric_handle, FABRIC_URI name, FABRIC_PARTITION_KEY_TYPE partitionKeyType, const void* partitionKey, IFabricResolvedServicePartitionResult* previousResult, DWORD timeoutMilliseconds, IFabricResolvedServicePartitionResult** resolveServicePartitionResult)
+{
+    (void)h_fabric_handle;
+    (void)previousResult;
+    IFabricResolvedServicePartitionResult* result;
+    /*a second caller asks for the same partition while the first one is resolving it*/
+    nested_result = h_fabric_resolution_cache_resolve(nested_cache, name, partitionKeyType, partitionKey, timeoutMilliseconds, &result);
+    *resolveServicePartitionResult = &test_result_1;
+    return S_OK;
+}
+
+static void hook_h_fabric_resolution_change_handler_close_with_a_notification_in_progress(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE h_fabric_resolution_change_handler)
+{
+    (void)h_fabric_resolution_change_handler;
+    /*a notification SF started delivering before the unregister finishes while destroy waits for it, the entry has to be still there*/
+    captured_on_resolution_change(captured_on_resolution_change_context, 42, &test_result_2, S_OK);
+}
+
+static void setup_create_cache_expectations(void)
+{
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 1, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(calloc(1 * 4, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_resolution_cache"));
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(IGNORED_ARG, TEST_THREADPOOL));
+}
+
+static H_FABRIC_RESOLUTION_CACHE_HANDLE test_create_cache(void)
+{
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = h_fabric_resolution_cache_create(test_client, TEST_THREADPOOL, 1, 4, TEST_IDLE_MS);
+    ASSERT_IS_NOT_NULL(cache);
+    umock_c_reset_all_calls();
+    return cache;
+}
+
+/*all the entries land in the same bucket, so adding one looks at all the others for eviction*/
+static H_FABRIC_RESOLUTION_CACHE_HANDLE test_create_cache_with_one_bucket(void)
+{
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = h_fabric_resolution_cache_create(test_client, TEST_THREADPOOL, 1, 1, TEST_IDLE_MS);
+    ASSERT_IS_NOT_NULL(cache);
+    umock_c_reset_all_calls();
+    return cache;
+}
+
+static void test_resolve_int64_key(H_FABRIC_RESOLUTION_CACHE_HANDLE cache, LONGLONG key, IFabricResolvedServicePartitionResult** resolved, HRESULT expected_hr)
+{
+    IFabricResolvedServicePartitionResult* result;
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, IGNORED_ARG, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(resolved, sizeof(*resolved))
+        .SetReturn(expected_hr);
+    ASSERT_ARE_EQUAL(HRESULT, expected_hr, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+}
+
+static void setup_resolve_miss_expectations(IFabricResolvedServicePartitionResult* previous, IFabricResolvedServicePartitionResult** resolved)
+{
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    if (previous == NULL)
+    {
+        STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+        STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+        STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+        STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+        STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+        STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_create(IGNORED_ARG, IGNORED_ARG))
+            .CaptureArgumentValue_on_resolution_change(&captured_on_resolution_change)
+            .CaptureArgumentValue_on_resolution_change_context(&captured_on_resolution_change_context);
+        STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler(test_change_handler, IGNORED_ARG));
+        STRICT_EXPECTED_CALL(HFSMC6_RegisterServicePartitionResolutionChangeHandler(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, IGNORED_ARG, IGNORED_ARG));
+    }
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, previous, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(resolved, sizeof(*resolved));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    if (previous != NULL)
+    {
+        STRICT_EXPECTED_CALL(test_result_Release(previous));
+    }
+    STRICT_EXPECTED_CALL(test_result_AddRef(*resolved));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+}
+
+static void test_resolve_and_release(H_FABRIC_RESOLUTION_CACHE_HANDLE cache)
+{
+    IFabricResolvedServicePartitionResult* result;
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+}
+
+static void setup_entry_destroy_expectations(IFabricResolvedServicePartitionResult* cached)
+{
+    STRICT_EXPECTED_CALL(HFSMC6_UnregisterServicePartitionResolutionChangeHandler(test_client, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_close(test_change_handler));
+    STRICT_EXPECTED_CALL(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler_Release(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_destroy(test_change_handler));
+    if (cached != NULL)
+    {
+        STRICT_EXPECTED_CALL(test_result_Release(cached));
+    }
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // entry
+}
+
+static void setup_destroy_with_one_entry_expectations(IFabricResolvedServicePartitionResult* cached)
+{
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX));
+    setup_entry_destroy_expectations(cached);
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // buckets
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // cache
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types(), "umocktypes_bool_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types(), "umocktypes_charptr_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types(), "umocktypes_stdint_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_wcharptr_register_types(), "umocktypes_wcharptr_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types(), "umocktypes_windows_register_types");
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(malloc_flex, NULL);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(calloc, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(srw_lock_create, test_lock, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(h_fabric_resolution_change_handler_create, test_change_handler, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(HFSMC6_RegisterServicePartitionResolutionChangeHandler, S_OK, E_FAIL);
+    REGISTER_GLOBAL_MOCK_RETURNS(HFSMC6_UnregisterServicePartitionResolutionChangeHandler, S_OK, E_FAIL);
+    REGISTER_GLOBAL_MOCK_RETURNS(HFSMC6_ResolveServicePartition, S_OK, FABRIC_E_SERVICE_DOES_NOT_EXIST);
+    REGISTER_GLOBAL_MOCK_RETURNS(InterlockedHL_WaitForNotValue, INTERLOCKED_HL_OK, INTERLOCKED_HL_ERROR);
+    REGISTER_GLOBAL_MOCK_RETURNS(InterlockedHL_WaitForValue, INTERLOCKED_HL_OK, INTERLOCKED_HL_ERROR);
+    REGISTER_GLOBAL_MOCK_HOOK(THANDLE_INITIALIZE(THREADPOOL), hook_THANDLE_INITIALIZE_THREADPOOL);
+    REGISTER_GLOBAL_MOCK_HOOK(THANDLE_ASSIGN(THREADPOOL), hook_THANDLE_ASSIGN_THREADPOOL);
+    REGISTER_GLOBAL_MOCK_HOOK(threadpool_schedule_work, hook_threadpool_schedule_work);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(threadpool_schedule_work, MU_FAILURE);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_AddRef, 2);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_Release, 1);
+    REGISTER_GLOBAL_MOCK_HOOK(timer_global_get_elapsed_ms, hook_timer_global_get_elapsed_ms);
+
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(LONGLONG, long long);
+    REGISTER_UMOCK_ALIAS_TYPE(FABRIC_URI, const wchar_t*);
+    REGISTER_UMOCK_ALIAS_TYPE(FABRIC_PARTITION_KEY_TYPE, int);
+    REGISTER_UMOCK_ALIAS_TYPE(SRW_LOCK_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THANDLE(THREADPOOL), void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THREADPOOL_WORK_FUNCTION, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(ON_RESOLUTION_CHANGE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_DESTROY_FUNC, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_HANDLE(IFabricServiceManagementClient6), void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricServicePartitionResolutionChangeHandler*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricResolvedServicePartitionResult*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricResolvedServicePartitionResult**, void*);
+
+    REGISTER_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    test_now = 0;
+    captured_on_resolution_change = NULL;
+    captured_on_resolution_change_context = NULL;
+    REGISTER_GLOBAL_MOCK_HOOK(h_fabric_resolution_change_handler_close, NULL);
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForNotValue, NULL);
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/*h_fabric_resolution_cache_create*/
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_001: [ If client is NULL then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_create_with_client_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache;
+
+    ///act
+    cache = h_fabric_resolution_cache_create(NULL, TEST_THREADPOOL, 1, 4, TEST_IDLE_MS);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_044: [ If threadpool is NULL then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_create_with_threadpool_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache;
+
+    ///act
+    cache = h_fabric_resolution_cache_create(test_client, NULL, 1, 4, TEST_IDLE_MS);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_002: [ If shard_count is 0 then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_create_with_shard_count_0_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache;
+
+    ///act
+    cache = h_fabric_resolution_cache_create(test_client, TEST_THREADPOOL, 0, 4, TEST_IDLE_MS);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_003: [ If buckets_per_shard is 0 then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_create_with_buckets_per_shard_0_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache;
+
+    ///act
+    cache = h_fabric_resolution_cache_create(test_client, TEST_THREADPOOL, 1, 0, TEST_IDLE_MS);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_040: [ If idle_ms is 0 then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_create_with_idle_ms_0_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache;
+
+    ///act
+    cache = h_fabric_resolution_cache_create(test_client, TEST_THREADPOOL, 1, 4, 0);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_004: [ h_fabric_resolution_cache_create shall allocate memory for the cache and its shard_count shards. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_005: [ h_fabric_resolution_cache_create shall allocate shard_count * buckets_per_shard empty buckets. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_006: [ h_fabric_resolution_cache_create shall create a lock for each shard by calling srw_lock_create. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_045: [ h_fabric_resolution_cache_create shall keep a reference on threadpool by calling THANDLE_INITIALIZE(THREADPOOL). ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_007: [ h_fabric_resolution_cache_create shall succeed and return a non-NULL handle. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_create_succeeds)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache;
+    setup_create_cache_expectations();
+
+    ///act
+    cache = h_fabric_resolution_cache_create(test_client, TEST_THREADPOOL, 1, 4, TEST_IDLE_MS);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_006: [ h_fabric_resolution_cache_create shall create a lock for each shard by calling srw_lock_create. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_create_with_3_shards_creates_3_locks)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 3, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(calloc(3 * 2, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_resolution_cache"));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_resolution_cache"));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_resolution_cache"));
+    STRICT_EXPECTED_CALL(THANDLE_INITIALIZE(THREADPOOL)(IGNORED_ARG, TEST_THREADPOOL));
+
+    ///act
+    cache = h_fabric_resolution_cache_create(test_client, TEST_THREADPOOL, 3, 2, TEST_IDLE_MS);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_008: [ If there are any failures then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(when_the_second_srw_lock_create_fails_h_fabric_resolution_cache_create_destroys_the_first_lock)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache;
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 2, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(calloc(2 * 4, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_resolution_cache"));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "h_fabric_resolution_cache"))
+        .SetReturn(NULL);
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    cache = h_fabric_resolution_cache_create(test_client, TEST_THREADPOOL, 2, 4, TEST_IDLE_MS);
+
+    ///assert
+    ASSERT_IS_NULL(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_008: [ If there are any failures then h_fabric_resolution_cache_create shall fail and return NULL. ]*/
+TEST_FUNCTION(when_underlying_calls_fail_h_fabric_resolution_cache_create_also_fails)
+{
+    ///arrange
+    setup_create_cache_expectations();
+
+    umock_c_negative_tests_snapshot();
+
+    for (size_t i = 0; i < umock_c_negative_tests_call_count(); i++)
+    {
+        if (umock_c_negative_tests_can_call_fail(i))
+        {
+            umock_c_negative_tests_reset();
+            umock_c_negative_tests_fail_call(i);
+
+            ///act
+            H_FABRIC_RESOLUTION_CACHE_HANDLE cache = h_fabric_resolution_cache_create(test_client, TEST_THREADPOOL, 1, 4, TEST_IDLE_MS);
+
+            ///assert
+            ASSERT_IS_NULL(cache, "On failed call %zu", i);
+        }
+    }
+}
+
+/*h_fabric_resolution_cache_destroy*/
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_009: [ If cache is NULL then h_fabric_resolution_cache_destroy shall return. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_destroy_with_cache_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_resolution_cache_destroy(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_046: [ h_fabric_resolution_cache_destroy shall wait for the work items releasing evicted entries to finish by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_012: [ h_fabric_resolution_cache_destroy shall destroy the shard locks and free the memory used by the cache. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_048: [ h_fabric_resolution_cache_destroy shall release its reference on threadpool by calling THANDLE_ASSIGN(THREADPOOL) with NULL. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_destroy_of_an_empty_cache_frees_everything)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX));
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(cache));
+
+    ///act
+    h_fabric_resolution_cache_destroy(cache);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_010: [ For each entry, h_fabric_resolution_cache_destroy shall unregister its change handler by calling H_FABRIC_API(FSMC6_UnregisterServicePartitionResolutionChangeHandler) and release it. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_011: [ For each entry, h_fabric_resolution_cache_destroy shall release the cached result and free the entry. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_012: [ h_fabric_resolution_cache_destroy shall destroy the shard locks and free the memory used by the cache. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_destroy_unregisters_and_releases_the_entries)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    setup_resolve_miss_expectations(NULL, &test_result_1_ptr);
+    test_resolve_and_release(cache);
+
+    setup_destroy_with_one_entry_expectations(&test_result_1);
+
+    ///act
+    h_fabric_resolution_cache_destroy(cache);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_010: [ For each entry, h_fabric_resolution_cache_destroy shall unregister its change handler by calling H_FABRIC_API(FSMC6_UnregisterServicePartitionResolutionChangeHandler) and release it. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_destroy_releases_the_change_handler_even_when_unregister_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    setup_resolve_miss_expectations(NULL, &test_result_1_ptr);
+    test_resolve_and_release(cache);
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX));
+    STRICT_EXPECTED_CALL(HFSMC6_UnregisterServicePartitionResolutionChangeHandler(test_client, IGNORED_ARG))
+        .SetReturn(FABRIC_E_OBJECT_CLOSED);
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_close(test_change_handler));
+    STRICT_EXPECTED_CALL(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler_Release(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_destroy(test_change_handler));
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result_1));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(cache));
+
+    ///act
+    h_fabric_resolution_cache_destroy(cache);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_039: [ h_fabric_resolution_cache_destroy shall close the change handler of each entry by calling h_fabric_resolution_change_handler_close before freeing the entry. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_destroy_frees_the_entry_only_after_a_notification_in_progress_finished)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    setup_resolve_miss_expectations(NULL, &test_result_1_ptr);
+    test_resolve_and_release(cache);
+    REGISTER_GLOBAL_MOCK_HOOK(h_fabric_resolution_change_handler_close, hook_h_fabric_resolution_change_handler_close_with_a_notification_in_progress);
+
+    setup_destroy_with_one_entry_expectations(&test_result_1);
+
+    ///act
+    h_fabric_resolution_cache_destroy(cache);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*h_fabric_resolution_cache_resolve*/
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_013: [ If cache is NULL then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_with_cache_NULL_fails)
+{
+    ///arrange
+    IFabricResolvedServicePartitionResult* result;
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(NULL, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_014: [ If name is NULL then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_with_name_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, NULL, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_015: [ If resolveServicePartitionResult is NULL then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_with_resolveServicePartitionResult_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_016: [ If partitionKeyType is not FABRIC_PARTITION_KEY_TYPE_NONE, FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, or partitionKey is NULL for FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_with_INT64_key_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_016: [ If partitionKeyType is not FABRIC_PARTITION_KEY_TYPE_NONE, FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, or partitionKey is NULL for FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_with_STRING_key_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_STRING, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_016: [ If partitionKeyType is not FABRIC_PARTITION_KEY_TYPE_NONE, FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, or partitionKey is NULL for FABRIC_PARTITION_KEY_TYPE_INT64 or FABRIC_PARTITION_KEY_TYPE_STRING, then h_fabric_resolution_cache_resolve shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_with_INVALID_key_type_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INVALID, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_017: [ h_fabric_resolution_cache_resolve shall look up the entry for name and partitionKey in its shard under the shared shard lock and, if the entry is RESOLVED, AddRef the cached result, return it in resolveServicePartitionResult and return S_OK. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_018: [ If there is no entry, h_fabric_resolution_cache_resolve shall add a STALE entry for name and partitionKey under the exclusive shard lock (unless another thread added it meanwhile). ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_019: [ If the entry is not watched for changes yet, h_fabric_resolution_cache_resolve shall create a change handler by calling h_fabric_resolution_change_handler_create and COM_WRAPPER_CREATE. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_020: [ h_fabric_resolution_cache_resolve shall register the change handler by calling H_FABRIC_API(FSMC6_RegisterServicePartitionResolutionChangeHandler). ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_022: [ h_fabric_resolution_cache_resolve shall call H_FABRIC_API(FSMC6_ResolveServicePartition) passing the result cached so far (if any) as previousResult. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_024: [ h_fabric_resolution_cache_resolve shall replace the cached result with the new one under the exclusive shard lock and release the previous result. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_025: [ h_fabric_resolution_cache_resolve shall AddRef the new result and return it in resolveServicePartitionResult. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_027: [ h_fabric_resolution_cache_resolve shall wake all the threads waiting for the entry. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_033: [ Otherwise h_fabric_resolution_cache_resolve shall switch the entry to RESOLVING. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_on_a_miss_asks_SF_and_watches_for_changes)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+    setup_resolve_miss_expectations(NULL, &test_result_1_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(captured_on_resolution_change);
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_026: [ If the entry is watched for changes and no change was notified while resolving, h_fabric_resolution_cache_resolve shall switch the entry to RESOLVED, otherwise to STALE. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_017: [ h_fabric_resolution_cache_resolve shall look up the entry for name and partitionKey in its shard under the shared shard lock and, if the entry is RESOLVED, AddRef the cached result, return it in resolveServicePartitionResult and return S_OK. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_on_a_hit_returns_the_cached_result_without_asking_SF)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+    setup_resolve_miss_expectations(NULL, &test_result_1_ptr);
+    test_resolve_and_release(cache);
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_1));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_018: [ If there is no entry, h_fabric_resolution_cache_resolve shall add a STALE entry for name and partitionKey under the exclusive shard lock (unless another thread added it meanwhile). ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_keeps_different_int64_keys_apart)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+    LONGLONG key_1 = 1;
+    LONGLONG key_2 = 2;
+
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key_1, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_create(IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler(test_change_handler, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_RegisterServicePartitionResolutionChangeHandler(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, IGNORED_ARG, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_2_ptr, sizeof(test_result_2_ptr));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_2));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key_2, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_017: [ h_fabric_resolution_cache_resolve shall look up the entry for name and partitionKey in its shard under the shared shard lock and, if the entry is RESOLVED, AddRef the cached result, return it in resolveServicePartitionResult and return S_OK. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_with_the_same_string_key_hits)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+    wchar_t key_1[] = L"partition";
+    wchar_t key_2[] = L"partition"; /*same value, different address*/
+
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_STRING, IGNORED_ARG, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_STRING, key_1, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_1));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_STRING, key_2, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_022: [ h_fabric_resolution_cache_resolve shall call H_FABRIC_API(FSMC6_ResolveServicePartition) passing the result cached so far (if any) as previousResult. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_024: [ h_fabric_resolution_cache_resolve shall replace the cached result with the new one under the exclusive shard lock and release the previous result. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_030: [ When the resolution of a partition changes, h_fabric_resolution_cache shall increment the number of changes of the entry and switch it from RESOLVED to STALE. ]*/
+TEST_FUNCTION(after_a_change_notification_h_fabric_resolution_cache_resolve_asks_SF_again_passing_the_previous_result)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+    setup_resolve_miss_expectations(NULL, &test_result_1_ptr);
+    test_resolve_and_release(cache);
+
+    captured_on_resolution_change(captured_on_resolution_change_context, 42, &test_result_2, S_OK);
+
+    setup_resolve_miss_expectations(&test_result_1, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_026: [ If the entry is watched for changes and no change was notified while resolving, h_fabric_resolution_cache_resolve shall switch the entry to RESOLVED, otherwise to STALE. ]*/
+TEST_FUNCTION(a_change_notified_while_resolving_makes_the_next_h_fabric_resolution_cache_resolve_ask_SF_again)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_create(IGNORED_ARG, IGNORED_ARG))
+        .CaptureArgumentValue_on_resolution_change(&captured_on_resolution_change)
+        .CaptureArgumentValue_on_resolution_change_context(&captured_on_resolution_change_context);
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result));
+    /*the change notification races the resolve that just finished: the entry is switched to STALE whether or not it was RESOLVED already*/
+    captured_on_resolution_change(captured_on_resolution_change_context, 42, &test_result_2, S_OK);
+    umock_c_reset_all_calls();
+
+    setup_resolve_miss_expectations(&test_result_1, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_021: [ If registering the change handler fails then h_fabric_resolution_cache_resolve shall still resolve the partition, but the result shall not be served from the cache. ]*/
+TEST_FUNCTION(when_registering_the_change_handler_fails_h_fabric_resolution_cache_resolve_succeeds_but_does_not_cache)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_create(IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler(test_change_handler, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_RegisterServicePartitionResolutionChangeHandler(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    STRICT_EXPECTED_CALL(H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler_Release(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_destroy(test_change_handler));
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_1));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result_1));
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_021: [ If registering the change handler fails then h_fabric_resolution_cache_resolve shall still resolve the partition, but the result shall not be served from the cache. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_052: [ If registering the change handler fails then h_fabric_resolution_cache_resolve shall double the backoff of the entry (starting at 1 second, up to 1 minute). ]*/
+TEST_FUNCTION(once_the_backoff_elapsed_h_fabric_resolution_cache_resolve_retries_registering_the_change_handler)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    STRICT_EXPECTED_CALL(HFSMC6_RegisterServicePartitionResolutionChangeHandler(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    test_now = 1000;
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_create(IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler(test_change_handler, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_RegisterServicePartitionResolutionChangeHandler(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, &test_result_1, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_2_ptr, sizeof(test_result_2_ptr));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result_1));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_2));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_051: [ If the entry is not watched for changes yet and registering its change handler failed less than the backoff of the entry ago (measured by timer_global_get_elapsed_ms), h_fabric_resolution_cache_resolve shall not register it. ]*/
+TEST_FUNCTION(within_the_backoff_h_fabric_resolution_cache_resolve_does_not_retry_registering_the_change_handler)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    STRICT_EXPECTED_CALL(HFSMC6_RegisterServicePartitionResolutionChangeHandler(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(FABRIC_E_TIMEOUT);
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    test_now = 999;
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, &test_result_1, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_2_ptr, sizeof(test_result_2_ptr));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result_1));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_2));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result_2));
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_051: [ If the entry is not watched for changes yet and registering its change handler failed less than the backoff of the entry ago (measured by timer_global_get_elapsed_ms), h_fabric_resolution_cache_resolve shall not register it. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_052: [ If registering the change handler fails then h_fabric_resolution_cache_resolve shall double the backoff of the entry (starting at 1 second, up to 1 minute). ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_doubles_the_backoff_when_registering_the_change_handler_fails_again)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    REGISTER_GLOBAL_MOCK_RETURN(HFSMC6_RegisterServicePartitionResolutionChangeHandler, FABRIC_E_TIMEOUT);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result));
+    test_now = 1000;
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    /*the second failure, at 1000, keeps the entry from registering for 2000 ms*/
+    test_now = 2999;
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, IGNORED_ARG, TEST_TIMEOUT, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_Release(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_result_AddRef(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    REGISTER_GLOBAL_MOCK_RETURN(HFSMC6_RegisterServicePartitionResolutionChangeHandler, S_OK);
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_023: [ If H_FABRIC_API(FSMC6_ResolveServicePartition) fails then h_fabric_resolution_cache_resolve shall record the error, switch the entry to FAILED and return the error. ]*/
+TEST_FUNCTION(when_FSMC6_ResolveServicePartition_fails_h_fabric_resolution_cache_resolve_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_create(IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler(test_change_handler, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_RegisterServicePartitionResolutionChangeHandler(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_SERVICE_DOES_NOT_EXIST);
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_SERVICE_DOES_NOT_EXIST, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    setup_destroy_with_one_entry_expectations(NULL);
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_023: [ If H_FABRIC_API(FSMC6_ResolveServicePartition) fails then h_fabric_resolution_cache_resolve shall record the error, switch the entry to FAILED and return the error. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_033: [ Otherwise h_fabric_resolution_cache_resolve shall switch the entry to RESOLVING. ]*/
+TEST_FUNCTION(after_FSMC6_ResolveServicePartition_failed_h_fabric_resolution_cache_resolve_asks_SF_again)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .SetReturn(FABRIC_E_SERVICE_DOES_NOT_EXIST);
+    ASSERT_ARE_EQUAL(HRESULT, FABRIC_E_SERVICE_DOES_NOT_EXIST, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_1));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_1, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_031: [ If there are any failures then h_fabric_resolution_cache_resolve shall fail and return an error. ]*/
+TEST_FUNCTION(when_adding_the_entry_fails_h_fabric_resolution_cache_resolve_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)))
+        .SetReturn(NULL);
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, E_OUTOFMEMORY, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_028: [ If another thread is resolving the entry then h_fabric_resolution_cache_resolve shall wait for it by calling InterlockedHL_WaitForNotValue. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_031: [ If there are any failures then h_fabric_resolution_cache_resolve shall fail and return an error. ]*/
+TEST_FUNCTION(when_waiting_for_the_resolving_thread_fails_h_fabric_resolution_cache_resolve_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+    nested_cache = cache;
+    nested_result = S_OK;
+
+    REGISTER_GLOBAL_MOCK_HOOK(HFSMC6_ResolveServicePartition, hook_HFSMC6_ResolveServicePartition_with_nested_resolve);
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, NULL, TEST_TIMEOUT, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForNotValue(IGNORED_ARG, 1, UINT32_MAX))
+        .SetReturn(INTERLOCKED_HL_ERROR);
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(HRESULT, E_FAIL, nested_result);
+
+    ///clean
+    REGISTER_GLOBAL_MOCK_HOOK(HFSMC6_ResolveServicePartition, NULL);
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_050: [ If the thread that was waited for succeeded but left the entry STALE (it is not watched, or it changed meanwhile) then h_fabric_resolution_cache_resolve shall AddRef the result of that thread, return it in resolveServicePartitionResult and return S_OK without asking SF again. ]*/
+TEST_FUNCTION(when_the_resolving_thread_leaves_the_entry_stale_h_fabric_resolution_cache_resolve_returns_its_result)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+    nested_cache = cache;
+    nested_result = E_FAIL;
+
+    /*the entry is not watched, so every resolve leaves it STALE*/
+    REGISTER_GLOBAL_MOCK_RETURN(HFSMC6_RegisterServicePartitionResolutionChangeHandler, FABRIC_E_TIMEOUT);
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_1_ptr, sizeof(test_result_1_ptr));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    REGISTER_GLOBAL_MOCK_HOOK(HFSMC6_ResolveServicePartition, hook_HFSMC6_ResolveServicePartition_with_nested_resolve);
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForNotValue, hook_InterlockedHL_WaitForNotValue_resolving_thread_leaves_the_entry_stale);
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForNotValue(IGNORED_ARG, 1, UINT32_MAX));
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, nested_result);
+
+    ///clean
+    REGISTER_GLOBAL_MOCK_HOOK(HFSMC6_ResolveServicePartition, NULL);
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForNotValue, NULL);
+    REGISTER_GLOBAL_MOCK_RETURN(HFSMC6_RegisterServicePartitionResolutionChangeHandler, S_OK);
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+static void setup_add_int64_entry_expectations(bool evicts, IFabricResolvedServicePartitionResult* evicted_result, IFabricResolvedServicePartitionResult** resolved)
+{
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    if (evicts)
+    {
+        STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG));
+        setup_entry_destroy_expectations(evicted_result);
+        STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    }
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_create(IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler(test_change_handler, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_RegisterServicePartitionResolutionChangeHandler(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, IGNORED_ARG, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(resolved, sizeof(*resolved));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_AddRef(*resolved));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_042: [ Before adding an entry, h_fabric_resolution_cache_resolve shall evict from its bucket the entries that no other call is using and that have no result or were not resolved for idle_ms. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_043: [ Once the exclusive shard lock is released, h_fabric_resolution_cache_resolve shall add the evicted entries to the evicted entries of the cache and call threadpool_schedule_work with a work item that unregisters and closes the change handlers of the evicted entries, releases their results and frees them. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_evicts_an_entry_not_resolved_for_idle_ms)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache_with_one_bucket();
+    IFabricResolvedServicePartitionResult* result;
+    LONGLONG key_2 = 2;
+    test_resolve_int64_key(cache, 1, &test_result_1_ptr, S_OK);
+
+    test_now = TEST_IDLE_MS;
+    setup_add_int64_entry_expectations(true, &test_result_1, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key_2, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    setup_destroy_with_one_entry_expectations(&test_result_2);
+    h_fabric_resolution_cache_destroy(cache);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_049: [ If threadpool_schedule_work fails then h_fabric_resolution_cache_resolve shall leave the evicted entries to the next work item or to h_fabric_resolution_cache_destroy. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_047: [ h_fabric_resolution_cache_destroy shall release the evicted entries that no work item released (because scheduling it failed) like the entries of the buckets. ]*/
+TEST_FUNCTION(when_scheduling_the_release_of_an_evicted_entry_fails_h_fabric_resolution_cache_destroy_releases_it)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache_with_one_bucket();
+    IFabricResolvedServicePartitionResult* result;
+    LONGLONG key_2 = 2;
+    test_resolve_int64_key(cache, 1, &test_result_1_ptr, S_OK);
+
+    test_now = TEST_IDLE_MS;
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, sizeof(wchar_t)));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(threadpool_schedule_work(TEST_THREADPOOL, IGNORED_ARG, IGNORED_ARG))
+        .SetReturn(MU_FAILURE);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(h_fabric_resolution_change_handler_create(IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE_IFabricServicePartitionResolutionChangeHandler(test_change_handler, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_RegisterServicePartitionResolutionChangeHandler(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(HFSMC6_ResolveServicePartition(test_client, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, IGNORED_ARG, NULL, TEST_TIMEOUT, IGNORED_ARG))
+        .CopyOutArgumentBuffer_resolveServicePartitionResult(&test_result_2_ptr, sizeof(test_result_2_ptr));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result_2));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key_2, TEST_TIMEOUT, &result));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 0, UINT32_MAX));
+    setup_entry_destroy_expectations(&test_result_1); // evicted
+    setup_entry_destroy_expectations(&test_result_2);
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(THANDLE_ASSIGN(THREADPOOL)(IGNORED_ARG, NULL));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // buckets
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // cache
+
+    ///act
+    h_fabric_resolution_cache_destroy(cache);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_042: [ Before adding an entry, h_fabric_resolution_cache_resolve shall evict from its bucket the entries that no other call is using and that have no result or were not resolved for idle_ms. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_does_not_evict_an_entry_resolved_less_than_idle_ms_ago)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache_with_one_bucket();
+    IFabricResolvedServicePartitionResult* result;
+    LONGLONG key_2 = 2;
+    test_resolve_int64_key(cache, 1, &test_result_1_ptr, S_OK);
+
+    test_now = TEST_IDLE_MS - 1;
+    setup_add_int64_entry_expectations(false, NULL, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key_2, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_041: [ h_fabric_resolution_cache_resolve shall mark the entry as used. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_042: [ Before adding an entry, h_fabric_resolution_cache_resolve shall evict from its bucket the entries that no other call is using and that have no result or were not resolved for idle_ms. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_does_not_evict_an_entry_hit_since_the_last_eviction)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache_with_one_bucket();
+    IFabricResolvedServicePartitionResult* result;
+    LONGLONG key_1 = 1;
+    LONGLONG key_2 = 2;
+    test_resolve_int64_key(cache, key_1, &test_result_1_ptr, S_OK);
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key_1, TEST_TIMEOUT, &result));
+    umock_c_reset_all_calls();
+
+    test_now = TEST_IDLE_MS;
+    setup_add_int64_entry_expectations(false, NULL, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key_2, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_042: [ Before adding an entry, h_fabric_resolution_cache_resolve shall evict from its bucket the entries that no other call is using and that have no result or were not resolved for idle_ms. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_043: [ Once the exclusive shard lock is released, h_fabric_resolution_cache_resolve shall add the evicted entries to the evicted entries of the cache and call threadpool_schedule_work with a work item that unregisters and closes the change handlers of the evicted entries, releases their results and frees them. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_resolve_evicts_an_entry_that_has_no_result_right_away)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache_with_one_bucket();
+    IFabricResolvedServicePartitionResult* result;
+    LONGLONG key_2 = 2;
+    test_resolve_int64_key(cache, 1, &test_result_1_ptr, FABRIC_E_SERVICE_DOES_NOT_EXIST);
+
+    setup_add_int64_entry_expectations(true, NULL, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, &key_2, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*h_fabric_resolution_cache_invalidate*/
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_034: [ If cache is NULL then h_fabric_resolution_cache_invalidate shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_invalidate_with_cache_NULL_fails)
+{
+    ///arrange
+
+    ///act
+    int result = h_fabric_resolution_cache_invalidate(NULL, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_035: [ If name is NULL then h_fabric_resolution_cache_invalidate shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_invalidate_with_name_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+
+    ///act
+    int result = h_fabric_resolution_cache_invalidate(cache, NULL, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_036: [ If partitionKeyType or partitionKey are invalid then h_fabric_resolution_cache_invalidate shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_invalidate_with_INT64_key_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+
+    ///act
+    int result = h_fabric_resolution_cache_invalidate(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_INT64, NULL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_038: [ h_fabric_resolution_cache_invalidate shall succeed and return 0. ]*/
+TEST_FUNCTION(h_fabric_resolution_cache_invalidate_of_an_unknown_partition_succeeds)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+
+    ///act
+    int result = h_fabric_resolution_cache_invalidate(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_037: [ If the entry for name and partitionKey is RESOLVED then h_fabric_resolution_cache_invalidate shall switch it to STALE, so that the next h_fabric_resolution_cache_resolve asks SF again passing the cached result as previousResult. ]*/
+/*Tests_SRS_H_FABRIC_RESOLUTION_CACHE_01_038: [ h_fabric_resolution_cache_invalidate shall succeed and return 0. ]*/
+TEST_FUNCTION(after_h_fabric_resolution_cache_invalidate_h_fabric_resolution_cache_resolve_asks_SF_again)
+{
+    ///arrange
+    H_FABRIC_RESOLUTION_CACHE_HANDLE cache = test_create_cache();
+    IFabricResolvedServicePartitionResult* result;
+    setup_resolve_miss_expectations(NULL, &test_result_1_ptr);
+    test_resolve_and_release(cache);
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_shared(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_shared(test_lock));
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_resolution_cache_invalidate(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    setup_resolve_miss_expectations(&test_result_1, &test_result_2_ptr);
+
+    ///act
+    HRESULT hr = h_fabric_resolution_cache_resolve(cache, TEST_SERVICE_NAME, FABRIC_PARTITION_KEY_TYPE_NONE, NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result_2, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_resolution_cache_destroy(cache);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,390 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_bool.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umocktypes_windows.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+
+#include "c_util/sm.h"
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "h_fabric_resolution_change_handler.h"
+
+// use fake objects as we do not expect any acting on them by this layer
+static IFabricServiceManagementClient* test_source = (IFabricServiceManagementClient*)0x4243;
+static IFabricResolvedServicePartitionResult* test_partition = (IFabricResolvedServicePartitionResult*)0x4244;
+#define TEST_SM ((SM_HANDLE)0x4245)
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+/*sm is mocked, so its enum strings (used in the logs) are not linked in*/
+MU_DEFINE_ENUM_STRINGS(SM_RESULT, SM_RESULT_VALUES)
+IMPLEMENT_UMOCK_C_ENUM_TYPE(SM_RESULT, SM_RESULT_VALUES);
+
+MOCK_FUNCTION_WITH_CODE(, void, test_on_resolution_change, void*, context, LONGLONG, handlerId, IFabricResolvedServicePartitionResult*, partition, HRESULT, error)
+MOCK_FUNCTION_END()
+
+static H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler_closed_by_callback;
+
+static void hook_test_on_resolution_change_closes_the_handler(void* context, LONGLONG handlerId, IFabricResolvedServicePartitionResult* partition, HRESULT error)
+{
+    (void)context;
+    (void)handlerId;
+    (void)partition;
+    (void)error;
+    /*simulates the owner closing the handler on another thread while the callback runs (sm is mocked, sm_close_begin would wait for sm_exec_end)*/
+    h_fabric_resolution_change_handler_close(handler_closed_by_callback);
+}
+
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+static void setup_create_expectations(void)
+{
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(sm_create(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(sm_open_begin(TEST_SM));
+    STRICT_EXPECTED_CALL(sm_open_end(TEST_SM, true));
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types());
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+
+    REGISTER_UMOCK_ALIAS_TYPE(LONGLONG, long long);
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(IFabricResolvedServicePartitionResult*, void*);
+
+    REGISTER_UMOCK_ALIAS_TYPE(SM_HANDLE, void*);
+
+    REGISTER_TYPE(SM_RESULT, SM_RESULT);
+    REGISTER_GLOBAL_MOCK_RETURNS(sm_create, TEST_SM, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(sm_open_begin, SM_EXEC_GRANTED, SM_ERROR);
+    REGISTER_GLOBAL_MOCK_RETURNS(sm_close_begin, SM_EXEC_GRANTED, SM_EXEC_REFUSED);
+    REGISTER_GLOBAL_MOCK_RETURNS(sm_exec_begin, SM_EXEC_GRANTED, SM_EXEC_REFUSED);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    REGISTER_GLOBAL_MOCK_HOOK(test_on_resolution_change, NULL);
+
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/* h_fabric_resolution_change_handler_create */
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_001: [ If on_resolution_change is NULL, h_fabric_resolution_change_handler_create shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_create_with_NULL_on_resolution_change_fails)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE result;
+
+    // act
+    result = h_fabric_resolution_change_handler_create(NULL, (void*)0x4242);
+
+    // assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_003: [ Otherwise, h_fabric_resolution_change_handler_create shall allocate a new change handler instance and on success return a non-NULL pointer to it. ]*/
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_014: [ h_fabric_resolution_change_handler_create shall create a state machine by calling sm_create. ]*/
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_015: [ h_fabric_resolution_change_handler_create shall open the state machine by calling sm_open_begin and sm_open_end. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_create_succeeds)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE result;
+
+    setup_create_expectations();
+
+    // act
+    result = h_fabric_resolution_change_handler_create(test_on_resolution_change, (void*)0x4242);
+
+    // assert
+    ASSERT_IS_NOT_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    h_fabric_resolution_change_handler_destroy(result);
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_002: [ on_resolution_change_context shall be allowed to be NULL. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_create_with_NULL_on_resolution_change_context_succeeds)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE result;
+
+    setup_create_expectations();
+
+    // act
+    result = h_fabric_resolution_change_handler_create(test_on_resolution_change, NULL);
+
+    // assert
+    ASSERT_IS_NOT_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    h_fabric_resolution_change_handler_destroy(result);
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_004: [ If any error occurs, h_fabric_resolution_change_handler_create shall fail and return NULL. ]*/
+TEST_FUNCTION(when_underlying_calls_fails_h_fabric_resolution_change_handler_create_also_fails)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE result;
+
+    setup_create_expectations();
+
+    umock_c_negative_tests_snapshot();
+
+    for (size_t i = 0; i < umock_c_negative_tests_call_count(); i++)
+    {
+        if (umock_c_negative_tests_can_call_fail(i))
+        {
+            umock_c_negative_tests_reset();
+            umock_c_negative_tests_fail_call(i);
+
+            // act
+            result = h_fabric_resolution_change_handler_create(test_on_resolution_change, (void*)0x4242);
+
+            //assert
+            ASSERT_IS_NULL(result, "On failed call %zu", i);
+        }
+    }
+}
+
+/* h_fabric_resolution_change_handler_destroy */
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_005: [ If h_fabric_resolution_change_handler is NULL, h_fabric_resolution_change_handler_destroy shall return. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_destroy_with_NULL_handle_returns)
+{
+    // arrange
+
+    // act
+    h_fabric_resolution_change_handler_destroy(NULL);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_016: [ Otherwise, h_fabric_resolution_change_handler_destroy shall destroy the state machine by calling sm_destroy. ]*/
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_006: [ h_fabric_resolution_change_handler_destroy shall free the memory allocated in h_fabric_resolution_change_handler_create. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_destroy_frees_the_memory)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler = h_fabric_resolution_change_handler_create(test_on_resolution_change, (void*)0x4242);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(sm_destroy(TEST_SM));
+    STRICT_EXPECTED_CALL(free(handler));
+
+    // act
+    h_fabric_resolution_change_handler_destroy(handler);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_resolution_change_handler_close */
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_009: [ If h_fabric_resolution_change_handler is NULL, h_fabric_resolution_change_handler_close shall return. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_close_with_NULL_handle_returns)
+{
+    // arrange
+
+    // act
+    h_fabric_resolution_change_handler_close(NULL);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_010: [ Otherwise, h_fabric_resolution_change_handler_close shall make the changes that arrive from now on not call on_resolution_change and wait for the calls to on_resolution_change in progress to finish by calling sm_close_begin. ]*/
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_018: [ h_fabric_resolution_change_handler_close shall call sm_close_end. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_close_waits_for_the_calls_in_progress)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler = h_fabric_resolution_change_handler_create(test_on_resolution_change, (void*)0x4242);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(sm_close_begin(TEST_SM));
+    STRICT_EXPECTED_CALL(sm_close_end(TEST_SM));
+
+    // act
+    h_fabric_resolution_change_handler_close(handler);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    h_fabric_resolution_change_handler_destroy(handler);
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_017: [ If sm_close_begin does not return SM_EXEC_GRANTED then h_fabric_resolution_change_handler_close shall return. ]*/
+TEST_FUNCTION(when_sm_close_begin_is_refused_h_fabric_resolution_change_handler_close_returns)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler = h_fabric_resolution_change_handler_create(test_on_resolution_change, (void*)0x4242);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(sm_close_begin(TEST_SM))
+        .SetReturn(SM_EXEC_REFUSED);
+
+    // act
+    h_fabric_resolution_change_handler_close(handler);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    h_fabric_resolution_change_handler_destroy(handler);
+}
+
+/* h_fabric_resolution_change_handler_OnChange */
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_007: [ If h_fabric_resolution_change_handler is NULL, h_fabric_resolution_change_handler_OnChange shall return. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_OnChange_with_NULL_handle_returns)
+{
+    // arrange
+
+    // act
+    h_fabric_resolution_change_handler_OnChange(NULL, test_source, 42, test_partition, S_OK);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_019: [ h_fabric_resolution_change_handler_OnChange shall call sm_exec_begin. ]*/
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_008: [ Otherwise h_fabric_resolution_change_handler_OnChange shall call on_resolution_change and pass as arguments on_resolution_change_context, handlerId, partition and error. ]*/
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_020: [ h_fabric_resolution_change_handler_OnChange shall call sm_exec_end after on_resolution_change returns. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_OnChange_calls_the_callback)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler = h_fabric_resolution_change_handler_create(test_on_resolution_change, (void*)0x4242);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(sm_exec_begin(TEST_SM));
+    STRICT_EXPECTED_CALL(test_on_resolution_change((void*)0x4242, 42, test_partition, S_OK));
+    STRICT_EXPECTED_CALL(sm_exec_end(TEST_SM));
+
+    // act
+    h_fabric_resolution_change_handler_OnChange(handler, test_source, 42, test_partition, S_OK);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    h_fabric_resolution_change_handler_destroy(handler);
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_008: [ Otherwise h_fabric_resolution_change_handler_OnChange shall call on_resolution_change and pass as arguments on_resolution_change_context, handlerId, partition and error. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_OnChange_passes_the_error)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler = h_fabric_resolution_change_handler_create(test_on_resolution_change, NULL);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(sm_exec_begin(TEST_SM));
+    STRICT_EXPECTED_CALL(test_on_resolution_change(NULL, 43, NULL, FABRIC_E_SERVICE_DOES_NOT_EXIST));
+    STRICT_EXPECTED_CALL(sm_exec_end(TEST_SM));
+
+    // act
+    h_fabric_resolution_change_handler_OnChange(handler, test_source, 43, NULL, FABRIC_E_SERVICE_DOES_NOT_EXIST);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    h_fabric_resolution_change_handler_destroy(handler);
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_012: [ If sm_exec_begin does not return SM_EXEC_GRANTED (the handler was closed) then h_fabric_resolution_change_handler_OnChange shall not call on_resolution_change. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_OnChange_after_close_does_not_call_the_callback)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler = h_fabric_resolution_change_handler_create(test_on_resolution_change, (void*)0x4242);
+    h_fabric_resolution_change_handler_close(handler);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(sm_exec_begin(TEST_SM))
+        .SetReturn(SM_EXEC_REFUSED);
+
+    // act
+    h_fabric_resolution_change_handler_OnChange(handler, test_source, 42, test_partition, S_OK);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    h_fabric_resolution_change_handler_destroy(handler);
+}
+
+/* Tests_SRS_H_FABRIC_RESOLUTION_CHANGE_HANDLER_01_020: [ h_fabric_resolution_change_handler_OnChange shall call sm_exec_end after on_resolution_change returns. ]*/
+TEST_FUNCTION(h_fabric_resolution_change_handler_OnChange_ends_the_execution_when_closed_during_the_callback)
+{
+    // arrange
+    H_FABRIC_RESOLUTION_CHANGE_HANDLER_HANDLE handler = h_fabric_resolution_change_handler_create(test_on_resolution_change, (void*)0x4242);
+    handler_closed_by_callback = handler;
+    REGISTER_GLOBAL_MOCK_HOOK(test_on_resolution_change, hook_test_on_resolution_change_closes_the_handler);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(sm_exec_begin(TEST_SM));
+    STRICT_EXPECTED_CALL(test_on_resolution_change((void*)0x4242, 42, test_partition, S_OK));
+    STRICT_EXPECTED_CALL(sm_close_begin(TEST_SM));
+    STRICT_EXPECTED_CALL(sm_close_end(TEST_SM));
+    STRICT_EXPECTED_CALL(sm_exec_end(TEST_SM)); /*with the real sm this is what lets sm_close_begin on the closing thread return*/
+
+    // act
+    h_fabric_resolution_change_handler_OnChange(handler, test_source, 42, test_partition, S_OK);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    h_fabric_resolution_change_handler_destroy(handler);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,9 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#define _CRT_RAND_S
+#include <stdlib.h>
+
+#define rand_s mocked_rand_s
+extern int mocked_rand_s(unsigned int* randomValue);
+
+#include "../../src/h_fabric_retry_policy.c"
@@ -0,0 +1,614 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#ifdef __cplusplus
+#include <cstdlib>
+#include <cstdint>
+#else
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_bool.h"
+#include "umock_c/umocktypes_charptr.h"
+
+#define ENABLE_MOCKS
+
+MOCKABLE_FUNCTION(, int, mocked_rand_s, unsigned int*, randomValue);
+MOCKABLE_FUNCTION(, uint32_t, test_compute_delay, void*, context, uint32_t, retry, uint32_t, previous_delay_ms);
+
+#undef ENABLE_MOCKS
+
+#include "h_fabric_retry_policy.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+#define TEST_CONTEXT ((void*)0x4242)
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types());
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types());
+
+    REGISTER_UMOCK_ALIAS_TYPE(H_FABRIC_RETRY_POLICY_COMPUTE_DELAY, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(unsigned int*, void*);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    umock_c_reset_all_calls();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+}
+
+/* h_fabric_retry_policy_init_fixed */
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_001: [ If policy is NULL then h_fabric_retry_policy_init_fixed shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_fixed_with_NULL_policy_fails)
+{
+    ///arrange
+
+    ///act
+    int result = h_fabric_retry_policy_init_fixed(NULL, 3, 100);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_002: [ h_fabric_retry_policy_init_fixed shall initialize policy as a H_FABRIC_RETRY_POLICY_TYPE_FIXED policy with max_tries, delay_ms as base and maximum delay and no retry budget. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_003: [ h_fabric_retry_policy_init_fixed shall succeed and return 0. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_fixed_succeeds)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+
+    ///act
+    int result = h_fabric_retry_policy_init_fixed(&policy, 3, 100);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(int, H_FABRIC_RETRY_POLICY_TYPE_FIXED, policy.type);
+    ASSERT_ARE_EQUAL(uint32_t, 3, policy.max_tries);
+    ASSERT_ARE_EQUAL(uint32_t, 100, policy.base_delay_ms);
+    ASSERT_ARE_EQUAL(uint32_t, 100, policy.max_delay_ms);
+    ASSERT_ARE_EQUAL(uint32_t, 0, policy.retry_budget_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_retry_policy_init_exponential */
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_004: [ If policy is NULL then h_fabric_retry_policy_init_exponential shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_exponential_with_NULL_policy_fails)
+{
+    ///arrange
+
+    ///act
+    int result = h_fabric_retry_policy_init_exponential(NULL, 3, 100, 1000);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_005: [ If max_delay_ms is less than base_delay_ms then h_fabric_retry_policy_init_exponential shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_exponential_with_max_delay_less_than_base_delay_fails)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+
+    ///act
+    int result = h_fabric_retry_policy_init_exponential(&policy, 3, 100, 99);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_006: [ h_fabric_retry_policy_init_exponential shall initialize policy as a H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL policy with max_tries, base_delay_ms, max_delay_ms and no retry budget. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_007: [ h_fabric_retry_policy_init_exponential shall succeed and return 0. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_exponential_succeeds)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+
+    ///act
+    int result = h_fabric_retry_policy_init_exponential(&policy, 3, 100, 1000);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(int, H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL, policy.type);
+    ASSERT_ARE_EQUAL(uint32_t, 3, policy.max_tries);
+    ASSERT_ARE_EQUAL(uint32_t, 100, policy.base_delay_ms);
+    ASSERT_ARE_EQUAL(uint32_t, 1000, policy.max_delay_ms);
+    ASSERT_ARE_EQUAL(uint32_t, 0, policy.retry_budget_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_retry_policy_init_decorrelated_jitter */
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_008: [ If policy is NULL then h_fabric_retry_policy_init_decorrelated_jitter shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_decorrelated_jitter_with_NULL_policy_fails)
+{
+    ///arrange
+
+    ///act
+    int result = h_fabric_retry_policy_init_decorrelated_jitter(NULL, 3, 100, 1000);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_009: [ If max_delay_ms is less than base_delay_ms then h_fabric_retry_policy_init_decorrelated_jitter shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_decorrelated_jitter_with_max_delay_less_than_base_delay_fails)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+
+    ///act
+    int result = h_fabric_retry_policy_init_decorrelated_jitter(&policy, 3, 100, 99);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_010: [ h_fabric_retry_policy_init_decorrelated_jitter shall initialize policy as a H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER policy with max_tries, base_delay_ms, max_delay_ms and no retry budget. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_011: [ h_fabric_retry_policy_init_decorrelated_jitter shall succeed and return 0. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_decorrelated_jitter_succeeds)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+
+    ///act
+    int result = h_fabric_retry_policy_init_decorrelated_jitter(&policy, 3, 100, 1000);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(int, H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER, policy.type);
+    ASSERT_ARE_EQUAL(uint32_t, 3, policy.max_tries);
+    ASSERT_ARE_EQUAL(uint32_t, 100, policy.base_delay_ms);
+    ASSERT_ARE_EQUAL(uint32_t, 1000, policy.max_delay_ms);
+    ASSERT_ARE_EQUAL(uint32_t, 0, policy.retry_budget_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_retry_policy_init_custom */
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_012: [ If policy is NULL then h_fabric_retry_policy_init_custom shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_custom_with_NULL_policy_fails)
+{
+    ///arrange
+
+    ///act
+    int result = h_fabric_retry_policy_init_custom(NULL, 3, test_compute_delay, TEST_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_013: [ If compute_delay is NULL then h_fabric_retry_policy_init_custom shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_custom_with_NULL_compute_delay_fails)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+
+    ///act
+    int result = h_fabric_retry_policy_init_custom(&policy, 3, NULL, TEST_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_014: [ h_fabric_retry_policy_init_custom shall initialize policy as a H_FABRIC_RETRY_POLICY_TYPE_CUSTOM policy with max_tries, compute_delay, compute_delay_context and no retry budget. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_015: [ h_fabric_retry_policy_init_custom shall succeed and return 0. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_init_custom_succeeds)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+
+    ///act
+    int result = h_fabric_retry_policy_init_custom(&policy, 3, test_compute_delay, TEST_CONTEXT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(int, H_FABRIC_RETRY_POLICY_TYPE_CUSTOM, policy.type);
+    ASSERT_ARE_EQUAL(uint32_t, 3, policy.max_tries);
+    ASSERT_ARE_EQUAL(void_ptr, (void*)test_compute_delay, (void*)policy.compute_delay);
+    ASSERT_ARE_EQUAL(void_ptr, TEST_CONTEXT, policy.compute_delay_context);
+    ASSERT_ARE_EQUAL(uint32_t, 0, policy.retry_budget_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_retry_policy_set_budget */
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_016: [ If policy is NULL then h_fabric_retry_policy_set_budget shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_set_budget_with_NULL_policy_fails)
+{
+    ///arrange
+
+    ///act
+    int result = h_fabric_retry_policy_set_budget(NULL, 1000);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_017: [ h_fabric_retry_policy_set_budget shall set the retry budget of policy to retry_budget_ms and return 0. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_set_budget_succeeds)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&policy, 3, 100));
+
+    ///act
+    int result = h_fabric_retry_policy_set_budget(&policy, 1000);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(uint32_t, 1000, policy.retry_budget_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_retry_policy_get_next_delay */
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_018: [ If policy is NULL then h_fabric_retry_policy_get_next_delay shall fail and return false. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_with_NULL_policy_fails)
+{
+    ///arrange
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay;
+
+    ///act
+    bool result = h_fabric_retry_policy_get_next_delay(NULL, &state, 1000, &delay);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_019: [ If state is NULL then h_fabric_retry_policy_get_next_delay shall fail and return false. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_with_NULL_state_fails)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&policy, 3, 100));
+    uint32_t delay;
+
+    ///act
+    bool result = h_fabric_retry_policy_get_next_delay(&policy, NULL, 1000, &delay);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_020: [ If delay_ms is NULL then h_fabric_retry_policy_get_next_delay shall fail and return false. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_with_NULL_delay_ms_fails)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&policy, 3, 100));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+
+    ///act
+    bool result = h_fabric_retry_policy_get_next_delay(&policy, &state, 1000, NULL);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_021: [ h_fabric_retry_policy_get_next_delay shall increment the number of tries in state. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_022: [ If the number of tries in state reached max_tries then h_fabric_retry_policy_get_next_delay shall return false. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_025: [ For H_FABRIC_RETRY_POLICY_TYPE_FIXED the delay shall be base_delay_ms. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_031: [ h_fabric_retry_policy_get_next_delay shall add the delay to the total delay in state, set delay_ms to the delay and return true. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_fixed_returns_the_delay_until_max_tries)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&policy, 3, 100));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay_1 = 0;
+    uint32_t delay_2 = 0;
+    uint32_t delay_3 = 0;
+
+    ///act
+    bool result_1 = h_fabric_retry_policy_get_next_delay(&policy, &state, 1000, &delay_1);
+    bool result_2 = h_fabric_retry_policy_get_next_delay(&policy, &state, 1000, &delay_2);
+    bool result_3 = h_fabric_retry_policy_get_next_delay(&policy, &state, 1000, &delay_3);
+
+    ///assert
+    ASSERT_IS_TRUE(result_1);
+    ASSERT_ARE_EQUAL(uint32_t, 100, delay_1);
+    ASSERT_IS_TRUE(result_2);
+    ASSERT_ARE_EQUAL(uint32_t, 100, delay_2);
+    ASSERT_IS_FALSE(result_3); /*3 tries were made already*/
+    ASSERT_ARE_EQUAL(uint32_t, 3, state.tries);
+    ASSERT_ARE_EQUAL(uint32_t, 200, state.total_delay_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_022: [ If the number of tries in state reached max_tries then h_fabric_retry_policy_get_next_delay shall return false. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_with_max_tries_0_returns_false)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&policy, 0, 100));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay;
+
+    ///act
+    bool result = h_fabric_retry_policy_get_next_delay(&policy, &state, 1000, &delay);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_023: [ If remaining_ms is 0 then h_fabric_retry_policy_get_next_delay shall return false. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_with_remaining_ms_0_returns_false)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&policy, 3, 100));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay;
+
+    ///act
+    bool result = h_fabric_retry_policy_get_next_delay(&policy, &state, 0, &delay);
+
+    ///assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_030: [ h_fabric_retry_policy_get_next_delay shall clamp the delay to remaining_ms. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_clamps_the_delay_to_remaining_ms)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&policy, 3, 100));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay = 0;
+
+    ///act
+    bool result = h_fabric_retry_policy_get_next_delay(&policy, &state, 42, &delay);
+
+    ///assert
+    ASSERT_IS_TRUE(result);
+    ASSERT_ARE_EQUAL(uint32_t, 42, delay);
+    ASSERT_ARE_EQUAL(uint32_t, 42, state.total_delay_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_026: [ For H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL the delay shall be base_delay_ms * 2^(tries - 1), capped at max_delay_ms. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_exponential_doubles_the_delay_up_to_the_cap)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_exponential(&policy, 10, 100, 500));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t expected_delays[] = { 100, 200, 400, 500, 500 };
+    uint32_t delays[MU_COUNT_ARRAY_ITEMS(expected_delays)];
+
+    ///act
+    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(expected_delays); i++)
+    {
+        ASSERT_IS_TRUE(h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delays[i]));
+    }
+
+    ///assert
+    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(expected_delays); i++)
+    {
+        ASSERT_ARE_EQUAL(uint32_t, expected_delays[i], delays[i]);
+    }
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_026: [ For H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL the delay shall be base_delay_ms * 2^(tries - 1), capped at max_delay_ms. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_exponential_does_not_overflow_after_many_tries)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_exponential(&policy, UINT32_MAX, 100, 60000));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    state.tries = 40;
+    uint32_t delay = 0;
+
+    ///act
+    bool result = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay);
+
+    ///assert
+    ASSERT_IS_TRUE(result);
+    ASSERT_ARE_EQUAL(uint32_t, 60000, delay);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_027: [ For H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER the delay shall be a random value between base_delay_ms and 3 times the previous delay (base_delay_ms for the first retry), capped at max_delay_ms. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_044: [ For H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER h_fabric_retry_policy_get_next_delay shall get the random value by calling rand_s. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_decorrelated_jitter_uses_the_previous_delay)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_decorrelated_jitter(&policy, 10, 100, 10000));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay_1 = 0;
+    uint32_t delay_2 = 0;
+
+    unsigned int random_1 = 150;
+    unsigned int random_2 = 651;
+
+    /*first retry: [100, 300]*/
+    STRICT_EXPECTED_CALL(mocked_rand_s(IGNORED_ARG))
+        .CopyOutArgumentBuffer_randomValue(&random_1, sizeof(random_1))
+        .SetReturn(0);
+    /*second retry: [100, 750]*/
+    STRICT_EXPECTED_CALL(mocked_rand_s(IGNORED_ARG))
+        .CopyOutArgumentBuffer_randomValue(&random_2, sizeof(random_2))
+        .SetReturn(0);
+
+    ///act
+    bool result_1 = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay_1);
+    bool result_2 = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay_2);
+
+    ///assert
+    ASSERT_IS_TRUE(result_1);
+    ASSERT_ARE_EQUAL(uint32_t, 250, delay_1);
+    ASSERT_IS_TRUE(result_2);
+    ASSERT_ARE_EQUAL(uint32_t, 100, delay_2); /*651 % 651 = 0*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_027: [ For H_FABRIC_RETRY_POLICY_TYPE_DECORRELATED_JITTER the delay shall be a random value between base_delay_ms and 3 times the previous delay (base_delay_ms for the first retry), capped at max_delay_ms. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_decorrelated_jitter_is_capped)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_decorrelated_jitter(&policy, 10, 100, 120));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay = 0;
+    unsigned int random = 200;
+
+    STRICT_EXPECTED_CALL(mocked_rand_s(IGNORED_ARG))
+        .CopyOutArgumentBuffer_randomValue(&random, sizeof(random))
+        .SetReturn(0);
+
+    ///act
+    bool result = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay);
+
+    ///assert
+    ASSERT_IS_TRUE(result);
+    ASSERT_ARE_EQUAL(uint32_t, 120, delay);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_045: [ If rand_s fails then the delay shall be base_delay_ms. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_decorrelated_jitter_when_rand_s_fails_uses_base_delay_ms)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_decorrelated_jitter(&policy, 10, 100, 10000));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay = 0;
+
+    STRICT_EXPECTED_CALL(mocked_rand_s(IGNORED_ARG))
+        .SetReturn(22); /*EINVAL*/
+
+    ///act
+    bool result = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay);
+
+    ///assert
+    ASSERT_IS_TRUE(result);
+    ASSERT_ARE_EQUAL(uint32_t, 100, delay);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_028: [ For H_FABRIC_RETRY_POLICY_TYPE_CUSTOM the delay shall be the value returned by compute_delay called with compute_delay_context, the number of tries in state and the previous delay. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_custom_calls_compute_delay)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_custom(&policy, 10, test_compute_delay, TEST_CONTEXT));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay_1 = 0;
+    uint32_t delay_2 = 0;
+
+    STRICT_EXPECTED_CALL(test_compute_delay(TEST_CONTEXT, 1, 0))
+        .SetReturn(42);
+    STRICT_EXPECTED_CALL(test_compute_delay(TEST_CONTEXT, 2, 42))
+        .SetReturn(43);
+
+    ///act
+    bool result_1 = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay_1);
+    bool result_2 = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay_2);
+
+    ///assert
+    ASSERT_IS_TRUE(result_1);
+    ASSERT_ARE_EQUAL(uint32_t, 42, delay_1);
+    ASSERT_IS_TRUE(result_2);
+    ASSERT_ARE_EQUAL(uint32_t, 43, delay_2);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_024: [ If policy has a retry budget and the total delay in state reached it then h_fabric_retry_policy_get_next_delay shall return false. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_029: [ If policy has a retry budget then h_fabric_retry_policy_get_next_delay shall clamp the delay to what is left of the budget. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_stops_when_the_budget_is_exhausted)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_fixed(&policy, 10, 100));
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_set_budget(&policy, 250));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay_1 = 0;
+    uint32_t delay_2 = 0;
+    uint32_t delay_3 = 0;
+    uint32_t delay_4 = 0;
+
+    ///act
+    bool result_1 = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay_1);
+    bool result_2 = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay_2);
+    bool result_3 = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay_3);
+    bool result_4 = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay_4);
+
+    ///assert
+    ASSERT_IS_TRUE(result_1);
+    ASSERT_ARE_EQUAL(uint32_t, 100, delay_1);
+    ASSERT_IS_TRUE(result_2);
+    ASSERT_ARE_EQUAL(uint32_t, 100, delay_2);
+    ASSERT_IS_TRUE(result_3);
+    ASSERT_ARE_EQUAL(uint32_t, 50, delay_3);
+    ASSERT_IS_FALSE(result_4);
+    ASSERT_ARE_EQUAL(uint32_t, 250, state.total_delay_ms);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_026: [ For H_FABRIC_RETRY_POLICY_TYPE_EXPONENTIAL the delay shall be base_delay_ms * 2^(tries - 1), capped at max_delay_ms. ]*/
+/*Tests_SRS_H_FABRIC_RETRY_POLICY_01_030: [ h_fabric_retry_policy_get_next_delay shall clamp the delay to remaining_ms. ]*/
+TEST_FUNCTION(h_fabric_retry_policy_get_next_delay_exponential_keeps_backing_off_after_a_clamped_delay)
+{
+    ///arrange
+    H_FABRIC_RETRY_POLICY policy;
+    ASSERT_ARE_EQUAL(int, 0, h_fabric_retry_policy_init_exponential(&policy, 10, 100, 10000));
+    H_FABRIC_RETRY_STATE state = H_FABRIC_RETRY_STATE_INITIALIZER;
+    uint32_t delay_1 = 0;
+    uint32_t delay_2 = 0;
+
+    ///act
+    bool result_1 = h_fabric_retry_policy_get_next_delay(&policy, &state, 10, &delay_1);
+    bool result_2 = h_fabric_retry_policy_get_next_delay(&policy, &state, UINT32_MAX, &delay_2);
+
+    ///assert
+    ASSERT_IS_TRUE(result_1);
+    ASSERT_ARE_EQUAL(uint32_t, 10, delay_1);
+    ASSERT_IS_TRUE(result_2);
+    ASSERT_ARE_EQUAL(uint32_t, 200, delay_2);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,818 @@
+// Copyright (c) Microsoft. All rights reserved.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <wchar.h>
+
+#include "windows.h"
+
+#include "fabrictypes.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_bool.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umocktypes_windows.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+
+MOCKABLE_FUNCTION(, ULONG, test_result_AddRef, IUnknown*, This);
+MOCKABLE_FUNCTION(, ULONG, test_result_Release, IUnknown*, This);
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "h_fabric_single_flight.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT_VALUES);
+
+#define TEST_API_NAME "GetPartitionList"
+#define TEST_OTHER_API_NAME "GetServiceList"
+#define TEST_TIMEOUT 1000
+
+/*fake results, only AddRef and Release are ever called*/
+static IUnknownVtbl test_result_vtbl =
+{
+    .AddRef = test_result_AddRef,
+    .Release = test_result_Release
+};
+static IUnknown test_result = { &test_result_vtbl };
+
+static H_FABRIC_SINGLE_FLIGHT test_single_flight;
+
+static void make_key(H_FABRIC_SINGLE_FLIGHT_KEY* key, const wchar_t* service_name)
+{
+    h_fabric_single_flight_key_init(key);
+    h_fabric_single_flight_key_add_wstring(key, service_name);
+}
+
+/*makes a leader call for TEST_API_NAME with the key built from service_name*/
+static H_FABRIC_SINGLE_FLIGHT_CALL* test_join_as_leader(const wchar_t* service_name)
+{
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader = false;
+    make_key(&key, service_name);
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, &key, &is_leader);
+    ASSERT_IS_NOT_NULL(call);
+    ASSERT_IS_TRUE(is_leader);
+    umock_c_reset_all_calls();
+    return call;
+}
+
+static H_FABRIC_SINGLE_FLIGHT_CALL* test_join_as_follower(const wchar_t* service_name)
+{
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader = true;
+    make_key(&key, service_name);
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, &key, &is_leader);
+    ASSERT_IS_NOT_NULL(call);
+    ASSERT_IS_FALSE(is_leader);
+    umock_c_reset_all_calls();
+    return call;
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types(), "umocktypes_bool_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_charptr_register_types(), "umocktypes_charptr_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types(), "umocktypes_stdint_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_windows_register_types(), "umocktypes_windows_register_types");
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(malloc_flex, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(InterlockedHL_WaitForValue, INTERLOCKED_HL_OK, INTERLOCKED_HL_ERROR);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_AddRef, 2);
+    REGISTER_GLOBAL_MOCK_RETURN(test_result_Release, 1);
+
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(IUnknown*, void*);
+
+    REGISTER_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    h_fabric_single_flight_init(&test_single_flight);
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/* h_fabric_single_flight_init */
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_001: [ If single_flight is NULL then h_fabric_single_flight_init shall return. ]*/
+TEST_FUNCTION(h_fabric_single_flight_init_with_single_flight_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_single_flight_init(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_002: [ h_fabric_single_flight_init shall initialize single_flight with no calls in flight. ]*/
+TEST_FUNCTION(h_fabric_single_flight_init_succeeds)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT single_flight;
+    (void)memset(&single_flight, 0xAA, sizeof(single_flight));
+
+    ///act
+    h_fabric_single_flight_init(&single_flight);
+
+    ///assert
+    ASSERT_IS_NULL(single_flight.calls);
+    ASSERT_ARE_EQUAL(int32_t, 0, single_flight.lock);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_single_flight_deinit */
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_003: [ If single_flight is NULL then h_fabric_single_flight_deinit shall return. ]*/
+TEST_FUNCTION(h_fabric_single_flight_deinit_with_single_flight_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_single_flight_deinit(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_004: [ If there are calls in flight then h_fabric_single_flight_deinit shall log an error and leave them to the threads that own them. ]*/
+TEST_FUNCTION(h_fabric_single_flight_deinit_with_a_call_in_flight_does_not_free_it)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = test_join_as_leader(L"fabric:/app/service");
+
+    ///act
+    h_fabric_single_flight_deinit(&test_single_flight);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, NULL);
+}
+
+/* h_fabric_single_flight_key_init */
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_005: [ If key is NULL then h_fabric_single_flight_key_init shall return. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_init_with_key_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_single_flight_key_init(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_006: [ h_fabric_single_flight_key_init shall initialize key as an empty key that can be coalesced. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_init_succeeds)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    key.can_coalesce = false;
+    key.size = 42;
+
+    ///act
+    h_fabric_single_flight_key_init(&key);
+
+    ///assert
+    ASSERT_IS_TRUE(key.can_coalesce);
+    ASSERT_ARE_EQUAL(size_t, 0, key.size);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_single_flight_key_add */
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_007: [ If key is NULL then h_fabric_single_flight_key_add shall return. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_add_with_key_NULL_returns)
+{
+    ///arrange
+    uint32_t value = 42;
+
+    ///act
+    h_fabric_single_flight_key_add(NULL, &value, sizeof(value));
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_008: [ If data is NULL and size is not 0 then h_fabric_single_flight_key_add shall mark key as not coalescable. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_add_with_data_NULL_disables_the_key)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    h_fabric_single_flight_key_init(&key);
+
+    ///act
+    h_fabric_single_flight_key_add(&key, NULL, 4);
+
+    ///assert
+    ASSERT_IS_FALSE(key.can_coalesce);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_009: [ If the key would grow past H_FABRIC_SINGLE_FLIGHT_KEY_MAX_SIZE bytes then h_fabric_single_flight_key_add shall mark key as not coalescable. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_add_past_max_size_disables_the_key)
+{
+    ///arrange
+    static unsigned char big[H_FABRIC_SINGLE_FLIGHT_KEY_MAX_SIZE];
+    unsigned char one = 1;
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    h_fabric_single_flight_key_init(&key);
+    h_fabric_single_flight_key_add(&key, big, sizeof(big));
+    ASSERT_IS_TRUE(key.can_coalesce);
+
+    ///act
+    h_fabric_single_flight_key_add(&key, &one, sizeof(one));
+
+    ///assert
+    ASSERT_IS_FALSE(key.can_coalesce);
+    ASSERT_ARE_EQUAL(size_t, H_FABRIC_SINGLE_FLIGHT_KEY_MAX_SIZE, key.size);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_010: [ h_fabric_single_flight_key_add shall append the size bytes at data to key. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_add_appends_the_bytes)
+{
+    ///arrange
+    uint32_t value_1 = 0x11223344;
+    uint16_t value_2 = 0x5566;
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    h_fabric_single_flight_key_init(&key);
+
+    ///act
+    h_fabric_single_flight_key_add(&key, &value_1, sizeof(value_1));
+    h_fabric_single_flight_key_add(&key, &value_2, sizeof(value_2));
+
+    ///assert
+    ASSERT_IS_TRUE(key.can_coalesce);
+    ASSERT_ARE_EQUAL(size_t, sizeof(value_1) + sizeof(value_2), key.size);
+    ASSERT_ARE_EQUAL(int, 0, memcmp(key.bytes, &value_1, sizeof(value_1)));
+    ASSERT_ARE_EQUAL(int, 0, memcmp(key.bytes + sizeof(value_1), &value_2, sizeof(value_2)));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_single_flight_key_add_wstring */
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_011: [ If key is NULL then h_fabric_single_flight_key_add_wstring shall return. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_add_wstring_with_key_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_single_flight_key_add_wstring(NULL, L"fabric:/app/service");
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_012: [ If value is NULL then h_fabric_single_flight_key_add_wstring shall append a marker for NULL to key. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_013: [ Otherwise h_fabric_single_flight_key_add_wstring shall append a marker for non-NULL, the length of value and the characters of value to key. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_add_wstring_keeps_NULL_and_empty_apart)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key_null;
+    H_FABRIC_SINGLE_FLIGHT_KEY key_empty;
+    h_fabric_single_flight_key_init(&key_null);
+    h_fabric_single_flight_key_init(&key_empty);
+
+    ///act
+    h_fabric_single_flight_key_add_wstring(&key_null, NULL);
+    h_fabric_single_flight_key_add_wstring(&key_empty, L"");
+
+    ///assert
+    ASSERT_IS_TRUE(key_null.can_coalesce);
+    ASSERT_IS_TRUE(key_empty.can_coalesce);
+    ASSERT_ARE_EQUAL(size_t, 1, key_null.size);
+    ASSERT_ARE_EQUAL(size_t, 1 + sizeof(size_t), key_empty.size);
+    ASSERT_ARE_NOT_EQUAL(int, 0, memcmp(key_null.bytes, key_empty.bytes, key_null.size));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_013: [ Otherwise h_fabric_single_flight_key_add_wstring shall append a marker for non-NULL, the length of value and the characters of value to key. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_add_wstring_keeps_string_boundaries)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key_1;
+    H_FABRIC_SINGLE_FLIGHT_KEY key_2;
+    h_fabric_single_flight_key_init(&key_1);
+    h_fabric_single_flight_key_init(&key_2);
+
+    ///act
+    h_fabric_single_flight_key_add_wstring(&key_1, L"ab");
+    h_fabric_single_flight_key_add_wstring(&key_1, L"c");
+    h_fabric_single_flight_key_add_wstring(&key_2, L"a");
+    h_fabric_single_flight_key_add_wstring(&key_2, L"bc");
+
+    ///assert
+    ASSERT_ARE_EQUAL(size_t, key_1.size, key_2.size);
+    ASSERT_ARE_NOT_EQUAL(int, 0, memcmp(key_1.bytes, key_2.bytes, key_1.size));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_single_flight_key_disable */
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_014: [ If key is NULL then h_fabric_single_flight_key_disable shall return. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_disable_with_key_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_single_flight_key_disable(NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_015: [ h_fabric_single_flight_key_disable shall mark key as not coalescable. ]*/
+TEST_FUNCTION(h_fabric_single_flight_key_disable_succeeds)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    h_fabric_single_flight_key_init(&key);
+
+    ///act
+    h_fabric_single_flight_key_disable(&key);
+
+    ///assert
+    ASSERT_IS_FALSE(key.can_coalesce);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_single_flight_join */
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_016: [ If single_flight is NULL then h_fabric_single_flight_join shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_with_single_flight_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader;
+    make_key(&key, L"fabric:/app/service");
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(NULL, TEST_API_NAME, &key, &is_leader);
+
+    ///assert
+    ASSERT_IS_NULL(call);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_017: [ If api_name is NULL then h_fabric_single_flight_join shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_with_api_name_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader;
+    make_key(&key, L"fabric:/app/service");
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, NULL, &key, &is_leader);
+
+    ///assert
+    ASSERT_IS_NULL(call);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_018: [ If key is NULL then h_fabric_single_flight_join shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_with_key_NULL_fails)
+{
+    ///arrange
+    bool is_leader;
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, NULL, &is_leader);
+
+    ///assert
+    ASSERT_IS_NULL(call);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_019: [ If is_leader is NULL then h_fabric_single_flight_join shall fail and return NULL. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_with_is_leader_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    make_key(&key, L"fabric:/app/service");
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, &key, NULL);
+
+    ///assert
+    ASSERT_IS_NULL(call);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_020: [ If key is marked as not coalescable then h_fabric_single_flight_join shall return NULL. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_with_disabled_key_returns_NULL)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader;
+    make_key(&key, L"fabric:/app/service");
+    h_fabric_single_flight_key_disable(&key);
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, &key, &is_leader);
+
+    ///assert
+    ASSERT_IS_NULL(call);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_021: [ h_fabric_single_flight_join shall look for a call in flight of api_name with the same key. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_023: [ Otherwise h_fabric_single_flight_join shall allocate a new call holding a copy of key and a reference for the caller, add it to the calls in flight, set is_leader to true and return it. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_first_caller_is_the_leader)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader = false;
+    make_key(&key, L"fabric:/app/service");
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, key.size, sizeof(unsigned char)));
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, &key, &is_leader);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(call);
+    ASSERT_IS_TRUE(is_leader);
+    ASSERT_ARE_EQUAL(void_ptr, call, test_single_flight.calls);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, NULL);
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_022: [ If such a call exists then h_fabric_single_flight_join shall take a reference on it, set is_leader to false and return it. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_with_the_same_key_joins_the_call_in_flight)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* leader_call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader = true;
+    make_key(&key, L"fabric:/app/service");
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, &key, &is_leader);
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, leader_call, call);
+    ASSERT_IS_FALSE(is_leader);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_single_flight_complete(&test_single_flight, leader_call, S_OK, NULL);
+    (void)h_fabric_single_flight_wait(call, TEST_TIMEOUT, NULL);
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_021: [ h_fabric_single_flight_join shall look for a call in flight of api_name with the same key. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_with_a_different_key_starts_a_new_call)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* leader_call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader = false;
+    make_key(&key, L"fabric:/app/other_service");
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, key.size, sizeof(unsigned char)));
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, &key, &is_leader);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(call);
+    ASSERT_ARE_NOT_EQUAL(void_ptr, leader_call, call);
+    ASSERT_IS_TRUE(is_leader);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_single_flight_complete(&test_single_flight, leader_call, S_OK, NULL);
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, NULL);
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_021: [ h_fabric_single_flight_join shall look for a call in flight of api_name with the same key. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_with_a_different_api_name_starts_a_new_call)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* leader_call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader = false;
+    make_key(&key, L"fabric:/app/service");
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, key.size, sizeof(unsigned char)));
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_OTHER_API_NAME, &key, &is_leader);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(call);
+    ASSERT_ARE_NOT_EQUAL(void_ptr, leader_call, call);
+    ASSERT_IS_TRUE(is_leader);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_single_flight_complete(&test_single_flight, leader_call, S_OK, NULL);
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, NULL);
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_024: [ If there are any failures then h_fabric_single_flight_join shall return NULL. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_fails_when_malloc_flex_fails)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader;
+    make_key(&key, L"fabric:/app/service");
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, key.size, sizeof(unsigned char)))
+        .SetReturn(NULL);
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, &key, &is_leader);
+
+    ///assert
+    ASSERT_IS_NULL(call);
+    ASSERT_IS_NULL(test_single_flight.calls);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* h_fabric_single_flight_complete */
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_025: [ If single_flight is NULL then h_fabric_single_flight_complete shall return. ]*/
+TEST_FUNCTION(h_fabric_single_flight_complete_with_single_flight_NULL_returns)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = test_join_as_leader(L"fabric:/app/service");
+
+    ///act
+    h_fabric_single_flight_complete(NULL, call, S_OK, &test_result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, NULL);
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_026: [ If call is NULL then h_fabric_single_flight_complete shall return. ]*/
+TEST_FUNCTION(h_fabric_single_flight_complete_with_call_NULL_returns)
+{
+    ///arrange
+
+    ///act
+    h_fabric_single_flight_complete(&test_single_flight, NULL, S_OK, &test_result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_027: [ h_fabric_single_flight_complete shall remove call from the calls in flight so that the calls that start from now on execute again. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_028: [ h_fabric_single_flight_complete shall store call_result and, if result is not NULL, take a reference on result. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_029: [ h_fabric_single_flight_complete shall mark call as done and wake up the threads waiting for it by calling wake_by_address_all. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_030: [ h_fabric_single_flight_complete shall give back the reference of the leader on call. ]*/
+TEST_FUNCTION(h_fabric_single_flight_complete_without_other_callers_frees_the_call)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = test_join_as_leader(L"fabric:/app/service");
+
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result));
+    STRICT_EXPECTED_CALL(free(call));
+
+    ///act
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, &test_result);
+
+    ///assert
+    ASSERT_IS_NULL(test_single_flight.calls);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_027: [ h_fabric_single_flight_complete shall remove call from the calls in flight so that the calls that start from now on execute again. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_030: [ h_fabric_single_flight_complete shall give back the reference of the leader on call. ]*/
+TEST_FUNCTION(h_fabric_single_flight_complete_with_other_callers_keeps_the_call)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_CALL* follower_call = test_join_as_follower(L"fabric:/app/service");
+    IUnknown* result;
+
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result));
+    STRICT_EXPECTED_CALL(wake_by_address_all(IGNORED_ARG));
+
+    ///act
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, &test_result);
+
+    ///assert
+    ASSERT_IS_NULL(test_single_flight.calls);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    (void)h_fabric_single_flight_wait(follower_call, TEST_TIMEOUT, &result);
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_027: [ h_fabric_single_flight_complete shall remove call from the calls in flight so that the calls that start from now on execute again. ]*/
+TEST_FUNCTION(h_fabric_single_flight_join_after_complete_starts_a_new_call)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* first_call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_CALL* follower_call = test_join_as_follower(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_KEY key;
+    bool is_leader = false;
+    IUnknown* result;
+    h_fabric_single_flight_complete(&test_single_flight, first_call, S_OK, &test_result);
+    make_key(&key, L"fabric:/app/service");
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, key.size, sizeof(unsigned char)));
+
+    ///act
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = h_fabric_single_flight_join(&test_single_flight, TEST_API_NAME, &key, &is_leader);
+
+    ///assert
+    ASSERT_IS_NOT_NULL(call);
+    ASSERT_IS_TRUE(is_leader);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    (void)h_fabric_single_flight_wait(follower_call, TEST_TIMEOUT, &result);
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, NULL);
+}
+
+/* h_fabric_single_flight_wait */
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_031: [ If call is NULL then h_fabric_single_flight_wait shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_single_flight_wait_with_call_NULL_fails)
+{
+    ///arrange
+    IUnknown* result;
+
+    ///act
+    HRESULT hr = h_fabric_single_flight_wait(NULL, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_032: [ If result is NULL then h_fabric_single_flight_wait shall give back the reference of the caller on call, fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(h_fabric_single_flight_wait_with_result_NULL_fails)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_CALL* follower_call = test_join_as_follower(L"fabric:/app/service");
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, &test_result);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result));
+    STRICT_EXPECTED_CALL(free(follower_call));
+
+    ///act
+    HRESULT hr = h_fabric_single_flight_wait(follower_call, TEST_TIMEOUT, NULL);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, E_INVALIDARG, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_033: [ h_fabric_single_flight_wait shall wait at most timeout_ms for call to be done by calling InterlockedHL_WaitForValue. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_036: [ h_fabric_single_flight_wait shall return the call_result stored by the leader. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_037: [ If call_result is a success code then h_fabric_single_flight_wait shall take a new reference on the result stored by the leader and return it in result. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_038: [ h_fabric_single_flight_wait shall give back the reference of the caller on call. ]*/
+TEST_FUNCTION(h_fabric_single_flight_wait_returns_the_shared_result)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_CALL* follower_call = test_join_as_follower(L"fabric:/app/service");
+    IUnknown* result;
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, &test_result);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, IGNORED_ARG, TEST_TIMEOUT));
+    STRICT_EXPECTED_CALL(test_result_AddRef(&test_result));
+    STRICT_EXPECTED_CALL(test_result_Release(&test_result)); /*the reference of the call*/
+    STRICT_EXPECTED_CALL(free(follower_call));
+
+    ///act
+    HRESULT hr = h_fabric_single_flight_wait(follower_call, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, S_OK, hr);
+    ASSERT_ARE_EQUAL(void_ptr, &test_result, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_036: [ h_fabric_single_flight_wait shall return the call_result stored by the leader. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_038: [ h_fabric_single_flight_wait shall give back the reference of the caller on call. ]*/
+TEST_FUNCTION(h_fabric_single_flight_wait_returns_the_failure_of_the_leader)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_CALL* follower_call = test_join_as_follower(L"fabric:/app/service");
+    IUnknown* result = NULL;
+    h_fabric_single_flight_complete(&test_single_flight, call, FABRIC_E_SERVICE_DOES_NOT_EXIST, NULL);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, IGNORED_ARG, TEST_TIMEOUT));
+    STRICT_EXPECTED_CALL(free(follower_call));
+
+    ///act
+    HRESULT hr = h_fabric_single_flight_wait(follower_call, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, FABRIC_E_SERVICE_DOES_NOT_EXIST, hr);
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_034: [ If the wait times out then h_fabric_single_flight_wait shall return FABRIC_E_TIMEOUT. ]*/
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_038: [ h_fabric_single_flight_wait shall give back the reference of the caller on call. ]*/
+TEST_FUNCTION(h_fabric_single_flight_wait_times_out)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_CALL* follower_call = test_join_as_follower(L"fabric:/app/service");
+    IUnknown* result;
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, IGNORED_ARG, TEST_TIMEOUT))
+        .SetReturn(INTERLOCKED_HL_TIMEOUT);
+
+    ///act
+    HRESULT hr = h_fabric_single_flight_wait(follower_call, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, FABRIC_E_TIMEOUT, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, NULL);
+}
+
+/*Tests_SRS_H_FABRIC_SINGLE_FLIGHT_01_035: [ If the wait fails then h_fabric_single_flight_wait shall return E_FAIL. ]*/
+TEST_FUNCTION(h_fabric_single_flight_wait_fails_when_InterlockedHL_WaitForValue_fails)
+{
+    ///arrange
+    H_FABRIC_SINGLE_FLIGHT_CALL* call = test_join_as_leader(L"fabric:/app/service");
+    H_FABRIC_SINGLE_FLIGHT_CALL* follower_call = test_join_as_follower(L"fabric:/app/service");
+    IUnknown* result;
+
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, IGNORED_ARG, TEST_TIMEOUT))
+        .SetReturn(INTERLOCKED_HL_ERROR);
+
+    ///act
+    HRESULT hr = h_fabric_single_flight_wait(follower_call, TEST_TIMEOUT, &result);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, E_FAIL, hr);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///clean
+    h_fabric_single_flight_complete(&test_single_flight, call, S_OK, NULL);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,338 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/interlocked.h"
+
+#include "sf_c_util/alloc_stats.h"
+
+#define ALLOC_STATS_REGISTRATION_STATE_VALUES \
+    ALLOC_STATS_NOT_REGISTERED, \
+    ALLOC_STATS_REGISTERING, \
+    ALLOC_STATS_REGISTERED
+
+MU_DEFINE_ENUM(ALLOC_STATS_REGISTRATION_STATE, ALLOC_STATS_REGISTRATION_STATE_VALUES)
+
+/* all the stats objects that have recorded at least one allocation, linked through their next field. Entries are never removed. */
+static void* volatile_atomic alloc_stats_list_head = NULL;
+
+static void register_stats(ALLOC_STATS* stats)
+{
+    if (interlocked_compare_exchange(&stats->registration_state, ALLOC_STATS_REGISTERING, ALLOC_STATS_NOT_REGISTERED) == ALLOC_STATS_NOT_REGISTERED)
+    {
+        void* current_head;
+        do
+        {
+            current_head = interlocked_compare_exchange_pointer(&alloc_stats_list_head, NULL, NULL);
+            stats->next = current_head;
+        } while (interlocked_compare_exchange_pointer(&alloc_stats_list_head, stats, current_head) != current_head);
+
+        (void)interlocked_exchange(&stats->registration_state, ALLOC_STATS_REGISTERED);
+    }
+}
+
+static ALLOC_STATS_COUNTERS* get_counters(ALLOC_STATS* stats, const char* function_name)
+{
+    ALLOC_STATS_COUNTERS* result;
+
+    if (
+        (stats == NULL) ||
+        (function_name == NULL)
+        )
+    {
+        /* Codes_SRS_ALLOC_STATS_01_034: [ If stats or function_name is NULL, the allocation functions of alloc_stats shall still allocate and free, without counting anything. ]*/
+        LogError("Invalid arguments: ALLOC_STATS* stats=%p, const char* function_name=%s", stats, MU_P_OR_NULL(function_name));
+        result = NULL;
+    }
+    else
+    {
+        uint32_t i;
+
+        /* Codes_SRS_ALLOC_STATS_01_035: [ If stats was not yet registered, it shall be added without taking any lock to the list of stats reported by alloc_stats_snapshot the first time something is counted in it. ]*/
+        if (interlocked_add(&stats->registration_state, 0) != ALLOC_STATS_REGISTERED)
+        {
+            register_stats(stats);
+        }
+
+        /* Codes_SRS_ALLOC_STATS_01_036: [ The counters of function_name shall be the ones of the slot of stats already holding function_name or else of the first free slot, claimed with a compare exchange. ]*/
+        /* Codes_SRS_ALLOC_STATS_01_037: [ If all ALLOC_STATS_FUNCTION_SLOT_COUNT slots are taken by other functions, other_functions shall be used. ]*/
+        result = &stats->other_functions;
+        for (i = 0; i < ALLOC_STATS_FUNCTION_SLOT_COUNT; i++)
+        {
+            /* taken slots are only read, a compare exchange on them would take their cache lines away from the threads counting in them */
+            void* slot_function_name = ReadPointerAcquire((PVOID volatile*)&stats->functions[i].function_name);
+            if (slot_function_name == NULL)
+            {
+                /* free, take it unless another thread takes it first */
+                slot_function_name = interlocked_compare_exchange_pointer(&stats->functions[i].function_name, (void*)function_name, NULL);
+                if (slot_function_name == NULL)
+                {
+                    slot_function_name = (void*)function_name;
+                }
+            }
+
+            if (slot_function_name == function_name)
+            {
+                result = &stats->functions[i].counters;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+static void record_allocation(ALLOC_STATS* stats, const char* function_name, size_t bytes)
+{
+    ALLOC_STATS_COUNTERS* counters = get_counters(stats, function_name);
+    if (counters != NULL)
+    {
+        (void)interlocked_increment_64(&counters->allocation_count);
+        (void)interlocked_add_64(&counters->allocated_bytes, (int64_t)bytes);
+    }
+}
+
+static void record_reallocation(ALLOC_STATS* stats, const char* function_name, void* ptr, size_t bytes)
+{
+    if (ptr == NULL)
+    {
+        record_allocation(stats, function_name, bytes);
+    }
+    else
+    {
+        ALLOC_STATS_COUNTERS* counters = get_counters(stats, function_name);
+        if (counters != NULL)
+        {
+            (void)interlocked_increment_64(&counters->reallocation_count);
+            (void)interlocked_add_64(&counters->reallocated_bytes, (int64_t)bytes);
+        }
+    }
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void*, alloc_stats_malloc, ALLOC_STATS*, stats, const char*, function_name, size_t, size)
+{
+    /* Codes_SRS_ALLOC_STATS_01_001: [ alloc_stats_malloc shall call gballoc_hl_malloc with size. ]*/
+    void* result = gballoc_hl_malloc(size);
+    if (result != NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_002: [ If the allocation succeeds, alloc_stats_malloc shall increment the allocation count of function_name in stats and add size to its allocated bytes. ]*/
+        record_allocation(stats, function_name, size);
+    }
+    /* Codes_SRS_ALLOC_STATS_01_003: [ alloc_stats_malloc shall return the result of gballoc_hl_malloc. ]*/
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void*, alloc_stats_malloc_2, ALLOC_STATS*, stats, const char*, function_name, size_t, nmemb, size_t, size)
+{
+    /* Codes_SRS_ALLOC_STATS_01_004: [ alloc_stats_malloc_2 shall call gballoc_hl_malloc_2 with nmemb and size. ]*/
+    void* result = gballoc_hl_malloc_2(nmemb, size);
+    if (result != NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_005: [ If the allocation succeeds, alloc_stats_malloc_2 shall increment the allocation count of function_name in stats and add nmemb * size to its allocated bytes. ]*/
+        record_allocation(stats, function_name, nmemb * size);
+    }
+    /* Codes_SRS_ALLOC_STATS_01_006: [ alloc_stats_malloc_2 shall return the result of gballoc_hl_malloc_2. ]*/
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void*, alloc_stats_malloc_flex, ALLOC_STATS*, stats, const char*, function_name, size_t, base, size_t, nmemb, size_t, size)
+{
+    /* Codes_SRS_ALLOC_STATS_01_007: [ alloc_stats_malloc_flex shall call gballoc_hl_malloc_flex with base, nmemb and size. ]*/
+    void* result = gballoc_hl_malloc_flex(base, nmemb, size);
+    if (result != NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_008: [ If the allocation succeeds, alloc_stats_malloc_flex shall increment the allocation count of function_name in stats and add base + nmemb * size to its allocated bytes. ]*/
+        record_allocation(stats, function_name, base + nmemb * size);
+    }
+    /* Codes_SRS_ALLOC_STATS_01_009: [ alloc_stats_malloc_flex shall return the result of gballoc_hl_malloc_flex. ]*/
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void*, alloc_stats_calloc, ALLOC_STATS*, stats, const char*, function_name, size_t, nmemb, size_t, size)
+{
+    /* Codes_SRS_ALLOC_STATS_01_010: [ alloc_stats_calloc shall call gballoc_hl_calloc with nmemb and size. ]*/
+    void* result = gballoc_hl_calloc(nmemb, size);
+    if (result != NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_011: [ If the allocation succeeds, alloc_stats_calloc shall increment the allocation count of function_name in stats and add nmemb * size to its allocated bytes. ]*/
+        record_allocation(stats, function_name, nmemb * size);
+    }
+    /* Codes_SRS_ALLOC_STATS_01_012: [ alloc_stats_calloc shall return the result of gballoc_hl_calloc. ]*/
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void*, alloc_stats_realloc, ALLOC_STATS*, stats, const char*, function_name, void*, ptr, size_t, size)
+{
+    /* Codes_SRS_ALLOC_STATS_01_013: [ alloc_stats_realloc shall call gballoc_hl_realloc with ptr and size. ]*/
+    void* result = gballoc_hl_realloc(ptr, size);
+    if (result != NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_014: [ If the reallocation succeeds and ptr is NULL, alloc_stats_realloc shall increment the allocation count of function_name in stats and add size to its allocated bytes. ]*/
+        /* Codes_SRS_ALLOC_STATS_01_015: [ If the reallocation succeeds and ptr is not NULL, alloc_stats_realloc shall increment the reallocation count of function_name in stats and add size to its reallocated bytes. ]*/
+        record_reallocation(stats, function_name, ptr, size);
+    }
+    /* Codes_SRS_ALLOC_STATS_01_016: [ alloc_stats_realloc shall return the result of gballoc_hl_realloc. ]*/
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void*, alloc_stats_realloc_2, ALLOC_STATS*, stats, const char*, function_name, void*, ptr, size_t, nmemb, size_t, size)
+{
+    /* Codes_SRS_ALLOC_STATS_01_017: [ alloc_stats_realloc_2 shall call gballoc_hl_realloc_2 with ptr, nmemb and size. ]*/
+    void* result = gballoc_hl_realloc_2(ptr, nmemb, size);
+    if (result != NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_018: [ If the reallocation succeeds, alloc_stats_realloc_2 shall record it as alloc_stats_realloc does, with nmemb * size bytes. ]*/
+        record_reallocation(stats, function_name, ptr, nmemb * size);
+    }
+    /* Codes_SRS_ALLOC_STATS_01_019: [ alloc_stats_realloc_2 shall return the result of gballoc_hl_realloc_2. ]*/
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void*, alloc_stats_realloc_flex, ALLOC_STATS*, stats, const char*, function_name, void*, ptr, size_t, base, size_t, nmemb, size_t, size)
+{
+    /* Codes_SRS_ALLOC_STATS_01_020: [ alloc_stats_realloc_flex shall call gballoc_hl_realloc_flex with ptr, base, nmemb and size. ]*/
+    void* result = gballoc_hl_realloc_flex(ptr, base, nmemb, size);
+    if (result != NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_021: [ If the reallocation succeeds, alloc_stats_realloc_flex shall record it as alloc_stats_realloc does, with base + nmemb * size bytes. ]*/
+        record_reallocation(stats, function_name, ptr, base + nmemb * size);
+    }
+    /* Codes_SRS_ALLOC_STATS_01_022: [ alloc_stats_realloc_flex shall return the result of gballoc_hl_realloc_flex. ]*/
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void, alloc_stats_free, ALLOC_STATS*, stats, const char*, function_name, void*, ptr)
+{
+    if (ptr != NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_023: [ If ptr is not NULL, alloc_stats_free shall increment the free count of function_name in stats. ]*/
+        ALLOC_STATS_COUNTERS* counters = get_counters(stats, function_name);
+        if (counters != NULL)
+        {
+            (void)interlocked_increment_64(&counters->free_count);
+        }
+    }
+    /* Codes_SRS_ALLOC_STATS_01_024: [ alloc_stats_free shall call gballoc_hl_free with ptr. ]*/
+    gballoc_hl_free(ptr);
+}
+
+static bool read_counters(ALLOC_STATS_COUNTERS* counters, ALLOC_STATS_SNAPSHOT* snapshot)
+{
+    snapshot->allocation_count = (uint64_t)interlocked_add_64(&counters->allocation_count, 0);
+    snapshot->allocated_bytes = (uint64_t)interlocked_add_64(&counters->allocated_bytes, 0);
+    snapshot->reallocation_count = (uint64_t)interlocked_add_64(&counters->reallocation_count, 0);
+    snapshot->reallocated_bytes = (uint64_t)interlocked_add_64(&counters->reallocated_bytes, 0);
+    snapshot->free_count = (uint64_t)interlocked_add_64(&counters->free_count, 0);
+    return (snapshot->allocation_count != 0) || (snapshot->reallocation_count != 0) || (snapshot->free_count != 0);
+}
+
+static void for_each_snapshot(ALLOC_STATS_SNAPSHOT_CB on_snapshot, void* on_snapshot_context)
+{
+    ALLOC_STATS_SNAPSHOT snapshot;
+    ALLOC_STATS* stats = interlocked_compare_exchange_pointer(&alloc_stats_list_head, NULL, NULL);
+
+    while (stats != NULL)
+    {
+        uint32_t i;
+
+        snapshot.module_name = stats->module_name;
+        for (i = 0; i < ALLOC_STATS_FUNCTION_SLOT_COUNT; i++)
+        {
+            snapshot.function_name = interlocked_compare_exchange_pointer(&stats->functions[i].function_name, NULL, NULL);
+            if (snapshot.function_name == NULL)
+            {
+                break;
+            }
+            (void)read_counters(&stats->functions[i].counters, &snapshot);
+            on_snapshot(on_snapshot_context, &snapshot);
+        }
+
+        snapshot.function_name = ALLOC_STATS_OTHER_FUNCTIONS_NAME;
+        if (read_counters(&stats->other_functions, &snapshot))
+        {
+            on_snapshot(on_snapshot_context, &snapshot);
+        }
+
+        stats = stats->next;
+    }
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, int, alloc_stats_snapshot, ALLOC_STATS_SNAPSHOT_CB, on_snapshot, void*, on_snapshot_context)
+{
+    int result;
+
+    /* Codes_SRS_ALLOC_STATS_01_026: [ on_snapshot_context shall be allowed to be NULL. ]*/
+
+    if (on_snapshot == NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_025: [ If on_snapshot is NULL, alloc_stats_snapshot shall fail and return a non-zero value. ]*/
+        LogError("Invalid arguments: ALLOC_STATS_SNAPSHOT_CB on_snapshot=%p, void* on_snapshot_context=%p", on_snapshot, on_snapshot_context);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_ALLOC_STATS_01_027: [ For each function of each registered stats object, alloc_stats_snapshot shall fill an ALLOC_STATS_SNAPSHOT with the counters read at the time of the call and call on_snapshot with it. ]*/
+        /* Codes_SRS_ALLOC_STATS_01_028: [ If other_functions of a stats object counted anything, alloc_stats_snapshot shall call on_snapshot with its counters and ALLOC_STATS_OTHER_FUNCTIONS_NAME as function_name. ]*/
+        for_each_snapshot(on_snapshot, on_snapshot_context);
+
+        /* Codes_SRS_ALLOC_STATS_01_029: [ On success alloc_stats_snapshot shall return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+static void add_to_totals(void* context, const ALLOC_STATS_SNAPSHOT* snapshot)
+{
+    ALLOC_STATS_SNAPSHOT* totals = context;
+    if (
+        ((totals->module_name == NULL) || (strcmp(totals->module_name, snapshot->module_name) == 0)) &&
+        ((totals->function_name == NULL) || (strcmp(totals->function_name, snapshot->function_name) == 0))
+        )
+    {
+        totals->allocation_count += snapshot->allocation_count;
+        totals->allocated_bytes += snapshot->allocated_bytes;
+        totals->reallocation_count += snapshot->reallocation_count;
+        totals->reallocated_bytes += snapshot->reallocated_bytes;
+        totals->free_count += snapshot->free_count;
+    }
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, int, alloc_stats_get_totals, const char*, module_name, const char*, function_name, ALLOC_STATS_SNAPSHOT*, totals)
+{
+    int result;
+
+    /* Codes_SRS_ALLOC_STATS_01_031: [ module_name and function_name shall be allowed to be NULL. ]*/
+
+    if (totals == NULL)
+    {
+        /* Codes_SRS_ALLOC_STATS_01_030: [ If totals is NULL, alloc_stats_get_totals shall fail and return a non-zero value. ]*/
+        LogError("Invalid arguments: const char* module_name=%s, const char* function_name=%s, ALLOC_STATS_SNAPSHOT* totals=%p",
+            MU_P_OR_NULL(module_name), MU_P_OR_NULL(function_name), totals);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_ALLOC_STATS_01_032: [ alloc_stats_get_totals shall set totals to the sum of the counters of all the snapshots whose module_name and function_name are equal to module_name and function_name, a NULL module_name or function_name matching any value. ]*/
+        (void)memset(totals, 0, sizeof(ALLOC_STATS_SNAPSHOT));
+        totals->module_name = module_name;
+        totals->function_name = function_name;
+        for_each_snapshot(add_to_totals, totals);
+
+        /* Codes_SRS_ALLOC_STATS_01_033: [ On success alloc_stats_get_totals shall return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
@@ -11,6 +11,10 @@
 
 #include "sf_c_util/common_argc_argv.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(common_argc_argv)
+
 MU_DEFINE_ENUM_STRINGS(ARGC_ARGV_DATA_RESULT, ARGC_ARGV_DATA_RESULT_VALUES);
 
 const char* ARGC_ARGV_KEYWORDS_LIST[] = { ARGC_ARGV_KEYWORDS_LIST_DEFINE };
@@ -21,6 +21,10 @@
 
 #include "sf_c_util/configuration_reader.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(configuration_reader)
+
 #define TRUEString L"True"
 #define FALSEString L"False"
 
@@ -16,6 +16,10 @@
 
 #include "sf_c_util/fabric_async_op_cb.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fabric_async_op_cb)
+
 typedef struct FABRIC_ASYNC_OP_CB_TAG
 {
     USER_INVOKE_CB user_invoke_cb;
@@ -13,6 +13,10 @@
 
 #include "sf_c_util/fabric_op_completed_sync_ctx.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fabric_op_completed_sync_ctx)
+
 typedef struct FABRIC_OP_COMPLETED_SYNC_CTX_TAG
 {
     IFabricAsyncOperationCallback* callback;
@@ -0,0 +1,325 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h"
+#include "c_pal/timer.h"
+
+#include "sf_c_util/fabric_op_stats.h"
+
+#define FABRIC_OP_STATS_REGISTRATION_STATE_VALUES \
+    FABRIC_OP_STATS_NOT_REGISTERED, \
+    FABRIC_OP_STATS_REGISTERING, \
+    FABRIC_OP_STATS_REGISTERED
+
+MU_DEFINE_ENUM(FABRIC_OP_STATS_REGISTRATION_STATE, FABRIC_OP_STATS_REGISTRATION_STATE_VALUES)
+
+#define FABRIC_OP_STATS_LINEAR_LIMIT ((uint64_t)1 << (FABRIC_OP_STATS_LATENCY_SUB_BUCKET_BITS + 1))
+#define FABRIC_OP_STATS_SUB_BUCKET_COUNT ((uint32_t)1 << FABRIC_OP_STATS_LATENCY_SUB_BUCKET_BITS)
+#define FABRIC_OP_STATS_HRESULT_KEY(hr) ((int64_t)(((uint64_t)1 << 32) | (uint32_t)(hr)))
+
+/* all the stats objects that have recorded at least one call, linked through their next field. Entries are never removed. */
+static void* volatile_atomic fabric_op_stats_list_head = NULL;
+
+static uint32_t get_most_significant_bit(uint64_t value)
+{
+    uint32_t result = 0;
+    while (value > 1)
+    {
+        value >>= 1;
+        result++;
+    }
+    return result;
+}
+
+static uint32_t get_latency_bucket_index(uint64_t latency_us)
+{
+    uint32_t result;
+    if (latency_us < FABRIC_OP_STATS_LINEAR_LIMIT)
+    {
+        result = (uint32_t)latency_us;
+    }
+    else
+    {
+        uint32_t msb = get_most_significant_bit(latency_us);
+        uint32_t sub_bucket = (uint32_t)(latency_us >> (msb - FABRIC_OP_STATS_LATENCY_SUB_BUCKET_BITS)) & (FABRIC_OP_STATS_SUB_BUCKET_COUNT - 1);
+        result = (uint32_t)FABRIC_OP_STATS_LINEAR_LIMIT + (msb - (FABRIC_OP_STATS_LATENCY_SUB_BUCKET_BITS + 1)) * FABRIC_OP_STATS_SUB_BUCKET_COUNT + sub_bucket;
+        if (result >= FABRIC_OP_STATS_LATENCY_BUCKET_COUNT)
+        {
+            result = FABRIC_OP_STATS_LATENCY_BUCKET_COUNT - 1;
+        }
+    }
+    return result;
+}
+
+static uint64_t get_latency_bucket_upper_bound(uint32_t bucket_index)
+{
+    uint64_t result;
+    if (bucket_index < FABRIC_OP_STATS_LINEAR_LIMIT)
+    {
+        result = bucket_index;
+    }
+    else
+    {
+        uint32_t msb = (bucket_index - (uint32_t)FABRIC_OP_STATS_LINEAR_LIMIT) / FABRIC_OP_STATS_SUB_BUCKET_COUNT + (FABRIC_OP_STATS_LATENCY_SUB_BUCKET_BITS + 1);
+        uint64_t sub_bucket = (bucket_index - (uint32_t)FABRIC_OP_STATS_LINEAR_LIMIT) % FABRIC_OP_STATS_SUB_BUCKET_COUNT;
+        result = ((FABRIC_OP_STATS_SUB_BUCKET_COUNT + sub_bucket + 1) << (msb - FABRIC_OP_STATS_LATENCY_SUB_BUCKET_BITS)) - 1;
+    }
+    return result;
+}
+
+static void register_stats(FABRIC_OP_STATS* stats)
+{
+    if (interlocked_compare_exchange(&stats->registration_state, FABRIC_OP_STATS_REGISTERING, FABRIC_OP_STATS_NOT_REGISTERED) == FABRIC_OP_STATS_NOT_REGISTERED)
+    {
+        void* current_head;
+        do
+        {
+            current_head = interlocked_compare_exchange_pointer(&fabric_op_stats_list_head, NULL, NULL);
+            stats->next = current_head;
+        } while (interlocked_compare_exchange_pointer(&fabric_op_stats_list_head, stats, current_head) != current_head);
+
+        (void)interlocked_exchange(&stats->registration_state, FABRIC_OP_STATS_REGISTERED);
+    }
+}
+
+static void record_hresult(FABRIC_OP_STATS* stats, HRESULT result)
+{
+    int64_t key = FABRIC_OP_STATS_HRESULT_KEY(result);
+    uint32_t i;
+    for (i = 0; i < FABRIC_OP_STATS_HRESULT_SLOT_COUNT; i++)
+    {
+        /* taken slots are only read, a compare exchange on them would take their cache lines away from the threads counting in them */
+        int64_t slot_key = ReadAcquire64((volatile LONG64*)&stats->hresults[i].key);
+        if (slot_key == 0)
+        {
+            /* free, take it unless another thread takes it first */
+            slot_key = interlocked_compare_exchange_64(&stats->hresults[i].key, key, 0);
+            if (slot_key == 0)
+            {
+                slot_key = key;
+            }
+        }
+
+        if (slot_key == key)
+        {
+            (void)interlocked_increment_64(&stats->hresults[i].count);
+            break;
+        }
+    }
+
+    if (i == FABRIC_OP_STATS_HRESULT_SLOT_COUNT)
+    {
+        (void)interlocked_increment_64(&stats->other_hresult_count);
+    }
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, double, fabric_op_stats_record_begin, FABRIC_OP_STATS*, stats)
+{
+    double result;
+
+    if (stats == NULL)
+    {
+        /* Codes_SRS_FABRIC_OP_STATS_01_001: [ If stats is NULL, fabric_op_stats_record_begin shall return 0. ]*/
+        LogError("Invalid arguments: FABRIC_OP_STATS* stats=%p", stats);
+        result = 0;
+    }
+    else
+    {
+        /* Codes_SRS_FABRIC_OP_STATS_01_002: [ If stats was not yet registered, fabric_op_stats_record_begin shall add it to the list of stats reported by fabric_op_stats_snapshot without taking any lock. ]*/
+        if (interlocked_add(&stats->registration_state, 0) != FABRIC_OP_STATS_REGISTERED)
+        {
+            register_stats(stats);
+        }
+
+        /* Codes_SRS_FABRIC_OP_STATS_01_003: [ fabric_op_stats_record_begin shall increment the call count of stats. ]*/
+        (void)interlocked_increment_64(&stats->call_count);
+
+        /* Codes_SRS_FABRIC_OP_STATS_01_004: [ fabric_op_stats_record_begin shall return the current time in microseconds as obtained from timer_global_get_elapsed_us. ]*/
+        result = timer_global_get_elapsed_us();
+    }
+
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void, fabric_op_stats_record_begin_failed, FABRIC_OP_STATS*, stats, HRESULT, result)
+{
+    if (stats == NULL)
+    {
+        /* Codes_SRS_FABRIC_OP_STATS_01_019: [ If stats is NULL, fabric_op_stats_record_begin_failed shall return. ]*/
+        LogError("Invalid arguments: FABRIC_OP_STATS* stats=%p, HRESULT result=0x%08x", stats, result);
+    }
+    else
+    {
+        /* Codes_SRS_FABRIC_OP_STATS_01_020: [ fabric_op_stats_record_begin_failed shall increment the Begin failure count of stats. ]*/
+        (void)interlocked_increment_64(&stats->begin_failed_count);
+
+        /* Codes_SRS_FABRIC_OP_STATS_01_021: [ fabric_op_stats_record_begin_failed shall increment the count for result the same way as fabric_op_stats_record_end. ]*/
+        record_hresult(stats, result);
+    }
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void, fabric_op_stats_record_end, FABRIC_OP_STATS*, stats, double, start_time_us, bool, completed_synchronously, HRESULT, result)
+{
+    if (stats == NULL)
+    {
+        /* Codes_SRS_FABRIC_OP_STATS_01_005: [ If stats is NULL, fabric_op_stats_record_end shall return. ]*/
+        LogError("Invalid arguments: FABRIC_OP_STATS* stats=%p, double start_time_us=%lf, bool completed_synchronously=%" PRI_BOOL ", HRESULT result=0x%08x",
+            stats, start_time_us, MU_BOOL_VALUE(completed_synchronously), result);
+    }
+    else
+    {
+        double now = timer_global_get_elapsed_us();
+        /* Codes_SRS_FABRIC_OP_STATS_01_006: [ fabric_op_stats_record_end shall compute the latency as the difference between the current time obtained from timer_global_get_elapsed_us and start_time_us, clamping negative values to 0. ]*/
+        uint64_t latency_us = (now > start_time_us) ? (uint64_t)(now - start_time_us) : 0;
+
+        /* Codes_SRS_FABRIC_OP_STATS_01_007: [ fabric_op_stats_record_end shall increment the latency bucket corresponding to the latency in the stripe selected by the current thread id. ]*/
+        uint32_t stripe = (uint32_t)GetCurrentThreadId() % FABRIC_OP_STATS_LATENCY_STRIPE_COUNT;
+        (void)interlocked_increment_64(&stats->latency_buckets[stripe][get_latency_bucket_index(latency_us)]);
+
+        /* Codes_SRS_FABRIC_OP_STATS_01_008: [ If completed_synchronously is true, fabric_op_stats_record_end shall increment the synchronous completion count, otherwise it shall increment the asynchronous completion count. ]*/
+        if (completed_synchronously)
+        {
+            (void)interlocked_increment_64(&stats->completed_synchronously_count);
+        }
+        else
+        {
+            (void)interlocked_increment_64(&stats->completed_asynchronously_count);
+        }
+
+        /* Codes_SRS_FABRIC_OP_STATS_01_009: [ fabric_op_stats_record_end shall increment the count for result by claiming with a compare exchange either the slot already holding result or the first free slot. ]*/
+        /* Codes_SRS_FABRIC_OP_STATS_01_010: [ If all FABRIC_OP_STATS_HRESULT_SLOT_COUNT slots are taken by other values, fabric_op_stats_record_end shall increment other_hresult_count. ]*/
+        record_hresult(stats, result);
+    }
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, int, fabric_op_stats_snapshot, FABRIC_OP_STATS_SNAPSHOT_CB, on_snapshot, void*, on_snapshot_context)
+{
+    int result;
+
+    /* Codes_SRS_FABRIC_OP_STATS_01_012: [ on_snapshot_context shall be allowed to be NULL. ]*/
+
+    if (on_snapshot == NULL)
+    {
+        /* Codes_SRS_FABRIC_OP_STATS_01_011: [ If on_snapshot is NULL, fabric_op_stats_snapshot shall fail and return a non-zero value. ]*/
+        LogError("Invalid arguments: FABRIC_OP_STATS_SNAPSHOT_CB on_snapshot=%p, void* on_snapshot_context=%p", on_snapshot, on_snapshot_context);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        FABRIC_OP_STATS_SNAPSHOT snapshot;
+        FABRIC_OP_STATS* stats = interlocked_compare_exchange_pointer(&fabric_op_stats_list_head, NULL, NULL);
+
+        /* Codes_SRS_FABRIC_OP_STATS_01_013: [ For each registered stats object, fabric_op_stats_snapshot shall fill a FABRIC_OP_STATS_SNAPSHOT with the counters read at the time of the call, summing the latency buckets across all stripes, and call on_snapshot with it. ]*/
+        while (stats != NULL)
+        {
+            uint32_t i;
+
+            (void)memset(&snapshot, 0, sizeof(snapshot));
+            snapshot.interface_name = stats->interface_name;
+            snapshot.operation_name = stats->operation_name;
+            snapshot.api_name = stats->api_name;
+            snapshot.call_count = (uint64_t)interlocked_add_64(&stats->call_count, 0);
+            snapshot.begin_failed_count = (uint64_t)interlocked_add_64(&stats->begin_failed_count, 0);
+            snapshot.completed_synchronously_count = (uint64_t)interlocked_add_64(&stats->completed_synchronously_count, 0);
+            snapshot.completed_asynchronously_count = (uint64_t)interlocked_add_64(&stats->completed_asynchronously_count, 0);
+            snapshot.other_hresult_count = (uint64_t)interlocked_add_64(&stats->other_hresult_count, 0);
+
+            for (i = 0; i < FABRIC_OP_STATS_HRESULT_SLOT_COUNT; i++)
+            {
+                int64_t key = interlocked_add_64(&stats->hresults[i].key, 0);
+                if (key == 0)
+                {
+                    break;
+                }
+                snapshot.hresults[snapshot.hresult_count].hresult = (HRESULT)(uint32_t)key;
+                snapshot.hresults[snapshot.hresult_count].count = (uint64_t)interlocked_add_64(&stats->hresults[i].count, 0);
+                snapshot.hresult_count++;
+            }
+
+            for (i = 0; i < FABRIC_OP_STATS_LATENCY_STRIPE_COUNT; i++)
+            {
+                uint32_t j;
+                for (j = 0; j < FABRIC_OP_STATS_LATENCY_BUCKET_COUNT; j++)
+                {
+                    snapshot.latency_buckets[j] += (uint64_t)interlocked_add_64(&stats->latency_buckets[i][j], 0);
+                }
+            }
+
+            on_snapshot(on_snapshot_context, &snapshot);
+
+            stats = stats->next;
+        }
+
+        /* Codes_SRS_FABRIC_OP_STATS_01_014: [ On success fabric_op_stats_snapshot shall return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, uint64_t, fabric_op_stats_get_latency_percentile_us, const FABRIC_OP_STATS_SNAPSHOT*, snapshot, double, percentile)
+{
+    uint64_t result;
+
+    if (
+        /* Codes_SRS_FABRIC_OP_STATS_01_015: [ If snapshot is NULL, fabric_op_stats_get_latency_percentile_us shall return 0. ]*/
+        (snapshot == NULL) ||
+        /* Codes_SRS_FABRIC_OP_STATS_01_016: [ If percentile is not in the [0, 100] range, fabric_op_stats_get_latency_percentile_us shall return 0. ]*/
+        (percentile < 0) ||
+        (percentile > 100)
+        )
+    {
+        LogError("Invalid arguments: const FABRIC_OP_STATS_SNAPSHOT* snapshot=%p, double percentile=%lf", snapshot, percentile);
+        result = 0;
+    }
+    else
+    {
+        uint64_t total = 0;
+        uint32_t i;
+        for (i = 0; i < FABRIC_OP_STATS_LATENCY_BUCKET_COUNT; i++)
+        {
+            total += snapshot->latency_buckets[i];
+        }
+
+        if (total == 0)
+        {
+            /* Codes_SRS_FABRIC_OP_STATS_01_017: [ If no latency was recorded in snapshot, fabric_op_stats_get_latency_percentile_us shall return 0. ]*/
+            result = 0;
+        }
+        else
+        {
+            /* Codes_SRS_FABRIC_OP_STATS_01_018: [ Otherwise fabric_op_stats_get_latency_percentile_us shall return the upper bound in microseconds of the first bucket at which the cumulative count reaches percentile percent of all recorded latencies. ]*/
+            double exact_target = (percentile * (double)total) / 100.0;
+            uint64_t target = (uint64_t)exact_target;
+            uint64_t cumulative = 0;
+            if ((target == 0) || ((double)target < exact_target))
+            {
+                target++;
+            }
+
+            result = get_latency_bucket_upper_bound(FABRIC_OP_STATS_LATENCY_BUCKET_COUNT - 1);
+            for (i = 0; i < FABRIC_OP_STATS_LATENCY_BUCKET_COUNT; i++)
+            {
+                cumulative += snapshot->latency_buckets[i];
+                if (cumulative >= target)
+                {
+                    result = get_latency_bucket_upper_bound(i);
+                    break;
+                }
+            }
+        }
+    }
+
+    return result;
+}
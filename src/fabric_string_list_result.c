@@ -5,95 +5,157 @@
 #include <stddef.h>
 #include <wchar.h>
 #include <inttypes.h>
-#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
 
 #include "windows.h"
 
 #include "c_logging/logger.h"
 
-#include "c_pal/string_utils.h"
 #include "c_pal/gballoc_hl.h"
 #include "c_pal/gballoc_hl_redirect.h"
 
 #include "sf_c_util/fabric_string_list_result.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fabric_string_list_result)
+
 typedef struct FABRIC_STRING_LIST_RESULT_TAG
 {
     ULONG nstrings;
-    wchar_t* strings[];
+    const LPCWSTR* strings; /*either strings_storage or what was given to fabric_string_list_result_create_move*/
+    void* buffer; /*owned by the result, NULL when there is nothing to free besides the result*/
+    LPCWSTR strings_storage[]; /*fabric_string_list_result_create puts the pointers here, followed by the characters of all the strings*/
 } FABRIC_STRING_LIST_RESULT;
 
 FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result_create(ULONG nStrings, const wchar_t** strings)
 {
     FABRIC_STRING_LIST_RESULT_HANDLE result;
 
+    /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_001: [ If strings is NULL, fabric_string_list_result_create shall fail and return NULL. ]*/
     if (strings == NULL)
     {
         LogError("invalid argument ULONG nStrings=%" PRIu32 ", const wchar_t** strings=%p",
             nStrings, strings);
         result = NULL;
     }
+    else if (nStrings > (SIZE_MAX - sizeof(FABRIC_STRING_LIST_RESULT)) / sizeof(LPCWSTR))
+    {
+        LogError("Overflow in needed memory computation, ULONG nStrings=%" PRIu32 "", nStrings);
+        result = NULL;
+    }
     else
     {
-        result = malloc_flex(sizeof(FABRIC_STRING_LIST_RESULT), nStrings, sizeof(wchar_t*));
-        if (result == NULL)
+        /*measure all the strings once, so that the pointers and the characters fit in the same allocation as the result*/
+        size_t total_length = 0;
+        ULONG i;
+        for (i = 0; i < nStrings; i++)
         {
-            LogError("failure in malloc_flex");
+            size_t length;
+            /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_002: [ If any of the nStrings entries of strings is NULL, fabric_string_list_result_create shall fail and return NULL. ]*/
+            if (strings[i] == NULL)
+            {
+                LogError("invalid argument const wchar_t** strings=%p has strings[%" PRIu32 "]=NULL", strings, i);
+                break;
+            }
+
+            length = wcslen(strings[i]);
+            if (length >= SIZE_MAX - total_length) /*one for the zero terminator*/
+            {
+                LogError("Overflow in needed memory computation");
+                break;
+            }
+            total_length += length + 1;
+        }
+
+        if (i < nStrings)
+        {
+            /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_006: [ If any error occurs, fabric_string_list_result_create shall fail and return NULL. ]*/
+            result = NULL;
         }
         else
         {
-            ULONG i;
-            bool wasError = false;
-            for (i = 0; !wasError && (i < nStrings); i++)
+            /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_003: [ fabric_string_list_result_create shall allocate with one call to malloc_flex the fabric string list result instance, nStrings pointers and the characters of all the strings including their zero terminators. ]*/
+            /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_005: [ If nStrings is 0, fabric_string_list_result_create shall succeed and return a fabric string list result with no strings. ]*/
+            result = malloc_flex(sizeof(FABRIC_STRING_LIST_RESULT) + nStrings * sizeof(LPCWSTR), total_length, sizeof(wchar_t));
+            if (result == NULL)
             {
-                result->strings[i] = sprintf_wchar(L"%ls", strings[i]); /*can be made missing with enough smartnesses*/
-                if (result->strings[i] == NULL)
-                {
-                    LogError("failire in sprintf_wchar");
-                    wasError = true;
-                }
-                else
-                {
-                    /*keep going*/
-                }
+                /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_006: [ If any error occurs, fabric_string_list_result_create shall fail and return NULL. ]*/
+                LogError("failure in malloc_flex(%zu, %zu, %zu)", sizeof(FABRIC_STRING_LIST_RESULT) + nStrings * sizeof(LPCWSTR), total_length, sizeof(wchar_t));
             }
-
-            if (wasError)
+            else
             {
-                ULONG j;
-                for (j = 0; j < i; j++)
+                /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_004: [ fabric_string_list_result_create shall copy the strings one after the other after the pointers and shall set every pointer to the copy of the string with the same index. ]*/
+                wchar_t* characters = (wchar_t*)(result->strings_storage + nStrings);
+                for (i = 0; i < nStrings; i++)
                 {
-                    free(result->strings[j]);
+                    size_t size = (wcslen(strings[i]) + 1) * sizeof(wchar_t);
+                    (void)memcpy(characters, strings[i], size);
+                    result->strings_storage[i] = characters;
+                    characters += size / sizeof(wchar_t);
                 }
-            }
-            else
-            {
+
                 result->nstrings = nStrings;
-                goto allok;
+                result->strings = result->strings_storage;
+                result->buffer = NULL;
             }
+        }
+    }
 
+    return result;
+}
 
+FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result_create_move(ULONG nStrings, const wchar_t** strings, void* buffer)
+{
+    FABRIC_STRING_LIST_RESULT_HANDLE result;
 
-            free(result);
-            result = NULL;
+    /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_007: [ If strings is NULL and nStrings is greater than 0, fabric_string_list_result_create_move shall fail and return NULL. ]*/
+    if (
+        (strings == NULL) &&
+        (nStrings > 0)
+        )
+    {
+        LogError("invalid argument ULONG nStrings=%" PRIu32 ", const wchar_t** strings=%p, void* buffer=%p",
+            nStrings, strings, buffer);
+        result = NULL;
+    }
+    else
+    {
+        /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_008: [ fabric_string_list_result_create_move shall allocate a new fabric string list result instance and on success return a non-NULL pointer to it. ]*/
+        result = malloc(sizeof(FABRIC_STRING_LIST_RESULT));
+        if (result == NULL)
+        {
+            /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_010: [ If any error occurs, fabric_string_list_result_create_move shall fail, shall not free buffer and shall return NULL. ]*/
+            LogError("failure in malloc(%zu)", sizeof(FABRIC_STRING_LIST_RESULT));
+        }
+        else
+        {
+            /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_009: [ fabric_string_list_result_create_move shall not copy strings, it shall store nStrings, strings and buffer. ]*/
+            result->nstrings = nStrings;
+            result->strings = strings;
+            result->buffer = buffer;
         }
     }
-allok:;
+
     return result;
 }
 
 void fabric_string_list_result_destroy(FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result)
 {
+    /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_011: [ If fabric_string_list_result is NULL, fabric_string_list_result_destroy shall return. ]*/
     if (fabric_string_list_result == NULL)
     {
         LogError("Invalid arguments: FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result=%p", fabric_string_list_result);
     }
     else
     {
-        for (ULONG i = 0; i < fabric_string_list_result->nstrings; i++)
+        /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_012: [ If fabric_string_list_result was created by fabric_string_list_result_create_move with a non-NULL buffer, fabric_string_list_result_destroy shall free buffer. ]*/
+        if (fabric_string_list_result->buffer != NULL)
         {
-            free(fabric_string_list_result->strings[i]);
+            free(fabric_string_list_result->buffer);
         }
+        /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_013: [ fabric_string_list_result_destroy shall free the memory associated with the fabric string list result instance. ]*/
         free(fabric_string_list_result);
     }
 }
@@ -102,8 +164,9 @@ HRESULT fabric_string_list_result_GetStrings(FABRIC_STRING_LIST_RESULT_HANDLE fa
 {
     HRESULT result;
 
+    /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_014: [ If fabric_string_list_result is NULL or nStrings is NULL or strings is NULL, fabric_string_list_result_GetStrings shall fail and return E_INVALIDARG. ]*/
     if (
-        (fabric_string_list_result == NULL)||
+        (fabric_string_list_result == NULL) ||
         (nStrings == NULL) ||
         (strings == NULL)
         )
@@ -114,6 +177,7 @@ HRESULT fabric_string_list_result_GetStrings(FABRIC_STRING_LIST_RESULT_HANDLE fa
     }
     else
     {
+        /*Codes_SRS_FABRIC_STRING_LIST_RESULT_01_015: [ Otherwise, fabric_string_list_result_GetStrings shall set nStrings to the number of strings, strings to the pointers of the strings and return S_OK. ]*/
         *nStrings = fabric_string_list_result->nstrings;
         *strings = fabric_string_list_result->strings;
         result = S_OK;
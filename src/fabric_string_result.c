@@ -14,9 +14,16 @@
 
 #include "sf_c_util/fabric_string_result.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fabric_string_result)
+
 typedef struct FABRIC_STRING_RESULT_TAG
 {
-    wchar_t string_result[];
+    const wchar_t* string_result; /*either string_result_copy or the string given to fabric_string_result_create_with_custom_free*/
+    FABRIC_STRING_RESULT_FREE_FUNC free_func;
+    void* free_func_context;
+    wchar_t string_result_copy[];
 } FABRIC_STRING_RESULT;
 
 IMPLEMENT_MOCKABLE_FUNCTION(, FABRIC_STRING_RESULT_HANDLE, fabric_string_result_create, const wchar_t*, string_result)
@@ -53,7 +60,10 @@ IMPLEMENT_MOCKABLE_FUNCTION(, FABRIC_STRING_RESULT_HANDLE, fabric_string_result_
             else
             {
                 /* Codes_SRS_FABRIC_STRING_RESULT_01_002: [ fabric_string_result_create shall copy the string_result string so it can be returned by get_String. ]*/
-                (void)memcpy(result->string_result, string_result, sizeof(wchar_t) * (string_length));
+                (void)memcpy(result->string_result_copy, string_result, sizeof(wchar_t) * (string_length));
+                result->string_result = result->string_result_copy;
+                result->free_func = NULL;
+                result->free_func_context = NULL;
                 goto all_ok;
             }
         }
@@ -65,6 +75,38 @@ all_ok:
     return result;
 }
 
+IMPLEMENT_MOCKABLE_FUNCTION(, FABRIC_STRING_RESULT_HANDLE, fabric_string_result_create_with_custom_free, const wchar_t*, string_result, FABRIC_STRING_RESULT_FREE_FUNC, free_func, void*, free_func_context)
+{
+    FABRIC_STRING_RESULT_HANDLE result;
+
+    if (string_result == NULL)
+    {
+        /* Codes_SRS_FABRIC_STRING_RESULT_01_009: [ If string_result is NULL, fabric_string_result_create_with_custom_free shall fail and return NULL. ]*/
+        LogError("Invalid arguments: const wchar_t* string_result=%ls, FABRIC_STRING_RESULT_FREE_FUNC free_func=%p, void* free_func_context=%p",
+            MU_WP_OR_NULL(string_result), free_func, free_func_context);
+        result = NULL;
+    }
+    else
+    {
+        /* Codes_SRS_FABRIC_STRING_RESULT_01_010: [ fabric_string_result_create_with_custom_free shall allocate a new fabric string result instance and on success return a non-NULL pointer to it. ]*/
+        result = malloc(sizeof(FABRIC_STRING_RESULT));
+        if (result == NULL)
+        {
+            /* Codes_SRS_FABRIC_STRING_RESULT_01_012: [ If any error occurs, fabric_string_result_create_with_custom_free shall fail and return NULL. ]*/
+            LogError("malloc(%zu) failed", sizeof(FABRIC_STRING_RESULT));
+        }
+        else
+        {
+            /* Codes_SRS_FABRIC_STRING_RESULT_01_011: [ fabric_string_result_create_with_custom_free shall not copy string_result, it shall store string_result, free_func and free_func_context. ]*/
+            result->string_result = string_result;
+            result->free_func = free_func;
+            result->free_func_context = free_func_context;
+        }
+    }
+
+    return result;
+}
+
 IMPLEMENT_MOCKABLE_FUNCTION(, void, fabric_string_result_destroy, FABRIC_STRING_RESULT_HANDLE, fabric_string_result)
 {
     if (fabric_string_result == NULL)
@@ -74,6 +116,12 @@ IMPLEMENT_MOCKABLE_FUNCTION(, void, fabric_string_result_destroy, FABRIC_STRING_
     }
     else
     {
+        if (fabric_string_result->free_func != NULL)
+        {
+            /* Codes_SRS_FABRIC_STRING_RESULT_01_013: [ If fabric_string_result was created by fabric_string_result_create_with_custom_free with a non-NULL free_func, fabric_string_result_destroy shall call free_func with free_func_context. ]*/
+            fabric_string_result->free_func(fabric_string_result->free_func_context);
+        }
+
         /* Codes_SRS_FABRIC_STRING_RESULT_01_005: [ Otherwise, fabric_string_result_destroy shall free the memory associated with the fabric string result instance. ]*/
         free(fabric_string_result);
     }
@@ -91,7 +139,7 @@ IMPLEMENT_MOCKABLE_FUNCTION(, LPCWSTR, fabric_string_result_get_String, FABRIC_S
     }
     else
     {
-        /* Codes_SRS_FABRIC_STRING_RESULT_01_007: [ Otherwise, fabric_string_result_get_String shall return a pointer to the string copied in fabric_string_result_create. ]*/
+        /* Codes_SRS_FABRIC_STRING_RESULT_01_007: [ Otherwise, fabric_string_result_get_String shall return a pointer to the string copied in fabric_string_result_create or to the string_result given to fabric_string_result_create_with_custom_free. ]*/
         result = fabric_string_result->string_result;
     }
 
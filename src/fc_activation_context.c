@@ -21,6 +21,10 @@
 
 #include "sf_c_util/fc_activation_context.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fc_activation_context)
+
 struct FC_ACTIVATION_CONTEXT_TAG
 {
     uint32_t nFabricConfigurationPackages;
@@ -20,6 +20,10 @@
 
 #include "sf_c_util/fc_erdl_argc_argv.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fc_erdl_argc_argv)
+
 
 /* FABRIC_ENDPOINT_RESOURCE_DESCRIPTION_LIST => argc/argv is a list of --serviceEndpointResource "string" --Protocol "string" --Type "string" --Port "string" --CertificateName "string"*/
 int FABRIC_ENDPOINT_RESOURCE_DESCRIPTION_LIST_to_ARGC_ARGV(const FABRIC_ENDPOINT_RESOURCE_DESCRIPTION_LIST* fabric_endpoint_resource_description_list, int* argc, char*** argv)
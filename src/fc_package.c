@@ -15,6 +15,10 @@
 
 #include "sf_c_util/fc_package.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fc_package)
+
 struct FC_PACKAGE_TAG
 {
     FABRIC_CONFIGURATION_PACKAGE_DESCRIPTION fabric_configuration_package_description;
@@ -13,6 +13,10 @@
 
 #include "sf_c_util/fc_parameter_argc_argv.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fc_parameter_argc_argv)
+
 int FABRIC_CONFIGURATION_PARAMETER_to_ARGC_ARGV(const FABRIC_CONFIGURATION_PARAMETER* fabric_configuration_parameter, int* argc, char*** argv)
 {
     int result;
@@ -15,6 +15,10 @@
 
 #include "sf_c_util/fc_parameter_argc_argv.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fc_parameter_list_argc_argv)
+
 int FABRIC_CONFIGURATION_PARAMETER_LIST_to_ARGC_ARGV(const FABRIC_CONFIGURATION_PARAMETER_LIST* fabric_configuration_parameter_list , int* argc, char*** argv)
 {
     int result;
@@ -14,6 +14,10 @@
 
 #include "sf_c_util/fc_section_argc_argv.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fc_section_argc_argv)
+
 /* FABRIC_CONFIGURATION_SECTION => argc/argv */
 int FABRIC_CONFIGURATION_SECTION_to_ARGC_ARGV(const FABRIC_CONFIGURATION_SECTION* fabric_configuration_section, int* argc, char*** argv)
 {
@@ -14,6 +14,10 @@
 
 #include "sf_c_util/fc_section_list_argc_argv.h"
 
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(fc_section_list_argc_argv)
+
 /* FABRIC_CONFIGURATION_SECTION_LIST => argc/argv */
 int FABRIC_CONFIGURATION_SECTION_LIST_to_ARGC_ARGV(const FABRIC_CONFIGURATION_SECTION_LIST* fabric_configuration_section_list, int* argc, char*** argv)
 {
@@ -5,6 +5,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "windows.h"
 #include "psapi.h"
@@ -23,13 +24,369 @@ void same_as_free(void* ptr)
 #include "macro_utils/macro_utils.h"
 #include "c_logging/logger.h"
 
+#include "c_pal/interlocked.h"
+
 #include "sf_c_util/servicefabric_enums_to_strings.h"
 
 #include "sf_c_util/hresult_to_string.h"
 
-#define N_MAX_MODULES 100
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(hresult_to_string)
+
 #define N_MAX_CHARACTERS 1000
 
+/*FormatMessage with FORMAT_MESSAGE_FROM_HMODULE reads the message table resource with id 1 of the module*/
+#define MESSAGE_TABLE_RESOURCE_ID MAKEINTRESOURCEW(1)
+#define MESSAGE_TABLE_RESOURCE_TYPE MAKEINTRESOURCEW(11) /*RT_MESSAGETABLE*/
+
+/*a block of message ids of the message table of a module*/
+typedef struct MESSAGE_MODULE_RANGE_TAG
+{
+    DWORD low_id;
+    DWORD high_id;
+    DWORD max_high_id; /*the highest high_id of this range and of all the ranges before it in the index*/
+    HMODULE module;
+} MESSAGE_MODULE_RANGE;
+
+/*the message ids of all the modules of the process that have a message table, sorted by low_id. It is built the first time a module is needed and built again when the number of modules of the process changes*/
+typedef struct MESSAGE_MODULE_INDEX_TAG
+{
+    SRWLOCK lock;
+    bool is_built;
+    DWORD module_count;
+    MESSAGE_MODULE_RANGE* ranges;
+    size_t range_count;
+} MESSAGE_MODULE_INDEX;
+
+static MESSAGE_MODULE_INDEX message_module_index = { SRWLOCK_INIT, false, 0, NULL, 0 };
+
+/*memory for the interned strings, it lives until the process exits*/
+#define INTERNED_ARENA_SIZE (32 * 1024)
+
+typedef struct HRESULT_TO_STRING_INTERNED_SLOT_TAG
+{
+    volatile_atomic int64_t key; /*0 when the slot is free, otherwise ((uint64_t)1 << 32) | (uint32_t)hresult*/
+    volatile_atomic int32_t is_claimed; /*1 once a thread produces the string, back to 0 if the string could not be produced*/
+    void* volatile_atomic string; /*NULL until the string is produced, interned_not_kept when the string could not be kept*/
+} HRESULT_TO_STRING_INTERNED_SLOT;
+
+static HRESULT_TO_STRING_INTERNED_SLOT interned_slots[HRESULT_TO_STRING_INTERNED_SLOT_COUNT];
+static char interned_not_kept[1];
+
+static char interned_arena[INTERNED_ARENA_SIZE];
+static volatile_atomic int32_t interned_arena_used;
+
+static int compare_message_module_ranges(const void* left, const void* right)
+{
+    const MESSAGE_MODULE_RANGE* left_range = left;
+    const MESSAGE_MODULE_RANGE* right_range = right;
+    return (left_range->low_id < right_range->low_id) ? -1 : ((left_range->low_id > right_range->low_id) ? 1 : 0);
+}
+
+/*adds the blocks of the message table of module (if it has one) to ranges*/
+static int add_message_table_ranges(HMODULE module, MESSAGE_MODULE_RANGE** ranges, size_t* range_count)
+{
+    int result;
+    HRSRC resource = FindResourceW(module, MESSAGE_TABLE_RESOURCE_ID, MESSAGE_TABLE_RESOURCE_TYPE);
+    if (resource == NULL)
+    {
+        /*most modules do not have a message table*/
+        result = 0;
+    }
+    else
+    {
+        HGLOBAL loaded = LoadResource(module, resource);
+        const MESSAGE_RESOURCE_DATA* table = (loaded == NULL) ? NULL : LockResource(loaded);
+        DWORD table_size = SizeofResource(module, resource);
+        if (
+            (table == NULL) ||
+            (table_size < sizeof(DWORD)) ||
+            (table->NumberOfBlocks > (table_size - sizeof(DWORD)) / sizeof(MESSAGE_RESOURCE_BLOCK))
+            )
+        {
+            /*FormatMessage cannot use this table either*/
+            LogWarning("module %p has a message table that cannot be read", module);
+            result = 0;
+        }
+        else if (table->NumberOfBlocks == 0)
+        {
+            result = 0;
+        }
+        else
+        {
+            MESSAGE_MODULE_RANGE* new_ranges = realloc_2(*ranges, *range_count + table->NumberOfBlocks, sizeof(MESSAGE_MODULE_RANGE));
+            if (new_ranges == NULL)
+            {
+                LogError("failure in realloc_2(%p, %zu, %zu)", *ranges, *range_count + table->NumberOfBlocks, sizeof(MESSAGE_MODULE_RANGE));
+                result = MU_FAILURE;
+            }
+            else
+            {
+                DWORD i;
+                for (i = 0; i < table->NumberOfBlocks; i++)
+                {
+                    new_ranges[*range_count + i].low_id = table->Blocks[i].LowId;
+                    new_ranges[*range_count + i].high_id = table->Blocks[i].HighId;
+                    new_ranges[*range_count + i].module = module;
+                }
+                *ranges = new_ranges;
+                *range_count += table->NumberOfBlocks;
+                result = 0;
+            }
+        }
+    }
+    return result;
+}
+
+/*builds message_module_index again from the modules of the process, called with the lock of the index held exclusively. module_bytes is what EnumProcessModules said the modules need*/
+static int build_message_module_index(HANDLE process, DWORD module_bytes)
+{
+    int result;
+    HMODULE* modules = NULL;
+    DWORD allocated_bytes = 0;
+    DWORD used_bytes = module_bytes;
+    MESSAGE_MODULE_RANGE* ranges = NULL;
+    size_t range_count = 0;
+
+    result = 0;
+    /*modules can be loaded while they are enumerated, in which case they are enumerated again with more room*/
+    while ((result == 0) && (used_bytes > allocated_bytes))
+    {
+        if (modules != NULL)
+        {
+            free(modules);
+        }
+        modules = malloc_2(used_bytes / sizeof(HMODULE), sizeof(HMODULE));
+        if (modules == NULL)
+        {
+            LogError("failure in malloc_2(%zu, %zu)", used_bytes / sizeof(HMODULE), sizeof(HMODULE));
+            result = MU_FAILURE;
+        }
+        else
+        {
+            allocated_bytes = used_bytes;
+            if (EnumProcessModules(process, modules, allocated_bytes, &used_bytes) == 0)
+            {
+                LogLastError("failure in EnumProcessModules");
+                result = MU_FAILURE;
+            }
+        }
+    }
+
+    if (result == 0)
+    {
+        DWORD module_count = used_bytes / sizeof(HMODULE);
+        DWORD i;
+        for (i = 0; i < module_count; i++)
+        {
+            if (add_message_table_ranges(modules[i], &ranges, &range_count) != 0)
+            {
+                result = MU_FAILURE;
+                break;
+            }
+        }
+
+        if (result != 0)
+        {
+            if (ranges != NULL)
+            {
+                free(ranges);
+            }
+        }
+        else
+        {
+            size_t j;
+            qsort(ranges, range_count, sizeof(MESSAGE_MODULE_RANGE), compare_message_module_ranges);
+            for (j = 0; j < range_count; j++)
+            {
+                ranges[j].max_high_id = ((j > 0) && (ranges[j - 1].max_high_id > ranges[j].high_id)) ? ranges[j - 1].max_high_id : ranges[j].high_id;
+            }
+
+            if (message_module_index.ranges != NULL)
+            {
+                free(message_module_index.ranges);
+            }
+            message_module_index.ranges = ranges;
+            message_module_index.range_count = range_count;
+            message_module_index.module_count = module_count;
+            message_module_index.is_built = true;
+        }
+    }
+
+    if (modules != NULL)
+    {
+        free(modules);
+    }
+    return result;
+}
+
+typedef DWORD (*FORMAT_FROM_MODULE)(HMODULE module, HRESULT hr, void* buffer, DWORD size);
+
+static DWORD format_from_module_char(HMODULE module, HRESULT hr, void* buffer, DWORD size)
+{
+    return FormatMessageA(
+        FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
+        module,
+        hr,
+        0,
+        (LPVOID)buffer, size, NULL);
+}
+
+static DWORD format_from_module_wchar(HMODULE module, HRESULT hr, void* buffer, DWORD size)
+{
+    return FormatMessageW(
+        FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
+        module,
+        hr,
+        0,
+        (LPVOID)buffer, size, NULL);
+}
+
+/*calls format for the modules whose message table has hr, called with the lock of the index held*/
+static bool format_from_indexed_modules(HRESULT hr, FORMAT_FROM_MODULE format, void* buffer, DWORD size)
+{
+    bool result = false;
+    DWORD id = (DWORD)hr;
+    size_t left = 0;
+    size_t right = message_module_index.range_count;
+
+    /*find the first range that starts after id...*/
+    while (left < right)
+    {
+        size_t middle = left + (right - left) / 2;
+        if (message_module_index.ranges[middle].low_id <= id)
+        {
+            left = middle + 1;
+        }
+        else
+        {
+            right = middle;
+        }
+    }
+
+    /*...then the ranges before it that can still reach id*/
+    while ((left > 0) && (message_module_index.ranges[left - 1].max_high_id >= id))
+    {
+        left--;
+        if (
+            (message_module_index.ranges[left].high_id >= id) &&
+            (format(message_module_index.ranges[left].module, hr, buffer, size) != 0)
+            )
+        {
+            result = true;
+            break;
+        }
+    }
+    return result;
+}
+
+/*returns true if a module of the process has the message of hr (produced by format in buffer)*/
+static bool format_from_modules(HRESULT hr, FORMAT_FROM_MODULE format, void* buffer, DWORD size)
+{
+    bool result;
+    HANDLE currentProcess = GetCurrentProcess();
+    /*apparently this cannot fail and returns somewhat of a "pseudo handle"*/
+    DWORD module_bytes;
+
+    /*Codes_SRS_HRESULT_TO_STRING_01_019: [ hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall get the number of modules of the current process by calling EnumProcessModules. ]*/
+    if (EnumProcessModules(currentProcess, NULL, 0, &module_bytes) == 0)
+    {
+        LogLastError("failure in EnumProcessModules");
+        result = false;
+    }
+    else
+    {
+        DWORD module_count = module_bytes / sizeof(HMODULE);
+
+        AcquireSRWLockShared(&message_module_index.lock);
+        if (message_module_index.is_built && (message_module_index.module_count == module_count))
+        {
+            /*Codes_SRS_HRESULT_TO_STRING_01_022: [ hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall call FormatMessage with FORMAT_MESSAGE_FROM_HMODULE only for the modules whose message table has a block of message ids that contains hresult. ]*/
+            result = format_from_indexed_modules(hr, format, buffer, size);
+            ReleaseSRWLockShared(&message_module_index.lock);
+        }
+        else
+        {
+            ReleaseSRWLockShared(&message_module_index.lock);
+
+            AcquireSRWLockExclusive(&message_module_index.lock);
+            /*another thread might have built it meanwhile*/
+            if (message_module_index.is_built && (message_module_index.module_count == module_count))
+            {
+                result = format_from_indexed_modules(hr, format, buffer, size);
+            }
+            /*Codes_SRS_HRESULT_TO_STRING_01_020: [ If the index of the message tables of the modules was not built yet or if the number of modules changed since it was built then hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall build it from all the modules returned by EnumProcessModules. ]*/
+            /*Codes_SRS_HRESULT_TO_STRING_01_021: [ The index shall have the blocks of message ids of the message table (FindResourceW, LoadResource, LockResource and SizeofResource) of every module that has one. ]*/
+            else if (build_message_module_index(currentProcess, module_bytes) != 0)
+            {
+                LogError("failure building the index of the message tables of the modules");
+                result = false;
+            }
+            else
+            {
+                result = format_from_indexed_modules(hr, format, buffer, size);
+            }
+            ReleaseSRWLockExclusive(&message_module_index.lock);
+        }
+    }
+    return result;
+}
+
+/*produces the string of hr in buffer, without allocating. Returns buffer, the string of a Service Fabric code (which is not copied in buffer) or NULL*/
+static const char* format_hresult(HRESULT hr, char* buffer, size_t size)
+{
+    const char* result;
+    DWORD nSize = (size > MAXDWORD) ? MAXDWORD : (DWORD)size;
+
+    buffer[0] = '\0';
+    /*Codes_SRS_HRESULT_TO_STRING_02_002: [ hresult_to_string shall call FormatMessageA with dwFlags set to FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS. ]*/
+    /*Codes_SRS_HRESULT_TO_STRING_01_013: [ hresult_to_string_buffer shall call FormatMessageA with dwFlags set to FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, buffer and size and return buffer if FormatMessageA succeeds. ]*/
+    /*see if the "system" can provide the code*/
+    if (FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL,
+        hr,
+        0, /*if you pass in zero, FormatMessage looks for a message for LANGIDs in the following order...*/
+        (LPVOID)buffer, nSize, NULL) != 0)
+    {
+        /*Codes_SRS_HRESULT_TO_STRING_02_003: [ If FormatMessageA succeeds then hresult_to_string shall return the value as given by FormatMessageA. ]*/
+        /*success, SYSTEM was able to find the message*/
+        result = buffer;
+    }
+    else
+    {
+        /*Codes_SRS_HRESULT_TO_STRING_02_004: [ Otherwise, hresult_to_string shall look in all Service Fabric code for a match and return that match. ]*/
+        /*Codes_SRS_HRESULT_TO_STRING_01_014: [ Otherwise, if hresult is a Service Fabric code then hresult_to_string_buffer shall return the string of the code without copying it in buffer. ]*/
+        /*look in ServiceFabric codes*/
+        const char* maybeSFhasIt = MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, hr);
+        if (strcmp(maybeSFhasIt, "UNKNOWN") != 0)
+        {
+            result = maybeSFhasIt;
+        }
+        else
+        {
+            /*Codes_SRS_HRESULT_TO_STRING_02_005: [ If no Service Fabric codes match hresult then hresult_to_string shall look in all the loaded modules by the current process. ]*/
+            /*Codes_SRS_HRESULT_TO_STRING_01_015: [ Otherwise hresult_to_string_buffer shall call FormatMessageA with FORMAT_MESSAGE_FROM_HMODULE for the modules loaded by the current process that have hresult in their message table, buffer and size and return buffer if one module can decode hresult. ]*/
+            /*then maaaaaybe one of the other modules provides it*/
+            if (format_from_modules(hr, format_from_module_char, buffer, nSize))
+            {
+                /*Codes_SRS_HRESULT_TO_STRING_02_006: [ If a module can decode hresult then that value shall be returned. */
+                result = buffer;
+            }
+            else
+            {
+                /*Codes_SRS_HRESULT_TO_STRING_02_007: [ Otherwise NULL shall be returned. ]*/
+                /*Codes_SRS_HRESULT_TO_STRING_02_008: [ If there are any failures then hresult_to_string shall return NULL. ]*/
+                /*Codes_SRS_HRESULT_TO_STRING_01_016: [ If no module can decode hresult or if there are any failures then hresult_to_string_buffer shall return NULL. ]*/
+                LogError("unknown HRESULT 0x%x", hr);
+                result = NULL;
+            }
+        }
+    }
+    return result;
+}
+
 char* hresult_to_string(malloc_t the_malloc, free_t the_free, HRESULT hr)
 {
     char* result;
@@ -47,7 +404,7 @@ char* hresult_to_string(malloc_t the_malloc, free_t the_free, HRESULT hr)
     else
     {
         /*allocate a buffer "large enough"*/
-    /*Codes_SRS_HRESULT_TO_STRING_02_001: [ hresult_to_string shall allocate memory for a "big enough" string representation. ]*/
+        /*Codes_SRS_HRESULT_TO_STRING_02_001: [ hresult_to_string shall allocate memory for a "big enough" string representation. ]*/
         result = the_malloc(N_MAX_CHARACTERS * sizeof(char));
         if (result == NULL)
         {
@@ -57,108 +414,37 @@ char* hresult_to_string(malloc_t the_malloc, free_t the_free, HRESULT hr)
         }
         else
         {
-            result[0] = '\0';
-            /*Codes_SRS_HRESULT_TO_STRING_02_002: [ hresult_to_string shall call FormatMessageA with dwFlags set to FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS. ]*/
-            /*see if the "system" can provide the code*/
-            if (FormatMessageA(
-                FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
-                NULL,
-                hr,
-                0, /*if you pass in zero, FormatMessage looks for a message for LANGIDs in the following order...*/
-                (LPVOID)result, N_MAX_CHARACTERS, NULL) != 0)
+            const char* formatted = format_hresult(hr, result, N_MAX_CHARACTERS);
+            if (formatted == NULL)
             {
-                /*Codes_SRS_HRESULT_TO_STRING_02_003: [ If FormatMessageA succeeds then hresult_to_string shall return the value as given by FormatMessageA. ]*/
-                /*success, SYSTEM was able to find the message*/
-                /*return as is*/
-                goto allok;
+                /*Codes_SRS_HRESULT_TO_STRING_02_007: [ Otherwise NULL shall be returned. ]*/
+                the_free(result);
+                result = NULL;
             }
-            else
+            else if (formatted != result)
             {
-                /*Codes_SRS_HRESULT_TO_STRING_02_004: [ Otherwise, hresult_to_string shall look in all Service Fabric code for a match and return that match. ]*/
-                /*look in ServiceFabric codes*/
-                const char* maybeSFhasIt = MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, hr);
-                if (strcmp(maybeSFhasIt, "UNKNOWN") != 0)
-                {
-                    size_t length = strlen(maybeSFhasIt);
-                    if ((length + 1) > N_MAX_CHARACTERS)
-                    {
-                        LogError("internal buffer would not fit the whole message");
-                        goto clean;
-                    }
-                    else
-                    {
-                        (void)memcpy(result, maybeSFhasIt, (length + 1) * sizeof(char));
-                        goto allok;
-                    }
-                }
-
-                /*Codes_SRS_HRESULT_TO_STRING_02_005: [ If no Service Fabric codes match hresult then hresult_to_string shall look in all the loaded modules by the current process. ]*/
-                /*then maaaaaybe one of the other modules provides it*/
-
-                HANDLE currentProcess = GetCurrentProcess();
-                /*apparently this cannot fail and returns somewhat of a "pseudo handle"*/
-
-                HMODULE hModules[N_MAX_MODULES];
-                DWORD enumModulesUsedBytes;
-                if (EnumProcessModules(currentProcess, hModules, sizeof(hModules), &enumModulesUsedBytes) == 0)
+                /*a Service Fabric code, copy it*/
+                size_t length = strlen(formatted);
+                if ((length + 1) > N_MAX_CHARACTERS)
                 {
-                    /*Codes_SRS_HRESULT_TO_STRING_02_008: [ If there are any failures then hresult_to_string shall return NULL. ]*/
-                    LogLastError("failure in EnumProcessModules");
+                    LogError("internal buffer would not fit the whole message");
+                    the_free(result);
+                    result = NULL;
                 }
                 else
                 {
-                    size_t iModule;
-                    for (iModule = 0; iModule < (enumModulesUsedBytes / sizeof(HMODULE)); iModule++)
-                    {
-                        char fileName[MAX_PATH];
-                        if (GetModuleFileNameA(hModules[iModule], fileName, sizeof(fileName) / sizeof(fileName[0])) == 0)
-                        {
-                            /*Codes_SRS_HRESULT_TO_STRING_02_008: [ If there are any failures then hresult_to_string shall return NULL. ]*/
-                            LogLastError("Failure in GetModuleFileNameA");
-                            iModule = enumModulesUsedBytes / sizeof(HMODULE);
-                            break;
-                        }
-                        else
-                        {
-                            /*see if this module */
-                            if (FormatMessageA(
-                                FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
-                                hModules[iModule],
-                                hr,
-                                0,
-                                (LPVOID)result, N_MAX_CHARACTERS, NULL) != 0)
-                            {
-                                /*Codes_SRS_HRESULT_TO_STRING_02_006: [ If a module can decode hresult then that value shall be returned. */
-                                break;
-                            }
-                            else
-                            {
-                                /*this module does not have it...*/
-                            }
-                        }
-                    }
-
-                    /*Codes_SRS_HRESULT_TO_STRING_02_007: [ Otherwise NULL shall be returned. ]*/
-                    if (iModule == (enumModulesUsedBytes / sizeof(HMODULE)))
-                    {
-                        LogError("unknown HRESULT 0x%x", hr);
-                    }
-                    else
-                    {
-                        goto allok;
-                    }
+                    (void)memcpy(result, formatted, (length + 1) * sizeof(char));
                 }
             }
-        clean:
-            the_free(result);
-            result = NULL;
-        allok:;
+            else
+            {
+                /*formatted in result, return as is*/
+            }
         }
     }
     return result;
 }
 
-
 wchar_t* hresult_to_wstring(HRESULT hr)
 {
     wchar_t* result;
@@ -211,58 +497,15 @@ wchar_t* hresult_to_wstring(HRESULT hr)
             }
 
             /*Codes_SRS_HRESULT_TO_STRING_02_013: [ If no Service Fabric codes match hresult then hresult_to_wstring shall look in all the loaded modules by the current process. ]*/
-
-            HANDLE currentProcess = GetCurrentProcess();
-            /*apparently this cannot fail and returns somewhat of a "pseudo handle"*/
-
-            HMODULE hModules[N_MAX_MODULES];
-            DWORD enumModulesUsedBytes;
-            if (EnumProcessModules(currentProcess, hModules, sizeof(hModules), &enumModulesUsedBytes) == 0)
+            if (format_from_modules(hr, format_from_module_wchar, result, N_MAX_CHARACTERS))
             {
-                /*Codes_SRS_HRESULT_TO_STRING_02_016: [ If there are any failures then hresult_to_wstring shall return NULL. ]*/
-                LogLastError("failure in EnumProcessModules");
+                /*Codes_SRS_HRESULT_TO_STRING_02_014: [ If a module can decode hresult then that value shall be returned. ]*/
+                goto allok;
             }
             else
             {
-                size_t iModule;
-                for (iModule = 0; iModule < (enumModulesUsedBytes / sizeof(HMODULE)); iModule++)
-                {
-                    char fileName[MAX_PATH];
-                    if (GetModuleFileNameA(hModules[iModule], fileName, sizeof(fileName) / sizeof(fileName[0])) == 0)
-                    {
-                        /*Codes_SRS_HRESULT_TO_STRING_02_016: [ If there are any failures then hresult_to_wstring shall return NULL. ]*/
-                        LogLastError("Failure in GetModuleFileNameA");
-                        iModule = enumModulesUsedBytes / sizeof(HMODULE);
-                        break;
-                    }
-                    else
-                    {
-                        /*Codes_SRS_HRESULT_TO_STRING_02_014: [ If a module can decode hresult then that value shall be returned. ]*/
-                        if (FormatMessageW(
-                            FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
-                            hModules[iModule],
-                            hr,
-                            0,
-                            (LPVOID)result, N_MAX_CHARACTERS, NULL) != 0)
-                        {
-                            break;
-                        }
-                        else
-                        {
-                            /*this module does not have it...*/
-                        }
-                    }
-                }
-
-                /*Codes_SRS_HRESULT_TO_STRING_02_007: [ Otherwise NULL shall be returned. ]*/
-                if (iModule == (enumModulesUsedBytes / sizeof(HMODULE)))
-                {
-                    LogError("unknown HRESULT 0x%x", hr);
-                }
-                else
-                {
-                    goto allok;
-                }
+                /*Codes_SRS_HRESULT_TO_STRING_02_016: [ If there are any failures then hresult_to_wstring shall return NULL. ]*/
+                LogError("unknown HRESULT 0x%x", hr);
             }
         }
 clean:
@@ -273,3 +516,174 @@ allok:;
     }
     return result;
 }
+
+static char* allocate_from_arena(size_t size)
+{
+    char* result = NULL;
+    int32_t used = interlocked_add(&interned_arena_used, 0);
+    while (size <= (size_t)(INTERNED_ARENA_SIZE - used))
+    {
+        int32_t previous = interlocked_compare_exchange(&interned_arena_used, used + (int32_t)size, used);
+        if (previous == used)
+        {
+            result = &interned_arena[used];
+            break;
+        }
+        used = previous;
+    }
+    return result;
+}
+
+/*returns the slot of hr, taking a free one if hr has none. Returns NULL if all the slots are used by other HRESULTs.
+The slots are only read (acquire loads), a slot is written once, when it is taken, so lookups of known HRESULTs do not write any shared cache line*/
+static HRESULT_TO_STRING_INTERNED_SLOT* get_interned_slot(HRESULT hr)
+{
+    HRESULT_TO_STRING_INTERNED_SLOT* result = NULL;
+    int64_t key = (int64_t)(((uint64_t)1 << 32) | (uint32_t)hr);
+    uint32_t start = ((uint32_t)hr * 2654435769u) >> (32 - HRESULT_TO_STRING_INTERNED_SLOT_BITS);
+    uint32_t i;
+
+    for (i = 0; i < HRESULT_TO_STRING_INTERNED_SLOT_COUNT; i++)
+    {
+        HRESULT_TO_STRING_INTERNED_SLOT* slot = &interned_slots[(start + i) & (HRESULT_TO_STRING_INTERNED_SLOT_COUNT - 1)];
+        int64_t slot_key = ReadAcquire64((volatile LONG64*)&slot->key);
+        if (slot_key == 0)
+        {
+            /*free, take it unless another thread takes it first*/
+            slot_key = interlocked_compare_exchange_64(&slot->key, key, 0);
+            if (slot_key == 0)
+            {
+                slot_key = key;
+            }
+        }
+
+        if (slot_key == key)
+        {
+            result = slot;
+            break;
+        }
+        else
+        {
+            /*slot is used by another hresult, probe the next one*/
+        }
+    }
+    return result;
+}
+
+/*true when this thread is the one producing the string of the slot*/
+static bool claim_interned_slot(HRESULT_TO_STRING_INTERNED_SLOT* slot)
+{
+    return (ReadAcquire((volatile LONG*)&slot->is_claimed) == 0) &&
+        (interlocked_compare_exchange(&slot->is_claimed, 1, 0) == 0);
+}
+
+/*publishes in the slot claimed by this thread the string produced by format_hresult*/
+static const char* keep_string(HRESULT_TO_STRING_INTERNED_SLOT* slot, const char* formatted, char* buffer, size_t size)
+{
+    const char* result;
+    void* kept;
+    if (formatted == NULL)
+    {
+        /*Codes_SRS_HRESULT_TO_STRING_01_005: [ If the string of hresult cannot be produced then hresult_to_string_buffer shall give back the claim on the slot of hresult without keeping anything, so that a later call produces the string again. ]*/
+        /*the message might not fit in a small buffer, EnumProcessModules or the index of the modules might have failed, or the module that has the message might not be loaded yet*/
+        kept = NULL;
+        result = NULL;
+    }
+    else if (formatted != buffer)
+    {
+        /*the string of a Service Fabric code is static already*/
+        kept = (void*)formatted;
+        result = formatted;
+    }
+    else
+    {
+        /*Codes_SRS_HRESULT_TO_STRING_01_004: [ hresult_to_string_buffer shall copy the string in static memory of the process, keep it and return it. ]*/
+        size_t length = strlen(formatted) + 1;
+        char* copy = allocate_from_arena(length);
+        if (copy == NULL)
+        {
+            /*Codes_SRS_HRESULT_TO_STRING_01_018: [ If there is no static memory left then hresult_to_string_buffer shall return buffer. ]*/
+            kept = interned_not_kept;
+            result = formatted;
+        }
+        else
+        {
+            (void)memcpy(copy, formatted, length);
+            kept = copy;
+            result = copy;
+        }
+    }
+    if (kept == NULL)
+    {
+        (void)interlocked_exchange(&slot->is_claimed, 0);
+    }
+    else
+    {
+        (void)interlocked_exchange_pointer(&slot->string, kept);
+    }
+    return result;
+}
+
+const char* hresult_to_string_buffer(HRESULT hr, char* buffer, size_t size)
+{
+    const char* result;
+
+    if (
+        /*Codes_SRS_HRESULT_TO_STRING_01_008: [ If buffer is NULL then hresult_to_string_buffer shall fail and return NULL. ]*/
+        (buffer == NULL) ||
+        /*Codes_SRS_HRESULT_TO_STRING_01_009: [ If size is 0 then hresult_to_string_buffer shall fail and return NULL. ]*/
+        (size == 0)
+        )
+    {
+        LogError("invalid arguments HRESULT hr=0x%x, char* buffer=%p, size_t size=%zu", hr, buffer, size);
+        result = NULL;
+    }
+    else
+    {
+        /*Codes_SRS_HRESULT_TO_STRING_01_010: [ hresult_to_string_buffer shall look for hresult in HRESULT_TO_STRING_INTERNED_SLOT_COUNT slots, starting at a slot given by a hash of hresult, without taking any lock. ]*/
+        HRESULT_TO_STRING_INTERNED_SLOT* slot = get_interned_slot(hr);
+        if (slot == NULL)
+        {
+            /*Codes_SRS_HRESULT_TO_STRING_01_007: [ If all the slots are used by other HRESULTs then hresult_to_string_buffer shall produce the string of hresult without keeping it. ]*/
+            result = format_hresult(hr, buffer, size);
+        }
+        else
+        {
+            /*the string is published with interlocked_exchange_pointer after it was written*/
+            const char* kept = ReadPointerAcquire((PVOID volatile*)&slot->string);
+            if ((kept == NULL) && claim_interned_slot(slot))
+            {
+                /*Codes_SRS_HRESULT_TO_STRING_01_003: [ If hresult is seen for the first time then hresult_to_string_buffer shall produce its string and keep it. ]*/
+                result = keep_string(slot, format_hresult(hr, buffer, size), buffer, size);
+            }
+            else if ((kept == NULL) || (kept == interned_not_kept))
+            {
+                /*Codes_SRS_HRESULT_TO_STRING_01_017: [ If the string of hresult is being produced by another thread or could not be kept then hresult_to_string_buffer shall produce it without keeping it. ]*/
+                result = format_hresult(hr, buffer, size);
+            }
+            else
+            {
+                /*Codes_SRS_HRESULT_TO_STRING_01_011: [ If the string of hresult is kept then hresult_to_string_buffer shall return it. ]*/
+                result = kept;
+            }
+        }
+    }
+    return result;
+}
+
+const char* hresult_to_string_interned(HRESULT hr)
+{
+    /*Codes_SRS_HRESULT_TO_STRING_01_001: [ hresult_to_string_interned shall call hresult_to_string_buffer with a buffer of HRESULT_TO_STRING_BUFFER_SIZE characters on its stack. ]*/
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+    const char* result = hresult_to_string_buffer(hr, buffer, sizeof(buffer));
+    if (result == buffer)
+    {
+        /*Codes_SRS_HRESULT_TO_STRING_01_006: [ If hresult_to_string_buffer returns buffer (the string was not kept) then hresult_to_string_interned shall return NULL. ]*/
+        result = NULL;
+    }
+    else
+    {
+        /*Codes_SRS_HRESULT_TO_STRING_01_002: [ Otherwise hresult_to_string_interned shall return what hresult_to_string_buffer returns. ]*/
+    }
+    return result;
+}
@@ -5,6 +5,9 @@
 /*generator is called "servicefabric_enums_to_strings_generator"*/
 
 #include <stddef.h>                          // for NULL, size_t
+#include <stdbool.h>                         // for bool
+#include <stdint.h>                          // for uint32_t, int32_t
+#include <string.h>                          // for strcmp
 
 #include "macro_utils/macro_utils.h"
 #include "fabrictypes.h"
@@ -17,10 +20,54 @@ typedef struct SF_ENUM_AND_STRING_TAG
     const char* valueAsString;
 } SF_ENUM_AND_STRING;
 
-static const SF_ENUM_AND_STRING FABRIC_ERROR_CODE_ValuesAndStrings[] ={
+/*FNV-1a over the string with the ASCII letters folded to lower case (c | 0x20), so the same perfect hash serves _FromString and _FromStringCaseInsensitive*/
+static uint32_t sf_enum_hash(const char* enumAsString)
+{
+    uint32_t hash = 2166136261U;
+    for (const unsigned char* c = (const unsigned char*)enumAsString; *c != '\0'; c++)
+    {
+        hash ^= (uint32_t)(*c | 0x20);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/*finalizer of MurmurHash3, it spreads the hash of the string differently for every seed*/
+static uint32_t sf_enum_mix(uint32_t hash, uint32_t seed)
+{
+    hash ^= seed * 0x9E3779B9U;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35U;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/*minimal perfect hash built by the generator: the string picks a bucket, the bucket has either the index of its only string (stored as -index-1) or the seed that spreads all its strings to distinct indexes*/
+static size_t sf_enum_perfect_hash(const char* enumAsString, const int32_t* seeds, size_t count)
+{
+    uint32_t hash = sf_enum_hash(enumAsString);
+    int32_t seed = seeds[sf_enum_mix(hash, 0) % count];
+    return (seed < 0) ? (size_t)(-(seed + 1)) : (size_t)(sf_enum_mix(hash, (uint32_t)seed) % count);
+}
+
+static bool sf_enum_equals_case_insensitive(const char* left, const char* right)
+{
+    for (; (*left != '\0') && (*right != '\0'); left++, right++)
+    {
+        unsigned char leftLower = ((*left >= 'A') && (*left <= 'Z')) ? (unsigned char)(*left + ('a' - 'A')) : (unsigned char)*left;
+        unsigned char rightLower = ((*right >= 'A') && (*right <= 'Z')) ? (unsigned char)(*right + ('a' - 'A')) : (unsigned char)*right;
+        if (leftLower != rightLower)
+        {
+            return false;
+        }
+    }
+    return (*left == '\0') && (*right == '\0');
+}
+
+static const SF_ENUM_AND_STRING FABRIC_ERROR_CODE_ValuesAndStrings[] ={ /*sorted by value*/
 { FABRIC_E_FIRST_RESERVED_HRESULT , "FABRIC_E_FIRST_RESERVED_HRESULT" },
-{ FABRIC_E_LAST_RESERVED_HRESULT , "FABRIC_E_LAST_RESERVED_HRESULT" },
-{ FABRIC_E_COMMUNICATION_ERROR , "FABRIC_E_COMMUNICATION_ERROR" },
 { FABRIC_E_INVALID_ADDRESS , "FABRIC_E_INVALID_ADDRESS" },
 { FABRIC_E_INVALID_NAME_URI , "FABRIC_E_INVALID_NAME_URI" },
 { FABRIC_E_INVALID_PARTITION_KEY , "FABRIC_E_INVALID_PARTITION_KEY" },
@@ -232,9 +279,8 @@ static const SF_ENUM_AND_STRING FABRIC_ERROR_CODE_ValuesAndStrings[] ={
 { FABRIC_E_NETWORK_NOT_FOUND , "FABRIC_E_NETWORK_NOT_FOUND" },
 { FABRIC_E_NETWORK_IN_USE , "FABRIC_E_NETWORK_IN_USE" },
 { FABRIC_E_ENDPOINT_NOT_REFERENCED , "FABRIC_E_ENDPOINT_NOT_REFERENCED" },
-{ FABRIC_E_LAST_USED_HRESULT , "FABRIC_E_LAST_USED_HRESULT" },
+{ FABRIC_E_LAST_RESERVED_HRESULT , "FABRIC_E_LAST_RESERVED_HRESULT" },
 { FABRIC_E_FACILITY_SF_FIRST_HRESULT , "FABRIC_E_FACILITY_SF_FIRST_HRESULT" },
-{ FABRIC_E_INSTANCE_ALREADY_EXISTS , "FABRIC_E_INSTANCE_ALREADY_EXISTS" },
 { FABRIC_E_NODE_TYPE_NOT_FOUND , "FABRIC_E_NODE_TYPE_NOT_FOUND" },
 { FABRIC_E_INSTANCE_COUNT_UPDATE_NOT_ALLOWED , "FABRIC_E_INSTANCE_COUNT_UPDATE_NOT_ALLOWED" },
 { FABRIC_E_COPY_ABORTED , "FABRIC_E_COPY_ABORTED" },
@@ -256,2665 +302,8503 @@ static const SF_ENUM_AND_STRING FABRIC_ERROR_CODE_ValuesAndStrings[] ={
 { FABRIC_E_SERVICE_DISABLE_IN_PROGRESS , "FABRIC_E_SERVICE_DISABLE_IN_PROGRESS" },
 { FABRIC_E_STORE_OUT_OF_LONG_VALUE_IDS , "FABRIC_E_STORE_OUT_OF_LONG_VALUE_IDS" },
 { FABRIC_E_STORE_OUT_OF_INSTANCES , "FABRIC_E_STORE_OUT_OF_INSTANCES" },
-{ FABRIC_E_LAST_USED_FACILITY_SF_HRESULT , "FABRIC_E_LAST_USED_FACILITY_SF_HRESULT" },
 { FABRIC_E_FACILITY_SF_LAST_HRESULT , "FABRIC_E_FACILITY_SF_LAST_HRESULT" },
 };
 const char* MU_C3(MU_,FABRIC_ERROR_CODE,_ToString)(FABRIC_ERROR_CODE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_ERROR_CODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_ERROR_CODE, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_ERROR_CODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_ERROR_CODE, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_CLIENT_ROLE_ValuesAndStrings[] ={
-{ FABRIC_CLIENT_ROLE_UNKNOWN , "FABRIC_CLIENT_ROLE_UNKNOWN" },
-{ FABRIC_CLIENT_ROLE_USER , "FABRIC_CLIENT_ROLE_USER" },
-{ FABRIC_CLIENT_ROLE_ADMIN , "FABRIC_CLIENT_ROLE_ADMIN" },
-{ FABRIC_CLIENT_ROLE_ELEVATED_ADMIN , "FABRIC_CLIENT_ROLE_ELEVATED_ADMIN" },
-};
-const char* MU_C3(MU_,FABRIC_CLIENT_ROLE,_ToString)(FABRIC_CLIENT_ROLE value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_CLIENT_ROLE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_CLIENT_ROLE, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_CLIENT_ROLE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_CLIENT_ROLE, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_STATUS_ValuesAndStrings[] ={
-{ FABRIC_QUERY_SERVICE_STATUS_UNKNOWN , "FABRIC_QUERY_SERVICE_STATUS_UNKNOWN" },
-{ FABRIC_QUERY_SERVICE_STATUS_ACTIVE , "FABRIC_QUERY_SERVICE_STATUS_ACTIVE" },
-{ FABRIC_QUERY_SERVICE_STATUS_UPGRADING , "FABRIC_QUERY_SERVICE_STATUS_UPGRADING" },
-{ FABRIC_QUERY_SERVICE_STATUS_DELETING , "FABRIC_QUERY_SERVICE_STATUS_DELETING" },
-{ FABRIC_QUERY_SERVICE_STATUS_CREATING , "FABRIC_QUERY_SERVICE_STATUS_CREATING" },
-{ FABRIC_QUERY_SERVICE_STATUS_FAILED , "FABRIC_QUERY_SERVICE_STATUS_FAILED" },
-{ FABRIC_QUERY_SERVICE_STATUS_DISABLING , "FABRIC_QUERY_SERVICE_STATUS_DISABLING" },
-{ FABRIC_QUERY_SERVICE_STATUS_DISABLED , "FABRIC_QUERY_SERVICE_STATUS_DISABLED" },
-};
-const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_STATUS,_ToString)(FABRIC_QUERY_SERVICE_STATUS value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_QUERY_SERVICE_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_STATUS, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_QUERY_SERVICE_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_QUERY_SERVICE_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_QUERY_NODE_STATUS_ValuesAndStrings[] ={
-{ FABRIC_QUERY_NODE_STATUS_INVALID , "FABRIC_QUERY_NODE_STATUS_INVALID" },
-{ FABRIC_QUERY_NODE_STATUS_UP , "FABRIC_QUERY_NODE_STATUS_UP" },
-{ FABRIC_QUERY_NODE_STATUS_DOWN , "FABRIC_QUERY_NODE_STATUS_DOWN" },
-{ FABRIC_QUERY_NODE_STATUS_ENABLING , "FABRIC_QUERY_NODE_STATUS_ENABLING" },
-{ FABRIC_QUERY_NODE_STATUS_DISABLING , "FABRIC_QUERY_NODE_STATUS_DISABLING" },
-{ FABRIC_QUERY_NODE_STATUS_DISABLED , "FABRIC_QUERY_NODE_STATUS_DISABLED" },
-{ FABRIC_QUERY_NODE_STATUS_UNKNOWN , "FABRIC_QUERY_NODE_STATUS_UNKNOWN" },
-{ FABRIC_QUERY_NODE_STATUS_REMOVED , "FABRIC_QUERY_NODE_STATUS_REMOVED" },
-};
-const char* MU_C3(MU_,FABRIC_QUERY_NODE_STATUS,_ToString)(FABRIC_QUERY_NODE_STATUS value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_QUERY_NODE_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_QUERY_NODE_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_QUERY_NODE_STATUS_FILTER_ValuesAndStrings[] ={
-{ FABRIC_QUERY_NODE_STATUS_FILTER_DEFAULT , "FABRIC_QUERY_NODE_STATUS_FILTER_DEFAULT" },
-{ FABRIC_QUERY_NODE_STATUS_FILTER_ALL , "FABRIC_QUERY_NODE_STATUS_FILTER_ALL" },
-{ FABRIC_QUERY_NODE_STATUS_FILTER_UP , "FABRIC_QUERY_NODE_STATUS_FILTER_UP" },
-{ FABRIC_QUERY_NODE_STATUS_FILTER_DOWN , "FABRIC_QUERY_NODE_STATUS_FILTER_DOWN" },
-{ FABRIC_QUERY_NODE_STATUS_FILTER_ENABLING , "FABRIC_QUERY_NODE_STATUS_FILTER_ENABLING" },
-{ FABRIC_QUERY_NODE_STATUS_FILTER_DISABLING , "FABRIC_QUERY_NODE_STATUS_FILTER_DISABLING" },
-{ FABRIC_QUERY_NODE_STATUS_FILTER_DISABLED , "FABRIC_QUERY_NODE_STATUS_FILTER_DISABLED" },
-{ FABRIC_QUERY_NODE_STATUS_FILTER_UNKNOWN , "FABRIC_QUERY_NODE_STATUS_FILTER_UNKNOWN" },
-{ FABRIC_QUERY_NODE_STATUS_FILTER_REMOVED , "FABRIC_QUERY_NODE_STATUS_FILTER_REMOVED" },
-};
-const char* MU_C3(MU_,FABRIC_QUERY_NODE_STATUS_FILTER,_ToString)(FABRIC_QUERY_NODE_STATUS_FILTER value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_KIND_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_KIND_INVALID , "FABRIC_SERVICE_KIND_INVALID" },
-{ FABRIC_SERVICE_KIND_STATELESS , "FABRIC_SERVICE_KIND_STATELESS" },
-{ FABRIC_SERVICE_KIND_STATEFUL , "FABRIC_SERVICE_KIND_STATEFUL" },
-{ FABRIC_SERVICE_KIND_SELF_RECONFIGURING , "FABRIC_SERVICE_KIND_SELF_RECONFIGURING" },
-};
-const char* MU_C3(MU_,FABRIC_SERVICE_KIND,_ToString)(FABRIC_SERVICE_KIND value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_KIND, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_SERVICE_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_PARTITION_KIND_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_PARTITION_KIND_INVALID , "FABRIC_SERVICE_PARTITION_KIND_INVALID" },
-{ FABRIC_SERVICE_PARTITION_KIND_SINGLETON , "FABRIC_SERVICE_PARTITION_KIND_SINGLETON" },
-{ FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE , "FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE" },
-{ FABRIC_SERVICE_PARTITION_KIND_NAMED , "FABRIC_SERVICE_PARTITION_KIND_NAMED" },
-};
-const char* MU_C3(MU_,FABRIC_SERVICE_PARTITION_KIND,_ToString)(FABRIC_SERVICE_PARTITION_KIND value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_PARTITION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_PARTITION_KIND, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_SERVICE_PARTITION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_PARTITION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_PARTITION_STATUS_ValuesAndStrings[] ={
-{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID" },
-{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_READY , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_READY" },
-{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_NOT_READY , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_NOT_READY" },
-{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_IN_QUORUM_LOSS , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_IN_QUORUM_LOSS" },
-{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_RECONFIGURING , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_RECONFIGURING" },
-{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_DELETING , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_DELETING" },
-{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLING , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLING" },
-{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLED , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLED" },
-};
-const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_PARTITION_STATUS,_ToString)(FABRIC_QUERY_SERVICE_PARTITION_STATUS value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_REPLICA_STATUS_ValuesAndStrings[] ={
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_INBUILD , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_INBUILD" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_STANDBY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_STANDBY" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_READY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_READY" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_DOWN , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_DOWN" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_DROPPED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_DROPPED" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_COMPLETED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_COMPLETED" },
-};
-const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_REPLICA_STATUS,_ToString)(FABRIC_QUERY_SERVICE_REPLICA_STATUS value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_ValuesAndStrings[] ={
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DEFAULT , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DEFAULT" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_ALL , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_ALL" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_INBUILD , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_INBUILD" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_STANDBY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_STANDBY" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_READY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_READY" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DOWN , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DOWN" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DROPPED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DROPPED" },
-{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_COMPLETED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_COMPLETED" },
-};
-const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER,_ToString)(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_OPERATION_NAME_ValuesAndStrings[] ={
-{ FABRIC_QUERY_SERVICE_OPERATION_NAME_INVALID , "FABRIC_QUERY_SERVICE_OPERATION_NAME_INVALID" },
-{ FABRIC_QUERY_SERVICE_OPERATION_NAME_NONE , "FABRIC_QUERY_SERVICE_OPERATION_NAME_NONE" },
-{ FABRIC_QUERY_SERVICE_OPERATION_NAME_OPEN , "FABRIC_QUERY_SERVICE_OPERATION_NAME_OPEN" },
-{ FABRIC_QUERY_SERVICE_OPERATION_NAME_CHANGEROLE , "FABRIC_QUERY_SERVICE_OPERATION_NAME_CHANGEROLE" },
-{ FABRIC_QUERY_SERVICE_OPERATION_NAME_CLOSE , "FABRIC_QUERY_SERVICE_OPERATION_NAME_CLOSE" },
-{ FABRIC_QUERY_SERVICE_OPERATION_NAME_ABORT , "FABRIC_QUERY_SERVICE_OPERATION_NAME_ABORT" },
-};
-const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_OPERATION_NAME,_ToString)(FABRIC_QUERY_SERVICE_OPERATION_NAME value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ValuesAndStrings[] ={
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_INVALID , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_INVALID" },
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_NONE , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_NONE" },
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_OPEN , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_OPEN" },
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CHANGEROLE , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CHANGEROLE" },
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_UPDATEEPOCH , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_UPDATEEPOCH" },
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CLOSE , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CLOSE" },
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ABORT , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ABORT" },
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ONDATALOSS , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ONDATALOSS" },
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_WAITFORCATCHUP , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_WAITFORCATCHUP" },
-{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_BUILD , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_BUILD" },
-};
-const char* MU_C3(MU_,FABRIC_QUERY_REPLICATOR_OPERATION_NAME,_ToString)(FABRIC_QUERY_REPLICATOR_OPERATION_NAME value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _ValuesAndStrings)[i].valueAsString;
-        }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_ValuesAndStrings[] ={
-{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID" },
-{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_NONE , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_NONE" },
-{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_EXEHOST , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_EXEHOST" },
-{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_DLLHOST , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_DLLHOST" },
-{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_CONTAINERHOST , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_CONTAINERHOST" },
-};
-const char* MU_C3(MU_,FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND,_ToString)(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _ValuesAndStrings)[0]);i++)
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_ERROR_CODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_ERROR_CODE, _ValuesAndStrings)[0]);
+    while(low < high)
     {
-        if(MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _ValuesAndStrings)[i].value == (int)value)
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_ERROR_CODE, _ValuesAndStrings)[middle].value < (int)value)
         {
-            return MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _ValuesAndStrings)[i].valueAsString;
+            low = middle + 1;
         }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_EXEHOST_WORKING_FOLDER_ValuesAndStrings[] ={
-{ FABRIC_EXEHOST_WORKING_FOLDER_INVALID , "FABRIC_EXEHOST_WORKING_FOLDER_INVALID" },
-{ FABRIC_EXEHOST_WORKING_FOLDER_WORK , "FABRIC_EXEHOST_WORKING_FOLDER_WORK" },
-{ FABRIC_EXEHOST_WORKING_FOLDER_CODE_PACKAGE , "FABRIC_EXEHOST_WORKING_FOLDER_CODE_PACKAGE" },
-{ FABRIC_EXEHOST_WORKING_FOLDER_CODE_BASE , "FABRIC_EXEHOST_WORKING_FOLDER_CODE_BASE" },
-};
-const char* MU_C3(MU_,FABRIC_EXEHOST_WORKING_FOLDER,_ToString)(FABRIC_EXEHOST_WORKING_FOLDER value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _ValuesAndStrings)[i].value == (int)value)
+        else if(MU_C2(FABRIC_ERROR_CODE, _ValuesAndStrings)[middle].value > (int)value)
         {
-            return MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _ValuesAndStrings)[i].valueAsString;
+            high = middle;
         }
-    }
-    return "UNKNOWN";
-}
-
-static const SF_ENUM_AND_STRING FABRIC_DLLHOST_HOSTED_DLL_KIND_ValuesAndStrings[] ={
-{ FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID , "FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID" },
-{ FABRIC_DLLHOST_HOSTED_DLL_KIND_UNMANAGED , "FABRIC_DLLHOST_HOSTED_DLL_KIND_UNMANAGED" },
-{ FABRIC_DLLHOST_HOSTED_DLL_KIND_MANAGED , "FABRIC_DLLHOST_HOSTED_DLL_KIND_MANAGED" },
-};
-const char* MU_C3(MU_,FABRIC_DLLHOST_HOSTED_DLL_KIND,_ToString)(FABRIC_DLLHOST_HOSTED_DLL_KIND value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _ValuesAndStrings)[i].value == (int)value)
+        else
         {
-            return MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _ValuesAndStrings)[i].valueAsString;
+            return MU_C2(FABRIC_ERROR_CODE, _ValuesAndStrings)[middle].valueAsString;
         }
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_DLLHOST_ISOLATION_POLICY_ValuesAndStrings[] ={
-{ FABRIC_DLLHOST_ISOLATION_POLICY_INVALID , "FABRIC_DLLHOST_ISOLATION_POLICY_INVALID" },
-{ FABRIC_DLLHOST_ISOLATION_POLICY_SHARED_DOMAIN , "FABRIC_DLLHOST_ISOLATION_POLICY_SHARED_DOMAIN" },
-{ FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_DOMAIN , "FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_DOMAIN" },
-{ FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_PROCESS , "FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_PROCESS" },
-};
-const char* MU_C3(MU_,FABRIC_DLLHOST_ISOLATION_POLICY,_ToString)(FABRIC_DLLHOST_ISOLATION_POLICY value)
-{
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _ValuesAndStrings)[0]);i++)
-    {
-        if(MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _ValuesAndStrings)[i].value == (int)value)
+static const SF_ENUM_AND_STRING FABRIC_ERROR_CODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_E_STORE_OUT_OF_SESSIONS , "FABRIC_E_STORE_OUT_OF_SESSIONS" },
+{ FABRIC_E_IMAGESTORE_IOERROR , "FABRIC_E_IMAGESTORE_IOERROR" },
+{ FABRIC_E_ENDPOINT_NOT_FOUND , "FABRIC_E_ENDPOINT_NOT_FOUND" },
+{ FABRIC_E_RELIABLE_SESSION_REJECTED , "FABRIC_E_RELIABLE_SESSION_REJECTED" },
+{ FABRIC_E_HEALTH_STALE_REPORT , "FABRIC_E_HEALTH_STALE_REPORT" },
+{ FABRIC_E_COPY_ABORTED , "FABRIC_E_COPY_ABORTED" },
+{ FABRIC_E_VOLUME_ALREADY_EXISTS , "FABRIC_E_VOLUME_ALREADY_EXISTS" },
+{ FABRIC_E_APPLICATION_NOT_FOUND , "FABRIC_E_APPLICATION_NOT_FOUND" },
+{ FABRIC_E_FORCE_NOT_SUPPORTED_FOR_REPLICA_OPERATION , "FABRIC_E_FORCE_NOT_SUPPORTED_FOR_REPLICA_OPERATION" },
+{ FABRIC_E_REPLICA_DOES_NOT_EXIST , "FABRIC_E_REPLICA_DOES_NOT_EXIST" },
+{ FABRIC_E_FABRIC_VERSION_NOT_FOUND , "FABRIC_E_FABRIC_VERSION_NOT_FOUND" },
+{ FABRIC_E_INVALID_RESTORE_DATA , "FABRIC_E_INVALID_RESTORE_DATA" },
+{ FABRIC_E_VERBOSE_FM_PLACEMENT_HEALTH_REPORTING_REQUIRED , "FABRIC_E_VERBOSE_FM_PLACEMENT_HEALTH_REPORTING_REQUIRED" },
+{ FABRIC_E_DUPLICATE_BACKUPS , "FABRIC_E_DUPLICATE_BACKUPS" },
+{ FABRIC_E_VOLUME_NOT_FOUND , "FABRIC_E_VOLUME_NOT_FOUND" },
+{ FABRIC_E_INVALID_X509_FIND_TYPE , "FABRIC_E_INVALID_X509_FIND_TYPE" },
+{ FABRIC_E_BACKUP_IS_ENABLED , "FABRIC_E_BACKUP_IS_ENABLED" },
+{ FABRIC_E_APPLICATION_NOT_UPGRADING , "FABRIC_E_APPLICATION_NOT_UPGRADING" },
+{ FABRIC_E_INVALID_PACKAGE_SHARING_POLICY , "FABRIC_E_INVALID_PACKAGE_SHARING_POLICY" },
+{ FABRIC_E_STOP_IN_PROGRESS , "FABRIC_E_STOP_IN_PROGRESS" },
+{ FABRIC_E_WRITE_CONFLICT , "FABRIC_E_WRITE_CONFLICT" },
+{ FABRIC_E_COMPOSE_DEPLOYMENT_ALREADY_EXISTS , "FABRIC_E_COMPOSE_DEPLOYMENT_ALREADY_EXISTS" },
+{ FABRIC_E_SERVER_AUTHENTICATION_FAILED , "FABRIC_E_SERVER_AUTHENTICATION_FAILED" },
+{ FABRIC_E_RELIABLE_SESSION_SERVICE_FAULTED , "FABRIC_E_RELIABLE_SESSION_SERVICE_FAULTED" },
+{ FABRIC_E_RELIABLE_SESSION_TRANSPORT_STARTUP_FAILURE , "FABRIC_E_RELIABLE_SESSION_TRANSPORT_STARTUP_FAILURE" },
+{ FABRIC_E_TIMEOUT , "FABRIC_E_TIMEOUT" },
+{ FABRIC_E_INSTANCE_COUNT_UPDATE_NOT_ALLOWED , "FABRIC_E_INSTANCE_COUNT_UPDATE_NOT_ALLOWED" },
+{ FABRIC_E_CM_OPERATION_FAILED , "FABRIC_E_CM_OPERATION_FAILED" },
+{ FABRIC_E_UPGRADE_DOMAIN_ALREADY_COMPLETED , "FABRIC_E_UPGRADE_DOMAIN_ALREADY_COMPLETED" },
+{ FABRIC_E_CONFIGURATION_PACKAGE_NOT_FOUND , "FABRIC_E_CONFIGURATION_PACKAGE_NOT_FOUND" },
+{ FABRIC_E_FAULT_ANALYSIS_SERVICE_NOT_ENABLED , "FABRIC_E_FAULT_ANALYSIS_SERVICE_NOT_ENABLED" },
+{ FABRIC_E_NODE_TRANSITION_IN_PROGRESS , "FABRIC_E_NODE_TRANSITION_IN_PROGRESS" },
+{ FABRIC_E_INVALID_REPLICA_SELECTOR , "FABRIC_E_INVALID_REPLICA_SELECTOR" },
+{ FABRIC_E_MESSAGE_TOO_LARGE , "FABRIC_E_MESSAGE_TOO_LARGE" },
+{ FABRIC_E_CONFIG_UPGRADE_FAILED , "FABRIC_E_CONFIG_UPGRADE_FAILED" },
+{ FABRIC_E_SERVICE_DOES_NOT_EXIST , "FABRIC_E_SERVICE_DOES_NOT_EXIST" },
+{ FABRIC_E_FACILITY_SF_LAST_HRESULT , "FABRIC_E_FACILITY_SF_LAST_HRESULT" },
+{ FABRIC_E_BACKUP_POLICY_ALREADY_EXISTS , "FABRIC_E_BACKUP_POLICY_ALREADY_EXISTS" },
+{ FABRIC_E_INVALID_CREDENTIAL_TYPE , "FABRIC_E_INVALID_CREDENTIAL_TYPE" },
+{ FABRIC_E_BACKUP_IN_PROGRESS , "FABRIC_E_BACKUP_IN_PROGRESS" },
+{ FABRIC_E_RELIABLE_SESSION_MANAGER_ALREADY_LISTENING , "FABRIC_E_RELIABLE_SESSION_MANAGER_ALREADY_LISTENING" },
+{ FABRIC_E_CONFIGURATION_PARAMETER_NOT_FOUND , "FABRIC_E_CONFIGURATION_PARAMETER_NOT_FOUND" },
+{ FABRIC_E_BACKUPCOPIER_TIMEOUT , "FABRIC_E_BACKUPCOPIER_TIMEOUT" },
+{ FABRIC_E_INVALID_PARTITION_SELECTOR , "FABRIC_E_INVALID_PARTITION_SELECTOR" },
+{ FABRIC_E_SECONDARY_ALREADY_EXISTS , "FABRIC_E_SECONDARY_ALREADY_EXISTS" },
+{ FABRIC_E_FABRIC_UPGRADE_VALIDATION_ERROR , "FABRIC_E_FABRIC_UPGRADE_VALIDATION_ERROR" },
+{ FABRIC_E_INVALID_DURATION , "FABRIC_E_INVALID_DURATION" },
+{ FABRIC_E_INVALID_FOR_STATELESS_SERVICES , "FABRIC_E_INVALID_FOR_STATELESS_SERVICES" },
+{ FABRIC_E_FABRIC_ALREADY_IN_TARGET_VERSION , "FABRIC_E_FABRIC_ALREADY_IN_TARGET_VERSION" },
+{ FABRIC_E_INVALID_PROTECTION_LEVEL , "FABRIC_E_INVALID_PROTECTION_LEVEL" },
+{ FABRIC_E_INVALID_OPERATION , "FABRIC_E_INVALID_OPERATION" },
+{ FABRIC_E_APPLICATION_TYPE_ALREADY_EXISTS , "FABRIC_E_APPLICATION_TYPE_ALREADY_EXISTS" },
+{ FABRIC_E_KEY_TOO_LARGE , "FABRIC_E_KEY_TOO_LARGE" },
+{ FABRIC_E_SERVICE_DISABLE_IN_PROGRESS , "FABRIC_E_SERVICE_DISABLE_IN_PROGRESS" },
+{ FABRIC_E_NODE_IS_DOWN , "FABRIC_E_NODE_IS_DOWN" },
+{ FABRIC_E_PROPERTY_DOES_NOT_EXIST , "FABRIC_E_PROPERTY_DOES_NOT_EXIST" },
+{ FABRIC_E_FABRIC_DATA_ROOT_NOT_FOUND , "FABRIC_E_FABRIC_DATA_ROOT_NOT_FOUND" },
+{ FABRIC_E_SERVICE_TYPE_NOT_REGISTERED , "FABRIC_E_SERVICE_TYPE_NOT_REGISTERED" },
+{ FABRIC_E_INVALID_REPLICA_STATE , "FABRIC_E_INVALID_REPLICA_STATE" },
+{ FABRIC_E_OPERATION_NOT_COMPLETE , "FABRIC_E_OPERATION_NOT_COMPLETE" },
+{ FABRIC_E_CODE_PACKAGE_NOT_FOUND , "FABRIC_E_CODE_PACKAGE_NOT_FOUND" },
+{ FABRIC_E_INSUFFICIENT_CLUSTER_CAPACITY , "FABRIC_E_INSUFFICIENT_CLUSTER_CAPACITY" },
+{ FABRIC_E_DATABASE_FILES_CORRUPTED , "FABRIC_E_DATABASE_FILES_CORRUPTED" },
+{ FABRIC_E_SERVICE_AFFINITY_CHAIN_NOT_SUPPORTED , "FABRIC_E_SERVICE_AFFINITY_CHAIN_NOT_SUPPORTED" },
+{ FABRIC_E_PARTITION_NOT_FOUND , "FABRIC_E_PARTITION_NOT_FOUND" },
+{ FABRIC_E_LOADBALANCER_NOT_READY , "FABRIC_E_LOADBALANCER_NOT_READY" },
+{ FABRIC_E_IMAGEBUILDER_TIMEOUT , "FABRIC_E_IMAGEBUILDER_TIMEOUT" },
+{ FABRIC_E_NOT_READABLE , "FABRIC_E_NOT_READABLE" },
+{ FABRIC_E_SINGLE_INSTANCE_APPLICATION_ALREADY_EXISTS , "FABRIC_E_SINGLE_INSTANCE_APPLICATION_ALREADY_EXISTS" },
+{ FABRIC_E_PRIMARY_ALREADY_EXISTS , "FABRIC_E_PRIMARY_ALREADY_EXISTS" },
+{ FABRIC_E_SERVICE_MANIFEST_NOT_FOUND , "FABRIC_E_SERVICE_MANIFEST_NOT_FOUND" },
+{ FABRIC_E_PATH_TOO_LONG , "FABRIC_E_PATH_TOO_LONG" },
+{ FABRIC_E_NODE_TYPE_NOT_FOUND , "FABRIC_E_NODE_TYPE_NOT_FOUND" },
+{ FABRIC_E_IMAGEBUILDER_VALIDATION_ERROR , "FABRIC_E_IMAGEBUILDER_VALIDATION_ERROR" },
+{ FABRIC_E_TRANSACTION_NOT_ACTIVE , "FABRIC_E_TRANSACTION_NOT_ACTIVE" },
+{ FABRIC_E_AUXILIARY_FEATURE_DISABLED , "FABRIC_E_AUXILIARY_FEATURE_DISABLED" },
+{ FABRIC_E_REPLICATION_OPERATION_TOO_LARGE , "FABRIC_E_REPLICATION_OPERATION_TOO_LARGE" },
+{ FABRIC_E_RELIABLE_SESSION_MANAGER_NOT_LISTENING , "FABRIC_E_RELIABLE_SESSION_MANAGER_NOT_LISTENING" },
+{ FABRIC_E_HEALTH_MAX_REPORTS_REACHED , "FABRIC_E_HEALTH_MAX_REPORTS_REACHED" },
+{ FABRIC_E_RESTORE_SAFE_CHECK_FAILED , "FABRIC_E_RESTORE_SAFE_CHECK_FAILED" },
+{ FABRIC_E_OPERATION_NOT_SUPPORTED , "FABRIC_E_OPERATION_NOT_SUPPORTED" },
+{ FABRIC_E_SERVICE_TOO_BUSY , "FABRIC_E_SERVICE_TOO_BUSY" },
+{ FABRIC_E_REPAIR_TASK_ALREADY_EXISTS , "FABRIC_E_REPAIR_TASK_ALREADY_EXISTS" },
+{ FABRIC_E_RELIABLE_SESSION_MANAGER_NOT_FOUND , "FABRIC_E_RELIABLE_SESSION_MANAGER_NOT_FOUND" },
+{ FABRIC_E_SECRET_VERSION_ALREADY_EXISTS , "FABRIC_E_SECRET_VERSION_ALREADY_EXISTS" },
+{ FABRIC_E_SERVICE_TYPE_TEMPLATE_NOT_FOUND , "FABRIC_E_SERVICE_TYPE_TEMPLATE_NOT_FOUND" },
+{ FABRIC_E_SEQUENCE_NUMBER_CHECK_FAILED , "FABRIC_E_SEQUENCE_NUMBER_CHECK_FAILED" },
+{ FABRIC_E_RUN_TO_COMPLETION_INCOMPATIBLE_WITH_SHARED_PROCESS , "FABRIC_E_RUN_TO_COMPLETION_INCOMPATIBLE_WITH_SHARED_PROCESS" },
+{ FABRIC_E_ONLY_VALID_FOR_STATEFUL_PERSISTENT_SERVICES , "FABRIC_E_ONLY_VALID_FOR_STATEFUL_PERSISTENT_SERVICES" },
+{ FABRIC_E_RELIABLE_SESSION_INVALID_TARGET_PARTITION , "FABRIC_E_RELIABLE_SESSION_INVALID_TARGET_PARTITION" },
+{ FABRIC_E_INVALID_REPLICA_OPERATION , "FABRIC_E_INVALID_REPLICA_OPERATION" },
+{ FABRIC_E_INVALID_BACKUP_SETTING , "FABRIC_E_INVALID_BACKUP_SETTING" },
+{ FABRIC_E_DNS_SERVICE_NOT_FOUND , "FABRIC_E_DNS_SERVICE_NOT_FOUND" },
+{ FABRIC_E_UPLOAD_SESSION_ID_CONFLICT , "FABRIC_E_UPLOAD_SESSION_ID_CONFLICT" },
+{ FABRIC_E_BACKUPCOPIER_ACCESS_DENIED , "FABRIC_E_BACKUPCOPIER_ACCESS_DENIED" },
+{ FABRIC_E_APPLICATION_ALREADY_EXISTS , "FABRIC_E_APPLICATION_ALREADY_EXISTS" },
+{ FABRIC_E_LAST_RESERVED_HRESULT , "FABRIC_E_LAST_RESERVED_HRESULT" },
+{ FABRIC_E_TEST_COMMAND_OPERATION_ID_ALREADY_EXISTS , "FABRIC_E_TEST_COMMAND_OPERATION_ID_ALREADY_EXISTS" },
+{ FABRIC_E_VERSION_STORE_OUT_OF_MEMORY , "FABRIC_E_VERSION_STORE_OUT_OF_MEMORY" },
+{ FABRIC_E_SERVICE_DISABLED , "FABRIC_E_SERVICE_DISABLED" },
+{ FABRIC_E_RELIABLE_SESSION_QUEUE_EMPTY , "FABRIC_E_RELIABLE_SESSION_QUEUE_EMPTY" },
+{ FABRIC_E_CONFIGURATION_SECTION_NOT_FOUND , "FABRIC_E_CONFIGURATION_SECTION_NOT_FOUND" },
+{ FABRIC_E_CONNECTION_CLOSED_BY_REMOTE_END , "FABRIC_E_CONNECTION_CLOSED_BY_REMOTE_END" },
+{ FABRIC_E_NODE_HAS_NOT_STOPPED_YET , "FABRIC_E_NODE_HAS_NOT_STOPPED_YET" },
+{ FABRIC_E_NO_WRITE_QUORUM , "FABRIC_E_NO_WRITE_QUORUM" },
+{ FABRIC_E_ENDPOINT_NOT_REFERENCED , "FABRIC_E_ENDPOINT_NOT_REFERENCED" },
+{ FABRIC_E_SKIP_RESTORE_OPERATION , "FABRIC_E_SKIP_RESTORE_OPERATION" },
+{ FABRIC_E_GATEWAY_NOT_REACHABLE , "FABRIC_E_GATEWAY_NOT_REACHABLE" },
+{ FABRIC_E_FABRIC_VERSION_ALREADY_EXISTS , "FABRIC_E_FABRIC_VERSION_ALREADY_EXISTS" },
+{ FABRIC_E_ENUMERATION_COMPLETED , "FABRIC_E_ENUMERATION_COMPLETED" },
+{ FABRIC_E_SINGLE_INSTANCE_APPLICATION_NOT_FOUND , "FABRIC_E_SINGLE_INSTANCE_APPLICATION_NOT_FOUND" },
+{ FABRIC_E_SERVICE_ENDPOINT_RESOURCE_NOT_FOUND , "FABRIC_E_SERVICE_ENDPOINT_RESOURCE_NOT_FOUND" },
+{ FABRIC_E_TRANSACTION_ABORTED , "FABRIC_E_TRANSACTION_ABORTED" },
+{ FABRIC_E_INVALID_ADDRESS , "FABRIC_E_INVALID_ADDRESS" },
+{ FABRIC_E_VALUE_TOO_LARGE , "FABRIC_E_VALUE_TOO_LARGE" },
+{ FABRIC_E_SERVICE_TYPE_MISMATCH , "FABRIC_E_SERVICE_TYPE_MISMATCH" },
+{ FABRIC_E_INVALID_NAME_URI , "FABRIC_E_INVALID_NAME_URI" },
+{ FABRIC_E_INVALID_PARTITION_OPERATION , "FABRIC_E_INVALID_PARTITION_OPERATION" },
+{ FABRIC_E_STORE_DISK_ERROR , "FABRIC_E_STORE_DISK_ERROR" },
+{ FABRIC_E_NOT_READY , "FABRIC_E_NOT_READY" },
+{ FABRIC_E_INVALID_X509_NAME_LIST , "FABRIC_E_INVALID_X509_NAME_LIST" },
+{ FABRIC_E_NOT_PRIMARY , "FABRIC_E_NOT_PRIMARY" },
+{ FABRIC_E_STORE_OUT_OF_INSTANCES , "FABRIC_E_STORE_OUT_OF_INSTANCES" },
+{ FABRIC_E_UPGRADE_FAILED , "FABRIC_E_UPGRADE_FAILED" },
+{ FABRIC_E_INVALID_SERVICE_TYPE , "FABRIC_E_INVALID_SERVICE_TYPE" },
+{ FABRIC_E_HEALTH_ENTITY_NOT_FOUND , "FABRIC_E_HEALTH_ENTITY_NOT_FOUND" },
+{ FABRIC_E_FABRIC_NOT_UPGRADING , "FABRIC_E_FABRIC_NOT_UPGRADING" },
+{ FABRIC_E_SERVICE_ALREADY_EXISTS , "FABRIC_E_SERVICE_ALREADY_EXISTS" },
+{ FABRIC_E_RESTORE_WAITING_FOR_USER_INTERVENTION , "FABRIC_E_RESTORE_WAITING_FOR_USER_INTERVENTION" },
+{ FABRIC_E_SECRET_INVALID , "FABRIC_E_SECRET_INVALID" },
+{ FABRIC_E_DNS_NAME_IN_USE , "FABRIC_E_DNS_NAME_IN_USE" },
+{ FABRIC_E_SERVICE_TYPE_NOT_FOUND , "FABRIC_E_SERVICE_TYPE_NOT_FOUND" },
+{ FABRIC_E_APPLICATION_TYPE_NOT_FOUND , "FABRIC_E_APPLICATION_TYPE_NOT_FOUND" },
+{ FABRIC_E_INVALID_CREDENTIALS , "FABRIC_E_INVALID_CREDENTIALS" },
+{ FABRIC_E_IMAGEBUILDER_UNEXPECTED_ERROR , "FABRIC_E_IMAGEBUILDER_UNEXPECTED_ERROR" },
+{ FABRIC_E_CORRUPTED_IMAGE_STORE_OBJECT_FOUND , "FABRIC_E_CORRUPTED_IMAGE_STORE_OBJECT_FOUND" },
+{ FABRIC_E_FABRIC_VERSION_IN_USE , "FABRIC_E_FABRIC_VERSION_IN_USE" },
+{ FABRIC_E_INVALID_CONFIGURATION , "FABRIC_E_INVALID_CONFIGURATION" },
+{ FABRIC_E_ACQUIRE_FILE_LOCK_FAILED , "FABRIC_E_ACQUIRE_FILE_LOCK_FAILED" },
+{ FABRIC_E_OBJECT_DISPOSED , "FABRIC_E_OBJECT_DISPOSED" },
+{ FABRIC_E_INVALID_ATOMIC_GROUP , "FABRIC_E_INVALID_ATOMIC_GROUP" },
+{ FABRIC_E_INVALID_INSTANCE_ID , "FABRIC_E_INVALID_INSTANCE_ID" },
+{ FABRIC_E_AUXILIARY_ALREADY_EXISTS , "FABRIC_E_AUXILIARY_ALREADY_EXISTS" },
+{ FABRIC_E_FILE_NOT_FOUND , "FABRIC_E_FILE_NOT_FOUND" },
+{ FABRIC_E_INVALID_X509_THUMBPRINT , "FABRIC_E_INVALID_X509_THUMBPRINT" },
+{ FABRIC_E_APPLICATION_UPGRADE_IN_PROGRESS , "FABRIC_E_APPLICATION_UPGRADE_IN_PROGRESS" },
+{ FABRIC_E_CONNECTION_DENIED , "FABRIC_E_CONNECTION_DENIED" },
+{ FABRIC_E_STORE_OUT_OF_LONG_VALUE_IDS , "FABRIC_E_STORE_OUT_OF_LONG_VALUE_IDS" },
+{ FABRIC_E_ALREADY_STOPPED , "FABRIC_E_ALREADY_STOPPED" },
+{ FABRIC_E_RECONFIGURATION_PENDING , "FABRIC_E_RECONFIGURATION_PENDING" },
+{ FABRIC_E_BACKUP_NOT_ENABLED , "FABRIC_E_BACKUP_NOT_ENABLED" },
+{ FABRIC_E_BACKUPCOPIER_UNEXPECTED_ERROR , "FABRIC_E_BACKUPCOPIER_UNEXPECTED_ERROR" },
+{ FABRIC_E_INSTANCE_ID_MISMATCH , "FABRIC_E_INSTANCE_ID_MISMATCH" },
+{ FABRIC_E_CENTRAL_SECRET_SERVICE_GENERIC , "FABRIC_E_CENTRAL_SECRET_SERVICE_GENERIC" },
+{ FABRIC_E_REPAIR_TASK_NOT_FOUND , "FABRIC_E_REPAIR_TASK_NOT_FOUND" },
+{ FABRIC_E_CANNOT_CONNECT , "FABRIC_E_CANNOT_CONNECT" },
+{ FABRIC_E_IMAGEBUILDER_ACCESS_DENIED , "FABRIC_E_IMAGEBUILDER_ACCESS_DENIED" },
+{ FABRIC_E_PREDEPLOYMENT_NOT_ALLOWED , "FABRIC_E_PREDEPLOYMENT_NOT_ALLOWED" },
+{ FABRIC_E_SERVICE_TYPE_ALREADY_REGISTERED , "FABRIC_E_SERVICE_TYPE_ALREADY_REGISTERED" },
+{ FABRIC_E_INVALID_SERVICE_SCALING_POLICY , "FABRIC_E_INVALID_SERVICE_SCALING_POLICY" },
+{ FABRIC_E_INVALID_UPLOAD_SESSION_ID , "FABRIC_E_INVALID_UPLOAD_SESSION_ID" },
+{ FABRIC_E_INVALID_PARTITION_KEY , "FABRIC_E_INVALID_PARTITION_KEY" },
+{ FABRIC_E_NETWORK_IN_USE , "FABRIC_E_NETWORK_IN_USE" },
+{ FABRIC_E_FIRST_RESERVED_HRESULT , "FABRIC_E_FIRST_RESERVED_HRESULT" },
+{ FABRIC_E_PROPERTY_CHECK_FAILED , "FABRIC_E_PROPERTY_CHECK_FAILED" },
+{ FABRIC_E_PROCESS_DEACTIVATED , "FABRIC_E_PROCESS_DEACTIVATED" },
+{ FABRIC_E_SERVICE_GROUP_DOES_NOT_EXIST , "FABRIC_E_SERVICE_GROUP_DOES_NOT_EXIST" },
+{ FABRIC_E_INSTANCE_ALREADY_EXISTS , "FABRIC_E_INSTANCE_ALREADY_EXISTS" },
+{ FABRIC_E_VALUE_EMPTY , "FABRIC_E_VALUE_EMPTY" },
+{ FABRIC_E_FACILITY_SF_FIRST_HRESULT , "FABRIC_E_FACILITY_SF_FIRST_HRESULT" },
+{ FABRIC_E_NODE_IS_UP , "FABRIC_E_NODE_IS_UP" },
+{ FABRIC_E_RESTORE_SOURCE_TARGET_PARTITION_MISMATCH , "FABRIC_E_RESTORE_SOURCE_TARGET_PARTITION_MISMATCH" },
+{ FABRIC_E_INVALID_FOR_STATEFUL_SERVICES , "FABRIC_E_INVALID_FOR_STATEFUL_SERVICES" },
+{ FABRIC_E_INVALID_X509_STORE_NAME , "FABRIC_E_INVALID_X509_STORE_NAME" },
+{ FABRIC_E_APPLICATION_UPGRADE_VALIDATION_ERROR , "FABRIC_E_APPLICATION_UPGRADE_VALIDATION_ERROR" },
+{ FABRIC_E_NAME_DOES_NOT_EXIST , "FABRIC_E_NAME_DOES_NOT_EXIST" },
+{ FABRIC_E_APPLICATION_TYPE_PROVISION_IN_PROGRESS , "FABRIC_E_APPLICATION_TYPE_PROVISION_IN_PROGRESS" },
+{ FABRIC_E_BACKUP_POLICY_DOES_NOT_EXIST , "FABRIC_E_BACKUP_POLICY_DOES_NOT_EXIST" },
+{ FABRIC_E_DATABASE_MIGRATION_IN_PROGRESS , "FABRIC_E_DATABASE_MIGRATION_IN_PROGRESS" },
+{ FABRIC_E_NAME_ALREADY_EXISTS , "FABRIC_E_NAME_ALREADY_EXISTS" },
+{ FABRIC_E_DUPLICATE_SERVICE_NOTIFICATION_FILTER_NAME , "FABRIC_E_DUPLICATE_SERVICE_NOTIFICATION_FILTER_NAME" },
+{ FABRIC_E_RELIABLE_SESSION_MANAGER_EXISTS , "FABRIC_E_RELIABLE_SESSION_MANAGER_EXISTS" },
+{ FABRIC_E_DIRECTORY_NOT_FOUND , "FABRIC_E_DIRECTORY_NOT_FOUND" },
+{ FABRIC_E_BACKUP_NOT_FOUND , "FABRIC_E_BACKUP_NOT_FOUND" },
+{ FABRIC_E_COMPOSE_DEPLOYMENT_NOT_UPGRADING , "FABRIC_E_COMPOSE_DEPLOYMENT_NOT_UPGRADING" },
+{ FABRIC_E_RELIABLE_SESSION_NOT_FOUND , "FABRIC_E_RELIABLE_SESSION_NOT_FOUND" },
+{ FABRIC_E_TRANSACTION_TOO_LARGE , "FABRIC_E_TRANSACTION_TOO_LARGE" },
+{ FABRIC_E_IMAGEBUILDER_RESERVED_DIRECTORY_ERROR , "FABRIC_E_IMAGEBUILDER_RESERVED_DIRECTORY_ERROR" },
+{ FABRIC_E_COMPOSE_DEPLOYMENT_NOT_FOUND , "FABRIC_E_COMPOSE_DEPLOYMENT_NOT_FOUND" },
+{ FABRIC_E_MISSING_FULL_BACKUP , "FABRIC_E_MISSING_FULL_BACKUP" },
+{ FABRIC_E_NETWORK_NOT_FOUND , "FABRIC_E_NETWORK_NOT_FOUND" },
+{ FABRIC_E_OBJECT_CLOSED , "FABRIC_E_OBJECT_CLOSED" },
+{ FABRIC_E_NAME_NOT_EMPTY , "FABRIC_E_NAME_NOT_EMPTY" },
+{ FABRIC_E_APPLICATION_TYPE_IN_USE , "FABRIC_E_APPLICATION_TYPE_IN_USE" },
+{ FABRIC_E_CONSTRAINT_NOT_SATISFIED , "FABRIC_E_CONSTRAINT_NOT_SATISFIED" },
+{ FABRIC_E_DECRYPTION_FAILED , "FABRIC_E_DECRYPTION_FAILED" },
+{ FABRIC_E_INVALID_X509_STORE , "FABRIC_E_INVALID_X509_STORE" },
+{ FABRIC_E_SERVICE_ALREADY_IN_REQUESTED_STATE , "FABRIC_E_SERVICE_ALREADY_IN_REQUESTED_STATE" },
+{ FABRIC_E_SERVICE_METADATA_MISMATCH , "FABRIC_E_SERVICE_METADATA_MISMATCH" },
+{ FABRIC_E_APPLICATION_ALREADY_IN_TARGET_VERSION , "FABRIC_E_APPLICATION_ALREADY_IN_TARGET_VERSION" },
+{ FABRIC_E_INVALID_TEST_COMMAND_STATE , "FABRIC_E_INVALID_TEST_COMMAND_STATE" },
+{ FABRIC_E_INVALID_X509_STORE_LOCATION , "FABRIC_E_INVALID_X509_STORE_LOCATION" },
+{ FABRIC_E_INSUFFICIENT_MAX_LOAD_CAPACITY , "FABRIC_E_INSUFFICIENT_MAX_LOAD_CAPACITY" },
+{ FABRIC_E_CHAOS_ALREADY_RUNNING , "FABRIC_E_CHAOS_ALREADY_RUNNING" },
+{ FABRIC_E_SECRET_TYPE_CANNOT_BE_CHANGED , "FABRIC_E_SECRET_TYPE_CANNOT_BE_CHANGED" },
+{ FABRIC_E_INVALID_DNS_NAME , "FABRIC_E_INVALID_DNS_NAME" },
+{ FABRIC_E_REPLICATION_QUEUE_FULL , "FABRIC_E_REPLICATION_QUEUE_FULL" },
+{ FABRIC_E_BACKUP_DIRECTORY_NOT_EMPTY , "FABRIC_E_BACKUP_DIRECTORY_NOT_EMPTY" },
+{ FABRIC_E_LAST_USED_HRESULT , "FABRIC_E_LAST_USED_HRESULT" },
+{ FABRIC_E_ENCRYPTION_FAILED , "FABRIC_E_ENCRYPTION_FAILED" },
+{ FABRIC_E_RELIABLE_SESSION_CANNOT_CONNECT , "FABRIC_E_RELIABLE_SESSION_CANNOT_CONNECT" },
+{ FABRIC_E_KEY_NOT_FOUND , "FABRIC_E_KEY_NOT_FOUND" },
+{ FABRIC_E_IMAGEBUILDER_INVALID_MSI_FILE , "FABRIC_E_IMAGEBUILDER_INVALID_MSI_FILE" },
+{ FABRIC_E_MAX_ALLOWED_DISABLED_SERVICES_REACHED , "FABRIC_E_MAX_ALLOWED_DISABLED_SERVICES_REACHED" },
+{ FABRIC_E_CERTIFICATE_NOT_FOUND , "FABRIC_E_CERTIFICATE_NOT_FOUND" },
+{ FABRIC_E_UPLOAD_SESSION_RANGE_NOT_SATISFIABLE , "FABRIC_E_UPLOAD_SESSION_RANGE_NOT_SATISFIABLE" },
+{ FABRIC_E_DATA_PACKAGE_NOT_FOUND , "FABRIC_E_DATA_PACKAGE_NOT_FOUND" },
+{ FABRIC_E_SERVICE_GROUP_ALREADY_EXISTS , "FABRIC_E_SERVICE_GROUP_ALREADY_EXISTS" },
+{ FABRIC_E_CONTAINER_NOT_FOUND , "FABRIC_E_CONTAINER_NOT_FOUND" },
+{ FABRIC_E_RELIABLE_SESSION_ALREADY_EXISTS , "FABRIC_E_RELIABLE_SESSION_ALREADY_EXISTS" },
+{ FABRIC_E_INVALID_SUBJECT_NAME , "FABRIC_E_INVALID_SUBJECT_NAME" },
+{ FABRIC_E_COMMUNICATION_ERROR , "FABRIC_E_COMMUNICATION_ERROR" },
+{ FABRIC_E_APPLICATION_UPDATE_IN_PROGRESS , "FABRIC_E_APPLICATION_UPDATE_IN_PROGRESS" },
+{ FABRIC_E_NODE_NOT_FOUND , "FABRIC_E_NODE_NOT_FOUND" },
+{ FABRIC_E_FABRIC_UPGRADE_IN_PROGRESS , "FABRIC_E_FABRIC_UPGRADE_IN_PROGRESS" },
+{ FABRIC_E_INVALID_DIRECTORY , "FABRIC_E_INVALID_DIRECTORY" },
+{ FABRIC_E_RESTORE_IN_PROGRESS , "FABRIC_E_RESTORE_IN_PROGRESS" },
+{ FABRIC_E_DELETE_BACKUP_FILE_FAILED , "FABRIC_E_DELETE_BACKUP_FILE_FAILED" },
+{ FABRIC_E_INVALID_BACKUP , "FABRIC_E_INVALID_BACKUP" },
+{ FABRIC_E_INVALID_BACKUP_CHAIN , "FABRIC_E_INVALID_BACKUP_CHAIN" },
+{ FABRIC_E_MULTITHREADED_TRANSACTIONS_NOT_ALLOWED , "FABRIC_E_MULTITHREADED_TRANSACTIONS_NOT_ALLOWED" },
+{ FABRIC_E_RELIABLE_SESSION_QUOTA_EXCEEDED , "FABRIC_E_RELIABLE_SESSION_QUOTA_EXCEEDED" },
+{ FABRIC_E_USER_ROLE_CLIENT_CERTIFICATE_NOT_CONFIGURED , "FABRIC_E_USER_ROLE_CLIENT_CERTIFICATE_NOT_CONFIGURED" },
+{ FABRIC_E_PROCESS_ABORTED , "FABRIC_E_PROCESS_ABORTED" },
+{ FABRIC_E_SERVICE_OFFLINE , "FABRIC_E_SERVICE_OFFLINE" },
+{ FABRIC_E_INVALID_ALLOWED_COMMON_NAME_LIST , "FABRIC_E_INVALID_ALLOWED_COMMON_NAME_LIST" },
+{ FABRIC_E_LAST_USED_FACILITY_SF_HRESULT , "FABRIC_E_LAST_USED_FACILITY_SF_HRESULT" },
+{ FABRIC_E_SINGLE_INSTANCE_APPLICATION_UPGRADE_IN_PROGRESS , "FABRIC_E_SINGLE_INSTANCE_APPLICATION_UPGRADE_IN_PROGRESS" },
+{ FABRIC_E_DISABLE_ENABLE_SERVICE_FEATURE_DISABLED , "FABRIC_E_DISABLE_ENABLE_SERVICE_FEATURE_DISABLED" },
+{ FABRIC_E_CONSTRAINT_KEY_UNDEFINED , "FABRIC_E_CONSTRAINT_KEY_UNDEFINED" },
+};
+static const int32_t FABRIC_ERROR_CODE_Seeds[] ={
+-3, -7, -12, 1, -15, 1, 1, 0, -21, -26, 0, 0, 4, 4, 0, 1,
+0, 0, 1, -30, -31, -34, 0, 0, 0, 1, -35, 2, 0, 4, 4, 0,
+-42, -46, 0, 0, -49, 0, 0, 0, 6, 0, 0, -50, 1, 3, 2, -52,
+0, -56, -59, -60, 1, 1, 0, 0, 0, -61, -62, -68, -69, -71, 0, -76,
+-82, -83, 2, -86, 0, -90, 2, -91, 1, 6, 0, -94, 0, 3, 0, 1,
+1, 4, 1, 8, -95, -96, 0, 0, 3, 0, 0, -97, 0, 2, 0, 2,
+0, -100, -101, 0, -104, 0, -107, 4, -109, 2, -111, 0, 0, -112, 3, 0,
+-113, -115, -119, 0, -122, -127, -131, 2, 0, 2, -133, -137, 0, 1, -140, 0,
+-141, 0, 1, 0, 12, -142, 0, 3, -145, -149, 1, 0, 0, 1, 3, -151,
+-153, 0, 0, 0, 0, 0, 0, -155, 0, 1, -162, -171, 0, 0, 1, 3,
+1, 0, -175, 8, -176, 0, 5, -179, 0, -180, -184, 2, -185, 3, -192, 0,
+0, 11, 0, -193, 0, 0, 2, 0, 7, -202, 0, 0, 0, 0, -203, -204,
+0, 20, 2, 0, 0, 0, 0, 0, -209, 0, -213, 1, 11, 2, 0, 1,
+0, 0, 2, 0, 5, 0, -215, 0, -216, 5, 0, 7, -221, 0, 1, 2,
+9, 10, 0, -222, -225, -227, -233, -237, 0, 0, 0, -239, 0, 0, 17, -240,
+};
+int MU_C2(FABRIC_ERROR_CODE, _FromString)(const char* enumAsString, FABRIC_ERROR_CODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ERROR_CODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ERROR_CODE, _Seeds), sizeof(MU_C2(FABRIC_ERROR_CODE, _Seeds))/sizeof(MU_C2(FABRIC_ERROR_CODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ERROR_CODE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_ERROR_CODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ERROR_CODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ERROR_CODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ERROR_CODE, _Seeds), sizeof(MU_C2(FABRIC_ERROR_CODE, _Seeds))/sizeof(MU_C2(FABRIC_ERROR_CODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ERROR_CODE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_CLIENT_ROLE_Strings[FABRIC_CLIENT_ROLE_ELEVATED_ADMIN - FABRIC_CLIENT_ROLE_UNKNOWN + 1] ={
+[FABRIC_CLIENT_ROLE_UNKNOWN - FABRIC_CLIENT_ROLE_UNKNOWN] = "FABRIC_CLIENT_ROLE_UNKNOWN",
+[FABRIC_CLIENT_ROLE_USER - FABRIC_CLIENT_ROLE_UNKNOWN] = "FABRIC_CLIENT_ROLE_USER",
+[FABRIC_CLIENT_ROLE_ADMIN - FABRIC_CLIENT_ROLE_UNKNOWN] = "FABRIC_CLIENT_ROLE_ADMIN",
+[FABRIC_CLIENT_ROLE_ELEVATED_ADMIN - FABRIC_CLIENT_ROLE_UNKNOWN] = "FABRIC_CLIENT_ROLE_ELEVATED_ADMIN",
+};
+const char* MU_C3(MU_,FABRIC_CLIENT_ROLE,_ToString)(FABRIC_CLIENT_ROLE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_CLIENT_ROLE_UNKNOWN;
+    if ((index < sizeof(MU_C2(FABRIC_CLIENT_ROLE, _Strings))/sizeof(MU_C2(FABRIC_CLIENT_ROLE, _Strings)[0])) && (MU_C2(FABRIC_CLIENT_ROLE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_CLIENT_ROLE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_CLIENT_ROLE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_CLIENT_ROLE_UNKNOWN , "FABRIC_CLIENT_ROLE_UNKNOWN" },
+{ FABRIC_CLIENT_ROLE_ADMIN , "FABRIC_CLIENT_ROLE_ADMIN" },
+{ FABRIC_CLIENT_ROLE_ELEVATED_ADMIN , "FABRIC_CLIENT_ROLE_ELEVATED_ADMIN" },
+{ FABRIC_CLIENT_ROLE_USER , "FABRIC_CLIENT_ROLE_USER" },
+};
+static const int32_t FABRIC_CLIENT_ROLE_Seeds[] ={
+1, 0, 1, 0,
+};
+int MU_C2(FABRIC_CLIENT_ROLE, _FromString)(const char* enumAsString, FABRIC_CLIENT_ROLE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CLIENT_ROLE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CLIENT_ROLE, _Seeds), sizeof(MU_C2(FABRIC_CLIENT_ROLE, _Seeds))/sizeof(MU_C2(FABRIC_CLIENT_ROLE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CLIENT_ROLE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_CLIENT_ROLE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CLIENT_ROLE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CLIENT_ROLE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CLIENT_ROLE, _Seeds), sizeof(MU_C2(FABRIC_CLIENT_ROLE, _Seeds))/sizeof(MU_C2(FABRIC_CLIENT_ROLE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CLIENT_ROLE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_QUERY_SERVICE_STATUS_Strings[FABRIC_QUERY_SERVICE_STATUS_DISABLED - FABRIC_QUERY_SERVICE_STATUS_UNKNOWN + 1] ={
+[FABRIC_QUERY_SERVICE_STATUS_UNKNOWN - FABRIC_QUERY_SERVICE_STATUS_UNKNOWN] = "FABRIC_QUERY_SERVICE_STATUS_UNKNOWN",
+[FABRIC_QUERY_SERVICE_STATUS_ACTIVE - FABRIC_QUERY_SERVICE_STATUS_UNKNOWN] = "FABRIC_QUERY_SERVICE_STATUS_ACTIVE",
+[FABRIC_QUERY_SERVICE_STATUS_UPGRADING - FABRIC_QUERY_SERVICE_STATUS_UNKNOWN] = "FABRIC_QUERY_SERVICE_STATUS_UPGRADING",
+[FABRIC_QUERY_SERVICE_STATUS_DELETING - FABRIC_QUERY_SERVICE_STATUS_UNKNOWN] = "FABRIC_QUERY_SERVICE_STATUS_DELETING",
+[FABRIC_QUERY_SERVICE_STATUS_CREATING - FABRIC_QUERY_SERVICE_STATUS_UNKNOWN] = "FABRIC_QUERY_SERVICE_STATUS_CREATING",
+[FABRIC_QUERY_SERVICE_STATUS_FAILED - FABRIC_QUERY_SERVICE_STATUS_UNKNOWN] = "FABRIC_QUERY_SERVICE_STATUS_FAILED",
+[FABRIC_QUERY_SERVICE_STATUS_DISABLING - FABRIC_QUERY_SERVICE_STATUS_UNKNOWN] = "FABRIC_QUERY_SERVICE_STATUS_DISABLING",
+[FABRIC_QUERY_SERVICE_STATUS_DISABLED - FABRIC_QUERY_SERVICE_STATUS_UNKNOWN] = "FABRIC_QUERY_SERVICE_STATUS_DISABLED",
+};
+const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_STATUS,_ToString)(FABRIC_QUERY_SERVICE_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_QUERY_SERVICE_STATUS_UNKNOWN;
+    if ((index < sizeof(MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Strings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Strings)[0])) && (MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_QUERY_SERVICE_STATUS_ACTIVE , "FABRIC_QUERY_SERVICE_STATUS_ACTIVE" },
+{ FABRIC_QUERY_SERVICE_STATUS_FAILED , "FABRIC_QUERY_SERVICE_STATUS_FAILED" },
+{ FABRIC_QUERY_SERVICE_STATUS_UNKNOWN , "FABRIC_QUERY_SERVICE_STATUS_UNKNOWN" },
+{ FABRIC_QUERY_SERVICE_STATUS_DISABLING , "FABRIC_QUERY_SERVICE_STATUS_DISABLING" },
+{ FABRIC_QUERY_SERVICE_STATUS_CREATING , "FABRIC_QUERY_SERVICE_STATUS_CREATING" },
+{ FABRIC_QUERY_SERVICE_STATUS_DISABLED , "FABRIC_QUERY_SERVICE_STATUS_DISABLED" },
+{ FABRIC_QUERY_SERVICE_STATUS_DELETING , "FABRIC_QUERY_SERVICE_STATUS_DELETING" },
+{ FABRIC_QUERY_SERVICE_STATUS_UPGRADING , "FABRIC_QUERY_SERVICE_STATUS_UPGRADING" },
+};
+static const int32_t FABRIC_QUERY_SERVICE_STATUS_Seeds[] ={
+1, -1, 0, -2, -3, -5, -7, -8,
+};
+int MU_C2(FABRIC_QUERY_SERVICE_STATUS, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_QUERY_SERVICE_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_STATUS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_QUERY_NODE_STATUS_Strings[FABRIC_QUERY_NODE_STATUS_REMOVED - FABRIC_QUERY_NODE_STATUS_INVALID + 1] ={
+[FABRIC_QUERY_NODE_STATUS_INVALID - FABRIC_QUERY_NODE_STATUS_INVALID] = "FABRIC_QUERY_NODE_STATUS_INVALID",
+[FABRIC_QUERY_NODE_STATUS_UP - FABRIC_QUERY_NODE_STATUS_INVALID] = "FABRIC_QUERY_NODE_STATUS_UP",
+[FABRIC_QUERY_NODE_STATUS_DOWN - FABRIC_QUERY_NODE_STATUS_INVALID] = "FABRIC_QUERY_NODE_STATUS_DOWN",
+[FABRIC_QUERY_NODE_STATUS_ENABLING - FABRIC_QUERY_NODE_STATUS_INVALID] = "FABRIC_QUERY_NODE_STATUS_ENABLING",
+[FABRIC_QUERY_NODE_STATUS_DISABLING - FABRIC_QUERY_NODE_STATUS_INVALID] = "FABRIC_QUERY_NODE_STATUS_DISABLING",
+[FABRIC_QUERY_NODE_STATUS_DISABLED - FABRIC_QUERY_NODE_STATUS_INVALID] = "FABRIC_QUERY_NODE_STATUS_DISABLED",
+[FABRIC_QUERY_NODE_STATUS_UNKNOWN - FABRIC_QUERY_NODE_STATUS_INVALID] = "FABRIC_QUERY_NODE_STATUS_UNKNOWN",
+[FABRIC_QUERY_NODE_STATUS_REMOVED - FABRIC_QUERY_NODE_STATUS_INVALID] = "FABRIC_QUERY_NODE_STATUS_REMOVED",
+};
+const char* MU_C3(MU_,FABRIC_QUERY_NODE_STATUS,_ToString)(FABRIC_QUERY_NODE_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_QUERY_NODE_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS, _Strings))/sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS, _Strings)[0])) && (MU_C2(FABRIC_QUERY_NODE_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_QUERY_NODE_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_NODE_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_QUERY_NODE_STATUS_UP , "FABRIC_QUERY_NODE_STATUS_UP" },
+{ FABRIC_QUERY_NODE_STATUS_REMOVED , "FABRIC_QUERY_NODE_STATUS_REMOVED" },
+{ FABRIC_QUERY_NODE_STATUS_UNKNOWN , "FABRIC_QUERY_NODE_STATUS_UNKNOWN" },
+{ FABRIC_QUERY_NODE_STATUS_DISABLING , "FABRIC_QUERY_NODE_STATUS_DISABLING" },
+{ FABRIC_QUERY_NODE_STATUS_DISABLED , "FABRIC_QUERY_NODE_STATUS_DISABLED" },
+{ FABRIC_QUERY_NODE_STATUS_ENABLING , "FABRIC_QUERY_NODE_STATUS_ENABLING" },
+{ FABRIC_QUERY_NODE_STATUS_INVALID , "FABRIC_QUERY_NODE_STATUS_INVALID" },
+{ FABRIC_QUERY_NODE_STATUS_DOWN , "FABRIC_QUERY_NODE_STATUS_DOWN" },
+};
+static const int32_t FABRIC_QUERY_NODE_STATUS_Seeds[] ={
+-1, -2, 0, -3, 1, 0, -6, 1,
+};
+int MU_C2(FABRIC_QUERY_NODE_STATUS, _FromString)(const char* enumAsString, FABRIC_QUERY_NODE_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_NODE_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_NODE_STATUS, _Seeds), sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_NODE_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_QUERY_NODE_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_NODE_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_NODE_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_NODE_STATUS, _Seeds), sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_NODE_STATUS)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_NODE_STATUS_FILTER_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_QUERY_NODE_STATUS_FILTER_DEFAULT , "FABRIC_QUERY_NODE_STATUS_FILTER_DEFAULT" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_UP , "FABRIC_QUERY_NODE_STATUS_FILTER_UP" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_DOWN , "FABRIC_QUERY_NODE_STATUS_FILTER_DOWN" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_ENABLING , "FABRIC_QUERY_NODE_STATUS_FILTER_ENABLING" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_DISABLING , "FABRIC_QUERY_NODE_STATUS_FILTER_DISABLING" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_DISABLED , "FABRIC_QUERY_NODE_STATUS_FILTER_DISABLED" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_UNKNOWN , "FABRIC_QUERY_NODE_STATUS_FILTER_UNKNOWN" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_REMOVED , "FABRIC_QUERY_NODE_STATUS_FILTER_REMOVED" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_ALL , "FABRIC_QUERY_NODE_STATUS_FILTER_ALL" },
+};
+const char* MU_C3(MU_,FABRIC_QUERY_NODE_STATUS_FILTER,_ToString)(FABRIC_QUERY_NODE_STATUS_FILTER value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_NODE_STATUS_FILTER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_QUERY_NODE_STATUS_FILTER_REMOVED , "FABRIC_QUERY_NODE_STATUS_FILTER_REMOVED" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_ENABLING , "FABRIC_QUERY_NODE_STATUS_FILTER_ENABLING" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_DISABLED , "FABRIC_QUERY_NODE_STATUS_FILTER_DISABLED" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_ALL , "FABRIC_QUERY_NODE_STATUS_FILTER_ALL" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_DEFAULT , "FABRIC_QUERY_NODE_STATUS_FILTER_DEFAULT" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_UNKNOWN , "FABRIC_QUERY_NODE_STATUS_FILTER_UNKNOWN" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_DISABLING , "FABRIC_QUERY_NODE_STATUS_FILTER_DISABLING" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_UP , "FABRIC_QUERY_NODE_STATUS_FILTER_UP" },
+{ FABRIC_QUERY_NODE_STATUS_FILTER_DOWN , "FABRIC_QUERY_NODE_STATUS_FILTER_DOWN" },
+};
+static const int32_t FABRIC_QUERY_NODE_STATUS_FILTER_Seeds[] ={
+1, -2, -5, -7, 0, 0, 0, -8, 1,
+};
+int MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _FromString)(const char* enumAsString, FABRIC_QUERY_NODE_STATUS_FILTER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _Seeds), sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_NODE_STATUS_FILTER)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_NODE_STATUS_FILTER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _Seeds), sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_NODE_STATUS_FILTER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_NODE_STATUS_FILTER)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_KIND_Strings[FABRIC_SERVICE_KIND_SELF_RECONFIGURING - FABRIC_SERVICE_KIND_INVALID + 1] ={
+[FABRIC_SERVICE_KIND_INVALID - FABRIC_SERVICE_KIND_INVALID] = "FABRIC_SERVICE_KIND_INVALID",
+[FABRIC_SERVICE_KIND_STATELESS - FABRIC_SERVICE_KIND_INVALID] = "FABRIC_SERVICE_KIND_STATELESS",
+[FABRIC_SERVICE_KIND_STATEFUL - FABRIC_SERVICE_KIND_INVALID] = "FABRIC_SERVICE_KIND_STATEFUL",
+[FABRIC_SERVICE_KIND_SELF_RECONFIGURING - FABRIC_SERVICE_KIND_INVALID] = "FABRIC_SERVICE_KIND_SELF_RECONFIGURING",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_KIND,_ToString)(FABRIC_SERVICE_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_KIND, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_KIND, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_KIND_SELF_RECONFIGURING , "FABRIC_SERVICE_KIND_SELF_RECONFIGURING" },
+{ FABRIC_SERVICE_KIND_INVALID , "FABRIC_SERVICE_KIND_INVALID" },
+{ FABRIC_SERVICE_KIND_STATEFUL , "FABRIC_SERVICE_KIND_STATEFUL" },
+{ FABRIC_SERVICE_KIND_STATELESS , "FABRIC_SERVICE_KIND_STATELESS" },
+};
+static const int32_t FABRIC_SERVICE_KIND_Seeds[] ={
+-1, -2, -3, -4,
+};
+int MU_C2(FABRIC_SERVICE_KIND, _FromString)(const char* enumAsString, FABRIC_SERVICE_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_KIND, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_KIND, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_PARTITION_KIND_Strings[FABRIC_SERVICE_PARTITION_KIND_NAMED - FABRIC_SERVICE_PARTITION_KIND_INVALID + 1] ={
+[FABRIC_SERVICE_PARTITION_KIND_INVALID - FABRIC_SERVICE_PARTITION_KIND_INVALID] = "FABRIC_SERVICE_PARTITION_KIND_INVALID",
+[FABRIC_SERVICE_PARTITION_KIND_SINGLETON - FABRIC_SERVICE_PARTITION_KIND_INVALID] = "FABRIC_SERVICE_PARTITION_KIND_SINGLETON",
+[FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE - FABRIC_SERVICE_PARTITION_KIND_INVALID] = "FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE",
+[FABRIC_SERVICE_PARTITION_KIND_NAMED - FABRIC_SERVICE_PARTITION_KIND_INVALID] = "FABRIC_SERVICE_PARTITION_KIND_NAMED",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_PARTITION_KIND,_ToString)(FABRIC_SERVICE_PARTITION_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_PARTITION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_PARTITION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_PARTITION_KIND_INVALID , "FABRIC_SERVICE_PARTITION_KIND_INVALID" },
+{ FABRIC_SERVICE_PARTITION_KIND_NAMED , "FABRIC_SERVICE_PARTITION_KIND_NAMED" },
+{ FABRIC_SERVICE_PARTITION_KIND_SINGLETON , "FABRIC_SERVICE_PARTITION_KIND_SINGLETON" },
+{ FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE , "FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE" },
+};
+static const int32_t FABRIC_SERVICE_PARTITION_KIND_Seeds[] ={
+0, 1, 0, -1,
+};
+int MU_C2(FABRIC_SERVICE_PARTITION_KIND, _FromString)(const char* enumAsString, FABRIC_SERVICE_PARTITION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_PARTITION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_PARTITION_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_PARTITION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_PARTITION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_PARTITION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_PARTITION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_PARTITION_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_QUERY_SERVICE_PARTITION_STATUS_Strings[FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLED - FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID + 1] ={
+[FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID - FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID",
+[FABRIC_QUERY_SERVICE_PARTITION_STATUS_READY - FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_PARTITION_STATUS_READY",
+[FABRIC_QUERY_SERVICE_PARTITION_STATUS_NOT_READY - FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_PARTITION_STATUS_NOT_READY",
+[FABRIC_QUERY_SERVICE_PARTITION_STATUS_IN_QUORUM_LOSS - FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_PARTITION_STATUS_IN_QUORUM_LOSS",
+[FABRIC_QUERY_SERVICE_PARTITION_STATUS_RECONFIGURING - FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_PARTITION_STATUS_RECONFIGURING",
+[FABRIC_QUERY_SERVICE_PARTITION_STATUS_DELETING - FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_PARTITION_STATUS_DELETING",
+[FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLING - FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLING",
+[FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLED - FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLED",
+};
+const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_PARTITION_STATUS,_ToString)(FABRIC_QUERY_SERVICE_PARTITION_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Strings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Strings)[0])) && (MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_PARTITION_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_NOT_READY , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_NOT_READY" },
+{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID" },
+{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_RECONFIGURING , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_RECONFIGURING" },
+{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_DELETING , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_DELETING" },
+{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_IN_QUORUM_LOSS , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_IN_QUORUM_LOSS" },
+{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLED , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLED" },
+{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLING , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLING" },
+{ FABRIC_QUERY_SERVICE_PARTITION_STATUS_READY , "FABRIC_QUERY_SERVICE_PARTITION_STATUS_READY" },
+};
+static const int32_t FABRIC_QUERY_SERVICE_PARTITION_STATUS_Seeds[] ={
+3, 0, 0, 0, 9, -3, 0, -8,
+};
+int MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_PARTITION_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_PARTITION_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_PARTITION_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_PARTITION_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_PARTITION_STATUS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_QUERY_SERVICE_REPLICA_STATUS_Strings[FABRIC_QUERY_SERVICE_REPLICA_STATUS_COMPLETED - FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID + 1] ={
+[FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID - FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID",
+[FABRIC_QUERY_SERVICE_REPLICA_STATUS_INBUILD - FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_REPLICA_STATUS_INBUILD",
+[FABRIC_QUERY_SERVICE_REPLICA_STATUS_STANDBY - FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_REPLICA_STATUS_STANDBY",
+[FABRIC_QUERY_SERVICE_REPLICA_STATUS_READY - FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_REPLICA_STATUS_READY",
+[FABRIC_QUERY_SERVICE_REPLICA_STATUS_DOWN - FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_REPLICA_STATUS_DOWN",
+[FABRIC_QUERY_SERVICE_REPLICA_STATUS_DROPPED - FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_REPLICA_STATUS_DROPPED",
+[FABRIC_QUERY_SERVICE_REPLICA_STATUS_COMPLETED - FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID] = "FABRIC_QUERY_SERVICE_REPLICA_STATUS_COMPLETED",
+};
+const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_REPLICA_STATUS,_ToString)(FABRIC_QUERY_SERVICE_REPLICA_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Strings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Strings)[0])) && (MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_REPLICA_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_COMPLETED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_COMPLETED" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_DROPPED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_DROPPED" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_READY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_READY" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_DOWN , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_DOWN" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_INBUILD , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_INBUILD" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_STANDBY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_STANDBY" },
+};
+static const int32_t FABRIC_QUERY_SERVICE_REPLICA_STATUS_Seeds[] ={
+1, -4, 15, 0, 0, 0, 0,
+};
+int MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_REPLICA_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_REPLICA_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_REPLICA_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_REPLICA_STATUS)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DEFAULT , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DEFAULT" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_INBUILD , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_INBUILD" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_STANDBY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_STANDBY" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_READY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_READY" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DOWN , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DOWN" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DROPPED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DROPPED" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_COMPLETED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_COMPLETED" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_ALL , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_ALL" },
+};
+const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER,_ToString)(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DOWN , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DOWN" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DEFAULT , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DEFAULT" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_COMPLETED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_COMPLETED" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_READY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_READY" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_STANDBY , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_STANDBY" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DROPPED , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DROPPED" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_INBUILD , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_INBUILD" },
+{ FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_ALL , "FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_ALL" },
+};
+static const int32_t FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_Seeds[] ={
+1, 2, -2, -3, -5, 0, 0, -8,
+};
+int MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_OPERATION_NAME_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_INVALID , "FABRIC_QUERY_SERVICE_OPERATION_NAME_INVALID" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_NONE , "FABRIC_QUERY_SERVICE_OPERATION_NAME_NONE" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_OPEN , "FABRIC_QUERY_SERVICE_OPERATION_NAME_OPEN" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_CHANGEROLE , "FABRIC_QUERY_SERVICE_OPERATION_NAME_CHANGEROLE" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_CLOSE , "FABRIC_QUERY_SERVICE_OPERATION_NAME_CLOSE" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_ABORT , "FABRIC_QUERY_SERVICE_OPERATION_NAME_ABORT" },
+};
+const char* MU_C3(MU_,FABRIC_QUERY_SERVICE_OPERATION_NAME,_ToString)(FABRIC_QUERY_SERVICE_OPERATION_NAME value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_SERVICE_OPERATION_NAME_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_OPEN , "FABRIC_QUERY_SERVICE_OPERATION_NAME_OPEN" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_CHANGEROLE , "FABRIC_QUERY_SERVICE_OPERATION_NAME_CHANGEROLE" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_CLOSE , "FABRIC_QUERY_SERVICE_OPERATION_NAME_CLOSE" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_NONE , "FABRIC_QUERY_SERVICE_OPERATION_NAME_NONE" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_ABORT , "FABRIC_QUERY_SERVICE_OPERATION_NAME_ABORT" },
+{ FABRIC_QUERY_SERVICE_OPERATION_NAME_INVALID , "FABRIC_QUERY_SERVICE_OPERATION_NAME_INVALID" },
+};
+static const int32_t FABRIC_QUERY_SERVICE_OPERATION_NAME_Seeds[] ={
+0, 0, 1, 4, 4, 0,
+};
+int MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _FromString)(const char* enumAsString, FABRIC_QUERY_SERVICE_OPERATION_NAME* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_OPERATION_NAME)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_SERVICE_OPERATION_NAME* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _Seeds), sizeof(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_SERVICE_OPERATION_NAME, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_SERVICE_OPERATION_NAME)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_INVALID , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_INVALID" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_NONE , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_NONE" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_OPEN , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_OPEN" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CHANGEROLE , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CHANGEROLE" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_UPDATEEPOCH , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_UPDATEEPOCH" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CLOSE , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CLOSE" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ABORT , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ABORT" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ONDATALOSS , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ONDATALOSS" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_WAITFORCATCHUP , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_WAITFORCATCHUP" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_BUILD , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_BUILD" },
+};
+const char* MU_C3(MU_,FABRIC_QUERY_REPLICATOR_OPERATION_NAME,_ToString)(FABRIC_QUERY_REPLICATOR_OPERATION_NAME value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_QUERY_REPLICATOR_OPERATION_NAME_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_INVALID , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_INVALID" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ONDATALOSS , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ONDATALOSS" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ABORT , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ABORT" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_NONE , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_NONE" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_UPDATEEPOCH , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_UPDATEEPOCH" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_WAITFORCATCHUP , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_WAITFORCATCHUP" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_BUILD , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_BUILD" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_OPEN , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_OPEN" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CLOSE , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CLOSE" },
+{ FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CHANGEROLE , "FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CHANGEROLE" },
+};
+static const int32_t FABRIC_QUERY_REPLICATOR_OPERATION_NAME_Seeds[] ={
+0, 0, 3, 0, -3, -5, 0, -7, 1, 1,
+};
+int MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _FromString)(const char* enumAsString, FABRIC_QUERY_REPLICATOR_OPERATION_NAME* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _Seeds), sizeof(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_REPLICATOR_OPERATION_NAME)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUERY_REPLICATOR_OPERATION_NAME* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _Seeds), sizeof(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _Seeds))/sizeof(MU_C2(FABRIC_QUERY_REPLICATOR_OPERATION_NAME, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUERY_REPLICATOR_OPERATION_NAME)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_Strings[FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_CONTAINERHOST - FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID + 1] ={
+[FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID - FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID] = "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID",
+[FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_NONE - FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID] = "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_NONE",
+[FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_EXEHOST - FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID] = "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_EXEHOST",
+[FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_DLLHOST - FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID] = "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_DLLHOST",
+[FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_CONTAINERHOST - FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID] = "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_CONTAINERHOST",
+};
+const char* MU_C3(MU_,FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND,_ToString)(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Strings))/sizeof(MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Strings)[0])) && (MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_NONE , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_NONE" },
+{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_CONTAINERHOST , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_CONTAINERHOST" },
+{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID" },
+{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_EXEHOST , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_EXEHOST" },
+{ FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_DLLHOST , "FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_DLLHOST" },
+};
+static const int32_t FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_Seeds[] ={
+-2, -3, -4, 0, 1,
+};
+int MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _FromString)(const char* enumAsString, FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Seeds), sizeof(MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Seeds))/sizeof(MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Seeds), sizeof(MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Seeds))/sizeof(MU_C2(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_EXEHOST_WORKING_FOLDER_Strings[FABRIC_EXEHOST_WORKING_FOLDER_CODE_BASE - FABRIC_EXEHOST_WORKING_FOLDER_INVALID + 1] ={
+[FABRIC_EXEHOST_WORKING_FOLDER_INVALID - FABRIC_EXEHOST_WORKING_FOLDER_INVALID] = "FABRIC_EXEHOST_WORKING_FOLDER_INVALID",
+[FABRIC_EXEHOST_WORKING_FOLDER_WORK - FABRIC_EXEHOST_WORKING_FOLDER_INVALID] = "FABRIC_EXEHOST_WORKING_FOLDER_WORK",
+[FABRIC_EXEHOST_WORKING_FOLDER_CODE_PACKAGE - FABRIC_EXEHOST_WORKING_FOLDER_INVALID] = "FABRIC_EXEHOST_WORKING_FOLDER_CODE_PACKAGE",
+[FABRIC_EXEHOST_WORKING_FOLDER_CODE_BASE - FABRIC_EXEHOST_WORKING_FOLDER_INVALID] = "FABRIC_EXEHOST_WORKING_FOLDER_CODE_BASE",
+};
+const char* MU_C3(MU_,FABRIC_EXEHOST_WORKING_FOLDER,_ToString)(FABRIC_EXEHOST_WORKING_FOLDER value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_EXEHOST_WORKING_FOLDER_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Strings))/sizeof(MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Strings)[0])) && (MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_EXEHOST_WORKING_FOLDER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_EXEHOST_WORKING_FOLDER_WORK , "FABRIC_EXEHOST_WORKING_FOLDER_WORK" },
+{ FABRIC_EXEHOST_WORKING_FOLDER_CODE_PACKAGE , "FABRIC_EXEHOST_WORKING_FOLDER_CODE_PACKAGE" },
+{ FABRIC_EXEHOST_WORKING_FOLDER_CODE_BASE , "FABRIC_EXEHOST_WORKING_FOLDER_CODE_BASE" },
+{ FABRIC_EXEHOST_WORKING_FOLDER_INVALID , "FABRIC_EXEHOST_WORKING_FOLDER_INVALID" },
+};
+static const int32_t FABRIC_EXEHOST_WORKING_FOLDER_Seeds[] ={
+-2, 1, 0, -3,
+};
+int MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _FromString)(const char* enumAsString, FABRIC_EXEHOST_WORKING_FOLDER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Seeds), sizeof(MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Seeds))/sizeof(MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_EXEHOST_WORKING_FOLDER)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_EXEHOST_WORKING_FOLDER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Seeds), sizeof(MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Seeds))/sizeof(MU_C2(FABRIC_EXEHOST_WORKING_FOLDER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_EXEHOST_WORKING_FOLDER)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_DLLHOST_HOSTED_DLL_KIND_Strings[FABRIC_DLLHOST_HOSTED_DLL_KIND_MANAGED - FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID + 1] ={
+[FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID - FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID] = "FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID",
+[FABRIC_DLLHOST_HOSTED_DLL_KIND_UNMANAGED - FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID] = "FABRIC_DLLHOST_HOSTED_DLL_KIND_UNMANAGED",
+[FABRIC_DLLHOST_HOSTED_DLL_KIND_MANAGED - FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID] = "FABRIC_DLLHOST_HOSTED_DLL_KIND_MANAGED",
+};
+const char* MU_C3(MU_,FABRIC_DLLHOST_HOSTED_DLL_KIND,_ToString)(FABRIC_DLLHOST_HOSTED_DLL_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Strings))/sizeof(MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Strings)[0])) && (MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_DLLHOST_HOSTED_DLL_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_DLLHOST_HOSTED_DLL_KIND_MANAGED , "FABRIC_DLLHOST_HOSTED_DLL_KIND_MANAGED" },
+{ FABRIC_DLLHOST_HOSTED_DLL_KIND_UNMANAGED , "FABRIC_DLLHOST_HOSTED_DLL_KIND_UNMANAGED" },
+{ FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID , "FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID" },
+};
+static const int32_t FABRIC_DLLHOST_HOSTED_DLL_KIND_Seeds[] ={
+2, 0, -2,
+};
+int MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _FromString)(const char* enumAsString, FABRIC_DLLHOST_HOSTED_DLL_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Seeds), sizeof(MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Seeds))/sizeof(MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DLLHOST_HOSTED_DLL_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DLLHOST_HOSTED_DLL_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Seeds), sizeof(MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Seeds))/sizeof(MU_C2(FABRIC_DLLHOST_HOSTED_DLL_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DLLHOST_HOSTED_DLL_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_DLLHOST_ISOLATION_POLICY_Strings[FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_PROCESS - FABRIC_DLLHOST_ISOLATION_POLICY_INVALID + 1] ={
+[FABRIC_DLLHOST_ISOLATION_POLICY_INVALID - FABRIC_DLLHOST_ISOLATION_POLICY_INVALID] = "FABRIC_DLLHOST_ISOLATION_POLICY_INVALID",
+[FABRIC_DLLHOST_ISOLATION_POLICY_SHARED_DOMAIN - FABRIC_DLLHOST_ISOLATION_POLICY_INVALID] = "FABRIC_DLLHOST_ISOLATION_POLICY_SHARED_DOMAIN",
+[FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_DOMAIN - FABRIC_DLLHOST_ISOLATION_POLICY_INVALID] = "FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_DOMAIN",
+[FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_PROCESS - FABRIC_DLLHOST_ISOLATION_POLICY_INVALID] = "FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_PROCESS",
+};
+const char* MU_C3(MU_,FABRIC_DLLHOST_ISOLATION_POLICY,_ToString)(FABRIC_DLLHOST_ISOLATION_POLICY value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_DLLHOST_ISOLATION_POLICY_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Strings))/sizeof(MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Strings)[0])) && (MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_DLLHOST_ISOLATION_POLICY_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_DLLHOST_ISOLATION_POLICY_SHARED_DOMAIN , "FABRIC_DLLHOST_ISOLATION_POLICY_SHARED_DOMAIN" },
+{ FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_DOMAIN , "FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_DOMAIN" },
+{ FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_PROCESS , "FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_PROCESS" },
+{ FABRIC_DLLHOST_ISOLATION_POLICY_INVALID , "FABRIC_DLLHOST_ISOLATION_POLICY_INVALID" },
+};
+static const int32_t FABRIC_DLLHOST_ISOLATION_POLICY_Seeds[] ={
+4, 0, 0, 0,
+};
+int MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _FromString)(const char* enumAsString, FABRIC_DLLHOST_ISOLATION_POLICY* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Seeds), sizeof(MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Seeds))/sizeof(MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DLLHOST_ISOLATION_POLICY)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DLLHOST_ISOLATION_POLICY* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Seeds), sizeof(MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Seeds))/sizeof(MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DLLHOST_ISOLATION_POLICY)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SECURITY_CREDENTIAL_KIND_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_SECURITY_CREDENTIAL_KIND_NONE , "FABRIC_SECURITY_CREDENTIAL_KIND_NONE" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_X509 , "FABRIC_SECURITY_CREDENTIAL_KIND_X509" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_WINDOWS , "FABRIC_SECURITY_CREDENTIAL_KIND_WINDOWS" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_CLAIMS , "FABRIC_SECURITY_CREDENTIAL_KIND_CLAIMS" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_X509_2 , "FABRIC_SECURITY_CREDENTIAL_KIND_X509_2" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_INVALID , "FABRIC_SECURITY_CREDENTIAL_KIND_INVALID" },
+};
+const char* MU_C3(MU_,FABRIC_SECURITY_CREDENTIAL_KIND,_ToString)(FABRIC_SECURITY_CREDENTIAL_KIND value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SECURITY_CREDENTIAL_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SECURITY_CREDENTIAL_KIND_X509_2 , "FABRIC_SECURITY_CREDENTIAL_KIND_X509_2" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_WINDOWS , "FABRIC_SECURITY_CREDENTIAL_KIND_WINDOWS" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_INVALID , "FABRIC_SECURITY_CREDENTIAL_KIND_INVALID" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_NONE , "FABRIC_SECURITY_CREDENTIAL_KIND_NONE" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_CLAIMS , "FABRIC_SECURITY_CREDENTIAL_KIND_CLAIMS" },
+{ FABRIC_SECURITY_CREDENTIAL_KIND_X509 , "FABRIC_SECURITY_CREDENTIAL_KIND_X509" },
+};
+static const int32_t FABRIC_SECURITY_CREDENTIAL_KIND_Seeds[] ={
+-2, 0, -3, 2, 2, 0,
+};
+int MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _FromString)(const char* enumAsString, FABRIC_SECURITY_CREDENTIAL_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _Seeds), sizeof(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SECURITY_CREDENTIAL_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SECURITY_CREDENTIAL_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _Seeds), sizeof(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SECURITY_CREDENTIAL_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_Strings[FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_AAD - FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE + 1] ={
+[FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE - FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE] = "FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE",
+[FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_AAD - FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE] = "FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_AAD",
+};
+const char* MU_C3(MU_,FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND,_ToString)(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Strings))/sizeof(MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Strings)[0])) && (MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE , "FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE" },
+{ FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_AAD , "FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_AAD" },
+};
+static const int32_t FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _FromString)(const char* enumAsString, FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Seeds), sizeof(MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Seeds))/sizeof(MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Seeds), sizeof(MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Seeds))/sizeof(MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_PROTECTION_LEVEL_Strings[FABRIC_PROTECTION_LEVEL_ENCRYPTANDSIGN - FABRIC_PROTECTION_LEVEL_NONE + 1] ={
+[FABRIC_PROTECTION_LEVEL_NONE - FABRIC_PROTECTION_LEVEL_NONE] = "FABRIC_PROTECTION_LEVEL_NONE",
+[FABRIC_PROTECTION_LEVEL_SIGN - FABRIC_PROTECTION_LEVEL_NONE] = "FABRIC_PROTECTION_LEVEL_SIGN",
+[FABRIC_PROTECTION_LEVEL_ENCRYPTANDSIGN - FABRIC_PROTECTION_LEVEL_NONE] = "FABRIC_PROTECTION_LEVEL_ENCRYPTANDSIGN",
+};
+const char* MU_C3(MU_,FABRIC_PROTECTION_LEVEL,_ToString)(FABRIC_PROTECTION_LEVEL value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_PROTECTION_LEVEL_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_PROTECTION_LEVEL, _Strings))/sizeof(MU_C2(FABRIC_PROTECTION_LEVEL, _Strings)[0])) && (MU_C2(FABRIC_PROTECTION_LEVEL, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_PROTECTION_LEVEL, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_PROTECTION_LEVEL_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PROTECTION_LEVEL_NONE , "FABRIC_PROTECTION_LEVEL_NONE" },
+{ FABRIC_PROTECTION_LEVEL_SIGN , "FABRIC_PROTECTION_LEVEL_SIGN" },
+{ FABRIC_PROTECTION_LEVEL_ENCRYPTANDSIGN , "FABRIC_PROTECTION_LEVEL_ENCRYPTANDSIGN" },
+};
+static const int32_t FABRIC_PROTECTION_LEVEL_Seeds[] ={
+2, 0, -2,
+};
+int MU_C2(FABRIC_PROTECTION_LEVEL, _FromString)(const char* enumAsString, FABRIC_PROTECTION_LEVEL* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PROTECTION_LEVEL, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PROTECTION_LEVEL, _Seeds), sizeof(MU_C2(FABRIC_PROTECTION_LEVEL, _Seeds))/sizeof(MU_C2(FABRIC_PROTECTION_LEVEL, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PROTECTION_LEVEL)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_PROTECTION_LEVEL, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PROTECTION_LEVEL* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PROTECTION_LEVEL, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PROTECTION_LEVEL, _Seeds), sizeof(MU_C2(FABRIC_PROTECTION_LEVEL, _Seeds))/sizeof(MU_C2(FABRIC_PROTECTION_LEVEL, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PROTECTION_LEVEL)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_X509_STORE_LOCATION_Strings[FABRIC_X509_STORE_LOCATION_LOCALMACHINE - FABRIC_X509_STORE_LOCATION_INVALID + 1] ={
+[FABRIC_X509_STORE_LOCATION_INVALID - FABRIC_X509_STORE_LOCATION_INVALID] = "FABRIC_X509_STORE_LOCATION_INVALID",
+[FABRIC_X509_STORE_LOCATION_CURRENTUSER - FABRIC_X509_STORE_LOCATION_INVALID] = "FABRIC_X509_STORE_LOCATION_CURRENTUSER",
+[FABRIC_X509_STORE_LOCATION_LOCALMACHINE - FABRIC_X509_STORE_LOCATION_INVALID] = "FABRIC_X509_STORE_LOCATION_LOCALMACHINE",
+};
+const char* MU_C3(MU_,FABRIC_X509_STORE_LOCATION,_ToString)(FABRIC_X509_STORE_LOCATION value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_X509_STORE_LOCATION_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_X509_STORE_LOCATION, _Strings))/sizeof(MU_C2(FABRIC_X509_STORE_LOCATION, _Strings)[0])) && (MU_C2(FABRIC_X509_STORE_LOCATION, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_X509_STORE_LOCATION, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_X509_STORE_LOCATION_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_X509_STORE_LOCATION_LOCALMACHINE , "FABRIC_X509_STORE_LOCATION_LOCALMACHINE" },
+{ FABRIC_X509_STORE_LOCATION_INVALID , "FABRIC_X509_STORE_LOCATION_INVALID" },
+{ FABRIC_X509_STORE_LOCATION_CURRENTUSER , "FABRIC_X509_STORE_LOCATION_CURRENTUSER" },
+};
+static const int32_t FABRIC_X509_STORE_LOCATION_Seeds[] ={
+-1, -2, -3,
+};
+int MU_C2(FABRIC_X509_STORE_LOCATION, _FromString)(const char* enumAsString, FABRIC_X509_STORE_LOCATION* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_X509_STORE_LOCATION, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_X509_STORE_LOCATION, _Seeds), sizeof(MU_C2(FABRIC_X509_STORE_LOCATION, _Seeds))/sizeof(MU_C2(FABRIC_X509_STORE_LOCATION, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_X509_STORE_LOCATION)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_X509_STORE_LOCATION, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_X509_STORE_LOCATION* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_X509_STORE_LOCATION, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_X509_STORE_LOCATION, _Seeds), sizeof(MU_C2(FABRIC_X509_STORE_LOCATION, _Seeds))/sizeof(MU_C2(FABRIC_X509_STORE_LOCATION, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_X509_STORE_LOCATION)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_X509_FIND_TYPE_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_X509_FIND_TYPE_FINDBYTHUMBPRINT , "FABRIC_X509_FIND_TYPE_FINDBYTHUMBPRINT" },
+{ FABRIC_X509_FIND_TYPE_FINDBYSUBJECTNAME , "FABRIC_X509_FIND_TYPE_FINDBYSUBJECTNAME" },
+{ FABRIC_X509_FIND_TYPE_FINDBYEXTENSION , "FABRIC_X509_FIND_TYPE_FINDBYEXTENSION" },
+};
+const char* MU_C3(MU_,FABRIC_X509_FIND_TYPE,_ToString)(FABRIC_X509_FIND_TYPE value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_X509_FIND_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_X509_FIND_TYPE, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_X509_FIND_TYPE, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_X509_FIND_TYPE, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_X509_FIND_TYPE, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_X509_FIND_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_X509_FIND_TYPE_FINDBYTHUMBPRINT , "FABRIC_X509_FIND_TYPE_FINDBYTHUMBPRINT" },
+{ FABRIC_X509_FIND_TYPE_FINDBYEXTENSION , "FABRIC_X509_FIND_TYPE_FINDBYEXTENSION" },
+{ FABRIC_X509_FIND_TYPE_FINDBYSUBJECTNAME , "FABRIC_X509_FIND_TYPE_FINDBYSUBJECTNAME" },
+};
+static const int32_t FABRIC_X509_FIND_TYPE_Seeds[] ={
+0, -1, 1,
+};
+int MU_C2(FABRIC_X509_FIND_TYPE, _FromString)(const char* enumAsString, FABRIC_X509_FIND_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_X509_FIND_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_X509_FIND_TYPE, _Seeds), sizeof(MU_C2(FABRIC_X509_FIND_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_X509_FIND_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_X509_FIND_TYPE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_X509_FIND_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_X509_FIND_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_X509_FIND_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_X509_FIND_TYPE, _Seeds), sizeof(MU_C2(FABRIC_X509_FIND_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_X509_FIND_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_X509_FIND_TYPE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_LOAD_METRIC_WEIGHT_Strings[FABRIC_SERVICE_LOAD_METRIC_WEIGHT_HIGH - FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO + 1] ={
+[FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO - FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO] = "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO",
+[FABRIC_SERVICE_LOAD_METRIC_WEIGHT_LOW - FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO] = "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_LOW",
+[FABRIC_SERVICE_LOAD_METRIC_WEIGHT_MEDIUM - FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO] = "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_MEDIUM",
+[FABRIC_SERVICE_LOAD_METRIC_WEIGHT_HIGH - FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO] = "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_HIGH",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_LOAD_METRIC_WEIGHT,_ToString)(FABRIC_SERVICE_LOAD_METRIC_WEIGHT value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_LOAD_METRIC_WEIGHT_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_LOAD_METRIC_WEIGHT_LOW , "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_LOW" },
+{ FABRIC_SERVICE_LOAD_METRIC_WEIGHT_MEDIUM , "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_MEDIUM" },
+{ FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO , "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO" },
+{ FABRIC_SERVICE_LOAD_METRIC_WEIGHT_HIGH , "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_HIGH" },
+};
+static const int32_t FABRIC_SERVICE_LOAD_METRIC_WEIGHT_Seeds[] ={
+0, 0, 3, -4,
+};
+int MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _FromString)(const char* enumAsString, FABRIC_SERVICE_LOAD_METRIC_WEIGHT* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_LOAD_METRIC_WEIGHT)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_LOAD_METRIC_WEIGHT* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_LOAD_METRIC_WEIGHT)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_MOVE_COST_Strings[FABRIC_MOVE_COST_VERYHIGH - FABRIC_MOVE_COST_ZERO + 1] ={
+[FABRIC_MOVE_COST_ZERO - FABRIC_MOVE_COST_ZERO] = "FABRIC_MOVE_COST_ZERO",
+[FABRIC_MOVE_COST_LOW - FABRIC_MOVE_COST_ZERO] = "FABRIC_MOVE_COST_LOW",
+[FABRIC_MOVE_COST_MEDIUM - FABRIC_MOVE_COST_ZERO] = "FABRIC_MOVE_COST_MEDIUM",
+[FABRIC_MOVE_COST_HIGH - FABRIC_MOVE_COST_ZERO] = "FABRIC_MOVE_COST_HIGH",
+[FABRIC_MOVE_COST_VERYHIGH - FABRIC_MOVE_COST_ZERO] = "FABRIC_MOVE_COST_VERYHIGH",
+};
+const char* MU_C3(MU_,FABRIC_MOVE_COST,_ToString)(FABRIC_MOVE_COST value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_MOVE_COST_ZERO;
+    if ((index < sizeof(MU_C2(FABRIC_MOVE_COST, _Strings))/sizeof(MU_C2(FABRIC_MOVE_COST, _Strings)[0])) && (MU_C2(FABRIC_MOVE_COST, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_MOVE_COST, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_MOVE_COST_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_MOVE_COST_VERYHIGH , "FABRIC_MOVE_COST_VERYHIGH" },
+{ FABRIC_MOVE_COST_HIGH , "FABRIC_MOVE_COST_HIGH" },
+{ FABRIC_MOVE_COST_MEDIUM , "FABRIC_MOVE_COST_MEDIUM" },
+{ FABRIC_MOVE_COST_LOW , "FABRIC_MOVE_COST_LOW" },
+{ FABRIC_MOVE_COST_ZERO , "FABRIC_MOVE_COST_ZERO" },
+};
+static const int32_t FABRIC_MOVE_COST_Seeds[] ={
+0, 0, 1, -3, 2,
+};
+int MU_C2(FABRIC_MOVE_COST, _FromString)(const char* enumAsString, FABRIC_MOVE_COST* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_COST, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_COST, _Seeds), sizeof(MU_C2(FABRIC_MOVE_COST, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_COST, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_COST)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_MOVE_COST, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_COST* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_COST, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_COST, _Seeds), sizeof(MU_C2(FABRIC_MOVE_COST, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_COST, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_COST)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_Strings[FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_EXCLUSIVE_PROCESS - FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS + 1] ={
+[FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS - FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS] = "FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS",
+[FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_EXCLUSIVE_PROCESS - FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS] = "FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_EXCLUSIVE_PROCESS",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE,_ToString)(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_EXCLUSIVE_PROCESS , "FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_EXCLUSIVE_PROCESS" },
+{ FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS , "FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS" },
+};
+static const int32_t FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _FromString)(const char* enumAsString, FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_CORRELATION_SCHEME_Strings[FABRIC_SERVICE_CORRELATION_SCHEME_NONALIGNED_AFFINITY - FABRIC_SERVICE_CORRELATION_SCHEME_INVALID + 1] ={
+[FABRIC_SERVICE_CORRELATION_SCHEME_INVALID - FABRIC_SERVICE_CORRELATION_SCHEME_INVALID] = "FABRIC_SERVICE_CORRELATION_SCHEME_INVALID",
+[FABRIC_SERVICE_CORRELATION_SCHEME_AFFINITY - FABRIC_SERVICE_CORRELATION_SCHEME_INVALID] = "FABRIC_SERVICE_CORRELATION_SCHEME_AFFINITY",
+[FABRIC_SERVICE_CORRELATION_SCHEME_ALIGNED_AFFINITY - FABRIC_SERVICE_CORRELATION_SCHEME_INVALID] = "FABRIC_SERVICE_CORRELATION_SCHEME_ALIGNED_AFFINITY",
+[FABRIC_SERVICE_CORRELATION_SCHEME_NONALIGNED_AFFINITY - FABRIC_SERVICE_CORRELATION_SCHEME_INVALID] = "FABRIC_SERVICE_CORRELATION_SCHEME_NONALIGNED_AFFINITY",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_CORRELATION_SCHEME,_ToString)(FABRIC_SERVICE_CORRELATION_SCHEME value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_CORRELATION_SCHEME_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_CORRELATION_SCHEME_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_CORRELATION_SCHEME_INVALID , "FABRIC_SERVICE_CORRELATION_SCHEME_INVALID" },
+{ FABRIC_SERVICE_CORRELATION_SCHEME_AFFINITY , "FABRIC_SERVICE_CORRELATION_SCHEME_AFFINITY" },
+{ FABRIC_SERVICE_CORRELATION_SCHEME_NONALIGNED_AFFINITY , "FABRIC_SERVICE_CORRELATION_SCHEME_NONALIGNED_AFFINITY" },
+{ FABRIC_SERVICE_CORRELATION_SCHEME_ALIGNED_AFFINITY , "FABRIC_SERVICE_CORRELATION_SCHEME_ALIGNED_AFFINITY" },
+};
+static const int32_t FABRIC_SERVICE_CORRELATION_SCHEME_Seeds[] ={
+0, 1, 0, 11,
+};
+int MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _FromString)(const char* enumAsString, FABRIC_SERVICE_CORRELATION_SCHEME* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_CORRELATION_SCHEME)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_CORRELATION_SCHEME* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_CORRELATION_SCHEME)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_PARTITION_ACCESS_STATUS_Strings[FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NO_WRITE_QUORUM - FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID + 1] ={
+[FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID - FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID] = "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID",
+[FABRIC_SERVICE_PARTITION_ACCESS_STATUS_GRANTED - FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID] = "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_GRANTED",
+[FABRIC_SERVICE_PARTITION_ACCESS_STATUS_RECONFIGURATION_PENDING - FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID] = "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_RECONFIGURATION_PENDING",
+[FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NOT_PRIMARY - FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID] = "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NOT_PRIMARY",
+[FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NO_WRITE_QUORUM - FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID] = "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NO_WRITE_QUORUM",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_PARTITION_ACCESS_STATUS,_ToString)(FABRIC_SERVICE_PARTITION_ACCESS_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_PARTITION_ACCESS_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_RECONFIGURATION_PENDING , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_RECONFIGURATION_PENDING" },
+{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_GRANTED , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_GRANTED" },
+{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID" },
+{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NO_WRITE_QUORUM , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NO_WRITE_QUORUM" },
+{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NOT_PRIMARY , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NOT_PRIMARY" },
+};
+static const int32_t FABRIC_SERVICE_PARTITION_ACCESS_STATUS_Seeds[] ={
+-1, -3, 0, -5, 2,
+};
+int MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _FromString)(const char* enumAsString, FABRIC_SERVICE_PARTITION_ACCESS_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_PARTITION_ACCESS_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_PARTITION_ACCESS_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_PARTITION_ACCESS_STATUS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPLICA_ROLE_Strings[FABRIC_REPLICA_ROLE_PRIMARY_AUXILIARY - FABRIC_REPLICA_ROLE_UNKNOWN + 1] ={
+[FABRIC_REPLICA_ROLE_UNKNOWN - FABRIC_REPLICA_ROLE_UNKNOWN] = "FABRIC_REPLICA_ROLE_UNKNOWN",
+[FABRIC_REPLICA_ROLE_NONE - FABRIC_REPLICA_ROLE_UNKNOWN] = "FABRIC_REPLICA_ROLE_NONE",
+[FABRIC_REPLICA_ROLE_PRIMARY - FABRIC_REPLICA_ROLE_UNKNOWN] = "FABRIC_REPLICA_ROLE_PRIMARY",
+[FABRIC_REPLICA_ROLE_IDLE_SECONDARY - FABRIC_REPLICA_ROLE_UNKNOWN] = "FABRIC_REPLICA_ROLE_IDLE_SECONDARY",
+[FABRIC_REPLICA_ROLE_ACTIVE_SECONDARY - FABRIC_REPLICA_ROLE_UNKNOWN] = "FABRIC_REPLICA_ROLE_ACTIVE_SECONDARY",
+[FABRIC_REPLICA_ROLE_IDLE_AUXILIARY - FABRIC_REPLICA_ROLE_UNKNOWN] = "FABRIC_REPLICA_ROLE_IDLE_AUXILIARY",
+[FABRIC_REPLICA_ROLE_ACTIVE_AUXILIARY - FABRIC_REPLICA_ROLE_UNKNOWN] = "FABRIC_REPLICA_ROLE_ACTIVE_AUXILIARY",
+[FABRIC_REPLICA_ROLE_PRIMARY_AUXILIARY - FABRIC_REPLICA_ROLE_UNKNOWN] = "FABRIC_REPLICA_ROLE_PRIMARY_AUXILIARY",
+};
+const char* MU_C3(MU_,FABRIC_REPLICA_ROLE,_ToString)(FABRIC_REPLICA_ROLE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPLICA_ROLE_UNKNOWN;
+    if ((index < sizeof(MU_C2(FABRIC_REPLICA_ROLE, _Strings))/sizeof(MU_C2(FABRIC_REPLICA_ROLE, _Strings)[0])) && (MU_C2(FABRIC_REPLICA_ROLE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPLICA_ROLE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPLICA_ROLE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPLICA_ROLE_UNKNOWN , "FABRIC_REPLICA_ROLE_UNKNOWN" },
+{ FABRIC_REPLICA_ROLE_PRIMARY , "FABRIC_REPLICA_ROLE_PRIMARY" },
+{ FABRIC_REPLICA_ROLE_IDLE_SECONDARY , "FABRIC_REPLICA_ROLE_IDLE_SECONDARY" },
+{ FABRIC_REPLICA_ROLE_IDLE_AUXILIARY , "FABRIC_REPLICA_ROLE_IDLE_AUXILIARY" },
+{ FABRIC_REPLICA_ROLE_PRIMARY_AUXILIARY , "FABRIC_REPLICA_ROLE_PRIMARY_AUXILIARY" },
+{ FABRIC_REPLICA_ROLE_ACTIVE_AUXILIARY , "FABRIC_REPLICA_ROLE_ACTIVE_AUXILIARY" },
+{ FABRIC_REPLICA_ROLE_ACTIVE_SECONDARY , "FABRIC_REPLICA_ROLE_ACTIVE_SECONDARY" },
+{ FABRIC_REPLICA_ROLE_NONE , "FABRIC_REPLICA_ROLE_NONE" },
+};
+static const int32_t FABRIC_REPLICA_ROLE_Seeds[] ={
+0, 2, 0, 0, 1, 8, 5, 0,
+};
+int MU_C2(FABRIC_REPLICA_ROLE, _FromString)(const char* enumAsString, FABRIC_REPLICA_ROLE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICA_ROLE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICA_ROLE, _Seeds), sizeof(MU_C2(FABRIC_REPLICA_ROLE, _Seeds))/sizeof(MU_C2(FABRIC_REPLICA_ROLE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICA_ROLE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPLICA_ROLE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICA_ROLE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICA_ROLE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICA_ROLE, _Seeds), sizeof(MU_C2(FABRIC_REPLICA_ROLE, _Seeds))/sizeof(MU_C2(FABRIC_REPLICA_ROLE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICA_ROLE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPLICA_OPEN_MODE_Strings[FABRIC_REPLICA_OPEN_MODE_EXISTING - FABRIC_REPLICA_OPEN_MODE_INVALID + 1] ={
+[FABRIC_REPLICA_OPEN_MODE_INVALID - FABRIC_REPLICA_OPEN_MODE_INVALID] = "FABRIC_REPLICA_OPEN_MODE_INVALID",
+[FABRIC_REPLICA_OPEN_MODE_NEW - FABRIC_REPLICA_OPEN_MODE_INVALID] = "FABRIC_REPLICA_OPEN_MODE_NEW",
+[FABRIC_REPLICA_OPEN_MODE_EXISTING - FABRIC_REPLICA_OPEN_MODE_INVALID] = "FABRIC_REPLICA_OPEN_MODE_EXISTING",
+};
+const char* MU_C3(MU_,FABRIC_REPLICA_OPEN_MODE,_ToString)(FABRIC_REPLICA_OPEN_MODE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPLICA_OPEN_MODE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_REPLICA_OPEN_MODE, _Strings))/sizeof(MU_C2(FABRIC_REPLICA_OPEN_MODE, _Strings)[0])) && (MU_C2(FABRIC_REPLICA_OPEN_MODE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPLICA_OPEN_MODE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPLICA_OPEN_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPLICA_OPEN_MODE_EXISTING , "FABRIC_REPLICA_OPEN_MODE_EXISTING" },
+{ FABRIC_REPLICA_OPEN_MODE_NEW , "FABRIC_REPLICA_OPEN_MODE_NEW" },
+{ FABRIC_REPLICA_OPEN_MODE_INVALID , "FABRIC_REPLICA_OPEN_MODE_INVALID" },
+};
+static const int32_t FABRIC_REPLICA_OPEN_MODE_Seeds[] ={
+1, 0, -2,
+};
+int MU_C2(FABRIC_REPLICA_OPEN_MODE, _FromString)(const char* enumAsString, FABRIC_REPLICA_OPEN_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICA_OPEN_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICA_OPEN_MODE, _Seeds), sizeof(MU_C2(FABRIC_REPLICA_OPEN_MODE, _Seeds))/sizeof(MU_C2(FABRIC_REPLICA_OPEN_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICA_OPEN_MODE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPLICA_OPEN_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICA_OPEN_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICA_OPEN_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICA_OPEN_MODE, _Seeds), sizeof(MU_C2(FABRIC_REPLICA_OPEN_MODE, _Seeds))/sizeof(MU_C2(FABRIC_REPLICA_OPEN_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICA_OPEN_MODE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPLICA_STATUS_Strings[FABRIC_REPLICA_STATUS_UP - FABRIC_REPLICA_STATUS_INVALID + 1] ={
+[FABRIC_REPLICA_STATUS_INVALID - FABRIC_REPLICA_STATUS_INVALID] = "FABRIC_REPLICA_STATUS_INVALID",
+[FABRIC_REPLICA_STATUS_DOWN - FABRIC_REPLICA_STATUS_INVALID] = "FABRIC_REPLICA_STATUS_DOWN",
+[FABRIC_REPLICA_STATUS_UP - FABRIC_REPLICA_STATUS_INVALID] = "FABRIC_REPLICA_STATUS_UP",
+};
+const char* MU_C3(MU_,FABRIC_REPLICA_STATUS,_ToString)(FABRIC_REPLICA_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPLICA_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_REPLICA_STATUS, _Strings))/sizeof(MU_C2(FABRIC_REPLICA_STATUS, _Strings)[0])) && (MU_C2(FABRIC_REPLICA_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPLICA_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPLICA_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPLICA_STATUS_DOWN , "FABRIC_REPLICA_STATUS_DOWN" },
+{ FABRIC_REPLICA_STATUS_INVALID , "FABRIC_REPLICA_STATUS_INVALID" },
+{ FABRIC_REPLICA_STATUS_UP , "FABRIC_REPLICA_STATUS_UP" },
+};
+static const int32_t FABRIC_REPLICA_STATUS_Seeds[] ={
+-1, -2, -3,
+};
+int MU_C2(FABRIC_REPLICA_STATUS, _FromString)(const char* enumAsString, FABRIC_REPLICA_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICA_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICA_STATUS, _Seeds), sizeof(MU_C2(FABRIC_REPLICA_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_REPLICA_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICA_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPLICA_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICA_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICA_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICA_STATUS, _Seeds), sizeof(MU_C2(FABRIC_REPLICA_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_REPLICA_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICA_STATUS)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_OPERATION_TYPE_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_OPERATION_TYPE_INVALID , "FABRIC_OPERATION_TYPE_INVALID" },
+{ FABRIC_OPERATION_TYPE_NORMAL , "FABRIC_OPERATION_TYPE_NORMAL" },
+{ FABRIC_OPERATION_TYPE_END_OF_STREAM , "FABRIC_OPERATION_TYPE_END_OF_STREAM" },
+{ FABRIC_OPERATION_TYPE_CREATE_ATOMIC_GROUP , "FABRIC_OPERATION_TYPE_CREATE_ATOMIC_GROUP" },
+{ FABRIC_OPERATION_TYPE_ATOMIC_GROUP_OPERATION , "FABRIC_OPERATION_TYPE_ATOMIC_GROUP_OPERATION" },
+{ FABRIC_OPERATION_TYPE_COMMIT_ATOMIC_GROUP , "FABRIC_OPERATION_TYPE_COMMIT_ATOMIC_GROUP" },
+{ FABRIC_OPERATION_TYPE_ROLLBACK_ATOMIC_GROUP , "FABRIC_OPERATION_TYPE_ROLLBACK_ATOMIC_GROUP" },
+{ FABRIC_OPERATION_TYPE_HAS_ATOMIC_GROUP_MASK , "FABRIC_OPERATION_TYPE_HAS_ATOMIC_GROUP_MASK" },
+};
+const char* MU_C3(MU_,FABRIC_OPERATION_TYPE,_ToString)(FABRIC_OPERATION_TYPE value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_OPERATION_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_OPERATION_TYPE, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_OPERATION_TYPE, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_OPERATION_TYPE, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_OPERATION_TYPE, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_OPERATION_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_OPERATION_TYPE_COMMIT_ATOMIC_GROUP , "FABRIC_OPERATION_TYPE_COMMIT_ATOMIC_GROUP" },
+{ FABRIC_OPERATION_TYPE_CREATE_ATOMIC_GROUP , "FABRIC_OPERATION_TYPE_CREATE_ATOMIC_GROUP" },
+{ FABRIC_OPERATION_TYPE_ATOMIC_GROUP_OPERATION , "FABRIC_OPERATION_TYPE_ATOMIC_GROUP_OPERATION" },
+{ FABRIC_OPERATION_TYPE_HAS_ATOMIC_GROUP_MASK , "FABRIC_OPERATION_TYPE_HAS_ATOMIC_GROUP_MASK" },
+{ FABRIC_OPERATION_TYPE_ROLLBACK_ATOMIC_GROUP , "FABRIC_OPERATION_TYPE_ROLLBACK_ATOMIC_GROUP" },
+{ FABRIC_OPERATION_TYPE_INVALID , "FABRIC_OPERATION_TYPE_INVALID" },
+{ FABRIC_OPERATION_TYPE_NORMAL , "FABRIC_OPERATION_TYPE_NORMAL" },
+{ FABRIC_OPERATION_TYPE_END_OF_STREAM , "FABRIC_OPERATION_TYPE_END_OF_STREAM" },
+};
+static const int32_t FABRIC_OPERATION_TYPE_Seeds[] ={
+0, -5, 1, 1, 0, -6, 0, 7,
+};
+int MU_C2(FABRIC_OPERATION_TYPE, _FromString)(const char* enumAsString, FABRIC_OPERATION_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_OPERATION_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_OPERATION_TYPE, _Seeds), sizeof(MU_C2(FABRIC_OPERATION_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_OPERATION_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_OPERATION_TYPE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_OPERATION_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_OPERATION_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_OPERATION_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_OPERATION_TYPE, _Seeds), sizeof(MU_C2(FABRIC_OPERATION_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_OPERATION_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_OPERATION_TYPE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPLICA_SET_QUORUM_MODE_Strings[FABRIC_REPLICA_SET_QUORUM_ALL - FABRIC_REPLICA_SET_QUORUM_INVALID + 1] ={
+[FABRIC_REPLICA_SET_QUORUM_INVALID - FABRIC_REPLICA_SET_QUORUM_INVALID] = "FABRIC_REPLICA_SET_QUORUM_INVALID",
+[FABRIC_REPLICA_SET_WRITE_QUORUM - FABRIC_REPLICA_SET_QUORUM_INVALID] = "FABRIC_REPLICA_SET_WRITE_QUORUM",
+[FABRIC_REPLICA_SET_QUORUM_ALL - FABRIC_REPLICA_SET_QUORUM_INVALID] = "FABRIC_REPLICA_SET_QUORUM_ALL",
+};
+const char* MU_C3(MU_,FABRIC_REPLICA_SET_QUORUM_MODE,_ToString)(FABRIC_REPLICA_SET_QUORUM_MODE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPLICA_SET_QUORUM_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Strings))/sizeof(MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Strings)[0])) && (MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPLICA_SET_QUORUM_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPLICA_SET_QUORUM_INVALID , "FABRIC_REPLICA_SET_QUORUM_INVALID" },
+{ FABRIC_REPLICA_SET_WRITE_QUORUM , "FABRIC_REPLICA_SET_WRITE_QUORUM" },
+{ FABRIC_REPLICA_SET_QUORUM_ALL , "FABRIC_REPLICA_SET_QUORUM_ALL" },
+};
+static const int32_t FABRIC_REPLICA_SET_QUORUM_MODE_Seeds[] ={
+2, 0, -1,
+};
+int MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _FromString)(const char* enumAsString, FABRIC_REPLICA_SET_QUORUM_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Seeds), sizeof(MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Seeds))/sizeof(MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICA_SET_QUORUM_MODE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICA_SET_QUORUM_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Seeds), sizeof(MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Seeds))/sizeof(MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICA_SET_QUORUM_MODE)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPLICATOR_SETTINGS_FLAGS_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_REPLICATOR_SETTINGS_NONE , "FABRIC_REPLICATOR_SETTINGS_NONE" },
+{ FABRIC_REPLICATOR_ADDRESS , "FABRIC_REPLICATOR_ADDRESS" },
+{ FABRIC_REPLICATOR_SECURITY , "FABRIC_REPLICATOR_SECURITY" },
+{ FABRIC_REPLICATOR_RETRY_INTERVAL , "FABRIC_REPLICATOR_RETRY_INTERVAL" },
+{ FABRIC_REPLICATOR_BATCH_ACKNOWLEDGEMENT_INTERVAL , "FABRIC_REPLICATOR_BATCH_ACKNOWLEDGEMENT_INTERVAL" },
+{ FABRIC_REPLICATOR_REQUIRE_SERVICE_ACK , "FABRIC_REPLICATOR_REQUIRE_SERVICE_ACK" },
+{ FABRIC_REPLICATOR_REPLICATION_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_REPLICATION_QUEUE_INITIAL_SIZE" },
+{ FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_COPY_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_COPY_QUEUE_INITIAL_SIZE" },
+{ FABRIC_REPLICATOR_COPY_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_COPY_QUEUE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_MEMORY_SIZE , "FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_MEMORY_SIZE" },
+{ FABRIC_REPLICATOR_SECONDARY_CLEAR_ACKNOWLEDGED_OPERATIONS , "FABRIC_REPLICATOR_SECONDARY_CLEAR_ACKNOWLEDGED_OPERATIONS" },
+{ FABRIC_REPLICATOR_REPLICATION_MESSAGE_MAX_SIZE , "FABRIC_REPLICATOR_REPLICATION_MESSAGE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_USE_STREAMFAULTS_AND_ENDOFSTREAM_OPERATIONACK , "FABRIC_REPLICATOR_USE_STREAMFAULTS_AND_ENDOFSTREAM_OPERATIONACK" },
+{ FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_INITIAL_SIZE" },
+{ FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE , "FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE" },
+{ FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_INITIAL_SIZE" },
+{ FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE , "FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE" },
+{ FABRIC_REPLICATOR_PRIMARY_WAIT_FOR_PENDING_QUORUMS_TIMEOUT , "FABRIC_REPLICATOR_PRIMARY_WAIT_FOR_PENDING_QUORUMS_TIMEOUT" },
+{ FABRIC_REPLICATOR_LISTEN_ADDRESS , "FABRIC_REPLICATOR_LISTEN_ADDRESS" },
+{ FABRIC_REPLICATOR_PUBLISH_ADDRESS , "FABRIC_REPLICATOR_PUBLISH_ADDRESS" },
+{ FABRIC_REPLICATOR_ENABLE_SEND_WINDOW_SIZE_IN_BYTES , "FABRIC_REPLICATOR_ENABLE_SEND_WINDOW_SIZE_IN_BYTES" },
+{ FABRIC_REPLICATOR_USE_INDIVIDUAL_HEAP_PER_REPLICA , "FABRIC_REPLICATOR_USE_INDIVIDUAL_HEAP_PER_REPLICA" },
+{ FABRIC_REPLICATOR_INITIAL_REPLICA_HEAP_SIZE_IN_KB , "FABRIC_REPLICATOR_INITIAL_REPLICA_HEAP_SIZE_IN_KB" },
+{ FABRIC_REPLICATOR_REPLICATION_BATCH_SIZE , "FABRIC_REPLICATOR_REPLICATION_BATCH_SIZE" },
+{ FABRIC_REPLICATOR_REPLICATION_BATCH_SEND_INTERVAL , "FABRIC_REPLICATOR_REPLICATION_BATCH_SEND_INTERVAL" },
+};
+const char* MU_C3(MU_,FABRIC_REPLICATOR_SETTINGS_FLAGS,_ToString)(FABRIC_REPLICATOR_SETTINGS_FLAGS value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPLICATOR_SETTINGS_FLAGS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPLICATOR_COPY_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_COPY_QUEUE_INITIAL_SIZE" },
+{ FABRIC_REPLICATOR_REPLICATION_BATCH_SEND_INTERVAL , "FABRIC_REPLICATOR_REPLICATION_BATCH_SEND_INTERVAL" },
+{ FABRIC_REPLICATOR_SETTINGS_NONE , "FABRIC_REPLICATOR_SETTINGS_NONE" },
+{ FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_INITIAL_SIZE" },
+{ FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE , "FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE" },
+{ FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_ADDRESS , "FABRIC_REPLICATOR_ADDRESS" },
+{ FABRIC_REPLICATOR_SECONDARY_CLEAR_ACKNOWLEDGED_OPERATIONS , "FABRIC_REPLICATOR_SECONDARY_CLEAR_ACKNOWLEDGED_OPERATIONS" },
+{ FABRIC_REPLICATOR_REQUIRE_SERVICE_ACK , "FABRIC_REPLICATOR_REQUIRE_SERVICE_ACK" },
+{ FABRIC_REPLICATOR_COPY_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_COPY_QUEUE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_USE_INDIVIDUAL_HEAP_PER_REPLICA , "FABRIC_REPLICATOR_USE_INDIVIDUAL_HEAP_PER_REPLICA" },
+{ FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_REPLICATION_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_REPLICATION_QUEUE_INITIAL_SIZE" },
+{ FABRIC_REPLICATOR_REPLICATION_MESSAGE_MAX_SIZE , "FABRIC_REPLICATOR_REPLICATION_MESSAGE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_PRIMARY_WAIT_FOR_PENDING_QUORUMS_TIMEOUT , "FABRIC_REPLICATOR_PRIMARY_WAIT_FOR_PENDING_QUORUMS_TIMEOUT" },
+{ FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_SIZE" },
+{ FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE , "FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE" },
+{ FABRIC_REPLICATOR_SECURITY , "FABRIC_REPLICATOR_SECURITY" },
+{ FABRIC_REPLICATOR_PUBLISH_ADDRESS , "FABRIC_REPLICATOR_PUBLISH_ADDRESS" },
+{ FABRIC_REPLICATOR_REPLICATION_BATCH_SIZE , "FABRIC_REPLICATOR_REPLICATION_BATCH_SIZE" },
+{ FABRIC_REPLICATOR_BATCH_ACKNOWLEDGEMENT_INTERVAL , "FABRIC_REPLICATOR_BATCH_ACKNOWLEDGEMENT_INTERVAL" },
+{ FABRIC_REPLICATOR_USE_STREAMFAULTS_AND_ENDOFSTREAM_OPERATIONACK , "FABRIC_REPLICATOR_USE_STREAMFAULTS_AND_ENDOFSTREAM_OPERATIONACK" },
+{ FABRIC_REPLICATOR_INITIAL_REPLICA_HEAP_SIZE_IN_KB , "FABRIC_REPLICATOR_INITIAL_REPLICA_HEAP_SIZE_IN_KB" },
+{ FABRIC_REPLICATOR_RETRY_INTERVAL , "FABRIC_REPLICATOR_RETRY_INTERVAL" },
+{ FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_INITIAL_SIZE" },
+{ FABRIC_REPLICATOR_ENABLE_SEND_WINDOW_SIZE_IN_BYTES , "FABRIC_REPLICATOR_ENABLE_SEND_WINDOW_SIZE_IN_BYTES" },
+{ FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_MEMORY_SIZE , "FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_MEMORY_SIZE" },
+{ FABRIC_REPLICATOR_LISTEN_ADDRESS , "FABRIC_REPLICATOR_LISTEN_ADDRESS" },
+};
+static const int32_t FABRIC_REPLICATOR_SETTINGS_FLAGS_Seeds[] ={
+0, 0, 0, 1, -1, -7, 1, -8, 0, -14, -15, -16, 0, 0, 1, 0,
+5, 1, 1, -17, -18, 0, -20, -25, -28, 0, 2, 0,
+};
+int MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _FromString)(const char* enumAsString, FABRIC_REPLICATOR_SETTINGS_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICATOR_SETTINGS_FLAGS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPLICATOR_SETTINGS_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPLICATOR_SETTINGS_FLAGS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_FAULT_TYPE_Strings[FABRIC_FAULT_TYPE_TRANSIENT - FABRIC_FAULT_TYPE_INVALID + 1] ={
+[FABRIC_FAULT_TYPE_INVALID - FABRIC_FAULT_TYPE_INVALID] = "FABRIC_FAULT_TYPE_INVALID",
+[FABRIC_FAULT_TYPE_PERMANENT - FABRIC_FAULT_TYPE_INVALID] = "FABRIC_FAULT_TYPE_PERMANENT",
+[FABRIC_FAULT_TYPE_TRANSIENT - FABRIC_FAULT_TYPE_INVALID] = "FABRIC_FAULT_TYPE_TRANSIENT",
+};
+const char* MU_C3(MU_,FABRIC_FAULT_TYPE,_ToString)(FABRIC_FAULT_TYPE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_FAULT_TYPE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_FAULT_TYPE, _Strings))/sizeof(MU_C2(FABRIC_FAULT_TYPE, _Strings)[0])) && (MU_C2(FABRIC_FAULT_TYPE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_FAULT_TYPE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_FAULT_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_FAULT_TYPE_PERMANENT , "FABRIC_FAULT_TYPE_PERMANENT" },
+{ FABRIC_FAULT_TYPE_INVALID , "FABRIC_FAULT_TYPE_INVALID" },
+{ FABRIC_FAULT_TYPE_TRANSIENT , "FABRIC_FAULT_TYPE_TRANSIENT" },
+};
+static const int32_t FABRIC_FAULT_TYPE_Seeds[] ={
+0, 0, 1,
+};
+int MU_C2(FABRIC_FAULT_TYPE, _FromString)(const char* enumAsString, FABRIC_FAULT_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_FAULT_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_FAULT_TYPE, _Seeds), sizeof(MU_C2(FABRIC_FAULT_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_FAULT_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_FAULT_TYPE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_FAULT_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_FAULT_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_FAULT_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_FAULT_TYPE, _Seeds), sizeof(MU_C2(FABRIC_FAULT_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_FAULT_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_FAULT_TYPE)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_HEALTH_STATE_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_HEALTH_STATE_INVALID , "FABRIC_HEALTH_STATE_INVALID" },
+{ FABRIC_HEALTH_STATE_OK , "FABRIC_HEALTH_STATE_OK" },
+{ FABRIC_HEALTH_STATE_WARNING , "FABRIC_HEALTH_STATE_WARNING" },
+{ FABRIC_HEALTH_STATE_ERROR , "FABRIC_HEALTH_STATE_ERROR" },
+{ FABRIC_HEALTH_STATE_UNKNOWN , "FABRIC_HEALTH_STATE_UNKNOWN" },
+};
+const char* MU_C3(MU_,FABRIC_HEALTH_STATE,_ToString)(FABRIC_HEALTH_STATE value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_HEALTH_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_HEALTH_STATE, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_HEALTH_STATE, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_HEALTH_STATE, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_HEALTH_STATE, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_HEALTH_STATE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_HEALTH_STATE_INVALID , "FABRIC_HEALTH_STATE_INVALID" },
+{ FABRIC_HEALTH_STATE_UNKNOWN , "FABRIC_HEALTH_STATE_UNKNOWN" },
+{ FABRIC_HEALTH_STATE_OK , "FABRIC_HEALTH_STATE_OK" },
+{ FABRIC_HEALTH_STATE_ERROR , "FABRIC_HEALTH_STATE_ERROR" },
+{ FABRIC_HEALTH_STATE_WARNING , "FABRIC_HEALTH_STATE_WARNING" },
+};
+static const int32_t FABRIC_HEALTH_STATE_Seeds[] ={
+1, 0, -1, -2, -4,
+};
+int MU_C2(FABRIC_HEALTH_STATE, _FromString)(const char* enumAsString, FABRIC_HEALTH_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_STATE, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_STATE, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_STATE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_STATE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_HEALTH_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_STATE, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_STATE, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_STATE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_STATE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_HEALTH_REPORT_KIND_Strings[FABRIC_HEALTH_REPORT_KIND_SELF_RECONFIGURING_SERVICE_INSTANCE - FABRIC_HEALTH_REPORT_KIND_INVALID + 1] ={
+[FABRIC_HEALTH_REPORT_KIND_INVALID - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_INVALID",
+[FABRIC_HEALTH_REPORT_KIND_STATEFUL_SERVICE_REPLICA - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_STATEFUL_SERVICE_REPLICA",
+[FABRIC_HEALTH_REPORT_KIND_STATELESS_SERVICE_INSTANCE - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_STATELESS_SERVICE_INSTANCE",
+[FABRIC_HEALTH_REPORT_KIND_PARTITION - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_PARTITION",
+[FABRIC_HEALTH_REPORT_KIND_NODE - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_NODE",
+[FABRIC_HEALTH_REPORT_KIND_SERVICE - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_SERVICE",
+[FABRIC_HEALTH_REPORT_KIND_APPLICATION - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_APPLICATION",
+[FABRIC_HEALTH_REPORT_KIND_DEPLOYED_APPLICATION - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_DEPLOYED_APPLICATION",
+[FABRIC_HEALTH_REPORT_KIND_DEPLOYED_SERVICE_PACKAGE - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_DEPLOYED_SERVICE_PACKAGE",
+[FABRIC_HEALTH_REPORT_KIND_CLUSTER - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_CLUSTER",
+[FABRIC_HEALTH_REPORT_KIND_SELF_RECONFIGURING_SERVICE_INSTANCE - FABRIC_HEALTH_REPORT_KIND_INVALID] = "FABRIC_HEALTH_REPORT_KIND_SELF_RECONFIGURING_SERVICE_INSTANCE",
+};
+const char* MU_C3(MU_,FABRIC_HEALTH_REPORT_KIND,_ToString)(FABRIC_HEALTH_REPORT_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_HEALTH_REPORT_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_HEALTH_REPORT_KIND, _Strings))/sizeof(MU_C2(FABRIC_HEALTH_REPORT_KIND, _Strings)[0])) && (MU_C2(FABRIC_HEALTH_REPORT_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_HEALTH_REPORT_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_HEALTH_REPORT_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_HEALTH_REPORT_KIND_NODE , "FABRIC_HEALTH_REPORT_KIND_NODE" },
+{ FABRIC_HEALTH_REPORT_KIND_APPLICATION , "FABRIC_HEALTH_REPORT_KIND_APPLICATION" },
+{ FABRIC_HEALTH_REPORT_KIND_SELF_RECONFIGURING_SERVICE_INSTANCE , "FABRIC_HEALTH_REPORT_KIND_SELF_RECONFIGURING_SERVICE_INSTANCE" },
+{ FABRIC_HEALTH_REPORT_KIND_DEPLOYED_APPLICATION , "FABRIC_HEALTH_REPORT_KIND_DEPLOYED_APPLICATION" },
+{ FABRIC_HEALTH_REPORT_KIND_STATELESS_SERVICE_INSTANCE , "FABRIC_HEALTH_REPORT_KIND_STATELESS_SERVICE_INSTANCE" },
+{ FABRIC_HEALTH_REPORT_KIND_CLUSTER , "FABRIC_HEALTH_REPORT_KIND_CLUSTER" },
+{ FABRIC_HEALTH_REPORT_KIND_PARTITION , "FABRIC_HEALTH_REPORT_KIND_PARTITION" },
+{ FABRIC_HEALTH_REPORT_KIND_DEPLOYED_SERVICE_PACKAGE , "FABRIC_HEALTH_REPORT_KIND_DEPLOYED_SERVICE_PACKAGE" },
+{ FABRIC_HEALTH_REPORT_KIND_SERVICE , "FABRIC_HEALTH_REPORT_KIND_SERVICE" },
+{ FABRIC_HEALTH_REPORT_KIND_INVALID , "FABRIC_HEALTH_REPORT_KIND_INVALID" },
+{ FABRIC_HEALTH_REPORT_KIND_STATEFUL_SERVICE_REPLICA , "FABRIC_HEALTH_REPORT_KIND_STATEFUL_SERVICE_REPLICA" },
+};
+static const int32_t FABRIC_HEALTH_REPORT_KIND_Seeds[] ={
+-2, -3, 1, 0, -6, 0, 0, 1, 0, 4, -9,
+};
+int MU_C2(FABRIC_HEALTH_REPORT_KIND, _FromString)(const char* enumAsString, FABRIC_HEALTH_REPORT_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_REPORT_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_REPORT_KIND, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_REPORT_KIND, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_REPORT_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_REPORT_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_HEALTH_REPORT_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_REPORT_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_REPORT_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_REPORT_KIND, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_REPORT_KIND, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_REPORT_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_REPORT_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_HEALTH_ENTITY_KIND_Strings[FABRIC_HEALTH_ENTITY_KIND_CLUSTER - FABRIC_HEALTH_ENTITY_KIND_INVALID + 1] ={
+[FABRIC_HEALTH_ENTITY_KIND_INVALID - FABRIC_HEALTH_ENTITY_KIND_INVALID] = "FABRIC_HEALTH_ENTITY_KIND_INVALID",
+[FABRIC_HEALTH_ENTITY_KIND_NODE - FABRIC_HEALTH_ENTITY_KIND_INVALID] = "FABRIC_HEALTH_ENTITY_KIND_NODE",
+[FABRIC_HEALTH_ENTITY_KIND_PARTITION - FABRIC_HEALTH_ENTITY_KIND_INVALID] = "FABRIC_HEALTH_ENTITY_KIND_PARTITION",
+[FABRIC_HEALTH_ENTITY_KIND_SERVICE - FABRIC_HEALTH_ENTITY_KIND_INVALID] = "FABRIC_HEALTH_ENTITY_KIND_SERVICE",
+[FABRIC_HEALTH_ENTITY_KIND_APPLICATION - FABRIC_HEALTH_ENTITY_KIND_INVALID] = "FABRIC_HEALTH_ENTITY_KIND_APPLICATION",
+[FABRIC_HEALTH_ENTITY_KIND_REPLICA - FABRIC_HEALTH_ENTITY_KIND_INVALID] = "FABRIC_HEALTH_ENTITY_KIND_REPLICA",
+[FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_APPLICATION - FABRIC_HEALTH_ENTITY_KIND_INVALID] = "FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_APPLICATION",
+[FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_SERVICE_PACKAGE - FABRIC_HEALTH_ENTITY_KIND_INVALID] = "FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_SERVICE_PACKAGE",
+[FABRIC_HEALTH_ENTITY_KIND_CLUSTER - FABRIC_HEALTH_ENTITY_KIND_INVALID] = "FABRIC_HEALTH_ENTITY_KIND_CLUSTER",
+};
+const char* MU_C3(MU_,FABRIC_HEALTH_ENTITY_KIND,_ToString)(FABRIC_HEALTH_ENTITY_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_HEALTH_ENTITY_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Strings))/sizeof(MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Strings)[0])) && (MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_HEALTH_ENTITY_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_HEALTH_ENTITY_KIND_SERVICE , "FABRIC_HEALTH_ENTITY_KIND_SERVICE" },
+{ FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_APPLICATION , "FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_APPLICATION" },
+{ FABRIC_HEALTH_ENTITY_KIND_REPLICA , "FABRIC_HEALTH_ENTITY_KIND_REPLICA" },
+{ FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_SERVICE_PACKAGE , "FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_SERVICE_PACKAGE" },
+{ FABRIC_HEALTH_ENTITY_KIND_INVALID , "FABRIC_HEALTH_ENTITY_KIND_INVALID" },
+{ FABRIC_HEALTH_ENTITY_KIND_NODE , "FABRIC_HEALTH_ENTITY_KIND_NODE" },
+{ FABRIC_HEALTH_ENTITY_KIND_PARTITION , "FABRIC_HEALTH_ENTITY_KIND_PARTITION" },
+{ FABRIC_HEALTH_ENTITY_KIND_CLUSTER , "FABRIC_HEALTH_ENTITY_KIND_CLUSTER" },
+{ FABRIC_HEALTH_ENTITY_KIND_APPLICATION , "FABRIC_HEALTH_ENTITY_KIND_APPLICATION" },
+};
+static const int32_t FABRIC_HEALTH_ENTITY_KIND_Seeds[] ={
+1, 0, -5, -6, 8, 0, -7, -8, 0,
+};
+int MU_C2(FABRIC_HEALTH_ENTITY_KIND, _FromString)(const char* enumAsString, FABRIC_HEALTH_ENTITY_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_ENTITY_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_ENTITY_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_HEALTH_ENTITY_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_ENTITY_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_ENTITY_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_ENTITY_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_ENTITY_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_HEALTH_EVALUATION_KIND_Strings[FABRIC_HEALTH_EVALUATION_KIND_NODE_TYPE_NODES - FABRIC_HEALTH_EVALUATION_KIND_INVALID + 1] ={
+[FABRIC_HEALTH_EVALUATION_KIND_INVALID - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_INVALID",
+[FABRIC_HEALTH_EVALUATION_KIND_EVENT - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_EVENT",
+[FABRIC_HEALTH_EVALUATION_KIND_REPLICAS - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_REPLICAS",
+[FABRIC_HEALTH_EVALUATION_KIND_PARTITIONS - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_PARTITIONS",
+[FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGES - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGES",
+[FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATIONS - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATIONS",
+[FABRIC_HEALTH_EVALUATION_KIND_SERVICES - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_SERVICES",
+[FABRIC_HEALTH_EVALUATION_KIND_NODES - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_NODES",
+[FABRIC_HEALTH_EVALUATION_KIND_APPLICATIONS - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_APPLICATIONS",
+[FABRIC_HEALTH_EVALUATION_KIND_SYSTEM_APPLICATION - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_SYSTEM_APPLICATION",
+[FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DEPLOYED_APPLICATIONS - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DEPLOYED_APPLICATIONS",
+[FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_NODES - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_NODES",
+[FABRIC_HEALTH_EVALUATION_KIND_NODE - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_NODE",
+[FABRIC_HEALTH_EVALUATION_KIND_REPLICA - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_REPLICA",
+[FABRIC_HEALTH_EVALUATION_KIND_PARTITION - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_PARTITION",
+[FABRIC_HEALTH_EVALUATION_KIND_SERVICE - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_SERVICE",
+[FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGE - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGE",
+[FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATION - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATION",
+[FABRIC_HEALTH_EVALUATION_KIND_APPLICATION - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_APPLICATION",
+[FABRIC_HEALTH_EVALUATION_KIND_DELTA_NODES_CHECK - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_DELTA_NODES_CHECK",
+[FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DELTA_NODES_CHECK - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DELTA_NODES_CHECK",
+[FABRIC_HEALTH_EVALUATION_KIND_APPLICATION_TYPE_APPLICATIONS - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_APPLICATION_TYPE_APPLICATIONS",
+[FABRIC_HEALTH_EVALUATION_KIND_NODE_TYPE_NODES - FABRIC_HEALTH_EVALUATION_KIND_INVALID] = "FABRIC_HEALTH_EVALUATION_KIND_NODE_TYPE_NODES",
+};
+const char* MU_C3(MU_,FABRIC_HEALTH_EVALUATION_KIND,_ToString)(FABRIC_HEALTH_EVALUATION_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_HEALTH_EVALUATION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Strings))/sizeof(MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Strings)[0])) && (MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_HEALTH_EVALUATION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_HEALTH_EVALUATION_KIND_NODES , "FABRIC_HEALTH_EVALUATION_KIND_NODES" },
+{ FABRIC_HEALTH_EVALUATION_KIND_SERVICES , "FABRIC_HEALTH_EVALUATION_KIND_SERVICES" },
+{ FABRIC_HEALTH_EVALUATION_KIND_APPLICATION , "FABRIC_HEALTH_EVALUATION_KIND_APPLICATION" },
+{ FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGES , "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGES" },
+{ FABRIC_HEALTH_EVALUATION_KIND_INVALID , "FABRIC_HEALTH_EVALUATION_KIND_INVALID" },
+{ FABRIC_HEALTH_EVALUATION_KIND_APPLICATION_TYPE_APPLICATIONS , "FABRIC_HEALTH_EVALUATION_KIND_APPLICATION_TYPE_APPLICATIONS" },
+{ FABRIC_HEALTH_EVALUATION_KIND_REPLICA , "FABRIC_HEALTH_EVALUATION_KIND_REPLICA" },
+{ FABRIC_HEALTH_EVALUATION_KIND_PARTITIONS , "FABRIC_HEALTH_EVALUATION_KIND_PARTITIONS" },
+{ FABRIC_HEALTH_EVALUATION_KIND_NODE_TYPE_NODES , "FABRIC_HEALTH_EVALUATION_KIND_NODE_TYPE_NODES" },
+{ FABRIC_HEALTH_EVALUATION_KIND_REPLICAS , "FABRIC_HEALTH_EVALUATION_KIND_REPLICAS" },
+{ FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGE , "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGE" },
+{ FABRIC_HEALTH_EVALUATION_KIND_PARTITION , "FABRIC_HEALTH_EVALUATION_KIND_PARTITION" },
+{ FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATIONS , "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATIONS" },
+{ FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATION , "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATION" },
+{ FABRIC_HEALTH_EVALUATION_KIND_SERVICE , "FABRIC_HEALTH_EVALUATION_KIND_SERVICE" },
+{ FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DEPLOYED_APPLICATIONS , "FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DEPLOYED_APPLICATIONS" },
+{ FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_NODES , "FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_NODES" },
+{ FABRIC_HEALTH_EVALUATION_KIND_EVENT , "FABRIC_HEALTH_EVALUATION_KIND_EVENT" },
+{ FABRIC_HEALTH_EVALUATION_KIND_DELTA_NODES_CHECK , "FABRIC_HEALTH_EVALUATION_KIND_DELTA_NODES_CHECK" },
+{ FABRIC_HEALTH_EVALUATION_KIND_SYSTEM_APPLICATION , "FABRIC_HEALTH_EVALUATION_KIND_SYSTEM_APPLICATION" },
+{ FABRIC_HEALTH_EVALUATION_KIND_NODE , "FABRIC_HEALTH_EVALUATION_KIND_NODE" },
+{ FABRIC_HEALTH_EVALUATION_KIND_APPLICATIONS , "FABRIC_HEALTH_EVALUATION_KIND_APPLICATIONS" },
+{ FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DELTA_NODES_CHECK , "FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DELTA_NODES_CHECK" },
+};
+static const int32_t FABRIC_HEALTH_EVALUATION_KIND_Seeds[] ={
+0, -2, 1, 1, -3, 0, 0, 0, 0, 2, 0, -8, -13, 1, 2, -14,
+-17, 0, -18, -19, -20, -21, -23,
+};
+int MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _FromString)(const char* enumAsString, FABRIC_HEALTH_EVALUATION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_EVALUATION_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_EVALUATION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_EVALUATION_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_PROPERTY_TYPE_ID_Strings[FABRIC_PROPERTY_TYPE_GUID - FABRIC_PROPERTY_TYPE_INVALID + 1] ={
+[FABRIC_PROPERTY_TYPE_INVALID - FABRIC_PROPERTY_TYPE_INVALID] = "FABRIC_PROPERTY_TYPE_INVALID",
+[FABRIC_PROPERTY_TYPE_BINARY - FABRIC_PROPERTY_TYPE_INVALID] = "FABRIC_PROPERTY_TYPE_BINARY",
+[FABRIC_PROPERTY_TYPE_INT64 - FABRIC_PROPERTY_TYPE_INVALID] = "FABRIC_PROPERTY_TYPE_INT64",
+[FABRIC_PROPERTY_TYPE_DOUBLE - FABRIC_PROPERTY_TYPE_INVALID] = "FABRIC_PROPERTY_TYPE_DOUBLE",
+[FABRIC_PROPERTY_TYPE_WSTRING - FABRIC_PROPERTY_TYPE_INVALID] = "FABRIC_PROPERTY_TYPE_WSTRING",
+[FABRIC_PROPERTY_TYPE_GUID - FABRIC_PROPERTY_TYPE_INVALID] = "FABRIC_PROPERTY_TYPE_GUID",
+};
+const char* MU_C3(MU_,FABRIC_PROPERTY_TYPE_ID,_ToString)(FABRIC_PROPERTY_TYPE_ID value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_PROPERTY_TYPE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_PROPERTY_TYPE_ID, _Strings))/sizeof(MU_C2(FABRIC_PROPERTY_TYPE_ID, _Strings)[0])) && (MU_C2(FABRIC_PROPERTY_TYPE_ID, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_PROPERTY_TYPE_ID, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_PROPERTY_TYPE_ID_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PROPERTY_TYPE_INVALID , "FABRIC_PROPERTY_TYPE_INVALID" },
+{ FABRIC_PROPERTY_TYPE_BINARY , "FABRIC_PROPERTY_TYPE_BINARY" },
+{ FABRIC_PROPERTY_TYPE_DOUBLE , "FABRIC_PROPERTY_TYPE_DOUBLE" },
+{ FABRIC_PROPERTY_TYPE_GUID , "FABRIC_PROPERTY_TYPE_GUID" },
+{ FABRIC_PROPERTY_TYPE_INT64 , "FABRIC_PROPERTY_TYPE_INT64" },
+{ FABRIC_PROPERTY_TYPE_WSTRING , "FABRIC_PROPERTY_TYPE_WSTRING" },
+};
+static const int32_t FABRIC_PROPERTY_TYPE_ID_Seeds[] ={
+-1, -2, -3, -5, 1, 0,
+};
+int MU_C2(FABRIC_PROPERTY_TYPE_ID, _FromString)(const char* enumAsString, FABRIC_PROPERTY_TYPE_ID* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PROPERTY_TYPE_ID, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PROPERTY_TYPE_ID, _Seeds), sizeof(MU_C2(FABRIC_PROPERTY_TYPE_ID, _Seeds))/sizeof(MU_C2(FABRIC_PROPERTY_TYPE_ID, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PROPERTY_TYPE_ID)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_PROPERTY_TYPE_ID, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PROPERTY_TYPE_ID* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PROPERTY_TYPE_ID, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PROPERTY_TYPE_ID, _Seeds), sizeof(MU_C2(FABRIC_PROPERTY_TYPE_ID, _Seeds))/sizeof(MU_C2(FABRIC_PROPERTY_TYPE_ID, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PROPERTY_TYPE_ID)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_PROPERTY_BATCH_OPERATION_KIND_Strings[FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_VALUE - FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID + 1] ={
+[FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID - FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID] = "FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID",
+[FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT - FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID] = "FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT",
+[FABRIC_PROPERTY_BATCH_OPERATION_KIND_GET - FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID] = "FABRIC_PROPERTY_BATCH_OPERATION_KIND_GET",
+[FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_EXISTS - FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID] = "FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_EXISTS",
+[FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_SEQUENCE - FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID] = "FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_SEQUENCE",
+[FABRIC_PROPERTY_BATCH_OPERATION_KIND_DELETE - FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID] = "FABRIC_PROPERTY_BATCH_OPERATION_KIND_DELETE",
+[FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT_CUSTOM - FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID] = "FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT_CUSTOM",
+[FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_VALUE - FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID] = "FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_VALUE",
+};
+const char* MU_C3(MU_,FABRIC_PROPERTY_BATCH_OPERATION_KIND,_ToString)(FABRIC_PROPERTY_BATCH_OPERATION_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Strings))/sizeof(MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Strings)[0])) && (MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_PROPERTY_BATCH_OPERATION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_DELETE , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_DELETE" },
+{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_VALUE , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_VALUE" },
+{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT" },
+{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_GET , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_GET" },
+{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_EXISTS , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_EXISTS" },
+{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID" },
+{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_SEQUENCE , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_SEQUENCE" },
+{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT_CUSTOM , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT_CUSTOM" },
+};
+static const int32_t FABRIC_PROPERTY_BATCH_OPERATION_KIND_Seeds[] ={
+3, 1, 0, 3, 0, 0, 0, -4,
+};
+int MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _FromString)(const char* enumAsString, FABRIC_PROPERTY_BATCH_OPERATION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Seeds), sizeof(MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PROPERTY_BATCH_OPERATION_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PROPERTY_BATCH_OPERATION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Seeds), sizeof(MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PROPERTY_BATCH_OPERATION_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_ENDPOINT_ROLE_Strings[FABRIC_SERVICE_ROLE_SELF_RECONFIGURING - FABRIC_SERVICE_ROLE_INVALID + 1] ={
+[FABRIC_SERVICE_ROLE_INVALID - FABRIC_SERVICE_ROLE_INVALID] = "FABRIC_SERVICE_ROLE_INVALID",
+[FABRIC_SERVICE_ROLE_STATELESS - FABRIC_SERVICE_ROLE_INVALID] = "FABRIC_SERVICE_ROLE_STATELESS",
+[FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY - FABRIC_SERVICE_ROLE_INVALID] = "FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY",
+[FABRIC_SERVICE_ROLE_STATEFUL_SECONDARY - FABRIC_SERVICE_ROLE_INVALID] = "FABRIC_SERVICE_ROLE_STATEFUL_SECONDARY",
+[FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY_AUXILIARY - FABRIC_SERVICE_ROLE_INVALID] = "FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY_AUXILIARY",
+[FABRIC_SERVICE_ROLE_STATEFUL_AUXILIARY - FABRIC_SERVICE_ROLE_INVALID] = "FABRIC_SERVICE_ROLE_STATEFUL_AUXILIARY",
+[FABRIC_SERVICE_ROLE_SELF_RECONFIGURING - FABRIC_SERVICE_ROLE_INVALID] = "FABRIC_SERVICE_ROLE_SELF_RECONFIGURING",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_ENDPOINT_ROLE,_ToString)(FABRIC_SERVICE_ENDPOINT_ROLE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_ROLE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_ENDPOINT_ROLE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_ROLE_STATEFUL_AUXILIARY , "FABRIC_SERVICE_ROLE_STATEFUL_AUXILIARY" },
+{ FABRIC_SERVICE_ROLE_STATEFUL_SECONDARY , "FABRIC_SERVICE_ROLE_STATEFUL_SECONDARY" },
+{ FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY_AUXILIARY , "FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY_AUXILIARY" },
+{ FABRIC_SERVICE_ROLE_SELF_RECONFIGURING , "FABRIC_SERVICE_ROLE_SELF_RECONFIGURING" },
+{ FABRIC_SERVICE_ROLE_STATELESS , "FABRIC_SERVICE_ROLE_STATELESS" },
+{ FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY , "FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY" },
+{ FABRIC_SERVICE_ROLE_INVALID , "FABRIC_SERVICE_ROLE_INVALID" },
+};
+static const int32_t FABRIC_SERVICE_ENDPOINT_ROLE_Seeds[] ={
+4, 0, 0, 4, 0, 0, 0,
+};
+int MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _FromString)(const char* enumAsString, FABRIC_SERVICE_ENDPOINT_ROLE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_ENDPOINT_ROLE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_ENDPOINT_ROLE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_ENDPOINT_ROLE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_ENUMERATION_STATUS_Strings[FABRIC_ENUMERATION_VALID_MASK - FABRIC_ENUMERATION_INVALID + 1] ={
+[FABRIC_ENUMERATION_INVALID - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_INVALID",
+[FABRIC_ENUMERATION_BEST_EFFORT_MORE_DATA - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_BEST_EFFORT_MORE_DATA",
+[FABRIC_ENUMERATION_CONSISTENT_MORE_DATA - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_CONSISTENT_MORE_DATA",
+[FABRIC_ENUMERATION_MORE_DATA_MASK - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_MORE_DATA_MASK",
+[FABRIC_ENUMERATION_BEST_EFFORT_FINISHED - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_BEST_EFFORT_FINISHED",
+[FABRIC_ENUMERATION_BEST_EFFORT_MASK - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_BEST_EFFORT_MASK",
+[FABRIC_ENUMERATION_CONSISTENT_FINISHED - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_CONSISTENT_FINISHED",
+[FABRIC_ENUMERATION_CONSISTENT_MASK - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_CONSISTENT_MASK",
+[FABRIC_ENUMERATION_FINISHED_MASK - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_FINISHED_MASK",
+[FABRIC_ENUMERATION_VALID_MASK - FABRIC_ENUMERATION_INVALID] = "FABRIC_ENUMERATION_VALID_MASK",
+};
+const char* MU_C3(MU_,FABRIC_ENUMERATION_STATUS,_ToString)(FABRIC_ENUMERATION_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_ENUMERATION_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_ENUMERATION_STATUS, _Strings))/sizeof(MU_C2(FABRIC_ENUMERATION_STATUS, _Strings)[0])) && (MU_C2(FABRIC_ENUMERATION_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_ENUMERATION_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_ENUMERATION_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_ENUMERATION_BEST_EFFORT_MASK , "FABRIC_ENUMERATION_BEST_EFFORT_MASK" },
+{ FABRIC_ENUMERATION_FINISHED_MASK , "FABRIC_ENUMERATION_FINISHED_MASK" },
+{ FABRIC_ENUMERATION_CONSISTENT_FINISHED , "FABRIC_ENUMERATION_CONSISTENT_FINISHED" },
+{ FABRIC_ENUMERATION_MORE_DATA_MASK , "FABRIC_ENUMERATION_MORE_DATA_MASK" },
+{ FABRIC_ENUMERATION_VALID_MASK , "FABRIC_ENUMERATION_VALID_MASK" },
+{ FABRIC_ENUMERATION_CONSISTENT_MASK , "FABRIC_ENUMERATION_CONSISTENT_MASK" },
+{ FABRIC_ENUMERATION_BEST_EFFORT_MORE_DATA , "FABRIC_ENUMERATION_BEST_EFFORT_MORE_DATA" },
+{ FABRIC_ENUMERATION_CONSISTENT_MORE_DATA , "FABRIC_ENUMERATION_CONSISTENT_MORE_DATA" },
+{ FABRIC_ENUMERATION_BEST_EFFORT_FINISHED , "FABRIC_ENUMERATION_BEST_EFFORT_FINISHED" },
+{ FABRIC_ENUMERATION_INVALID , "FABRIC_ENUMERATION_INVALID" },
+};
+static const int32_t FABRIC_ENUMERATION_STATUS_Seeds[] ={
+0, 0, 2, -4, 0, -5, 1, 7, 0, -7,
+};
+int MU_C2(FABRIC_ENUMERATION_STATUS, _FromString)(const char* enumAsString, FABRIC_ENUMERATION_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ENUMERATION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ENUMERATION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_ENUMERATION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_ENUMERATION_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ENUMERATION_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_ENUMERATION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ENUMERATION_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ENUMERATION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ENUMERATION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_ENUMERATION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_ENUMERATION_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ENUMERATION_STATUS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_PARTITION_KEY_TYPE_Strings[FABRIC_PARTITION_KEY_TYPE_STRING - FABRIC_PARTITION_KEY_TYPE_INVALID + 1] ={
+[FABRIC_PARTITION_KEY_TYPE_INVALID - FABRIC_PARTITION_KEY_TYPE_INVALID] = "FABRIC_PARTITION_KEY_TYPE_INVALID",
+[FABRIC_PARTITION_KEY_TYPE_NONE - FABRIC_PARTITION_KEY_TYPE_INVALID] = "FABRIC_PARTITION_KEY_TYPE_NONE",
+[FABRIC_PARTITION_KEY_TYPE_INT64 - FABRIC_PARTITION_KEY_TYPE_INVALID] = "FABRIC_PARTITION_KEY_TYPE_INT64",
+[FABRIC_PARTITION_KEY_TYPE_STRING - FABRIC_PARTITION_KEY_TYPE_INVALID] = "FABRIC_PARTITION_KEY_TYPE_STRING",
+};
+const char* MU_C3(MU_,FABRIC_PARTITION_KEY_TYPE,_ToString)(FABRIC_PARTITION_KEY_TYPE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_PARTITION_KEY_TYPE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_PARTITION_KEY_TYPE, _Strings))/sizeof(MU_C2(FABRIC_PARTITION_KEY_TYPE, _Strings)[0])) && (MU_C2(FABRIC_PARTITION_KEY_TYPE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_PARTITION_KEY_TYPE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_PARTITION_KEY_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PARTITION_KEY_TYPE_INT64 , "FABRIC_PARTITION_KEY_TYPE_INT64" },
+{ FABRIC_PARTITION_KEY_TYPE_NONE , "FABRIC_PARTITION_KEY_TYPE_NONE" },
+{ FABRIC_PARTITION_KEY_TYPE_INVALID , "FABRIC_PARTITION_KEY_TYPE_INVALID" },
+{ FABRIC_PARTITION_KEY_TYPE_STRING , "FABRIC_PARTITION_KEY_TYPE_STRING" },
+};
+static const int32_t FABRIC_PARTITION_KEY_TYPE_Seeds[] ={
+-3, 2, -4, 0,
+};
+int MU_C2(FABRIC_PARTITION_KEY_TYPE, _FromString)(const char* enumAsString, FABRIC_PARTITION_KEY_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PARTITION_KEY_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PARTITION_KEY_TYPE, _Seeds), sizeof(MU_C2(FABRIC_PARTITION_KEY_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_PARTITION_KEY_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PARTITION_KEY_TYPE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_PARTITION_KEY_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PARTITION_KEY_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PARTITION_KEY_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PARTITION_KEY_TYPE, _Seeds), sizeof(MU_C2(FABRIC_PARTITION_KEY_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_PARTITION_KEY_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PARTITION_KEY_TYPE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_PARTITION_SCHEME_Strings[FABRIC_PARTITION_SCHEME_NAMED - FABRIC_PARTITION_SCHEME_INVALID + 1] ={
+[FABRIC_PARTITION_SCHEME_INVALID - FABRIC_PARTITION_SCHEME_INVALID] = "FABRIC_PARTITION_SCHEME_INVALID",
+[FABRIC_PARTITION_SCHEME_SINGLETON - FABRIC_PARTITION_SCHEME_INVALID] = "FABRIC_PARTITION_SCHEME_SINGLETON",
+[FABRIC_PARTITION_SCHEME_UNIFORM_INT64_RANGE - FABRIC_PARTITION_SCHEME_INVALID] = "FABRIC_PARTITION_SCHEME_UNIFORM_INT64_RANGE",
+[FABRIC_PARTITION_SCHEME_NAMED - FABRIC_PARTITION_SCHEME_INVALID] = "FABRIC_PARTITION_SCHEME_NAMED",
+};
+const char* MU_C3(MU_,FABRIC_PARTITION_SCHEME,_ToString)(FABRIC_PARTITION_SCHEME value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_PARTITION_SCHEME_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_PARTITION_SCHEME, _Strings))/sizeof(MU_C2(FABRIC_PARTITION_SCHEME, _Strings)[0])) && (MU_C2(FABRIC_PARTITION_SCHEME, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_PARTITION_SCHEME, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_PARTITION_SCHEME_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PARTITION_SCHEME_NAMED , "FABRIC_PARTITION_SCHEME_NAMED" },
+{ FABRIC_PARTITION_SCHEME_UNIFORM_INT64_RANGE , "FABRIC_PARTITION_SCHEME_UNIFORM_INT64_RANGE" },
+{ FABRIC_PARTITION_SCHEME_INVALID , "FABRIC_PARTITION_SCHEME_INVALID" },
+{ FABRIC_PARTITION_SCHEME_SINGLETON , "FABRIC_PARTITION_SCHEME_SINGLETON" },
+};
+static const int32_t FABRIC_PARTITION_SCHEME_Seeds[] ={
+-1, 0, -3, 1,
+};
+int MU_C2(FABRIC_PARTITION_SCHEME, _FromString)(const char* enumAsString, FABRIC_PARTITION_SCHEME* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PARTITION_SCHEME, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PARTITION_SCHEME, _Seeds), sizeof(MU_C2(FABRIC_PARTITION_SCHEME, _Seeds))/sizeof(MU_C2(FABRIC_PARTITION_SCHEME, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PARTITION_SCHEME)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_PARTITION_SCHEME, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PARTITION_SCHEME* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PARTITION_SCHEME, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PARTITION_SCHEME, _Seeds), sizeof(MU_C2(FABRIC_PARTITION_SCHEME, _Seeds))/sizeof(MU_C2(FABRIC_PARTITION_SCHEME, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PARTITION_SCHEME)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_DESCRIPTION_KIND_Strings[FABRIC_SERVICE_DESCRIPTION_KIND_SELF_RECONFIGURING - FABRIC_SERVICE_DESCRIPTION_KIND_INVALID + 1] ={
+[FABRIC_SERVICE_DESCRIPTION_KIND_INVALID - FABRIC_SERVICE_DESCRIPTION_KIND_INVALID] = "FABRIC_SERVICE_DESCRIPTION_KIND_INVALID",
+[FABRIC_SERVICE_DESCRIPTION_KIND_STATELESS - FABRIC_SERVICE_DESCRIPTION_KIND_INVALID] = "FABRIC_SERVICE_DESCRIPTION_KIND_STATELESS",
+[FABRIC_SERVICE_DESCRIPTION_KIND_STATEFUL - FABRIC_SERVICE_DESCRIPTION_KIND_INVALID] = "FABRIC_SERVICE_DESCRIPTION_KIND_STATEFUL",
+[FABRIC_SERVICE_DESCRIPTION_KIND_SELF_RECONFIGURING - FABRIC_SERVICE_DESCRIPTION_KIND_INVALID] = "FABRIC_SERVICE_DESCRIPTION_KIND_SELF_RECONFIGURING",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_DESCRIPTION_KIND,_ToString)(FABRIC_SERVICE_DESCRIPTION_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_DESCRIPTION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_DESCRIPTION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_DESCRIPTION_KIND_SELF_RECONFIGURING , "FABRIC_SERVICE_DESCRIPTION_KIND_SELF_RECONFIGURING" },
+{ FABRIC_SERVICE_DESCRIPTION_KIND_STATELESS , "FABRIC_SERVICE_DESCRIPTION_KIND_STATELESS" },
+{ FABRIC_SERVICE_DESCRIPTION_KIND_INVALID , "FABRIC_SERVICE_DESCRIPTION_KIND_INVALID" },
+{ FABRIC_SERVICE_DESCRIPTION_KIND_STATEFUL , "FABRIC_SERVICE_DESCRIPTION_KIND_STATEFUL" },
+};
+static const int32_t FABRIC_SERVICE_DESCRIPTION_KIND_Seeds[] ={
+1, -1, 0, -4,
+};
+int MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_SERVICE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_DESCRIPTION_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_DESCRIPTION_KIND)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_NONE , "FABRIC_STATEFUL_SERVICE_SETTINGS_NONE" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_REPLICA_RESTART_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_SETTINGS_REPLICA_RESTART_WAIT_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_QUORUM_LOSS_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_SETTINGS_QUORUM_LOSS_WAIT_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_STANDBY_REPLICA_KEEP_DURATION , "FABRIC_STATEFUL_SERVICE_SETTINGS_STANDBY_REPLICA_KEEP_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_PLACEMENT_TIME_LIMIT , "FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_PLACEMENT_TIME_LIMIT" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_DROP_SOURCE_REPLICA_ON_MOVE , "FABRIC_STATEFUL_SERVICE_SETTINGS_DROP_SOURCE_REPLICA_ON_MOVE" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE , "FABRIC_STATEFUL_SERVICE_SETTINGS_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE , "FABRIC_STATEFUL_SERVICE_SETTINGS_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_AUXILIARY_REPLICA_COUNT , "FABRIC_STATEFUL_SERVICE_SETTINGS_AUXILIARY_REPLICA_COUNT" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_SENSITIVITY , "FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_SENSITIVITY" },
+};
+const char* MU_C3(MU_,FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS,_ToString)(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE , "FABRIC_STATEFUL_SERVICE_SETTINGS_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE , "FABRIC_STATEFUL_SERVICE_SETTINGS_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_AUXILIARY_REPLICA_COUNT , "FABRIC_STATEFUL_SERVICE_SETTINGS_AUXILIARY_REPLICA_COUNT" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_STANDBY_REPLICA_KEEP_DURATION , "FABRIC_STATEFUL_SERVICE_SETTINGS_STANDBY_REPLICA_KEEP_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_REPLICA_RESTART_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_SETTINGS_REPLICA_RESTART_WAIT_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_NONE , "FABRIC_STATEFUL_SERVICE_SETTINGS_NONE" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_PLACEMENT_TIME_LIMIT , "FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_PLACEMENT_TIME_LIMIT" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_SENSITIVITY , "FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_SENSITIVITY" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_QUORUM_LOSS_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_SETTINGS_QUORUM_LOSS_WAIT_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_SETTINGS_DROP_SOURCE_REPLICA_ON_MOVE , "FABRIC_STATEFUL_SERVICE_SETTINGS_DROP_SOURCE_REPLICA_ON_MOVE" },
+};
+static const int32_t FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS_Seeds[] ={
+-2, 0, -5, 0, -6, -9, 1, 1, -10, 0,
+};
+int MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromString)(const char* enumAsString, FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS_Strings[FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_RESTART_WAIT_DURATION - FABRIC_STATELESS_SERVICE_SETTINGS_NONE + 1] ={
+[FABRIC_STATELESS_SERVICE_SETTINGS_NONE - FABRIC_STATELESS_SERVICE_SETTINGS_NONE] = "FABRIC_STATELESS_SERVICE_SETTINGS_NONE",
+[FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_CLOSE_DELAY_DURATION - FABRIC_STATELESS_SERVICE_SETTINGS_NONE] = "FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_CLOSE_DELAY_DURATION",
+[FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_RESTART_WAIT_DURATION - FABRIC_STATELESS_SERVICE_SETTINGS_NONE] = "FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_RESTART_WAIT_DURATION",
+};
+const char* MU_C3(MU_,FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS,_ToString)(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_STATELESS_SERVICE_SETTINGS_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Strings))/sizeof(MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Strings)[0])) && (MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_RESTART_WAIT_DURATION , "FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_RESTART_WAIT_DURATION" },
+{ FABRIC_STATELESS_SERVICE_SETTINGS_NONE , "FABRIC_STATELESS_SERVICE_SETTINGS_NONE" },
+{ FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_CLOSE_DELAY_DURATION , "FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_CLOSE_DELAY_DURATION" },
+};
+static const int32_t FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS_Seeds[] ={
+-3, 1, 0,
+};
+int MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromString)(const char* enumAsString, FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_STATELESS_SERVICE_NONE , "FABRIC_STATELESS_SERVICE_NONE" },
+{ FABRIC_STATELESS_SERVICE_INSTANCE_COUNT , "FABRIC_STATELESS_SERVICE_INSTANCE_COUNT" },
+{ FABRIC_STATELESS_SERVICE_PLACEMENT_CONSTRAINTS , "FABRIC_STATELESS_SERVICE_PLACEMENT_CONSTRAINTS" },
+{ FABRIC_STATELESS_SERVICE_POLICY_LIST , "FABRIC_STATELESS_SERVICE_POLICY_LIST" },
+{ FABRIC_STATELESS_SERVICE_CORRELATIONS , "FABRIC_STATELESS_SERVICE_CORRELATIONS" },
+{ FABRIC_STATELESS_SERVICE_METRICS , "FABRIC_STATELESS_SERVICE_METRICS" },
+{ FABRIC_STATELESS_SERVICE_MOVE_COST , "FABRIC_STATELESS_SERVICE_MOVE_COST" },
+{ FABRIC_STATELESS_SERVICE_SCALING_POLICY , "FABRIC_STATELESS_SERVICE_SCALING_POLICY" },
+{ FABRIC_STATELESS_SERVICE_MIN_INSTANCE_COUNT , "FABRIC_STATELESS_SERVICE_MIN_INSTANCE_COUNT" },
+{ FABRIC_STATELESS_SERVICE_MIN_INSTANCE_PERCENTAGE , "FABRIC_STATELESS_SERVICE_MIN_INSTANCE_PERCENTAGE" },
+{ FABRIC_STATELESS_SERVICE_INSTANCE_CLOSE_DELAY_DURATION , "FABRIC_STATELESS_SERVICE_INSTANCE_CLOSE_DELAY_DURATION" },
+{ FABRIC_STATELESS_SERVICE_INSTANCE_RESTART_WAIT_DURATION , "FABRIC_STATELESS_SERVICE_INSTANCE_RESTART_WAIT_DURATION" },
+{ FABRIC_STATELESS_SERVICE_SERVICE_DNS_NAME , "FABRIC_STATELESS_SERVICE_SERVICE_DNS_NAME" },
+{ FABRIC_STATELESS_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE , "FABRIC_STATELESS_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE" },
+{ FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_PLACE , "FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_PLACE" },
+{ FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_RUN , "FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_RUN" },
+};
+const char* MU_C3(MU_,FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS,_ToString)(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_STATELESS_SERVICE_SCALING_POLICY , "FABRIC_STATELESS_SERVICE_SCALING_POLICY" },
+{ FABRIC_STATELESS_SERVICE_NONE , "FABRIC_STATELESS_SERVICE_NONE" },
+{ FABRIC_STATELESS_SERVICE_METRICS , "FABRIC_STATELESS_SERVICE_METRICS" },
+{ FABRIC_STATELESS_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE , "FABRIC_STATELESS_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE" },
+{ FABRIC_STATELESS_SERVICE_INSTANCE_CLOSE_DELAY_DURATION , "FABRIC_STATELESS_SERVICE_INSTANCE_CLOSE_DELAY_DURATION" },
+{ FABRIC_STATELESS_SERVICE_MOVE_COST , "FABRIC_STATELESS_SERVICE_MOVE_COST" },
+{ FABRIC_STATELESS_SERVICE_PLACEMENT_CONSTRAINTS , "FABRIC_STATELESS_SERVICE_PLACEMENT_CONSTRAINTS" },
+{ FABRIC_STATELESS_SERVICE_SERVICE_DNS_NAME , "FABRIC_STATELESS_SERVICE_SERVICE_DNS_NAME" },
+{ FABRIC_STATELESS_SERVICE_MIN_INSTANCE_COUNT , "FABRIC_STATELESS_SERVICE_MIN_INSTANCE_COUNT" },
+{ FABRIC_STATELESS_SERVICE_POLICY_LIST , "FABRIC_STATELESS_SERVICE_POLICY_LIST" },
+{ FABRIC_STATELESS_SERVICE_CORRELATIONS , "FABRIC_STATELESS_SERVICE_CORRELATIONS" },
+{ FABRIC_STATELESS_SERVICE_INSTANCE_RESTART_WAIT_DURATION , "FABRIC_STATELESS_SERVICE_INSTANCE_RESTART_WAIT_DURATION" },
+{ FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_RUN , "FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_RUN" },
+{ FABRIC_STATELESS_SERVICE_MIN_INSTANCE_PERCENTAGE , "FABRIC_STATELESS_SERVICE_MIN_INSTANCE_PERCENTAGE" },
+{ FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_PLACE , "FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_PLACE" },
+{ FABRIC_STATELESS_SERVICE_INSTANCE_COUNT , "FABRIC_STATELESS_SERVICE_INSTANCE_COUNT" },
+};
+static const int32_t FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS_Seeds[] ={
+1, 1, 0, 3, -2, 15, 0, 0, 6, 0, -5, -6, 0, 0, 0, -12,
+};
+int MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromString)(const char* enumAsString, FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_STATEFUL_SERVICE_NONE , "FABRIC_STATEFUL_SERVICE_NONE" },
+{ FABRIC_STATEFUL_SERVICE_TARGET_REPLICA_SET_SIZE , "FABRIC_STATEFUL_SERVICE_TARGET_REPLICA_SET_SIZE" },
+{ FABRIC_STATEFUL_SERVICE_REPLICA_RESTART_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_REPLICA_RESTART_WAIT_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_QUORUM_LOSS_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_QUORUM_LOSS_WAIT_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_STANDBY_REPLICA_KEEP_DURATION , "FABRIC_STATEFUL_SERVICE_STANDBY_REPLICA_KEEP_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_MIN_REPLICA_SET_SIZE , "FABRIC_STATEFUL_SERVICE_MIN_REPLICA_SET_SIZE" },
+{ FABRIC_STATEFUL_SERVICE_PLACEMENT_CONSTRAINTS , "FABRIC_STATEFUL_SERVICE_PLACEMENT_CONSTRAINTS" },
+{ FABRIC_STATEFUL_SERVICE_POLICY_LIST , "FABRIC_STATEFUL_SERVICE_POLICY_LIST" },
+{ FABRIC_STATEFUL_SERVICE_CORRELATIONS , "FABRIC_STATEFUL_SERVICE_CORRELATIONS" },
+{ FABRIC_STATEFUL_SERVICE_METRICS , "FABRIC_STATEFUL_SERVICE_METRICS" },
+{ FABRIC_STATEFUL_SERVICE_MOVE_COST , "FABRIC_STATEFUL_SERVICE_MOVE_COST" },
+{ FABRIC_STATEFUL_SERVICE_SCALING_POLICY , "FABRIC_STATEFUL_SERVICE_SCALING_POLICY" },
+{ FABRIC_STATEFUL_SERVICE_SERVICE_PLACEMENT_TIME_LIMIT , "FABRIC_STATEFUL_SERVICE_SERVICE_PLACEMENT_TIME_LIMIT" },
+{ FABRIC_STATEFUL_SERVICE_DROP_SOURCE_REPLICA_ON_MOVE , "FABRIC_STATEFUL_SERVICE_DROP_SOURCE_REPLICA_ON_MOVE" },
+{ FABRIC_STATEFUL_SERVICE_SERVICE_DNS_NAME , "FABRIC_STATEFUL_SERVICE_SERVICE_DNS_NAME" },
+{ FABRIC_STATEFUL_SERVICE_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE , "FABRIC_STATEFUL_SERVICE_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE" },
+{ FABRIC_STATEFUL_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE , "FABRIC_STATEFUL_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE" },
+{ FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_PLACE , "FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_PLACE" },
+{ FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_RUN , "FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_RUN" },
+{ FABRIC_STATEFUL_SERVICE_AUXILIARY_REPLICA_COUNT , "FABRIC_STATEFUL_SERVICE_AUXILIARY_REPLICA_COUNT" },
+{ FABRIC_STATEFUL_SERVICE_SERVICE_SENSITIVITY , "FABRIC_STATEFUL_SERVICE_SERVICE_SENSITIVITY" },
+};
+const char* MU_C3(MU_,FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS,_ToString)(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_STATEFUL_SERVICE_SERVICE_PLACEMENT_TIME_LIMIT , "FABRIC_STATEFUL_SERVICE_SERVICE_PLACEMENT_TIME_LIMIT" },
+{ FABRIC_STATEFUL_SERVICE_STANDBY_REPLICA_KEEP_DURATION , "FABRIC_STATEFUL_SERVICE_STANDBY_REPLICA_KEEP_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE , "FABRIC_STATEFUL_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE" },
+{ FABRIC_STATEFUL_SERVICE_SCALING_POLICY , "FABRIC_STATEFUL_SERVICE_SCALING_POLICY" },
+{ FABRIC_STATEFUL_SERVICE_DROP_SOURCE_REPLICA_ON_MOVE , "FABRIC_STATEFUL_SERVICE_DROP_SOURCE_REPLICA_ON_MOVE" },
+{ FABRIC_STATEFUL_SERVICE_SERVICE_DNS_NAME , "FABRIC_STATEFUL_SERVICE_SERVICE_DNS_NAME" },
+{ FABRIC_STATEFUL_SERVICE_MIN_REPLICA_SET_SIZE , "FABRIC_STATEFUL_SERVICE_MIN_REPLICA_SET_SIZE" },
+{ FABRIC_STATEFUL_SERVICE_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE , "FABRIC_STATEFUL_SERVICE_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE" },
+{ FABRIC_STATEFUL_SERVICE_AUXILIARY_REPLICA_COUNT , "FABRIC_STATEFUL_SERVICE_AUXILIARY_REPLICA_COUNT" },
+{ FABRIC_STATEFUL_SERVICE_METRICS , "FABRIC_STATEFUL_SERVICE_METRICS" },
+{ FABRIC_STATEFUL_SERVICE_PLACEMENT_CONSTRAINTS , "FABRIC_STATEFUL_SERVICE_PLACEMENT_CONSTRAINTS" },
+{ FABRIC_STATEFUL_SERVICE_REPLICA_RESTART_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_REPLICA_RESTART_WAIT_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_PLACE , "FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_PLACE" },
+{ FABRIC_STATEFUL_SERVICE_QUORUM_LOSS_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_QUORUM_LOSS_WAIT_DURATION" },
+{ FABRIC_STATEFUL_SERVICE_MOVE_COST , "FABRIC_STATEFUL_SERVICE_MOVE_COST" },
+{ FABRIC_STATEFUL_SERVICE_SERVICE_SENSITIVITY , "FABRIC_STATEFUL_SERVICE_SERVICE_SENSITIVITY" },
+{ FABRIC_STATEFUL_SERVICE_NONE , "FABRIC_STATEFUL_SERVICE_NONE" },
+{ FABRIC_STATEFUL_SERVICE_CORRELATIONS , "FABRIC_STATEFUL_SERVICE_CORRELATIONS" },
+{ FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_RUN , "FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_RUN" },
+{ FABRIC_STATEFUL_SERVICE_TARGET_REPLICA_SET_SIZE , "FABRIC_STATEFUL_SERVICE_TARGET_REPLICA_SET_SIZE" },
+{ FABRIC_STATEFUL_SERVICE_POLICY_LIST , "FABRIC_STATEFUL_SERVICE_POLICY_LIST" },
+};
+static const int32_t FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS_Seeds[] ={
+0, -1, 2, -5, 1, -6, -7, -10, 0, -11, 0, -13, -14, -16, -17, 1,
+-18, -19, -21, 0, 0,
+};
+int MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromString)(const char* enumAsString, FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_Strings[FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_EXISTING - FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID + 1] ={
+[FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID - FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID] = "FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID",
+[FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_NEW - FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID] = "FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_NEW",
+[FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_EXISTING - FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID] = "FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_EXISTING",
+};
+const char* MU_C3(MU_,FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE,_ToString)(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Strings))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Strings)[0])) && (MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_NEW , "FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_NEW" },
+{ FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID , "FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID" },
+{ FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_EXISTING , "FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_EXISTING" },
+};
+static const int32_t FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_Seeds[] ={
+0, 9, 0,
+};
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _FromString)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Seeds), sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Seeds))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Seeds), sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Seeds))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_Strings[FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_NONE - FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID + 1] ={
+[FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID - FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID] = "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID",
+[FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INITIAL - FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID] = "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INITIAL",
+[FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_MEMBER - FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID] = "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_MEMBER",
+[FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_NONE - FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID] = "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_NONE",
+};
+const char* MU_C3(MU_,FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE,_ToString)(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Strings))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Strings)[0])) && (MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_NONE , "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_NONE" },
+{ FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INITIAL , "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INITIAL" },
+{ FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_MEMBER , "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_MEMBER" },
+{ FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID , "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID" },
+};
+static const int32_t FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_Seeds[] ={
+-1, 3, 0, -4,
+};
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _FromString)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Seeds), sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Seeds))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Seeds), sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Seeds))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE_Strings[FABRIC_SELF_RECONFIGURATION_STATUS_DEACTIVATED - FABRIC_SELF_RECONFIGURATION_STATUS_INVALID + 1] ={
+[FABRIC_SELF_RECONFIGURATION_STATUS_INVALID - FABRIC_SELF_RECONFIGURATION_STATUS_INVALID] = "FABRIC_SELF_RECONFIGURATION_STATUS_INVALID",
+[FABRIC_SELF_RECONFIGURATION_STATUS_ACTIVATED - FABRIC_SELF_RECONFIGURATION_STATUS_INVALID] = "FABRIC_SELF_RECONFIGURATION_STATUS_ACTIVATED",
+[FABRIC_SELF_RECONFIGURATION_STATUS_DEACTIVATED - FABRIC_SELF_RECONFIGURATION_STATUS_INVALID] = "FABRIC_SELF_RECONFIGURATION_STATUS_DEACTIVATED",
+};
+const char* MU_C3(MU_,FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE,_ToString)(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SELF_RECONFIGURATION_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Strings))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Strings)[0])) && (MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SELF_RECONFIGURATION_STATUS_DEACTIVATED , "FABRIC_SELF_RECONFIGURATION_STATUS_DEACTIVATED" },
+{ FABRIC_SELF_RECONFIGURATION_STATUS_INVALID , "FABRIC_SELF_RECONFIGURATION_STATUS_INVALID" },
+{ FABRIC_SELF_RECONFIGURATION_STATUS_ACTIVATED , "FABRIC_SELF_RECONFIGURATION_STATUS_ACTIVATED" },
+};
+static const int32_t FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE_Seeds[] ={
+2, 0, 0,
+};
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _FromString)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Seeds), sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Seeds))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Seeds), sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Seeds))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_Strings[FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_PRIMARY_ONLY - FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE + 1] ={
+[FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE - FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE] = "FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE",
+[FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NAME_PREFIX - FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE] = "FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NAME_PREFIX",
+[FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_PRIMARY_ONLY - FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE] = "FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_PRIMARY_ONLY",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS,_ToString)(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE , "FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE" },
+{ FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_PRIMARY_ONLY , "FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_PRIMARY_ONLY" },
+{ FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NAME_PREFIX , "FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NAME_PREFIX" },
+};
+static const int32_t FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_Seeds[] ={
+0, -2, 1,
+};
+int MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _FromString)(const char* enumAsString, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_APPLICATION_UPGRADE_KIND_Strings[FABRIC_APPLICATION_UPGRADE_KIND_ROLLING - FABRIC_APPLICATION_UPGRADE_KIND_INVALID + 1] ={
+[FABRIC_APPLICATION_UPGRADE_KIND_INVALID - FABRIC_APPLICATION_UPGRADE_KIND_INVALID] = "FABRIC_APPLICATION_UPGRADE_KIND_INVALID",
+[FABRIC_APPLICATION_UPGRADE_KIND_ROLLING - FABRIC_APPLICATION_UPGRADE_KIND_INVALID] = "FABRIC_APPLICATION_UPGRADE_KIND_ROLLING",
+};
+const char* MU_C3(MU_,FABRIC_APPLICATION_UPGRADE_KIND,_ToString)(FABRIC_APPLICATION_UPGRADE_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_APPLICATION_UPGRADE_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Strings))/sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Strings)[0])) && (MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_UPGRADE_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_UPGRADE_KIND_INVALID , "FABRIC_APPLICATION_UPGRADE_KIND_INVALID" },
+{ FABRIC_APPLICATION_UPGRADE_KIND_ROLLING , "FABRIC_APPLICATION_UPGRADE_KIND_ROLLING" },
+};
+static const int32_t FABRIC_APPLICATION_UPGRADE_KIND_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _FromString)(const char* enumAsString, FABRIC_APPLICATION_UPGRADE_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_UPGRADE_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_UPGRADE_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_UPGRADE_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_UPGRADE_KIND_Strings[FABRIC_UPGRADE_KIND_ROLLING - FABRIC_UPGRADE_KIND_INVALID + 1] ={
+[FABRIC_UPGRADE_KIND_INVALID - FABRIC_UPGRADE_KIND_INVALID] = "FABRIC_UPGRADE_KIND_INVALID",
+[FABRIC_UPGRADE_KIND_ROLLING - FABRIC_UPGRADE_KIND_INVALID] = "FABRIC_UPGRADE_KIND_ROLLING",
+};
+const char* MU_C3(MU_,FABRIC_UPGRADE_KIND,_ToString)(FABRIC_UPGRADE_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_UPGRADE_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_UPGRADE_KIND, _Strings))/sizeof(MU_C2(FABRIC_UPGRADE_KIND, _Strings)[0])) && (MU_C2(FABRIC_UPGRADE_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_UPGRADE_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_UPGRADE_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_UPGRADE_KIND_ROLLING , "FABRIC_UPGRADE_KIND_ROLLING" },
+{ FABRIC_UPGRADE_KIND_INVALID , "FABRIC_UPGRADE_KIND_INVALID" },
+};
+static const int32_t FABRIC_UPGRADE_KIND_Seeds[] ={
+0, 2,
+};
+int MU_C2(FABRIC_UPGRADE_KIND, _FromString)(const char* enumAsString, FABRIC_UPGRADE_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_KIND, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_UPGRADE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_KIND, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_UPGRADE_SORT_ORDER_Strings[FABRIC_UPGRADE_SORT_ORDER_REVERSE_LEXICOGRAPHICAL - FABRIC_UPGRADE_SORT_ORDER_INVALID + 1] ={
+[FABRIC_UPGRADE_SORT_ORDER_INVALID - FABRIC_UPGRADE_SORT_ORDER_INVALID] = "FABRIC_UPGRADE_SORT_ORDER_INVALID",
+[FABRIC_UPGRADE_SORT_ORDER_DEFAULT - FABRIC_UPGRADE_SORT_ORDER_INVALID] = "FABRIC_UPGRADE_SORT_ORDER_DEFAULT",
+[FABRIC_UPGRADE_SORT_ORDER_NUMERIC - FABRIC_UPGRADE_SORT_ORDER_INVALID] = "FABRIC_UPGRADE_SORT_ORDER_NUMERIC",
+[FABRIC_UPGRADE_SORT_ORDER_LEXICOGRAPHICAL - FABRIC_UPGRADE_SORT_ORDER_INVALID] = "FABRIC_UPGRADE_SORT_ORDER_LEXICOGRAPHICAL",
+[FABRIC_UPGRADE_SORT_ORDER_REVERSE_NUMERIC - FABRIC_UPGRADE_SORT_ORDER_INVALID] = "FABRIC_UPGRADE_SORT_ORDER_REVERSE_NUMERIC",
+[FABRIC_UPGRADE_SORT_ORDER_REVERSE_LEXICOGRAPHICAL - FABRIC_UPGRADE_SORT_ORDER_INVALID] = "FABRIC_UPGRADE_SORT_ORDER_REVERSE_LEXICOGRAPHICAL",
+};
+const char* MU_C3(MU_,FABRIC_UPGRADE_SORT_ORDER,_ToString)(FABRIC_UPGRADE_SORT_ORDER value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_UPGRADE_SORT_ORDER_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Strings))/sizeof(MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Strings)[0])) && (MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_UPGRADE_SORT_ORDER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_UPGRADE_SORT_ORDER_INVALID , "FABRIC_UPGRADE_SORT_ORDER_INVALID" },
+{ FABRIC_UPGRADE_SORT_ORDER_DEFAULT , "FABRIC_UPGRADE_SORT_ORDER_DEFAULT" },
+{ FABRIC_UPGRADE_SORT_ORDER_NUMERIC , "FABRIC_UPGRADE_SORT_ORDER_NUMERIC" },
+{ FABRIC_UPGRADE_SORT_ORDER_REVERSE_NUMERIC , "FABRIC_UPGRADE_SORT_ORDER_REVERSE_NUMERIC" },
+{ FABRIC_UPGRADE_SORT_ORDER_LEXICOGRAPHICAL , "FABRIC_UPGRADE_SORT_ORDER_LEXICOGRAPHICAL" },
+{ FABRIC_UPGRADE_SORT_ORDER_REVERSE_LEXICOGRAPHICAL , "FABRIC_UPGRADE_SORT_ORDER_REVERSE_LEXICOGRAPHICAL" },
+};
+static const int32_t FABRIC_UPGRADE_SORT_ORDER_Seeds[] ={
+-2, 1, 0, -5, 0, 2,
+};
+int MU_C2(FABRIC_UPGRADE_SORT_ORDER, _FromString)(const char* enumAsString, FABRIC_UPGRADE_SORT_ORDER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_SORT_ORDER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_SORT_ORDER)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_UPGRADE_SORT_ORDER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_SORT_ORDER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_SORT_ORDER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_SORT_ORDER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_SORT_ORDER)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_ROLLING_UPGRADE_MODE_Strings[FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_DEFERRED - FABRIC_ROLLING_UPGRADE_MODE_INVALID + 1] ={
+[FABRIC_ROLLING_UPGRADE_MODE_INVALID - FABRIC_ROLLING_UPGRADE_MODE_INVALID] = "FABRIC_ROLLING_UPGRADE_MODE_INVALID",
+[FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_AUTO - FABRIC_ROLLING_UPGRADE_MODE_INVALID] = "FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_AUTO",
+[FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_MANUAL - FABRIC_ROLLING_UPGRADE_MODE_INVALID] = "FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_MANUAL",
+[FABRIC_ROLLING_UPGRADE_MODE_MONITORED - FABRIC_ROLLING_UPGRADE_MODE_INVALID] = "FABRIC_ROLLING_UPGRADE_MODE_MONITORED",
+[FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_DEFERRED - FABRIC_ROLLING_UPGRADE_MODE_INVALID] = "FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_DEFERRED",
+};
+const char* MU_C3(MU_,FABRIC_ROLLING_UPGRADE_MODE,_ToString)(FABRIC_ROLLING_UPGRADE_MODE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_ROLLING_UPGRADE_MODE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Strings))/sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Strings)[0])) && (MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_ROLLING_UPGRADE_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_MANUAL , "FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_MANUAL" },
+{ FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_AUTO , "FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_AUTO" },
+{ FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_DEFERRED , "FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_DEFERRED" },
+{ FABRIC_ROLLING_UPGRADE_MODE_INVALID , "FABRIC_ROLLING_UPGRADE_MODE_INVALID" },
+{ FABRIC_ROLLING_UPGRADE_MODE_MONITORED , "FABRIC_ROLLING_UPGRADE_MODE_MONITORED" },
+};
+static const int32_t FABRIC_ROLLING_UPGRADE_MODE_Seeds[] ={
+-2, -4, -5, 0, 1,
+};
+int MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _FromString)(const char* enumAsString, FABRIC_ROLLING_UPGRADE_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Seeds), sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Seeds))/sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ROLLING_UPGRADE_MODE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ROLLING_UPGRADE_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Seeds), sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Seeds))/sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ROLLING_UPGRADE_MODE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_Strings[FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_MANUAL - FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID + 1] ={
+[FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID - FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID] = "FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID",
+[FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_ROLLBACK - FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID] = "FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_ROLLBACK",
+[FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_MANUAL - FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID] = "FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_MANUAL",
+};
+const char* MU_C3(MU_,FABRIC_MONITORED_UPGRADE_FAILURE_ACTION,_ToString)(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Strings))/sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Strings)[0])) && (MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_ROLLBACK , "FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_ROLLBACK" },
+{ FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_MANUAL , "FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_MANUAL" },
+{ FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID , "FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID" },
+};
+static const int32_t FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_Seeds[] ={
+0, 2, -2,
+};
+int MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _FromString)(const char* enumAsString, FABRIC_MONITORED_UPGRADE_FAILURE_ACTION* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Seeds), sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Seeds))/sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MONITORED_UPGRADE_FAILURE_ACTION)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MONITORED_UPGRADE_FAILURE_ACTION* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Seeds), sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Seeds))/sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MONITORED_UPGRADE_FAILURE_ACTION)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_Strings[FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_RETRY - FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID + 1] ={
+[FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID - FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID] = "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID",
+[FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_WAIT_DURATION - FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID] = "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_WAIT_DURATION",
+[FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_STABLE_DURATION - FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID] = "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_STABLE_DURATION",
+[FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_RETRY - FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID] = "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_RETRY",
+};
+const char* MU_C3(MU_,FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE,_ToString)(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Strings))/sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Strings)[0])) && (MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_WAIT_DURATION , "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_WAIT_DURATION" },
+{ FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID , "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID" },
+{ FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_RETRY , "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_RETRY" },
+{ FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_STABLE_DURATION , "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_STABLE_DURATION" },
+};
+static const int32_t FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_Seeds[] ={
+-1, -2, 0, 1,
+};
+int MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _FromString)(const char* enumAsString, FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Seeds), sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Seeds))/sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Seeds), sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Seeds))/sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_NONE , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_NONE" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_MODE , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_MODE" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FORCE_RESTART , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FORCE_RESTART" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_REPLICA_SET_CHECK_TIMEOUT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_REPLICA_SET_CHECK_TIMEOUT" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FAILURE_ACTION , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FAILURE_ACTION" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_WAIT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_WAIT" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_STABLE , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_STABLE" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_RETRY , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_RETRY" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_TIMEOUT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_TIMEOUT" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_DOMAIN_TIMEOUT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_DOMAIN_TIMEOUT" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_POLICY , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_POLICY" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_ENABLE_DELTAS , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_ENABLE_DELTAS" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_HEALTH_POLICY , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_HEALTH_POLICY" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_APPLICATION_HEALTH_POLICY_MAP , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_APPLICATION_HEALTH_POLICY_MAP" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_INSTANCE_CLOSE_DELAY_DURATION , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_INSTANCE_CLOSE_DELAY_DURATION" },
+};
+const char* MU_C3(MU_,FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS,_ToString)(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_APPLICATION_HEALTH_POLICY_MAP , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_APPLICATION_HEALTH_POLICY_MAP" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_HEALTH_POLICY , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_HEALTH_POLICY" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_POLICY , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_POLICY" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FAILURE_ACTION , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FAILURE_ACTION" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_ENABLE_DELTAS , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_ENABLE_DELTAS" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_INSTANCE_CLOSE_DELAY_DURATION , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_INSTANCE_CLOSE_DELAY_DURATION" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_NONE , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_NONE" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FORCE_RESTART , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FORCE_RESTART" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_MODE , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_MODE" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_TIMEOUT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_TIMEOUT" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_RETRY , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_RETRY" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_WAIT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_WAIT" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_DOMAIN_TIMEOUT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_DOMAIN_TIMEOUT" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_REPLICA_SET_CHECK_TIMEOUT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_REPLICA_SET_CHECK_TIMEOUT" },
+{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_STABLE , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_STABLE" },
+};
+static const int32_t FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_Seeds[] ={
+0, -2, -4, 1, 3, 0, -5, 0, 0, -11, 0, 8, 0, 8, -15,
+};
+int MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _FromString)(const char* enumAsString, FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_APPLICATION_UPGRADE_STATE_Strings[FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_PENDING - FABRIC_APPLICATION_UPGRADE_STATE_INVALID + 1] ={
+[FABRIC_APPLICATION_UPGRADE_STATE_INVALID - FABRIC_APPLICATION_UPGRADE_STATE_INVALID] = "FABRIC_APPLICATION_UPGRADE_STATE_INVALID",
+[FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS - FABRIC_APPLICATION_UPGRADE_STATE_INVALID] = "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS",
+[FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_COMPLETED - FABRIC_APPLICATION_UPGRADE_STATE_INVALID] = "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_COMPLETED",
+[FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_PENDING - FABRIC_APPLICATION_UPGRADE_STATE_INVALID] = "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_PENDING",
+[FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS - FABRIC_APPLICATION_UPGRADE_STATE_INVALID] = "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS",
+[FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED - FABRIC_APPLICATION_UPGRADE_STATE_INVALID] = "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED",
+[FABRIC_APPLICATION_UPGRADE_STATE_FAILED - FABRIC_APPLICATION_UPGRADE_STATE_INVALID] = "FABRIC_APPLICATION_UPGRADE_STATE_FAILED",
+[FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_PENDING - FABRIC_APPLICATION_UPGRADE_STATE_INVALID] = "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_PENDING",
+};
+const char* MU_C3(MU_,FABRIC_APPLICATION_UPGRADE_STATE,_ToString)(FABRIC_APPLICATION_UPGRADE_STATE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_APPLICATION_UPGRADE_STATE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Strings))/sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Strings)[0])) && (MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_UPGRADE_STATE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_PENDING , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_PENDING" },
+{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_COMPLETED , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_COMPLETED" },
+{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS" },
+{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS" },
+{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_PENDING , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_PENDING" },
+{ FABRIC_APPLICATION_UPGRADE_STATE_INVALID , "FABRIC_APPLICATION_UPGRADE_STATE_INVALID" },
+{ FABRIC_APPLICATION_UPGRADE_STATE_FAILED , "FABRIC_APPLICATION_UPGRADE_STATE_FAILED" },
+{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED" },
+};
+static const int32_t FABRIC_APPLICATION_UPGRADE_STATE_Seeds[] ={
+-1, -3, -5, 1, -6, 0, 0, 0,
+};
+int MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _FromString)(const char* enumAsString, FABRIC_APPLICATION_UPGRADE_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_UPGRADE_STATE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_UPGRADE_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_UPGRADE_STATE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_UPGRADE_STATE_Strings[FABRIC_UPGRADE_STATE_ROLLING_BACK_PENDING - FABRIC_UPGRADE_STATE_INVALID + 1] ={
+[FABRIC_UPGRADE_STATE_INVALID - FABRIC_UPGRADE_STATE_INVALID] = "FABRIC_UPGRADE_STATE_INVALID",
+[FABRIC_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS - FABRIC_UPGRADE_STATE_INVALID] = "FABRIC_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS",
+[FABRIC_UPGRADE_STATE_ROLLING_BACK_COMPLETED - FABRIC_UPGRADE_STATE_INVALID] = "FABRIC_UPGRADE_STATE_ROLLING_BACK_COMPLETED",
+[FABRIC_UPGRADE_STATE_ROLLING_FORWARD_PENDING - FABRIC_UPGRADE_STATE_INVALID] = "FABRIC_UPGRADE_STATE_ROLLING_FORWARD_PENDING",
+[FABRIC_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS - FABRIC_UPGRADE_STATE_INVALID] = "FABRIC_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS",
+[FABRIC_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED - FABRIC_UPGRADE_STATE_INVALID] = "FABRIC_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED",
+[FABRIC_UPGRADE_STATE_FAILED - FABRIC_UPGRADE_STATE_INVALID] = "FABRIC_UPGRADE_STATE_FAILED",
+[FABRIC_UPGRADE_STATE_ROLLING_BACK_PENDING - FABRIC_UPGRADE_STATE_INVALID] = "FABRIC_UPGRADE_STATE_ROLLING_BACK_PENDING",
+};
+const char* MU_C3(MU_,FABRIC_UPGRADE_STATE,_ToString)(FABRIC_UPGRADE_STATE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_UPGRADE_STATE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_UPGRADE_STATE, _Strings))/sizeof(MU_C2(FABRIC_UPGRADE_STATE, _Strings)[0])) && (MU_C2(FABRIC_UPGRADE_STATE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_UPGRADE_STATE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_UPGRADE_STATE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_UPGRADE_STATE_FAILED , "FABRIC_UPGRADE_STATE_FAILED" },
+{ FABRIC_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS , "FABRIC_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS" },
+{ FABRIC_UPGRADE_STATE_INVALID , "FABRIC_UPGRADE_STATE_INVALID" },
+{ FABRIC_UPGRADE_STATE_ROLLING_FORWARD_PENDING , "FABRIC_UPGRADE_STATE_ROLLING_FORWARD_PENDING" },
+{ FABRIC_UPGRADE_STATE_ROLLING_BACK_COMPLETED , "FABRIC_UPGRADE_STATE_ROLLING_BACK_COMPLETED" },
+{ FABRIC_UPGRADE_STATE_ROLLING_BACK_PENDING , "FABRIC_UPGRADE_STATE_ROLLING_BACK_PENDING" },
+{ FABRIC_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED , "FABRIC_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED" },
+{ FABRIC_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS , "FABRIC_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS" },
+};
+static const int32_t FABRIC_UPGRADE_STATE_Seeds[] ={
+0, 0, 0, -7, 1, 20, 2, 0,
+};
+int MU_C2(FABRIC_UPGRADE_STATE, _FromString)(const char* enumAsString, FABRIC_UPGRADE_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_STATE, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_STATE, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_STATE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_STATE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_UPGRADE_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_STATE, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_STATE, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_STATE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_STATE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_UPGRADE_DOMAIN_STATE_Strings[FABRIC_UPGRADE_DOMAIN_STATE_COMPLETED - FABRIC_UPGRADE_DOMAIN_STATE_INVALID + 1] ={
+[FABRIC_UPGRADE_DOMAIN_STATE_INVALID - FABRIC_UPGRADE_DOMAIN_STATE_INVALID] = "FABRIC_UPGRADE_DOMAIN_STATE_INVALID",
+[FABRIC_UPGRADE_DOMAIN_STATE_PENDING - FABRIC_UPGRADE_DOMAIN_STATE_INVALID] = "FABRIC_UPGRADE_DOMAIN_STATE_PENDING",
+[FABRIC_UPGRADE_DOMAIN_STATE_IN_PROGRESS - FABRIC_UPGRADE_DOMAIN_STATE_INVALID] = "FABRIC_UPGRADE_DOMAIN_STATE_IN_PROGRESS",
+[FABRIC_UPGRADE_DOMAIN_STATE_COMPLETED - FABRIC_UPGRADE_DOMAIN_STATE_INVALID] = "FABRIC_UPGRADE_DOMAIN_STATE_COMPLETED",
+};
+const char* MU_C3(MU_,FABRIC_UPGRADE_DOMAIN_STATE,_ToString)(FABRIC_UPGRADE_DOMAIN_STATE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_UPGRADE_DOMAIN_STATE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Strings))/sizeof(MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Strings)[0])) && (MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_UPGRADE_DOMAIN_STATE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_UPGRADE_DOMAIN_STATE_COMPLETED , "FABRIC_UPGRADE_DOMAIN_STATE_COMPLETED" },
+{ FABRIC_UPGRADE_DOMAIN_STATE_IN_PROGRESS , "FABRIC_UPGRADE_DOMAIN_STATE_IN_PROGRESS" },
+{ FABRIC_UPGRADE_DOMAIN_STATE_INVALID , "FABRIC_UPGRADE_DOMAIN_STATE_INVALID" },
+{ FABRIC_UPGRADE_DOMAIN_STATE_PENDING , "FABRIC_UPGRADE_DOMAIN_STATE_PENDING" },
+};
+static const int32_t FABRIC_UPGRADE_DOMAIN_STATE_Seeds[] ={
+0, -1, 0, 2,
+};
+int MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _FromString)(const char* enumAsString, FABRIC_UPGRADE_DOMAIN_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_DOMAIN_STATE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_DOMAIN_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_DOMAIN_STATE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_UPGRADE_FAILURE_REASON_Strings[FABRIC_UPGRADE_FAILURE_REASON_PROCESSING_FAILURE - FABRIC_UPGRADE_FAILURE_REASON_NONE + 1] ={
+[FABRIC_UPGRADE_FAILURE_REASON_NONE - FABRIC_UPGRADE_FAILURE_REASON_NONE] = "FABRIC_UPGRADE_FAILURE_REASON_NONE",
+[FABRIC_UPGRADE_FAILURE_REASON_INTERRUPTED - FABRIC_UPGRADE_FAILURE_REASON_NONE] = "FABRIC_UPGRADE_FAILURE_REASON_INTERRUPTED",
+[FABRIC_UPGRADE_FAILURE_REASON_HEALTH_CHECK - FABRIC_UPGRADE_FAILURE_REASON_NONE] = "FABRIC_UPGRADE_FAILURE_REASON_HEALTH_CHECK",
+[FABRIC_UPGRADE_FAILURE_REASON_UPGRADE_DOMAIN_TIMEOUT - FABRIC_UPGRADE_FAILURE_REASON_NONE] = "FABRIC_UPGRADE_FAILURE_REASON_UPGRADE_DOMAIN_TIMEOUT",
+[FABRIC_UPGRADE_FAILURE_REASON_OVERALL_UPGRADE_TIMEOUT - FABRIC_UPGRADE_FAILURE_REASON_NONE] = "FABRIC_UPGRADE_FAILURE_REASON_OVERALL_UPGRADE_TIMEOUT",
+[FABRIC_UPGRADE_FAILURE_REASON_PROCESSING_FAILURE - FABRIC_UPGRADE_FAILURE_REASON_NONE] = "FABRIC_UPGRADE_FAILURE_REASON_PROCESSING_FAILURE",
+};
+const char* MU_C3(MU_,FABRIC_UPGRADE_FAILURE_REASON,_ToString)(FABRIC_UPGRADE_FAILURE_REASON value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_UPGRADE_FAILURE_REASON_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Strings))/sizeof(MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Strings)[0])) && (MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_UPGRADE_FAILURE_REASON_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_UPGRADE_FAILURE_REASON_OVERALL_UPGRADE_TIMEOUT , "FABRIC_UPGRADE_FAILURE_REASON_OVERALL_UPGRADE_TIMEOUT" },
+{ FABRIC_UPGRADE_FAILURE_REASON_NONE , "FABRIC_UPGRADE_FAILURE_REASON_NONE" },
+{ FABRIC_UPGRADE_FAILURE_REASON_HEALTH_CHECK , "FABRIC_UPGRADE_FAILURE_REASON_HEALTH_CHECK" },
+{ FABRIC_UPGRADE_FAILURE_REASON_PROCESSING_FAILURE , "FABRIC_UPGRADE_FAILURE_REASON_PROCESSING_FAILURE" },
+{ FABRIC_UPGRADE_FAILURE_REASON_UPGRADE_DOMAIN_TIMEOUT , "FABRIC_UPGRADE_FAILURE_REASON_UPGRADE_DOMAIN_TIMEOUT" },
+{ FABRIC_UPGRADE_FAILURE_REASON_INTERRUPTED , "FABRIC_UPGRADE_FAILURE_REASON_INTERRUPTED" },
+};
+static const int32_t FABRIC_UPGRADE_FAILURE_REASON_Seeds[] ={
+-3, 0, 3, 1, 0, 0,
+};
+int MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _FromString)(const char* enumAsString, FABRIC_UPGRADE_FAILURE_REASON* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_FAILURE_REASON)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_FAILURE_REASON* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_FAILURE_REASON)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_LOCAL_STORE_KIND_Strings[FABRIC_LOCAL_STORE_KIND_ESE - FABRIC_LOCAL_STORE_KIND_INVALID + 1] ={
+[FABRIC_LOCAL_STORE_KIND_INVALID - FABRIC_LOCAL_STORE_KIND_INVALID] = "FABRIC_LOCAL_STORE_KIND_INVALID",
+[FABRIC_LOCAL_STORE_KIND_ESE - FABRIC_LOCAL_STORE_KIND_INVALID] = "FABRIC_LOCAL_STORE_KIND_ESE",
+};
+const char* MU_C3(MU_,FABRIC_LOCAL_STORE_KIND,_ToString)(FABRIC_LOCAL_STORE_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_LOCAL_STORE_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_LOCAL_STORE_KIND, _Strings))/sizeof(MU_C2(FABRIC_LOCAL_STORE_KIND, _Strings)[0])) && (MU_C2(FABRIC_LOCAL_STORE_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_LOCAL_STORE_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_LOCAL_STORE_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_LOCAL_STORE_KIND_ESE , "FABRIC_LOCAL_STORE_KIND_ESE" },
+{ FABRIC_LOCAL_STORE_KIND_INVALID , "FABRIC_LOCAL_STORE_KIND_INVALID" },
+};
+static const int32_t FABRIC_LOCAL_STORE_KIND_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_LOCAL_STORE_KIND, _FromString)(const char* enumAsString, FABRIC_LOCAL_STORE_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_LOCAL_STORE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_LOCAL_STORE_KIND, _Seeds), sizeof(MU_C2(FABRIC_LOCAL_STORE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_LOCAL_STORE_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_LOCAL_STORE_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_LOCAL_STORE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_LOCAL_STORE_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_LOCAL_STORE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_LOCAL_STORE_KIND, _Seeds), sizeof(MU_C2(FABRIC_LOCAL_STORE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_LOCAL_STORE_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_LOCAL_STORE_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_REPLICA_KIND_Strings[FABRIC_SERVICE_REPLICA_KIND_KEY_VALUE_STORE - FABRIC_SERVICE_REPLICA_KIND_INVALID + 1] ={
+[FABRIC_SERVICE_REPLICA_KIND_INVALID - FABRIC_SERVICE_REPLICA_KIND_INVALID] = "FABRIC_SERVICE_REPLICA_KIND_INVALID",
+[FABRIC_SERVICE_REPLICA_KIND_KEY_VALUE_STORE - FABRIC_SERVICE_REPLICA_KIND_INVALID] = "FABRIC_SERVICE_REPLICA_KIND_KEY_VALUE_STORE",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_REPLICA_KIND,_ToString)(FABRIC_SERVICE_REPLICA_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_REPLICA_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_REPLICA_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_REPLICA_KIND_KEY_VALUE_STORE , "FABRIC_SERVICE_REPLICA_KIND_KEY_VALUE_STORE" },
+{ FABRIC_SERVICE_REPLICA_KIND_INVALID , "FABRIC_SERVICE_REPLICA_KIND_INVALID" },
+};
+static const int32_t FABRIC_SERVICE_REPLICA_KIND_Seeds[] ={
+0, 1,
+};
+int MU_C2(FABRIC_SERVICE_REPLICA_KIND, _FromString)(const char* enumAsString, FABRIC_SERVICE_REPLICA_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_REPLICA_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_REPLICA_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_REPLICA_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_REPLICA_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_REPLICA_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_REPLICA_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_REPLICA_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_Strings[FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_BLOCK_SECONDARY_ACK - FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID + 1] ={
+[FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID - FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID] = "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID",
+[FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NONE - FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID] = "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NONE",
+[FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NON_BLOCKING_QUORUM_ACKED - FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID] = "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NON_BLOCKING_QUORUM_ACKED",
+[FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_BLOCK_SECONDARY_ACK - FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID] = "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_BLOCK_SECONDARY_ACK",
+};
+const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE,_ToString)(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Strings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Strings)[0])) && (MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_BLOCK_SECONDARY_ACK , "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_BLOCK_SECONDARY_ACK" },
+{ FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NON_BLOCKING_QUORUM_ACKED , "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NON_BLOCKING_QUORUM_ACKED" },
+{ FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID , "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID" },
+{ FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NONE , "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NONE" },
+};
+static const int32_t FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_Seeds[] ={
+-2, 0, -4, 1,
+};
+int MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_Strings[FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_REBUILD - FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT + 1] ={
+[FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT - FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT] = "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT",
+[FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_PHYSICAL - FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT] = "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_PHYSICAL",
+[FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_LOGICAL - FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT] = "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_LOGICAL",
+[FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_REBUILD - FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT] = "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_REBUILD",
+};
+const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE,_ToString)(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT;
+    if ((index < sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Strings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Strings)[0])) && (MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_LOGICAL , "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_LOGICAL" },
+{ FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_REBUILD , "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_REBUILD" },
+{ FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT , "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT" },
+{ FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_PHYSICAL , "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_PHYSICAL" },
+};
+static const int32_t FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_Seeds[] ={
+-2, 0, -4, 1,
+};
+int MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_TRANSACTION_ISOLATION_LEVEL_Strings[FABRIC_TRANSACTION_ISOLATION_LEVEL_SERIALIZABLE - FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT + 1] ={
+[FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT - FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT] = "FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT",
+[FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_UNCOMMITTED - FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT] = "FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_UNCOMMITTED",
+[FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_COMMITTED - FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT] = "FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_COMMITTED",
+[FABRIC_TRANSACTION_ISOLATION_LEVEL_REPEATABLE_READ - FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT] = "FABRIC_TRANSACTION_ISOLATION_LEVEL_REPEATABLE_READ",
+[FABRIC_TRANSACTION_ISOLATION_LEVEL_SNAPSHOT - FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT] = "FABRIC_TRANSACTION_ISOLATION_LEVEL_SNAPSHOT",
+[FABRIC_TRANSACTION_ISOLATION_LEVEL_SERIALIZABLE - FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT] = "FABRIC_TRANSACTION_ISOLATION_LEVEL_SERIALIZABLE",
+};
+const char* MU_C3(MU_,FABRIC_TRANSACTION_ISOLATION_LEVEL,_ToString)(FABRIC_TRANSACTION_ISOLATION_LEVEL value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT;
+    if ((index < sizeof(MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Strings))/sizeof(MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Strings)[0])) && (MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_TRANSACTION_ISOLATION_LEVEL_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_UNCOMMITTED , "FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_UNCOMMITTED" },
+{ FABRIC_TRANSACTION_ISOLATION_LEVEL_SERIALIZABLE , "FABRIC_TRANSACTION_ISOLATION_LEVEL_SERIALIZABLE" },
+{ FABRIC_TRANSACTION_ISOLATION_LEVEL_REPEATABLE_READ , "FABRIC_TRANSACTION_ISOLATION_LEVEL_REPEATABLE_READ" },
+{ FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT , "FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT" },
+{ FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_COMMITTED , "FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_COMMITTED" },
+{ FABRIC_TRANSACTION_ISOLATION_LEVEL_SNAPSHOT , "FABRIC_TRANSACTION_ISOLATION_LEVEL_SNAPSHOT" },
+};
+static const int32_t FABRIC_TRANSACTION_ISOLATION_LEVEL_Seeds[] ={
+0, -1, -2, 2, -3, -6,
+};
+int MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _FromString)(const char* enumAsString, FABRIC_TRANSACTION_ISOLATION_LEVEL* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Seeds), sizeof(MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Seeds))/sizeof(MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TRANSACTION_ISOLATION_LEVEL)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TRANSACTION_ISOLATION_LEVEL* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Seeds), sizeof(MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Seeds))/sizeof(MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TRANSACTION_ISOLATION_LEVEL)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_NODE_DEACTIVATION_INTENT_Strings[FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_NODE - FABRIC_NODE_DEACTIVATION_INTENT_INVALID + 1] ={
+[FABRIC_NODE_DEACTIVATION_INTENT_INVALID - FABRIC_NODE_DEACTIVATION_INTENT_INVALID] = "FABRIC_NODE_DEACTIVATION_INTENT_INVALID",
+[FABRIC_NODE_DEACTIVATION_INTENT_PAUSE - FABRIC_NODE_DEACTIVATION_INTENT_INVALID] = "FABRIC_NODE_DEACTIVATION_INTENT_PAUSE",
+[FABRIC_NODE_DEACTIVATION_INTENT_RESTART - FABRIC_NODE_DEACTIVATION_INTENT_INVALID] = "FABRIC_NODE_DEACTIVATION_INTENT_RESTART",
+[FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_DATA - FABRIC_NODE_DEACTIVATION_INTENT_INVALID] = "FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_DATA",
+[FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_NODE - FABRIC_NODE_DEACTIVATION_INTENT_INVALID] = "FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_NODE",
+};
+const char* MU_C3(MU_,FABRIC_NODE_DEACTIVATION_INTENT,_ToString)(FABRIC_NODE_DEACTIVATION_INTENT value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_NODE_DEACTIVATION_INTENT_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Strings))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Strings)[0])) && (MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_NODE_DEACTIVATION_INTENT_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_NODE , "FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_NODE" },
+{ FABRIC_NODE_DEACTIVATION_INTENT_INVALID , "FABRIC_NODE_DEACTIVATION_INTENT_INVALID" },
+{ FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_DATA , "FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_DATA" },
+{ FABRIC_NODE_DEACTIVATION_INTENT_RESTART , "FABRIC_NODE_DEACTIVATION_INTENT_RESTART" },
+{ FABRIC_NODE_DEACTIVATION_INTENT_PAUSE , "FABRIC_NODE_DEACTIVATION_INTENT_PAUSE" },
+};
+static const int32_t FABRIC_NODE_DEACTIVATION_INTENT_Seeds[] ={
+-1, -2, 1, 0, -5,
+};
+int MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _FromString)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_INTENT* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Seeds), sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Seeds))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NODE_DEACTIVATION_INTENT)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_INTENT* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Seeds), sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Seeds))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NODE_DEACTIVATION_INTENT)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_DISABLE_FLAG_Strings[FABRIC_SERVICE_DISABLE_FLAG_REMOVE_DATA - FABRIC_SERVICE_DISABLE_FLAG_INVALID + 1] ={
+[FABRIC_SERVICE_DISABLE_FLAG_INVALID - FABRIC_SERVICE_DISABLE_FLAG_INVALID] = "FABRIC_SERVICE_DISABLE_FLAG_INVALID",
+[FABRIC_SERVICE_DISABLE_FLAG_REMOVE_DATA - FABRIC_SERVICE_DISABLE_FLAG_INVALID] = "FABRIC_SERVICE_DISABLE_FLAG_REMOVE_DATA",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_DISABLE_FLAG,_ToString)(FABRIC_SERVICE_DISABLE_FLAG value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_DISABLE_FLAG_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_DISABLE_FLAG_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_DISABLE_FLAG_INVALID , "FABRIC_SERVICE_DISABLE_FLAG_INVALID" },
+{ FABRIC_SERVICE_DISABLE_FLAG_REMOVE_DATA , "FABRIC_SERVICE_DISABLE_FLAG_REMOVE_DATA" },
+};
+static const int32_t FABRIC_SERVICE_DISABLE_FLAG_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _FromString)(const char* enumAsString, FABRIC_SERVICE_DISABLE_FLAG* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_DISABLE_FLAG)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_DISABLE_FLAG* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_DISABLE_FLAG)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_APPLICATION_TYPE_STATUS_Strings[FABRIC_APPLICATION_TYPE_STATUS_FAILED - FABRIC_APPLICATION_TYPE_STATUS_INVALID + 1] ={
+[FABRIC_APPLICATION_TYPE_STATUS_INVALID - FABRIC_APPLICATION_TYPE_STATUS_INVALID] = "FABRIC_APPLICATION_TYPE_STATUS_INVALID",
+[FABRIC_APPLICATION_TYPE_STATUS_PROVISIONING - FABRIC_APPLICATION_TYPE_STATUS_INVALID] = "FABRIC_APPLICATION_TYPE_STATUS_PROVISIONING",
+[FABRIC_APPLICATION_TYPE_STATUS_AVAILABLE - FABRIC_APPLICATION_TYPE_STATUS_INVALID] = "FABRIC_APPLICATION_TYPE_STATUS_AVAILABLE",
+[FABRIC_APPLICATION_TYPE_STATUS_UNPROVISIONING - FABRIC_APPLICATION_TYPE_STATUS_INVALID] = "FABRIC_APPLICATION_TYPE_STATUS_UNPROVISIONING",
+[FABRIC_APPLICATION_TYPE_STATUS_FAILED - FABRIC_APPLICATION_TYPE_STATUS_INVALID] = "FABRIC_APPLICATION_TYPE_STATUS_FAILED",
+};
+const char* MU_C3(MU_,FABRIC_APPLICATION_TYPE_STATUS,_ToString)(FABRIC_APPLICATION_TYPE_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_APPLICATION_TYPE_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Strings))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Strings)[0])) && (MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_TYPE_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_TYPE_STATUS_PROVISIONING , "FABRIC_APPLICATION_TYPE_STATUS_PROVISIONING" },
+{ FABRIC_APPLICATION_TYPE_STATUS_FAILED , "FABRIC_APPLICATION_TYPE_STATUS_FAILED" },
+{ FABRIC_APPLICATION_TYPE_STATUS_AVAILABLE , "FABRIC_APPLICATION_TYPE_STATUS_AVAILABLE" },
+{ FABRIC_APPLICATION_TYPE_STATUS_UNPROVISIONING , "FABRIC_APPLICATION_TYPE_STATUS_UNPROVISIONING" },
+{ FABRIC_APPLICATION_TYPE_STATUS_INVALID , "FABRIC_APPLICATION_TYPE_STATUS_INVALID" },
+};
+static const int32_t FABRIC_APPLICATION_TYPE_STATUS_Seeds[] ={
+-3, -5, 1, 0, 0,
+};
+int MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _FromString)(const char* enumAsString, FABRIC_APPLICATION_TYPE_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_TYPE_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_TYPE_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_TYPE_STATUS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_APPLICATION_STATUS_Strings[FABRIC_APPLICATION_STATUS_FAILED - FABRIC_APPLICATION_STATUS_INVALID + 1] ={
+[FABRIC_APPLICATION_STATUS_INVALID - FABRIC_APPLICATION_STATUS_INVALID] = "FABRIC_APPLICATION_STATUS_INVALID",
+[FABRIC_APPLICATION_STATUS_READY - FABRIC_APPLICATION_STATUS_INVALID] = "FABRIC_APPLICATION_STATUS_READY",
+[FABRIC_APPLICATION_STATUS_UPGRADING - FABRIC_APPLICATION_STATUS_INVALID] = "FABRIC_APPLICATION_STATUS_UPGRADING",
+[FABRIC_APPLICATION_STATUS_CREATING - FABRIC_APPLICATION_STATUS_INVALID] = "FABRIC_APPLICATION_STATUS_CREATING",
+[FABRIC_APPLICATION_STATUS_DELETING - FABRIC_APPLICATION_STATUS_INVALID] = "FABRIC_APPLICATION_STATUS_DELETING",
+[FABRIC_APPLICATION_STATUS_FAILED - FABRIC_APPLICATION_STATUS_INVALID] = "FABRIC_APPLICATION_STATUS_FAILED",
+};
+const char* MU_C3(MU_,FABRIC_APPLICATION_STATUS,_ToString)(FABRIC_APPLICATION_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_APPLICATION_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_APPLICATION_STATUS, _Strings))/sizeof(MU_C2(FABRIC_APPLICATION_STATUS, _Strings)[0])) && (MU_C2(FABRIC_APPLICATION_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_APPLICATION_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_STATUS_READY , "FABRIC_APPLICATION_STATUS_READY" },
+{ FABRIC_APPLICATION_STATUS_INVALID , "FABRIC_APPLICATION_STATUS_INVALID" },
+{ FABRIC_APPLICATION_STATUS_UPGRADING , "FABRIC_APPLICATION_STATUS_UPGRADING" },
+{ FABRIC_APPLICATION_STATUS_CREATING , "FABRIC_APPLICATION_STATUS_CREATING" },
+{ FABRIC_APPLICATION_STATUS_FAILED , "FABRIC_APPLICATION_STATUS_FAILED" },
+{ FABRIC_APPLICATION_STATUS_DELETING , "FABRIC_APPLICATION_STATUS_DELETING" },
+};
+static const int32_t FABRIC_APPLICATION_STATUS_Seeds[] ={
+-1, 0, 0, 1, 3, -2,
+};
+int MU_C2(FABRIC_APPLICATION_STATUS, _FromString)(const char* enumAsString, FABRIC_APPLICATION_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_APPLICATION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_STATUS)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_DEFINITION_KIND_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_APPLICATION_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_COMPOSE , "FABRIC_APPLICATION_DEFINITION_KIND_COMPOSE" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_INVALID , "FABRIC_APPLICATION_DEFINITION_KIND_INVALID" },
+};
+const char* MU_C3(MU_,FABRIC_APPLICATION_DEFINITION_KIND,_ToString)(FABRIC_APPLICATION_DEFINITION_KIND value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _ValuesAndStrings)[middle].value > (int)value)
         {
-            return MU_C2(FABRIC_DLLHOST_ISOLATION_POLICY, _ValuesAndStrings)[i].valueAsString;
+            high = middle;
         }
+        else
+        {
+            return MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_DEFINITION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_INVALID , "FABRIC_APPLICATION_DEFINITION_KIND_INVALID" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_COMPOSE , "FABRIC_APPLICATION_DEFINITION_KIND_COMPOSE" },
+};
+static const int32_t FABRIC_APPLICATION_DEFINITION_KIND_Seeds[] ={
+2, -1, 0, -3,
+};
+int MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _FromString)(const char* enumAsString, FABRIC_APPLICATION_DEFINITION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_DEFINITION_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_DEFINITION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_DEFINITION_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_APPLICATION_TYPE_DEFINITION_KIND_Strings[FABRIC_APPLICATION_TYPE_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION - FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID + 1] ={
+[FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID - FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID] = "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID",
+[FABRIC_APPLICATION_TYPE_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_PACKAGE - FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID] = "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_PACKAGE",
+[FABRIC_APPLICATION_TYPE_DEFINITION_KIND_COMPOSE - FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID] = "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_COMPOSE",
+[FABRIC_APPLICATION_TYPE_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION - FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID] = "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION",
+};
+const char* MU_C3(MU_,FABRIC_APPLICATION_TYPE_DEFINITION_KIND,_ToString)(FABRIC_APPLICATION_TYPE_DEFINITION_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Strings))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Strings)[0])) && (MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_TYPE_DEFINITION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_PACKAGE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_PACKAGE" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_COMPOSE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_COMPOSE" },
+};
+static const int32_t FABRIC_APPLICATION_TYPE_DEFINITION_KIND_Seeds[] ={
+3, -1, -3, 0,
+};
+int MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _FromString)(const char* enumAsString, FABRIC_APPLICATION_TYPE_DEFINITION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_TYPE_DEFINITION_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_TYPE_DEFINITION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_TYPE_DEFINITION_KIND)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_DEFINITION_KIND_FILTER_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_DEFAULT , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_DEFAULT" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_COMPOSE , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_COMPOSE" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_ALL , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_ALL" },
+};
+const char* MU_C3(MU_,FABRIC_APPLICATION_DEFINITION_KIND_FILTER,_ToString)(FABRIC_APPLICATION_DEFINITION_KIND_FILTER value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_DEFINITION_KIND_FILTER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_COMPOSE , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_COMPOSE" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_DEFAULT , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_DEFAULT" },
+{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_ALL , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_ALL" },
+};
+static const int32_t FABRIC_APPLICATION_DEFINITION_KIND_FILTER_Seeds[] ={
+-2, 1, -3, -5, 0,
+};
+int MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _FromString)(const char* enumAsString, FABRIC_APPLICATION_DEFINITION_KIND_FILTER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_DEFINITION_KIND_FILTER)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_DEFINITION_KIND_FILTER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_DEFINITION_KIND_FILTER)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_DEFAULT , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_DEFAULT" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_PACKAGE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_PACKAGE" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_COMPOSE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_COMPOSE" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_ALL , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_ALL" },
+};
+const char* MU_C3(MU_,FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER,_ToString)(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER value)
+{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _ValuesAndStrings)[0]);
+    while(low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _ValuesAndStrings)[middle].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_DEFAULT , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_DEFAULT" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_COMPOSE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_COMPOSE" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_ALL , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_ALL" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_PACKAGE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_PACKAGE" },
+{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION" },
+};
+static const int32_t FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_Seeds[] ={
+0, -5, 1, 0, 7,
+};
+int MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _FromString)(const char* enumAsString, FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_Strings[FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_REGISTERED - FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID + 1] ={
+[FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID - FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID] = "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID",
+[FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_DISABLED - FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID] = "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_DISABLED",
+[FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_NOT_REGISTERED - FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID] = "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_NOT_REGISTERED",
+[FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_REGISTERED - FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID] = "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_REGISTERED",
+};
+const char* MU_C3(MU_,FABRIC_SERVICE_TYPE_REGISTRATION_STATUS,_ToString)(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_DISABLED , "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_DISABLED" },
+{ FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_REGISTERED , "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_REGISTERED" },
+{ FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_NOT_REGISTERED , "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_NOT_REGISTERED" },
+{ FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID , "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID" },
+};
+static const int32_t FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_Seeds[] ={
+0, 0, -4, 1,
+};
+int MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _FromString)(const char* enumAsString, FABRIC_SERVICE_TYPE_REGISTRATION_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_TYPE_REGISTRATION_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_TYPE_REGISTRATION_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_TYPE_REGISTRATION_STATUS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_DEPLOYMENT_STATUS_Strings[FABRIC_DEPLOYMENT_STATUS_FAILED - FABRIC_DEPLOYMENT_STATUS_INVALID + 1] ={
+[FABRIC_DEPLOYMENT_STATUS_INVALID - FABRIC_DEPLOYMENT_STATUS_INVALID] = "FABRIC_DEPLOYMENT_STATUS_INVALID",
+[FABRIC_DEPLOYMENT_STATUS_DOWNLOADING - FABRIC_DEPLOYMENT_STATUS_INVALID] = "FABRIC_DEPLOYMENT_STATUS_DOWNLOADING",
+[FABRIC_DEPLOYMENT_STATUS_ACTIVATING - FABRIC_DEPLOYMENT_STATUS_INVALID] = "FABRIC_DEPLOYMENT_STATUS_ACTIVATING",
+[FABRIC_DEPLOYMENT_STATUS_ACTIVE - FABRIC_DEPLOYMENT_STATUS_INVALID] = "FABRIC_DEPLOYMENT_STATUS_ACTIVE",
+[FABRIC_DEPLOYMENT_STATUS_UPGRADING - FABRIC_DEPLOYMENT_STATUS_INVALID] = "FABRIC_DEPLOYMENT_STATUS_UPGRADING",
+[FABRIC_DEPLOYMENT_STATUS_DEACTIVATING - FABRIC_DEPLOYMENT_STATUS_INVALID] = "FABRIC_DEPLOYMENT_STATUS_DEACTIVATING",
+[FABRIC_DEPLOYMENT_STATUS_RAN_TO_COMPLETION - FABRIC_DEPLOYMENT_STATUS_INVALID] = "FABRIC_DEPLOYMENT_STATUS_RAN_TO_COMPLETION",
+[FABRIC_DEPLOYMENT_STATUS_FAILED - FABRIC_DEPLOYMENT_STATUS_INVALID] = "FABRIC_DEPLOYMENT_STATUS_FAILED",
+};
+const char* MU_C3(MU_,FABRIC_DEPLOYMENT_STATUS,_ToString)(FABRIC_DEPLOYMENT_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_DEPLOYMENT_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_DEPLOYMENT_STATUS, _Strings))/sizeof(MU_C2(FABRIC_DEPLOYMENT_STATUS, _Strings)[0])) && (MU_C2(FABRIC_DEPLOYMENT_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_DEPLOYMENT_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_DEPLOYMENT_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_DEPLOYMENT_STATUS_ACTIVATING , "FABRIC_DEPLOYMENT_STATUS_ACTIVATING" },
+{ FABRIC_DEPLOYMENT_STATUS_UPGRADING , "FABRIC_DEPLOYMENT_STATUS_UPGRADING" },
+{ FABRIC_DEPLOYMENT_STATUS_DOWNLOADING , "FABRIC_DEPLOYMENT_STATUS_DOWNLOADING" },
+{ FABRIC_DEPLOYMENT_STATUS_INVALID , "FABRIC_DEPLOYMENT_STATUS_INVALID" },
+{ FABRIC_DEPLOYMENT_STATUS_DEACTIVATING , "FABRIC_DEPLOYMENT_STATUS_DEACTIVATING" },
+{ FABRIC_DEPLOYMENT_STATUS_FAILED , "FABRIC_DEPLOYMENT_STATUS_FAILED" },
+{ FABRIC_DEPLOYMENT_STATUS_ACTIVE , "FABRIC_DEPLOYMENT_STATUS_ACTIVE" },
+{ FABRIC_DEPLOYMENT_STATUS_RAN_TO_COMPLETION , "FABRIC_DEPLOYMENT_STATUS_RAN_TO_COMPLETION" },
+};
+static const int32_t FABRIC_DEPLOYMENT_STATUS_Seeds[] ={
+-1, -3, 0, -5, -6, 0, 1, -7,
+};
+int MU_C2(FABRIC_DEPLOYMENT_STATUS, _FromString)(const char* enumAsString, FABRIC_DEPLOYMENT_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DEPLOYMENT_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DEPLOYMENT_STATUS, _Seeds), sizeof(MU_C2(FABRIC_DEPLOYMENT_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_DEPLOYMENT_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DEPLOYMENT_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_DEPLOYMENT_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DEPLOYMENT_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DEPLOYMENT_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DEPLOYMENT_STATUS, _Seeds), sizeof(MU_C2(FABRIC_DEPLOYMENT_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_DEPLOYMENT_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DEPLOYMENT_STATUS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_HOST_TYPE_Strings[FABRIC_HOST_TYPE_CONTAINER_HOST - FABRIC_HOST_TYPE_INVALID + 1] ={
+[FABRIC_HOST_TYPE_INVALID - FABRIC_HOST_TYPE_INVALID] = "FABRIC_HOST_TYPE_INVALID",
+[FABRIC_HOST_TYPE_EXE_HOST - FABRIC_HOST_TYPE_INVALID] = "FABRIC_HOST_TYPE_EXE_HOST",
+[FABRIC_HOST_TYPE_CONTAINER_HOST - FABRIC_HOST_TYPE_INVALID] = "FABRIC_HOST_TYPE_CONTAINER_HOST",
+};
+const char* MU_C3(MU_,FABRIC_HOST_TYPE,_ToString)(FABRIC_HOST_TYPE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_HOST_TYPE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_HOST_TYPE, _Strings))/sizeof(MU_C2(FABRIC_HOST_TYPE, _Strings)[0])) && (MU_C2(FABRIC_HOST_TYPE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_HOST_TYPE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_HOST_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_HOST_TYPE_INVALID , "FABRIC_HOST_TYPE_INVALID" },
+{ FABRIC_HOST_TYPE_CONTAINER_HOST , "FABRIC_HOST_TYPE_CONTAINER_HOST" },
+{ FABRIC_HOST_TYPE_EXE_HOST , "FABRIC_HOST_TYPE_EXE_HOST" },
+};
+static const int32_t FABRIC_HOST_TYPE_Seeds[] ={
+-1, -2, -3,
+};
+int MU_C2(FABRIC_HOST_TYPE, _FromString)(const char* enumAsString, FABRIC_HOST_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HOST_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HOST_TYPE, _Seeds), sizeof(MU_C2(FABRIC_HOST_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_HOST_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HOST_TYPE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_HOST_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HOST_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HOST_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HOST_TYPE, _Seeds), sizeof(MU_C2(FABRIC_HOST_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_HOST_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HOST_TYPE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_HOST_ISOLATION_MODE_Strings[FABRIC_HOST_ISOLATION_MODE_HYPER_V - FABRIC_HOST_ISOLATION_MODE_NONE + 1] ={
+[FABRIC_HOST_ISOLATION_MODE_NONE - FABRIC_HOST_ISOLATION_MODE_NONE] = "FABRIC_HOST_ISOLATION_MODE_NONE",
+[FABRIC_HOST_ISOLATION_MODE_PROCESS - FABRIC_HOST_ISOLATION_MODE_NONE] = "FABRIC_HOST_ISOLATION_MODE_PROCESS",
+[FABRIC_HOST_ISOLATION_MODE_HYPER_V - FABRIC_HOST_ISOLATION_MODE_NONE] = "FABRIC_HOST_ISOLATION_MODE_HYPER_V",
+};
+const char* MU_C3(MU_,FABRIC_HOST_ISOLATION_MODE,_ToString)(FABRIC_HOST_ISOLATION_MODE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_HOST_ISOLATION_MODE_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_HOST_ISOLATION_MODE, _Strings))/sizeof(MU_C2(FABRIC_HOST_ISOLATION_MODE, _Strings)[0])) && (MU_C2(FABRIC_HOST_ISOLATION_MODE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_HOST_ISOLATION_MODE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_HOST_ISOLATION_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_HOST_ISOLATION_MODE_NONE , "FABRIC_HOST_ISOLATION_MODE_NONE" },
+{ FABRIC_HOST_ISOLATION_MODE_PROCESS , "FABRIC_HOST_ISOLATION_MODE_PROCESS" },
+{ FABRIC_HOST_ISOLATION_MODE_HYPER_V , "FABRIC_HOST_ISOLATION_MODE_HYPER_V" },
+};
+static const int32_t FABRIC_HOST_ISOLATION_MODE_Seeds[] ={
+2, -1, 0,
+};
+int MU_C2(FABRIC_HOST_ISOLATION_MODE, _FromString)(const char* enumAsString, FABRIC_HOST_ISOLATION_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HOST_ISOLATION_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HOST_ISOLATION_MODE, _Seeds), sizeof(MU_C2(FABRIC_HOST_ISOLATION_MODE, _Seeds))/sizeof(MU_C2(FABRIC_HOST_ISOLATION_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HOST_ISOLATION_MODE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_HOST_ISOLATION_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HOST_ISOLATION_MODE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HOST_ISOLATION_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HOST_ISOLATION_MODE, _Seeds), sizeof(MU_C2(FABRIC_HOST_ISOLATION_MODE, _Seeds))/sizeof(MU_C2(FABRIC_HOST_ISOLATION_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HOST_ISOLATION_MODE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_ENTRY_POINT_STATUS_Strings[FABRIC_ENTRY_POINT_STATUS_STOPPED - FABRIC_ENTRY_POINT_STATUS_INVALID + 1] ={
+[FABRIC_ENTRY_POINT_STATUS_INVALID - FABRIC_ENTRY_POINT_STATUS_INVALID] = "FABRIC_ENTRY_POINT_STATUS_INVALID",
+[FABRIC_ENTRY_POINT_STATUS_PENDING - FABRIC_ENTRY_POINT_STATUS_INVALID] = "FABRIC_ENTRY_POINT_STATUS_PENDING",
+[FABRIC_ENTRY_POINT_STATUS_STARTING - FABRIC_ENTRY_POINT_STATUS_INVALID] = "FABRIC_ENTRY_POINT_STATUS_STARTING",
+[FABRIC_ENTRY_POINT_STATUS_STARTED - FABRIC_ENTRY_POINT_STATUS_INVALID] = "FABRIC_ENTRY_POINT_STATUS_STARTED",
+[FABRIC_ENTRY_POINT_STATUS_STOPPING - FABRIC_ENTRY_POINT_STATUS_INVALID] = "FABRIC_ENTRY_POINT_STATUS_STOPPING",
+[FABRIC_ENTRY_POINT_STATUS_STOPPED - FABRIC_ENTRY_POINT_STATUS_INVALID] = "FABRIC_ENTRY_POINT_STATUS_STOPPED",
+};
+const char* MU_C3(MU_,FABRIC_ENTRY_POINT_STATUS,_ToString)(FABRIC_ENTRY_POINT_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_ENTRY_POINT_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_ENTRY_POINT_STATUS, _Strings))/sizeof(MU_C2(FABRIC_ENTRY_POINT_STATUS, _Strings)[0])) && (MU_C2(FABRIC_ENTRY_POINT_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_ENTRY_POINT_STATUS, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_ENTRY_POINT_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_ENTRY_POINT_STATUS_STOPPING , "FABRIC_ENTRY_POINT_STATUS_STOPPING" },
+{ FABRIC_ENTRY_POINT_STATUS_STARTED , "FABRIC_ENTRY_POINT_STATUS_STARTED" },
+{ FABRIC_ENTRY_POINT_STATUS_STARTING , "FABRIC_ENTRY_POINT_STATUS_STARTING" },
+{ FABRIC_ENTRY_POINT_STATUS_STOPPED , "FABRIC_ENTRY_POINT_STATUS_STOPPED" },
+{ FABRIC_ENTRY_POINT_STATUS_PENDING , "FABRIC_ENTRY_POINT_STATUS_PENDING" },
+{ FABRIC_ENTRY_POINT_STATUS_INVALID , "FABRIC_ENTRY_POINT_STATUS_INVALID" },
+};
+static const int32_t FABRIC_ENTRY_POINT_STATUS_Seeds[] ={
+0, -2, -3, -5, 1, -6,
+};
+int MU_C2(FABRIC_ENTRY_POINT_STATUS, _FromString)(const char* enumAsString, FABRIC_ENTRY_POINT_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ENTRY_POINT_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ENTRY_POINT_STATUS, _Seeds), sizeof(MU_C2(FABRIC_ENTRY_POINT_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_ENTRY_POINT_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ENTRY_POINT_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_ENTRY_POINT_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ENTRY_POINT_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ENTRY_POINT_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ENTRY_POINT_STATUS, _Seeds), sizeof(MU_C2(FABRIC_ENTRY_POINT_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_ENTRY_POINT_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ENTRY_POINT_STATUS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_NODE_UPGRADE_PHASE_Strings[FABRIC_NODE_UPGRADE_PHASE_POST_UPGRADE_SAFETY_CHECK - FABRIC_NODE_UPGRADE_PHASE_INVALID + 1] ={
+[FABRIC_NODE_UPGRADE_PHASE_INVALID - FABRIC_NODE_UPGRADE_PHASE_INVALID] = "FABRIC_NODE_UPGRADE_PHASE_INVALID",
+[FABRIC_NODE_UPGRADE_PHASE_PRE_UPGRADE_SAFETY_CHECK - FABRIC_NODE_UPGRADE_PHASE_INVALID] = "FABRIC_NODE_UPGRADE_PHASE_PRE_UPGRADE_SAFETY_CHECK",
+[FABRIC_NODE_UPGRADE_PHASE_UPGRADING - FABRIC_NODE_UPGRADE_PHASE_INVALID] = "FABRIC_NODE_UPGRADE_PHASE_UPGRADING",
+[FABRIC_NODE_UPGRADE_PHASE_POST_UPGRADE_SAFETY_CHECK - FABRIC_NODE_UPGRADE_PHASE_INVALID] = "FABRIC_NODE_UPGRADE_PHASE_POST_UPGRADE_SAFETY_CHECK",
+};
+const char* MU_C3(MU_,FABRIC_NODE_UPGRADE_PHASE,_ToString)(FABRIC_NODE_UPGRADE_PHASE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_NODE_UPGRADE_PHASE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Strings))/sizeof(MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Strings)[0])) && (MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_NODE_UPGRADE_PHASE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_NODE_UPGRADE_PHASE_PRE_UPGRADE_SAFETY_CHECK , "FABRIC_NODE_UPGRADE_PHASE_PRE_UPGRADE_SAFETY_CHECK" },
+{ FABRIC_NODE_UPGRADE_PHASE_INVALID , "FABRIC_NODE_UPGRADE_PHASE_INVALID" },
+{ FABRIC_NODE_UPGRADE_PHASE_UPGRADING , "FABRIC_NODE_UPGRADE_PHASE_UPGRADING" },
+{ FABRIC_NODE_UPGRADE_PHASE_POST_UPGRADE_SAFETY_CHECK , "FABRIC_NODE_UPGRADE_PHASE_POST_UPGRADE_SAFETY_CHECK" },
+};
+static const int32_t FABRIC_NODE_UPGRADE_PHASE_Seeds[] ={
+0, 1, 8, 0,
+};
+int MU_C2(FABRIC_NODE_UPGRADE_PHASE, _FromString)(const char* enumAsString, FABRIC_NODE_UPGRADE_PHASE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_UPGRADE_PHASE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Seeds), sizeof(MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Seeds))/sizeof(MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NODE_UPGRADE_PHASE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_NODE_UPGRADE_PHASE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_UPGRADE_PHASE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_UPGRADE_PHASE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Seeds), sizeof(MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Seeds))/sizeof(MU_C2(FABRIC_NODE_UPGRADE_PHASE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NODE_UPGRADE_PHASE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_UPGRADE_SAFETY_CHECK_KIND_Strings[FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RESOURCE_AVAILABILITY - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID + 1] ={
+[FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID] = "FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID",
+[FABRIC_UPGRADE_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID] = "FABRIC_UPGRADE_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM",
+[FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID] = "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM",
+[FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID] = "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT",
+[FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID] = "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP",
+[FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID] = "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION",
+[FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID] = "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA",
+[FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID] = "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY",
+[FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RESOURCE_AVAILABILITY - FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID] = "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RESOURCE_AVAILABILITY",
+};
+const char* MU_C3(MU_,FABRIC_UPGRADE_SAFETY_CHECK_KIND,_ToString)(FABRIC_UPGRADE_SAFETY_CHECK_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Strings))/sizeof(MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Strings)[0])) && (MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_UPGRADE_SAFETY_CHECK_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RESOURCE_AVAILABILITY , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RESOURCE_AVAILABILITY" },
+{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT" },
+{ FABRIC_UPGRADE_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM , "FABRIC_UPGRADE_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM" },
+{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA" },
+{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM" },
+{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY" },
+{ FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID , "FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID" },
+{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP" },
+{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION" },
+};
+static const int32_t FABRIC_UPGRADE_SAFETY_CHECK_KIND_Seeds[] ={
+-2, 1, 0, 0, 1, -4, -5, -8, -9,
+};
+int MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _FromString)(const char* enumAsString, FABRIC_UPGRADE_SAFETY_CHECK_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_SAFETY_CHECK_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_UPGRADE_SAFETY_CHECK_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Seeds), sizeof(MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Seeds))/sizeof(MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_UPGRADE_SAFETY_CHECK_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_SAFETY_CHECK_KIND_Strings[FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY - FABRIC_SAFETY_CHECK_KIND_INVALID + 1] ={
+[FABRIC_SAFETY_CHECK_KIND_INVALID - FABRIC_SAFETY_CHECK_KIND_INVALID] = "FABRIC_SAFETY_CHECK_KIND_INVALID",
+[FABRIC_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM - FABRIC_SAFETY_CHECK_KIND_INVALID] = "FABRIC_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM",
+[FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM - FABRIC_SAFETY_CHECK_KIND_INVALID] = "FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM",
+[FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT - FABRIC_SAFETY_CHECK_KIND_INVALID] = "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT",
+[FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP - FABRIC_SAFETY_CHECK_KIND_INVALID] = "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP",
+[FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION - FABRIC_SAFETY_CHECK_KIND_INVALID] = "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION",
+[FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA - FABRIC_SAFETY_CHECK_KIND_INVALID] = "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA",
+[FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY - FABRIC_SAFETY_CHECK_KIND_INVALID] = "FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY",
+};
+const char* MU_C3(MU_,FABRIC_SAFETY_CHECK_KIND,_ToString)(FABRIC_SAFETY_CHECK_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SAFETY_CHECK_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SAFETY_CHECK_KIND, _Strings))/sizeof(MU_C2(FABRIC_SAFETY_CHECK_KIND, _Strings)[0])) && (MU_C2(FABRIC_SAFETY_CHECK_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_SAFETY_CHECK_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_SAFETY_CHECK_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY , "FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY" },
+{ FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM , "FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM" },
+{ FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT , "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT" },
+{ FABRIC_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM , "FABRIC_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM" },
+{ FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION , "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION" },
+{ FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA , "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA" },
+{ FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP , "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP" },
+{ FABRIC_SAFETY_CHECK_KIND_INVALID , "FABRIC_SAFETY_CHECK_KIND_INVALID" },
+};
+static const int32_t FABRIC_SAFETY_CHECK_KIND_Seeds[] ={
+0, -1, -4, 2, -5, -8, 1, 0,
+};
+int MU_C2(FABRIC_SAFETY_CHECK_KIND, _FromString)(const char* enumAsString, FABRIC_SAFETY_CHECK_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SAFETY_CHECK_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SAFETY_CHECK_KIND, _Seeds), sizeof(MU_C2(FABRIC_SAFETY_CHECK_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SAFETY_CHECK_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SAFETY_CHECK_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_SAFETY_CHECK_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SAFETY_CHECK_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SAFETY_CHECK_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SAFETY_CHECK_KIND, _Seeds), sizeof(MU_C2(FABRIC_SAFETY_CHECK_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SAFETY_CHECK_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SAFETY_CHECK_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_Strings[FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_CLUSTER - FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID + 1] ={
+[FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID - FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID] = "FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID",
+[FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_CLUSTER - FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID] = "FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_CLUSTER",
+};
+const char* MU_C3(MU_,FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND,_ToString)(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Strings))/sizeof(MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Strings)[0])) && (MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_CLUSTER , "FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_CLUSTER" },
+{ FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID , "FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID" },
+};
+static const int32_t FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _FromString)(const char* enumAsString, FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPAIR_TARGET_KIND_Strings[FABRIC_REPAIR_TARGET_KIND_NODE - FABRIC_REPAIR_TARGET_KIND_INVALID + 1] ={
+[FABRIC_REPAIR_TARGET_KIND_INVALID - FABRIC_REPAIR_TARGET_KIND_INVALID] = "FABRIC_REPAIR_TARGET_KIND_INVALID",
+[FABRIC_REPAIR_TARGET_KIND_NODE - FABRIC_REPAIR_TARGET_KIND_INVALID] = "FABRIC_REPAIR_TARGET_KIND_NODE",
+};
+const char* MU_C3(MU_,FABRIC_REPAIR_TARGET_KIND,_ToString)(FABRIC_REPAIR_TARGET_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPAIR_TARGET_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_REPAIR_TARGET_KIND, _Strings))/sizeof(MU_C2(FABRIC_REPAIR_TARGET_KIND, _Strings)[0])) && (MU_C2(FABRIC_REPAIR_TARGET_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPAIR_TARGET_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_TARGET_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPAIR_TARGET_KIND_NODE , "FABRIC_REPAIR_TARGET_KIND_NODE" },
+{ FABRIC_REPAIR_TARGET_KIND_INVALID , "FABRIC_REPAIR_TARGET_KIND_INVALID" },
+};
+static const int32_t FABRIC_REPAIR_TARGET_KIND_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_REPAIR_TARGET_KIND, _FromString)(const char* enumAsString, FABRIC_REPAIR_TARGET_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TARGET_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TARGET_KIND, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TARGET_KIND, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TARGET_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TARGET_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPAIR_TARGET_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TARGET_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TARGET_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TARGET_KIND, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TARGET_KIND, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TARGET_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TARGET_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_RESTART_NODE_DESCRIPTION_KIND_Strings[FABRIC_RESTART_NODE_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID + 1] ={
+[FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID - FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID] = "FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID",
+[FABRIC_RESTART_NODE_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID] = "FABRIC_RESTART_NODE_DESCRIPTION_KIND_USING_NODE_NAME",
+};
+const char* MU_C3(MU_,FABRIC_RESTART_NODE_DESCRIPTION_KIND,_ToString)(FABRIC_RESTART_NODE_DESCRIPTION_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Strings))/sizeof(MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Strings)[0])) && (MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_RESTART_NODE_DESCRIPTION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_RESTART_NODE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_RESTART_NODE_DESCRIPTION_KIND_USING_NODE_NAME" },
+{ FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID , "FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID" },
+};
+static const int32_t FABRIC_RESTART_NODE_DESCRIPTION_KIND_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_RESTART_NODE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RESTART_NODE_DESCRIPTION_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RESTART_NODE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RESTART_NODE_DESCRIPTION_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_START_NODE_DESCRIPTION_KIND_Strings[FABRIC_START_NODE_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_START_NODE_DESCRIPTION_KIND_INVALID + 1] ={
+[FABRIC_START_NODE_DESCRIPTION_KIND_INVALID - FABRIC_START_NODE_DESCRIPTION_KIND_INVALID] = "FABRIC_START_NODE_DESCRIPTION_KIND_INVALID",
+[FABRIC_START_NODE_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_START_NODE_DESCRIPTION_KIND_INVALID] = "FABRIC_START_NODE_DESCRIPTION_KIND_USING_NODE_NAME",
+};
+const char* MU_C3(MU_,FABRIC_START_NODE_DESCRIPTION_KIND,_ToString)(FABRIC_START_NODE_DESCRIPTION_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_START_NODE_DESCRIPTION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Strings))/sizeof(MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Strings)[0])) && (MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_START_NODE_DESCRIPTION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_START_NODE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_START_NODE_DESCRIPTION_KIND_USING_NODE_NAME" },
+{ FABRIC_START_NODE_DESCRIPTION_KIND_INVALID , "FABRIC_START_NODE_DESCRIPTION_KIND_INVALID" },
+};
+static const int32_t FABRIC_START_NODE_DESCRIPTION_KIND_Seeds[] ={
+1, 0,
+};
+int MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_START_NODE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_START_NODE_DESCRIPTION_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_START_NODE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_START_NODE_DESCRIPTION_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_STOP_NODE_DESCRIPTION_KIND_Strings[FABRIC_STOP_NODE_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID + 1] ={
+[FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID - FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID] = "FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID",
+[FABRIC_STOP_NODE_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID] = "FABRIC_STOP_NODE_DESCRIPTION_KIND_USING_NODE_NAME",
+};
+const char* MU_C3(MU_,FABRIC_STOP_NODE_DESCRIPTION_KIND,_ToString)(FABRIC_STOP_NODE_DESCRIPTION_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Strings))/sizeof(MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Strings)[0])) && (MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_STOP_NODE_DESCRIPTION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID , "FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID" },
+{ FABRIC_STOP_NODE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_STOP_NODE_DESCRIPTION_KIND_USING_NODE_NAME" },
+};
+static const int32_t FABRIC_STOP_NODE_DESCRIPTION_KIND_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_STOP_NODE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STOP_NODE_DESCRIPTION_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STOP_NODE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STOP_NODE_DESCRIPTION_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_Strings[FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID + 1] ={
+[FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID - FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID] = "FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID",
+[FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID] = "FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_USING_NODE_NAME",
+};
+const char* MU_C3(MU_,FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND,_ToString)(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Strings))/sizeof(MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Strings)[0])) && (MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Strings)[index];
+    }
+    return "UNKNOWN";
+}
+
+static const SF_ENUM_AND_STRING FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_USING_NODE_NAME" },
+{ FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID , "FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID" },
+};
+static const int32_t FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SECURITY_CREDENTIAL_KIND_ValuesAndStrings[] ={
-{ FABRIC_SECURITY_CREDENTIAL_KIND_NONE , "FABRIC_SECURITY_CREDENTIAL_KIND_NONE" },
-{ FABRIC_SECURITY_CREDENTIAL_KIND_X509 , "FABRIC_SECURITY_CREDENTIAL_KIND_X509" },
-{ FABRIC_SECURITY_CREDENTIAL_KIND_WINDOWS , "FABRIC_SECURITY_CREDENTIAL_KIND_WINDOWS" },
-{ FABRIC_SECURITY_CREDENTIAL_KIND_CLAIMS , "FABRIC_SECURITY_CREDENTIAL_KIND_CLAIMS" },
-{ FABRIC_SECURITY_CREDENTIAL_KIND_X509_2 , "FABRIC_SECURITY_CREDENTIAL_KIND_X509_2" },
-{ FABRIC_SECURITY_CREDENTIAL_KIND_INVALID , "FABRIC_SECURITY_CREDENTIAL_KIND_INVALID" },
+int MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_STATE_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_REPAIR_TASK_STATE_INVALID , "FABRIC_REPAIR_TASK_STATE_INVALID" },
+{ FABRIC_REPAIR_TASK_STATE_CREATED , "FABRIC_REPAIR_TASK_STATE_CREATED" },
+{ FABRIC_REPAIR_TASK_STATE_CLAIMED , "FABRIC_REPAIR_TASK_STATE_CLAIMED" },
+{ FABRIC_REPAIR_TASK_STATE_PREPARING , "FABRIC_REPAIR_TASK_STATE_PREPARING" },
+{ FABRIC_REPAIR_TASK_STATE_APPROVED , "FABRIC_REPAIR_TASK_STATE_APPROVED" },
+{ FABRIC_REPAIR_TASK_STATE_EXECUTING , "FABRIC_REPAIR_TASK_STATE_EXECUTING" },
+{ FABRIC_REPAIR_TASK_STATE_RESTORING , "FABRIC_REPAIR_TASK_STATE_RESTORING" },
+{ FABRIC_REPAIR_TASK_STATE_COMPLETED , "FABRIC_REPAIR_TASK_STATE_COMPLETED" },
 };
-const char* MU_C3(MU_,FABRIC_SECURITY_CREDENTIAL_KIND,_ToString)(FABRIC_SECURITY_CREDENTIAL_KIND value)
+const char* MU_C3(MU_,FABRIC_REPAIR_TASK_STATE,_ToString)(FABRIC_REPAIR_TASK_STATE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _ValuesAndStrings)[0]);i++)
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_REPAIR_TASK_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_TASK_STATE, _ValuesAndStrings)[0]);
+    while(low < high)
     {
-        if(MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _ValuesAndStrings)[i].value == (int)value)
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_REPAIR_TASK_STATE, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_REPAIR_TASK_STATE, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
         {
-            return MU_C2(FABRIC_SECURITY_CREDENTIAL_KIND, _ValuesAndStrings)[i].valueAsString;
+            return MU_C2(FABRIC_REPAIR_TASK_STATE, _ValuesAndStrings)[middle].valueAsString;
         }
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_ValuesAndStrings[] ={
-{ FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE , "FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE" },
-{ FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_AAD , "FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_AAD" },
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_STATE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPAIR_TASK_STATE_CREATED , "FABRIC_REPAIR_TASK_STATE_CREATED" },
+{ FABRIC_REPAIR_TASK_STATE_EXECUTING , "FABRIC_REPAIR_TASK_STATE_EXECUTING" },
+{ FABRIC_REPAIR_TASK_STATE_APPROVED , "FABRIC_REPAIR_TASK_STATE_APPROVED" },
+{ FABRIC_REPAIR_TASK_STATE_INVALID , "FABRIC_REPAIR_TASK_STATE_INVALID" },
+{ FABRIC_REPAIR_TASK_STATE_COMPLETED , "FABRIC_REPAIR_TASK_STATE_COMPLETED" },
+{ FABRIC_REPAIR_TASK_STATE_PREPARING , "FABRIC_REPAIR_TASK_STATE_PREPARING" },
+{ FABRIC_REPAIR_TASK_STATE_CLAIMED , "FABRIC_REPAIR_TASK_STATE_CLAIMED" },
+{ FABRIC_REPAIR_TASK_STATE_RESTORING , "FABRIC_REPAIR_TASK_STATE_RESTORING" },
 };
-const char* MU_C3(MU_,FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND,_ToString)(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND value)
+static const int32_t FABRIC_REPAIR_TASK_STATE_Seeds[] ={
+-4, 3, -6, 0, 1, 0, -7, 0,
+};
+int MU_C2(FABRIC_REPAIR_TASK_STATE, _FromString)(const char* enumAsString, FABRIC_REPAIR_TASK_STATE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TASK_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TASK_STATE, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TASK_STATE, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TASK_STATE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TASK_STATE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPAIR_TASK_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TASK_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TASK_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TASK_STATE, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TASK_STATE, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TASK_STATE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TASK_STATE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_Strings[FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_TIMEDOUT - FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED + 1] ={
+[FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED - FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED] = "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED",
+[FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_IN_PROGRESS - FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED] = "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_IN_PROGRESS",
+[FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SUCCEEDED - FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED] = "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SUCCEEDED",
+[FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SKIPPED - FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED] = "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SKIPPED",
+[FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_TIMEDOUT - FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED] = "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_TIMEDOUT",
+};
+const char* MU_C3(MU_,FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE,_ToString)(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED;
+    if ((index < sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Strings))/sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Strings)[0])) && (MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_PROTECTION_LEVEL_ValuesAndStrings[] ={
-{ FABRIC_PROTECTION_LEVEL_NONE , "FABRIC_PROTECTION_LEVEL_NONE" },
-{ FABRIC_PROTECTION_LEVEL_SIGN , "FABRIC_PROTECTION_LEVEL_SIGN" },
-{ FABRIC_PROTECTION_LEVEL_ENCRYPTANDSIGN , "FABRIC_PROTECTION_LEVEL_ENCRYPTANDSIGN" },
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SKIPPED , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SKIPPED" },
+{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_TIMEDOUT , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_TIMEDOUT" },
+{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SUCCEEDED , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SUCCEEDED" },
+{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED" },
+{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_IN_PROGRESS , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_IN_PROGRESS" },
 };
-const char* MU_C3(MU_,FABRIC_PROTECTION_LEVEL,_ToString)(FABRIC_PROTECTION_LEVEL value)
+static const int32_t FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_Seeds[] ={
+1, 0, 0, 3, -5,
+};
+int MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _FromString)(const char* enumAsString, FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_PROTECTION_LEVEL, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_PROTECTION_LEVEL, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_PROTECTION_LEVEL, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_PROTECTION_LEVEL, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS_Strings[FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_RESTORING_HEALTH_CHECK - FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE + 1] ={
+[FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE - FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE] = "FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE",
+[FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_PREPARING_HEALTH_CHECK - FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE] = "FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_PREPARING_HEALTH_CHECK",
+[FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_RESTORING_HEALTH_CHECK - FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE] = "FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_RESTORING_HEALTH_CHECK",
+};
+const char* MU_C3(MU_,FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS,_ToString)(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Strings))/sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Strings)[0])) && (MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_X509_STORE_LOCATION_ValuesAndStrings[] ={
-{ FABRIC_X509_STORE_LOCATION_INVALID , "FABRIC_X509_STORE_LOCATION_INVALID" },
-{ FABRIC_X509_STORE_LOCATION_CURRENTUSER , "FABRIC_X509_STORE_LOCATION_CURRENTUSER" },
-{ FABRIC_X509_STORE_LOCATION_LOCALMACHINE , "FABRIC_X509_STORE_LOCATION_LOCALMACHINE" },
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_RESTORING_HEALTH_CHECK , "FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_RESTORING_HEALTH_CHECK" },
+{ FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE , "FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE" },
+{ FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_PREPARING_HEALTH_CHECK , "FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_PREPARING_HEALTH_CHECK" },
 };
-const char* MU_C3(MU_,FABRIC_X509_STORE_LOCATION,_ToString)(FABRIC_X509_STORE_LOCATION value)
+static const int32_t FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS_Seeds[] ={
+1, -2, 0,
+};
+int MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _FromString)(const char* enumAsString, FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_X509_STORE_LOCATION, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_X509_STORE_LOCATION, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_X509_STORE_LOCATION, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_X509_STORE_LOCATION, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPAIR_IMPACT_KIND_Strings[FABRIC_REPAIR_IMPACT_KIND_NODE - FABRIC_REPAIR_IMPACT_KIND_INVALID + 1] ={
+[FABRIC_REPAIR_IMPACT_KIND_INVALID - FABRIC_REPAIR_IMPACT_KIND_INVALID] = "FABRIC_REPAIR_IMPACT_KIND_INVALID",
+[FABRIC_REPAIR_IMPACT_KIND_NODE - FABRIC_REPAIR_IMPACT_KIND_INVALID] = "FABRIC_REPAIR_IMPACT_KIND_NODE",
+};
+const char* MU_C3(MU_,FABRIC_REPAIR_IMPACT_KIND,_ToString)(FABRIC_REPAIR_IMPACT_KIND value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPAIR_IMPACT_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Strings))/sizeof(MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Strings)[0])) && (MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_X509_FIND_TYPE_ValuesAndStrings[] ={
-{ FABRIC_X509_FIND_TYPE_FINDBYTHUMBPRINT , "FABRIC_X509_FIND_TYPE_FINDBYTHUMBPRINT" },
-{ FABRIC_X509_FIND_TYPE_FINDBYSUBJECTNAME , "FABRIC_X509_FIND_TYPE_FINDBYSUBJECTNAME" },
-{ FABRIC_X509_FIND_TYPE_FINDBYEXTENSION , "FABRIC_X509_FIND_TYPE_FINDBYEXTENSION" },
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_IMPACT_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPAIR_IMPACT_KIND_NODE , "FABRIC_REPAIR_IMPACT_KIND_NODE" },
+{ FABRIC_REPAIR_IMPACT_KIND_INVALID , "FABRIC_REPAIR_IMPACT_KIND_INVALID" },
 };
-const char* MU_C3(MU_,FABRIC_X509_FIND_TYPE,_ToString)(FABRIC_X509_FIND_TYPE value)
+static const int32_t FABRIC_REPAIR_IMPACT_KIND_Seeds[] ={
+1, 0,
+};
+int MU_C2(FABRIC_REPAIR_IMPACT_KIND, _FromString)(const char* enumAsString, FABRIC_REPAIR_IMPACT_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_X509_FIND_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_X509_FIND_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_X509_FIND_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_X509_FIND_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_IMPACT_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_IMPACT_KIND)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPAIR_IMPACT_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_IMPACT_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_IMPACT_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_IMPACT_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_IMPACT_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_REPAIR_NODE_IMPACT_LEVEL_Strings[FABRIC_REPAIR_NODE_IMPACT_LEVEL_PAUSE - FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID + 1] ={
+[FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID - FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID] = "FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID",
+[FABRIC_REPAIR_NODE_IMPACT_LEVEL_NONE - FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID] = "FABRIC_REPAIR_NODE_IMPACT_LEVEL_NONE",
+[FABRIC_REPAIR_NODE_IMPACT_LEVEL_RESTART - FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID] = "FABRIC_REPAIR_NODE_IMPACT_LEVEL_RESTART",
+[FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_DATA - FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID] = "FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_DATA",
+[FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_NODE - FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID] = "FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_NODE",
+[FABRIC_REPAIR_NODE_IMPACT_LEVEL_PAUSE - FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID] = "FABRIC_REPAIR_NODE_IMPACT_LEVEL_PAUSE",
+};
+const char* MU_C3(MU_,FABRIC_REPAIR_NODE_IMPACT_LEVEL,_ToString)(FABRIC_REPAIR_NODE_IMPACT_LEVEL value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Strings))/sizeof(MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Strings)[0])) && (MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO , "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO" },
-{ FABRIC_SERVICE_LOAD_METRIC_WEIGHT_LOW , "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_LOW" },
-{ FABRIC_SERVICE_LOAD_METRIC_WEIGHT_MEDIUM , "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_MEDIUM" },
-{ FABRIC_SERVICE_LOAD_METRIC_WEIGHT_HIGH , "FABRIC_SERVICE_LOAD_METRIC_WEIGHT_HIGH" },
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_NODE_IMPACT_LEVEL_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_NONE , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_NONE" },
+{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_PAUSE , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_PAUSE" },
+{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID" },
+{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_DATA , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_DATA" },
+{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_RESTART , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_RESTART" },
+{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_NODE , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_NODE" },
 };
-const char* MU_C3(MU_,FABRIC_SERVICE_LOAD_METRIC_WEIGHT,_ToString)(FABRIC_SERVICE_LOAD_METRIC_WEIGHT value)
+static const int32_t FABRIC_REPAIR_NODE_IMPACT_LEVEL_Seeds[] ={
+0, 0, 1, 2, -4, -5,
+};
+int MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _FromString)(const char* enumAsString, FABRIC_REPAIR_NODE_IMPACT_LEVEL* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_NODE_IMPACT_LEVEL)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_NODE_IMPACT_LEVEL* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_NODE_IMPACT_LEVEL)candidate->value;
+    return 0;
+}
+
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_RESULT_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_REPAIR_TASK_RESULT_INVALID , "FABRIC_REPAIR_TASK_RESULT_INVALID" },
+{ FABRIC_REPAIR_TASK_RESULT_SUCCEEDED , "FABRIC_REPAIR_TASK_RESULT_SUCCEEDED" },
+{ FABRIC_REPAIR_TASK_RESULT_CANCELLED , "FABRIC_REPAIR_TASK_RESULT_CANCELLED" },
+{ FABRIC_REPAIR_TASK_RESULT_INTERRUPTED , "FABRIC_REPAIR_TASK_RESULT_INTERRUPTED" },
+{ FABRIC_REPAIR_TASK_RESULT_FAILED , "FABRIC_REPAIR_TASK_RESULT_FAILED" },
+{ FABRIC_REPAIR_TASK_RESULT_PENDING , "FABRIC_REPAIR_TASK_RESULT_PENDING" },
+};
+const char* MU_C3(MU_,FABRIC_REPAIR_TASK_RESULT,_ToString)(FABRIC_REPAIR_TASK_RESULT value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _ValuesAndStrings)[0]);i++)
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_REPAIR_TASK_RESULT, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_TASK_RESULT, _ValuesAndStrings)[0]);
+    while(low < high)
     {
-        if(MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _ValuesAndStrings)[i].value == (int)value)
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_REPAIR_TASK_RESULT, _ValuesAndStrings)[middle].value < (int)value)
         {
-            return MU_C2(FABRIC_SERVICE_LOAD_METRIC_WEIGHT, _ValuesAndStrings)[i].valueAsString;
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_REPAIR_TASK_RESULT, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_REPAIR_TASK_RESULT, _ValuesAndStrings)[middle].valueAsString;
         }
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_MOVE_COST_ValuesAndStrings[] ={
-{ FABRIC_MOVE_COST_ZERO , "FABRIC_MOVE_COST_ZERO" },
-{ FABRIC_MOVE_COST_LOW , "FABRIC_MOVE_COST_LOW" },
-{ FABRIC_MOVE_COST_MEDIUM , "FABRIC_MOVE_COST_MEDIUM" },
-{ FABRIC_MOVE_COST_HIGH , "FABRIC_MOVE_COST_HIGH" },
-{ FABRIC_MOVE_COST_VERYHIGH , "FABRIC_MOVE_COST_VERYHIGH" },
+static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_RESULT_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_REPAIR_TASK_RESULT_SUCCEEDED , "FABRIC_REPAIR_TASK_RESULT_SUCCEEDED" },
+{ FABRIC_REPAIR_TASK_RESULT_FAILED , "FABRIC_REPAIR_TASK_RESULT_FAILED" },
+{ FABRIC_REPAIR_TASK_RESULT_PENDING , "FABRIC_REPAIR_TASK_RESULT_PENDING" },
+{ FABRIC_REPAIR_TASK_RESULT_INVALID , "FABRIC_REPAIR_TASK_RESULT_INVALID" },
+{ FABRIC_REPAIR_TASK_RESULT_INTERRUPTED , "FABRIC_REPAIR_TASK_RESULT_INTERRUPTED" },
+{ FABRIC_REPAIR_TASK_RESULT_CANCELLED , "FABRIC_REPAIR_TASK_RESULT_CANCELLED" },
 };
-const char* MU_C3(MU_,FABRIC_MOVE_COST,_ToString)(FABRIC_MOVE_COST value)
+static const int32_t FABRIC_REPAIR_TASK_RESULT_Seeds[] ={
+0, 4, 0, -2, 0, 7,
+};
+int MU_C2(FABRIC_REPAIR_TASK_RESULT, _FromString)(const char* enumAsString, FABRIC_REPAIR_TASK_RESULT* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_MOVE_COST, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_MOVE_COST, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_MOVE_COST, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_MOVE_COST, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TASK_RESULT, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TASK_RESULT, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TASK_RESULT, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TASK_RESULT, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TASK_RESULT)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_REPAIR_TASK_RESULT, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_REPAIR_TASK_RESULT* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_REPAIR_TASK_RESULT, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_REPAIR_TASK_RESULT, _Seeds), sizeof(MU_C2(FABRIC_REPAIR_TASK_RESULT, _Seeds))/sizeof(MU_C2(FABRIC_REPAIR_TASK_RESULT, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_REPAIR_TASK_RESULT)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_NODE_DEACTIVATION_STATUS_Strings[FABRIC_NODE_DEACTIVATION_STATUS_COMPLETED - FABRIC_NODE_DEACTIVATION_STATUS_NONE + 1] ={
+[FABRIC_NODE_DEACTIVATION_STATUS_NONE - FABRIC_NODE_DEACTIVATION_STATUS_NONE] = "FABRIC_NODE_DEACTIVATION_STATUS_NONE",
+[FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_IN_PROGRESS - FABRIC_NODE_DEACTIVATION_STATUS_NONE] = "FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_IN_PROGRESS",
+[FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_COMPLETE - FABRIC_NODE_DEACTIVATION_STATUS_NONE] = "FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_COMPLETE",
+[FABRIC_NODE_DEACTIVATION_STATUS_COMPLETED - FABRIC_NODE_DEACTIVATION_STATUS_NONE] = "FABRIC_NODE_DEACTIVATION_STATUS_COMPLETED",
+};
+const char* MU_C3(MU_,FABRIC_NODE_DEACTIVATION_STATUS,_ToString)(FABRIC_NODE_DEACTIVATION_STATUS value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_NODE_DEACTIVATION_STATUS_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Strings))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Strings)[0])) && (MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS , "FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS" },
-{ FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_EXCLUSIVE_PROCESS , "FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_EXCLUSIVE_PROCESS" },
+static const SF_ENUM_AND_STRING FABRIC_NODE_DEACTIVATION_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_COMPLETE , "FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_COMPLETE" },
+{ FABRIC_NODE_DEACTIVATION_STATUS_COMPLETED , "FABRIC_NODE_DEACTIVATION_STATUS_COMPLETED" },
+{ FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_IN_PROGRESS , "FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_IN_PROGRESS" },
+{ FABRIC_NODE_DEACTIVATION_STATUS_NONE , "FABRIC_NODE_DEACTIVATION_STATUS_NONE" },
 };
-const char* MU_C3(MU_,FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE,_ToString)(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE value)
+static const int32_t FABRIC_NODE_DEACTIVATION_STATUS_Seeds[] ={
+-1, -2, -3, -4,
+};
+int MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _FromString)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_STATUS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NODE_DEACTIVATION_STATUS)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_STATUS* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Seeds), sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NODE_DEACTIVATION_STATUS)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_NODE_DEACTIVATION_TASK_TYPE_Strings[FABRIC_NODE_DEACTIVATION_TASK_TYPE_CLIENT - FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID + 1] ={
+[FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID - FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID] = "FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID",
+[FABRIC_NODE_DEACTIVATION_TASK_TYPE_INFRASTRUCTURE - FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID] = "FABRIC_NODE_DEACTIVATION_TASK_TYPE_INFRASTRUCTURE",
+[FABRIC_NODE_DEACTIVATION_TASK_TYPE_REPAIR - FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID] = "FABRIC_NODE_DEACTIVATION_TASK_TYPE_REPAIR",
+[FABRIC_NODE_DEACTIVATION_TASK_TYPE_CLIENT - FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID] = "FABRIC_NODE_DEACTIVATION_TASK_TYPE_CLIENT",
+};
+const char* MU_C3(MU_,FABRIC_NODE_DEACTIVATION_TASK_TYPE,_ToString)(FABRIC_NODE_DEACTIVATION_TASK_TYPE value)
+{
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Strings))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Strings)[0])) && (MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Strings)[index] != NULL))
+    {
+        return MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_CORRELATION_SCHEME_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_CORRELATION_SCHEME_INVALID , "FABRIC_SERVICE_CORRELATION_SCHEME_INVALID" },
-{ FABRIC_SERVICE_CORRELATION_SCHEME_AFFINITY , "FABRIC_SERVICE_CORRELATION_SCHEME_AFFINITY" },
-{ FABRIC_SERVICE_CORRELATION_SCHEME_ALIGNED_AFFINITY , "FABRIC_SERVICE_CORRELATION_SCHEME_ALIGNED_AFFINITY" },
-{ FABRIC_SERVICE_CORRELATION_SCHEME_NONALIGNED_AFFINITY , "FABRIC_SERVICE_CORRELATION_SCHEME_NONALIGNED_AFFINITY" },
+static const SF_ENUM_AND_STRING FABRIC_NODE_DEACTIVATION_TASK_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_NODE_DEACTIVATION_TASK_TYPE_INFRASTRUCTURE , "FABRIC_NODE_DEACTIVATION_TASK_TYPE_INFRASTRUCTURE" },
+{ FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID , "FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID" },
+{ FABRIC_NODE_DEACTIVATION_TASK_TYPE_CLIENT , "FABRIC_NODE_DEACTIVATION_TASK_TYPE_CLIENT" },
+{ FABRIC_NODE_DEACTIVATION_TASK_TYPE_REPAIR , "FABRIC_NODE_DEACTIVATION_TASK_TYPE_REPAIR" },
 };
-const char* MU_C3(MU_,FABRIC_SERVICE_CORRELATION_SCHEME,_ToString)(FABRIC_SERVICE_CORRELATION_SCHEME value)
+static const int32_t FABRIC_NODE_DEACTIVATION_TASK_TYPE_Seeds[] ={
+0, -2, -4, 1,
+};
+int MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _FromString)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_TASK_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Seeds), sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NODE_DEACTIVATION_TASK_TYPE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_DEACTIVATION_TASK_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Seeds), sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
     {
-        if(MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_CORRELATION_SCHEME, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    *destination = (FABRIC_NODE_DEACTIVATION_TASK_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_PARTITION_ACCESS_STATUS_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID" },
-{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_GRANTED , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_GRANTED" },
-{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_RECONFIGURATION_PENDING , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_RECONFIGURATION_PENDING" },
-{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NOT_PRIMARY , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NOT_PRIMARY" },
-{ FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NO_WRITE_QUORUM , "FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NO_WRITE_QUORUM" },
+static const char* const FABRIC_PARTITION_SELECTOR_TYPE_Strings[FABRIC_PARTITION_SELECTOR_TYPE_RANDOM - FABRIC_PARTITION_SELECTOR_TYPE_NONE + 1] ={
+[FABRIC_PARTITION_SELECTOR_TYPE_NONE - FABRIC_PARTITION_SELECTOR_TYPE_NONE] = "FABRIC_PARTITION_SELECTOR_TYPE_NONE",
+[FABRIC_PARTITION_SELECTOR_TYPE_SINGLETON - FABRIC_PARTITION_SELECTOR_TYPE_NONE] = "FABRIC_PARTITION_SELECTOR_TYPE_SINGLETON",
+[FABRIC_PARTITION_SELECTOR_TYPE_NAMED - FABRIC_PARTITION_SELECTOR_TYPE_NONE] = "FABRIC_PARTITION_SELECTOR_TYPE_NAMED",
+[FABRIC_PARTITION_SELECTOR_TYPE_UNIFORM_INT64 - FABRIC_PARTITION_SELECTOR_TYPE_NONE] = "FABRIC_PARTITION_SELECTOR_TYPE_UNIFORM_INT64",
+[FABRIC_PARTITION_SELECTOR_TYPE_PARTITION_ID - FABRIC_PARTITION_SELECTOR_TYPE_NONE] = "FABRIC_PARTITION_SELECTOR_TYPE_PARTITION_ID",
+[FABRIC_PARTITION_SELECTOR_TYPE_RANDOM - FABRIC_PARTITION_SELECTOR_TYPE_NONE] = "FABRIC_PARTITION_SELECTOR_TYPE_RANDOM",
 };
-const char* MU_C3(MU_,FABRIC_SERVICE_PARTITION_ACCESS_STATUS,_ToString)(FABRIC_SERVICE_PARTITION_ACCESS_STATUS value)
+const char* MU_C3(MU_,FABRIC_PARTITION_SELECTOR_TYPE,_ToString)(FABRIC_PARTITION_SELECTOR_TYPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_PARTITION_SELECTOR_TYPE_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Strings))/sizeof(MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Strings)[0])) && (MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_PARTITION_ACCESS_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPLICA_ROLE_ValuesAndStrings[] ={
-{ FABRIC_REPLICA_ROLE_UNKNOWN , "FABRIC_REPLICA_ROLE_UNKNOWN" },
-{ FABRIC_REPLICA_ROLE_NONE , "FABRIC_REPLICA_ROLE_NONE" },
-{ FABRIC_REPLICA_ROLE_PRIMARY , "FABRIC_REPLICA_ROLE_PRIMARY" },
-{ FABRIC_REPLICA_ROLE_IDLE_SECONDARY , "FABRIC_REPLICA_ROLE_IDLE_SECONDARY" },
-{ FABRIC_REPLICA_ROLE_ACTIVE_SECONDARY , "FABRIC_REPLICA_ROLE_ACTIVE_SECONDARY" },
-{ FABRIC_REPLICA_ROLE_IDLE_AUXILIARY , "FABRIC_REPLICA_ROLE_IDLE_AUXILIARY" },
-{ FABRIC_REPLICA_ROLE_ACTIVE_AUXILIARY , "FABRIC_REPLICA_ROLE_ACTIVE_AUXILIARY" },
-{ FABRIC_REPLICA_ROLE_PRIMARY_AUXILIARY , "FABRIC_REPLICA_ROLE_PRIMARY_AUXILIARY" },
+static const SF_ENUM_AND_STRING FABRIC_PARTITION_SELECTOR_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PARTITION_SELECTOR_TYPE_UNIFORM_INT64 , "FABRIC_PARTITION_SELECTOR_TYPE_UNIFORM_INT64" },
+{ FABRIC_PARTITION_SELECTOR_TYPE_NAMED , "FABRIC_PARTITION_SELECTOR_TYPE_NAMED" },
+{ FABRIC_PARTITION_SELECTOR_TYPE_NONE , "FABRIC_PARTITION_SELECTOR_TYPE_NONE" },
+{ FABRIC_PARTITION_SELECTOR_TYPE_RANDOM , "FABRIC_PARTITION_SELECTOR_TYPE_RANDOM" },
+{ FABRIC_PARTITION_SELECTOR_TYPE_SINGLETON , "FABRIC_PARTITION_SELECTOR_TYPE_SINGLETON" },
+{ FABRIC_PARTITION_SELECTOR_TYPE_PARTITION_ID , "FABRIC_PARTITION_SELECTOR_TYPE_PARTITION_ID" },
 };
-const char* MU_C3(MU_,FABRIC_REPLICA_ROLE,_ToString)(FABRIC_REPLICA_ROLE value)
+static const int32_t FABRIC_PARTITION_SELECTOR_TYPE_Seeds[] ={
+0, -2, -4, 0, 2, -5,
+};
+int MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _FromString)(const char* enumAsString, FABRIC_PARTITION_SELECTOR_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPLICA_ROLE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPLICA_ROLE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_REPLICA_ROLE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPLICA_ROLE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Seeds), sizeof(MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PARTITION_SELECTOR_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPLICA_OPEN_MODE_ValuesAndStrings[] ={
-{ FABRIC_REPLICA_OPEN_MODE_INVALID , "FABRIC_REPLICA_OPEN_MODE_INVALID" },
-{ FABRIC_REPLICA_OPEN_MODE_NEW , "FABRIC_REPLICA_OPEN_MODE_NEW" },
-{ FABRIC_REPLICA_OPEN_MODE_EXISTING , "FABRIC_REPLICA_OPEN_MODE_EXISTING" },
-};
-const char* MU_C3(MU_,FABRIC_REPLICA_OPEN_MODE,_ToString)(FABRIC_REPLICA_OPEN_MODE value)
+int MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PARTITION_SELECTOR_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPLICA_OPEN_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPLICA_OPEN_MODE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_REPLICA_OPEN_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPLICA_OPEN_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Seeds), sizeof(MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PARTITION_SELECTOR_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPLICA_STATUS_ValuesAndStrings[] ={
-{ FABRIC_REPLICA_STATUS_INVALID , "FABRIC_REPLICA_STATUS_INVALID" },
-{ FABRIC_REPLICA_STATUS_DOWN , "FABRIC_REPLICA_STATUS_DOWN" },
-{ FABRIC_REPLICA_STATUS_UP , "FABRIC_REPLICA_STATUS_UP" },
+static const char* const FABRIC_DATA_LOSS_MODE_Strings[FABRIC_DATA_LOSS_MODE_FULL - FABRIC_DATA_LOSS_MODE_INVALID + 1] ={
+[FABRIC_DATA_LOSS_MODE_INVALID - FABRIC_DATA_LOSS_MODE_INVALID] = "FABRIC_DATA_LOSS_MODE_INVALID",
+[FABRIC_DATA_LOSS_MODE_PARTIAL - FABRIC_DATA_LOSS_MODE_INVALID] = "FABRIC_DATA_LOSS_MODE_PARTIAL",
+[FABRIC_DATA_LOSS_MODE_FULL - FABRIC_DATA_LOSS_MODE_INVALID] = "FABRIC_DATA_LOSS_MODE_FULL",
 };
-const char* MU_C3(MU_,FABRIC_REPLICA_STATUS,_ToString)(FABRIC_REPLICA_STATUS value)
+const char* MU_C3(MU_,FABRIC_DATA_LOSS_MODE,_ToString)(FABRIC_DATA_LOSS_MODE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPLICA_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPLICA_STATUS, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_DATA_LOSS_MODE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_DATA_LOSS_MODE, _Strings))/sizeof(MU_C2(FABRIC_DATA_LOSS_MODE, _Strings)[0])) && (MU_C2(FABRIC_DATA_LOSS_MODE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_REPLICA_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPLICA_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_DATA_LOSS_MODE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_OPERATION_TYPE_ValuesAndStrings[] ={
-{ FABRIC_OPERATION_TYPE_INVALID , "FABRIC_OPERATION_TYPE_INVALID" },
-{ FABRIC_OPERATION_TYPE_NORMAL , "FABRIC_OPERATION_TYPE_NORMAL" },
-{ FABRIC_OPERATION_TYPE_END_OF_STREAM , "FABRIC_OPERATION_TYPE_END_OF_STREAM" },
-{ FABRIC_OPERATION_TYPE_CREATE_ATOMIC_GROUP , "FABRIC_OPERATION_TYPE_CREATE_ATOMIC_GROUP" },
-{ FABRIC_OPERATION_TYPE_ATOMIC_GROUP_OPERATION , "FABRIC_OPERATION_TYPE_ATOMIC_GROUP_OPERATION" },
-{ FABRIC_OPERATION_TYPE_COMMIT_ATOMIC_GROUP , "FABRIC_OPERATION_TYPE_COMMIT_ATOMIC_GROUP" },
-{ FABRIC_OPERATION_TYPE_ROLLBACK_ATOMIC_GROUP , "FABRIC_OPERATION_TYPE_ROLLBACK_ATOMIC_GROUP" },
-{ FABRIC_OPERATION_TYPE_HAS_ATOMIC_GROUP_MASK , "FABRIC_OPERATION_TYPE_HAS_ATOMIC_GROUP_MASK" },
+static const SF_ENUM_AND_STRING FABRIC_DATA_LOSS_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_DATA_LOSS_MODE_PARTIAL , "FABRIC_DATA_LOSS_MODE_PARTIAL" },
+{ FABRIC_DATA_LOSS_MODE_INVALID , "FABRIC_DATA_LOSS_MODE_INVALID" },
+{ FABRIC_DATA_LOSS_MODE_FULL , "FABRIC_DATA_LOSS_MODE_FULL" },
 };
-const char* MU_C3(MU_,FABRIC_OPERATION_TYPE,_ToString)(FABRIC_OPERATION_TYPE value)
+static const int32_t FABRIC_DATA_LOSS_MODE_Seeds[] ={
+0, 1, 0,
+};
+int MU_C2(FABRIC_DATA_LOSS_MODE, _FromString)(const char* enumAsString, FABRIC_DATA_LOSS_MODE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_OPERATION_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_OPERATION_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_OPERATION_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_OPERATION_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DATA_LOSS_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DATA_LOSS_MODE, _Seeds), sizeof(MU_C2(FABRIC_DATA_LOSS_MODE, _Seeds))/sizeof(MU_C2(FABRIC_DATA_LOSS_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DATA_LOSS_MODE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPLICA_SET_QUORUM_MODE_ValuesAndStrings[] ={
-{ FABRIC_REPLICA_SET_QUORUM_INVALID , "FABRIC_REPLICA_SET_QUORUM_INVALID" },
-{ FABRIC_REPLICA_SET_WRITE_QUORUM , "FABRIC_REPLICA_SET_WRITE_QUORUM" },
-{ FABRIC_REPLICA_SET_QUORUM_ALL , "FABRIC_REPLICA_SET_QUORUM_ALL" },
-};
-const char* MU_C3(MU_,FABRIC_REPLICA_SET_QUORUM_MODE,_ToString)(FABRIC_REPLICA_SET_QUORUM_MODE value)
+int MU_C2(FABRIC_DATA_LOSS_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DATA_LOSS_MODE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPLICA_SET_QUORUM_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DATA_LOSS_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DATA_LOSS_MODE, _Seeds), sizeof(MU_C2(FABRIC_DATA_LOSS_MODE, _Seeds))/sizeof(MU_C2(FABRIC_DATA_LOSS_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DATA_LOSS_MODE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPLICATOR_SETTINGS_FLAGS_ValuesAndStrings[] ={
-{ FABRIC_REPLICATOR_SETTINGS_NONE , "FABRIC_REPLICATOR_SETTINGS_NONE" },
-{ FABRIC_REPLICATOR_ADDRESS , "FABRIC_REPLICATOR_ADDRESS" },
-{ FABRIC_REPLICATOR_SECURITY , "FABRIC_REPLICATOR_SECURITY" },
-{ FABRIC_REPLICATOR_RETRY_INTERVAL , "FABRIC_REPLICATOR_RETRY_INTERVAL" },
-{ FABRIC_REPLICATOR_BATCH_ACKNOWLEDGEMENT_INTERVAL , "FABRIC_REPLICATOR_BATCH_ACKNOWLEDGEMENT_INTERVAL" },
-{ FABRIC_REPLICATOR_REQUIRE_SERVICE_ACK , "FABRIC_REPLICATOR_REQUIRE_SERVICE_ACK" },
-{ FABRIC_REPLICATOR_REPLICATION_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_REPLICATION_QUEUE_INITIAL_SIZE" },
-{ FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_SIZE" },
-{ FABRIC_REPLICATOR_COPY_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_COPY_QUEUE_INITIAL_SIZE" },
-{ FABRIC_REPLICATOR_COPY_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_COPY_QUEUE_MAX_SIZE" },
-{ FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_MEMORY_SIZE , "FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_MEMORY_SIZE" },
-{ FABRIC_REPLICATOR_SECONDARY_CLEAR_ACKNOWLEDGED_OPERATIONS , "FABRIC_REPLICATOR_SECONDARY_CLEAR_ACKNOWLEDGED_OPERATIONS" },
-{ FABRIC_REPLICATOR_REPLICATION_MESSAGE_MAX_SIZE , "FABRIC_REPLICATOR_REPLICATION_MESSAGE_MAX_SIZE" },
-{ FABRIC_REPLICATOR_USE_STREAMFAULTS_AND_ENDOFSTREAM_OPERATIONACK , "FABRIC_REPLICATOR_USE_STREAMFAULTS_AND_ENDOFSTREAM_OPERATIONACK" },
-{ FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_INITIAL_SIZE" },
-{ FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_SIZE" },
-{ FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE , "FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE" },
-{ FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_INITIAL_SIZE , "FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_INITIAL_SIZE" },
-{ FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_SIZE , "FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_SIZE" },
-{ FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE , "FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE" },
-{ FABRIC_REPLICATOR_PRIMARY_WAIT_FOR_PENDING_QUORUMS_TIMEOUT , "FABRIC_REPLICATOR_PRIMARY_WAIT_FOR_PENDING_QUORUMS_TIMEOUT" },
-{ FABRIC_REPLICATOR_LISTEN_ADDRESS , "FABRIC_REPLICATOR_LISTEN_ADDRESS" },
-{ FABRIC_REPLICATOR_PUBLISH_ADDRESS , "FABRIC_REPLICATOR_PUBLISH_ADDRESS" },
-{ FABRIC_REPLICATOR_ENABLE_SEND_WINDOW_SIZE_IN_BYTES , "FABRIC_REPLICATOR_ENABLE_SEND_WINDOW_SIZE_IN_BYTES" },
-{ FABRIC_REPLICATOR_USE_INDIVIDUAL_HEAP_PER_REPLICA , "FABRIC_REPLICATOR_USE_INDIVIDUAL_HEAP_PER_REPLICA" },
-{ FABRIC_REPLICATOR_INITIAL_REPLICA_HEAP_SIZE_IN_KB , "FABRIC_REPLICATOR_INITIAL_REPLICA_HEAP_SIZE_IN_KB" },
-{ FABRIC_REPLICATOR_REPLICATION_BATCH_SIZE , "FABRIC_REPLICATOR_REPLICATION_BATCH_SIZE" },
-{ FABRIC_REPLICATOR_REPLICATION_BATCH_SEND_INTERVAL , "FABRIC_REPLICATOR_REPLICATION_BATCH_SEND_INTERVAL" },
+static const char* const FABRIC_TEST_COMMAND_PROGRESS_STATE_Strings[FABRIC_TEST_COMMAND_PROGRESS_STATE_FORCE_CANCELLED - FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID + 1] ={
+[FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID - FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID] = "FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID",
+[FABRIC_TEST_COMMAND_PROGRESS_STATE_RUNNING - FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID] = "FABRIC_TEST_COMMAND_PROGRESS_STATE_RUNNING",
+[FABRIC_TEST_COMMAND_PROGRESS_STATE_ROLLING_BACK - FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID] = "FABRIC_TEST_COMMAND_PROGRESS_STATE_ROLLING_BACK",
+[FABRIC_TEST_COMMAND_PROGRESS_STATE_COMPLETED - FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID] = "FABRIC_TEST_COMMAND_PROGRESS_STATE_COMPLETED",
+[FABRIC_TEST_COMMAND_PROGRESS_STATE_FAULTED - FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID] = "FABRIC_TEST_COMMAND_PROGRESS_STATE_FAULTED",
+[FABRIC_TEST_COMMAND_PROGRESS_STATE_CANCELLED - FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID] = "FABRIC_TEST_COMMAND_PROGRESS_STATE_CANCELLED",
+[FABRIC_TEST_COMMAND_PROGRESS_STATE_FORCE_CANCELLED - FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID] = "FABRIC_TEST_COMMAND_PROGRESS_STATE_FORCE_CANCELLED",
 };
-const char* MU_C3(MU_,FABRIC_REPLICATOR_SETTINGS_FLAGS,_ToString)(FABRIC_REPLICATOR_SETTINGS_FLAGS value)
+const char* MU_C3(MU_,FABRIC_TEST_COMMAND_PROGRESS_STATE,_ToString)(FABRIC_TEST_COMMAND_PROGRESS_STATE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Strings))/sizeof(MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Strings)[0])) && (MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPLICATOR_SETTINGS_FLAGS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_FAULT_TYPE_ValuesAndStrings[] ={
-{ FABRIC_FAULT_TYPE_INVALID , "FABRIC_FAULT_TYPE_INVALID" },
-{ FABRIC_FAULT_TYPE_PERMANENT , "FABRIC_FAULT_TYPE_PERMANENT" },
-{ FABRIC_FAULT_TYPE_TRANSIENT , "FABRIC_FAULT_TYPE_TRANSIENT" },
+static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_PROGRESS_STATE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_TEST_COMMAND_PROGRESS_STATE_COMPLETED , "FABRIC_TEST_COMMAND_PROGRESS_STATE_COMPLETED" },
+{ FABRIC_TEST_COMMAND_PROGRESS_STATE_CANCELLED , "FABRIC_TEST_COMMAND_PROGRESS_STATE_CANCELLED" },
+{ FABRIC_TEST_COMMAND_PROGRESS_STATE_ROLLING_BACK , "FABRIC_TEST_COMMAND_PROGRESS_STATE_ROLLING_BACK" },
+{ FABRIC_TEST_COMMAND_PROGRESS_STATE_FORCE_CANCELLED , "FABRIC_TEST_COMMAND_PROGRESS_STATE_FORCE_CANCELLED" },
+{ FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID , "FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID" },
+{ FABRIC_TEST_COMMAND_PROGRESS_STATE_RUNNING , "FABRIC_TEST_COMMAND_PROGRESS_STATE_RUNNING" },
+{ FABRIC_TEST_COMMAND_PROGRESS_STATE_FAULTED , "FABRIC_TEST_COMMAND_PROGRESS_STATE_FAULTED" },
 };
-const char* MU_C3(MU_,FABRIC_FAULT_TYPE,_ToString)(FABRIC_FAULT_TYPE value)
+static const int32_t FABRIC_TEST_COMMAND_PROGRESS_STATE_Seeds[] ={
+1, 2, 0, -1, -2, -3, 0,
+};
+int MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _FromString)(const char* enumAsString, FABRIC_TEST_COMMAND_PROGRESS_STATE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_FAULT_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_FAULT_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_FAULT_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_FAULT_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Seeds), sizeof(MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Seeds))/sizeof(MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TEST_COMMAND_PROGRESS_STATE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_HEALTH_STATE_ValuesAndStrings[] ={
-{ FABRIC_HEALTH_STATE_INVALID , "FABRIC_HEALTH_STATE_INVALID" },
-{ FABRIC_HEALTH_STATE_OK , "FABRIC_HEALTH_STATE_OK" },
-{ FABRIC_HEALTH_STATE_WARNING , "FABRIC_HEALTH_STATE_WARNING" },
-{ FABRIC_HEALTH_STATE_ERROR , "FABRIC_HEALTH_STATE_ERROR" },
-{ FABRIC_HEALTH_STATE_UNKNOWN , "FABRIC_HEALTH_STATE_UNKNOWN" },
-};
-const char* MU_C3(MU_,FABRIC_HEALTH_STATE,_ToString)(FABRIC_HEALTH_STATE value)
+int MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TEST_COMMAND_PROGRESS_STATE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_HEALTH_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_HEALTH_STATE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_HEALTH_STATE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_HEALTH_STATE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Seeds), sizeof(MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Seeds))/sizeof(MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TEST_COMMAND_PROGRESS_STATE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_HEALTH_REPORT_KIND_ValuesAndStrings[] ={
-{ FABRIC_HEALTH_REPORT_KIND_INVALID , "FABRIC_HEALTH_REPORT_KIND_INVALID" },
-{ FABRIC_HEALTH_REPORT_KIND_STATEFUL_SERVICE_REPLICA , "FABRIC_HEALTH_REPORT_KIND_STATEFUL_SERVICE_REPLICA" },
-{ FABRIC_HEALTH_REPORT_KIND_STATELESS_SERVICE_INSTANCE , "FABRIC_HEALTH_REPORT_KIND_STATELESS_SERVICE_INSTANCE" },
-{ FABRIC_HEALTH_REPORT_KIND_PARTITION , "FABRIC_HEALTH_REPORT_KIND_PARTITION" },
-{ FABRIC_HEALTH_REPORT_KIND_NODE , "FABRIC_HEALTH_REPORT_KIND_NODE" },
-{ FABRIC_HEALTH_REPORT_KIND_SERVICE , "FABRIC_HEALTH_REPORT_KIND_SERVICE" },
-{ FABRIC_HEALTH_REPORT_KIND_APPLICATION , "FABRIC_HEALTH_REPORT_KIND_APPLICATION" },
-{ FABRIC_HEALTH_REPORT_KIND_DEPLOYED_APPLICATION , "FABRIC_HEALTH_REPORT_KIND_DEPLOYED_APPLICATION" },
-{ FABRIC_HEALTH_REPORT_KIND_DEPLOYED_SERVICE_PACKAGE , "FABRIC_HEALTH_REPORT_KIND_DEPLOYED_SERVICE_PACKAGE" },
-{ FABRIC_HEALTH_REPORT_KIND_CLUSTER , "FABRIC_HEALTH_REPORT_KIND_CLUSTER" },
-{ FABRIC_HEALTH_REPORT_KIND_SELF_RECONFIGURING_SERVICE_INSTANCE , "FABRIC_HEALTH_REPORT_KIND_SELF_RECONFIGURING_SERVICE_INSTANCE" },
+static const char* const FABRIC_QUORUM_LOSS_MODE_Strings[FABRIC_QUORUM_LOSS_MODE_ALL_REPLICAS - FABRIC_QUORUM_LOSS_MODE_INVALID + 1] ={
+[FABRIC_QUORUM_LOSS_MODE_INVALID - FABRIC_QUORUM_LOSS_MODE_INVALID] = "FABRIC_QUORUM_LOSS_MODE_INVALID",
+[FABRIC_QUORUM_LOSS_MODE_QUORUM_REPLICAS - FABRIC_QUORUM_LOSS_MODE_INVALID] = "FABRIC_QUORUM_LOSS_MODE_QUORUM_REPLICAS",
+[FABRIC_QUORUM_LOSS_MODE_ALL_REPLICAS - FABRIC_QUORUM_LOSS_MODE_INVALID] = "FABRIC_QUORUM_LOSS_MODE_ALL_REPLICAS",
 };
-const char* MU_C3(MU_,FABRIC_HEALTH_REPORT_KIND,_ToString)(FABRIC_HEALTH_REPORT_KIND value)
+const char* MU_C3(MU_,FABRIC_QUORUM_LOSS_MODE,_ToString)(FABRIC_QUORUM_LOSS_MODE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_HEALTH_REPORT_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_HEALTH_REPORT_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_QUORUM_LOSS_MODE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_QUORUM_LOSS_MODE, _Strings))/sizeof(MU_C2(FABRIC_QUORUM_LOSS_MODE, _Strings)[0])) && (MU_C2(FABRIC_QUORUM_LOSS_MODE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_HEALTH_REPORT_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_HEALTH_REPORT_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_QUORUM_LOSS_MODE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_HEALTH_ENTITY_KIND_ValuesAndStrings[] ={
-{ FABRIC_HEALTH_ENTITY_KIND_INVALID , "FABRIC_HEALTH_ENTITY_KIND_INVALID" },
-{ FABRIC_HEALTH_ENTITY_KIND_NODE , "FABRIC_HEALTH_ENTITY_KIND_NODE" },
-{ FABRIC_HEALTH_ENTITY_KIND_PARTITION , "FABRIC_HEALTH_ENTITY_KIND_PARTITION" },
-{ FABRIC_HEALTH_ENTITY_KIND_SERVICE , "FABRIC_HEALTH_ENTITY_KIND_SERVICE" },
-{ FABRIC_HEALTH_ENTITY_KIND_APPLICATION , "FABRIC_HEALTH_ENTITY_KIND_APPLICATION" },
-{ FABRIC_HEALTH_ENTITY_KIND_REPLICA , "FABRIC_HEALTH_ENTITY_KIND_REPLICA" },
-{ FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_APPLICATION , "FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_APPLICATION" },
-{ FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_SERVICE_PACKAGE , "FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_SERVICE_PACKAGE" },
-{ FABRIC_HEALTH_ENTITY_KIND_CLUSTER , "FABRIC_HEALTH_ENTITY_KIND_CLUSTER" },
+static const SF_ENUM_AND_STRING FABRIC_QUORUM_LOSS_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_QUORUM_LOSS_MODE_ALL_REPLICAS , "FABRIC_QUORUM_LOSS_MODE_ALL_REPLICAS" },
+{ FABRIC_QUORUM_LOSS_MODE_QUORUM_REPLICAS , "FABRIC_QUORUM_LOSS_MODE_QUORUM_REPLICAS" },
+{ FABRIC_QUORUM_LOSS_MODE_INVALID , "FABRIC_QUORUM_LOSS_MODE_INVALID" },
 };
-const char* MU_C3(MU_,FABRIC_HEALTH_ENTITY_KIND,_ToString)(FABRIC_HEALTH_ENTITY_KIND value)
+static const int32_t FABRIC_QUORUM_LOSS_MODE_Seeds[] ={
+3, 0, 0,
+};
+int MU_C2(FABRIC_QUORUM_LOSS_MODE, _FromString)(const char* enumAsString, FABRIC_QUORUM_LOSS_MODE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_HEALTH_ENTITY_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_HEALTH_ENTITY_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_HEALTH_ENTITY_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_HEALTH_ENTITY_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUORUM_LOSS_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUORUM_LOSS_MODE, _Seeds), sizeof(MU_C2(FABRIC_QUORUM_LOSS_MODE, _Seeds))/sizeof(MU_C2(FABRIC_QUORUM_LOSS_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUORUM_LOSS_MODE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_HEALTH_EVALUATION_KIND_ValuesAndStrings[] ={
-{ FABRIC_HEALTH_EVALUATION_KIND_INVALID , "FABRIC_HEALTH_EVALUATION_KIND_INVALID" },
-{ FABRIC_HEALTH_EVALUATION_KIND_EVENT , "FABRIC_HEALTH_EVALUATION_KIND_EVENT" },
-{ FABRIC_HEALTH_EVALUATION_KIND_REPLICAS , "FABRIC_HEALTH_EVALUATION_KIND_REPLICAS" },
-{ FABRIC_HEALTH_EVALUATION_KIND_PARTITIONS , "FABRIC_HEALTH_EVALUATION_KIND_PARTITIONS" },
-{ FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGES , "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGES" },
-{ FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATIONS , "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATIONS" },
-{ FABRIC_HEALTH_EVALUATION_KIND_SERVICES , "FABRIC_HEALTH_EVALUATION_KIND_SERVICES" },
-{ FABRIC_HEALTH_EVALUATION_KIND_NODES , "FABRIC_HEALTH_EVALUATION_KIND_NODES" },
-{ FABRIC_HEALTH_EVALUATION_KIND_APPLICATIONS , "FABRIC_HEALTH_EVALUATION_KIND_APPLICATIONS" },
-{ FABRIC_HEALTH_EVALUATION_KIND_SYSTEM_APPLICATION , "FABRIC_HEALTH_EVALUATION_KIND_SYSTEM_APPLICATION" },
-{ FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DEPLOYED_APPLICATIONS , "FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DEPLOYED_APPLICATIONS" },
-{ FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_NODES , "FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_NODES" },
-{ FABRIC_HEALTH_EVALUATION_KIND_NODE , "FABRIC_HEALTH_EVALUATION_KIND_NODE" },
-{ FABRIC_HEALTH_EVALUATION_KIND_REPLICA , "FABRIC_HEALTH_EVALUATION_KIND_REPLICA" },
-{ FABRIC_HEALTH_EVALUATION_KIND_PARTITION , "FABRIC_HEALTH_EVALUATION_KIND_PARTITION" },
-{ FABRIC_HEALTH_EVALUATION_KIND_SERVICE , "FABRIC_HEALTH_EVALUATION_KIND_SERVICE" },
-{ FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGE , "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGE" },
-{ FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATION , "FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATION" },
-{ FABRIC_HEALTH_EVALUATION_KIND_APPLICATION , "FABRIC_HEALTH_EVALUATION_KIND_APPLICATION" },
-{ FABRIC_HEALTH_EVALUATION_KIND_DELTA_NODES_CHECK , "FABRIC_HEALTH_EVALUATION_KIND_DELTA_NODES_CHECK" },
-{ FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DELTA_NODES_CHECK , "FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DELTA_NODES_CHECK" },
-{ FABRIC_HEALTH_EVALUATION_KIND_APPLICATION_TYPE_APPLICATIONS , "FABRIC_HEALTH_EVALUATION_KIND_APPLICATION_TYPE_APPLICATIONS" },
-{ FABRIC_HEALTH_EVALUATION_KIND_NODE_TYPE_NODES , "FABRIC_HEALTH_EVALUATION_KIND_NODE_TYPE_NODES" },
-};
-const char* MU_C3(MU_,FABRIC_HEALTH_EVALUATION_KIND,_ToString)(FABRIC_HEALTH_EVALUATION_KIND value)
+int MU_C2(FABRIC_QUORUM_LOSS_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_QUORUM_LOSS_MODE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_HEALTH_EVALUATION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_QUORUM_LOSS_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_QUORUM_LOSS_MODE, _Seeds), sizeof(MU_C2(FABRIC_QUORUM_LOSS_MODE, _Seeds))/sizeof(MU_C2(FABRIC_QUORUM_LOSS_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_QUORUM_LOSS_MODE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_PROPERTY_TYPE_ID_ValuesAndStrings[] ={
-{ FABRIC_PROPERTY_TYPE_INVALID , "FABRIC_PROPERTY_TYPE_INVALID" },
-{ FABRIC_PROPERTY_TYPE_BINARY , "FABRIC_PROPERTY_TYPE_BINARY" },
-{ FABRIC_PROPERTY_TYPE_INT64 , "FABRIC_PROPERTY_TYPE_INT64" },
-{ FABRIC_PROPERTY_TYPE_DOUBLE , "FABRIC_PROPERTY_TYPE_DOUBLE" },
-{ FABRIC_PROPERTY_TYPE_WSTRING , "FABRIC_PROPERTY_TYPE_WSTRING" },
-{ FABRIC_PROPERTY_TYPE_GUID , "FABRIC_PROPERTY_TYPE_GUID" },
+static const char* const FABRIC_RESTART_PARTITION_MODE_Strings[FABRIC_RESTART_PARTITION_MODE_ONLY_ACTIVE_SECONDARIES - FABRIC_RESTART_PARTITION_MODE_INVALID + 1] ={
+[FABRIC_RESTART_PARTITION_MODE_INVALID - FABRIC_RESTART_PARTITION_MODE_INVALID] = "FABRIC_RESTART_PARTITION_MODE_INVALID",
+[FABRIC_RESTART_PARTITION_MODE_ALL_REPLICAS_OR_INSTANCES - FABRIC_RESTART_PARTITION_MODE_INVALID] = "FABRIC_RESTART_PARTITION_MODE_ALL_REPLICAS_OR_INSTANCES",
+[FABRIC_RESTART_PARTITION_MODE_ONLY_ACTIVE_SECONDARIES - FABRIC_RESTART_PARTITION_MODE_INVALID] = "FABRIC_RESTART_PARTITION_MODE_ONLY_ACTIVE_SECONDARIES",
 };
-const char* MU_C3(MU_,FABRIC_PROPERTY_TYPE_ID,_ToString)(FABRIC_PROPERTY_TYPE_ID value)
+const char* MU_C3(MU_,FABRIC_RESTART_PARTITION_MODE,_ToString)(FABRIC_RESTART_PARTITION_MODE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_PROPERTY_TYPE_ID, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_PROPERTY_TYPE_ID, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_RESTART_PARTITION_MODE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_RESTART_PARTITION_MODE, _Strings))/sizeof(MU_C2(FABRIC_RESTART_PARTITION_MODE, _Strings)[0])) && (MU_C2(FABRIC_RESTART_PARTITION_MODE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_PROPERTY_TYPE_ID, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_PROPERTY_TYPE_ID, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_RESTART_PARTITION_MODE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_PROPERTY_BATCH_OPERATION_KIND_ValuesAndStrings[] ={
-{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID" },
-{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT" },
-{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_GET , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_GET" },
-{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_EXISTS , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_EXISTS" },
-{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_SEQUENCE , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_SEQUENCE" },
-{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_DELETE , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_DELETE" },
-{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT_CUSTOM , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT_CUSTOM" },
-{ FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_VALUE , "FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_VALUE" },
+static const SF_ENUM_AND_STRING FABRIC_RESTART_PARTITION_MODE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_RESTART_PARTITION_MODE_ONLY_ACTIVE_SECONDARIES , "FABRIC_RESTART_PARTITION_MODE_ONLY_ACTIVE_SECONDARIES" },
+{ FABRIC_RESTART_PARTITION_MODE_INVALID , "FABRIC_RESTART_PARTITION_MODE_INVALID" },
+{ FABRIC_RESTART_PARTITION_MODE_ALL_REPLICAS_OR_INSTANCES , "FABRIC_RESTART_PARTITION_MODE_ALL_REPLICAS_OR_INSTANCES" },
 };
-const char* MU_C3(MU_,FABRIC_PROPERTY_BATCH_OPERATION_KIND,_ToString)(FABRIC_PROPERTY_BATCH_OPERATION_KIND value)
+static const int32_t FABRIC_RESTART_PARTITION_MODE_Seeds[] ={
+1, 0, -2,
+};
+int MU_C2(FABRIC_RESTART_PARTITION_MODE, _FromString)(const char* enumAsString, FABRIC_RESTART_PARTITION_MODE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_PROPERTY_BATCH_OPERATION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RESTART_PARTITION_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RESTART_PARTITION_MODE, _Seeds), sizeof(MU_C2(FABRIC_RESTART_PARTITION_MODE, _Seeds))/sizeof(MU_C2(FABRIC_RESTART_PARTITION_MODE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RESTART_PARTITION_MODE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_ENDPOINT_ROLE_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_ROLE_INVALID , "FABRIC_SERVICE_ROLE_INVALID" },
-{ FABRIC_SERVICE_ROLE_STATELESS , "FABRIC_SERVICE_ROLE_STATELESS" },
-{ FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY , "FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY" },
-{ FABRIC_SERVICE_ROLE_STATEFUL_SECONDARY , "FABRIC_SERVICE_ROLE_STATEFUL_SECONDARY" },
-{ FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY_AUXILIARY , "FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY_AUXILIARY" },
-{ FABRIC_SERVICE_ROLE_STATEFUL_AUXILIARY , "FABRIC_SERVICE_ROLE_STATEFUL_AUXILIARY" },
-{ FABRIC_SERVICE_ROLE_SELF_RECONFIGURING , "FABRIC_SERVICE_ROLE_SELF_RECONFIGURING" },
-};
-const char* MU_C3(MU_,FABRIC_SERVICE_ENDPOINT_ROLE,_ToString)(FABRIC_SERVICE_ENDPOINT_ROLE value)
+int MU_C2(FABRIC_RESTART_PARTITION_MODE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RESTART_PARTITION_MODE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_ENDPOINT_ROLE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RESTART_PARTITION_MODE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RESTART_PARTITION_MODE, _Seeds), sizeof(MU_C2(FABRIC_RESTART_PARTITION_MODE, _Seeds))/sizeof(MU_C2(FABRIC_RESTART_PARTITION_MODE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RESTART_PARTITION_MODE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_ENUMERATION_STATUS_ValuesAndStrings[] ={
-{ FABRIC_ENUMERATION_INVALID , "FABRIC_ENUMERATION_INVALID" },
-{ FABRIC_ENUMERATION_BEST_EFFORT_MORE_DATA , "FABRIC_ENUMERATION_BEST_EFFORT_MORE_DATA" },
-{ FABRIC_ENUMERATION_CONSISTENT_MORE_DATA , "FABRIC_ENUMERATION_CONSISTENT_MORE_DATA" },
-{ FABRIC_ENUMERATION_BEST_EFFORT_FINISHED , "FABRIC_ENUMERATION_BEST_EFFORT_FINISHED" },
-{ FABRIC_ENUMERATION_CONSISTENT_FINISHED , "FABRIC_ENUMERATION_CONSISTENT_FINISHED" },
-{ FABRIC_ENUMERATION_VALID_MASK , "FABRIC_ENUMERATION_VALID_MASK" },
-{ FABRIC_ENUMERATION_BEST_EFFORT_MASK , "FABRIC_ENUMERATION_BEST_EFFORT_MASK" },
-{ FABRIC_ENUMERATION_CONSISTENT_MASK , "FABRIC_ENUMERATION_CONSISTENT_MASK" },
-{ FABRIC_ENUMERATION_MORE_DATA_MASK , "FABRIC_ENUMERATION_MORE_DATA_MASK" },
-{ FABRIC_ENUMERATION_FINISHED_MASK , "FABRIC_ENUMERATION_FINISHED_MASK" },
+static const char* const FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_Strings[FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR - FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID + 1] ={
+[FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID - FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID",
+[FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_NODE_NAME",
+[FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR - FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR",
 };
-const char* MU_C3(MU_,FABRIC_ENUMERATION_STATUS,_ToString)(FABRIC_ENUMERATION_STATUS value)
+const char* MU_C3(MU_,FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND,_ToString)(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_ENUMERATION_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_ENUMERATION_STATUS, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Strings))/sizeof(MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Strings)[0])) && (MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_ENUMERATION_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_ENUMERATION_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_PARTITION_KEY_TYPE_ValuesAndStrings[] ={
-{ FABRIC_PARTITION_KEY_TYPE_INVALID , "FABRIC_PARTITION_KEY_TYPE_INVALID" },
-{ FABRIC_PARTITION_KEY_TYPE_NONE , "FABRIC_PARTITION_KEY_TYPE_NONE" },
-{ FABRIC_PARTITION_KEY_TYPE_INT64 , "FABRIC_PARTITION_KEY_TYPE_INT64" },
-{ FABRIC_PARTITION_KEY_TYPE_STRING , "FABRIC_PARTITION_KEY_TYPE_STRING" },
+static const SF_ENUM_AND_STRING FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR , "FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR" },
+{ FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID , "FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID" },
+{ FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_NODE_NAME" },
 };
-const char* MU_C3(MU_,FABRIC_PARTITION_KEY_TYPE,_ToString)(FABRIC_PARTITION_KEY_TYPE value)
+static const int32_t FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_Seeds[] ={
+3, -1, 0,
+};
+int MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_PARTITION_KEY_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_PARTITION_KEY_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_PARTITION_KEY_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_PARTITION_KEY_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_PARTITION_SCHEME_ValuesAndStrings[] ={
-{ FABRIC_PARTITION_SCHEME_INVALID , "FABRIC_PARTITION_SCHEME_INVALID" },
-{ FABRIC_PARTITION_SCHEME_SINGLETON , "FABRIC_PARTITION_SCHEME_SINGLETON" },
-{ FABRIC_PARTITION_SCHEME_UNIFORM_INT64_RANGE , "FABRIC_PARTITION_SCHEME_UNIFORM_INT64_RANGE" },
-{ FABRIC_PARTITION_SCHEME_NAMED , "FABRIC_PARTITION_SCHEME_NAMED" },
-};
-const char* MU_C3(MU_,FABRIC_PARTITION_SCHEME,_ToString)(FABRIC_PARTITION_SCHEME value)
+int MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_PARTITION_SCHEME, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_PARTITION_SCHEME, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_PARTITION_SCHEME, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_PARTITION_SCHEME, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_DESCRIPTION_KIND_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_DESCRIPTION_KIND_INVALID , "FABRIC_SERVICE_DESCRIPTION_KIND_INVALID" },
-{ FABRIC_SERVICE_DESCRIPTION_KIND_STATELESS , "FABRIC_SERVICE_DESCRIPTION_KIND_STATELESS" },
-{ FABRIC_SERVICE_DESCRIPTION_KIND_STATEFUL , "FABRIC_SERVICE_DESCRIPTION_KIND_STATEFUL" },
-{ FABRIC_SERVICE_DESCRIPTION_KIND_SELF_RECONFIGURING , "FABRIC_SERVICE_DESCRIPTION_KIND_SELF_RECONFIGURING" },
+static const char* const FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_Strings[FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR - FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID + 1] ={
+[FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID - FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID",
+[FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_NODE_NAME",
+[FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR - FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR",
 };
-const char* MU_C3(MU_,FABRIC_SERVICE_DESCRIPTION_KIND,_ToString)(FABRIC_SERVICE_DESCRIPTION_KIND value)
+const char* MU_C3(MU_,FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND,_ToString)(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Strings))/sizeof(MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Strings)[0])) && (MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_DESCRIPTION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS_ValuesAndStrings[] ={
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_NONE , "FABRIC_STATEFUL_SERVICE_SETTINGS_NONE" },
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_REPLICA_RESTART_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_SETTINGS_REPLICA_RESTART_WAIT_DURATION" },
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_QUORUM_LOSS_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_SETTINGS_QUORUM_LOSS_WAIT_DURATION" },
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_STANDBY_REPLICA_KEEP_DURATION , "FABRIC_STATEFUL_SERVICE_SETTINGS_STANDBY_REPLICA_KEEP_DURATION" },
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_PLACEMENT_TIME_LIMIT , "FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_PLACEMENT_TIME_LIMIT" },
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_DROP_SOURCE_REPLICA_ON_MOVE , "FABRIC_STATEFUL_SERVICE_SETTINGS_DROP_SOURCE_REPLICA_ON_MOVE" },
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE , "FABRIC_STATEFUL_SERVICE_SETTINGS_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE" },
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE , "FABRIC_STATEFUL_SERVICE_SETTINGS_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE" },
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_AUXILIARY_REPLICA_COUNT , "FABRIC_STATEFUL_SERVICE_SETTINGS_AUXILIARY_REPLICA_COUNT" },
-{ FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_SENSITIVITY , "FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_SENSITIVITY" },
+static const SF_ENUM_AND_STRING FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID , "FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID" },
+{ FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_NODE_NAME" },
+{ FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR , "FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR" },
 };
-const char* MU_C3(MU_,FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS,_ToString)(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS value)
+static const int32_t FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_Seeds[] ={
+-1, -2, -3,
+};
+int MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS_ValuesAndStrings[] ={
-{ FABRIC_STATELESS_SERVICE_SETTINGS_NONE , "FABRIC_STATELESS_SERVICE_SETTINGS_NONE" },
-{ FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_CLOSE_DELAY_DURATION , "FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_CLOSE_DELAY_DURATION" },
-{ FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_RESTART_WAIT_DURATION , "FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_RESTART_WAIT_DURATION" },
-};
-const char* MU_C3(MU_,FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS,_ToString)(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS value)
+int MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS_ValuesAndStrings[] ={
-{ FABRIC_STATELESS_SERVICE_NONE , "FABRIC_STATELESS_SERVICE_NONE" },
-{ FABRIC_STATELESS_SERVICE_INSTANCE_COUNT , "FABRIC_STATELESS_SERVICE_INSTANCE_COUNT" },
-{ FABRIC_STATELESS_SERVICE_PLACEMENT_CONSTRAINTS , "FABRIC_STATELESS_SERVICE_PLACEMENT_CONSTRAINTS" },
-{ FABRIC_STATELESS_SERVICE_POLICY_LIST , "FABRIC_STATELESS_SERVICE_POLICY_LIST" },
-{ FABRIC_STATELESS_SERVICE_CORRELATIONS , "FABRIC_STATELESS_SERVICE_CORRELATIONS" },
-{ FABRIC_STATELESS_SERVICE_METRICS , "FABRIC_STATELESS_SERVICE_METRICS" },
-{ FABRIC_STATELESS_SERVICE_MOVE_COST , "FABRIC_STATELESS_SERVICE_MOVE_COST" },
-{ FABRIC_STATELESS_SERVICE_SCALING_POLICY , "FABRIC_STATELESS_SERVICE_SCALING_POLICY" },
-{ FABRIC_STATELESS_SERVICE_MIN_INSTANCE_COUNT , "FABRIC_STATELESS_SERVICE_MIN_INSTANCE_COUNT" },
-{ FABRIC_STATELESS_SERVICE_MIN_INSTANCE_PERCENTAGE , "FABRIC_STATELESS_SERVICE_MIN_INSTANCE_PERCENTAGE" },
-{ FABRIC_STATELESS_SERVICE_INSTANCE_CLOSE_DELAY_DURATION , "FABRIC_STATELESS_SERVICE_INSTANCE_CLOSE_DELAY_DURATION" },
-{ FABRIC_STATELESS_SERVICE_INSTANCE_RESTART_WAIT_DURATION , "FABRIC_STATELESS_SERVICE_INSTANCE_RESTART_WAIT_DURATION" },
-{ FABRIC_STATELESS_SERVICE_SERVICE_DNS_NAME , "FABRIC_STATELESS_SERVICE_SERVICE_DNS_NAME" },
-{ FABRIC_STATELESS_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE , "FABRIC_STATELESS_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE" },
-{ FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_PLACE , "FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_PLACE" },
-{ FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_RUN , "FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_RUN" },
+static const char* const FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_Strings[FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_REPLICA_SELECTOR - FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID + 1] ={
+[FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID - FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID",
+[FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_NODE_NAME",
+[FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_REPLICA_SELECTOR - FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_REPLICA_SELECTOR",
 };
-const char* MU_C3(MU_,FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS,_ToString)(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS value)
+const char* MU_C3(MU_,FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND,_ToString)(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Strings))/sizeof(MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Strings)[0])) && (MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS_ValuesAndStrings[] ={
-{ FABRIC_STATEFUL_SERVICE_NONE , "FABRIC_STATEFUL_SERVICE_NONE" },
-{ FABRIC_STATEFUL_SERVICE_TARGET_REPLICA_SET_SIZE , "FABRIC_STATEFUL_SERVICE_TARGET_REPLICA_SET_SIZE" },
-{ FABRIC_STATEFUL_SERVICE_REPLICA_RESTART_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_REPLICA_RESTART_WAIT_DURATION" },
-{ FABRIC_STATEFUL_SERVICE_QUORUM_LOSS_WAIT_DURATION , "FABRIC_STATEFUL_SERVICE_QUORUM_LOSS_WAIT_DURATION" },
-{ FABRIC_STATEFUL_SERVICE_STANDBY_REPLICA_KEEP_DURATION , "FABRIC_STATEFUL_SERVICE_STANDBY_REPLICA_KEEP_DURATION" },
-{ FABRIC_STATEFUL_SERVICE_MIN_REPLICA_SET_SIZE , "FABRIC_STATEFUL_SERVICE_MIN_REPLICA_SET_SIZE" },
-{ FABRIC_STATEFUL_SERVICE_PLACEMENT_CONSTRAINTS , "FABRIC_STATEFUL_SERVICE_PLACEMENT_CONSTRAINTS" },
-{ FABRIC_STATEFUL_SERVICE_POLICY_LIST , "FABRIC_STATEFUL_SERVICE_POLICY_LIST" },
-{ FABRIC_STATEFUL_SERVICE_CORRELATIONS , "FABRIC_STATEFUL_SERVICE_CORRELATIONS" },
-{ FABRIC_STATEFUL_SERVICE_METRICS , "FABRIC_STATEFUL_SERVICE_METRICS" },
-{ FABRIC_STATEFUL_SERVICE_MOVE_COST , "FABRIC_STATEFUL_SERVICE_MOVE_COST" },
-{ FABRIC_STATEFUL_SERVICE_SCALING_POLICY , "FABRIC_STATEFUL_SERVICE_SCALING_POLICY" },
-{ FABRIC_STATEFUL_SERVICE_SERVICE_PLACEMENT_TIME_LIMIT , "FABRIC_STATEFUL_SERVICE_SERVICE_PLACEMENT_TIME_LIMIT" },
-{ FABRIC_STATEFUL_SERVICE_DROP_SOURCE_REPLICA_ON_MOVE , "FABRIC_STATEFUL_SERVICE_DROP_SOURCE_REPLICA_ON_MOVE" },
-{ FABRIC_STATEFUL_SERVICE_SERVICE_DNS_NAME , "FABRIC_STATEFUL_SERVICE_SERVICE_DNS_NAME" },
-{ FABRIC_STATEFUL_SERVICE_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE , "FABRIC_STATEFUL_SERVICE_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE" },
-{ FABRIC_STATEFUL_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE , "FABRIC_STATEFUL_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE" },
-{ FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_PLACE , "FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_PLACE" },
-{ FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_RUN , "FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_RUN" },
-{ FABRIC_STATEFUL_SERVICE_AUXILIARY_REPLICA_COUNT , "FABRIC_STATEFUL_SERVICE_AUXILIARY_REPLICA_COUNT" },
-{ FABRIC_STATEFUL_SERVICE_SERVICE_SENSITIVITY , "FABRIC_STATEFUL_SERVICE_SERVICE_SENSITIVITY" },
+static const SF_ENUM_AND_STRING FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID , "FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID" },
+{ FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_REPLICA_SELECTOR , "FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_REPLICA_SELECTOR" },
+{ FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_NODE_NAME" },
 };
-const char* MU_C3(MU_,FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS,_ToString)(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS value)
+static const int32_t FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_Seeds[] ={
+-3, 0, 1,
+};
+int MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_ValuesAndStrings[] ={
-{ FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID , "FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID" },
-{ FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_NEW , "FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_NEW" },
-{ FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_EXISTING , "FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_EXISTING" },
-};
-const char* MU_C3(MU_,FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE,_ToString)(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE value)
+int MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_ValuesAndStrings[] ={
-{ FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID , "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID" },
-{ FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INITIAL , "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INITIAL" },
-{ FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_MEMBER , "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_MEMBER" },
-{ FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_NONE , "FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_NONE" },
+static const char* const FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_Strings[FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR - FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID + 1] ={
+[FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID - FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID",
+[FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_NODE_NAME - FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_NODE_NAME",
+[FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR - FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID] = "FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR",
 };
-const char* MU_C3(MU_,FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE,_ToString)(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE value)
+const char* MU_C3(MU_,FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND,_ToString)(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Strings))/sizeof(MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Strings)[0])) && (MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE_ValuesAndStrings[] ={
-{ FABRIC_SELF_RECONFIGURATION_STATUS_INVALID , "FABRIC_SELF_RECONFIGURATION_STATUS_INVALID" },
-{ FABRIC_SELF_RECONFIGURATION_STATUS_ACTIVATED , "FABRIC_SELF_RECONFIGURATION_STATUS_ACTIVATED" },
-{ FABRIC_SELF_RECONFIGURATION_STATUS_DEACTIVATED , "FABRIC_SELF_RECONFIGURATION_STATUS_DEACTIVATED" },
+static const SF_ENUM_AND_STRING FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID , "FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID" },
+{ FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR , "FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR" },
+{ FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_NODE_NAME" },
 };
-const char* MU_C3(MU_,FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE,_ToString)(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE value)
+static const int32_t FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_Seeds[] ={
+-2, 0, 2,
+};
+int MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _FromString)(const char* enumAsString, FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE , "FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE" },
-{ FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NAME_PREFIX , "FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NAME_PREFIX" },
-{ FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_PRIMARY_ONLY , "FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_PRIMARY_ONLY" },
-};
-const char* MU_C3(MU_,FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS,_ToString)(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS value)
+int MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Seeds), sizeof(MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Seeds))/sizeof(MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_UPGRADE_KIND_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_UPGRADE_KIND_INVALID , "FABRIC_APPLICATION_UPGRADE_KIND_INVALID" },
-{ FABRIC_APPLICATION_UPGRADE_KIND_ROLLING , "FABRIC_APPLICATION_UPGRADE_KIND_ROLLING" },
+static const char* const FABRIC_NODE_TRANSITION_TYPE_Strings[FABRIC_NODE_TRANSITION_TYPE_STOP - FABRIC_NODE_TRANSITION_TYPE_INVALID + 1] ={
+[FABRIC_NODE_TRANSITION_TYPE_INVALID - FABRIC_NODE_TRANSITION_TYPE_INVALID] = "FABRIC_NODE_TRANSITION_TYPE_INVALID",
+[FABRIC_NODE_TRANSITION_TYPE_START - FABRIC_NODE_TRANSITION_TYPE_INVALID] = "FABRIC_NODE_TRANSITION_TYPE_START",
+[FABRIC_NODE_TRANSITION_TYPE_STOP - FABRIC_NODE_TRANSITION_TYPE_INVALID] = "FABRIC_NODE_TRANSITION_TYPE_STOP",
 };
-const char* MU_C3(MU_,FABRIC_APPLICATION_UPGRADE_KIND,_ToString)(FABRIC_APPLICATION_UPGRADE_KIND value)
+const char* MU_C3(MU_,FABRIC_NODE_TRANSITION_TYPE,_ToString)(FABRIC_NODE_TRANSITION_TYPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_NODE_TRANSITION_TYPE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Strings))/sizeof(MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Strings)[0])) && (MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_UPGRADE_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_UPGRADE_KIND_ValuesAndStrings[] ={
-{ FABRIC_UPGRADE_KIND_INVALID , "FABRIC_UPGRADE_KIND_INVALID" },
-{ FABRIC_UPGRADE_KIND_ROLLING , "FABRIC_UPGRADE_KIND_ROLLING" },
+static const SF_ENUM_AND_STRING FABRIC_NODE_TRANSITION_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_NODE_TRANSITION_TYPE_STOP , "FABRIC_NODE_TRANSITION_TYPE_STOP" },
+{ FABRIC_NODE_TRANSITION_TYPE_INVALID , "FABRIC_NODE_TRANSITION_TYPE_INVALID" },
+{ FABRIC_NODE_TRANSITION_TYPE_START , "FABRIC_NODE_TRANSITION_TYPE_START" },
 };
-const char* MU_C3(MU_,FABRIC_UPGRADE_KIND,_ToString)(FABRIC_UPGRADE_KIND value)
+static const int32_t FABRIC_NODE_TRANSITION_TYPE_Seeds[] ={
+0, 0, 6,
+};
+int MU_C2(FABRIC_NODE_TRANSITION_TYPE, _FromString)(const char* enumAsString, FABRIC_NODE_TRANSITION_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_UPGRADE_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_UPGRADE_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_UPGRADE_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_UPGRADE_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_TRANSITION_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Seeds), sizeof(MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NODE_TRANSITION_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_UPGRADE_SORT_ORDER_ValuesAndStrings[] ={
-{ FABRIC_UPGRADE_SORT_ORDER_INVALID , "FABRIC_UPGRADE_SORT_ORDER_INVALID" },
-{ FABRIC_UPGRADE_SORT_ORDER_DEFAULT , "FABRIC_UPGRADE_SORT_ORDER_DEFAULT" },
-{ FABRIC_UPGRADE_SORT_ORDER_NUMERIC , "FABRIC_UPGRADE_SORT_ORDER_NUMERIC" },
-{ FABRIC_UPGRADE_SORT_ORDER_LEXICOGRAPHICAL , "FABRIC_UPGRADE_SORT_ORDER_LEXICOGRAPHICAL" },
-{ FABRIC_UPGRADE_SORT_ORDER_REVERSE_NUMERIC , "FABRIC_UPGRADE_SORT_ORDER_REVERSE_NUMERIC" },
-{ FABRIC_UPGRADE_SORT_ORDER_REVERSE_LEXICOGRAPHICAL , "FABRIC_UPGRADE_SORT_ORDER_REVERSE_LEXICOGRAPHICAL" },
-};
-const char* MU_C3(MU_,FABRIC_UPGRADE_SORT_ORDER,_ToString)(FABRIC_UPGRADE_SORT_ORDER value)
+int MU_C2(FABRIC_NODE_TRANSITION_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NODE_TRANSITION_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_UPGRADE_SORT_ORDER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_UPGRADE_SORT_ORDER, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_UPGRADE_SORT_ORDER, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_UPGRADE_SORT_ORDER, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NODE_TRANSITION_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Seeds), sizeof(MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_NODE_TRANSITION_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NODE_TRANSITION_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_ROLLING_UPGRADE_MODE_ValuesAndStrings[] ={
-{ FABRIC_ROLLING_UPGRADE_MODE_INVALID , "FABRIC_ROLLING_UPGRADE_MODE_INVALID" },
-{ FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_AUTO , "FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_AUTO" },
-{ FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_MANUAL , "FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_MANUAL" },
-{ FABRIC_ROLLING_UPGRADE_MODE_MONITORED , "FABRIC_ROLLING_UPGRADE_MODE_MONITORED" },
-{ FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_DEFERRED , "FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_DEFERRED" },
+static const char* const FABRIC_RECONFIGURATION_PHASE_Strings[FABRIC_RECONFIGURATION_ABORT_PHASE_ZERO - FABRIC_RECONFIGURATION_PHASE_INVALID + 1] ={
+[FABRIC_RECONFIGURATION_PHASE_INVALID - FABRIC_RECONFIGURATION_PHASE_INVALID] = "FABRIC_RECONFIGURATION_PHASE_INVALID",
+[FABRIC_RECONFIGURATION_PHASE_NONE - FABRIC_RECONFIGURATION_PHASE_INVALID] = "FABRIC_RECONFIGURATION_PHASE_NONE",
+[FABRIC_RECONFIGURATION_PHASE_ZERO - FABRIC_RECONFIGURATION_PHASE_INVALID] = "FABRIC_RECONFIGURATION_PHASE_ZERO",
+[FABRIC_RECONFIGURATION_PHASE_ONE - FABRIC_RECONFIGURATION_PHASE_INVALID] = "FABRIC_RECONFIGURATION_PHASE_ONE",
+[FABRIC_RECONFIGURATION_PHASE_TWO - FABRIC_RECONFIGURATION_PHASE_INVALID] = "FABRIC_RECONFIGURATION_PHASE_TWO",
+[FABRIC_RECONFIGURATION_PHASE_THREE - FABRIC_RECONFIGURATION_PHASE_INVALID] = "FABRIC_RECONFIGURATION_PHASE_THREE",
+[FABRIC_RECONFIGURATION_PHASE_FOUR - FABRIC_RECONFIGURATION_PHASE_INVALID] = "FABRIC_RECONFIGURATION_PHASE_FOUR",
+[FABRIC_RECONFIGURATION_ABORT_PHASE_ZERO - FABRIC_RECONFIGURATION_PHASE_INVALID] = "FABRIC_RECONFIGURATION_ABORT_PHASE_ZERO",
 };
-const char* MU_C3(MU_,FABRIC_ROLLING_UPGRADE_MODE,_ToString)(FABRIC_ROLLING_UPGRADE_MODE value)
+const char* MU_C3(MU_,FABRIC_RECONFIGURATION_PHASE,_ToString)(FABRIC_RECONFIGURATION_PHASE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_RECONFIGURATION_PHASE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_RECONFIGURATION_PHASE, _Strings))/sizeof(MU_C2(FABRIC_RECONFIGURATION_PHASE, _Strings)[0])) && (MU_C2(FABRIC_RECONFIGURATION_PHASE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_ROLLING_UPGRADE_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_RECONFIGURATION_PHASE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_ValuesAndStrings[] ={
-{ FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID , "FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID" },
-{ FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_ROLLBACK , "FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_ROLLBACK" },
-{ FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_MANUAL , "FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_MANUAL" },
+static const SF_ENUM_AND_STRING FABRIC_RECONFIGURATION_PHASE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_RECONFIGURATION_PHASE_ONE , "FABRIC_RECONFIGURATION_PHASE_ONE" },
+{ FABRIC_RECONFIGURATION_PHASE_ZERO , "FABRIC_RECONFIGURATION_PHASE_ZERO" },
+{ FABRIC_RECONFIGURATION_PHASE_NONE , "FABRIC_RECONFIGURATION_PHASE_NONE" },
+{ FABRIC_RECONFIGURATION_ABORT_PHASE_ZERO , "FABRIC_RECONFIGURATION_ABORT_PHASE_ZERO" },
+{ FABRIC_RECONFIGURATION_PHASE_THREE , "FABRIC_RECONFIGURATION_PHASE_THREE" },
+{ FABRIC_RECONFIGURATION_PHASE_FOUR , "FABRIC_RECONFIGURATION_PHASE_FOUR" },
+{ FABRIC_RECONFIGURATION_PHASE_INVALID , "FABRIC_RECONFIGURATION_PHASE_INVALID" },
+{ FABRIC_RECONFIGURATION_PHASE_TWO , "FABRIC_RECONFIGURATION_PHASE_TWO" },
 };
-const char* MU_C3(MU_,FABRIC_MONITORED_UPGRADE_FAILURE_ACTION,_ToString)(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION value)
+static const int32_t FABRIC_RECONFIGURATION_PHASE_Seeds[] ={
+-2, 1, -3, -4, -5, -6, -8, 0,
+};
+int MU_C2(FABRIC_RECONFIGURATION_PHASE, _FromString)(const char* enumAsString, FABRIC_RECONFIGURATION_PHASE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RECONFIGURATION_PHASE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RECONFIGURATION_PHASE, _Seeds), sizeof(MU_C2(FABRIC_RECONFIGURATION_PHASE, _Seeds))/sizeof(MU_C2(FABRIC_RECONFIGURATION_PHASE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RECONFIGURATION_PHASE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_ValuesAndStrings[] ={
-{ FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID , "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID" },
-{ FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_WAIT_DURATION , "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_WAIT_DURATION" },
-{ FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_STABLE_DURATION , "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_STABLE_DURATION" },
-{ FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_RETRY , "FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_RETRY" },
+int MU_C2(FABRIC_RECONFIGURATION_PHASE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RECONFIGURATION_PHASE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RECONFIGURATION_PHASE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RECONFIGURATION_PHASE, _Seeds), sizeof(MU_C2(FABRIC_RECONFIGURATION_PHASE, _Seeds))/sizeof(MU_C2(FABRIC_RECONFIGURATION_PHASE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RECONFIGURATION_PHASE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_RECONFIGURATION_TYPE_Strings[FABRIC_RECONFIGURATION_TYPE_NONE - FABRIC_RECONFIGURATION_TYPE_INVALID + 1] ={
+[FABRIC_RECONFIGURATION_TYPE_INVALID - FABRIC_RECONFIGURATION_TYPE_INVALID] = "FABRIC_RECONFIGURATION_TYPE_INVALID",
+[FABRIC_RECONFIGURATION_TYPE_SWAPPRIMARY - FABRIC_RECONFIGURATION_TYPE_INVALID] = "FABRIC_RECONFIGURATION_TYPE_SWAPPRIMARY",
+[FABRIC_RECONFIGURATION_TYPE_FAILOVER - FABRIC_RECONFIGURATION_TYPE_INVALID] = "FABRIC_RECONFIGURATION_TYPE_FAILOVER",
+[FABRIC_RECONFIGURATION_TYPE_OTHER - FABRIC_RECONFIGURATION_TYPE_INVALID] = "FABRIC_RECONFIGURATION_TYPE_OTHER",
+[FABRIC_RECONFIGURATION_TYPE_NONE - FABRIC_RECONFIGURATION_TYPE_INVALID] = "FABRIC_RECONFIGURATION_TYPE_NONE",
 };
-const char* MU_C3(MU_,FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE,_ToString)(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE value)
+const char* MU_C3(MU_,FABRIC_RECONFIGURATION_TYPE,_ToString)(FABRIC_RECONFIGURATION_TYPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_RECONFIGURATION_TYPE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_RECONFIGURATION_TYPE, _Strings))/sizeof(MU_C2(FABRIC_RECONFIGURATION_TYPE, _Strings)[0])) && (MU_C2(FABRIC_RECONFIGURATION_TYPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_RECONFIGURATION_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_ValuesAndStrings[] ={
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_NONE , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_NONE" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_MODE , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_MODE" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FORCE_RESTART , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FORCE_RESTART" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_REPLICA_SET_CHECK_TIMEOUT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_REPLICA_SET_CHECK_TIMEOUT" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FAILURE_ACTION , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FAILURE_ACTION" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_WAIT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_WAIT" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_STABLE , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_STABLE" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_RETRY , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_RETRY" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_TIMEOUT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_TIMEOUT" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_DOMAIN_TIMEOUT , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_DOMAIN_TIMEOUT" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_POLICY , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_POLICY" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_ENABLE_DELTAS , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_ENABLE_DELTAS" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_HEALTH_POLICY , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_HEALTH_POLICY" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_APPLICATION_HEALTH_POLICY_MAP , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_APPLICATION_HEALTH_POLICY_MAP" },
-{ FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_INSTANCE_CLOSE_DELAY_DURATION , "FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_INSTANCE_CLOSE_DELAY_DURATION" },
+static const SF_ENUM_AND_STRING FABRIC_RECONFIGURATION_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_RECONFIGURATION_TYPE_INVALID , "FABRIC_RECONFIGURATION_TYPE_INVALID" },
+{ FABRIC_RECONFIGURATION_TYPE_SWAPPRIMARY , "FABRIC_RECONFIGURATION_TYPE_SWAPPRIMARY" },
+{ FABRIC_RECONFIGURATION_TYPE_NONE , "FABRIC_RECONFIGURATION_TYPE_NONE" },
+{ FABRIC_RECONFIGURATION_TYPE_FAILOVER , "FABRIC_RECONFIGURATION_TYPE_FAILOVER" },
+{ FABRIC_RECONFIGURATION_TYPE_OTHER , "FABRIC_RECONFIGURATION_TYPE_OTHER" },
 };
-const char* MU_C3(MU_,FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS,_ToString)(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS value)
+static const int32_t FABRIC_RECONFIGURATION_TYPE_Seeds[] ={
+1, 2, 0, -4, 0,
+};
+int MU_C2(FABRIC_RECONFIGURATION_TYPE, _FromString)(const char* enumAsString, FABRIC_RECONFIGURATION_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RECONFIGURATION_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RECONFIGURATION_TYPE, _Seeds), sizeof(MU_C2(FABRIC_RECONFIGURATION_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_RECONFIGURATION_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RECONFIGURATION_TYPE)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_RECONFIGURATION_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_RECONFIGURATION_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_RECONFIGURATION_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_RECONFIGURATION_TYPE, _Seeds), sizeof(MU_C2(FABRIC_RECONFIGURATION_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_RECONFIGURATION_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_RECONFIGURATION_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_UPGRADE_STATE_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_UPGRADE_STATE_INVALID , "FABRIC_APPLICATION_UPGRADE_STATE_INVALID" },
-{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS" },
-{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_COMPLETED , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_COMPLETED" },
-{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_PENDING , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_PENDING" },
-{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS" },
-{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED" },
-{ FABRIC_APPLICATION_UPGRADE_STATE_FAILED , "FABRIC_APPLICATION_UPGRADE_STATE_FAILED" },
-{ FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_PENDING , "FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_PENDING" },
+static const char* const FABRIC_CHAOS_STATUS_Strings[FABRIC_CHAOS_STATUS_STOPPED - FABRIC_CHAOS_STATUS_INVALID + 1] ={
+[FABRIC_CHAOS_STATUS_INVALID - FABRIC_CHAOS_STATUS_INVALID] = "FABRIC_CHAOS_STATUS_INVALID",
+[FABRIC_CHAOS_STATUS_RUNNING - FABRIC_CHAOS_STATUS_INVALID] = "FABRIC_CHAOS_STATUS_RUNNING",
+[FABRIC_CHAOS_STATUS_STOPPED - FABRIC_CHAOS_STATUS_INVALID] = "FABRIC_CHAOS_STATUS_STOPPED",
 };
-const char* MU_C3(MU_,FABRIC_APPLICATION_UPGRADE_STATE,_ToString)(FABRIC_APPLICATION_UPGRADE_STATE value)
+const char* MU_C3(MU_,FABRIC_CHAOS_STATUS,_ToString)(FABRIC_CHAOS_STATUS value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_CHAOS_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_CHAOS_STATUS, _Strings))/sizeof(MU_C2(FABRIC_CHAOS_STATUS, _Strings)[0])) && (MU_C2(FABRIC_CHAOS_STATUS, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_UPGRADE_STATE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_CHAOS_STATUS, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_UPGRADE_STATE_ValuesAndStrings[] ={
-{ FABRIC_UPGRADE_STATE_INVALID , "FABRIC_UPGRADE_STATE_INVALID" },
-{ FABRIC_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS , "FABRIC_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS" },
-{ FABRIC_UPGRADE_STATE_ROLLING_BACK_COMPLETED , "FABRIC_UPGRADE_STATE_ROLLING_BACK_COMPLETED" },
-{ FABRIC_UPGRADE_STATE_ROLLING_FORWARD_PENDING , "FABRIC_UPGRADE_STATE_ROLLING_FORWARD_PENDING" },
-{ FABRIC_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS , "FABRIC_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS" },
-{ FABRIC_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED , "FABRIC_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED" },
-{ FABRIC_UPGRADE_STATE_FAILED , "FABRIC_UPGRADE_STATE_FAILED" },
-{ FABRIC_UPGRADE_STATE_ROLLING_BACK_PENDING , "FABRIC_UPGRADE_STATE_ROLLING_BACK_PENDING" },
+static const SF_ENUM_AND_STRING FABRIC_CHAOS_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_CHAOS_STATUS_RUNNING , "FABRIC_CHAOS_STATUS_RUNNING" },
+{ FABRIC_CHAOS_STATUS_INVALID , "FABRIC_CHAOS_STATUS_INVALID" },
+{ FABRIC_CHAOS_STATUS_STOPPED , "FABRIC_CHAOS_STATUS_STOPPED" },
 };
-const char* MU_C3(MU_,FABRIC_UPGRADE_STATE,_ToString)(FABRIC_UPGRADE_STATE value)
+static const int32_t FABRIC_CHAOS_STATUS_Seeds[] ={
+-1, -2, -3,
+};
+int MU_C2(FABRIC_CHAOS_STATUS, _FromString)(const char* enumAsString, FABRIC_CHAOS_STATUS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_UPGRADE_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_UPGRADE_STATE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_UPGRADE_STATE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_UPGRADE_STATE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CHAOS_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CHAOS_STATUS, _Seeds), sizeof(MU_C2(FABRIC_CHAOS_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_CHAOS_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CHAOS_STATUS)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_UPGRADE_DOMAIN_STATE_ValuesAndStrings[] ={
-{ FABRIC_UPGRADE_DOMAIN_STATE_INVALID , "FABRIC_UPGRADE_DOMAIN_STATE_INVALID" },
-{ FABRIC_UPGRADE_DOMAIN_STATE_PENDING , "FABRIC_UPGRADE_DOMAIN_STATE_PENDING" },
-{ FABRIC_UPGRADE_DOMAIN_STATE_IN_PROGRESS , "FABRIC_UPGRADE_DOMAIN_STATE_IN_PROGRESS" },
-{ FABRIC_UPGRADE_DOMAIN_STATE_COMPLETED , "FABRIC_UPGRADE_DOMAIN_STATE_COMPLETED" },
-};
-const char* MU_C3(MU_,FABRIC_UPGRADE_DOMAIN_STATE,_ToString)(FABRIC_UPGRADE_DOMAIN_STATE value)
+int MU_C2(FABRIC_CHAOS_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CHAOS_STATUS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_UPGRADE_DOMAIN_STATE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CHAOS_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CHAOS_STATUS, _Seeds), sizeof(MU_C2(FABRIC_CHAOS_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_CHAOS_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CHAOS_STATUS)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_UPGRADE_FAILURE_REASON_ValuesAndStrings[] ={
-{ FABRIC_UPGRADE_FAILURE_REASON_NONE , "FABRIC_UPGRADE_FAILURE_REASON_NONE" },
-{ FABRIC_UPGRADE_FAILURE_REASON_INTERRUPTED , "FABRIC_UPGRADE_FAILURE_REASON_INTERRUPTED" },
-{ FABRIC_UPGRADE_FAILURE_REASON_HEALTH_CHECK , "FABRIC_UPGRADE_FAILURE_REASON_HEALTH_CHECK" },
-{ FABRIC_UPGRADE_FAILURE_REASON_UPGRADE_DOMAIN_TIMEOUT , "FABRIC_UPGRADE_FAILURE_REASON_UPGRADE_DOMAIN_TIMEOUT" },
-{ FABRIC_UPGRADE_FAILURE_REASON_OVERALL_UPGRADE_TIMEOUT , "FABRIC_UPGRADE_FAILURE_REASON_OVERALL_UPGRADE_TIMEOUT" },
-{ FABRIC_UPGRADE_FAILURE_REASON_PROCESSING_FAILURE , "FABRIC_UPGRADE_FAILURE_REASON_PROCESSING_FAILURE" },
+static const char* const FABRIC_CHAOS_SCHEDULE_STATUS_Strings[FABRIC_CHAOS_SCHEDULE_STATUS_STOPPED - FABRIC_CHAOS_SCHEDULE_STATUS_INVALID + 1] ={
+[FABRIC_CHAOS_SCHEDULE_STATUS_INVALID - FABRIC_CHAOS_SCHEDULE_STATUS_INVALID] = "FABRIC_CHAOS_SCHEDULE_STATUS_INVALID",
+[FABRIC_CHAOS_SCHEDULE_STATUS_ACTIVE - FABRIC_CHAOS_SCHEDULE_STATUS_INVALID] = "FABRIC_CHAOS_SCHEDULE_STATUS_ACTIVE",
+[FABRIC_CHAOS_SCHEDULE_STATUS_EXPIRED - FABRIC_CHAOS_SCHEDULE_STATUS_INVALID] = "FABRIC_CHAOS_SCHEDULE_STATUS_EXPIRED",
+[FABRIC_CHAOS_SCHEDULE_STATUS_PENDING - FABRIC_CHAOS_SCHEDULE_STATUS_INVALID] = "FABRIC_CHAOS_SCHEDULE_STATUS_PENDING",
+[FABRIC_CHAOS_SCHEDULE_STATUS_STOPPED - FABRIC_CHAOS_SCHEDULE_STATUS_INVALID] = "FABRIC_CHAOS_SCHEDULE_STATUS_STOPPED",
 };
-const char* MU_C3(MU_,FABRIC_UPGRADE_FAILURE_REASON,_ToString)(FABRIC_UPGRADE_FAILURE_REASON value)
+const char* MU_C3(MU_,FABRIC_CHAOS_SCHEDULE_STATUS,_ToString)(FABRIC_CHAOS_SCHEDULE_STATUS value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_CHAOS_SCHEDULE_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Strings))/sizeof(MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Strings)[0])) && (MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_UPGRADE_FAILURE_REASON, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_LOCAL_STORE_KIND_ValuesAndStrings[] ={
-{ FABRIC_LOCAL_STORE_KIND_INVALID , "FABRIC_LOCAL_STORE_KIND_INVALID" },
-{ FABRIC_LOCAL_STORE_KIND_ESE , "FABRIC_LOCAL_STORE_KIND_ESE" },
+static const SF_ENUM_AND_STRING FABRIC_CHAOS_SCHEDULE_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_CHAOS_SCHEDULE_STATUS_EXPIRED , "FABRIC_CHAOS_SCHEDULE_STATUS_EXPIRED" },
+{ FABRIC_CHAOS_SCHEDULE_STATUS_INVALID , "FABRIC_CHAOS_SCHEDULE_STATUS_INVALID" },
+{ FABRIC_CHAOS_SCHEDULE_STATUS_PENDING , "FABRIC_CHAOS_SCHEDULE_STATUS_PENDING" },
+{ FABRIC_CHAOS_SCHEDULE_STATUS_STOPPED , "FABRIC_CHAOS_SCHEDULE_STATUS_STOPPED" },
+{ FABRIC_CHAOS_SCHEDULE_STATUS_ACTIVE , "FABRIC_CHAOS_SCHEDULE_STATUS_ACTIVE" },
 };
-const char* MU_C3(MU_,FABRIC_LOCAL_STORE_KIND,_ToString)(FABRIC_LOCAL_STORE_KIND value)
+static const int32_t FABRIC_CHAOS_SCHEDULE_STATUS_Seeds[] ={
+1, 0, -2, 11, 0,
+};
+int MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _FromString)(const char* enumAsString, FABRIC_CHAOS_SCHEDULE_STATUS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_LOCAL_STORE_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_LOCAL_STORE_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_LOCAL_STORE_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_LOCAL_STORE_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Seeds), sizeof(MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CHAOS_SCHEDULE_STATUS)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_REPLICA_KIND_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_REPLICA_KIND_INVALID , "FABRIC_SERVICE_REPLICA_KIND_INVALID" },
-{ FABRIC_SERVICE_REPLICA_KIND_KEY_VALUE_STORE , "FABRIC_SERVICE_REPLICA_KIND_KEY_VALUE_STORE" },
-};
-const char* MU_C3(MU_,FABRIC_SERVICE_REPLICA_KIND,_ToString)(FABRIC_SERVICE_REPLICA_KIND value)
+int MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CHAOS_SCHEDULE_STATUS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_REPLICA_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_REPLICA_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SERVICE_REPLICA_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_REPLICA_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Seeds), sizeof(MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CHAOS_SCHEDULE_STATUS)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_ValuesAndStrings[] ={
-{ FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID , "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID" },
-{ FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NONE , "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NONE" },
-{ FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NON_BLOCKING_QUORUM_ACKED , "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NON_BLOCKING_QUORUM_ACKED" },
-{ FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_BLOCK_SECONDARY_ACK , "FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_BLOCK_SECONDARY_ACK" },
+static const char* const FABRIC_CHAOS_EVENT_KIND_Strings[FABRIC_CHAOS_EVENT_KIND_STOPPED - FABRIC_CHAOS_EVENT_KIND_INVALID + 1] ={
+[FABRIC_CHAOS_EVENT_KIND_INVALID - FABRIC_CHAOS_EVENT_KIND_INVALID] = "FABRIC_CHAOS_EVENT_KIND_INVALID",
+[FABRIC_CHAOS_EVENT_KIND_STARTED - FABRIC_CHAOS_EVENT_KIND_INVALID] = "FABRIC_CHAOS_EVENT_KIND_STARTED",
+[FABRIC_CHAOS_EVENT_KIND_EXECUTING_FAULTS - FABRIC_CHAOS_EVENT_KIND_INVALID] = "FABRIC_CHAOS_EVENT_KIND_EXECUTING_FAULTS",
+[FABRIC_CHAOS_EVENT_KIND_WAITING - FABRIC_CHAOS_EVENT_KIND_INVALID] = "FABRIC_CHAOS_EVENT_KIND_WAITING",
+[FABRIC_CHAOS_EVENT_KIND_VALIDATION_FAILED - FABRIC_CHAOS_EVENT_KIND_INVALID] = "FABRIC_CHAOS_EVENT_KIND_VALIDATION_FAILED",
+[FABRIC_CHAOS_EVENT_KIND_TEST_ERROR - FABRIC_CHAOS_EVENT_KIND_INVALID] = "FABRIC_CHAOS_EVENT_KIND_TEST_ERROR",
+[FABRIC_CHAOS_EVENT_KIND_STOPPED - FABRIC_CHAOS_EVENT_KIND_INVALID] = "FABRIC_CHAOS_EVENT_KIND_STOPPED",
 };
-const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE,_ToString)(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE value)
+const char* MU_C3(MU_,FABRIC_CHAOS_EVENT_KIND,_ToString)(FABRIC_CHAOS_EVENT_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_CHAOS_EVENT_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_CHAOS_EVENT_KIND, _Strings))/sizeof(MU_C2(FABRIC_CHAOS_EVENT_KIND, _Strings)[0])) && (MU_C2(FABRIC_CHAOS_EVENT_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_CHAOS_EVENT_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_ValuesAndStrings[] ={
-{ FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT , "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT" },
-{ FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_PHYSICAL , "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_PHYSICAL" },
-{ FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_LOGICAL , "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_LOGICAL" },
-{ FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_REBUILD , "FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_REBUILD" },
+static const SF_ENUM_AND_STRING FABRIC_CHAOS_EVENT_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_CHAOS_EVENT_KIND_INVALID , "FABRIC_CHAOS_EVENT_KIND_INVALID" },
+{ FABRIC_CHAOS_EVENT_KIND_STARTED , "FABRIC_CHAOS_EVENT_KIND_STARTED" },
+{ FABRIC_CHAOS_EVENT_KIND_STOPPED , "FABRIC_CHAOS_EVENT_KIND_STOPPED" },
+{ FABRIC_CHAOS_EVENT_KIND_EXECUTING_FAULTS , "FABRIC_CHAOS_EVENT_KIND_EXECUTING_FAULTS" },
+{ FABRIC_CHAOS_EVENT_KIND_VALIDATION_FAILED , "FABRIC_CHAOS_EVENT_KIND_VALIDATION_FAILED" },
+{ FABRIC_CHAOS_EVENT_KIND_TEST_ERROR , "FABRIC_CHAOS_EVENT_KIND_TEST_ERROR" },
+{ FABRIC_CHAOS_EVENT_KIND_WAITING , "FABRIC_CHAOS_EVENT_KIND_WAITING" },
 };
-const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE,_ToString)(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE value)
+static const int32_t FABRIC_CHAOS_EVENT_KIND_Seeds[] ={
+-2, 0, -4, 0, -6, 2, 0,
+};
+int MU_C2(FABRIC_CHAOS_EVENT_KIND, _FromString)(const char* enumAsString, FABRIC_CHAOS_EVENT_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CHAOS_EVENT_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CHAOS_EVENT_KIND, _Seeds), sizeof(MU_C2(FABRIC_CHAOS_EVENT_KIND, _Seeds))/sizeof(MU_C2(FABRIC_CHAOS_EVENT_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CHAOS_EVENT_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_TRANSACTION_ISOLATION_LEVEL_ValuesAndStrings[] ={
-{ FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT , "FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT" },
-{ FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_UNCOMMITTED , "FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_UNCOMMITTED" },
-{ FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_COMMITTED , "FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_COMMITTED" },
-{ FABRIC_TRANSACTION_ISOLATION_LEVEL_REPEATABLE_READ , "FABRIC_TRANSACTION_ISOLATION_LEVEL_REPEATABLE_READ" },
-{ FABRIC_TRANSACTION_ISOLATION_LEVEL_SNAPSHOT , "FABRIC_TRANSACTION_ISOLATION_LEVEL_SNAPSHOT" },
-{ FABRIC_TRANSACTION_ISOLATION_LEVEL_SERIALIZABLE , "FABRIC_TRANSACTION_ISOLATION_LEVEL_SERIALIZABLE" },
-};
-const char* MU_C3(MU_,FABRIC_TRANSACTION_ISOLATION_LEVEL,_ToString)(FABRIC_TRANSACTION_ISOLATION_LEVEL value)
+int MU_C2(FABRIC_CHAOS_EVENT_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CHAOS_EVENT_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_TRANSACTION_ISOLATION_LEVEL, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CHAOS_EVENT_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CHAOS_EVENT_KIND, _Seeds), sizeof(MU_C2(FABRIC_CHAOS_EVENT_KIND, _Seeds))/sizeof(MU_C2(FABRIC_CHAOS_EVENT_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CHAOS_EVENT_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_NODE_DEACTIVATION_INTENT_ValuesAndStrings[] ={
-{ FABRIC_NODE_DEACTIVATION_INTENT_INVALID , "FABRIC_NODE_DEACTIVATION_INTENT_INVALID" },
-{ FABRIC_NODE_DEACTIVATION_INTENT_PAUSE , "FABRIC_NODE_DEACTIVATION_INTENT_PAUSE" },
-{ FABRIC_NODE_DEACTIVATION_INTENT_RESTART , "FABRIC_NODE_DEACTIVATION_INTENT_RESTART" },
-{ FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_DATA , "FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_DATA" },
-{ FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_NODE , "FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_NODE" },
+static const char* const FABRIC_PROVISION_APPLICATION_TYPE_KIND_Strings[FABRIC_PROVISION_APPLICATION_TYPE_KIND_EXTERNAL_STORE - FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID + 1] ={
+[FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID - FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID] = "FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID",
+[FABRIC_PROVISION_APPLICATION_TYPE_KIND_IMAGE_STORE_PATH - FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID] = "FABRIC_PROVISION_APPLICATION_TYPE_KIND_IMAGE_STORE_PATH",
+[FABRIC_PROVISION_APPLICATION_TYPE_KIND_EXTERNAL_STORE - FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID] = "FABRIC_PROVISION_APPLICATION_TYPE_KIND_EXTERNAL_STORE",
 };
-const char* MU_C3(MU_,FABRIC_NODE_DEACTIVATION_INTENT,_ToString)(FABRIC_NODE_DEACTIVATION_INTENT value)
+const char* MU_C3(MU_,FABRIC_PROVISION_APPLICATION_TYPE_KIND,_ToString)(FABRIC_PROVISION_APPLICATION_TYPE_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Strings))/sizeof(MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Strings)[0])) && (MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_NODE_DEACTIVATION_INTENT, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_DISABLE_FLAG_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_DISABLE_FLAG_INVALID , "FABRIC_SERVICE_DISABLE_FLAG_INVALID" },
-{ FABRIC_SERVICE_DISABLE_FLAG_REMOVE_DATA , "FABRIC_SERVICE_DISABLE_FLAG_REMOVE_DATA" },
+static const SF_ENUM_AND_STRING FABRIC_PROVISION_APPLICATION_TYPE_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PROVISION_APPLICATION_TYPE_KIND_IMAGE_STORE_PATH , "FABRIC_PROVISION_APPLICATION_TYPE_KIND_IMAGE_STORE_PATH" },
+{ FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID , "FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID" },
+{ FABRIC_PROVISION_APPLICATION_TYPE_KIND_EXTERNAL_STORE , "FABRIC_PROVISION_APPLICATION_TYPE_KIND_EXTERNAL_STORE" },
 };
-const char* MU_C3(MU_,FABRIC_SERVICE_DISABLE_FLAG,_ToString)(FABRIC_SERVICE_DISABLE_FLAG value)
+static const int32_t FABRIC_PROVISION_APPLICATION_TYPE_KIND_Seeds[] ={
+-1, -2, -3,
+};
+int MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _FromString)(const char* enumAsString, FABRIC_PROVISION_APPLICATION_TYPE_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_DISABLE_FLAG, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Seeds), sizeof(MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PROVISION_APPLICATION_TYPE_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_TYPE_STATUS_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_TYPE_STATUS_INVALID , "FABRIC_APPLICATION_TYPE_STATUS_INVALID" },
-{ FABRIC_APPLICATION_TYPE_STATUS_PROVISIONING , "FABRIC_APPLICATION_TYPE_STATUS_PROVISIONING" },
-{ FABRIC_APPLICATION_TYPE_STATUS_AVAILABLE , "FABRIC_APPLICATION_TYPE_STATUS_AVAILABLE" },
-{ FABRIC_APPLICATION_TYPE_STATUS_UNPROVISIONING , "FABRIC_APPLICATION_TYPE_STATUS_UNPROVISIONING" },
-{ FABRIC_APPLICATION_TYPE_STATUS_FAILED , "FABRIC_APPLICATION_TYPE_STATUS_FAILED" },
-};
-const char* MU_C3(MU_,FABRIC_APPLICATION_TYPE_STATUS,_ToString)(FABRIC_APPLICATION_TYPE_STATUS value)
+int MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PROVISION_APPLICATION_TYPE_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_TYPE_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Seeds), sizeof(MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Seeds))/sizeof(MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PROVISION_APPLICATION_TYPE_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_STATUS_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_STATUS_INVALID , "FABRIC_APPLICATION_STATUS_INVALID" },
-{ FABRIC_APPLICATION_STATUS_READY , "FABRIC_APPLICATION_STATUS_READY" },
-{ FABRIC_APPLICATION_STATUS_UPGRADING , "FABRIC_APPLICATION_STATUS_UPGRADING" },
-{ FABRIC_APPLICATION_STATUS_CREATING , "FABRIC_APPLICATION_STATUS_CREATING" },
-{ FABRIC_APPLICATION_STATUS_DELETING , "FABRIC_APPLICATION_STATUS_DELETING" },
-{ FABRIC_APPLICATION_STATUS_FAILED , "FABRIC_APPLICATION_STATUS_FAILED" },
+static const char* const FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_Strings[FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_MANUAL - FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID + 1] ={
+[FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID - FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID] = "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID",
+[FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_DEFAULT - FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID] = "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_DEFAULT",
+[FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_AUTOMATIC - FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID] = "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_AUTOMATIC",
+[FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_MANUAL - FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID] = "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_MANUAL",
 };
-const char* MU_C3(MU_,FABRIC_APPLICATION_STATUS,_ToString)(FABRIC_APPLICATION_STATUS value)
+const char* MU_C3(MU_,FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY,_ToString)(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_STATUS, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Strings))/sizeof(MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Strings)[0])) && (MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_DEFINITION_KIND_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_DEFINITION_KIND_INVALID , "FABRIC_APPLICATION_DEFINITION_KIND_INVALID" },
-{ FABRIC_APPLICATION_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_DESCRIPTION" },
-{ FABRIC_APPLICATION_DEFINITION_KIND_COMPOSE , "FABRIC_APPLICATION_DEFINITION_KIND_COMPOSE" },
-{ FABRIC_APPLICATION_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION" },
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_AUTOMATIC , "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_AUTOMATIC" },
+{ FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID , "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID" },
+{ FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_DEFAULT , "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_DEFAULT" },
+{ FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_MANUAL , "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_MANUAL" },
 };
-const char* MU_C3(MU_,FABRIC_APPLICATION_DEFINITION_KIND,_ToString)(FABRIC_APPLICATION_DEFINITION_KIND value)
+static const int32_t FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_Seeds[] ={
+0, 1, -1, -2,
+};
+int MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _FromString)(const char* enumAsString, FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_DEFINITION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_TYPE_DEFINITION_KIND_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID" },
-{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_PACKAGE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_PACKAGE" },
-{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_COMPOSE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_COMPOSE" },
-{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION" },
+int MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_DIAGNOSTICS_SINKS_KIND_Strings[FABRIC_DIAGNOSTICS_SINKS_KIND_AZUREINTERNAL - FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID + 1] ={
+[FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID - FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID] = "FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID",
+[FABRIC_DIAGNOSTICS_SINKS_KIND_AZUREINTERNAL - FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID] = "FABRIC_DIAGNOSTICS_SINKS_KIND_AZUREINTERNAL",
 };
-const char* MU_C3(MU_,FABRIC_APPLICATION_TYPE_DEFINITION_KIND,_ToString)(FABRIC_APPLICATION_TYPE_DEFINITION_KIND value)
+const char* MU_C3(MU_,FABRIC_DIAGNOSTICS_SINKS_KIND,_ToString)(FABRIC_DIAGNOSTICS_SINKS_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Strings))/sizeof(MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Strings)[0])) && (MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_DEFINITION_KIND_FILTER_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_DEFAULT , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_DEFAULT" },
-{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_ALL , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_ALL" },
-{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_DESCRIPTION" },
-{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_COMPOSE , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_COMPOSE" },
-{ FABRIC_APPLICATION_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION" },
+static const SF_ENUM_AND_STRING FABRIC_DIAGNOSTICS_SINKS_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_DIAGNOSTICS_SINKS_KIND_AZUREINTERNAL , "FABRIC_DIAGNOSTICS_SINKS_KIND_AZUREINTERNAL" },
+{ FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID , "FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID" },
 };
-const char* MU_C3(MU_,FABRIC_APPLICATION_DEFINITION_KIND_FILTER,_ToString)(FABRIC_APPLICATION_DEFINITION_KIND_FILTER value)
+static const int32_t FABRIC_DIAGNOSTICS_SINKS_KIND_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _FromString)(const char* enumAsString, FABRIC_DIAGNOSTICS_SINKS_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_DEFINITION_KIND_FILTER, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Seeds), sizeof(MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Seeds))/sizeof(MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DIAGNOSTICS_SINKS_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_DEFAULT , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_DEFAULT" },
-{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_ALL , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_ALL" },
-{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_PACKAGE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_PACKAGE" },
-{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_COMPOSE , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_COMPOSE" },
-{ FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION , "FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION" },
+int MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_DIAGNOSTICS_SINKS_KIND* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Seeds), sizeof(MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Seeds))/sizeof(MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_DIAGNOSTICS_SINKS_KIND)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_PLACEMENT_POLICY_TYPE_Strings[FABRIC_PLACEMENT_POLICY_ALLOW_MULTIPLE_STATELESS_INSTANCES_ON_NODE - FABRIC_PLACEMENT_POLICY_INVALID + 1] ={
+[FABRIC_PLACEMENT_POLICY_INVALID - FABRIC_PLACEMENT_POLICY_INVALID] = "FABRIC_PLACEMENT_POLICY_INVALID",
+[FABRIC_PLACEMENT_POLICY_INVALID_DOMAIN - FABRIC_PLACEMENT_POLICY_INVALID] = "FABRIC_PLACEMENT_POLICY_INVALID_DOMAIN",
+[FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN - FABRIC_PLACEMENT_POLICY_INVALID] = "FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN",
+[FABRIC_PLACEMENT_POLICY_PREFERRED_PRIMARY_DOMAIN - FABRIC_PLACEMENT_POLICY_INVALID] = "FABRIC_PLACEMENT_POLICY_PREFERRED_PRIMARY_DOMAIN",
+[FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN_DISTRIBUTION - FABRIC_PLACEMENT_POLICY_INVALID] = "FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN_DISTRIBUTION",
+[FABRIC_PLACEMENT_POLICY_NONPARTIALLY_PLACE_SERVICE - FABRIC_PLACEMENT_POLICY_INVALID] = "FABRIC_PLACEMENT_POLICY_NONPARTIALLY_PLACE_SERVICE",
+[FABRIC_PLACEMENT_POLICY_ALLOW_MULTIPLE_STATELESS_INSTANCES_ON_NODE - FABRIC_PLACEMENT_POLICY_INVALID] = "FABRIC_PLACEMENT_POLICY_ALLOW_MULTIPLE_STATELESS_INSTANCES_ON_NODE",
 };
-const char* MU_C3(MU_,FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER,_ToString)(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER value)
+const char* MU_C3(MU_,FABRIC_PLACEMENT_POLICY_TYPE,_ToString)(FABRIC_PLACEMENT_POLICY_TYPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_PLACEMENT_POLICY_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Strings))/sizeof(MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Strings)[0])) && (MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID , "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID" },
-{ FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_DISABLED , "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_DISABLED" },
-{ FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_NOT_REGISTERED , "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_NOT_REGISTERED" },
-{ FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_REGISTERED , "FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_REGISTERED" },
+static const SF_ENUM_AND_STRING FABRIC_PLACEMENT_POLICY_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PLACEMENT_POLICY_INVALID , "FABRIC_PLACEMENT_POLICY_INVALID" },
+{ FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN_DISTRIBUTION , "FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN_DISTRIBUTION" },
+{ FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN , "FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN" },
+{ FABRIC_PLACEMENT_POLICY_NONPARTIALLY_PLACE_SERVICE , "FABRIC_PLACEMENT_POLICY_NONPARTIALLY_PLACE_SERVICE" },
+{ FABRIC_PLACEMENT_POLICY_INVALID_DOMAIN , "FABRIC_PLACEMENT_POLICY_INVALID_DOMAIN" },
+{ FABRIC_PLACEMENT_POLICY_ALLOW_MULTIPLE_STATELESS_INSTANCES_ON_NODE , "FABRIC_PLACEMENT_POLICY_ALLOW_MULTIPLE_STATELESS_INSTANCES_ON_NODE" },
+{ FABRIC_PLACEMENT_POLICY_PREFERRED_PRIMARY_DOMAIN , "FABRIC_PLACEMENT_POLICY_PREFERRED_PRIMARY_DOMAIN" },
 };
-const char* MU_C3(MU_,FABRIC_SERVICE_TYPE_REGISTRATION_STATUS,_ToString)(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS value)
+static const int32_t FABRIC_PLACEMENT_POLICY_TYPE_Seeds[] ={
+1, -1, 0, 0, 1, 0, -4,
+};
+int MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _FromString)(const char* enumAsString, FABRIC_PLACEMENT_POLICY_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Seeds), sizeof(MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PLACEMENT_POLICY_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_DEPLOYMENT_STATUS_ValuesAndStrings[] ={
-{ FABRIC_DEPLOYMENT_STATUS_INVALID , "FABRIC_DEPLOYMENT_STATUS_INVALID" },
-{ FABRIC_DEPLOYMENT_STATUS_DOWNLOADING , "FABRIC_DEPLOYMENT_STATUS_DOWNLOADING" },
-{ FABRIC_DEPLOYMENT_STATUS_ACTIVATING , "FABRIC_DEPLOYMENT_STATUS_ACTIVATING" },
-{ FABRIC_DEPLOYMENT_STATUS_ACTIVE , "FABRIC_DEPLOYMENT_STATUS_ACTIVE" },
-{ FABRIC_DEPLOYMENT_STATUS_UPGRADING , "FABRIC_DEPLOYMENT_STATUS_UPGRADING" },
-{ FABRIC_DEPLOYMENT_STATUS_DEACTIVATING , "FABRIC_DEPLOYMENT_STATUS_DEACTIVATING" },
-{ FABRIC_DEPLOYMENT_STATUS_RAN_TO_COMPLETION , "FABRIC_DEPLOYMENT_STATUS_RAN_TO_COMPLETION" },
-{ FABRIC_DEPLOYMENT_STATUS_FAILED , "FABRIC_DEPLOYMENT_STATUS_FAILED" },
+int MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PLACEMENT_POLICY_TYPE* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Seeds), sizeof(MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PLACEMENT_POLICY_TYPE)candidate->value;
+    return 0;
+}
+
+static const char* const FABRIC_PACKAGE_SHARING_POLICY_SCOPE_Strings[FABRIC_PACKAGE_SHARING_POLICY_SCOPE_DATA - FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE + 1] ={
+[FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE - FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE] = "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE",
+[FABRIC_PACKAGE_SHARING_POLICY_SCOPE_ALL - FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE] = "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_ALL",
+[FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CODE - FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE] = "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CODE",
+[FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CONFIG - FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE] = "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CONFIG",
+[FABRIC_PACKAGE_SHARING_POLICY_SCOPE_DATA - FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE] = "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_DATA",
 };
-const char* MU_C3(MU_,FABRIC_DEPLOYMENT_STATUS,_ToString)(FABRIC_DEPLOYMENT_STATUS value)
+const char* MU_C3(MU_,FABRIC_PACKAGE_SHARING_POLICY_SCOPE,_ToString)(FABRIC_PACKAGE_SHARING_POLICY_SCOPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_DEPLOYMENT_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_DEPLOYMENT_STATUS, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Strings))/sizeof(MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Strings)[0])) && (MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_DEPLOYMENT_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_DEPLOYMENT_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_HOST_TYPE_ValuesAndStrings[] ={
-{ FABRIC_HOST_TYPE_INVALID , "FABRIC_HOST_TYPE_INVALID" },
-{ FABRIC_HOST_TYPE_EXE_HOST , "FABRIC_HOST_TYPE_EXE_HOST" },
-{ FABRIC_HOST_TYPE_CONTAINER_HOST , "FABRIC_HOST_TYPE_CONTAINER_HOST" },
+static const SF_ENUM_AND_STRING FABRIC_PACKAGE_SHARING_POLICY_SCOPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_DATA , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_DATA" },
+{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CODE , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CODE" },
+{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CONFIG , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CONFIG" },
+{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE" },
+{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_ALL , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_ALL" },
 };
-const char* MU_C3(MU_,FABRIC_HOST_TYPE,_ToString)(FABRIC_HOST_TYPE value)
+static const int32_t FABRIC_PACKAGE_SHARING_POLICY_SCOPE_Seeds[] ={
+0, 0, 1, 3, -1,
+};
+int MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _FromString)(const char* enumAsString, FABRIC_PACKAGE_SHARING_POLICY_SCOPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_HOST_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_HOST_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_HOST_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_HOST_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Seeds), sizeof(MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Seeds))/sizeof(MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PACKAGE_SHARING_POLICY_SCOPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_HOST_ISOLATION_MODE_ValuesAndStrings[] ={
-{ FABRIC_HOST_ISOLATION_MODE_NONE , "FABRIC_HOST_ISOLATION_MODE_NONE" },
-{ FABRIC_HOST_ISOLATION_MODE_PROCESS , "FABRIC_HOST_ISOLATION_MODE_PROCESS" },
-{ FABRIC_HOST_ISOLATION_MODE_HYPER_V , "FABRIC_HOST_ISOLATION_MODE_HYPER_V" },
-};
-const char* MU_C3(MU_,FABRIC_HOST_ISOLATION_MODE,_ToString)(FABRIC_HOST_ISOLATION_MODE value)
+int MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_PACKAGE_SHARING_POLICY_SCOPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_HOST_ISOLATION_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_HOST_ISOLATION_MODE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_HOST_ISOLATION_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_HOST_ISOLATION_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Seeds), sizeof(MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Seeds))/sizeof(MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_PACKAGE_SHARING_POLICY_SCOPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_ENTRY_POINT_STATUS_ValuesAndStrings[] ={
-{ FABRIC_ENTRY_POINT_STATUS_INVALID , "FABRIC_ENTRY_POINT_STATUS_INVALID" },
-{ FABRIC_ENTRY_POINT_STATUS_PENDING , "FABRIC_ENTRY_POINT_STATUS_PENDING" },
-{ FABRIC_ENTRY_POINT_STATUS_STARTING , "FABRIC_ENTRY_POINT_STATUS_STARTING" },
-{ FABRIC_ENTRY_POINT_STATUS_STARTED , "FABRIC_ENTRY_POINT_STATUS_STARTED" },
-{ FABRIC_ENTRY_POINT_STATUS_STOPPING , "FABRIC_ENTRY_POINT_STATUS_STOPPING" },
-{ FABRIC_ENTRY_POINT_STATUS_STOPPED , "FABRIC_ENTRY_POINT_STATUS_STOPPED" },
+static const SF_ENUM_AND_STRING FABRIC_HEALTH_STATE_FILTER_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_HEALTH_STATE_FILTER_DEFAULT , "FABRIC_HEALTH_STATE_FILTER_DEFAULT" },
+{ FABRIC_HEALTH_STATE_FILTER_NONE , "FABRIC_HEALTH_STATE_FILTER_NONE" },
+{ FABRIC_HEALTH_STATE_FILTER_OK , "FABRIC_HEALTH_STATE_FILTER_OK" },
+{ FABRIC_HEALTH_STATE_FILTER_WARNING , "FABRIC_HEALTH_STATE_FILTER_WARNING" },
+{ FABRIC_HEALTH_STATE_FILTER_ERROR , "FABRIC_HEALTH_STATE_FILTER_ERROR" },
+{ FABRIC_HEALTH_STATE_FILTER_ALL , "FABRIC_HEALTH_STATE_FILTER_ALL" },
 };
-const char* MU_C3(MU_,FABRIC_ENTRY_POINT_STATUS,_ToString)(FABRIC_ENTRY_POINT_STATUS value)
+const char* MU_C3(MU_,FABRIC_HEALTH_STATE_FILTER,_ToString)(FABRIC_HEALTH_STATE_FILTER value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_ENTRY_POINT_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_ENTRY_POINT_STATUS, _ValuesAndStrings)[0]);i++)
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_HEALTH_STATE_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_HEALTH_STATE_FILTER, _ValuesAndStrings)[0]);
+    while(low < high)
     {
-        if(MU_C2(FABRIC_ENTRY_POINT_STATUS, _ValuesAndStrings)[i].value == (int)value)
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_HEALTH_STATE_FILTER, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_HEALTH_STATE_FILTER, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
         {
-            return MU_C2(FABRIC_ENTRY_POINT_STATUS, _ValuesAndStrings)[i].valueAsString;
+            return MU_C2(FABRIC_HEALTH_STATE_FILTER, _ValuesAndStrings)[middle].valueAsString;
         }
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_NODE_UPGRADE_PHASE_ValuesAndStrings[] ={
-{ FABRIC_NODE_UPGRADE_PHASE_INVALID , "FABRIC_NODE_UPGRADE_PHASE_INVALID" },
-{ FABRIC_NODE_UPGRADE_PHASE_PRE_UPGRADE_SAFETY_CHECK , "FABRIC_NODE_UPGRADE_PHASE_PRE_UPGRADE_SAFETY_CHECK" },
-{ FABRIC_NODE_UPGRADE_PHASE_UPGRADING , "FABRIC_NODE_UPGRADE_PHASE_UPGRADING" },
-{ FABRIC_NODE_UPGRADE_PHASE_POST_UPGRADE_SAFETY_CHECK , "FABRIC_NODE_UPGRADE_PHASE_POST_UPGRADE_SAFETY_CHECK" },
+static const SF_ENUM_AND_STRING FABRIC_HEALTH_STATE_FILTER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_HEALTH_STATE_FILTER_OK , "FABRIC_HEALTH_STATE_FILTER_OK" },
+{ FABRIC_HEALTH_STATE_FILTER_NONE , "FABRIC_HEALTH_STATE_FILTER_NONE" },
+{ FABRIC_HEALTH_STATE_FILTER_ALL , "FABRIC_HEALTH_STATE_FILTER_ALL" },
+{ FABRIC_HEALTH_STATE_FILTER_DEFAULT , "FABRIC_HEALTH_STATE_FILTER_DEFAULT" },
+{ FABRIC_HEALTH_STATE_FILTER_WARNING , "FABRIC_HEALTH_STATE_FILTER_WARNING" },
+{ FABRIC_HEALTH_STATE_FILTER_ERROR , "FABRIC_HEALTH_STATE_FILTER_ERROR" },
 };
-const char* MU_C3(MU_,FABRIC_NODE_UPGRADE_PHASE,_ToString)(FABRIC_NODE_UPGRADE_PHASE value)
+static const int32_t FABRIC_HEALTH_STATE_FILTER_Seeds[] ={
+0, 0, 0, 4, 14, -3,
+};
+int MU_C2(FABRIC_HEALTH_STATE_FILTER, _FromString)(const char* enumAsString, FABRIC_HEALTH_STATE_FILTER* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_NODE_UPGRADE_PHASE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_NODE_UPGRADE_PHASE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_NODE_UPGRADE_PHASE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_NODE_UPGRADE_PHASE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_STATE_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_STATE_FILTER, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_STATE_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_STATE_FILTER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_STATE_FILTER)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_UPGRADE_SAFETY_CHECK_KIND_ValuesAndStrings[] ={
-{ FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID , "FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID" },
-{ FABRIC_UPGRADE_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM , "FABRIC_UPGRADE_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM" },
-{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM" },
-{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT" },
-{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP" },
-{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION" },
-{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA" },
-{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY" },
-{ FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RESOURCE_AVAILABILITY , "FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RESOURCE_AVAILABILITY" },
-};
-const char* MU_C3(MU_,FABRIC_UPGRADE_SAFETY_CHECK_KIND,_ToString)(FABRIC_UPGRADE_SAFETY_CHECK_KIND value)
+int MU_C2(FABRIC_HEALTH_STATE_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_HEALTH_STATE_FILTER* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_UPGRADE_SAFETY_CHECK_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_HEALTH_STATE_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_HEALTH_STATE_FILTER, _Seeds), sizeof(MU_C2(FABRIC_HEALTH_STATE_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_HEALTH_STATE_FILTER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_HEALTH_STATE_FILTER)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SAFETY_CHECK_KIND_ValuesAndStrings[] ={
-{ FABRIC_SAFETY_CHECK_KIND_INVALID , "FABRIC_SAFETY_CHECK_KIND_INVALID" },
-{ FABRIC_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM , "FABRIC_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM" },
-{ FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM , "FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM" },
-{ FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT , "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT" },
-{ FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP , "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP" },
-{ FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION , "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION" },
-{ FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA , "FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA" },
-{ FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY , "FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY" },
+static const char* const FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_Strings[FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_METRICS - FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE + 1] ={
+[FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE - FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE] = "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE",
+[FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MINNODES - FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE] = "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MINNODES",
+[FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MAXNODES - FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE] = "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MAXNODES",
+[FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_METRICS - FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE] = "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_METRICS",
 };
-const char* MU_C3(MU_,FABRIC_SAFETY_CHECK_KIND,_ToString)(FABRIC_SAFETY_CHECK_KIND value)
+const char* MU_C3(MU_,FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS,_ToString)(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SAFETY_CHECK_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SAFETY_CHECK_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE;
+    if ((index < sizeof(MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Strings))/sizeof(MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Strings)[0])) && (MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_SAFETY_CHECK_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SAFETY_CHECK_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_ValuesAndStrings[] ={
-{ FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID , "FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID" },
-{ FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_CLUSTER , "FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_CLUSTER" },
+static const SF_ENUM_AND_STRING FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_METRICS , "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_METRICS" },
+{ FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE , "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE" },
+{ FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MINNODES , "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MINNODES" },
+{ FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MAXNODES , "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MAXNODES" },
 };
-const char* MU_C3(MU_,FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND,_ToString)(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND value)
+static const int32_t FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_Seeds[] ={
+2, 7, 0, 0,
+};
+int MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _FromString)(const char* enumAsString, FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPAIR_TARGET_KIND_ValuesAndStrings[] ={
-{ FABRIC_REPAIR_TARGET_KIND_INVALID , "FABRIC_REPAIR_TARGET_KIND_INVALID" },
-{ FABRIC_REPAIR_TARGET_KIND_NODE , "FABRIC_REPAIR_TARGET_KIND_NODE" },
-};
-const char* MU_C3(MU_,FABRIC_REPAIR_TARGET_KIND,_ToString)(FABRIC_REPAIR_TARGET_KIND value)
+int MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPAIR_TARGET_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_TARGET_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_REPAIR_TARGET_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPAIR_TARGET_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Seeds), sizeof(MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Seeds))/sizeof(MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_RESTART_NODE_DESCRIPTION_KIND_ValuesAndStrings[] ={
-{ FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID , "FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID" },
-{ FABRIC_RESTART_NODE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_RESTART_NODE_DESCRIPTION_KIND_USING_NODE_NAME" },
+static const char* const FABRIC_SCALING_TRIGGER_KIND_Strings[FABRIC_SCALING_TRIGGER_KIND_AVERAGE_SERVICE_LOAD - FABRIC_SCALING_TRIGGER_KIND_INVALID + 1] ={
+[FABRIC_SCALING_TRIGGER_KIND_INVALID - FABRIC_SCALING_TRIGGER_KIND_INVALID] = "FABRIC_SCALING_TRIGGER_KIND_INVALID",
+[FABRIC_SCALING_TRIGGER_KIND_AVERAGE_PARTITION_LOAD - FABRIC_SCALING_TRIGGER_KIND_INVALID] = "FABRIC_SCALING_TRIGGER_KIND_AVERAGE_PARTITION_LOAD",
+[FABRIC_SCALING_TRIGGER_KIND_AVERAGE_SERVICE_LOAD - FABRIC_SCALING_TRIGGER_KIND_INVALID] = "FABRIC_SCALING_TRIGGER_KIND_AVERAGE_SERVICE_LOAD",
 };
-const char* MU_C3(MU_,FABRIC_RESTART_NODE_DESCRIPTION_KIND,_ToString)(FABRIC_RESTART_NODE_DESCRIPTION_KIND value)
+const char* MU_C3(MU_,FABRIC_SCALING_TRIGGER_KIND,_ToString)(FABRIC_SCALING_TRIGGER_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SCALING_TRIGGER_KIND_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Strings))/sizeof(MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Strings)[0])) && (MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_RESTART_NODE_DESCRIPTION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_START_NODE_DESCRIPTION_KIND_ValuesAndStrings[] ={
-{ FABRIC_START_NODE_DESCRIPTION_KIND_INVALID , "FABRIC_START_NODE_DESCRIPTION_KIND_INVALID" },
-{ FABRIC_START_NODE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_START_NODE_DESCRIPTION_KIND_USING_NODE_NAME" },
+static const SF_ENUM_AND_STRING FABRIC_SCALING_TRIGGER_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SCALING_TRIGGER_KIND_AVERAGE_PARTITION_LOAD , "FABRIC_SCALING_TRIGGER_KIND_AVERAGE_PARTITION_LOAD" },
+{ FABRIC_SCALING_TRIGGER_KIND_AVERAGE_SERVICE_LOAD , "FABRIC_SCALING_TRIGGER_KIND_AVERAGE_SERVICE_LOAD" },
+{ FABRIC_SCALING_TRIGGER_KIND_INVALID , "FABRIC_SCALING_TRIGGER_KIND_INVALID" },
 };
-const char* MU_C3(MU_,FABRIC_START_NODE_DESCRIPTION_KIND,_ToString)(FABRIC_START_NODE_DESCRIPTION_KIND value)
+static const int32_t FABRIC_SCALING_TRIGGER_KIND_Seeds[] ={
+1, -2, 0,
+};
+int MU_C2(FABRIC_SCALING_TRIGGER_KIND, _FromString)(const char* enumAsString, FABRIC_SCALING_TRIGGER_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_START_NODE_DESCRIPTION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SCALING_TRIGGER_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Seeds), sizeof(MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SCALING_TRIGGER_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_STOP_NODE_DESCRIPTION_KIND_ValuesAndStrings[] ={
-{ FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID , "FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID" },
-{ FABRIC_STOP_NODE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_STOP_NODE_DESCRIPTION_KIND_USING_NODE_NAME" },
-};
-const char* MU_C3(MU_,FABRIC_STOP_NODE_DESCRIPTION_KIND,_ToString)(FABRIC_STOP_NODE_DESCRIPTION_KIND value)
+int MU_C2(FABRIC_SCALING_TRIGGER_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SCALING_TRIGGER_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_STOP_NODE_DESCRIPTION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SCALING_TRIGGER_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Seeds), sizeof(MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SCALING_TRIGGER_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SCALING_TRIGGER_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_ValuesAndStrings[] ={
-{ FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID , "FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID" },
-{ FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_USING_NODE_NAME" },
+static const char* const FABRIC_SCALING_MECHANISM_KIND_Strings[FABRIC_SCALING_MECHANISM_KIND_ADD_REMOVE_INCREMENTAL_NAMED_PARTITION - FABRIC_SCALING_MECHANISM_INVALID + 1] ={
+[FABRIC_SCALING_MECHANISM_INVALID - FABRIC_SCALING_MECHANISM_INVALID] = "FABRIC_SCALING_MECHANISM_INVALID",
+[FABRIC_SCALING_MECHANISM_KIND_SCALE_PARTITION_INSTANCE_COUNT - FABRIC_SCALING_MECHANISM_INVALID] = "FABRIC_SCALING_MECHANISM_KIND_SCALE_PARTITION_INSTANCE_COUNT",
+[FABRIC_SCALING_MECHANISM_KIND_ADD_REMOVE_INCREMENTAL_NAMED_PARTITION - FABRIC_SCALING_MECHANISM_INVALID] = "FABRIC_SCALING_MECHANISM_KIND_ADD_REMOVE_INCREMENTAL_NAMED_PARTITION",
 };
-const char* MU_C3(MU_,FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND,_ToString)(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND value)
+const char* MU_C3(MU_,FABRIC_SCALING_MECHANISM_KIND,_ToString)(FABRIC_SCALING_MECHANISM_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SCALING_MECHANISM_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Strings))/sizeof(MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Strings)[0])) && (MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_STATE_ValuesAndStrings[] ={
-{ FABRIC_REPAIR_TASK_STATE_INVALID , "FABRIC_REPAIR_TASK_STATE_INVALID" },
-{ FABRIC_REPAIR_TASK_STATE_CREATED , "FABRIC_REPAIR_TASK_STATE_CREATED" },
-{ FABRIC_REPAIR_TASK_STATE_CLAIMED , "FABRIC_REPAIR_TASK_STATE_CLAIMED" },
-{ FABRIC_REPAIR_TASK_STATE_PREPARING , "FABRIC_REPAIR_TASK_STATE_PREPARING" },
-{ FABRIC_REPAIR_TASK_STATE_APPROVED , "FABRIC_REPAIR_TASK_STATE_APPROVED" },
-{ FABRIC_REPAIR_TASK_STATE_EXECUTING , "FABRIC_REPAIR_TASK_STATE_EXECUTING" },
-{ FABRIC_REPAIR_TASK_STATE_RESTORING , "FABRIC_REPAIR_TASK_STATE_RESTORING" },
-{ FABRIC_REPAIR_TASK_STATE_COMPLETED , "FABRIC_REPAIR_TASK_STATE_COMPLETED" },
+static const SF_ENUM_AND_STRING FABRIC_SCALING_MECHANISM_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SCALING_MECHANISM_KIND_SCALE_PARTITION_INSTANCE_COUNT , "FABRIC_SCALING_MECHANISM_KIND_SCALE_PARTITION_INSTANCE_COUNT" },
+{ FABRIC_SCALING_MECHANISM_INVALID , "FABRIC_SCALING_MECHANISM_INVALID" },
+{ FABRIC_SCALING_MECHANISM_KIND_ADD_REMOVE_INCREMENTAL_NAMED_PARTITION , "FABRIC_SCALING_MECHANISM_KIND_ADD_REMOVE_INCREMENTAL_NAMED_PARTITION" },
 };
-const char* MU_C3(MU_,FABRIC_REPAIR_TASK_STATE,_ToString)(FABRIC_REPAIR_TASK_STATE value)
+static const int32_t FABRIC_SCALING_MECHANISM_KIND_Seeds[] ={
+0, 1, -2,
+};
+int MU_C2(FABRIC_SCALING_MECHANISM_KIND, _FromString)(const char* enumAsString, FABRIC_SCALING_MECHANISM_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPAIR_TASK_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_TASK_STATE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_REPAIR_TASK_STATE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPAIR_TASK_STATE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SCALING_MECHANISM_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Seeds), sizeof(MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SCALING_MECHANISM_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_ValuesAndStrings[] ={
-{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED" },
-{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_IN_PROGRESS , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_IN_PROGRESS" },
-{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SUCCEEDED , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SUCCEEDED" },
-{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SKIPPED , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SKIPPED" },
-{ FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_TIMEDOUT , "FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_TIMEDOUT" },
-};
-const char* MU_C3(MU_,FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE,_ToString)(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE value)
+int MU_C2(FABRIC_SCALING_MECHANISM_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SCALING_MECHANISM_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SCALING_MECHANISM_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Seeds), sizeof(MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Seeds))/sizeof(MU_C2(FABRIC_SCALING_MECHANISM_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SCALING_MECHANISM_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS_ValuesAndStrings[] ={
-{ FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE , "FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE" },
-{ FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_PREPARING_HEALTH_CHECK , "FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_PREPARING_HEALTH_CHECK" },
-{ FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_RESTORING_HEALTH_CHECK , "FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_RESTORING_HEALTH_CHECK" },
+static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_STATE_FILTER_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_TEST_COMMAND_STATE_FILTER_DEFAULT , "FABRIC_TEST_COMMAND_STATE_FILTER_DEFAULT" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_RUNNING , "FABRIC_TEST_COMMAND_STATE_FILTER_RUNNING" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_ROLLING_BACK , "FABRIC_TEST_COMMAND_STATE_FILTER_ROLLING_BACK" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_COMPLETED_SUCCESSFULLY , "FABRIC_TEST_COMMAND_STATE_FILTER_COMPLETED_SUCCESSFULLY" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_FAILED , "FABRIC_TEST_COMMAND_STATE_FILTER_FAILED" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_CANCELLED , "FABRIC_TEST_COMMAND_STATE_FILTER_CANCELLED" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_FORCE_CANCELLED , "FABRIC_TEST_COMMAND_STATE_FILTER_FORCE_CANCELLED" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_ALL , "FABRIC_TEST_COMMAND_STATE_FILTER_ALL" },
 };
-const char* MU_C3(MU_,FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS,_ToString)(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS value)
+const char* MU_C3(MU_,FABRIC_TEST_COMMAND_STATE_FILTER,_ToString)(FABRIC_TEST_COMMAND_STATE_FILTER value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _ValuesAndStrings)[0]);i++)
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _ValuesAndStrings)[0]);
+    while(low < high)
     {
-        if(MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _ValuesAndStrings)[i].value == (int)value)
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _ValuesAndStrings)[middle].value < (int)value)
         {
-            return MU_C2(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS, _ValuesAndStrings)[i].valueAsString;
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _ValuesAndStrings)[middle].valueAsString;
         }
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPAIR_IMPACT_KIND_ValuesAndStrings[] ={
-{ FABRIC_REPAIR_IMPACT_KIND_INVALID , "FABRIC_REPAIR_IMPACT_KIND_INVALID" },
-{ FABRIC_REPAIR_IMPACT_KIND_NODE , "FABRIC_REPAIR_IMPACT_KIND_NODE" },
+static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_STATE_FILTER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_TEST_COMMAND_STATE_FILTER_CANCELLED , "FABRIC_TEST_COMMAND_STATE_FILTER_CANCELLED" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_DEFAULT , "FABRIC_TEST_COMMAND_STATE_FILTER_DEFAULT" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_FAILED , "FABRIC_TEST_COMMAND_STATE_FILTER_FAILED" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_ROLLING_BACK , "FABRIC_TEST_COMMAND_STATE_FILTER_ROLLING_BACK" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_FORCE_CANCELLED , "FABRIC_TEST_COMMAND_STATE_FILTER_FORCE_CANCELLED" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_COMPLETED_SUCCESSFULLY , "FABRIC_TEST_COMMAND_STATE_FILTER_COMPLETED_SUCCESSFULLY" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_RUNNING , "FABRIC_TEST_COMMAND_STATE_FILTER_RUNNING" },
+{ FABRIC_TEST_COMMAND_STATE_FILTER_ALL , "FABRIC_TEST_COMMAND_STATE_FILTER_ALL" },
 };
-const char* MU_C3(MU_,FABRIC_REPAIR_IMPACT_KIND,_ToString)(FABRIC_REPAIR_IMPACT_KIND value)
+static const int32_t FABRIC_TEST_COMMAND_STATE_FILTER_Seeds[] ={
+0, 0, 1, 1, -1, 0, 3, -6,
+};
+int MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _FromString)(const char* enumAsString, FABRIC_TEST_COMMAND_STATE_FILTER* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPAIR_IMPACT_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_IMPACT_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_REPAIR_IMPACT_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPAIR_IMPACT_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _Seeds), sizeof(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TEST_COMMAND_STATE_FILTER)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPAIR_NODE_IMPACT_LEVEL_ValuesAndStrings[] ={
-{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID" },
-{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_NONE , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_NONE" },
-{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_RESTART , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_RESTART" },
-{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_DATA , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_DATA" },
-{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_NODE , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_NODE" },
-{ FABRIC_REPAIR_NODE_IMPACT_LEVEL_PAUSE , "FABRIC_REPAIR_NODE_IMPACT_LEVEL_PAUSE" },
-};
-const char* MU_C3(MU_,FABRIC_REPAIR_NODE_IMPACT_LEVEL,_ToString)(FABRIC_REPAIR_NODE_IMPACT_LEVEL value)
+int MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TEST_COMMAND_STATE_FILTER* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_REPAIR_NODE_IMPACT_LEVEL, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _Seeds), sizeof(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TEST_COMMAND_STATE_FILTER)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_REPAIR_TASK_RESULT_ValuesAndStrings[] ={
-{ FABRIC_REPAIR_TASK_RESULT_INVALID , "FABRIC_REPAIR_TASK_RESULT_INVALID" },
-{ FABRIC_REPAIR_TASK_RESULT_SUCCEEDED , "FABRIC_REPAIR_TASK_RESULT_SUCCEEDED" },
-{ FABRIC_REPAIR_TASK_RESULT_CANCELLED , "FABRIC_REPAIR_TASK_RESULT_CANCELLED" },
-{ FABRIC_REPAIR_TASK_RESULT_INTERRUPTED , "FABRIC_REPAIR_TASK_RESULT_INTERRUPTED" },
-{ FABRIC_REPAIR_TASK_RESULT_FAILED , "FABRIC_REPAIR_TASK_RESULT_FAILED" },
-{ FABRIC_REPAIR_TASK_RESULT_PENDING , "FABRIC_REPAIR_TASK_RESULT_PENDING" },
+static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_TYPE_FILTER_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_DEFAULT , "FABRIC_TEST_COMMAND_TYPE_FILTER_DEFAULT" },
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_DATA_LOSS , "FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_DATA_LOSS" },
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_QUORUM_LOSS , "FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_QUORUM_LOSS" },
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_RESTART , "FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_RESTART" },
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_ALL , "FABRIC_TEST_COMMAND_TYPE_FILTER_ALL" },
 };
-const char* MU_C3(MU_,FABRIC_REPAIR_TASK_RESULT,_ToString)(FABRIC_REPAIR_TASK_RESULT value)
+const char* MU_C3(MU_,FABRIC_TEST_COMMAND_TYPE_FILTER,_ToString)(FABRIC_TEST_COMMAND_TYPE_FILTER value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_REPAIR_TASK_RESULT, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_REPAIR_TASK_RESULT, _ValuesAndStrings)[0]);i++)
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _ValuesAndStrings)[0]);
+    while(low < high)
     {
-        if(MU_C2(FABRIC_REPAIR_TASK_RESULT, _ValuesAndStrings)[i].value == (int)value)
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _ValuesAndStrings)[middle].value > (int)value)
+        {
+            high = middle;
+        }
+        else
         {
-            return MU_C2(FABRIC_REPAIR_TASK_RESULT, _ValuesAndStrings)[i].valueAsString;
+            return MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _ValuesAndStrings)[middle].valueAsString;
         }
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_NODE_DEACTIVATION_STATUS_ValuesAndStrings[] ={
-{ FABRIC_NODE_DEACTIVATION_STATUS_NONE , "FABRIC_NODE_DEACTIVATION_STATUS_NONE" },
-{ FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_IN_PROGRESS , "FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_IN_PROGRESS" },
-{ FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_COMPLETE , "FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_COMPLETE" },
-{ FABRIC_NODE_DEACTIVATION_STATUS_COMPLETED , "FABRIC_NODE_DEACTIVATION_STATUS_COMPLETED" },
+static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_TYPE_FILTER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_DATA_LOSS , "FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_DATA_LOSS" },
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_DEFAULT , "FABRIC_TEST_COMMAND_TYPE_FILTER_DEFAULT" },
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_QUORUM_LOSS , "FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_QUORUM_LOSS" },
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_ALL , "FABRIC_TEST_COMMAND_TYPE_FILTER_ALL" },
+{ FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_RESTART , "FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_RESTART" },
 };
-const char* MU_C3(MU_,FABRIC_NODE_DEACTIVATION_STATUS,_ToString)(FABRIC_NODE_DEACTIVATION_STATUS value)
+static const int32_t FABRIC_TEST_COMMAND_TYPE_FILTER_Seeds[] ={
+2, -4, 0, 0, 1,
+};
+int MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _FromString)(const char* enumAsString, FABRIC_TEST_COMMAND_TYPE_FILTER* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _Seeds), sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TEST_COMMAND_TYPE_FILTER)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TEST_COMMAND_TYPE_FILTER* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_NODE_DEACTIVATION_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _Seeds), sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TEST_COMMAND_TYPE_FILTER)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_NODE_DEACTIVATION_TASK_TYPE_ValuesAndStrings[] ={
-{ FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID , "FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID" },
-{ FABRIC_NODE_DEACTIVATION_TASK_TYPE_INFRASTRUCTURE , "FABRIC_NODE_DEACTIVATION_TASK_TYPE_INFRASTRUCTURE" },
-{ FABRIC_NODE_DEACTIVATION_TASK_TYPE_REPAIR , "FABRIC_NODE_DEACTIVATION_TASK_TYPE_REPAIR" },
-{ FABRIC_NODE_DEACTIVATION_TASK_TYPE_CLIENT , "FABRIC_NODE_DEACTIVATION_TASK_TYPE_CLIENT" },
+static const char* const FABRIC_TEST_COMMAND_TYPE_Strings[FABRIC_TEST_COMMAND_TYPE_START_NODE_TRANSITION - FABRIC_TEST_COMMAND_TYPE_DEFAULT + 1] ={
+[FABRIC_TEST_COMMAND_TYPE_DEFAULT - FABRIC_TEST_COMMAND_TYPE_DEFAULT] = "FABRIC_TEST_COMMAND_TYPE_DEFAULT",
+[FABRIC_TEST_COMMAND_TYPE_INVOKE_DATA_LOSS - FABRIC_TEST_COMMAND_TYPE_DEFAULT] = "FABRIC_TEST_COMMAND_TYPE_INVOKE_DATA_LOSS",
+[FABRIC_TEST_COMMAND_TYPE_INVOKE_QUORUM_LOSS - FABRIC_TEST_COMMAND_TYPE_DEFAULT] = "FABRIC_TEST_COMMAND_TYPE_INVOKE_QUORUM_LOSS",
+[FABRIC_TEST_COMMAND_TYPE_INVOKE_RESTART_PARTITION - FABRIC_TEST_COMMAND_TYPE_DEFAULT] = "FABRIC_TEST_COMMAND_TYPE_INVOKE_RESTART_PARTITION",
+[FABRIC_TEST_COMMAND_TYPE_START_NODE_TRANSITION - FABRIC_TEST_COMMAND_TYPE_DEFAULT] = "FABRIC_TEST_COMMAND_TYPE_START_NODE_TRANSITION",
 };
-const char* MU_C3(MU_,FABRIC_NODE_DEACTIVATION_TASK_TYPE,_ToString)(FABRIC_NODE_DEACTIVATION_TASK_TYPE value)
+const char* MU_C3(MU_,FABRIC_TEST_COMMAND_TYPE,_ToString)(FABRIC_TEST_COMMAND_TYPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_TEST_COMMAND_TYPE_DEFAULT;
+    if ((index < sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE, _Strings))/sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE, _Strings)[0])) && (MU_C2(FABRIC_TEST_COMMAND_TYPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_NODE_DEACTIVATION_TASK_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_TEST_COMMAND_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_PARTITION_SELECTOR_TYPE_ValuesAndStrings[] ={
-{ FABRIC_PARTITION_SELECTOR_TYPE_NONE , "FABRIC_PARTITION_SELECTOR_TYPE_NONE" },
-{ FABRIC_PARTITION_SELECTOR_TYPE_SINGLETON , "FABRIC_PARTITION_SELECTOR_TYPE_SINGLETON" },
-{ FABRIC_PARTITION_SELECTOR_TYPE_NAMED , "FABRIC_PARTITION_SELECTOR_TYPE_NAMED" },
-{ FABRIC_PARTITION_SELECTOR_TYPE_UNIFORM_INT64 , "FABRIC_PARTITION_SELECTOR_TYPE_UNIFORM_INT64" },
-{ FABRIC_PARTITION_SELECTOR_TYPE_PARTITION_ID , "FABRIC_PARTITION_SELECTOR_TYPE_PARTITION_ID" },
-{ FABRIC_PARTITION_SELECTOR_TYPE_RANDOM , "FABRIC_PARTITION_SELECTOR_TYPE_RANDOM" },
+static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_TEST_COMMAND_TYPE_INVOKE_RESTART_PARTITION , "FABRIC_TEST_COMMAND_TYPE_INVOKE_RESTART_PARTITION" },
+{ FABRIC_TEST_COMMAND_TYPE_START_NODE_TRANSITION , "FABRIC_TEST_COMMAND_TYPE_START_NODE_TRANSITION" },
+{ FABRIC_TEST_COMMAND_TYPE_INVOKE_DATA_LOSS , "FABRIC_TEST_COMMAND_TYPE_INVOKE_DATA_LOSS" },
+{ FABRIC_TEST_COMMAND_TYPE_DEFAULT , "FABRIC_TEST_COMMAND_TYPE_DEFAULT" },
+{ FABRIC_TEST_COMMAND_TYPE_INVOKE_QUORUM_LOSS , "FABRIC_TEST_COMMAND_TYPE_INVOKE_QUORUM_LOSS" },
 };
-const char* MU_C3(MU_,FABRIC_PARTITION_SELECTOR_TYPE,_ToString)(FABRIC_PARTITION_SELECTOR_TYPE value)
+static const int32_t FABRIC_TEST_COMMAND_TYPE_Seeds[] ={
+1, -2, 0, 11, 0,
+};
+int MU_C2(FABRIC_TEST_COMMAND_TYPE, _FromString)(const char* enumAsString, FABRIC_TEST_COMMAND_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_PARTITION_SELECTOR_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TEST_COMMAND_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TEST_COMMAND_TYPE, _Seeds), sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TEST_COMMAND_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_DATA_LOSS_MODE_ValuesAndStrings[] ={
-{ FABRIC_DATA_LOSS_MODE_INVALID , "FABRIC_DATA_LOSS_MODE_INVALID" },
-{ FABRIC_DATA_LOSS_MODE_PARTIAL , "FABRIC_DATA_LOSS_MODE_PARTIAL" },
-{ FABRIC_DATA_LOSS_MODE_FULL , "FABRIC_DATA_LOSS_MODE_FULL" },
-};
-const char* MU_C3(MU_,FABRIC_DATA_LOSS_MODE,_ToString)(FABRIC_DATA_LOSS_MODE value)
+int MU_C2(FABRIC_TEST_COMMAND_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_TEST_COMMAND_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_DATA_LOSS_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_DATA_LOSS_MODE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_DATA_LOSS_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_DATA_LOSS_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_TEST_COMMAND_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_TEST_COMMAND_TYPE, _Seeds), sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_TEST_COMMAND_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_PROGRESS_STATE_ValuesAndStrings[] ={
-{ FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID , "FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID" },
-{ FABRIC_TEST_COMMAND_PROGRESS_STATE_RUNNING , "FABRIC_TEST_COMMAND_PROGRESS_STATE_RUNNING" },
-{ FABRIC_TEST_COMMAND_PROGRESS_STATE_ROLLING_BACK , "FABRIC_TEST_COMMAND_PROGRESS_STATE_ROLLING_BACK" },
-{ FABRIC_TEST_COMMAND_PROGRESS_STATE_COMPLETED , "FABRIC_TEST_COMMAND_PROGRESS_STATE_COMPLETED" },
-{ FABRIC_TEST_COMMAND_PROGRESS_STATE_FAULTED , "FABRIC_TEST_COMMAND_PROGRESS_STATE_FAULTED" },
-{ FABRIC_TEST_COMMAND_PROGRESS_STATE_CANCELLED , "FABRIC_TEST_COMMAND_PROGRESS_STATE_CANCELLED" },
-{ FABRIC_TEST_COMMAND_PROGRESS_STATE_FORCE_CANCELLED , "FABRIC_TEST_COMMAND_PROGRESS_STATE_FORCE_CANCELLED" },
+static const char* const FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_Strings[FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_RESTORE_SOURCE_BACKUP - FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE + 1] ={
+[FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE - FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_MIGRATION - FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_MIGRATION",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_SWAP - FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_SWAP",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_CLEANUP - FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_CLEANUP",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_SOURCE_DATABASE_CLEANUP - FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_SOURCE_DATABASE_CLEANUP",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_ACTIVE - FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_ACTIVE",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_RESTORE_SOURCE_BACKUP - FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_RESTORE_SOURCE_BACKUP",
 };
-const char* MU_C3(MU_,FABRIC_TEST_COMMAND_PROGRESS_STATE,_ToString)(FABRIC_TEST_COMMAND_PROGRESS_STATE value)
+const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE,_ToString)(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE;
+    if ((index < sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Strings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Strings)[0])) && (MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_TEST_COMMAND_PROGRESS_STATE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_QUORUM_LOSS_MODE_ValuesAndStrings[] ={
-{ FABRIC_QUORUM_LOSS_MODE_INVALID , "FABRIC_QUORUM_LOSS_MODE_INVALID" },
-{ FABRIC_QUORUM_LOSS_MODE_QUORUM_REPLICAS , "FABRIC_QUORUM_LOSS_MODE_QUORUM_REPLICAS" },
-{ FABRIC_QUORUM_LOSS_MODE_ALL_REPLICAS , "FABRIC_QUORUM_LOSS_MODE_ALL_REPLICAS" },
+static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_RESTORE_SOURCE_BACKUP , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_RESTORE_SOURCE_BACKUP" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_SOURCE_DATABASE_CLEANUP , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_SOURCE_DATABASE_CLEANUP" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_ACTIVE , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_ACTIVE" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_CLEANUP , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_CLEANUP" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_SWAP , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_SWAP" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_MIGRATION , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_MIGRATION" },
 };
-const char* MU_C3(MU_,FABRIC_QUORUM_LOSS_MODE,_ToString)(FABRIC_QUORUM_LOSS_MODE value)
+static const int32_t FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_Seeds[] ={
+2, -1, 0, 0, 1, 5, 0,
+};
+int MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_QUORUM_LOSS_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_QUORUM_LOSS_MODE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_QUORUM_LOSS_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_QUORUM_LOSS_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_RESTART_PARTITION_MODE_ValuesAndStrings[] ={
-{ FABRIC_RESTART_PARTITION_MODE_INVALID , "FABRIC_RESTART_PARTITION_MODE_INVALID" },
-{ FABRIC_RESTART_PARTITION_MODE_ALL_REPLICAS_OR_INSTANCES , "FABRIC_RESTART_PARTITION_MODE_ALL_REPLICAS_OR_INSTANCES" },
-{ FABRIC_RESTART_PARTITION_MODE_ONLY_ACTIVE_SECONDARIES , "FABRIC_RESTART_PARTITION_MODE_ONLY_ACTIVE_SECONDARIES" },
-};
-const char* MU_C3(MU_,FABRIC_RESTART_PARTITION_MODE,_ToString)(FABRIC_RESTART_PARTITION_MODE value)
+int MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_RESTART_PARTITION_MODE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_RESTART_PARTITION_MODE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_RESTART_PARTITION_MODE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_RESTART_PARTITION_MODE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_ValuesAndStrings[] ={
-{ FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID , "FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID" },
-{ FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_NODE_NAME" },
-{ FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR , "FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR" },
+static const char* const FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_Strings[FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_FAILED - FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE + 1] ={
+[FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE - FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_PROCESSING - FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_PROCESSING",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_COMPLETED - FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_COMPLETED",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_CANCELED - FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_CANCELED",
+[FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_FAILED - FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE] = "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_FAILED",
 };
-const char* MU_C3(MU_,FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND,_ToString)(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND value)
+const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_MIGRATION_STATE,_ToString)(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE;
+    if ((index < sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Strings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Strings)[0])) && (MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_ValuesAndStrings[] ={
-{ FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID , "FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID" },
-{ FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_NODE_NAME" },
-{ FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR , "FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR" },
+static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_FAILED , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_FAILED" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_PROCESSING , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_PROCESSING" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_COMPLETED , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_COMPLETED" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_CANCELED , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_CANCELED" },
+{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE" },
 };
-const char* MU_C3(MU_,FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND,_ToString)(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND value)
+static const int32_t FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_Seeds[] ={
+-2, 0, -3, -5, 1,
+};
+int MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_MIGRATION_STATE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_MIGRATION_STATE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_ValuesAndStrings[] ={
-{ FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID , "FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID" },
-{ FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_NODE_NAME" },
-{ FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_REPLICA_SELECTOR , "FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_REPLICA_SELECTOR" },
-};
-const char* MU_C3(MU_,FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND,_ToString)(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND value)
+int MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_MIGRATION_STATE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_MIGRATION_STATE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_ValuesAndStrings[] ={
-{ FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID , "FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID" },
-{ FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_NODE_NAME , "FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_NODE_NAME" },
-{ FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR , "FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR" },
+static const char* const FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_Strings[FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_TSTORE - FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN + 1] ={
+[FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN - FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN] = "FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN",
+[FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_ESE - FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN] = "FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_ESE",
+[FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_TSTORE - FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN] = "FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_TSTORE",
 };
-const char* MU_C3(MU_,FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND,_ToString)(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND value)
+const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_PROVIDER_KIND,_ToString)(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN;
+    if ((index < sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Strings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Strings)[0])) && (MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_NODE_TRANSITION_TYPE_ValuesAndStrings[] ={
-{ FABRIC_NODE_TRANSITION_TYPE_INVALID , "FABRIC_NODE_TRANSITION_TYPE_INVALID" },
-{ FABRIC_NODE_TRANSITION_TYPE_START , "FABRIC_NODE_TRANSITION_TYPE_START" },
-{ FABRIC_NODE_TRANSITION_TYPE_STOP , "FABRIC_NODE_TRANSITION_TYPE_STOP" },
+static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_ESE , "FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_ESE" },
+{ FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_TSTORE , "FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_TSTORE" },
+{ FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN , "FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN" },
 };
-const char* MU_C3(MU_,FABRIC_NODE_TRANSITION_TYPE,_ToString)(FABRIC_NODE_TRANSITION_TYPE value)
+static const int32_t FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_Seeds[] ={
+1, 0, -1,
+};
+int MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _FromString)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_PROVIDER_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_NODE_TRANSITION_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_NODE_TRANSITION_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_NODE_TRANSITION_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_NODE_TRANSITION_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_PROVIDER_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_RECONFIGURATION_PHASE_ValuesAndStrings[] ={
-{ FABRIC_RECONFIGURATION_PHASE_INVALID , "FABRIC_RECONFIGURATION_PHASE_INVALID" },
-{ FABRIC_RECONFIGURATION_PHASE_NONE , "FABRIC_RECONFIGURATION_PHASE_NONE" },
-{ FABRIC_RECONFIGURATION_PHASE_ZERO , "FABRIC_RECONFIGURATION_PHASE_ZERO" },
-{ FABRIC_RECONFIGURATION_PHASE_ONE , "FABRIC_RECONFIGURATION_PHASE_ONE" },
-{ FABRIC_RECONFIGURATION_PHASE_TWO , "FABRIC_RECONFIGURATION_PHASE_TWO" },
-{ FABRIC_RECONFIGURATION_PHASE_THREE , "FABRIC_RECONFIGURATION_PHASE_THREE" },
-{ FABRIC_RECONFIGURATION_PHASE_FOUR , "FABRIC_RECONFIGURATION_PHASE_FOUR" },
-{ FABRIC_RECONFIGURATION_ABORT_PHASE_ZERO , "FABRIC_RECONFIGURATION_ABORT_PHASE_ZERO" },
-};
-const char* MU_C3(MU_,FABRIC_RECONFIGURATION_PHASE,_ToString)(FABRIC_RECONFIGURATION_PHASE value)
+int MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_KEY_VALUE_STORE_PROVIDER_KIND* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_RECONFIGURATION_PHASE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_RECONFIGURATION_PHASE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_RECONFIGURATION_PHASE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_RECONFIGURATION_PHASE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Seeds), sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Seeds))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_KEY_VALUE_STORE_PROVIDER_KIND)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_RECONFIGURATION_TYPE_ValuesAndStrings[] ={
-{ FABRIC_RECONFIGURATION_TYPE_INVALID , "FABRIC_RECONFIGURATION_TYPE_INVALID" },
-{ FABRIC_RECONFIGURATION_TYPE_SWAPPRIMARY , "FABRIC_RECONFIGURATION_TYPE_SWAPPRIMARY" },
-{ FABRIC_RECONFIGURATION_TYPE_FAILOVER , "FABRIC_RECONFIGURATION_TYPE_FAILOVER" },
-{ FABRIC_RECONFIGURATION_TYPE_OTHER , "FABRIC_RECONFIGURATION_TYPE_OTHER" },
-{ FABRIC_RECONFIGURATION_TYPE_NONE , "FABRIC_RECONFIGURATION_TYPE_NONE" },
+static const char* const FABRIC_NETWORK_TYPE_Strings[FABRIC_NETWORK_TYPE_FEDERATED - FABRIC_NETWORK_TYPE_INVALID + 1] ={
+[FABRIC_NETWORK_TYPE_INVALID - FABRIC_NETWORK_TYPE_INVALID] = "FABRIC_NETWORK_TYPE_INVALID",
+[FABRIC_NETWORK_TYPE_LOCAL - FABRIC_NETWORK_TYPE_INVALID] = "FABRIC_NETWORK_TYPE_LOCAL",
+[FABRIC_NETWORK_TYPE_FEDERATED - FABRIC_NETWORK_TYPE_INVALID] = "FABRIC_NETWORK_TYPE_FEDERATED",
 };
-const char* MU_C3(MU_,FABRIC_RECONFIGURATION_TYPE,_ToString)(FABRIC_RECONFIGURATION_TYPE value)
+const char* MU_C3(MU_,FABRIC_NETWORK_TYPE,_ToString)(FABRIC_NETWORK_TYPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_RECONFIGURATION_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_RECONFIGURATION_TYPE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_NETWORK_TYPE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_NETWORK_TYPE, _Strings))/sizeof(MU_C2(FABRIC_NETWORK_TYPE, _Strings)[0])) && (MU_C2(FABRIC_NETWORK_TYPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_RECONFIGURATION_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_RECONFIGURATION_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_NETWORK_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_CHAOS_STATUS_ValuesAndStrings[] ={
-{ FABRIC_CHAOS_STATUS_INVALID , "FABRIC_CHAOS_STATUS_INVALID" },
-{ FABRIC_CHAOS_STATUS_RUNNING , "FABRIC_CHAOS_STATUS_RUNNING" },
-{ FABRIC_CHAOS_STATUS_STOPPED , "FABRIC_CHAOS_STATUS_STOPPED" },
+static const SF_ENUM_AND_STRING FABRIC_NETWORK_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_NETWORK_TYPE_LOCAL , "FABRIC_NETWORK_TYPE_LOCAL" },
+{ FABRIC_NETWORK_TYPE_INVALID , "FABRIC_NETWORK_TYPE_INVALID" },
+{ FABRIC_NETWORK_TYPE_FEDERATED , "FABRIC_NETWORK_TYPE_FEDERATED" },
 };
-const char* MU_C3(MU_,FABRIC_CHAOS_STATUS,_ToString)(FABRIC_CHAOS_STATUS value)
+static const int32_t FABRIC_NETWORK_TYPE_Seeds[] ={
+0, 1, -1,
+};
+int MU_C2(FABRIC_NETWORK_TYPE, _FromString)(const char* enumAsString, FABRIC_NETWORK_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_CHAOS_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_CHAOS_STATUS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_CHAOS_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_CHAOS_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NETWORK_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NETWORK_TYPE, _Seeds), sizeof(MU_C2(FABRIC_NETWORK_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_NETWORK_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NETWORK_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_CHAOS_SCHEDULE_STATUS_ValuesAndStrings[] ={
-{ FABRIC_CHAOS_SCHEDULE_STATUS_INVALID , "FABRIC_CHAOS_SCHEDULE_STATUS_INVALID" },
-{ FABRIC_CHAOS_SCHEDULE_STATUS_ACTIVE , "FABRIC_CHAOS_SCHEDULE_STATUS_ACTIVE" },
-{ FABRIC_CHAOS_SCHEDULE_STATUS_EXPIRED , "FABRIC_CHAOS_SCHEDULE_STATUS_EXPIRED" },
-{ FABRIC_CHAOS_SCHEDULE_STATUS_PENDING , "FABRIC_CHAOS_SCHEDULE_STATUS_PENDING" },
-{ FABRIC_CHAOS_SCHEDULE_STATUS_STOPPED , "FABRIC_CHAOS_SCHEDULE_STATUS_STOPPED" },
-};
-const char* MU_C3(MU_,FABRIC_CHAOS_SCHEDULE_STATUS,_ToString)(FABRIC_CHAOS_SCHEDULE_STATUS value)
+int MU_C2(FABRIC_NETWORK_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NETWORK_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_CHAOS_SCHEDULE_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NETWORK_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NETWORK_TYPE, _Seeds), sizeof(MU_C2(FABRIC_NETWORK_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_NETWORK_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NETWORK_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_CHAOS_EVENT_KIND_ValuesAndStrings[] ={
-{ FABRIC_CHAOS_EVENT_KIND_INVALID , "FABRIC_CHAOS_EVENT_KIND_INVALID" },
-{ FABRIC_CHAOS_EVENT_KIND_STARTED , "FABRIC_CHAOS_EVENT_KIND_STARTED" },
-{ FABRIC_CHAOS_EVENT_KIND_EXECUTING_FAULTS , "FABRIC_CHAOS_EVENT_KIND_EXECUTING_FAULTS" },
-{ FABRIC_CHAOS_EVENT_KIND_WAITING , "FABRIC_CHAOS_EVENT_KIND_WAITING" },
-{ FABRIC_CHAOS_EVENT_KIND_VALIDATION_FAILED , "FABRIC_CHAOS_EVENT_KIND_VALIDATION_FAILED" },
-{ FABRIC_CHAOS_EVENT_KIND_TEST_ERROR , "FABRIC_CHAOS_EVENT_KIND_TEST_ERROR" },
-{ FABRIC_CHAOS_EVENT_KIND_STOPPED , "FABRIC_CHAOS_EVENT_KIND_STOPPED" },
+static const char* const FABRIC_NETWORK_STATUS_Strings[FABRIC_NETWORK_STATUS_FAILED - FABRIC_NETWORK_STATUS_INVALID + 1] ={
+[FABRIC_NETWORK_STATUS_INVALID - FABRIC_NETWORK_STATUS_INVALID] = "FABRIC_NETWORK_STATUS_INVALID",
+[FABRIC_NETWORK_STATUS_READY - FABRIC_NETWORK_STATUS_INVALID] = "FABRIC_NETWORK_STATUS_READY",
+[FABRIC_NETWORK_STATUS_CREATING - FABRIC_NETWORK_STATUS_INVALID] = "FABRIC_NETWORK_STATUS_CREATING",
+[FABRIC_NETWORK_STATUS_DELETING - FABRIC_NETWORK_STATUS_INVALID] = "FABRIC_NETWORK_STATUS_DELETING",
+[FABRIC_NETWORK_STATUS_UPDATING - FABRIC_NETWORK_STATUS_INVALID] = "FABRIC_NETWORK_STATUS_UPDATING",
+[FABRIC_NETWORK_STATUS_FAILED - FABRIC_NETWORK_STATUS_INVALID] = "FABRIC_NETWORK_STATUS_FAILED",
 };
-const char* MU_C3(MU_,FABRIC_CHAOS_EVENT_KIND,_ToString)(FABRIC_CHAOS_EVENT_KIND value)
+const char* MU_C3(MU_,FABRIC_NETWORK_STATUS,_ToString)(FABRIC_NETWORK_STATUS value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_CHAOS_EVENT_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_CHAOS_EVENT_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_NETWORK_STATUS_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_NETWORK_STATUS, _Strings))/sizeof(MU_C2(FABRIC_NETWORK_STATUS, _Strings)[0])) && (MU_C2(FABRIC_NETWORK_STATUS, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_CHAOS_EVENT_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_CHAOS_EVENT_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_NETWORK_STATUS, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_PROVISION_APPLICATION_TYPE_KIND_ValuesAndStrings[] ={
-{ FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID , "FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID" },
-{ FABRIC_PROVISION_APPLICATION_TYPE_KIND_IMAGE_STORE_PATH , "FABRIC_PROVISION_APPLICATION_TYPE_KIND_IMAGE_STORE_PATH" },
-{ FABRIC_PROVISION_APPLICATION_TYPE_KIND_EXTERNAL_STORE , "FABRIC_PROVISION_APPLICATION_TYPE_KIND_EXTERNAL_STORE" },
+static const SF_ENUM_AND_STRING FABRIC_NETWORK_STATUS_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_NETWORK_STATUS_FAILED , "FABRIC_NETWORK_STATUS_FAILED" },
+{ FABRIC_NETWORK_STATUS_INVALID , "FABRIC_NETWORK_STATUS_INVALID" },
+{ FABRIC_NETWORK_STATUS_READY , "FABRIC_NETWORK_STATUS_READY" },
+{ FABRIC_NETWORK_STATUS_DELETING , "FABRIC_NETWORK_STATUS_DELETING" },
+{ FABRIC_NETWORK_STATUS_UPDATING , "FABRIC_NETWORK_STATUS_UPDATING" },
+{ FABRIC_NETWORK_STATUS_CREATING , "FABRIC_NETWORK_STATUS_CREATING" },
 };
-const char* MU_C3(MU_,FABRIC_PROVISION_APPLICATION_TYPE_KIND,_ToString)(FABRIC_PROVISION_APPLICATION_TYPE_KIND value)
+static const int32_t FABRIC_NETWORK_STATUS_Seeds[] ={
+0, -2, -5, -6, 0, 3,
+};
+int MU_C2(FABRIC_NETWORK_STATUS, _FromString)(const char* enumAsString, FABRIC_NETWORK_STATUS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_PROVISION_APPLICATION_TYPE_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NETWORK_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NETWORK_STATUS, _Seeds), sizeof(MU_C2(FABRIC_NETWORK_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_NETWORK_STATUS, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NETWORK_STATUS)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID , "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID" },
-{ FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_DEFAULT , "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_DEFAULT" },
-{ FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_AUTOMATIC , "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_AUTOMATIC" },
-{ FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_MANUAL , "FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_MANUAL" },
-};
-const char* MU_C3(MU_,FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY,_ToString)(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY value)
+int MU_C2(FABRIC_NETWORK_STATUS, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NETWORK_STATUS* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NETWORK_STATUS, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NETWORK_STATUS, _Seeds), sizeof(MU_C2(FABRIC_NETWORK_STATUS, _Seeds))/sizeof(MU_C2(FABRIC_NETWORK_STATUS, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NETWORK_STATUS)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_DIAGNOSTICS_SINKS_KIND_ValuesAndStrings[] ={
-{ FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID , "FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID" },
-{ FABRIC_DIAGNOSTICS_SINKS_KIND_AZUREINTERNAL , "FABRIC_DIAGNOSTICS_SINKS_KIND_AZUREINTERNAL" },
+static const SF_ENUM_AND_STRING FABRIC_NETWORK_STATUS_FILTER_ValuesAndStrings[] ={ /*sorted by value*/
+{ FABRIC_NETWORK_STATUS_FILTER_DEFAULT , "FABRIC_NETWORK_STATUS_FILTER_DEFAULT" },
+{ FABRIC_NETWORK_STATUS_FILTER_READY , "FABRIC_NETWORK_STATUS_FILTER_READY" },
+{ FABRIC_NETWORK_STATUS_FILTER_CREATING , "FABRIC_NETWORK_STATUS_FILTER_CREATING" },
+{ FABRIC_NETWORK_STATUS_FILTER_DELETING , "FABRIC_NETWORK_STATUS_FILTER_DELETING" },
+{ FABRIC_NETWORK_STATUS_FILTER_UPDATING , "FABRIC_NETWORK_STATUS_FILTER_UPDATING" },
+{ FABRIC_NETWORK_STATUS_FILTER_FAILED , "FABRIC_NETWORK_STATUS_FILTER_FAILED" },
+{ FABRIC_NETWORK_STATUS_FILTER_ALL , "FABRIC_NETWORK_STATUS_FILTER_ALL" },
 };
-const char* MU_C3(MU_,FABRIC_DIAGNOSTICS_SINKS_KIND,_ToString)(FABRIC_DIAGNOSTICS_SINKS_KIND value)
+const char* MU_C3(MU_,FABRIC_NETWORK_STATUS_FILTER,_ToString)(FABRIC_NETWORK_STATUS_FILTER value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _ValuesAndStrings)[0]);i++)
+    size_t low = 0;
+    size_t high = sizeof(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _ValuesAndStrings)[0]);
+    while(low < high)
     {
-        if(MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _ValuesAndStrings)[i].value == (int)value)
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _ValuesAndStrings)[middle].value < (int)value)
+        {
+            low = middle + 1;
+        }
+        else if(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _ValuesAndStrings)[middle].value > (int)value)
         {
-            return MU_C2(FABRIC_DIAGNOSTICS_SINKS_KIND, _ValuesAndStrings)[i].valueAsString;
+            high = middle;
+        }
+        else
+        {
+            return MU_C2(FABRIC_NETWORK_STATUS_FILTER, _ValuesAndStrings)[middle].valueAsString;
         }
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_PLACEMENT_POLICY_TYPE_ValuesAndStrings[] ={
-{ FABRIC_PLACEMENT_POLICY_INVALID , "FABRIC_PLACEMENT_POLICY_INVALID" },
-{ FABRIC_PLACEMENT_POLICY_INVALID_DOMAIN , "FABRIC_PLACEMENT_POLICY_INVALID_DOMAIN" },
-{ FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN , "FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN" },
-{ FABRIC_PLACEMENT_POLICY_PREFERRED_PRIMARY_DOMAIN , "FABRIC_PLACEMENT_POLICY_PREFERRED_PRIMARY_DOMAIN" },
-{ FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN_DISTRIBUTION , "FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN_DISTRIBUTION" },
-{ FABRIC_PLACEMENT_POLICY_NONPARTIALLY_PLACE_SERVICE , "FABRIC_PLACEMENT_POLICY_NONPARTIALLY_PLACE_SERVICE" },
-{ FABRIC_PLACEMENT_POLICY_ALLOW_MULTIPLE_STATELESS_INSTANCES_ON_NODE , "FABRIC_PLACEMENT_POLICY_ALLOW_MULTIPLE_STATELESS_INSTANCES_ON_NODE" },
+static const SF_ENUM_AND_STRING FABRIC_NETWORK_STATUS_FILTER_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_NETWORK_STATUS_FILTER_FAILED , "FABRIC_NETWORK_STATUS_FILTER_FAILED" },
+{ FABRIC_NETWORK_STATUS_FILTER_READY , "FABRIC_NETWORK_STATUS_FILTER_READY" },
+{ FABRIC_NETWORK_STATUS_FILTER_DELETING , "FABRIC_NETWORK_STATUS_FILTER_DELETING" },
+{ FABRIC_NETWORK_STATUS_FILTER_UPDATING , "FABRIC_NETWORK_STATUS_FILTER_UPDATING" },
+{ FABRIC_NETWORK_STATUS_FILTER_CREATING , "FABRIC_NETWORK_STATUS_FILTER_CREATING" },
+{ FABRIC_NETWORK_STATUS_FILTER_ALL , "FABRIC_NETWORK_STATUS_FILTER_ALL" },
+{ FABRIC_NETWORK_STATUS_FILTER_DEFAULT , "FABRIC_NETWORK_STATUS_FILTER_DEFAULT" },
 };
-const char* MU_C3(MU_,FABRIC_PLACEMENT_POLICY_TYPE,_ToString)(FABRIC_PLACEMENT_POLICY_TYPE value)
+static const int32_t FABRIC_NETWORK_STATUS_FILTER_Seeds[] ={
+1, 0, 1, -3, 0, -4, -5,
+};
+int MU_C2(FABRIC_NETWORK_STATUS_FILTER, _FromString)(const char* enumAsString, FABRIC_NETWORK_STATUS_FILTER* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NETWORK_STATUS_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NETWORK_STATUS_FILTER, _Seeds), sizeof(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
     {
-        if(MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_PLACEMENT_POLICY_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    *destination = (FABRIC_NETWORK_STATUS_FILTER)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_PACKAGE_SHARING_POLICY_SCOPE_ValuesAndStrings[] ={
-{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE" },
-{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_ALL , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_ALL" },
-{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CODE , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CODE" },
-{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CONFIG , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CONFIG" },
-{ FABRIC_PACKAGE_SHARING_POLICY_SCOPE_DATA , "FABRIC_PACKAGE_SHARING_POLICY_SCOPE_DATA" },
-};
-const char* MU_C3(MU_,FABRIC_PACKAGE_SHARING_POLICY_SCOPE,_ToString)(FABRIC_PACKAGE_SHARING_POLICY_SCOPE value)
+int MU_C2(FABRIC_NETWORK_STATUS_FILTER, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_NETWORK_STATUS_FILTER* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_PACKAGE_SHARING_POLICY_SCOPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_NETWORK_STATUS_FILTER, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_NETWORK_STATUS_FILTER, _Seeds), sizeof(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _Seeds))/sizeof(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_NETWORK_STATUS_FILTER)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_HEALTH_STATE_FILTER_ValuesAndStrings[] ={
-{ FABRIC_HEALTH_STATE_FILTER_DEFAULT , "FABRIC_HEALTH_STATE_FILTER_DEFAULT" },
-{ FABRIC_HEALTH_STATE_FILTER_NONE , "FABRIC_HEALTH_STATE_FILTER_NONE" },
-{ FABRIC_HEALTH_STATE_FILTER_OK , "FABRIC_HEALTH_STATE_FILTER_OK" },
-{ FABRIC_HEALTH_STATE_FILTER_WARNING , "FABRIC_HEALTH_STATE_FILTER_WARNING" },
-{ FABRIC_HEALTH_STATE_FILTER_ERROR , "FABRIC_HEALTH_STATE_FILTER_ERROR" },
-{ FABRIC_HEALTH_STATE_FILTER_ALL , "FABRIC_HEALTH_STATE_FILTER_ALL" },
+static const char* const FABRIC_ORDERING_Strings[FABRIC_ORDERING_ASC - FABRIC_ORDERING_DESC + 1] ={
+[FABRIC_ORDERING_DESC - FABRIC_ORDERING_DESC] = "FABRIC_ORDERING_DESC",
+[FABRIC_ORDERING_ASC - FABRIC_ORDERING_DESC] = "FABRIC_ORDERING_ASC",
 };
-const char* MU_C3(MU_,FABRIC_HEALTH_STATE_FILTER,_ToString)(FABRIC_HEALTH_STATE_FILTER value)
+const char* MU_C3(MU_,FABRIC_ORDERING,_ToString)(FABRIC_ORDERING value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_HEALTH_STATE_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_HEALTH_STATE_FILTER, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_ORDERING_DESC;
+    if ((index < sizeof(MU_C2(FABRIC_ORDERING, _Strings))/sizeof(MU_C2(FABRIC_ORDERING, _Strings)[0])) && (MU_C2(FABRIC_ORDERING, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_HEALTH_STATE_FILTER, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_HEALTH_STATE_FILTER, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_ORDERING, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_ValuesAndStrings[] ={
-{ FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE , "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE" },
-{ FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MINNODES , "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MINNODES" },
-{ FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MAXNODES , "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MAXNODES" },
-{ FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_METRICS , "FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_METRICS" },
+static const SF_ENUM_AND_STRING FABRIC_ORDERING_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_ORDERING_DESC , "FABRIC_ORDERING_DESC" },
+{ FABRIC_ORDERING_ASC , "FABRIC_ORDERING_ASC" },
 };
-const char* MU_C3(MU_,FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS,_ToString)(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS value)
+static const int32_t FABRIC_ORDERING_Seeds[] ={
+-1, -2,
+};
+int MU_C2(FABRIC_ORDERING, _FromString)(const char* enumAsString, FABRIC_ORDERING* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ORDERING, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ORDERING, _Seeds), sizeof(MU_C2(FABRIC_ORDERING, _Seeds))/sizeof(MU_C2(FABRIC_ORDERING, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ORDERING)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SCALING_TRIGGER_KIND_ValuesAndStrings[] ={
-{ FABRIC_SCALING_TRIGGER_KIND_INVALID , "FABRIC_SCALING_TRIGGER_KIND_INVALID" },
-{ FABRIC_SCALING_TRIGGER_KIND_AVERAGE_PARTITION_LOAD , "FABRIC_SCALING_TRIGGER_KIND_AVERAGE_PARTITION_LOAD" },
-{ FABRIC_SCALING_TRIGGER_KIND_AVERAGE_SERVICE_LOAD , "FABRIC_SCALING_TRIGGER_KIND_AVERAGE_SERVICE_LOAD" },
-};
-const char* MU_C3(MU_,FABRIC_SCALING_TRIGGER_KIND,_ToString)(FABRIC_SCALING_TRIGGER_KIND value)
+int MU_C2(FABRIC_ORDERING, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_ORDERING* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SCALING_TRIGGER_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SCALING_TRIGGER_KIND, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SCALING_TRIGGER_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SCALING_TRIGGER_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_ORDERING, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_ORDERING, _Seeds), sizeof(MU_C2(FABRIC_ORDERING, _Seeds))/sizeof(MU_C2(FABRIC_ORDERING, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_ORDERING)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SCALING_MECHANISM_KIND_ValuesAndStrings[] ={
-{ FABRIC_SCALING_MECHANISM_INVALID , "FABRIC_SCALING_MECHANISM_INVALID" },
-{ FABRIC_SCALING_MECHANISM_KIND_SCALE_PARTITION_INSTANCE_COUNT , "FABRIC_SCALING_MECHANISM_KIND_SCALE_PARTITION_INSTANCE_COUNT" },
-{ FABRIC_SCALING_MECHANISM_KIND_ADD_REMOVE_INCREMENTAL_NAMED_PARTITION , "FABRIC_SCALING_MECHANISM_KIND_ADD_REMOVE_INCREMENTAL_NAMED_PARTITION" },
+static const char* const FABRIC_BLOCK_LIST_TYPE_Strings[FABRIC_BLOCK_LIST_TYPE_RUNNING_TAGS - FABRIC_BLOCK_LIST_TYPE_SERVICE + 1] ={
+[FABRIC_BLOCK_LIST_TYPE_SERVICE - FABRIC_BLOCK_LIST_TYPE_SERVICE] = "FABRIC_BLOCK_LIST_TYPE_SERVICE",
+[FABRIC_BLOCK_LIST_TYPE_OVERALL - FABRIC_BLOCK_LIST_TYPE_SERVICE] = "FABRIC_BLOCK_LIST_TYPE_OVERALL",
+[FABRIC_BLOCK_LIST_TYPE_PREFERRED_PRIMARY - FABRIC_BLOCK_LIST_TYPE_SERVICE] = "FABRIC_BLOCK_LIST_TYPE_PREFERRED_PRIMARY",
+[FABRIC_BLOCK_LIST_TYPE_PLACEMENT_TAGS - FABRIC_BLOCK_LIST_TYPE_SERVICE] = "FABRIC_BLOCK_LIST_TYPE_PLACEMENT_TAGS",
+[FABRIC_BLOCK_LIST_TYPE_RUNNING_TAGS - FABRIC_BLOCK_LIST_TYPE_SERVICE] = "FABRIC_BLOCK_LIST_TYPE_RUNNING_TAGS",
 };
-const char* MU_C3(MU_,FABRIC_SCALING_MECHANISM_KIND,_ToString)(FABRIC_SCALING_MECHANISM_KIND value)
+const char* MU_C3(MU_,FABRIC_BLOCK_LIST_TYPE,_ToString)(FABRIC_BLOCK_LIST_TYPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SCALING_MECHANISM_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SCALING_MECHANISM_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_BLOCK_LIST_TYPE_SERVICE;
+    if ((index < sizeof(MU_C2(FABRIC_BLOCK_LIST_TYPE, _Strings))/sizeof(MU_C2(FABRIC_BLOCK_LIST_TYPE, _Strings)[0])) && (MU_C2(FABRIC_BLOCK_LIST_TYPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_SCALING_MECHANISM_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SCALING_MECHANISM_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_BLOCK_LIST_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_STATE_FILTER_ValuesAndStrings[] ={
-{ FABRIC_TEST_COMMAND_STATE_FILTER_DEFAULT , "FABRIC_TEST_COMMAND_STATE_FILTER_DEFAULT" },
-{ FABRIC_TEST_COMMAND_STATE_FILTER_ALL , "FABRIC_TEST_COMMAND_STATE_FILTER_ALL" },
-{ FABRIC_TEST_COMMAND_STATE_FILTER_RUNNING , "FABRIC_TEST_COMMAND_STATE_FILTER_RUNNING" },
-{ FABRIC_TEST_COMMAND_STATE_FILTER_ROLLING_BACK , "FABRIC_TEST_COMMAND_STATE_FILTER_ROLLING_BACK" },
-{ FABRIC_TEST_COMMAND_STATE_FILTER_COMPLETED_SUCCESSFULLY , "FABRIC_TEST_COMMAND_STATE_FILTER_COMPLETED_SUCCESSFULLY" },
-{ FABRIC_TEST_COMMAND_STATE_FILTER_FAILED , "FABRIC_TEST_COMMAND_STATE_FILTER_FAILED" },
-{ FABRIC_TEST_COMMAND_STATE_FILTER_CANCELLED , "FABRIC_TEST_COMMAND_STATE_FILTER_CANCELLED" },
-{ FABRIC_TEST_COMMAND_STATE_FILTER_FORCE_CANCELLED , "FABRIC_TEST_COMMAND_STATE_FILTER_FORCE_CANCELLED" },
+static const SF_ENUM_AND_STRING FABRIC_BLOCK_LIST_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_BLOCK_LIST_TYPE_OVERALL , "FABRIC_BLOCK_LIST_TYPE_OVERALL" },
+{ FABRIC_BLOCK_LIST_TYPE_PLACEMENT_TAGS , "FABRIC_BLOCK_LIST_TYPE_PLACEMENT_TAGS" },
+{ FABRIC_BLOCK_LIST_TYPE_RUNNING_TAGS , "FABRIC_BLOCK_LIST_TYPE_RUNNING_TAGS" },
+{ FABRIC_BLOCK_LIST_TYPE_SERVICE , "FABRIC_BLOCK_LIST_TYPE_SERVICE" },
+{ FABRIC_BLOCK_LIST_TYPE_PREFERRED_PRIMARY , "FABRIC_BLOCK_LIST_TYPE_PREFERRED_PRIMARY" },
 };
-const char* MU_C3(MU_,FABRIC_TEST_COMMAND_STATE_FILTER,_ToString)(FABRIC_TEST_COMMAND_STATE_FILTER value)
+static const int32_t FABRIC_BLOCK_LIST_TYPE_Seeds[] ={
+-1, -2, 0, 0, 1,
+};
+int MU_C2(FABRIC_BLOCK_LIST_TYPE, _FromString)(const char* enumAsString, FABRIC_BLOCK_LIST_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_TEST_COMMAND_STATE_FILTER, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_BLOCK_LIST_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_BLOCK_LIST_TYPE, _Seeds), sizeof(MU_C2(FABRIC_BLOCK_LIST_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_BLOCK_LIST_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_BLOCK_LIST_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_TYPE_FILTER_ValuesAndStrings[] ={
-{ FABRIC_TEST_COMMAND_TYPE_FILTER_DEFAULT , "FABRIC_TEST_COMMAND_TYPE_FILTER_DEFAULT" },
-{ FABRIC_TEST_COMMAND_TYPE_FILTER_ALL , "FABRIC_TEST_COMMAND_TYPE_FILTER_ALL" },
-{ FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_DATA_LOSS , "FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_DATA_LOSS" },
-{ FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_QUORUM_LOSS , "FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_QUORUM_LOSS" },
-{ FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_RESTART , "FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_RESTART" },
-};
-const char* MU_C3(MU_,FABRIC_TEST_COMMAND_TYPE_FILTER,_ToString)(FABRIC_TEST_COMMAND_TYPE_FILTER value)
+int MU_C2(FABRIC_BLOCK_LIST_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_BLOCK_LIST_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_TEST_COMMAND_TYPE_FILTER, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_BLOCK_LIST_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_BLOCK_LIST_TYPE, _Seeds), sizeof(MU_C2(FABRIC_BLOCK_LIST_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_BLOCK_LIST_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_BLOCK_LIST_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_TEST_COMMAND_TYPE_ValuesAndStrings[] ={
-{ FABRIC_TEST_COMMAND_TYPE_DEFAULT , "FABRIC_TEST_COMMAND_TYPE_DEFAULT" },
-{ FABRIC_TEST_COMMAND_TYPE_INVOKE_DATA_LOSS , "FABRIC_TEST_COMMAND_TYPE_INVOKE_DATA_LOSS" },
-{ FABRIC_TEST_COMMAND_TYPE_INVOKE_QUORUM_LOSS , "FABRIC_TEST_COMMAND_TYPE_INVOKE_QUORUM_LOSS" },
-{ FABRIC_TEST_COMMAND_TYPE_INVOKE_RESTART_PARTITION , "FABRIC_TEST_COMMAND_TYPE_INVOKE_RESTART_PARTITION" },
-{ FABRIC_TEST_COMMAND_TYPE_START_NODE_TRANSITION , "FABRIC_TEST_COMMAND_TYPE_START_NODE_TRANSITION" },
+static const char* const FABRIC_STORE_BACKUP_OPTION_Strings[FABRIC_STORE_BACKUP_OPTION_TRUNCATE_LOGS_ONLY - FABRIC_STORE_BACKUP_OPTION_FULL + 1] ={
+[FABRIC_STORE_BACKUP_OPTION_FULL - FABRIC_STORE_BACKUP_OPTION_FULL] = "FABRIC_STORE_BACKUP_OPTION_FULL",
+[FABRIC_STORE_BACKUP_OPTION_INCREMENTAL - FABRIC_STORE_BACKUP_OPTION_FULL] = "FABRIC_STORE_BACKUP_OPTION_INCREMENTAL",
+[FABRIC_STORE_BACKUP_OPTION_TRUNCATE_LOGS_ONLY - FABRIC_STORE_BACKUP_OPTION_FULL] = "FABRIC_STORE_BACKUP_OPTION_TRUNCATE_LOGS_ONLY",
 };
-const char* MU_C3(MU_,FABRIC_TEST_COMMAND_TYPE,_ToString)(FABRIC_TEST_COMMAND_TYPE value)
+const char* MU_C3(MU_,FABRIC_STORE_BACKUP_OPTION,_ToString)(FABRIC_STORE_BACKUP_OPTION value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_TEST_COMMAND_TYPE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_STORE_BACKUP_OPTION_FULL;
+    if ((index < sizeof(MU_C2(FABRIC_STORE_BACKUP_OPTION, _Strings))/sizeof(MU_C2(FABRIC_STORE_BACKUP_OPTION, _Strings)[0])) && (MU_C2(FABRIC_STORE_BACKUP_OPTION, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_TEST_COMMAND_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_TEST_COMMAND_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_STORE_BACKUP_OPTION, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_ValuesAndStrings[] ={
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_MIGRATION , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_MIGRATION" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_SWAP , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_SWAP" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_CLEANUP , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_CLEANUP" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_SOURCE_DATABASE_CLEANUP , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_SOURCE_DATABASE_CLEANUP" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_ACTIVE , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_ACTIVE" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_RESTORE_SOURCE_BACKUP , "FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_RESTORE_SOURCE_BACKUP" },
+static const SF_ENUM_AND_STRING FABRIC_STORE_BACKUP_OPTION_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_STORE_BACKUP_OPTION_FULL , "FABRIC_STORE_BACKUP_OPTION_FULL" },
+{ FABRIC_STORE_BACKUP_OPTION_TRUNCATE_LOGS_ONLY , "FABRIC_STORE_BACKUP_OPTION_TRUNCATE_LOGS_ONLY" },
+{ FABRIC_STORE_BACKUP_OPTION_INCREMENTAL , "FABRIC_STORE_BACKUP_OPTION_INCREMENTAL" },
 };
-const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE,_ToString)(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE value)
+static const int32_t FABRIC_STORE_BACKUP_OPTION_Seeds[] ={
+-2, 2, 0,
+};
+int MU_C2(FABRIC_STORE_BACKUP_OPTION, _FromString)(const char* enumAsString, FABRIC_STORE_BACKUP_OPTION* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STORE_BACKUP_OPTION, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STORE_BACKUP_OPTION, _Seeds), sizeof(MU_C2(FABRIC_STORE_BACKUP_OPTION, _Seeds))/sizeof(MU_C2(FABRIC_STORE_BACKUP_OPTION, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STORE_BACKUP_OPTION)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_ValuesAndStrings[] ={
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_PROCESSING , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_PROCESSING" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_COMPLETED , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_COMPLETED" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_CANCELED , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_CANCELED" },
-{ FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_FAILED , "FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_FAILED" },
-};
-const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_MIGRATION_STATE,_ToString)(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE value)
+int MU_C2(FABRIC_STORE_BACKUP_OPTION, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_STORE_BACKUP_OPTION* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_STORE_BACKUP_OPTION, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_STORE_BACKUP_OPTION, _Seeds), sizeof(MU_C2(FABRIC_STORE_BACKUP_OPTION, _Seeds))/sizeof(MU_C2(FABRIC_STORE_BACKUP_OPTION, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_STORE_BACKUP_OPTION)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_ValuesAndStrings[] ={
-{ FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN , "FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN" },
-{ FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_ESE , "FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_ESE" },
-{ FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_TSTORE , "FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_TSTORE" },
+static const char* const FABRIC_CODE_PACKAGE_EVENT_TYPE_Strings[FABRIC_CODE_PACKAGE_EVENT_TYPE_RAN_TO_COMPLETION - FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID + 1] ={
+[FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID - FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID] = "FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID",
+[FABRIC_CODE_PACKAGE_EVENT_TYPE_START_FAILED - FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID] = "FABRIC_CODE_PACKAGE_EVENT_TYPE_START_FAILED",
+[FABRIC_CODE_PACKAGE_EVENT_TYPE_STARTED - FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID] = "FABRIC_CODE_PACKAGE_EVENT_TYPE_STARTED",
+[FABRIC_CODE_PACKAGE_EVENT_TYPE_READY - FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID] = "FABRIC_CODE_PACKAGE_EVENT_TYPE_READY",
+[FABRIC_CODE_PACKAGE_EVENT_TYPE_HEALTH - FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID] = "FABRIC_CODE_PACKAGE_EVENT_TYPE_HEALTH",
+[FABRIC_CODE_PACKAGE_EVENT_TYPE_STOPPED - FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID] = "FABRIC_CODE_PACKAGE_EVENT_TYPE_STOPPED",
+[FABRIC_CODE_PACKAGE_EVENT_TYPE_TERMINATED - FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID] = "FABRIC_CODE_PACKAGE_EVENT_TYPE_TERMINATED",
+[FABRIC_CODE_PACKAGE_EVENT_TYPE_RAN_TO_COMPLETION - FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID] = "FABRIC_CODE_PACKAGE_EVENT_TYPE_RAN_TO_COMPLETION",
 };
-const char* MU_C3(MU_,FABRIC_KEY_VALUE_STORE_PROVIDER_KIND,_ToString)(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND value)
+const char* MU_C3(MU_,FABRIC_CODE_PACKAGE_EVENT_TYPE,_ToString)(FABRIC_CODE_PACKAGE_EVENT_TYPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Strings))/sizeof(MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Strings)[0])) && (MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_NETWORK_TYPE_ValuesAndStrings[] ={
-{ FABRIC_NETWORK_TYPE_INVALID , "FABRIC_NETWORK_TYPE_INVALID" },
-{ FABRIC_NETWORK_TYPE_LOCAL , "FABRIC_NETWORK_TYPE_LOCAL" },
-{ FABRIC_NETWORK_TYPE_FEDERATED , "FABRIC_NETWORK_TYPE_FEDERATED" },
+static const SF_ENUM_AND_STRING FABRIC_CODE_PACKAGE_EVENT_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_CODE_PACKAGE_EVENT_TYPE_HEALTH , "FABRIC_CODE_PACKAGE_EVENT_TYPE_HEALTH" },
+{ FABRIC_CODE_PACKAGE_EVENT_TYPE_START_FAILED , "FABRIC_CODE_PACKAGE_EVENT_TYPE_START_FAILED" },
+{ FABRIC_CODE_PACKAGE_EVENT_TYPE_TERMINATED , "FABRIC_CODE_PACKAGE_EVENT_TYPE_TERMINATED" },
+{ FABRIC_CODE_PACKAGE_EVENT_TYPE_READY , "FABRIC_CODE_PACKAGE_EVENT_TYPE_READY" },
+{ FABRIC_CODE_PACKAGE_EVENT_TYPE_RAN_TO_COMPLETION , "FABRIC_CODE_PACKAGE_EVENT_TYPE_RAN_TO_COMPLETION" },
+{ FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID , "FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID" },
+{ FABRIC_CODE_PACKAGE_EVENT_TYPE_STARTED , "FABRIC_CODE_PACKAGE_EVENT_TYPE_STARTED" },
+{ FABRIC_CODE_PACKAGE_EVENT_TYPE_STOPPED , "FABRIC_CODE_PACKAGE_EVENT_TYPE_STOPPED" },
 };
-const char* MU_C3(MU_,FABRIC_NETWORK_TYPE,_ToString)(FABRIC_NETWORK_TYPE value)
+static const int32_t FABRIC_CODE_PACKAGE_EVENT_TYPE_Seeds[] ={
+-1, 0, -3, 2, 0, 5, 0, 0,
+};
+int MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _FromString)(const char* enumAsString, FABRIC_CODE_PACKAGE_EVENT_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_NETWORK_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_NETWORK_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_NETWORK_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_NETWORK_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Seeds), sizeof(MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CODE_PACKAGE_EVENT_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_NETWORK_STATUS_ValuesAndStrings[] ={
-{ FABRIC_NETWORK_STATUS_INVALID , "FABRIC_NETWORK_STATUS_INVALID" },
-{ FABRIC_NETWORK_STATUS_READY , "FABRIC_NETWORK_STATUS_READY" },
-{ FABRIC_NETWORK_STATUS_CREATING , "FABRIC_NETWORK_STATUS_CREATING" },
-{ FABRIC_NETWORK_STATUS_DELETING , "FABRIC_NETWORK_STATUS_DELETING" },
-{ FABRIC_NETWORK_STATUS_UPDATING , "FABRIC_NETWORK_STATUS_UPDATING" },
-{ FABRIC_NETWORK_STATUS_FAILED , "FABRIC_NETWORK_STATUS_FAILED" },
-};
-const char* MU_C3(MU_,FABRIC_NETWORK_STATUS,_ToString)(FABRIC_NETWORK_STATUS value)
+int MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_CODE_PACKAGE_EVENT_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_NETWORK_STATUS, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_NETWORK_STATUS, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_NETWORK_STATUS, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_NETWORK_STATUS, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Seeds), sizeof(MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_CODE_PACKAGE_EVENT_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_NETWORK_STATUS_FILTER_ValuesAndStrings[] ={
-{ FABRIC_NETWORK_STATUS_FILTER_DEFAULT , "FABRIC_NETWORK_STATUS_FILTER_DEFAULT" },
-{ FABRIC_NETWORK_STATUS_FILTER_ALL , "FABRIC_NETWORK_STATUS_FILTER_ALL" },
-{ FABRIC_NETWORK_STATUS_FILTER_READY , "FABRIC_NETWORK_STATUS_FILTER_READY" },
-{ FABRIC_NETWORK_STATUS_FILTER_CREATING , "FABRIC_NETWORK_STATUS_FILTER_CREATING" },
-{ FABRIC_NETWORK_STATUS_FILTER_DELETING , "FABRIC_NETWORK_STATUS_FILTER_DELETING" },
-{ FABRIC_NETWORK_STATUS_FILTER_UPDATING , "FABRIC_NETWORK_STATUS_FILTER_UPDATING" },
-{ FABRIC_NETWORK_STATUS_FILTER_FAILED , "FABRIC_NETWORK_STATUS_FILTER_FAILED" },
+static const char* const FABRIC_SERVICE_HOST_UPGRADE_IMPACT_Strings[FABRIC_SERVICE_HOST_UPGRADE_IMPACT_UNEXPECTED_SERVICE_HOST_RESTART - FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID + 1] ={
+[FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID - FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID] = "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID",
+[FABRIC_SERVICE_HOST_UPGRADE_IMPACT_NONE - FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID] = "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_NONE",
+[FABRIC_SERVICE_HOST_UPGRADE_IMPACT_SERVICE_HOST_RESTART - FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID] = "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_SERVICE_HOST_RESTART",
+[FABRIC_SERVICE_HOST_UPGRADE_IMPACT_UNEXPECTED_SERVICE_HOST_RESTART - FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID] = "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_UNEXPECTED_SERVICE_HOST_RESTART",
 };
-const char* MU_C3(MU_,FABRIC_NETWORK_STATUS_FILTER,_ToString)(FABRIC_NETWORK_STATUS_FILTER value)
+const char* MU_C3(MU_,FABRIC_SERVICE_HOST_UPGRADE_IMPACT,_ToString)(FABRIC_SERVICE_HOST_UPGRADE_IMPACT value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID;
+    if ((index < sizeof(MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Strings))/sizeof(MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Strings)[0])) && (MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_NETWORK_STATUS_FILTER, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_NETWORK_STATUS_FILTER, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_ORDERING_ValuesAndStrings[] ={
-{ FABRIC_ORDERING_DESC , "FABRIC_ORDERING_DESC" },
-{ FABRIC_ORDERING_ASC , "FABRIC_ORDERING_ASC" },
+static const SF_ENUM_AND_STRING FABRIC_SERVICE_HOST_UPGRADE_IMPACT_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_SERVICE_HOST_UPGRADE_IMPACT_NONE , "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_NONE" },
+{ FABRIC_SERVICE_HOST_UPGRADE_IMPACT_SERVICE_HOST_RESTART , "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_SERVICE_HOST_RESTART" },
+{ FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID , "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID" },
+{ FABRIC_SERVICE_HOST_UPGRADE_IMPACT_UNEXPECTED_SERVICE_HOST_RESTART , "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_UNEXPECTED_SERVICE_HOST_RESTART" },
 };
-const char* MU_C3(MU_,FABRIC_ORDERING,_ToString)(FABRIC_ORDERING value)
+static const int32_t FABRIC_SERVICE_HOST_UPGRADE_IMPACT_Seeds[] ={
+-1, 0, 1, -2,
+};
+int MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _FromString)(const char* enumAsString, FABRIC_SERVICE_HOST_UPGRADE_IMPACT* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_ORDERING, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_ORDERING, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_ORDERING, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_ORDERING, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_HOST_UPGRADE_IMPACT)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_BLOCK_LIST_TYPE_ValuesAndStrings[] ={
-{ FABRIC_BLOCK_LIST_TYPE_SERVICE , "FABRIC_BLOCK_LIST_TYPE_SERVICE" },
-{ FABRIC_BLOCK_LIST_TYPE_OVERALL , "FABRIC_BLOCK_LIST_TYPE_OVERALL" },
-{ FABRIC_BLOCK_LIST_TYPE_PREFERRED_PRIMARY , "FABRIC_BLOCK_LIST_TYPE_PREFERRED_PRIMARY" },
-{ FABRIC_BLOCK_LIST_TYPE_PLACEMENT_TAGS , "FABRIC_BLOCK_LIST_TYPE_PLACEMENT_TAGS" },
-{ FABRIC_BLOCK_LIST_TYPE_RUNNING_TAGS , "FABRIC_BLOCK_LIST_TYPE_RUNNING_TAGS" },
-};
-const char* MU_C3(MU_,FABRIC_BLOCK_LIST_TYPE,_ToString)(FABRIC_BLOCK_LIST_TYPE value)
+int MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_SERVICE_HOST_UPGRADE_IMPACT* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_BLOCK_LIST_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_BLOCK_LIST_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_BLOCK_LIST_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_BLOCK_LIST_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Seeds), sizeof(MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Seeds))/sizeof(MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_SERVICE_HOST_UPGRADE_IMPACT)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_STORE_BACKUP_OPTION_ValuesAndStrings[] ={
-{ FABRIC_STORE_BACKUP_OPTION_FULL , "FABRIC_STORE_BACKUP_OPTION_FULL" },
-{ FABRIC_STORE_BACKUP_OPTION_INCREMENTAL , "FABRIC_STORE_BACKUP_OPTION_INCREMENTAL" },
-{ FABRIC_STORE_BACKUP_OPTION_TRUNCATE_LOGS_ONLY , "FABRIC_STORE_BACKUP_OPTION_TRUNCATE_LOGS_ONLY" },
+static const char* const FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_Strings[FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_TO_COMPLETION - FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS + 1] ={
+[FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS - FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS] = "FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS",
+[FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_TO_COMPLETION - FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS] = "FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_TO_COMPLETION",
 };
-const char* MU_C3(MU_,FABRIC_STORE_BACKUP_OPTION,_ToString)(FABRIC_STORE_BACKUP_OPTION value)
+const char* MU_C3(MU_,FABRIC_EXECUTION_POLICY_EXECUTION_TYPE,_ToString)(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_STORE_BACKUP_OPTION, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_STORE_BACKUP_OPTION, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS;
+    if ((index < sizeof(MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Strings))/sizeof(MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Strings)[0])) && (MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_STORE_BACKUP_OPTION, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_STORE_BACKUP_OPTION, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_CODE_PACKAGE_EVENT_TYPE_ValuesAndStrings[] ={
-{ FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID , "FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID" },
-{ FABRIC_CODE_PACKAGE_EVENT_TYPE_START_FAILED , "FABRIC_CODE_PACKAGE_EVENT_TYPE_START_FAILED" },
-{ FABRIC_CODE_PACKAGE_EVENT_TYPE_STARTED , "FABRIC_CODE_PACKAGE_EVENT_TYPE_STARTED" },
-{ FABRIC_CODE_PACKAGE_EVENT_TYPE_READY , "FABRIC_CODE_PACKAGE_EVENT_TYPE_READY" },
-{ FABRIC_CODE_PACKAGE_EVENT_TYPE_HEALTH , "FABRIC_CODE_PACKAGE_EVENT_TYPE_HEALTH" },
-{ FABRIC_CODE_PACKAGE_EVENT_TYPE_STOPPED , "FABRIC_CODE_PACKAGE_EVENT_TYPE_STOPPED" },
-{ FABRIC_CODE_PACKAGE_EVENT_TYPE_TERMINATED , "FABRIC_CODE_PACKAGE_EVENT_TYPE_TERMINATED" },
-{ FABRIC_CODE_PACKAGE_EVENT_TYPE_RAN_TO_COMPLETION , "FABRIC_CODE_PACKAGE_EVENT_TYPE_RAN_TO_COMPLETION" },
+static const SF_ENUM_AND_STRING FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
+{ FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_TO_COMPLETION , "FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_TO_COMPLETION" },
+{ FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS , "FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS" },
 };
-const char* MU_C3(MU_,FABRIC_CODE_PACKAGE_EVENT_TYPE,_ToString)(FABRIC_CODE_PACKAGE_EVENT_TYPE value)
+static const int32_t FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_Seeds[] ={
+0, 1,
+};
+int MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _FromString)(const char* enumAsString, FABRIC_EXECUTION_POLICY_EXECUTION_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_CODE_PACKAGE_EVENT_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Seeds), sizeof(MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_EXECUTION_POLICY_EXECUTION_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_SERVICE_HOST_UPGRADE_IMPACT_ValuesAndStrings[] ={
-{ FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID , "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID" },
-{ FABRIC_SERVICE_HOST_UPGRADE_IMPACT_NONE , "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_NONE" },
-{ FABRIC_SERVICE_HOST_UPGRADE_IMPACT_SERVICE_HOST_RESTART , "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_SERVICE_HOST_RESTART" },
-{ FABRIC_SERVICE_HOST_UPGRADE_IMPACT_UNEXPECTED_SERVICE_HOST_RESTART , "FABRIC_SERVICE_HOST_UPGRADE_IMPACT_UNEXPECTED_SERVICE_HOST_RESTART" },
-};
-const char* MU_C3(MU_,FABRIC_SERVICE_HOST_UPGRADE_IMPACT,_ToString)(FABRIC_SERVICE_HOST_UPGRADE_IMPACT value)
+int MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_EXECUTION_POLICY_EXECUTION_TYPE* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_SERVICE_HOST_UPGRADE_IMPACT, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Seeds), sizeof(MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Seeds))/sizeof(MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_EXECUTION_POLICY_EXECUTION_TYPE)candidate->value;
+    return 0;
 }
 
-static const SF_ENUM_AND_STRING FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_ValuesAndStrings[] ={
-{ FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS , "FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS" },
-{ FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_TO_COMPLETION , "FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_TO_COMPLETION" },
+static const char* const FABRIC_EXECUTION_POLICY_RESTART_POLICY_Strings[FABRIC_EXECUTION_POLICY_RESTART_POLICY_NEVER - FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS + 1] ={
+[FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS - FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS] = "FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS",
+[FABRIC_EXECUTION_POLICY_RESTART_POLICY_ON_FAILURE - FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS] = "FABRIC_EXECUTION_POLICY_RESTART_POLICY_ON_FAILURE",
+[FABRIC_EXECUTION_POLICY_RESTART_POLICY_NEVER - FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS] = "FABRIC_EXECUTION_POLICY_RESTART_POLICY_NEVER",
 };
-const char* MU_C3(MU_,FABRIC_EXECUTION_POLICY_EXECUTION_TYPE,_ToString)(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE value)
+const char* MU_C3(MU_,FABRIC_EXECUTION_POLICY_RESTART_POLICY,_ToString)(FABRIC_EXECUTION_POLICY_RESTART_POLICY value)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _ValuesAndStrings)[0]);i++)
+    uint32_t index = (uint32_t)value - (uint32_t)FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS;
+    if ((index < sizeof(MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Strings))/sizeof(MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Strings)[0])) && (MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Strings)[index] != NULL))
     {
-        if(MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Strings)[index];
     }
     return "UNKNOWN";
 }
 
-static const SF_ENUM_AND_STRING FABRIC_EXECUTION_POLICY_RESTART_POLICY_ValuesAndStrings[] ={
-{ FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS , "FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS" },
+static const SF_ENUM_AND_STRING FABRIC_EXECUTION_POLICY_RESTART_POLICY_StringsAndValues[] ={ /*placed by the perfect hash of the string*/
 { FABRIC_EXECUTION_POLICY_RESTART_POLICY_ON_FAILURE , "FABRIC_EXECUTION_POLICY_RESTART_POLICY_ON_FAILURE" },
 { FABRIC_EXECUTION_POLICY_RESTART_POLICY_NEVER , "FABRIC_EXECUTION_POLICY_RESTART_POLICY_NEVER" },
+{ FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS , "FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS" },
 };
-const char* MU_C3(MU_,FABRIC_EXECUTION_POLICY_RESTART_POLICY,_ToString)(FABRIC_EXECUTION_POLICY_RESTART_POLICY value)
+static const int32_t FABRIC_EXECUTION_POLICY_RESTART_POLICY_Seeds[] ={
+0, 1, -2,
+};
+int MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _FromString)(const char* enumAsString, FABRIC_EXECUTION_POLICY_RESTART_POLICY* destination)
 {
-    for(size_t i=0;i<sizeof(MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _ValuesAndStrings))/sizeof(MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _ValuesAndStrings)[0]);i++)
+    if((enumAsString == NULL) || (destination == NULL))
     {
-        if(MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _ValuesAndStrings)[i].value == (int)value)
-        {
-            return MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _ValuesAndStrings)[i].valueAsString;
-        }
+        return MU_FAILURE;
     }
-    return "UNKNOWN";
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Seeds), sizeof(MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Seeds))/sizeof(MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Seeds)[0]))];
+    if(strcmp(enumAsString, candidate->valueAsString) != 0)
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_EXECUTION_POLICY_RESTART_POLICY)candidate->value;
+    return 0;
+}
+
+int MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _FromStringCaseInsensitive)(const char* enumAsString, FABRIC_EXECUTION_POLICY_RESTART_POLICY* destination)
+{
+    if((enumAsString == NULL) || (destination == NULL))
+    {
+        return MU_FAILURE;
+    }
+    const SF_ENUM_AND_STRING* candidate = &MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Seeds), sizeof(MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Seeds))/sizeof(MU_C2(FABRIC_EXECUTION_POLICY_RESTART_POLICY, _Seeds)[0]))];
+    if(!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString))
+    {
+        return MU_FAILURE;
+    }
+    *destination = (FABRIC_EXECUTION_POLICY_RESTART_POLICY)candidate->value;
+    return 0;
 }
 
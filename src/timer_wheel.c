@@ -0,0 +1,427 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/srw_lock.h"
+#include "c_pal/threadapi.h"
+#include "c_pal/timer.h"
+
+#include "sf_c_util/timer_wheel.h"
+
+#include "sf_c_util/alloc_stats_redirect.h"
+
+ALLOC_STATS_DEFINE_MODULE(timer_wheel)
+
+typedef struct TIMER_WHEEL_TAG
+{
+    uint32_t tick_ms;
+    double start_time; /* ticks are counted from here */
+    uint64_t next_tick; /* the first tick that was not processed yet, protected by lock */
+    SRW_LOCK_HANDLE lock;
+    THREAD_HANDLE thread;
+    volatile_atomic int32_t is_stopping;
+    TIMER_WHEEL_TIMER slots[TIMER_WHEEL_LEVEL_COUNT][TIMER_WHEEL_LEVEL_SLOT_COUNT]; /* every slot is the head of a circular list of the timers that expire in it, protected by lock */
+} TIMER_WHEEL;
+
+static uint64_t get_current_tick(TIMER_WHEEL* timer_wheel)
+{
+    double elapsed = timer_global_get_elapsed_ms() - timer_wheel->start_time;
+    return (elapsed <= 0) ? 0 : (uint64_t)(elapsed / timer_wheel->tick_ms);
+}
+
+static void unlink_timer(TIMER_WHEEL_TIMER* timer)
+{
+    timer->previous->next = timer->next;
+    timer->next->previous = timer->previous;
+    timer->next = NULL;
+    timer->previous = NULL;
+}
+
+/* links timer at the end of the slot for its expiry tick, relative to next_tick, must be called under the lock */
+static void link_timer(TIMER_WHEEL* timer_wheel, TIMER_WHEEL_TIMER* timer)
+{
+    TIMER_WHEEL_TIMER* slot;
+    uint64_t slot_tick = timer->expiry_tick;
+    uint32_t level = 0;
+
+    /* Codes_SRS_TIMER_WHEEL_01_031: [ A timer that expires TIMER_WHEEL_MAX_TICKS or more ticks after the first tick that was not processed yet shall be linked in the slot for the tick TIMER_WHEEL_MAX_TICKS - 1 ticks after it. ]*/
+    if (slot_tick - timer_wheel->next_tick >= TIMER_WHEEL_MAX_TICKS)
+    {
+        slot_tick = timer_wheel->next_tick + TIMER_WHEEL_MAX_TICKS - 1;
+    }
+
+    /* Codes_SRS_TIMER_WHEEL_01_030: [ The slot for a tick shall be in the lowest level level for which the tick is less than TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level + 1 ticks after the first tick that was not processed yet, at the index (tick / TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level) modulo TIMER_WHEEL_LEVEL_SLOT_COUNT. ]*/
+    while ((slot_tick - timer_wheel->next_tick) >> (TIMER_WHEEL_LEVEL_BITS * (level + 1)) != 0)
+    {
+        level++;
+    }
+    slot = &timer_wheel->slots[level][(slot_tick >> (TIMER_WHEEL_LEVEL_BITS * level)) & (TIMER_WHEEL_LEVEL_SLOT_COUNT - 1)];
+
+    timer->next = slot;
+    timer->previous = slot->previous;
+    slot->previous->next = timer;
+    slot->previous = timer;
+}
+
+/* moves the timers of a slot of an upper level to their slots relative to next_tick, they all expire in the TIMER_WHEEL_LEVEL_SLOT_COUNT ticks of the level below starting at next_tick */
+static void cascade_slot(TIMER_WHEEL* timer_wheel, TIMER_WHEEL_TIMER* slot)
+{
+    if (slot->next != slot)
+    {
+        /* detach the list first, a timer that expires TIMER_WHEEL_MAX_TICKS or more ticks away goes to another slot of the same level */
+        TIMER_WHEEL_TIMER* timer = slot->next;
+        slot->previous->next = NULL;
+        slot->next = slot;
+        slot->previous = slot;
+
+        while (timer != NULL)
+        {
+            TIMER_WHEEL_TIMER* next = timer->next;
+            link_timer(timer_wheel, timer);
+            timer = next;
+        }
+    }
+}
+
+/* appends timer to the chain of timers to fire, which goes through their previous field */
+static void chain_timer(TIMER_WHEEL_TIMER** first, TIMER_WHEEL_TIMER** last, TIMER_WHEEL_TIMER* timer)
+{
+    if (*last == NULL)
+    {
+        *first = timer;
+    }
+    else
+    {
+        (*last)->previous = timer;
+    }
+    *last = timer;
+}
+
+/* calls the callbacks of a chain of unlinked timers */
+static void fire_timers(TIMER_WHEEL_TIMER* timer, bool is_cancelled)
+{
+    while (timer != NULL)
+    {
+        /* the callback can schedule the timer again or free it */
+        TIMER_WHEEL_TIMER* next = timer->previous;
+        timer->previous = NULL;
+        timer->callback(timer->callback_context, is_cancelled);
+        timer = next;
+    }
+}
+
+/* unlinks the timers that expired up to the current tick and chains them through their previous field, in expiry order */
+static TIMER_WHEEL_TIMER* collect_expired_timers(TIMER_WHEEL* timer_wheel)
+{
+    TIMER_WHEEL_TIMER* first = NULL;
+    TIMER_WHEEL_TIMER* last = NULL;
+    uint64_t current_tick = get_current_tick(timer_wheel);
+
+    srw_lock_acquire_exclusive(timer_wheel->lock);
+    while (timer_wheel->next_tick <= current_tick)
+    {
+        uint64_t tick = timer_wheel->next_tick;
+        uint32_t level;
+        TIMER_WHEEL_TIMER* slot;
+
+        /* Codes_SRS_TIMER_WHEEL_01_032: [ Before processing a tick that is a multiple of TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level, for every level from 1 up, the thread of the wheel shall move the timers of the slot for the tick in level to their slots relative to the tick. ]*/
+        for (level = 1; level < TIMER_WHEEL_LEVEL_COUNT; level++)
+        {
+            if ((tick & (((uint64_t)1 << (TIMER_WHEEL_LEVEL_BITS * level)) - 1)) != 0)
+            {
+                break;
+            }
+            cascade_slot(timer_wheel, &timer_wheel->slots[level][(tick >> (TIMER_WHEEL_LEVEL_BITS * level)) & (TIMER_WHEEL_LEVEL_SLOT_COUNT - 1)]);
+        }
+
+        /* Codes_SRS_TIMER_WHEEL_01_033: [ The thread of the wheel shall unlink all the timers of the slot for the tick in level 0, they all expire in the tick. ]*/
+        slot = &timer_wheel->slots[0][tick & (TIMER_WHEEL_LEVEL_SLOT_COUNT - 1)];
+        while (slot->next != slot)
+        {
+            TIMER_WHEEL_TIMER* timer = slot->next;
+            unlink_timer(timer);
+            chain_timer(&first, &last, timer);
+        }
+        timer_wheel->next_tick++;
+    }
+    srw_lock_release_exclusive(timer_wheel->lock);
+
+    return first;
+}
+
+static int timer_wheel_thread(void* context)
+{
+    TIMER_WHEEL* timer_wheel = context;
+
+    while (interlocked_add(&timer_wheel->is_stopping, 0) == 0)
+    {
+        /* Codes_SRS_TIMER_WHEEL_01_025: [ The thread of the wheel shall wait at most tick_ms for the wheel to be destroyed by calling InterlockedHL_WaitForValue. ]*/
+        INTERLOCKED_HL_RESULT wait_result = InterlockedHL_WaitForValue(&timer_wheel->is_stopping, 1, timer_wheel->tick_ms);
+        if (wait_result == INTERLOCKED_HL_OK)
+        {
+            /* Codes_SRS_TIMER_WHEEL_01_028: [ When the wheel is destroyed the thread of the wheel shall exit and leave the timers that are still scheduled to timer_wheel_destroy. ]*/
+        }
+        else
+        {
+            if (wait_result != INTERLOCKED_HL_TIMEOUT)
+            {
+                LogError("failure in InterlockedHL_WaitForValue(&timer_wheel->is_stopping=%p, 1, timer_wheel->tick_ms=%" PRIu32 "), INTERLOCKED_HL_RESULT wait_result=%d",
+                    &timer_wheel->is_stopping, timer_wheel->tick_ms, (int)wait_result);
+            }
+
+            /* Codes_SRS_TIMER_WHEEL_01_026: [ Otherwise the thread of the wheel shall compute the current tick by calling timer_global_get_elapsed_ms and, under the lock, process every tick that was not processed yet up to the current tick. ]*/
+            TIMER_WHEEL_TIMER* timer = collect_expired_timers(timer_wheel);
+
+            /* Codes_SRS_TIMER_WHEEL_01_027: [ The thread of the wheel shall call the callback of every unlinked timer with is_cancelled set to false, in expiry order, after releasing the lock. ]*/
+            fire_timers(timer, false);
+        }
+    }
+
+    return 0;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, TIMER_WHEEL_HANDLE, timer_wheel_create, uint32_t, tick_ms)
+{
+    TIMER_WHEEL_HANDLE result;
+
+    if (tick_ms == 0)
+    {
+        /* Codes_SRS_TIMER_WHEEL_01_001: [ If tick_ms is 0, timer_wheel_create shall fail and return NULL. ]*/
+        LogError("Invalid arguments: uint32_t tick_ms=%" PRIu32 "", tick_ms);
+    }
+    else
+    {
+        /* Codes_SRS_TIMER_WHEEL_01_002: [ timer_wheel_create shall allocate memory for the wheel. ]*/
+        result = malloc(sizeof(TIMER_WHEEL));
+        if (result == NULL)
+        {
+            /* Codes_SRS_TIMER_WHEEL_01_006: [ If any error occurs, timer_wheel_create shall fail and return NULL. ]*/
+            LogError("failure in malloc(sizeof(TIMER_WHEEL)=%zu)", sizeof(TIMER_WHEEL));
+        }
+        else
+        {
+            /* Codes_SRS_TIMER_WHEEL_01_003: [ timer_wheel_create shall create the lock of the wheel by calling srw_lock_create. ]*/
+            result->lock = srw_lock_create(false, "timer_wheel");
+            if (result->lock == NULL)
+            {
+                /* Codes_SRS_TIMER_WHEEL_01_006: [ If any error occurs, timer_wheel_create shall fail and return NULL. ]*/
+                LogError("failure in srw_lock_create(false, \"timer_wheel\")");
+            }
+            else
+            {
+                THREADAPI_RESULT thread_result;
+                uint32_t level;
+                uint32_t i;
+
+                /* Codes_SRS_TIMER_WHEEL_01_004: [ timer_wheel_create shall initialize all the slots of all the levels of the wheel as empty and count the ticks from the time returned by timer_global_get_elapsed_ms. ]*/
+                for (level = 0; level < TIMER_WHEEL_LEVEL_COUNT; level++)
+                {
+                    for (i = 0; i < TIMER_WHEEL_LEVEL_SLOT_COUNT; i++)
+                    {
+                        result->slots[level][i].next = &result->slots[level][i];
+                        result->slots[level][i].previous = &result->slots[level][i];
+                    }
+                }
+                result->tick_ms = tick_ms;
+                result->start_time = timer_global_get_elapsed_ms();
+                result->next_tick = 0;
+                (void)interlocked_exchange(&result->is_stopping, 0);
+
+                /* Codes_SRS_TIMER_WHEEL_01_005: [ timer_wheel_create shall start the thread that fires the timers by calling ThreadAPI_Create. ]*/
+                thread_result = ThreadAPI_Create(&result->thread, timer_wheel_thread, result);
+                if (thread_result != THREADAPI_OK)
+                {
+                    /* Codes_SRS_TIMER_WHEEL_01_006: [ If any error occurs, timer_wheel_create shall fail and return NULL. ]*/
+                    LogError("failure in ThreadAPI_Create(&result->thread=%p, timer_wheel_thread=%p, result=%p), THREADAPI_RESULT thread_result=%" PRI_MU_ENUM "",
+                        &result->thread, timer_wheel_thread, result, MU_ENUM_VALUE(THREADAPI_RESULT, thread_result));
+                }
+                else
+                {
+                    /* Codes_SRS_TIMER_WHEEL_01_007: [ timer_wheel_create shall succeed and return a non-NULL handle. ]*/
+                    goto all_ok;
+                }
+                srw_lock_destroy(result->lock);
+            }
+            free(result);
+        }
+    }
+
+    result = NULL;
+
+all_ok:
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void, timer_wheel_destroy, TIMER_WHEEL_HANDLE, timer_wheel)
+{
+    if (timer_wheel == NULL)
+    {
+        /* Codes_SRS_TIMER_WHEEL_01_008: [ If timer_wheel is NULL, timer_wheel_destroy shall return. ]*/
+        LogError("Invalid arguments: TIMER_WHEEL_HANDLE timer_wheel=%p", timer_wheel);
+    }
+    else
+    {
+        int thread_return;
+        THREADAPI_RESULT thread_result;
+        uint32_t level;
+        uint32_t i;
+        TIMER_WHEEL_TIMER* first = NULL;
+        TIMER_WHEEL_TIMER* last = NULL;
+
+        /* Codes_SRS_TIMER_WHEEL_01_009: [ timer_wheel_destroy shall stop the thread of the wheel by setting the stop flag, calling wake_by_address_single and ThreadAPI_Join. ]*/
+        (void)interlocked_exchange(&timer_wheel->is_stopping, 1);
+        wake_by_address_single(&timer_wheel->is_stopping);
+        thread_result = ThreadAPI_Join(timer_wheel->thread, &thread_return);
+        if (thread_result != THREADAPI_OK)
+        {
+            LogError("failure in ThreadAPI_Join(timer_wheel->thread=%p, &thread_return=%p), THREADAPI_RESULT thread_result=%" PRI_MU_ENUM "",
+                timer_wheel->thread, &thread_return, MU_ENUM_VALUE(THREADAPI_RESULT, thread_result));
+        }
+
+        /* Codes_SRS_TIMER_WHEEL_01_010: [ timer_wheel_destroy shall unlink under the lock the timers that are still scheduled and call their callbacks with is_cancelled set to true after releasing the lock. ]*/
+        /* the operations that own the timers can still cancel them concurrently */
+        srw_lock_acquire_exclusive(timer_wheel->lock);
+        for (level = 0; level < TIMER_WHEEL_LEVEL_COUNT; level++)
+        {
+            for (i = 0; i < TIMER_WHEEL_LEVEL_SLOT_COUNT; i++)
+            {
+                while (timer_wheel->slots[level][i].next != &timer_wheel->slots[level][i])
+                {
+                    TIMER_WHEEL_TIMER* timer = timer_wheel->slots[level][i].next;
+                    unlink_timer(timer);
+                    chain_timer(&first, &last, timer);
+                }
+            }
+        }
+        srw_lock_release_exclusive(timer_wheel->lock);
+
+        fire_timers(first, true);
+
+        /* Codes_SRS_TIMER_WHEEL_01_011: [ timer_wheel_destroy shall destroy the lock by calling srw_lock_destroy and free the memory used by the wheel. ]*/
+        srw_lock_destroy(timer_wheel->lock);
+        free(timer_wheel);
+    }
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, void, timer_wheel_timer_init, TIMER_WHEEL_TIMER*, timer)
+{
+    if (timer == NULL)
+    {
+        /* Codes_SRS_TIMER_WHEEL_01_012: [ If timer is NULL, timer_wheel_timer_init shall return. ]*/
+        LogError("Invalid arguments: TIMER_WHEEL_TIMER* timer=%p", timer);
+    }
+    else
+    {
+        /* Codes_SRS_TIMER_WHEEL_01_013: [ timer_wheel_timer_init shall initialize timer as not scheduled. ]*/
+        timer->next = NULL;
+        timer->previous = NULL;
+        timer->expiry_tick = 0;
+        timer->callback = NULL;
+        timer->callback_context = NULL;
+    }
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, int, timer_wheel_schedule, TIMER_WHEEL_HANDLE, timer_wheel, TIMER_WHEEL_TIMER*, timer, uint32_t, delay_ms, TIMER_WHEEL_CALLBACK, callback, void*, callback_context)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_TIMER_WHEEL_01_014: [ If timer_wheel is NULL, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+        (timer_wheel == NULL) ||
+        /* Codes_SRS_TIMER_WHEEL_01_015: [ If timer is NULL, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+        (timer == NULL) ||
+        /* Codes_SRS_TIMER_WHEEL_01_016: [ If callback is NULL, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+        (callback == NULL)
+        )
+    {
+        LogError("Invalid arguments: TIMER_WHEEL_HANDLE timer_wheel=%p, TIMER_WHEEL_TIMER* timer=%p, uint32_t delay_ms=%" PRIu32 ", TIMER_WHEEL_CALLBACK callback=%p, void* callback_context=%p",
+            timer_wheel, timer, delay_ms, callback, callback_context);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_TIMER_WHEEL_01_019: [ timer_wheel_schedule shall compute the expiry tick of timer as the current tick (timer_global_get_elapsed_ms) plus delay_ms rounded up to a whole number of ticks, but not earlier than the first tick that was not processed yet. ]*/
+        uint64_t expiry_tick = get_current_tick(timer_wheel) + ((uint64_t)delay_ms + timer_wheel->tick_ms - 1) / timer_wheel->tick_ms;
+
+        /* Codes_SRS_TIMER_WHEEL_01_017: [ timer_wheel_schedule shall acquire the lock of the wheel by calling srw_lock_acquire_exclusive. ]*/
+        srw_lock_acquire_exclusive(timer_wheel->lock);
+        if (timer->next != NULL)
+        {
+            /* Codes_SRS_TIMER_WHEEL_01_018: [ If timer is already scheduled, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+            LogError("timer=%p is already scheduled to expire at tick %" PRIu64 "", timer, timer->expiry_tick);
+            result = MU_FAILURE;
+        }
+        else if (interlocked_add(&timer_wheel->is_stopping, 0) != 0)
+        {
+            /* Codes_SRS_TIMER_WHEEL_01_034: [ If the wheel is being destroyed, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+            LogError("timer_wheel=%p is being destroyed, cannot schedule timer=%p", timer_wheel, timer);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            if (expiry_tick < timer_wheel->next_tick)
+            {
+                expiry_tick = timer_wheel->next_tick;
+            }
+            timer->expiry_tick = expiry_tick;
+            timer->callback = callback;
+            timer->callback_context = callback_context;
+
+            /* Codes_SRS_TIMER_WHEEL_01_020: [ timer_wheel_schedule shall link timer at the end of the slot for its expiry tick and return 0. ]*/
+            link_timer(timer_wheel, timer);
+
+            result = 0;
+        }
+        /* Codes_SRS_TIMER_WHEEL_01_029: [ timer_wheel_schedule shall release the lock by calling srw_lock_release_exclusive. ]*/
+        srw_lock_release_exclusive(timer_wheel->lock);
+    }
+
+    return result;
+}
+
+IMPLEMENT_MOCKABLE_FUNCTION(, bool, timer_wheel_cancel, TIMER_WHEEL_HANDLE, timer_wheel, TIMER_WHEEL_TIMER*, timer)
+{
+    bool result;
+
+    if (
+        /* Codes_SRS_TIMER_WHEEL_01_021: [ If timer_wheel is NULL, timer_wheel_cancel shall fail and return false. ]*/
+        (timer_wheel == NULL) ||
+        /* Codes_SRS_TIMER_WHEEL_01_022: [ If timer is NULL, timer_wheel_cancel shall fail and return false. ]*/
+        (timer == NULL)
+        )
+    {
+        LogError("Invalid arguments: TIMER_WHEEL_HANDLE timer_wheel=%p, TIMER_WHEEL_TIMER* timer=%p", timer_wheel, timer);
+        result = false;
+    }
+    else
+    {
+        srw_lock_acquire_exclusive(timer_wheel->lock);
+        if (timer->next != NULL)
+        {
+            /* Codes_SRS_TIMER_WHEEL_01_023: [ If timer is scheduled, timer_wheel_cancel shall unlink it under the lock of the wheel and return true. ]*/
+            unlink_timer(timer);
+            result = true;
+        }
+        else
+        {
+            /* Codes_SRS_TIMER_WHEEL_01_024: [ Otherwise (timer expired or was never scheduled) timer_wheel_cancel shall return false. ]*/
+            result = false;
+        }
+        srw_lock_release_exclusive(timer_wheel->lock);
+    }
+
+    return result;
+}
@@ -0,0 +1,512 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "sf_c_util/alloc_stats.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+/* every test uses its own module, the stats are never unregistered */
+static ALLOC_STATS test_stats_malloc = ALLOC_STATS_INITIALIZER(test_module_malloc);
+static ALLOC_STATS test_stats_malloc_fails = ALLOC_STATS_INITIALIZER(test_module_malloc_fails);
+static ALLOC_STATS test_stats_malloc_2 = ALLOC_STATS_INITIALIZER(test_module_malloc_2);
+static ALLOC_STATS test_stats_malloc_flex = ALLOC_STATS_INITIALIZER(test_module_malloc_flex);
+static ALLOC_STATS test_stats_calloc = ALLOC_STATS_INITIALIZER(test_module_calloc);
+static ALLOC_STATS test_stats_realloc = ALLOC_STATS_INITIALIZER(test_module_realloc);
+static ALLOC_STATS test_stats_realloc_2_flex = ALLOC_STATS_INITIALIZER(test_module_realloc_2_flex);
+static ALLOC_STATS test_stats_free = ALLOC_STATS_INITIALIZER(test_module_free);
+static ALLOC_STATS test_stats_many_functions = ALLOC_STATS_INITIALIZER(test_module_many_functions);
+static ALLOC_STATS test_stats_never_used = ALLOC_STATS_INITIALIZER(test_module_never_used);
+static ALLOC_STATS test_stats_totals_1 = ALLOC_STATS_INITIALIZER(test_module_totals);
+static ALLOC_STATS test_stats_totals_2 = ALLOC_STATS_INITIALIZER(test_module_totals);
+
+/* the functions are told apart by the address of their name, as with __func__ */
+static const char test_function_1[] = "test_function_1";
+static const char test_function_2[] = "test_function_2";
+
+typedef struct TEST_SNAPSHOT_CONTEXT_TAG
+{
+    const char* module_name;
+    const char* function_name;
+    uint32_t snapshot_count;
+    uint32_t matched_count;
+    ALLOC_STATS_SNAPSHOT snapshot;
+} TEST_SNAPSHOT_CONTEXT;
+
+static void test_on_snapshot(void* context, const ALLOC_STATS_SNAPSHOT* snapshot)
+{
+    TEST_SNAPSHOT_CONTEXT* test_context = context;
+    test_context->snapshot_count++;
+    if (
+        (strcmp(snapshot->module_name, test_context->module_name) == 0) &&
+        (strcmp(snapshot->function_name, test_context->function_name) == 0)
+        )
+    {
+        test_context->matched_count++;
+        (void)memcpy(&test_context->snapshot, snapshot, sizeof(ALLOC_STATS_SNAPSHOT));
+    }
+}
+
+static void get_snapshot_for(const char* module_name, const char* function_name, TEST_SNAPSHOT_CONTEXT* test_context)
+{
+    (void)memset(test_context, 0, sizeof(TEST_SNAPSHOT_CONTEXT));
+    test_context->module_name = module_name;
+    test_context->function_name = function_name;
+    ASSERT_ARE_EQUAL(int, 0, alloc_stats_snapshot(test_on_snapshot, test_context));
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types(), "umocktypes_stdint_register_types");
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/* alloc_stats_malloc */
+
+/* Tests_SRS_ALLOC_STATS_01_001: [ alloc_stats_malloc shall call gballoc_hl_malloc with size. ]*/
+/* Tests_SRS_ALLOC_STATS_01_002: [ If the allocation succeeds, alloc_stats_malloc shall increment the allocation count of function_name in stats and add size to its allocated bytes. ]*/
+/* Tests_SRS_ALLOC_STATS_01_003: [ alloc_stats_malloc shall return the result of gballoc_hl_malloc. ]*/
+/* Tests_SRS_ALLOC_STATS_01_035: [ If stats was not yet registered, it shall be added without taking any lock to the list of stats reported by alloc_stats_snapshot the first time something is counted in it. ]*/
+/* Tests_SRS_ALLOC_STATS_01_036: [ The counters of function_name shall be the ones of the slot of stats already holding function_name or else of the first free slot, claimed with a compare exchange. ]*/
+TEST_FUNCTION(alloc_stats_malloc_allocates_and_counts_per_function)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    void* ptr_1;
+    void* ptr_2;
+    void* ptr_3;
+
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc(10));
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc(20));
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc(5));
+
+    // act
+    ptr_1 = alloc_stats_malloc(&test_stats_malloc, test_function_1, 10);
+    ptr_2 = alloc_stats_malloc(&test_stats_malloc, test_function_2, 20);
+    ptr_3 = alloc_stats_malloc(&test_stats_malloc, test_function_1, 5);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(ptr_1);
+    ASSERT_IS_NOT_NULL(ptr_2);
+    ASSERT_IS_NOT_NULL(ptr_3);
+    get_snapshot_for("test_module_malloc", "test_function_1", &test_context);
+    ASSERT_ARE_EQUAL(uint32_t, 1, test_context.matched_count);
+    ASSERT_ARE_EQUAL(uint64_t, 2, test_context.snapshot.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 15, test_context.snapshot.allocated_bytes);
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_context.snapshot.reallocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_context.snapshot.free_count);
+    get_snapshot_for("test_module_malloc", "test_function_2", &test_context);
+    ASSERT_ARE_EQUAL(uint32_t, 1, test_context.matched_count);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 20, test_context.snapshot.allocated_bytes);
+
+    // cleanup
+    real_gballoc_hl_free(ptr_1);
+    real_gballoc_hl_free(ptr_2);
+    real_gballoc_hl_free(ptr_3);
+}
+
+/* Tests_SRS_ALLOC_STATS_01_002: [ If the allocation succeeds, alloc_stats_malloc shall increment the allocation count of function_name in stats and add size to its allocated bytes. ]*/
+/* Tests_SRS_ALLOC_STATS_01_003: [ alloc_stats_malloc shall return the result of gballoc_hl_malloc. ]*/
+TEST_FUNCTION(when_gballoc_hl_malloc_fails_alloc_stats_malloc_returns_NULL_and_does_not_count)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    void* ptr;
+
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc(10))
+        .SetReturn(NULL);
+
+    // act
+    ptr = alloc_stats_malloc(&test_stats_malloc_fails, test_function_1, 10);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(ptr);
+    get_snapshot_for("test_module_malloc_fails", "test_function_1", &test_context);
+    ASSERT_ARE_EQUAL(uint32_t, 0, test_context.matched_count);
+}
+
+/* Tests_SRS_ALLOC_STATS_01_034: [ If stats or function_name is NULL, the allocation functions of alloc_stats shall still allocate and free, without counting anything. ]*/
+TEST_FUNCTION(alloc_stats_malloc_and_free_with_NULL_stats_or_function_name_allocate_and_free)
+{
+    // arrange
+    void* ptr_1;
+    void* ptr_2;
+
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc(10));
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc(10));
+    STRICT_EXPECTED_CALL(gballoc_hl_free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(gballoc_hl_free(IGNORED_ARG));
+
+    // act
+    ptr_1 = alloc_stats_malloc(NULL, test_function_1, 10);
+    ptr_2 = alloc_stats_malloc(&test_stats_never_used, NULL, 10);
+    alloc_stats_free(NULL, test_function_1, ptr_1);
+    alloc_stats_free(&test_stats_never_used, NULL, ptr_2);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(ptr_1);
+    ASSERT_IS_NOT_NULL(ptr_2);
+    ASSERT_ARE_EQUAL(int32_t, 0, test_stats_never_used.registration_state);
+}
+
+/* alloc_stats_malloc_2 */
+
+/* Tests_SRS_ALLOC_STATS_01_004: [ alloc_stats_malloc_2 shall call gballoc_hl_malloc_2 with nmemb and size. ]*/
+/* Tests_SRS_ALLOC_STATS_01_005: [ If the allocation succeeds, alloc_stats_malloc_2 shall increment the allocation count of function_name in stats and add nmemb * size to its allocated bytes. ]*/
+/* Tests_SRS_ALLOC_STATS_01_006: [ alloc_stats_malloc_2 shall return the result of gballoc_hl_malloc_2. ]*/
+TEST_FUNCTION(alloc_stats_malloc_2_allocates_and_counts)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    void* ptr;
+
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc_2(3, 8));
+
+    // act
+    ptr = alloc_stats_malloc_2(&test_stats_malloc_2, test_function_1, 3, 8);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(ptr);
+    get_snapshot_for("test_module_malloc_2", "test_function_1", &test_context);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 24, test_context.snapshot.allocated_bytes);
+
+    // cleanup
+    real_gballoc_hl_free(ptr);
+}
+
+/* alloc_stats_malloc_flex */
+
+/* Tests_SRS_ALLOC_STATS_01_007: [ alloc_stats_malloc_flex shall call gballoc_hl_malloc_flex with base, nmemb and size. ]*/
+/* Tests_SRS_ALLOC_STATS_01_008: [ If the allocation succeeds, alloc_stats_malloc_flex shall increment the allocation count of function_name in stats and add base + nmemb * size to its allocated bytes. ]*/
+/* Tests_SRS_ALLOC_STATS_01_009: [ alloc_stats_malloc_flex shall return the result of gballoc_hl_malloc_flex. ]*/
+TEST_FUNCTION(alloc_stats_malloc_flex_allocates_and_counts)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    void* ptr;
+
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc_flex(16, 3, 8));
+
+    // act
+    ptr = alloc_stats_malloc_flex(&test_stats_malloc_flex, test_function_1, 16, 3, 8);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(ptr);
+    get_snapshot_for("test_module_malloc_flex", "test_function_1", &test_context);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 40, test_context.snapshot.allocated_bytes);
+
+    // cleanup
+    real_gballoc_hl_free(ptr);
+}
+
+/* alloc_stats_calloc */
+
+/* Tests_SRS_ALLOC_STATS_01_010: [ alloc_stats_calloc shall call gballoc_hl_calloc with nmemb and size. ]*/
+/* Tests_SRS_ALLOC_STATS_01_011: [ If the allocation succeeds, alloc_stats_calloc shall increment the allocation count of function_name in stats and add nmemb * size to its allocated bytes. ]*/
+/* Tests_SRS_ALLOC_STATS_01_012: [ alloc_stats_calloc shall return the result of gballoc_hl_calloc. ]*/
+TEST_FUNCTION(alloc_stats_calloc_allocates_and_counts)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    void* ptr;
+
+    STRICT_EXPECTED_CALL(gballoc_hl_calloc(4, 4));
+
+    // act
+    ptr = alloc_stats_calloc(&test_stats_calloc, test_function_1, 4, 4);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(ptr);
+    get_snapshot_for("test_module_calloc", "test_function_1", &test_context);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 16, test_context.snapshot.allocated_bytes);
+
+    // cleanup
+    real_gballoc_hl_free(ptr);
+}
+
+/* alloc_stats_realloc */
+
+/* Tests_SRS_ALLOC_STATS_01_013: [ alloc_stats_realloc shall call gballoc_hl_realloc with ptr and size. ]*/
+/* Tests_SRS_ALLOC_STATS_01_014: [ If the reallocation succeeds and ptr is NULL, alloc_stats_realloc shall increment the allocation count of function_name in stats and add size to its allocated bytes. ]*/
+/* Tests_SRS_ALLOC_STATS_01_015: [ If the reallocation succeeds and ptr is not NULL, alloc_stats_realloc shall increment the reallocation count of function_name in stats and add size to its reallocated bytes. ]*/
+/* Tests_SRS_ALLOC_STATS_01_016: [ alloc_stats_realloc shall return the result of gballoc_hl_realloc. ]*/
+TEST_FUNCTION(alloc_stats_realloc_counts_realloc_of_NULL_as_allocation)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    void* ptr;
+
+    STRICT_EXPECTED_CALL(gballoc_hl_realloc(NULL, 10));
+    STRICT_EXPECTED_CALL(gballoc_hl_realloc(IGNORED_ARG, 30));
+
+    // act
+    ptr = alloc_stats_realloc(&test_stats_realloc, test_function_1, NULL, 10);
+    ASSERT_IS_NOT_NULL(ptr);
+    ptr = alloc_stats_realloc(&test_stats_realloc, test_function_1, ptr, 30);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(ptr);
+    get_snapshot_for("test_module_realloc", "test_function_1", &test_context);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 10, test_context.snapshot.allocated_bytes);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.reallocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 30, test_context.snapshot.reallocated_bytes);
+
+    // cleanup
+    real_gballoc_hl_free(ptr);
+}
+
+/* alloc_stats_realloc_2 and alloc_stats_realloc_flex */
+
+/* Tests_SRS_ALLOC_STATS_01_017: [ alloc_stats_realloc_2 shall call gballoc_hl_realloc_2 with ptr, nmemb and size. ]*/
+/* Tests_SRS_ALLOC_STATS_01_018: [ If the reallocation succeeds, alloc_stats_realloc_2 shall record it as alloc_stats_realloc does, with nmemb * size bytes. ]*/
+/* Tests_SRS_ALLOC_STATS_01_019: [ alloc_stats_realloc_2 shall return the result of gballoc_hl_realloc_2. ]*/
+/* Tests_SRS_ALLOC_STATS_01_020: [ alloc_stats_realloc_flex shall call gballoc_hl_realloc_flex with ptr, base, nmemb and size. ]*/
+/* Tests_SRS_ALLOC_STATS_01_021: [ If the reallocation succeeds, alloc_stats_realloc_flex shall record it as alloc_stats_realloc does, with base + nmemb * size bytes. ]*/
+/* Tests_SRS_ALLOC_STATS_01_022: [ alloc_stats_realloc_flex shall return the result of gballoc_hl_realloc_flex. ]*/
+TEST_FUNCTION(alloc_stats_realloc_2_and_realloc_flex_count)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    void* ptr;
+
+    STRICT_EXPECTED_CALL(gballoc_hl_realloc_2(NULL, 2, 8));
+    STRICT_EXPECTED_CALL(gballoc_hl_realloc_flex(IGNORED_ARG, 8, 4, 8));
+
+    // act
+    ptr = alloc_stats_realloc_2(&test_stats_realloc_2_flex, test_function_1, NULL, 2, 8);
+    ASSERT_IS_NOT_NULL(ptr);
+    ptr = alloc_stats_realloc_flex(&test_stats_realloc_2_flex, test_function_1, ptr, 8, 4, 8);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(ptr);
+    get_snapshot_for("test_module_realloc_2_flex", "test_function_1", &test_context);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 16, test_context.snapshot.allocated_bytes);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.reallocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 40, test_context.snapshot.reallocated_bytes);
+
+    // cleanup
+    real_gballoc_hl_free(ptr);
+}
+
+/* alloc_stats_free */
+
+/* Tests_SRS_ALLOC_STATS_01_023: [ If ptr is not NULL, alloc_stats_free shall increment the free count of function_name in stats. ]*/
+/* Tests_SRS_ALLOC_STATS_01_024: [ alloc_stats_free shall call gballoc_hl_free with ptr. ]*/
+TEST_FUNCTION(alloc_stats_free_frees_and_counts_non_NULL_pointers)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    void* ptr = real_gballoc_hl_malloc(10);
+    ASSERT_IS_NOT_NULL(ptr);
+
+    STRICT_EXPECTED_CALL(gballoc_hl_free(ptr));
+    STRICT_EXPECTED_CALL(gballoc_hl_free(NULL));
+
+    // act
+    alloc_stats_free(&test_stats_free, test_function_2, ptr);
+    alloc_stats_free(&test_stats_free, test_function_2, NULL);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    get_snapshot_for("test_module_free", "test_function_2", &test_context);
+    ASSERT_ARE_EQUAL(uint32_t, 1, test_context.matched_count);
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_context.snapshot.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.free_count);
+}
+
+/* Tests_SRS_ALLOC_STATS_01_037: [ If all ALLOC_STATS_FUNCTION_SLOT_COUNT slots are taken by other functions, other_functions shall be used. ]*/
+/* Tests_SRS_ALLOC_STATS_01_028: [ If other_functions of a stats object counted anything, alloc_stats_snapshot shall call on_snapshot with its counters and ALLOC_STATS_OTHER_FUNCTIONS_NAME as function_name. ]*/
+TEST_FUNCTION(alloc_stats_counts_functions_over_the_slot_count_as_other)
+{
+    // arrange
+    static char function_names[ALLOC_STATS_FUNCTION_SLOT_COUNT + 2][32];
+    TEST_SNAPSHOT_CONTEXT test_context;
+    uint32_t i;
+
+    for (i = 0; i < ALLOC_STATS_FUNCTION_SLOT_COUNT + 2; i++)
+    {
+        (void)snprintf(function_names[i], sizeof(function_names[i]), "function_%" PRIu32 "", i);
+        STRICT_EXPECTED_CALL(gballoc_hl_free(IGNORED_ARG));
+    }
+
+    // act
+    for (i = 0; i < ALLOC_STATS_FUNCTION_SLOT_COUNT + 2; i++)
+    {
+        alloc_stats_free(&test_stats_many_functions, function_names[i], real_gballoc_hl_malloc(1));
+    }
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    get_snapshot_for("test_module_many_functions", "function_0", &test_context);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.free_count);
+    get_snapshot_for("test_module_many_functions", ALLOC_STATS_OTHER_FUNCTIONS_NAME, &test_context);
+    ASSERT_ARE_EQUAL(uint32_t, 1, test_context.matched_count);
+    ASSERT_ARE_EQUAL(uint64_t, 2, test_context.snapshot.free_count);
+}
+
+/* alloc_stats_snapshot */
+
+/* Tests_SRS_ALLOC_STATS_01_025: [ If on_snapshot is NULL, alloc_stats_snapshot shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(alloc_stats_snapshot_with_NULL_on_snapshot_fails)
+{
+    // arrange
+    int result;
+
+    // act
+    result = alloc_stats_snapshot(NULL, (void*)0x4242);
+
+    // assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_ALLOC_STATS_01_026: [ on_snapshot_context shall be allowed to be NULL. ]*/
+/* Tests_SRS_ALLOC_STATS_01_027: [ For each function of each registered stats object, alloc_stats_snapshot shall fill an ALLOC_STATS_SNAPSHOT with the counters read at the time of the call and call on_snapshot with it. ]*/
+/* Tests_SRS_ALLOC_STATS_01_029: [ On success alloc_stats_snapshot shall return 0. ]*/
+TEST_FUNCTION(alloc_stats_snapshot_does_not_report_stats_that_were_never_used)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+
+    // act
+    get_snapshot_for("test_module_never_used", "test_function_1", &test_context);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint32_t, 0, test_context.matched_count);
+    ASSERT_ARE_EQUAL(int32_t, 0, test_stats_never_used.registration_state);
+}
+
+/* alloc_stats_get_totals */
+
+/* Tests_SRS_ALLOC_STATS_01_030: [ If totals is NULL, alloc_stats_get_totals shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(alloc_stats_get_totals_with_NULL_totals_fails)
+{
+    // arrange
+    int result;
+
+    // act
+    result = alloc_stats_get_totals("test_module_totals", NULL, NULL);
+
+    // assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_ALLOC_STATS_01_031: [ module_name and function_name shall be allowed to be NULL. ]*/
+/* Tests_SRS_ALLOC_STATS_01_032: [ alloc_stats_get_totals shall set totals to the sum of the counters of all the snapshots whose module_name and function_name are equal to module_name and function_name, a NULL module_name or function_name matching any value. ]*/
+/* Tests_SRS_ALLOC_STATS_01_033: [ On success alloc_stats_get_totals shall return 0. ]*/
+TEST_FUNCTION(alloc_stats_get_totals_sums_the_matching_functions_of_all_stats_with_the_module_name)
+{
+    // arrange
+    ALLOC_STATS_SNAPSHOT all_before;
+    ALLOC_STATS_SNAPSHOT all_after;
+    ALLOC_STATS_SNAPSHOT module_totals;
+    ALLOC_STATS_SNAPSHOT function_totals;
+    ALLOC_STATS_SNAPSHOT unknown_totals;
+    void* ptr_1;
+    void* ptr_2;
+    void* ptr_3;
+
+    ASSERT_ARE_EQUAL(int, 0, alloc_stats_get_totals(NULL, NULL, &all_before));
+
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc(1));
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc(2));
+    STRICT_EXPECTED_CALL(gballoc_hl_malloc(4));
+    ptr_1 = alloc_stats_malloc(&test_stats_totals_1, test_function_1, 1);
+    ptr_2 = alloc_stats_malloc(&test_stats_totals_1, test_function_2, 2);
+    ptr_3 = alloc_stats_malloc(&test_stats_totals_2, test_function_1, 4);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // act
+    int result_1 = alloc_stats_get_totals("test_module_totals", NULL, &module_totals);
+    int result_2 = alloc_stats_get_totals("test_module_totals", "test_function_1", &function_totals);
+    int result_3 = alloc_stats_get_totals("test_module_unknown", NULL, &unknown_totals);
+    int result_4 = alloc_stats_get_totals(NULL, NULL, &all_after);
+
+    // assert
+    ASSERT_ARE_EQUAL(int, 0, result_1);
+    ASSERT_ARE_EQUAL(uint64_t, 3, module_totals.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 7, module_totals.allocated_bytes);
+    ASSERT_ARE_EQUAL(int, 0, result_2);
+    ASSERT_ARE_EQUAL(uint64_t, 2, function_totals.allocation_count);
+    ASSERT_ARE_EQUAL(uint64_t, 5, function_totals.allocated_bytes);
+    ASSERT_ARE_EQUAL(int, 0, result_3);
+    ASSERT_ARE_EQUAL(uint64_t, 0, unknown_totals.allocation_count);
+    ASSERT_ARE_EQUAL(int, 0, result_4);
+    ASSERT_ARE_EQUAL(uint64_t, all_before.allocation_count + 3, all_after.allocation_count);
+
+    // cleanup
+    real_gballoc_hl_free(ptr_1);
+    real_gballoc_hl_free(ptr_2);
+    real_gballoc_hl_free(ptr_3);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,268 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+
+#include "fabriccommon.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_c.h"
+#include "umock_c/umocktypes_bool.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+
+#include "sf_c_util/fabric_op_stats.h"
+
+#define GBALLOC_HL_REDIRECT_H
+#include "sf_c_util/fabric_async_op_cb.h"
+#include "com_wrapper/com_wrapper.h"
+#include "sf_c_util/fabric_async_op_cb_com.h"
+#include "../../src/fabric_async_op_cb_com.c"
+#include "test_fabric_async_operation.h"
+#include "test_fabric_async_operation_com.h"
+#include "test_fabric_async_operation_com.c"
+#include "test_async_operation_context.h"
+#include "test_async_operation_context_com.h"
+#include "test_async_operation_context_com.c"
+#undef GBALLOC_HL_REDIRECT_H
+
+#include "c_pal/gballoc_hl_redirect.h"
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+
+#include "test_fabric_async_operation_wrapper.h"
+
+/* the same test operation as fabric_async_op_wrapper_ut, built with SF_C_UTIL_FABRIC_OP_STATS defined. Only the calls to fabric_op_stats are checked here */
+
+#define TEST_START_TIME_US 4242.0
+
+static ITestAsyncOperation* test_async_operation_com;
+static IFabricAsyncOperationContext* test_async_operation_context_com;
+static FABRIC_ASYNC_OP_CB_HANDLE test_fabric_async_op_cb = (FABRIC_ASYNC_OP_CB_HANDLE)0x4242;
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+MOCK_FUNCTION_WITH_CODE(, void, on_test_fabric_operation_complete, void*, context, HRESULT, async_operation_result, int, operation_result)
+MOCK_FUNCTION_END()
+
+static void setup_execute_async_expectations(HRESULT begin_result)
+{
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG)); // context
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_AddRef(test_async_operation_com));
+    STRICT_EXPECTED_CALL(fabric_async_op_cb_create(IGNORED_ARG, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_FABRIC_ASYNC_OP_CB_HANDLE_IFabricAsyncOperationCallback(test_fabric_async_op_cb, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(fabric_op_stats_record_begin(IGNORED_ARG));
+    if (FAILED(begin_result))
+    {
+        STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_test_fabric_async_operation_BeginTestOperation(test_async_operation_com, 42, IGNORED_ARG, IGNORED_ARG))
+            .SetReturn(begin_result);
+    }
+    else
+    {
+        STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_test_fabric_async_operation_BeginTestOperation(test_async_operation_com, 42, IGNORED_ARG, IGNORED_ARG))
+            .CopyOutArgumentBuffer(4, &test_async_operation_context_com, sizeof(test_async_operation_context_com));
+    }
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_c_register_types(), "umocktypes_c_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types(), "umocktypes_bool_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types(), "umocktypes_stdint_register_types");
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_RETURNS(fabric_async_op_cb_create, test_fabric_async_op_cb, NULL);
+    REGISTER_GLOBAL_MOCK_RETURN(fabric_op_stats_record_begin, TEST_START_TIME_US);
+    REGISTER_GLOBAL_MOCK_RETURN(TEST_ASYNC_OPERATION_CONTEXT_HANDLE_IFabricAsyncOperationContext_test_async_operation_context_CompletedSynchronously, TRUE);
+
+    REGISTER_UMOCK_ALIAS_TYPE(USER_INVOKE_CB, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(BOOLEAN, uint8_t);
+    REGISTER_UMOCK_ALIAS_TYPE(HRESULT, long);
+    REGISTER_UMOCK_ALIAS_TYPE(FABRIC_OP_STATS*, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(FABRIC_ASYNC_OP_CB_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(FABRIC_ASYNC_OP_CB_HANDLE_DESTROY_FUNC, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TEST_FABRIC_ASYNC_OPERATION_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TEST_FABRIC_ASYNC_OPERATION_HANDLE_DESTROY_FUNC, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TEST_ASYNC_OPERATION_CONTEXT_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(TEST_ASYNC_OPERATION_CONTEXT_HANDLE_DESTROY_FUNC, void*);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    TEST_FABRIC_ASYNC_OPERATION_HANDLE test_fabric_async_operation = test_fabric_async_operation_create();
+    ASSERT_IS_NOT_NULL(test_fabric_async_operation);
+    test_async_operation_com = COM_WRAPPER_CREATE(TEST_FABRIC_ASYNC_OPERATION_HANDLE, ITestAsyncOperation, test_fabric_async_operation, test_fabric_async_operation_destroy);
+    ASSERT_IS_NOT_NULL(test_async_operation_com);
+
+    TEST_ASYNC_OPERATION_CONTEXT_HANDLE test_async_operation_context = test_async_operation_context_create();
+    ASSERT_IS_NOT_NULL(test_async_operation_context);
+    test_async_operation_context_com = COM_WRAPPER_CREATE(TEST_ASYNC_OPERATION_CONTEXT_HANDLE, IFabricAsyncOperationContext, test_async_operation_context, test_async_operation_context_destroy);
+    ASSERT_IS_NOT_NULL(test_async_operation_context_com);
+
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+    (void)test_async_operation_com->lpVtbl->Release(test_async_operation_com);
+    (void)test_async_operation_context_com->lpVtbl->Release(test_async_operation_context_com);
+}
+
+/* Tests_SRS_FABRIC_ASYNC_OP_WRAPPER_01_032: [ If SF_C_UTIL_FABRIC_OP_STATS is defined, _execute_async shall call fabric_op_stats_record_begin before calling Begin{operation_name} and fabric_op_stats_record_end once the result of the operation is known. ]*/
+TEST_FUNCTION(fabric_async_op_wrapper_execute_async_completed_synchronously_records_a_synchronous_completion)
+{
+    // arrange
+    HRESULT result;
+    int operation_int_result = 43;
+    (void)test_async_operation_context_com->lpVtbl->AddRef(test_async_operation_context_com); // returned in the Begin
+    umock_c_reset_all_calls();
+
+    setup_execute_async_expectations(S_OK);
+    STRICT_EXPECTED_CALL(TEST_ASYNC_OPERATION_CONTEXT_HANDLE_IFabricAsyncOperationContext_test_async_operation_context_CompletedSynchronously(test_async_operation_context_com))
+        .SetReturn(TRUE);
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_test_fabric_async_operation_EndTestOperation(test_async_operation_com, test_async_operation_context_com, IGNORED_ARG))
+        .CopyOutArgumentBuffer(3, &operation_int_result, sizeof(operation_int_result));
+    STRICT_EXPECTED_CALL(fabric_op_stats_record_end(IGNORED_ARG, TEST_START_TIME_US, true, S_OK));
+    STRICT_EXPECTED_CALL(on_test_fabric_operation_complete((void*)0x4242, S_OK, 43));
+    STRICT_EXPECTED_CALL(TEST_ASYNC_OPERATION_CONTEXT_HANDLE_IFabricAsyncOperationContext_Release(test_async_operation_context_com));
+    STRICT_EXPECTED_CALL(FABRIC_ASYNC_OP_CB_HANDLE_IFabricAsyncOperationCallback_Release(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(fabric_async_op_cb_destroy(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_Release(test_async_operation_com));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // context
+
+    // act
+    result = ITestAsyncOperation_TestOperation_execute_async(test_async_operation_com, 42, on_test_fabric_operation_complete, (void*)0x4242);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, result);
+}
+
+/* Tests_SRS_FABRIC_ASYNC_OP_WRAPPER_01_032: [ If SF_C_UTIL_FABRIC_OP_STATS is defined, _execute_async shall call fabric_op_stats_record_begin before calling Begin{operation_name} and fabric_op_stats_record_end once the result of the operation is known. ]*/
+TEST_FUNCTION(fabric_async_op_wrapper_execute_async_records_the_error_of_End_completed_synchronously)
+{
+    // arrange
+    HRESULT result;
+    (void)test_async_operation_context_com->lpVtbl->AddRef(test_async_operation_context_com); // returned in the Begin
+    umock_c_reset_all_calls();
+
+    setup_execute_async_expectations(S_OK);
+    STRICT_EXPECTED_CALL(TEST_ASYNC_OPERATION_CONTEXT_HANDLE_IFabricAsyncOperationContext_test_async_operation_context_CompletedSynchronously(test_async_operation_context_com))
+        .SetReturn(TRUE);
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_test_fabric_async_operation_EndTestOperation(test_async_operation_com, test_async_operation_context_com, IGNORED_ARG))
+        .SetReturn(E_INVALIDARG);
+    STRICT_EXPECTED_CALL(fabric_op_stats_record_end(IGNORED_ARG, TEST_START_TIME_US, true, E_INVALIDARG));
+    STRICT_EXPECTED_CALL(TEST_ASYNC_OPERATION_CONTEXT_HANDLE_IFabricAsyncOperationContext_Release(test_async_operation_context_com));
+    STRICT_EXPECTED_CALL(FABRIC_ASYNC_OP_CB_HANDLE_IFabricAsyncOperationCallback_Release(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(fabric_async_op_cb_destroy(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_Release(test_async_operation_com));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // context
+
+    // act
+    result = ITestAsyncOperation_TestOperation_execute_async(test_async_operation_com, 42, on_test_fabric_operation_complete, (void*)0x4242);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(HRESULT, E_INVALIDARG, result);
+}
+
+/* Tests_SRS_FABRIC_ASYNC_OP_WRAPPER_01_035: [ If SF_C_UTIL_FABRIC_OP_STATS is defined and Begin{operation_name} fails, _execute_async shall call fabric_op_stats_record_begin_failed with the error returned by Begin{operation_name} instead of fabric_op_stats_record_end. ]*/
+TEST_FUNCTION(when_Begin_fails_fabric_async_op_wrapper_execute_async_records_a_Begin_failure_and_no_completion)
+{
+    // arrange
+    HRESULT result;
+
+    setup_execute_async_expectations(E_OUTOFMEMORY);
+    STRICT_EXPECTED_CALL(fabric_op_stats_record_begin_failed(IGNORED_ARG, E_OUTOFMEMORY));
+    STRICT_EXPECTED_CALL(FABRIC_ASYNC_OP_CB_HANDLE_IFabricAsyncOperationCallback_Release(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(fabric_async_op_cb_destroy(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_Release(test_async_operation_com));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // context
+
+    // act
+    result = ITestAsyncOperation_TestOperation_execute_async(test_async_operation_com, 42, on_test_fabric_operation_complete, (void*)0x4242);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(HRESULT, E_OUTOFMEMORY, result);
+}
+
+/* Tests_SRS_FABRIC_ASYNC_OP_WRAPPER_01_033: [ If SF_C_UTIL_FABRIC_OP_STATS is defined, _wrapper_cb shall call fabric_op_stats_record_end with the result of End{operation_name}, marking the operation as completed asynchronously. ]*/
+TEST_FUNCTION(wrapper_cb_when_not_completed_synchronously_records_an_asynchronous_completion)
+{
+    // arrange
+    USER_INVOKE_CB wrapper_cb;
+    void* wrapper_cb_context;
+    int operation_int_result = 44;
+    (void)test_async_operation_context_com->lpVtbl->AddRef(test_async_operation_context_com); // returned in the Begin
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG)); // context
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_AddRef(test_async_operation_com));
+    STRICT_EXPECTED_CALL(fabric_async_op_cb_create(IGNORED_ARG, IGNORED_ARG))
+        .CaptureArgumentValue_user_invoke_cb(&wrapper_cb)
+        .CaptureArgumentValue_user_invoke_cb_context(&wrapper_cb_context);
+    STRICT_EXPECTED_CALL(COM_WRAPPER_TYPE_CREATE_FABRIC_ASYNC_OP_CB_HANDLE_IFabricAsyncOperationCallback(test_fabric_async_op_cb, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(fabric_op_stats_record_begin(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_test_fabric_async_operation_BeginTestOperation(test_async_operation_com, 42, IGNORED_ARG, IGNORED_ARG))
+        .CopyOutArgumentBuffer(4, &test_async_operation_context_com, sizeof(test_async_operation_context_com));
+    STRICT_EXPECTED_CALL(TEST_ASYNC_OPERATION_CONTEXT_HANDLE_IFabricAsyncOperationContext_test_async_operation_context_CompletedSynchronously(test_async_operation_context_com))
+        .SetReturn(FALSE);
+    STRICT_EXPECTED_CALL(TEST_ASYNC_OPERATION_CONTEXT_HANDLE_IFabricAsyncOperationContext_Release(test_async_operation_context_com));
+    STRICT_EXPECTED_CALL(FABRIC_ASYNC_OP_CB_HANDLE_IFabricAsyncOperationCallback_Release(IGNORED_ARG));
+    ASSERT_ARE_EQUAL(HRESULT, S_OK, ITestAsyncOperation_TestOperation_execute_async(test_async_operation_com, 42, on_test_fabric_operation_complete, (void*)0x4242));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(TEST_ASYNC_OPERATION_CONTEXT_HANDLE_IFabricAsyncOperationContext_test_async_operation_context_CompletedSynchronously(test_async_operation_context_com))
+        .SetReturn(FALSE);
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_test_fabric_async_operation_EndTestOperation(test_async_operation_com, test_async_operation_context_com, IGNORED_ARG))
+        .CopyOutArgumentBuffer(3, &operation_int_result, sizeof(operation_int_result));
+    STRICT_EXPECTED_CALL(fabric_op_stats_record_end(IGNORED_ARG, TEST_START_TIME_US, false, S_OK));
+    STRICT_EXPECTED_CALL(on_test_fabric_operation_complete((void*)0x4242, S_OK, 44));
+    STRICT_EXPECTED_CALL(TEST_FABRIC_ASYNC_OPERATION_HANDLE_ITestAsyncOperation_Release(test_async_operation_com));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); // context
+
+    // act
+    wrapper_cb(wrapper_cb_context, test_async_operation_context_com);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -0,0 +1,389 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "windows.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/timer.h"
+
+#undef ENABLE_MOCKS
+
+#include "sf_c_util/fabric_op_stats.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+static FABRIC_OP_STATS test_stats_1 = FABRIC_OP_STATS_INITIALIZER(IFabricTest, Op1, execute);
+static FABRIC_OP_STATS test_stats_2 = FABRIC_OP_STATS_INITIALIZER(IFabricTest, Op2, execute);
+static FABRIC_OP_STATS test_stats_3 = FABRIC_OP_STATS_INITIALIZER(IFabricTest, Op3, execute);
+static FABRIC_OP_STATS test_stats_4 = FABRIC_OP_STATS_INITIALIZER(IFabricTest, Op4, execute_async);
+static FABRIC_OP_STATS test_stats_5 = FABRIC_OP_STATS_INITIALIZER(IFabricTest, Op5, execute_async);
+static FABRIC_OP_STATS test_stats_6 = FABRIC_OP_STATS_INITIALIZER(IFabricTest, Op6, execute_async);
+
+typedef struct TEST_SNAPSHOT_CONTEXT_TAG
+{
+    const char* operation_name;
+    uint32_t snapshot_count;
+    uint32_t matched_count;
+    FABRIC_OP_STATS_SNAPSHOT snapshot;
+} TEST_SNAPSHOT_CONTEXT;
+
+static void test_on_snapshot(void* context, const FABRIC_OP_STATS_SNAPSHOT* snapshot)
+{
+    TEST_SNAPSHOT_CONTEXT* test_context = context;
+    test_context->snapshot_count++;
+    if (strcmp(snapshot->operation_name, test_context->operation_name) == 0)
+    {
+        test_context->matched_count++;
+        (void)memcpy(&test_context->snapshot, snapshot, sizeof(FABRIC_OP_STATS_SNAPSHOT));
+    }
+}
+
+static void get_snapshot_for(const char* operation_name, TEST_SNAPSHOT_CONTEXT* test_context)
+{
+    (void)memset(test_context, 0, sizeof(TEST_SNAPSHOT_CONTEXT));
+    test_context->operation_name = operation_name;
+    ASSERT_ARE_EQUAL(int, 0, fabric_op_stats_snapshot(test_on_snapshot, test_context));
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types(), "umocktypes_stdint_register_types");
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/* fabric_op_stats_record_begin */
+
+/* Tests_SRS_FABRIC_OP_STATS_01_001: [ If stats is NULL, fabric_op_stats_record_begin shall return 0. ]*/
+TEST_FUNCTION(fabric_op_stats_record_begin_with_NULL_stats_returns_0)
+{
+    // arrange
+    double result;
+
+    // act
+    result = fabric_op_stats_record_begin(NULL);
+
+    // assert
+    ASSERT_ARE_EQUAL(double, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_OP_STATS_01_002: [ If stats was not yet registered, fabric_op_stats_record_begin shall add it to the list of stats reported by fabric_op_stats_snapshot without taking any lock. ]*/
+/* Tests_SRS_FABRIC_OP_STATS_01_003: [ fabric_op_stats_record_begin shall increment the call count of stats. ]*/
+/* Tests_SRS_FABRIC_OP_STATS_01_004: [ fabric_op_stats_record_begin shall return the current time in microseconds as obtained from timer_global_get_elapsed_us. ]*/
+TEST_FUNCTION(fabric_op_stats_record_begin_registers_stats_and_counts_calls)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    double result_1;
+    double result_2;
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us())
+        .SetReturn(1000);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us())
+        .SetReturn(2000);
+
+    // act
+    result_1 = fabric_op_stats_record_begin(&test_stats_1);
+    result_2 = fabric_op_stats_record_begin(&test_stats_1);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(double, 1000, result_1);
+    ASSERT_ARE_EQUAL(double, 2000, result_2);
+    get_snapshot_for("Op1", &test_context);
+    ASSERT_ARE_EQUAL(uint32_t, 1, test_context.matched_count);
+    ASSERT_ARE_EQUAL(char_ptr, "IFabricTest", test_context.snapshot.interface_name);
+    ASSERT_ARE_EQUAL(char_ptr, "execute", test_context.snapshot.api_name);
+    ASSERT_ARE_EQUAL(uint64_t, 2, test_context.snapshot.call_count);
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_context.snapshot.completed_synchronously_count);
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_context.snapshot.completed_asynchronously_count);
+    ASSERT_ARE_EQUAL(uint32_t, 0, test_context.snapshot.hresult_count);
+}
+
+/* fabric_op_stats_record_begin_failed */
+
+/* Tests_SRS_FABRIC_OP_STATS_01_019: [ If stats is NULL, fabric_op_stats_record_begin_failed shall return. ]*/
+TEST_FUNCTION(fabric_op_stats_record_begin_failed_with_NULL_stats_returns)
+{
+    // arrange
+
+    // act
+    fabric_op_stats_record_begin_failed(NULL, E_FAIL);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_OP_STATS_01_020: [ fabric_op_stats_record_begin_failed shall increment the Begin failure count of stats. ]*/
+/* Tests_SRS_FABRIC_OP_STATS_01_021: [ fabric_op_stats_record_begin_failed shall increment the count for result the same way as fabric_op_stats_record_end. ]*/
+TEST_FUNCTION(fabric_op_stats_record_begin_failed_records_the_failure_and_no_completion)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    uint32_t i;
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us());
+    (void)fabric_op_stats_record_begin(&test_stats_6);
+    umock_c_reset_all_calls();
+
+    // act
+    fabric_op_stats_record_begin_failed(&test_stats_6, E_OUTOFMEMORY);
+    fabric_op_stats_record_begin_failed(&test_stats_6, E_OUTOFMEMORY);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    get_snapshot_for("Op6", &test_context);
+    ASSERT_ARE_EQUAL(uint32_t, 1, test_context.matched_count);
+    ASSERT_ARE_EQUAL(uint64_t, 2, test_context.snapshot.begin_failed_count);
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_context.snapshot.completed_synchronously_count);
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_context.snapshot.completed_asynchronously_count);
+    ASSERT_ARE_EQUAL(uint32_t, 1, test_context.snapshot.hresult_count);
+    ASSERT_ARE_EQUAL(int32_t, E_OUTOFMEMORY, test_context.snapshot.hresults[0].hresult);
+    ASSERT_ARE_EQUAL(uint64_t, 2, test_context.snapshot.hresults[0].count);
+    for (i = 0; i < FABRIC_OP_STATS_LATENCY_BUCKET_COUNT; i++)
+    {
+        ASSERT_ARE_EQUAL(uint64_t, 0, test_context.snapshot.latency_buckets[i]);
+    }
+}
+
+/* fabric_op_stats_record_end */
+
+/* Tests_SRS_FABRIC_OP_STATS_01_005: [ If stats is NULL, fabric_op_stats_record_end shall return. ]*/
+TEST_FUNCTION(fabric_op_stats_record_end_with_NULL_stats_returns)
+{
+    // arrange
+
+    // act
+    fabric_op_stats_record_end(NULL, 0, true, S_OK);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_OP_STATS_01_006: [ fabric_op_stats_record_end shall compute the latency as the difference between the current time obtained from timer_global_get_elapsed_us and start_time_us, clamping negative values to 0. ]*/
+/* Tests_SRS_FABRIC_OP_STATS_01_007: [ fabric_op_stats_record_end shall increment the latency bucket corresponding to the latency in the stripe selected by the current thread id. ]*/
+/* Tests_SRS_FABRIC_OP_STATS_01_008: [ If completed_synchronously is true, fabric_op_stats_record_end shall increment the synchronous completion count, otherwise it shall increment the asynchronous completion count. ]*/
+/* Tests_SRS_FABRIC_OP_STATS_01_009: [ fabric_op_stats_record_end shall increment the count for result by claiming with a compare exchange either the slot already holding result or the first free slot. ]*/
+TEST_FUNCTION(fabric_op_stats_record_end_records_completion_latency_and_hresult)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    double start_time;
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us())
+        .SetReturn(100);
+    start_time = fabric_op_stats_record_begin(&test_stats_2);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us())
+        .SetReturn(103);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us())
+        .SetReturn(50);
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us())
+        .SetReturn(112);
+
+    // act
+    fabric_op_stats_record_end(&test_stats_2, start_time, true, S_OK);
+    fabric_op_stats_record_end(&test_stats_2, start_time, false, E_FAIL);
+    fabric_op_stats_record_end(&test_stats_2, start_time, false, S_OK);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    get_snapshot_for("Op2", &test_context);
+    ASSERT_ARE_EQUAL(uint32_t, 1, test_context.matched_count);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.completed_synchronously_count);
+    ASSERT_ARE_EQUAL(uint64_t, 2, test_context.snapshot.completed_asynchronously_count);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.latency_buckets[0]); /* clamped */
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.latency_buckets[3]); /* 3us */
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.latency_buckets[10]); /* 12us is in [12, 13] */
+    ASSERT_ARE_EQUAL(uint32_t, 2, test_context.snapshot.hresult_count);
+    ASSERT_ARE_EQUAL(int32_t, S_OK, test_context.snapshot.hresults[0].hresult);
+    ASSERT_ARE_EQUAL(uint64_t, 2, test_context.snapshot.hresults[0].count);
+    ASSERT_ARE_EQUAL(int32_t, E_FAIL, test_context.snapshot.hresults[1].hresult);
+    ASSERT_ARE_EQUAL(uint64_t, 1, test_context.snapshot.hresults[1].count);
+    ASSERT_ARE_EQUAL(uint64_t, 0, test_context.snapshot.other_hresult_count);
+}
+
+/* Tests_SRS_FABRIC_OP_STATS_01_010: [ If all FABRIC_OP_STATS_HRESULT_SLOT_COUNT slots are taken by other values, fabric_op_stats_record_end shall increment other_hresult_count. ]*/
+TEST_FUNCTION(fabric_op_stats_record_end_counts_hresults_over_the_slot_count_as_other)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    uint32_t i;
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us());
+    (void)fabric_op_stats_record_begin(&test_stats_3);
+    umock_c_reset_all_calls();
+
+    for (i = 0; i < FABRIC_OP_STATS_HRESULT_SLOT_COUNT + 2; i++)
+    {
+        STRICT_EXPECTED_CALL(timer_global_get_elapsed_us());
+    }
+
+    // act
+    for (i = 0; i < FABRIC_OP_STATS_HRESULT_SLOT_COUNT + 2; i++)
+    {
+        fabric_op_stats_record_end(&test_stats_3, 0, true, (HRESULT)(0x80070000 + i));
+    }
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    get_snapshot_for("Op3", &test_context);
+    ASSERT_ARE_EQUAL(uint32_t, FABRIC_OP_STATS_HRESULT_SLOT_COUNT, test_context.snapshot.hresult_count);
+    ASSERT_ARE_EQUAL(uint64_t, 2, test_context.snapshot.other_hresult_count);
+}
+
+/* fabric_op_stats_snapshot */
+
+/* Tests_SRS_FABRIC_OP_STATS_01_011: [ If on_snapshot is NULL, fabric_op_stats_snapshot shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(fabric_op_stats_snapshot_with_NULL_on_snapshot_fails)
+{
+    // arrange
+    int result;
+
+    // act
+    result = fabric_op_stats_snapshot(NULL, (void*)0x4242);
+
+    // assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_OP_STATS_01_013: [ For each registered stats object, fabric_op_stats_snapshot shall fill a FABRIC_OP_STATS_SNAPSHOT with the counters read at the time of the call, summing the latency buckets across all stripes, and call on_snapshot with it. ]*/
+/* Tests_SRS_FABRIC_OP_STATS_01_014: [ On success fabric_op_stats_snapshot shall return 0. ]*/
+TEST_FUNCTION(fabric_op_stats_snapshot_does_not_report_stats_that_were_never_used)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+
+    // act
+    get_snapshot_for("Op5", &test_context);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint32_t, 0, test_context.matched_count);
+    ASSERT_ARE_EQUAL(int64_t, 0, test_stats_5.call_count);
+}
+
+/* fabric_op_stats_get_latency_percentile_us */
+
+/* Tests_SRS_FABRIC_OP_STATS_01_015: [ If snapshot is NULL, fabric_op_stats_get_latency_percentile_us shall return 0. ]*/
+TEST_FUNCTION(fabric_op_stats_get_latency_percentile_us_with_NULL_snapshot_returns_0)
+{
+    // arrange
+    uint64_t result;
+
+    // act
+    result = fabric_op_stats_get_latency_percentile_us(NULL, 50);
+
+    // assert
+    ASSERT_ARE_EQUAL(uint64_t, 0, result);
+}
+
+/* Tests_SRS_FABRIC_OP_STATS_01_016: [ If percentile is not in the [0, 100] range, fabric_op_stats_get_latency_percentile_us shall return 0. ]*/
+TEST_FUNCTION(fabric_op_stats_get_latency_percentile_us_with_percentile_out_of_range_returns_0)
+{
+    // arrange
+    FABRIC_OP_STATS_SNAPSHOT snapshot;
+    (void)memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.latency_buckets[5] = 1;
+
+    // act
+    uint64_t result_1 = fabric_op_stats_get_latency_percentile_us(&snapshot, -1);
+    uint64_t result_2 = fabric_op_stats_get_latency_percentile_us(&snapshot, 100.5);
+
+    // assert
+    ASSERT_ARE_EQUAL(uint64_t, 0, result_1);
+    ASSERT_ARE_EQUAL(uint64_t, 0, result_2);
+}
+
+/* Tests_SRS_FABRIC_OP_STATS_01_017: [ If no latency was recorded in snapshot, fabric_op_stats_get_latency_percentile_us shall return 0. ]*/
+TEST_FUNCTION(fabric_op_stats_get_latency_percentile_us_with_empty_histogram_returns_0)
+{
+    // arrange
+    FABRIC_OP_STATS_SNAPSHOT snapshot;
+    (void)memset(&snapshot, 0, sizeof(snapshot));
+
+    // act
+    uint64_t result = fabric_op_stats_get_latency_percentile_us(&snapshot, 99);
+
+    // assert
+    ASSERT_ARE_EQUAL(uint64_t, 0, result);
+}
+
+/* Tests_SRS_FABRIC_OP_STATS_01_018: [ Otherwise fabric_op_stats_get_latency_percentile_us shall return the upper bound in microseconds of the first bucket at which the cumulative count reaches percentile percent of all recorded latencies. ]*/
+TEST_FUNCTION(fabric_op_stats_get_latency_percentile_us_returns_the_bucket_upper_bound)
+{
+    // arrange
+    TEST_SNAPSHOT_CONTEXT test_context;
+    uint32_t i;
+
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us())
+        .SetReturn(0);
+    (void)fabric_op_stats_record_begin(&test_stats_4);
+    for (i = 0; i < 99; i++)
+    {
+        STRICT_EXPECTED_CALL(timer_global_get_elapsed_us())
+            .SetReturn(5);
+    }
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_us())
+        .SetReturn(1000);
+    for (i = 0; i < 100; i++)
+    {
+        fabric_op_stats_record_end(&test_stats_4, 0, false, S_OK);
+    }
+    get_snapshot_for("Op4", &test_context);
+
+    // act
+    uint64_t p50 = fabric_op_stats_get_latency_percentile_us(&test_context.snapshot, 50);
+    uint64_t p99 = fabric_op_stats_get_latency_percentile_us(&test_context.snapshot, 99);
+    uint64_t p100 = fabric_op_stats_get_latency_percentile_us(&test_context.snapshot, 100);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint64_t, 5, p50);
+    ASSERT_ARE_EQUAL(uint64_t, 5, p99);
+    /* 1000us falls in [896, 1023] */
+    ASSERT_ARE_EQUAL(uint64_t, 1023, p100);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
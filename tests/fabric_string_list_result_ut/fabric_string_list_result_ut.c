@@ -0,0 +1,447 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <wchar.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_charptr.h"
+#include "umock_c/umock_c_negative_tests.h"
+#include "c_logging/logger.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+
+#include "sf_c_util/fabric_string_list_result.h"
+
+static const wchar_t* test_strings[] = { L"hagauaga", L"", L"x" };
+#define TEST_N_STRINGS ((ULONG)(sizeof(test_strings) / sizeof(test_strings[0])))
+#define TEST_N_CHARACTERS (9 + 1 + 2) /*with the zero terminators*/
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error));
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(malloc, NULL);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(malloc_flex, NULL);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/* fabric_string_list_result_create */
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_001: [ If strings is NULL, fabric_string_list_result_create shall fail and return NULL. ]*/
+TEST_FUNCTION(fabric_string_list_result_create_with_NULL_strings_fails)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create(TEST_N_STRINGS, NULL);
+
+    // assert
+    ASSERT_IS_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_002: [ If any of the nStrings entries of strings is NULL, fabric_string_list_result_create shall fail and return NULL. ]*/
+TEST_FUNCTION(fabric_string_list_result_create_with_a_NULL_string_fails)
+{
+    // arrange
+    const wchar_t* strings[] = { L"hagauaga", NULL, L"x" };
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create(3, strings);
+
+    // assert
+    ASSERT_IS_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_002: [ If any of the nStrings entries of strings is NULL, fabric_string_list_result_create shall fail and return NULL. ]*/
+TEST_FUNCTION(fabric_string_list_result_create_with_the_last_string_NULL_fails)
+{
+    // arrange
+    const wchar_t* strings[] = { L"hagauaga", L"x", NULL };
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create(3, strings);
+
+    // assert
+    ASSERT_IS_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_003: [ fabric_string_list_result_create shall allocate with one call to malloc_flex the fabric string list result instance, nStrings pointers and the characters of all the strings including their zero terminators. ]*/
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_004: [ fabric_string_list_result_create shall copy the strings one after the other after the pointers and shall set every pointer to the copy of the string with the same index. ]*/
+TEST_FUNCTION(fabric_string_list_result_create_succeeds)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+    ULONG nStrings;
+    const LPCWSTR* strings;
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, TEST_N_CHARACTERS, sizeof(wchar_t)));
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create(TEST_N_STRINGS, test_strings);
+
+    // assert
+    ASSERT_IS_NOT_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int, S_OK, fabric_string_list_result_GetStrings(fabric_string_list_result, &nStrings, &strings));
+    ASSERT_ARE_EQUAL(uint32_t, TEST_N_STRINGS, nStrings);
+    for (ULONG i = 0; i < TEST_N_STRINGS; i++)
+    {
+        ASSERT_ARE_NOT_EQUAL(void_ptr, test_strings[i], strings[i]);
+        ASSERT_ARE_EQUAL(wchar_ptr, test_strings[i], strings[i]);
+    }
+
+    // cleanup
+    fabric_string_list_result_destroy(fabric_string_list_result);
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_003: [ fabric_string_list_result_create shall allocate with one call to malloc_flex the fabric string list result instance, nStrings pointers and the characters of all the strings including their zero terminators. ]*/
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_004: [ fabric_string_list_result_create shall copy the strings one after the other after the pointers and shall set every pointer to the copy of the string with the same index. ]*/
+TEST_FUNCTION(fabric_string_list_result_create_packs_the_pointers_and_the_characters_after_the_result)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result = fabric_string_list_result_create(TEST_N_STRINGS, test_strings);
+    ULONG nStrings;
+    const LPCWSTR* strings;
+    umock_c_reset_all_calls();
+
+    // act
+    HRESULT result = fabric_string_list_result_GetStrings(fabric_string_list_result, &nStrings, &strings);
+
+    // assert
+    ASSERT_ARE_EQUAL(int, S_OK, result);
+    ASSERT_IS_TRUE((const void*)strings > (const void*)fabric_string_list_result);
+    ASSERT_ARE_EQUAL(void_ptr, (void*)(strings + TEST_N_STRINGS), strings[0]);
+    for (ULONG i = 1; i < TEST_N_STRINGS; i++)
+    {
+        ASSERT_ARE_EQUAL(void_ptr, strings[i - 1] + wcslen(test_strings[i - 1]) + 1, strings[i]);
+    }
+
+    // cleanup
+    fabric_string_list_result_destroy(fabric_string_list_result);
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_005: [ If nStrings is 0, fabric_string_list_result_create shall succeed and return a fabric string list result with no strings. ]*/
+TEST_FUNCTION(fabric_string_list_result_create_with_0_strings_succeeds)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+    ULONG nStrings;
+    const LPCWSTR* strings;
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, 0, sizeof(wchar_t)));
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create(0, test_strings);
+
+    // assert
+    ASSERT_IS_NOT_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int, S_OK, fabric_string_list_result_GetStrings(fabric_string_list_result, &nStrings, &strings));
+    ASSERT_ARE_EQUAL(uint32_t, 0, nStrings);
+
+    // cleanup
+    fabric_string_list_result_destroy(fabric_string_list_result);
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_006: [ If any error occurs, fabric_string_list_result_create shall fail and return NULL. ]*/
+TEST_FUNCTION(when_malloc_flex_fails_fabric_string_list_result_create_also_fails)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+
+    STRICT_EXPECTED_CALL(malloc_flex(IGNORED_ARG, TEST_N_CHARACTERS, sizeof(wchar_t)))
+        .SetReturn(NULL);
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create(TEST_N_STRINGS, test_strings);
+
+    // assert
+    ASSERT_IS_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* fabric_string_list_result_create_move */
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_007: [ If strings is NULL and nStrings is greater than 0, fabric_string_list_result_create_move shall fail and return NULL. ]*/
+TEST_FUNCTION(fabric_string_list_result_create_move_with_NULL_strings_fails)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create_move(TEST_N_STRINGS, NULL, NULL);
+
+    // assert
+    ASSERT_IS_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_008: [ fabric_string_list_result_create_move shall allocate a new fabric string list result instance and on success return a non-NULL pointer to it. ]*/
+TEST_FUNCTION(fabric_string_list_result_create_move_with_NULL_strings_and_0_strings_succeeds)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+    ULONG nStrings;
+    const LPCWSTR* strings;
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create_move(0, NULL, NULL);
+
+    // assert
+    ASSERT_IS_NOT_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int, S_OK, fabric_string_list_result_GetStrings(fabric_string_list_result, &nStrings, &strings));
+    ASSERT_ARE_EQUAL(uint32_t, 0, nStrings);
+
+    // cleanup
+    fabric_string_list_result_destroy(fabric_string_list_result);
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_008: [ fabric_string_list_result_create_move shall allocate a new fabric string list result instance and on success return a non-NULL pointer to it. ]*/
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_009: [ fabric_string_list_result_create_move shall not copy strings, it shall store nStrings, strings and buffer. ]*/
+TEST_FUNCTION(fabric_string_list_result_create_move_succeeds_without_copying_the_strings)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+    ULONG nStrings;
+    const LPCWSTR* strings;
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create_move(TEST_N_STRINGS, test_strings, NULL);
+
+    // assert
+    ASSERT_IS_NOT_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int, S_OK, fabric_string_list_result_GetStrings(fabric_string_list_result, &nStrings, &strings));
+    ASSERT_ARE_EQUAL(uint32_t, TEST_N_STRINGS, nStrings);
+    ASSERT_ARE_EQUAL(void_ptr, test_strings, strings);
+
+    // cleanup
+    fabric_string_list_result_destroy(fabric_string_list_result);
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_010: [ If any error occurs, fabric_string_list_result_create_move shall fail, shall not free buffer and shall return NULL. ]*/
+TEST_FUNCTION(when_malloc_fails_fabric_string_list_result_create_move_also_fails_and_does_not_free_buffer)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result;
+    void* buffer = real_gballoc_hl_malloc(1);
+    ASSERT_IS_NOT_NULL(buffer);
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG))
+        .SetReturn(NULL);
+
+    // act
+    fabric_string_list_result = fabric_string_list_result_create_move(TEST_N_STRINGS, test_strings, buffer);
+
+    // assert
+    ASSERT_IS_NULL(fabric_string_list_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    real_gballoc_hl_free(buffer);
+}
+
+/* fabric_string_list_result_destroy */
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_011: [ If fabric_string_list_result is NULL, fabric_string_list_result_destroy shall return. ]*/
+TEST_FUNCTION(fabric_string_list_result_destroy_with_NULL_fabric_string_list_result_returns)
+{
+    // arrange
+
+    // act
+    fabric_string_list_result_destroy(NULL);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_013: [ fabric_string_list_result_destroy shall free the memory associated with the fabric string list result instance. ]*/
+TEST_FUNCTION(fabric_string_list_result_destroy_frees_the_result_of_create)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result = fabric_string_list_result_create(TEST_N_STRINGS, test_strings);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(free(fabric_string_list_result));
+
+    // act
+    fabric_string_list_result_destroy(fabric_string_list_result);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_012: [ If fabric_string_list_result was created by fabric_string_list_result_create_move with a non-NULL buffer, fabric_string_list_result_destroy shall free buffer. ]*/
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_013: [ fabric_string_list_result_destroy shall free the memory associated with the fabric string list result instance. ]*/
+TEST_FUNCTION(fabric_string_list_result_destroy_frees_the_buffer_given_to_create_move)
+{
+    // arrange
+    void* buffer = real_gballoc_hl_malloc(1);
+    ASSERT_IS_NOT_NULL(buffer);
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result = fabric_string_list_result_create_move(TEST_N_STRINGS, test_strings, buffer);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(free(buffer));
+    STRICT_EXPECTED_CALL(free(fabric_string_list_result));
+
+    // act
+    fabric_string_list_result_destroy(fabric_string_list_result);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_013: [ fabric_string_list_result_destroy shall free the memory associated with the fabric string list result instance. ]*/
+TEST_FUNCTION(fabric_string_list_result_destroy_with_NULL_buffer_only_frees_the_result)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result = fabric_string_list_result_create_move(TEST_N_STRINGS, test_strings, NULL);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(free(fabric_string_list_result));
+
+    // act
+    fabric_string_list_result_destroy(fabric_string_list_result);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* fabric_string_list_result_GetStrings */
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_014: [ If fabric_string_list_result is NULL or nStrings is NULL or strings is NULL, fabric_string_list_result_GetStrings shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(fabric_string_list_result_GetStrings_with_NULL_fabric_string_list_result_fails)
+{
+    // arrange
+    ULONG nStrings;
+    const LPCWSTR* strings;
+
+    // act
+    HRESULT result = fabric_string_list_result_GetStrings(NULL, &nStrings, &strings);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int, E_INVALIDARG, result);
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_014: [ If fabric_string_list_result is NULL or nStrings is NULL or strings is NULL, fabric_string_list_result_GetStrings shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(fabric_string_list_result_GetStrings_with_NULL_nStrings_fails)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result = fabric_string_list_result_create(TEST_N_STRINGS, test_strings);
+    const LPCWSTR* strings;
+    umock_c_reset_all_calls();
+
+    // act
+    HRESULT result = fabric_string_list_result_GetStrings(fabric_string_list_result, NULL, &strings);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int, E_INVALIDARG, result);
+
+    // cleanup
+    fabric_string_list_result_destroy(fabric_string_list_result);
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_014: [ If fabric_string_list_result is NULL or nStrings is NULL or strings is NULL, fabric_string_list_result_GetStrings shall fail and return E_INVALIDARG. ]*/
+TEST_FUNCTION(fabric_string_list_result_GetStrings_with_NULL_strings_fails)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result = fabric_string_list_result_create(TEST_N_STRINGS, test_strings);
+    ULONG nStrings;
+    umock_c_reset_all_calls();
+
+    // act
+    HRESULT result = fabric_string_list_result_GetStrings(fabric_string_list_result, &nStrings, NULL);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int, E_INVALIDARG, result);
+
+    // cleanup
+    fabric_string_list_result_destroy(fabric_string_list_result);
+}
+
+/* Tests_SRS_FABRIC_STRING_LIST_RESULT_01_015: [ Otherwise, fabric_string_list_result_GetStrings shall set nStrings to the number of strings, strings to the pointers of the strings and return S_OK. ]*/
+TEST_FUNCTION(fabric_string_list_result_GetStrings_returns_the_strings_twice)
+{
+    // arrange
+    FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result = fabric_string_list_result_create(TEST_N_STRINGS, test_strings);
+    ULONG nStrings_1;
+    const LPCWSTR* strings_1;
+    ULONG nStrings_2;
+    const LPCWSTR* strings_2;
+    umock_c_reset_all_calls();
+
+    // act
+    HRESULT result_1 = fabric_string_list_result_GetStrings(fabric_string_list_result, &nStrings_1, &strings_1);
+    HRESULT result_2 = fabric_string_list_result_GetStrings(fabric_string_list_result, &nStrings_2, &strings_2);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(int, S_OK, result_1);
+    ASSERT_ARE_EQUAL(int, S_OK, result_2);
+    ASSERT_ARE_EQUAL(uint32_t, TEST_N_STRINGS, nStrings_1);
+    ASSERT_ARE_EQUAL(uint32_t, TEST_N_STRINGS, nStrings_2);
+    ASSERT_ARE_EQUAL(void_ptr, strings_1, strings_2);
+
+    // cleanup
+    fabric_string_list_result_destroy(fabric_string_list_result);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
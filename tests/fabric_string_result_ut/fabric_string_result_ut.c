@@ -26,6 +26,11 @@
 
 #include "sf_c_util/fabric_string_result.h"
 
+MOCK_FUNCTION_WITH_CODE(, void, test_free_func, void*, context)
+MOCK_FUNCTION_END()
+
+#define TEST_FREE_FUNC_CONTEXT ((void*)0x4242)
+
 MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
 
 static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
@@ -115,6 +120,58 @@ TEST_FUNCTION(when_malloc_fails_fabric_string_result_create_also_fails)
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 }
 
+/* fabric_string_result_create_with_custom_free */
+
+/* Tests_SRS_FABRIC_STRING_RESULT_01_009: [ If string_result is NULL, fabric_string_result_create_with_custom_free shall fail and return NULL. ]*/
+TEST_FUNCTION(fabric_string_result_create_with_custom_free_with_NULL_string_result_fails)
+{
+    // arrange
+    FABRIC_STRING_RESULT_HANDLE fabric_string_result;
+
+    // act
+    fabric_string_result = fabric_string_result_create_with_custom_free(NULL, test_free_func, TEST_FREE_FUNC_CONTEXT);
+
+    // assert
+    ASSERT_IS_NULL(fabric_string_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_STRING_RESULT_01_010: [ fabric_string_result_create_with_custom_free shall allocate a new fabric string result instance and on success return a non-NULL pointer to it. ]*/
+TEST_FUNCTION(fabric_string_result_create_with_custom_free_succeeds)
+{
+    // arrange
+    FABRIC_STRING_RESULT_HANDLE fabric_string_result;
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+
+    // act
+    fabric_string_result = fabric_string_result_create_with_custom_free(L"hagauaga", test_free_func, TEST_FREE_FUNC_CONTEXT);
+
+    // assert
+    ASSERT_IS_NOT_NULL(fabric_string_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    fabric_string_result_destroy(fabric_string_result);
+}
+
+/* Tests_SRS_FABRIC_STRING_RESULT_01_012: [ If any error occurs, fabric_string_result_create_with_custom_free shall fail and return NULL. ]*/
+TEST_FUNCTION(when_malloc_fails_fabric_string_result_create_with_custom_free_also_fails)
+{
+    // arrange
+    FABRIC_STRING_RESULT_HANDLE fabric_string_result;
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG))
+        .SetReturn(NULL);
+
+    // act
+    fabric_string_result = fabric_string_result_create_with_custom_free(L"hagauaga", test_free_func, TEST_FREE_FUNC_CONTEXT);
+
+    // assert
+    ASSERT_IS_NULL(fabric_string_result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
 /* fabric_string_result_destroy */
 
 /* Tests_SRS_FABRIC_STRING_RESULT_01_004: [ If fabric_string_result is NULL, fabric_string_result_destroy shall return. ]*/
@@ -145,6 +202,39 @@ TEST_FUNCTION(fabric_string_result_destroy_frees_resources)
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 }
 
+/* Tests_SRS_FABRIC_STRING_RESULT_01_013: [ If fabric_string_result was created by fabric_string_result_create_with_custom_free with a non-NULL free_func, fabric_string_result_destroy shall call free_func with free_func_context. ]*/
+TEST_FUNCTION(fabric_string_result_destroy_calls_free_func)
+{
+    // arrange
+    FABRIC_STRING_RESULT_HANDLE fabric_string_result = fabric_string_result_create_with_custom_free(L"hagauaga", test_free_func, TEST_FREE_FUNC_CONTEXT);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(test_free_func(TEST_FREE_FUNC_CONTEXT));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    // act
+    fabric_string_result_destroy(fabric_string_result);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_FABRIC_STRING_RESULT_01_005: [ Otherwise, fabric_string_result_destroy shall free the memory associated with the fabric string result instance. ]*/
+TEST_FUNCTION(fabric_string_result_destroy_with_NULL_free_func_only_frees_resources)
+{
+    // arrange
+    FABRIC_STRING_RESULT_HANDLE fabric_string_result = fabric_string_result_create_with_custom_free(L"hagauaga", NULL, NULL);
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    // act
+    fabric_string_result_destroy(fabric_string_result);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
 /* fabric_string_result_get_String */
 
 /* Tests_SRS_FABRIC_STRING_RESULT_01_006: [ If fabric_string_result is NULL, fabric_string_result_get_String shall fail and return NULL. ]*/
@@ -161,7 +251,7 @@ TEST_FUNCTION(fabric_string_result_get_String_with_NULL_fabric_string_result_fai
     ASSERT_IS_NULL(result);
 }
 
-/* Tests_SRS_FABRIC_STRING_RESULT_01_007: [ Otherwise, fabric_string_result_get_String shall return a pointer to the string copied in fabric_string_result_create. ]*/
+/* Tests_SRS_FABRIC_STRING_RESULT_01_007: [ Otherwise, fabric_string_result_get_String shall return a pointer to the string copied in fabric_string_result_create or to the string_result given to fabric_string_result_create_with_custom_free. ]*/
 /* Tests_SRS_FABRIC_STRING_RESULT_01_002: [ fabric_string_result_create shall copy the string_result string so it can be returned by get_String. ]*/
 TEST_FUNCTION(fabric_string_result_get_String_returns_the_string_passed_to_create)
 {
@@ -181,7 +271,7 @@ TEST_FUNCTION(fabric_string_result_get_String_returns_the_string_passed_to_creat
     fabric_string_result_destroy(fabric_string_result);
 }
 
-/* Tests_SRS_FABRIC_STRING_RESULT_01_007: [ Otherwise, fabric_string_result_get_String shall return a pointer to the string copied in fabric_string_result_create. ]*/
+/* Tests_SRS_FABRIC_STRING_RESULT_01_007: [ Otherwise, fabric_string_result_get_String shall return a pointer to the string copied in fabric_string_result_create or to the string_result given to fabric_string_result_create_with_custom_free. ]*/
 /* Tests_SRS_FABRIC_STRING_RESULT_01_002: [ fabric_string_result_create shall copy the string_result string so it can be returned by get_String. ]*/
 TEST_FUNCTION(fabric_string_result_get_String_returns_empty_string)
 {
@@ -201,7 +291,7 @@ TEST_FUNCTION(fabric_string_result_get_String_returns_empty_string)
     fabric_string_result_destroy(fabric_string_result);
 }
 
-/* Tests_SRS_FABRIC_STRING_RESULT_01_007: [ Otherwise, fabric_string_result_get_String shall return a pointer to the string copied in fabric_string_result_create. ]*/
+/* Tests_SRS_FABRIC_STRING_RESULT_01_007: [ Otherwise, fabric_string_result_get_String shall return a pointer to the string copied in fabric_string_result_create or to the string_result given to fabric_string_result_create_with_custom_free. ]*/
 /* Tests_SRS_FABRIC_STRING_RESULT_01_002: [ fabric_string_result_create shall copy the string_result string so it can be returned by get_String. ]*/
 TEST_FUNCTION(fabric_string_result_get_String_returns_the_string_twice)
 {
@@ -224,4 +314,25 @@ TEST_FUNCTION(fabric_string_result_get_String_returns_the_string_twice)
     fabric_string_result_destroy(fabric_string_result);
 }
 
+/* Tests_SRS_FABRIC_STRING_RESULT_01_007: [ Otherwise, fabric_string_result_get_String shall return a pointer to the string copied in fabric_string_result_create or to the string_result given to fabric_string_result_create_with_custom_free. ]*/
+/* Tests_SRS_FABRIC_STRING_RESULT_01_011: [ fabric_string_result_create_with_custom_free shall not copy string_result, it shall store string_result, free_func and free_func_context. ]*/
+TEST_FUNCTION(fabric_string_result_get_String_returns_the_string_passed_to_create_with_custom_free_without_copying_it)
+{
+    // arrange
+    const wchar_t* string_result = L"hagauaga";
+    FABRIC_STRING_RESULT_HANDLE fabric_string_result = fabric_string_result_create_with_custom_free(string_result, test_free_func, TEST_FREE_FUNC_CONTEXT);
+    LPCWSTR result;
+    umock_c_reset_all_calls();
+
+    // act
+    result = fabric_string_result_get_String(fabric_string_result);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(void_ptr, string_result, result);
+
+    // cleanup
+    fabric_string_result_destroy(fabric_string_result);
+}
+
 END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
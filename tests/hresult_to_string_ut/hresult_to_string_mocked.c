@@ -15,13 +15,6 @@ extern BOOL WINAPI mocked_K32EnumProcessModules(
     LPDWORD lpcbNeeded
 );
 
-#define GetModuleFileNameA mocked_GetModuleFileNameA
-extern DWORD WINAPI mocked_GetModuleFileNameA(
-    HMODULE hModule,
-    LPSTR  lpFilename,
-    DWORD   nSize
-);
-
 #define FormatMessageA mocked_FormatMessageA
 extern DWORD WINAPI mocked_FormatMessageA(
     DWORD   dwFlags,
@@ -44,4 +37,53 @@ extern DWORD WINAPI mocked_FormatMessageW(
     va_list *Arguments
 );
 
+#define FindResourceW mocked_FindResourceW
+extern HRSRC WINAPI mocked_FindResourceW(
+    HMODULE hModule,
+    LPCWSTR lpName,
+    LPCWSTR lpType
+);
+
+#define LoadResource mocked_LoadResource
+extern HGLOBAL WINAPI mocked_LoadResource(
+    HMODULE hModule,
+    HRSRC   hResInfo
+);
+
+#define LockResource mocked_LockResource
+extern LPVOID WINAPI mocked_LockResource(
+    HGLOBAL hResData
+);
+
+#define SizeofResource mocked_SizeofResource
+extern DWORD WINAPI mocked_SizeofResource(
+    HMODULE hModule,
+    HRSRC   hResInfo
+);
+
 #include "../../src/hresult_to_string.c"
+
+/*the index of the message tables lives for the whole process, tests start without one*/
+void hresult_to_string_ut_reset_message_module_index(void)
+{
+    if (message_module_index.ranges != NULL)
+    {
+        free(message_module_index.ranges);
+    }
+    message_module_index.ranges = NULL;
+    message_module_index.range_count = 0;
+    message_module_index.module_count = 0;
+    message_module_index.is_built = false;
+}
+
+/*the interned strings live for the whole process, tests start without any*/
+void hresult_to_string_ut_reset_interned_strings(void)
+{
+    (void)memset(interned_slots, 0, sizeof(interned_slots));
+    (void)interlocked_exchange(&interned_arena_used, 0);
+}
+
+void hresult_to_string_ut_use_up_interned_arena(void)
+{
+    (void)interlocked_exchange(&interned_arena_used, INTERNED_ARENA_SIZE);
+}
@@ -50,10 +50,24 @@ MOCKABLE_FUNCTION(, BOOL, mocked_K32EnumProcessModules,
     LPDWORD  ,lpcbNeeded
 );
 
-MOCKABLE_FUNCTION(, DWORD, mocked_GetModuleFileNameA,
-    HMODULE ,hModule,
-    LPSTR   ,lpFilename,
-    DWORD   ,nSize
+MOCKABLE_FUNCTION(, HRSRC, mocked_FindResourceW,
+    HMODULE, hModule,
+    LPCWSTR, lpName,
+    LPCWSTR, lpType
+);
+
+MOCKABLE_FUNCTION(, HGLOBAL, mocked_LoadResource,
+    HMODULE, hModule,
+    HRSRC, hResInfo
+);
+
+MOCKABLE_FUNCTION(, LPVOID, mocked_LockResource,
+    HGLOBAL, hResData
+);
+
+MOCKABLE_FUNCTION(, DWORD, mocked_SizeofResource,
+    HMODULE, hModule,
+    HRSRC, hResInfo
 );
 #undef ENABLE_MOCKS
 
@@ -63,6 +77,11 @@ MOCKABLE_FUNCTION(, DWORD, mocked_GetModuleFileNameA,
 
 #include "sf_c_util/hresult_to_string.h"
 
+/*in hresult_to_string_mocked.c*/
+void hresult_to_string_ut_reset_message_module_index(void);
+void hresult_to_string_ut_reset_interned_strings(void);
+void hresult_to_string_ut_use_up_interned_arena(void);
+
 MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
 
 static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
@@ -90,6 +109,84 @@ static const HRESULT TEST_HRESULT_WINHTTP = MAKE_HRESULT(1, FACILITY_WIN32, 1202
 static const char* TEST_HRESULT_WINHTTP_STRING = TEST_HRESULT_WINHTTP_STRING_DEFINE;
 static const wchar_t* TEST_HRESULT_WINHTTP_WSTRING = TEST_HRESULT_WINHTTP_WSTRING_DEFINE;
 
+#define TEST_MESSAGE_TABLE_RESOURCE ((HRSRC)0x22)
+#define TEST_MESSAGE_TABLE_LOADED ((HGLOBAL)0x33)
+
+/*the message table of a module that has the messages of the WinHttp errors*/
+static const MESSAGE_RESOURCE_DATA test_message_table = { 1, { { (DWORD)MAKE_HRESULT(1, FACILITY_WIN32, 12000), (DWORD)MAKE_HRESULT(1, FACILITY_WIN32, 12200), 0 } } };
+
+/*a message table with a smaller block that also has the messages of the WinHttp errors*/
+static const MESSAGE_RESOURCE_DATA test_narrow_message_table = { 1, { { (DWORD)MAKE_HRESULT(1, FACILITY_WIN32, 12020), (DWORD)MAKE_HRESULT(1, FACILITY_WIN32, 12040), 0 } } };
+
+/*a message table that does not have the messages of the WinHttp errors*/
+static const MESSAGE_RESOURCE_DATA test_other_message_table = { 1, { { (DWORD)MAKE_HRESULT(1, FACILITY_WIN32, 1), (DWORD)MAKE_HRESULT(1, FACILITY_WIN32, 100), 0 } } };
+
+static void expect_not_from_system(HRESULT hr)
+{
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        IGNORED_ARG,
+        NULL))
+        .SetReturn(0); /*0 means "system doesn't have it"*/
+}
+
+static void expect_get_module_count(DWORD module_count)
+{
+    DWORD module_bytes = module_count * sizeof(HMODULE);
+    STRICT_EXPECTED_CALL(mocked_GetCurrentProcess());
+    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, 0, IGNORED_ARG))
+        .CopyOutArgumentBuffer_lpcbNeeded(&module_bytes, sizeof(module_bytes))
+        .SetReturn(TRUE);
+}
+
+static void expect_message_table(HMODULE hmodule, const MESSAGE_RESOURCE_DATA* table)
+{
+    if (table == NULL)
+    {
+        STRICT_EXPECTED_CALL(mocked_FindResourceW(hmodule, MAKEINTRESOURCEW(1), MAKEINTRESOURCEW(11)))
+            .SetReturn(NULL);
+    }
+    else
+    {
+        STRICT_EXPECTED_CALL(mocked_FindResourceW(hmodule, MAKEINTRESOURCEW(1), MAKEINTRESOURCEW(11)))
+            .SetReturn(TEST_MESSAGE_TABLE_RESOURCE);
+        STRICT_EXPECTED_CALL(mocked_LoadResource(hmodule, TEST_MESSAGE_TABLE_RESOURCE))
+            .SetReturn(TEST_MESSAGE_TABLE_LOADED);
+        STRICT_EXPECTED_CALL(mocked_LockResource(TEST_MESSAGE_TABLE_LOADED))
+            .SetReturn((LPVOID)table);
+        STRICT_EXPECTED_CALL(mocked_SizeofResource(hmodule, TEST_MESSAGE_TABLE_RESOURCE))
+            .SetReturn(sizeof(MESSAGE_RESOURCE_DATA));
+        STRICT_EXPECTED_CALL(realloc_2(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+    }
+}
+
+/*the first time a module is needed (and every time the number of modules changes) the index of their message tables is built*/
+static void expect_build_message_module_index(HMODULE* hmodules, const MESSAGE_RESOURCE_DATA** tables, DWORD module_count)
+{
+    DWORD module_bytes = module_count * sizeof(HMODULE);
+    DWORD i;
+    STRICT_EXPECTED_CALL(malloc_2(module_count, sizeof(HMODULE)));
+    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, module_bytes, IGNORED_ARG))
+        .CopyOutArgumentBuffer_lphModule(hmodules, module_bytes)
+        .CopyOutArgumentBuffer_lpcbNeeded(&module_bytes, sizeof(module_bytes))
+        .SetReturn(TRUE);
+    for (i = 0; i < module_count; i++)
+    {
+        expect_message_table(hmodules[i], tables[i]);
+    }
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); /*the modules*/
+}
+
+static void expect_format_from_one_module(HMODULE hmodule, const MESSAGE_RESOURCE_DATA* table)
+{
+    expect_get_module_count(1);
+    expect_build_message_module_index(&hmodule, &table, 1);
+}
 
 BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
 
@@ -116,6 +213,10 @@ TEST_SUITE_INITIALIZE(suite_init)
     REGISTER_UMOCK_ALIAS_TYPE(LPCSTR, const char*);
     REGISTER_UMOCK_ALIAS_TYPE(LPWSTR, wchar_t*);
     REGISTER_UMOCK_ALIAS_TYPE(BOOL, int);
+    REGISTER_UMOCK_ALIAS_TYPE(LPCWSTR, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(LPVOID, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(HRSRC, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(HGLOBAL, void*);
 
     REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
 }
@@ -129,6 +230,8 @@ TEST_SUITE_CLEANUP(suite_cleanup)
 
 TEST_FUNCTION_INITIALIZE(method_init)
 {
+    hresult_to_string_ut_reset_message_module_index();
+    hresult_to_string_ut_reset_interned_strings();
     umock_c_reset_all_calls();
 }
 
@@ -235,7 +338,6 @@ TEST_FUNCTION(hresult_to_string_succeeds_from_module_succeeds)
 {
     ///arrange
     HMODULE hmodule = (HMODULE)0x11;
-    DWORD size = sizeof(hmodule);
 
     STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(mocked_FormatMessageA(
@@ -250,14 +352,7 @@ TEST_FUNCTION(hresult_to_string_succeeds_from_module_succeeds)
 
     /*here a "for" loop over SF codes happens*/
 
-    STRICT_EXPECTED_CALL(mocked_GetCurrentProcess());
-    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
-        .CopyOutArgumentBuffer_lphModule(&hmodule, sizeof(hmodule))
-        .CopyOutArgumentBuffer_lpcbNeeded(&size, sizeof(size))
-        .SetReturn(TRUE);
-
-    STRICT_EXPECTED_CALL(mocked_GetModuleFileNameA(hmodule, IGNORED_ARG, MAX_PATH))
-        .SetReturn(1);
+    expect_format_from_one_module(hmodule, &test_message_table);
     STRICT_EXPECTED_CALL(mocked_FormatMessageA(
         FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
         hmodule, /*"some module"*/
@@ -285,7 +380,6 @@ TEST_FUNCTION(hresult_to_string_succeeds_from_module_returns_NULL_no_module_can_
 {
     ///arrange
     HMODULE hmodule = (HMODULE)0x11;
-    DWORD size = sizeof(hmodule);
 
     STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(mocked_FormatMessageA(
@@ -300,14 +394,7 @@ TEST_FUNCTION(hresult_to_string_succeeds_from_module_returns_NULL_no_module_can_
 
     /*here a "for" loop over SF codes happens*/
 
-    STRICT_EXPECTED_CALL(mocked_GetCurrentProcess());
-    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
-        .CopyOutArgumentBuffer_lphModule(&hmodule, sizeof(hmodule))
-        .CopyOutArgumentBuffer_lpcbNeeded(&size, sizeof(size))
-        .SetReturn(TRUE);
-
-    STRICT_EXPECTED_CALL(mocked_GetModuleFileNameA(hmodule, IGNORED_ARG, MAX_PATH))
-        .SetReturn(1);
+    expect_format_from_one_module(hmodule, &test_message_table);
     STRICT_EXPECTED_CALL(mocked_FormatMessageA(
         FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
         hmodule, /*"some module"*/
@@ -332,12 +419,9 @@ TEST_FUNCTION(hresult_to_string_succeeds_from_module_returns_NULL_no_module_can_
 }
 
 /*Tests_SRS_HRESULT_TO_STRING_02_008: [ If there are any failures then hresult_to_string shall return NULL. ]*/
-TEST_FUNCTION(hresult_to_string_succeeds_from_module_returns_when_GetModuleFileName_fails)
+TEST_FUNCTION(hresult_to_string_succeeds_from_module_returns_when_building_the_index_fails)
 {
     ///arrange
-    HMODULE hmodule = (HMODULE)0x11;
-    DWORD size = sizeof(hmodule);
-
     STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(mocked_FormatMessageA(
         FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
@@ -351,14 +435,9 @@ TEST_FUNCTION(hresult_to_string_succeeds_from_module_returns_when_GetModuleFileN
 
     /*here a "for" loop over SF codes happens*/
 
-    STRICT_EXPECTED_CALL(mocked_GetCurrentProcess());
-    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
-        .CopyOutArgumentBuffer_lphModule(&hmodule, sizeof(hmodule))
-        .CopyOutArgumentBuffer_lpcbNeeded(&size, sizeof(size))
-        .SetReturn(TRUE);
-
-    STRICT_EXPECTED_CALL(mocked_GetModuleFileNameA(hmodule, IGNORED_ARG, MAX_PATH))
-        .SetReturn(0); /*fails*/
+    expect_get_module_count(1);
+    STRICT_EXPECTED_CALL(malloc_2(1, sizeof(HMODULE)))
+        .SetReturn(NULL);
 
     STRICT_EXPECTED_CALL(free(IGNORED_ARG));
 
@@ -487,7 +566,6 @@ TEST_FUNCTION(hresult_to_wstring_succeeds_from_module_succeeds)
 {
     ///arrange
     HMODULE hmodule = (HMODULE)0x11;
-    DWORD size = sizeof(hmodule);
 
     STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(mocked_FormatMessageW(
@@ -502,14 +580,7 @@ TEST_FUNCTION(hresult_to_wstring_succeeds_from_module_succeeds)
 
     /*here a "for" loop over SF codes happens*/
 
-    STRICT_EXPECTED_CALL(mocked_GetCurrentProcess());
-    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
-        .CopyOutArgumentBuffer_lphModule(&hmodule, sizeof(hmodule))
-        .CopyOutArgumentBuffer_lpcbNeeded(&size, sizeof(size))
-        .SetReturn(TRUE);
-
-    STRICT_EXPECTED_CALL(mocked_GetModuleFileNameA(hmodule, IGNORED_ARG, MAX_PATH))
-        .SetReturn(1);
+    expect_format_from_one_module(hmodule, &test_message_table);
     STRICT_EXPECTED_CALL(mocked_FormatMessageW(
         FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
         hmodule, /*"some module"*/
@@ -537,7 +608,6 @@ TEST_FUNCTION(hresult_to_wstring_succeeds_from_module_returns_NULL_no_module_can
 {
     ///arrange
     HMODULE hmodule = (HMODULE)0x11;
-    DWORD size = sizeof(hmodule);
 
     STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(mocked_FormatMessageW(
@@ -552,14 +622,7 @@ TEST_FUNCTION(hresult_to_wstring_succeeds_from_module_returns_NULL_no_module_can
 
     /*here a "for" loop over SF codes happens*/
 
-    STRICT_EXPECTED_CALL(mocked_GetCurrentProcess());
-    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
-        .CopyOutArgumentBuffer_lphModule(&hmodule, sizeof(hmodule))
-        .CopyOutArgumentBuffer_lpcbNeeded(&size, sizeof(size))
-        .SetReturn(TRUE);
-
-    STRICT_EXPECTED_CALL(mocked_GetModuleFileNameA(hmodule, IGNORED_ARG, MAX_PATH))
-        .SetReturn(1);
+    expect_format_from_one_module(hmodule, &test_message_table);
     STRICT_EXPECTED_CALL(mocked_FormatMessageW(
         FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
         hmodule, /*"some module"*/
@@ -584,12 +647,9 @@ TEST_FUNCTION(hresult_to_wstring_succeeds_from_module_returns_NULL_no_module_can
 }
 
 /*Tests_SRS_HRESULT_TO_STRING_02_016: [ If there are any failures then hresult_to_wstring shall return NULL. ]*/
-TEST_FUNCTION(hresult_to_wstring_succeeds_from_module_returns_when_GetModuleFileName_fails)
+TEST_FUNCTION(hresult_to_wstring_succeeds_from_module_returns_when_building_the_index_fails)
 {
     ///arrange
-    HMODULE hmodule = (HMODULE)0x11;
-    DWORD size = sizeof(hmodule);
-
     STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
     STRICT_EXPECTED_CALL(mocked_FormatMessageW(
         FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
@@ -603,14 +663,9 @@ TEST_FUNCTION(hresult_to_wstring_succeeds_from_module_returns_when_GetModuleFile
 
     /*here a "for" loop over SF codes happens*/
 
-    STRICT_EXPECTED_CALL(mocked_GetCurrentProcess());
-    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
-        .CopyOutArgumentBuffer_lphModule(&hmodule, sizeof(hmodule))
-        .CopyOutArgumentBuffer_lpcbNeeded(&size, sizeof(size))
-        .SetReturn(TRUE);
-
-    STRICT_EXPECTED_CALL(mocked_GetModuleFileNameA(hmodule, IGNORED_ARG, MAX_PATH))
-        .SetReturn(0); /*fails*/
+    expect_get_module_count(1);
+    STRICT_EXPECTED_CALL(malloc_2(1, sizeof(HMODULE)))
+        .SetReturn(NULL);
 
     STRICT_EXPECTED_CALL(free(IGNORED_ARG));
 
@@ -663,4 +718,585 @@ TEST_FUNCTION(hresult_to_wstring_succeeds_from_module_returns_when_EnumProcessMo
 }
 
 
+/*the strings kept by hresult_to_string_buffer live as long as the process, so every test below uses an HRESULT that no other test uses*/
+
+/*Tests_SRS_HRESULT_TO_STRING_01_008: [ If buffer is NULL then hresult_to_string_buffer shall fail and return NULL. ]*/
+TEST_FUNCTION(hresult_to_string_buffer_with_buffer_NULL_fails)
+{
+    ///act
+    const char* humanReadable = hresult_to_string_buffer(TEST_HRESULT, NULL, HRESULT_TO_STRING_BUFFER_SIZE);
+
+    ///assert
+    ASSERT_IS_NULL(humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_009: [ If size is 0 then hresult_to_string_buffer shall fail and return NULL. ]*/
+TEST_FUNCTION(hresult_to_string_buffer_with_size_0_fails)
+{
+    ///arrange
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+
+    ///act
+    const char* humanReadable = hresult_to_string_buffer(TEST_HRESULT, buffer, 0);
+
+    ///assert
+    ASSERT_IS_NULL(humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_010: [ hresult_to_string_buffer shall look for hresult in HRESULT_TO_STRING_INTERNED_SLOT_COUNT slots, starting at a slot given by a hash of hresult, without taking any lock. ]*/
+/*Tests_SRS_HRESULT_TO_STRING_01_003: [ If hresult is seen for the first time then hresult_to_string_buffer shall produce its string and keep it. ]*/
+/*Tests_SRS_HRESULT_TO_STRING_01_013: [ hresult_to_string_buffer shall call FormatMessageA with dwFlags set to FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, buffer and size and return buffer if FormatMessageA succeeds. ]*/
+/*Tests_SRS_HRESULT_TO_STRING_01_004: [ hresult_to_string_buffer shall copy the string in static memory of the process, keep it and return it. ]*/
+TEST_FUNCTION(hresult_to_string_buffer_keeps_the_string_from_system_the_first_time)
+{
+    ///arrange
+    HRESULT hr = E_ACCESSDENIED;
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        sizeof(buffer),
+        NULL))
+        .SetReturn(1) /*1 is "success"*/
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    const char* humanReadable = hresult_to_string_buffer(hr, buffer, sizeof(buffer));
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_NOT_EQUAL(void_ptr, buffer, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_011: [ If the string of hresult is kept then hresult_to_string_buffer shall return it. ]*/
+TEST_FUNCTION(hresult_to_string_buffer_returns_the_kept_string_without_calls_the_second_time)
+{
+    ///arrange
+    HRESULT hr = E_OUTOFMEMORY;
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        IGNORED_ARG,
+        NULL))
+        .SetReturn(1) /*1 is "success"*/
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+    const char* first = hresult_to_string_buffer(hr, buffer, sizeof(buffer));
+    ASSERT_IS_NOT_NULL(first);
+    umock_c_reset_all_calls();
+
+    ///act
+    const char* humanReadable = hresult_to_string_buffer(hr, buffer, sizeof(buffer));
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, first, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_014: [ Otherwise, if hresult is a Service Fabric code then hresult_to_string_buffer shall return the string of the code without copying it in buffer. ]*/
+TEST_FUNCTION(hresult_to_string_buffer_returns_the_string_of_a_service_fabric_code)
+{
+    ///arrange
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)TEST_HRESULT_SF,
+        0,
+        IGNORED_ARG,
+        IGNORED_ARG,
+        NULL))
+        .SetReturn(0); /*0 means "system doesn't have it"*/
+
+    ///act
+    const char* humanReadable = hresult_to_string_buffer(TEST_HRESULT_SF, buffer, sizeof(buffer));
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, "FABRIC_E_FIRST_RESERVED_HRESULT", humanReadable);
+    ASSERT_ARE_NOT_EQUAL(void_ptr, buffer, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_015: [ Otherwise hresult_to_string_buffer shall call FormatMessageA with FORMAT_MESSAGE_FROM_HMODULE for the modules loaded by the current process that have hresult in their message table, buffer and size and return buffer if one module can decode hresult. ]*/
+TEST_FUNCTION(hresult_to_string_buffer_keeps_the_string_from_module)
+{
+    ///arrange
+    HRESULT hr = MAKE_HRESULT(1, FACILITY_WIN32, 12031);
+    HMODULE hmodule = (HMODULE)0x11;
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        IGNORED_ARG,
+        NULL))
+        .SetReturn(0); /*0 means "system doesn't have it"*/
+
+    /*here a "for" loop over SF codes happens*/
+
+    expect_format_from_one_module(hmodule, &test_message_table);
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
+        hmodule, /*"some module"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        sizeof(buffer),
+        NULL))
+        .SetReturn(1) /*1 means the module has it!*/
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    const char* humanReadable = hresult_to_string_buffer(hr, buffer, sizeof(buffer));
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_016: [ If no module can decode hresult or if there are any failures then hresult_to_string_buffer shall return NULL. ]*/
+/*Tests_SRS_HRESULT_TO_STRING_01_005: [ If the string of hresult cannot be produced then hresult_to_string_buffer shall give back the claim on the slot of hresult without keeping anything, so that a later call produces the string again. ]*/
+TEST_FUNCTION(hresult_to_string_buffer_produces_the_string_again_after_no_module_could_decode_it)
+{
+    ///arrange
+    HRESULT hr = MAKE_HRESULT(1, FACILITY_WIN32, 12030);
+    HMODULE hmodule = (HMODULE)0x11;
+    DWORD size = 0;
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        IGNORED_ARG,
+        NULL))
+        .SetReturn(0); /*0 means "system doesn't have it"*/
+
+    /*here a "for" loop over SF codes happens*/
+
+    STRICT_EXPECTED_CALL(mocked_GetCurrentProcess());
+    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
+        .CopyOutArgumentBuffer_lpcbNeeded(&size, sizeof(size)) /*the module that has the message is not loaded yet*/
+        .SetReturn(TRUE);
+    ASSERT_IS_NULL(hresult_to_string_buffer(hr, buffer, sizeof(buffer)));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        IGNORED_ARG,
+        NULL))
+        .SetReturn(0); /*0 means "system doesn't have it"*/
+    expect_format_from_one_module(hmodule, &test_message_table); /*now it is loaded*/
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
+        hmodule, /*"some module"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        sizeof(buffer),
+        NULL))
+        .SetReturn(1) /*1 means the module has it!*/
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    const char* humanReadable = hresult_to_string_buffer(hr, buffer, sizeof(buffer));
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(void_ptr, buffer, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+    ASSERT_ARE_EQUAL(void_ptr, humanReadable, hresult_to_string_buffer(hr, buffer, sizeof(buffer))); /*kept*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_005: [ If the string of hresult cannot be produced then hresult_to_string_buffer shall give back the claim on the slot of hresult without keeping anything, so that a later call produces the string again. ]*/
+TEST_FUNCTION(hresult_to_string_buffer_keeps_the_string_after_a_call_with_a_small_buffer)
+{
+    ///arrange
+    HRESULT hr = E_NOINTERFACE;
+    DWORD size = 0;
+    char small_buffer[4];
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        sizeof(small_buffer),
+        NULL))
+        .SetReturn(0); /*the message does not fit*/
+    STRICT_EXPECTED_CALL(mocked_GetCurrentProcess());
+    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG, IGNORED_ARG))
+        .CopyOutArgumentBuffer_lpcbNeeded(&size, sizeof(size)) /*no modules*/
+        .SetReturn(TRUE);
+    ASSERT_IS_NULL(hresult_to_string_buffer(hr, small_buffer, sizeof(small_buffer)));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        sizeof(buffer),
+        NULL))
+        .SetReturn(1) /*1 is "success"*/
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    const char* humanReadable = hresult_to_string_buffer(hr, buffer, sizeof(buffer));
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(void_ptr, buffer, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+    ASSERT_ARE_EQUAL(void_ptr, humanReadable, hresult_to_string_buffer(hr, buffer, sizeof(buffer))); /*kept*/
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_001: [ hresult_to_string_interned shall call hresult_to_string_buffer with a buffer of HRESULT_TO_STRING_BUFFER_SIZE characters on its stack. ]*/
+/*Tests_SRS_HRESULT_TO_STRING_01_002: [ Otherwise hresult_to_string_interned shall return what hresult_to_string_buffer returns. ]*/
+TEST_FUNCTION(hresult_to_string_interned_returns_the_kept_string)
+{
+    ///arrange
+    HRESULT hr = E_POINTER;
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        HRESULT_TO_STRING_BUFFER_SIZE,
+        NULL))
+        .SetReturn(1) /*1 is "success"*/
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    const char* humanReadable = hresult_to_string_interned(hr);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_017: [ If the string of hresult is being produced by another thread or could not be kept then hresult_to_string_buffer shall produce it without keeping it. ]*/
+TEST_FUNCTION(hresult_to_string_buffer_produces_again_a_string_that_could_not_be_kept)
+{
+    ///arrange
+    HRESULT hr = E_UNEXPECTED;
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+    hresult_to_string_ut_use_up_interned_arena();
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        sizeof(buffer),
+        NULL))
+        .SetReturn(1) /*1 is "success"*/
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+    ASSERT_ARE_EQUAL(void_ptr, buffer, hresult_to_string_buffer(hr, buffer, sizeof(buffer)));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        sizeof(buffer),
+        NULL))
+        .SetReturn(1) /*1 is "success"*/
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    const char* humanReadable = hresult_to_string_buffer(hr, buffer, sizeof(buffer));
+
+    ///assert
+    ASSERT_ARE_EQUAL(void_ptr, buffer, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_018: [ If there is no static memory left then hresult_to_string_buffer shall return buffer. ]*/
+/*Tests_SRS_HRESULT_TO_STRING_01_006: [ If hresult_to_string_buffer returns buffer (the string was not kept) then hresult_to_string_interned shall return NULL. ]*/
+TEST_FUNCTION(hresult_to_string_interned_returns_NULL_when_the_string_is_not_kept)
+{
+    ///arrange
+    HRESULT hr = E_HANDLE;
+    hresult_to_string_ut_use_up_interned_arena();
+
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(
+        FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+        NULL, /*NULL is "system"*/
+        (DWORD)hr,
+        0,
+        IGNORED_ARG,
+        HRESULT_TO_STRING_BUFFER_SIZE,
+        NULL))
+        .SetReturn(1) /*1 is "success"*/
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    const char* humanReadable = hresult_to_string_interned(hr);
+
+    ///assert
+    ASSERT_IS_NULL(humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_021: [ The index shall have the blocks of message ids of the message table (FindResourceW, LoadResource, LockResource and SizeofResource) of every module that has one. ]*/
+/*Tests_SRS_HRESULT_TO_STRING_01_022: [ hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall call FormatMessage with FORMAT_MESSAGE_FROM_HMODULE only for the modules whose message table has a block of message ids that contains hresult. ]*/
+TEST_FUNCTION(hresult_to_string_does_not_call_FormatMessageA_for_a_module_without_message_table)
+{
+    ///arrange
+    HMODULE hmodule = (HMODULE)0x11;
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_format_from_one_module(hmodule, NULL);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    char* humanReadable = hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP);
+
+    ///assert
+    ASSERT_IS_NULL(humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_022: [ hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall call FormatMessage with FORMAT_MESSAGE_FROM_HMODULE only for the modules whose message table has a block of message ids that contains hresult. ]*/
+TEST_FUNCTION(hresult_to_string_does_not_call_FormatMessageA_for_a_module_whose_message_table_does_not_have_hresult)
+{
+    ///arrange
+    HMODULE hmodule = (HMODULE)0x11;
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_format_from_one_module(hmodule, &test_other_message_table);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    char* humanReadable = hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP);
+
+    ///assert
+    ASSERT_IS_NULL(humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_021: [ The index shall have the blocks of message ids of the message table (FindResourceW, LoadResource, LockResource and SizeofResource) of every module that has one. ]*/
+TEST_FUNCTION(hresult_to_string_does_not_call_FormatMessageA_for_a_module_whose_message_table_is_too_small)
+{
+    ///arrange
+    HMODULE hmodule = (HMODULE)0x11;
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_get_module_count(1);
+    STRICT_EXPECTED_CALL(malloc_2(1, sizeof(HMODULE)));
+    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, sizeof(HMODULE), IGNORED_ARG))
+        .CopyOutArgumentBuffer_lphModule(&hmodule, sizeof(hmodule))
+        .SetReturn(TRUE);
+    STRICT_EXPECTED_CALL(mocked_FindResourceW(hmodule, MAKEINTRESOURCEW(1), MAKEINTRESOURCEW(11)))
+        .SetReturn(TEST_MESSAGE_TABLE_RESOURCE);
+    STRICT_EXPECTED_CALL(mocked_LoadResource(hmodule, TEST_MESSAGE_TABLE_RESOURCE))
+        .SetReturn(TEST_MESSAGE_TABLE_LOADED);
+    STRICT_EXPECTED_CALL(mocked_LockResource(TEST_MESSAGE_TABLE_LOADED))
+        .SetReturn((LPVOID)&test_message_table);
+    STRICT_EXPECTED_CALL(mocked_SizeofResource(hmodule, TEST_MESSAGE_TABLE_RESOURCE))
+        .SetReturn(sizeof(DWORD)); /*has room for NumberOfBlocks, but not for the block*/
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); /*the modules*/
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    ///act
+    char* humanReadable = hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP);
+
+    ///assert
+    ASSERT_IS_NULL(humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_022: [ hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall call FormatMessage with FORMAT_MESSAGE_FROM_HMODULE only for the modules whose message table has a block of message ids that contains hresult. ]*/
+TEST_FUNCTION(hresult_to_string_calls_FormatMessageA_for_all_the_modules_whose_message_table_has_hresult)
+{
+    ///arrange
+    HMODULE hmodules[3] = { (HMODULE)0x11, (HMODULE)0x12, (HMODULE)0x13 };
+    const MESSAGE_RESOURCE_DATA* tables[3] = { &test_message_table, &test_other_message_table, &test_narrow_message_table };
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_get_module_count(3);
+    expect_build_message_module_index(hmodules, tables, 3);
+    /*the module whose block starts closest to hresult is asked first*/
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, hmodules[2], (DWORD)TEST_HRESULT_WINHTTP, 0, IGNORED_ARG, IGNORED_ARG, NULL))
+        .SetReturn(0);
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, hmodules[0], (DWORD)TEST_HRESULT_WINHTTP, 0, IGNORED_ARG, IGNORED_ARG, NULL))
+        .SetReturn(1)
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    char* humanReadable = hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///cleanup
+    real_gballoc_hl_free(humanReadable);
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_019: [ hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall get the number of modules of the current process by calling EnumProcessModules. ]*/
+/*Tests_SRS_HRESULT_TO_STRING_01_020: [ If the index of the message tables of the modules was not built yet or if the number of modules changed since it was built then hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall build it from all the modules returned by EnumProcessModules. ]*/
+TEST_FUNCTION(hresult_to_string_does_not_build_the_index_again_when_the_number_of_modules_does_not_change)
+{
+    ///arrange
+    HMODULE hmodule = (HMODULE)0x11;
+    char* humanReadable;
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_format_from_one_module(hmodule, &test_message_table);
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, hmodule, (DWORD)TEST_HRESULT_WINHTTP, 0, IGNORED_ARG, IGNORED_ARG, NULL))
+        .SetReturn(0);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    ASSERT_IS_NULL(hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_get_module_count(1);
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, hmodule, (DWORD)TEST_HRESULT_WINHTTP, 0, IGNORED_ARG, IGNORED_ARG, NULL))
+        .SetReturn(1)
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    humanReadable = hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///cleanup
+    real_gballoc_hl_free(humanReadable);
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_020: [ If the index of the message tables of the modules was not built yet or if the number of modules changed since it was built then hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall build it from all the modules returned by EnumProcessModules. ]*/
+TEST_FUNCTION(hresult_to_string_builds_the_index_again_when_the_number_of_modules_changes)
+{
+    ///arrange
+    HMODULE hmodules[2] = { (HMODULE)0x11, (HMODULE)0x12 };
+    const MESSAGE_RESOURCE_DATA* tables[2] = { &test_other_message_table, &test_message_table };
+    DWORD module_bytes = sizeof(hmodules);
+    char* humanReadable;
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_format_from_one_module(hmodules[0], tables[0]);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    ASSERT_IS_NULL(hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP));
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    umock_c_reset_all_calls();
+
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_get_module_count(2); /*a module was loaded*/
+    STRICT_EXPECTED_CALL(malloc_2(2, sizeof(HMODULE)));
+    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, sizeof(hmodules), IGNORED_ARG))
+        .CopyOutArgumentBuffer_lphModule(hmodules, sizeof(hmodules))
+        .CopyOutArgumentBuffer_lpcbNeeded(&module_bytes, sizeof(module_bytes))
+        .SetReturn(TRUE);
+    expect_message_table(hmodules[0], tables[0]);
+    expect_message_table(hmodules[1], tables[1]);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); /*the previous index*/
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG)); /*the modules*/
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, hmodules[1], (DWORD)TEST_HRESULT_WINHTTP, 0, IGNORED_ARG, IGNORED_ARG, NULL))
+        .SetReturn(1)
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    humanReadable = hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///cleanup
+    real_gballoc_hl_free(humanReadable);
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_020: [ If the index of the message tables of the modules was not built yet or if the number of modules changed since it was built then hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall build it from all the modules returned by EnumProcessModules. ]*/
+TEST_FUNCTION(hresult_to_string_enumerates_the_modules_again_when_modules_are_loaded_while_they_are_enumerated)
+{
+    ///arrange
+    HMODULE hmodules[2] = { (HMODULE)0x11, (HMODULE)0x12 };
+    const MESSAGE_RESOURCE_DATA* tables[2] = { NULL, &test_message_table };
+    DWORD module_bytes = sizeof(hmodules);
+    char* humanReadable;
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_get_module_count(1);
+    STRICT_EXPECTED_CALL(malloc_2(1, sizeof(HMODULE)));
+    STRICT_EXPECTED_CALL(mocked_K32EnumProcessModules(IGNORED_ARG, IGNORED_ARG, sizeof(HMODULE), IGNORED_ARG))
+        .CopyOutArgumentBuffer_lphModule(hmodules, sizeof(HMODULE))
+        .CopyOutArgumentBuffer_lpcbNeeded(&module_bytes, sizeof(module_bytes)) /*a module was loaded meanwhile*/
+        .SetReturn(TRUE);
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    expect_build_message_module_index(hmodules, tables, 2);
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, hmodules[1], (DWORD)TEST_HRESULT_WINHTTP, 0, IGNORED_ARG, IGNORED_ARG, NULL))
+        .SetReturn(1)
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    humanReadable = hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///cleanup
+    real_gballoc_hl_free(humanReadable);
+}
+
+/*Tests_SRS_HRESULT_TO_STRING_01_020: [ If the index of the message tables of the modules was not built yet or if the number of modules changed since it was built then hresult_to_string, hresult_to_wstring and hresult_to_string_buffer shall build it from all the modules returned by EnumProcessModules. ]*/
+TEST_FUNCTION(hresult_to_string_finds_the_message_in_the_last_of_more_than_100_modules)
+{
+    ///arrange
+    HMODULE hmodules[150];
+    const MESSAGE_RESOURCE_DATA* tables[150];
+    char* humanReadable;
+    size_t i;
+    for (i = 0; i < 150; i++)
+    {
+        hmodules[i] = (HMODULE)(0x1000 + i);
+        tables[i] = NULL;
+    }
+    tables[149] = &test_message_table;
+
+    expect_not_from_system(TEST_HRESULT_WINHTTP);
+    expect_get_module_count(150);
+    expect_build_message_module_index(hmodules, tables, 150);
+    STRICT_EXPECTED_CALL(mocked_FormatMessageA(FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, hmodules[149], (DWORD)TEST_HRESULT_WINHTTP, 0, IGNORED_ARG, IGNORED_ARG, NULL))
+        .SetReturn(1)
+        .CopyOutArgumentBuffer_lpBuffer(TEST_HRESULT_WINHTTP_STRING, strlen(TEST_HRESULT_WINHTTP_STRING) + 1);
+
+    ///act
+    humanReadable = hresult_to_string(malloc, free, TEST_HRESULT_WINHTTP);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, TEST_HRESULT_WINHTTP_STRING_DEFINE, humanReadable);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    ///cleanup
+    real_gballoc_hl_free(humanReadable);
+}
+
 END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -14,6 +14,7 @@
 #define REGISTER_FABRIC_STRING_LIST_RESULT_GLOBAL_MOCK_HOOK() \
     MU_FOR_EACH_1(R2, \
         fabric_string_list_result_create, \
+        fabric_string_list_result_create_move, \
         fabric_string_list_result_destroy,   \
         fabric_string_list_result_GetStrings \
 )
@@ -22,6 +23,7 @@
 
 
 FABRIC_STRING_LIST_RESULT_HANDLE real_fabric_string_list_result_create(ULONG nStrings, const wchar_t** strings);
+FABRIC_STRING_LIST_RESULT_HANDLE real_fabric_string_list_result_create_move(ULONG nStrings, const wchar_t** strings, void* buffer);
 void real_fabric_string_list_result_destroy(FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result);
 HRESULT real_fabric_string_list_result_GetStrings(FABRIC_STRING_LIST_RESULT_HANDLE fabric_string_list_result, ULONG* nStrings, const LPCWSTR** strings);
 
@@ -2,5 +2,6 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 #define fabric_string_list_result_create            real_fabric_string_list_result_create
+#define fabric_string_list_result_create_move       real_fabric_string_list_result_create_move
 #define fabric_string_list_result_destroy           real_fabric_string_list_result_destroy
 #define fabric_string_list_result_GetStrings        real_fabric_string_list_result_GetStrings
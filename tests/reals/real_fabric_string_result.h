@@ -14,6 +14,7 @@
 #define REGISTER_FABRIC_STRING_RESULT_GLOBAL_MOCK_HOOK() \
     MU_FOR_EACH_1(R2, \
         fabric_string_result_create, \
+        fabric_string_result_create_with_custom_free, \
         fabric_string_result_destroy,   \
         fabric_string_result_get_String \
 )
@@ -22,6 +23,7 @@
 
 
 FABRIC_STRING_RESULT_HANDLE real_fabric_string_result_create(const wchar_t* result_string);
+FABRIC_STRING_RESULT_HANDLE real_fabric_string_result_create_with_custom_free(const wchar_t* string_result, FABRIC_STRING_RESULT_FREE_FUNC free_func, void* free_func_context);
 void real_fabric_string_result_destroy(FABRIC_STRING_RESULT_HANDLE fabric_string_result);
 LPCWSTR real_fabric_string_result_get_String(FABRIC_STRING_RESULT_HANDLE fabric_string_result);
 
@@ -2,5 +2,6 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 #define fabric_string_result_create         real_fabric_string_result_create 
+#define fabric_string_result_create_with_custom_free real_fabric_string_result_create_with_custom_free
 #define fabric_string_result_destroy        real_fabric_string_result_destroy 
 #define fabric_string_result_get_String     real_fabric_string_result_get_String 
@@ -24,6 +24,8 @@
 
     char* real_hresult_to_string(malloc_t the_malloc, free_t the_free, HRESULT hr);
     wchar_t* real_hresult_to_wstring(HRESULT hresult);
+    const char* real_hresult_to_string_buffer(HRESULT hresult, char* buffer, size_t size);
+    const char* real_hresult_to_string_interned(HRESULT hresult);
     void real_same_as_free(void* ptr);
     void* real_same_as_malloc(size_t size);
     
@@ -3,5 +3,7 @@
 
 #define hresult_to_string                                        real_hresult_to_string
 #define hresult_to_wstring                                       real_hresult_to_wstring
+#define hresult_to_string_buffer                                 real_hresult_to_string_buffer
+#define hresult_to_string_interned                               real_hresult_to_string_interned
 #define same_as_malloc                                        real_same_as_malloc
 #define same_as_free                                       real_same_as_free
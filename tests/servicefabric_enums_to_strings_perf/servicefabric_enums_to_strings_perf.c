@@ -0,0 +1,243 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+#include "testrunnerswitcher.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/timer.h"
+
+#include "sf_c_util/servicefabric_enums_to_strings.h"
+
+/*compares the generated lookups with the linear search that the generated code used to do, over the same FABRIC_ERROR_CODE values*/
+
+#define N_ITERATIONS 10000
+
+typedef struct LINEAR_ENUM_AND_STRING_TAG
+{
+    int value;
+    const char* valueAsString;
+} LINEAR_ENUM_AND_STRING;
+
+/*all the FABRIC_ERROR_CODEs in the reserved range, in the order of their values (which is the order in which fabrictypes.h declares them)*/
+static LINEAR_ENUM_AND_STRING fabric_error_codes[FABRIC_E_LAST_RESERVED_HRESULT - FABRIC_E_FIRST_RESERVED_HRESULT + 1];
+static uint32_t fabric_error_code_count;
+
+/*the same names in lower case, as they could be written in a configuration*/
+static char fabric_error_codes_lower_case[FABRIC_E_LAST_RESERVED_HRESULT - FABRIC_E_FIRST_RESERVED_HRESULT + 1][128];
+
+/*HRESULTs that are not FABRIC_ERROR_CODEs, hresult_to_string looks these up too*/
+static const HRESULT not_fabric_error_codes[] = { E_INVALIDARG, E_OUTOFMEMORY, E_POINTER, E_FAIL, S_OK };
+
+static const char* linear_to_string(int value)
+{
+    for (uint32_t i = 0; i < fabric_error_code_count; i++)
+    {
+        if (fabric_error_codes[i].value == value)
+        {
+            return fabric_error_codes[i].valueAsString;
+        }
+    }
+    return "UNKNOWN";
+}
+
+static int linear_from_string(const char* enumAsString, int* destination)
+{
+    for (uint32_t i = 0; i < fabric_error_code_count; i++)
+    {
+        if (strcmp(fabric_error_codes[i].valueAsString, enumAsString) == 0)
+        {
+            *destination = fabric_error_codes[i].value;
+            return 0;
+        }
+    }
+    return MU_FAILURE;
+}
+
+static int linear_from_string_case_insensitive(const char* enumAsString, int* destination)
+{
+    for (uint32_t i = 0; i < fabric_error_code_count; i++)
+    {
+        if (_stricmp(fabric_error_codes[i].valueAsString, enumAsString) == 0)
+        {
+            *destination = fabric_error_codes[i].value;
+            return 0;
+        }
+    }
+    return MU_FAILURE;
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    fabric_error_code_count = 0;
+    for (uint32_t i = 0; i < sizeof(fabric_error_codes) / sizeof(fabric_error_codes[0]); i++)
+    {
+        int value = (int)((uint32_t)FABRIC_E_FIRST_RESERVED_HRESULT + i);
+        const char* valueAsString = MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, value);
+        if (strcmp(valueAsString, "UNKNOWN") != 0)
+        {
+            fabric_error_codes[fabric_error_code_count].value = value;
+            fabric_error_codes[fabric_error_code_count].valueAsString = valueAsString;
+            ASSERT_IS_TRUE(strlen(valueAsString) < sizeof(fabric_error_codes_lower_case[0]));
+            for (size_t j = 0; valueAsString[j] != '\0'; j++)
+            {
+                fabric_error_codes_lower_case[fabric_error_code_count][j] = (char)tolower((unsigned char)valueAsString[j]);
+            }
+            fabric_error_code_count++;
+        }
+    }
+    ASSERT_IS_TRUE(fabric_error_code_count > 0);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+}
+
+TEST_FUNCTION(FABRIC_ERROR_CODE_ToString_compared_to_linear_search)
+{
+    ///arrange
+    volatile uint32_t length_sum = 0; /*so the lookups are not optimized away*/
+
+    ///act
+    double start = timer_global_get_elapsed_us();
+    for (uint32_t iteration = 0; iteration < N_ITERATIONS; iteration++)
+    {
+        for (uint32_t i = 0; i < fabric_error_code_count; i++)
+        {
+            length_sum += (uint32_t)strlen(linear_to_string(fabric_error_codes[i].value));
+        }
+        for (uint32_t i = 0; i < sizeof(not_fabric_error_codes) / sizeof(not_fabric_error_codes[0]); i++)
+        {
+            length_sum += (uint32_t)strlen(linear_to_string(not_fabric_error_codes[i]));
+        }
+    }
+    double linear_us = timer_global_get_elapsed_us() - start;
+
+    start = timer_global_get_elapsed_us();
+    for (uint32_t iteration = 0; iteration < N_ITERATIONS; iteration++)
+    {
+        for (uint32_t i = 0; i < fabric_error_code_count; i++)
+        {
+            length_sum += (uint32_t)strlen(MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, fabric_error_codes[i].value));
+        }
+        for (uint32_t i = 0; i < sizeof(not_fabric_error_codes) / sizeof(not_fabric_error_codes[0]); i++)
+        {
+            length_sum += (uint32_t)strlen(MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, not_fabric_error_codes[i]));
+        }
+    }
+    double generated_us = timer_global_get_elapsed_us() - start;
+
+    ///assert
+    double lookups = (double)N_ITERATIONS * (fabric_error_code_count + sizeof(not_fabric_error_codes) / sizeof(not_fabric_error_codes[0]));
+    LogInfo("FABRIC_ERROR_CODE to string: linear search %.1f ns/lookup, generated %.1f ns/lookup (%" PRIu32 " codes)",
+        linear_us * 1000 / lookups, generated_us * 1000 / lookups, fabric_error_code_count);
+    for (uint32_t i = 0; i < fabric_error_code_count; i++)
+    {
+        ASSERT_ARE_EQUAL(char_ptr, linear_to_string(fabric_error_codes[i].value), MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, fabric_error_codes[i].value));
+    }
+}
+
+TEST_FUNCTION(FABRIC_ERROR_CODE_FromString_compared_to_linear_search)
+{
+    ///arrange
+    volatile int value_sum = 0; /*so the lookups are not optimized away*/
+
+    ///act
+    double start = timer_global_get_elapsed_us();
+    for (uint32_t iteration = 0; iteration < N_ITERATIONS; iteration++)
+    {
+        for (uint32_t i = 0; i < fabric_error_code_count; i++)
+        {
+            int value;
+            (void)linear_from_string(fabric_error_codes[i].valueAsString, &value);
+            value_sum += value;
+        }
+    }
+    double linear_us = timer_global_get_elapsed_us() - start;
+
+    start = timer_global_get_elapsed_us();
+    for (uint32_t iteration = 0; iteration < N_ITERATIONS; iteration++)
+    {
+        for (uint32_t i = 0; i < fabric_error_code_count; i++)
+        {
+            FABRIC_ERROR_CODE value;
+            (void)FABRIC_ERROR_CODE_FromString(fabric_error_codes[i].valueAsString, &value);
+            value_sum += (int)value;
+        }
+    }
+    double generated_us = timer_global_get_elapsed_us() - start;
+
+    ///assert
+    double lookups = (double)N_ITERATIONS * fabric_error_code_count;
+    LogInfo("FABRIC_ERROR_CODE from string: linear search %.1f ns/lookup, generated %.1f ns/lookup (%" PRIu32 " codes)",
+        linear_us * 1000 / lookups, generated_us * 1000 / lookups, fabric_error_code_count);
+    for (uint32_t i = 0; i < fabric_error_code_count; i++)
+    {
+        FABRIC_ERROR_CODE value;
+        ASSERT_ARE_EQUAL(int, 0, FABRIC_ERROR_CODE_FromString(fabric_error_codes[i].valueAsString, &value));
+        ASSERT_ARE_EQUAL(int, fabric_error_codes[i].value, (int)value);
+    }
+}
+
+TEST_FUNCTION(FABRIC_ERROR_CODE_FromStringCaseInsensitive_compared_to_linear_search)
+{
+    ///arrange
+    volatile int value_sum = 0; /*so the lookups are not optimized away*/
+
+    ///act
+    double start = timer_global_get_elapsed_us();
+    for (uint32_t iteration = 0; iteration < N_ITERATIONS; iteration++)
+    {
+        for (uint32_t i = 0; i < fabric_error_code_count; i++)
+        {
+            int value;
+            (void)linear_from_string_case_insensitive(fabric_error_codes_lower_case[i], &value);
+            value_sum += value;
+        }
+    }
+    double linear_us = timer_global_get_elapsed_us() - start;
+
+    start = timer_global_get_elapsed_us();
+    for (uint32_t iteration = 0; iteration < N_ITERATIONS; iteration++)
+    {
+        for (uint32_t i = 0; i < fabric_error_code_count; i++)
+        {
+            FABRIC_ERROR_CODE value;
+            (void)FABRIC_ERROR_CODE_FromStringCaseInsensitive(fabric_error_codes_lower_case[i], &value);
+            value_sum += (int)value;
+        }
+    }
+    double generated_us = timer_global_get_elapsed_us() - start;
+
+    ///assert
+    double lookups = (double)N_ITERATIONS * fabric_error_code_count;
+    LogInfo("FABRIC_ERROR_CODE from string (case insensitive): linear search %.1f ns/lookup, generated %.1f ns/lookup (%" PRIu32 " codes)",
+        linear_us * 1000 / lookups, generated_us * 1000 / lookups, fabric_error_code_count);
+    for (uint32_t i = 0; i < fabric_error_code_count; i++)
+    {
+        FABRIC_ERROR_CODE value;
+        ASSERT_ARE_EQUAL(int, 0, FABRIC_ERROR_CODE_FromStringCaseInsensitive(fabric_error_codes_lower_case[i], &value));
+        ASSERT_ARE_EQUAL(int, fabric_error_codes[i].value, (int)value);
+    }
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
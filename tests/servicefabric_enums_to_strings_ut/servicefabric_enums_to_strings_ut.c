@@ -0,0 +1,2292 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+#include "testrunnerswitcher.h"
+
+#include "fabrictypes.h"
+
+#include "sf_c_util/servicefabric_enums_to_strings.h"
+
+/*every enumerator of every enum in servicefabric_enums_to_strings.h (keep in sync with the generator), with the string that _ToString gives for its value: its own name, or the name of the first enumerator that has the same value*/
+typedef struct TEST_ENUMERATOR_TAG
+{
+    int value;
+    const char* name;
+    const char* value_as_string;
+} TEST_ENUMERATOR;
+
+#define TEST_ENUMERATOR_VALUE(name) { (int)(name), #name, #name }
+#define TEST_ENUMERATOR_ALIAS(name, first_name) { (int)(name), #name, #first_name }
+
+typedef struct TEST_ENUM_TAG
+{
+    const char* enum_name;
+    const TEST_ENUMERATOR* enumerators;
+    uint32_t enumerator_count;
+    const char* (*to_string)(int value);
+    int (*from_string)(const char* enum_as_string, int* value);
+    int (*from_string_case_insensitive)(const char* enum_as_string, int* value);
+} TEST_ENUM;
+
+/*the generated functions take the enum type, these take an int so that all the enums go through the same checks*/
+#define DEFINE_TEST_ENUM(enum_name) \
+    static const char* MU_C2(enum_name, _test_to_string)(int value) \
+    { \
+        return MU_ENUM_TO_STRING(enum_name, (enum_name)value); \
+    } \
+    static int MU_C2(enum_name, _test_from_string)(const char* enum_as_string, int* value) \
+    { \
+        enum_name destination; \
+        int result = MU_C2(enum_name, _FromString)(enum_as_string, &destination); \
+        if (result == 0) \
+        { \
+            *value = (int)destination; \
+        } \
+        return result; \
+    } \
+    static int MU_C2(enum_name, _test_from_string_case_insensitive)(const char* enum_as_string, int* value) \
+    { \
+        enum_name destination; \
+        int result = MU_C2(enum_name, _FromStringCaseInsensitive)(enum_as_string, &destination); \
+        if (result == 0) \
+        { \
+            *value = (int)destination; \
+        } \
+        return result; \
+    }
+
+#define TEST_ENUM_ENTRY(enum_name) { #enum_name, MU_C2(enum_name, _enumerators), sizeof(MU_C2(enum_name, _enumerators)) / sizeof(MU_C2(enum_name, _enumerators)[0]), MU_C2(enum_name, _test_to_string), MU_C2(enum_name, _test_from_string), MU_C2(enum_name, _test_from_string_case_insensitive) }
+
+static const TEST_ENUMERATOR FABRIC_ERROR_CODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FIRST_RESERVED_HRESULT),
+    TEST_ENUMERATOR_ALIAS(FABRIC_E_COMMUNICATION_ERROR, FABRIC_E_FIRST_RESERVED_HRESULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_ADDRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_NAME_URI),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_PARTITION_KEY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NAME_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NAME_DOES_NOT_EXIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NAME_NOT_EMPTY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NODE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NODE_IS_UP),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NO_WRITE_QUORUM),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NOT_PRIMARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NOT_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_OPERATION_NOT_COMPLETE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_PROPERTY_DOES_NOT_EXIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RECONFIGURATION_PENDING),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_REPLICATION_QUEUE_FULL),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_DOES_NOT_EXIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_OFFLINE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_METADATA_MISMATCH),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_AFFINITY_CHAIN_NOT_SUPPORTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_TYPE_ALREADY_REGISTERED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_TYPE_NOT_REGISTERED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_VALUE_TOO_LARGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_VALUE_EMPTY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_PROPERTY_CHECK_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_WRITE_CONFLICT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_ENUMERATION_COMPLETED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_TYPE_PROVISION_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_TYPE_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_TYPE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_TYPE_IN_USE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_UPGRADE_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_UPGRADE_VALIDATION_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_TYPE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_TYPE_MISMATCH),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_TYPE_TEMPLATE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CONFIGURATION_SECTION_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CONFIGURATION_PARAMETER_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_CONFIGURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_IMAGEBUILDER_VALIDATION_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_PARTITION_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_REPLICA_DOES_NOT_EXIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_GROUP_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_GROUP_DOES_NOT_EXIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_PROCESS_DEACTIVATED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_PROCESS_ABORTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_UPGRADE_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_CREDENTIAL_TYPE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_X509_FIND_TYPE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_X509_STORE_LOCATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_X509_STORE_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_X509_THUMBPRINT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_PROTECTION_LEVEL),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_X509_STORE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_SUBJECT_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_ALLOWED_COMMON_NAME_LIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_CREDENTIALS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DECRYPTION_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CONFIGURATION_PACKAGE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DATA_PACKAGE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CODE_PACKAGE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_ENDPOINT_RESOURCE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_OPERATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_OBJECT_CLOSED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_TIMEOUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FILE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DIRECTORY_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_DIRECTORY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_PATH_TOO_LONG),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_IMAGESTORE_IOERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CORRUPTED_IMAGE_STORE_OBJECT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_NOT_UPGRADING),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_ALREADY_IN_TARGET_VERSION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_IMAGEBUILDER_UNEXPECTED_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FABRIC_VERSION_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FABRIC_VERSION_IN_USE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FABRIC_VERSION_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FABRIC_ALREADY_IN_TARGET_VERSION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FABRIC_NOT_UPGRADING),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FABRIC_UPGRADE_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FABRIC_UPGRADE_VALIDATION_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_HEALTH_MAX_REPORTS_REACHED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_HEALTH_STALE_REPORT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_KEY_TOO_LARGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_KEY_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SEQUENCE_NUMBER_CHECK_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_ENCRYPTION_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_ATOMIC_GROUP),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_HEALTH_ENTITY_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_MANIFEST_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_TRANSPORT_STARTUP_FAILURE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_CANNOT_CONNECT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_MANAGER_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_REJECTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_MANAGER_ALREADY_LISTENING),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_MANAGER_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_MANAGER_NOT_LISTENING),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_SERVICE_TYPE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_IMAGEBUILDER_TIMEOUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_IMAGEBUILDER_ACCESS_DENIED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_IMAGEBUILDER_INVALID_MSI_FILE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_TOO_BUSY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_TRANSACTION_NOT_ACTIVE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_REPAIR_TASK_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_REPAIR_TASK_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_QUEUE_EMPTY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_QUOTA_EXCEEDED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_SERVICE_FAULTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RELIABLE_SESSION_INVALID_TARGET_PARTITION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_TRANSACTION_TOO_LARGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_REPLICATION_OPERATION_TOO_LARGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INSTANCE_ID_MISMATCH),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_UPGRADE_DOMAIN_ALREADY_COMPLETED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NODE_HAS_NOT_STOPPED_YET),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INSUFFICIENT_CLUSTER_CAPACITY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_PACKAGE_SHARING_POLICY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_PREDEPLOYMENT_NOT_ALLOWED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_BACKUP_SETTING),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_MISSING_FULL_BACKUP),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUP_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DUPLICATE_SERVICE_NOTIFICATION_FILTER_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_REPLICA_OPERATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_REPLICA_STATE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_LOADBALANCER_NOT_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_PARTITION_OPERATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_PRIMARY_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SECONDARY_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUP_DIRECTORY_NOT_EMPTY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FORCE_NOT_SUPPORTED_FOR_REPLICA_OPERATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_ACQUIRE_FILE_LOCK_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CONNECTION_DENIED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVER_AUTHENTICATION_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CONSTRAINT_KEY_UNDEFINED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_MULTITHREADED_TRANSACTIONS_NOT_ALLOWED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_X509_NAME_LIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_VERBOSE_FM_PLACEMENT_HEALTH_REPORTING_REQUIRED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_GATEWAY_NOT_REACHABLE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_USER_ROLE_CLIENT_CERTIFICATE_NOT_CONFIGURED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_TRANSACTION_ABORTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CANNOT_CONNECT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_MESSAGE_TOO_LARGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CONSTRAINT_NOT_SATISFIED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_ENDPOINT_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_APPLICATION_UPDATE_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DELETE_BACKUP_FILE_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CONNECTION_CLOSED_BY_REMOTE_END),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_TEST_COMMAND_STATE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_TEST_COMMAND_OPERATION_ID_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CM_OPERATION_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_IMAGEBUILDER_RESERVED_DIRECTORY_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CERTIFICATE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CHAOS_ALREADY_RUNNING),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FABRIC_DATA_ROOT_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_RESTORE_DATA),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DUPLICATE_BACKUPS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_BACKUP_CHAIN),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_STOP_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_ALREADY_STOPPED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NODE_IS_DOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NODE_TRANSITION_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_BACKUP),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_INSTANCE_ID),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RESTORE_SAFE_CHECK_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CONFIG_UPGRADE_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_UPLOAD_SESSION_RANGE_NOT_SATISFIABLE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_UPLOAD_SESSION_ID_CONFLICT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_PARTITION_SELECTOR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_REPLICA_SELECTOR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DNS_SERVICE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_DNS_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DNS_NAME_IN_USE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_COMPOSE_DEPLOYMENT_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_COMPOSE_DEPLOYMENT_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_FOR_STATEFUL_SERVICES),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_FOR_STATELESS_SERVICES),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_ONLY_VALID_FOR_STATEFUL_PERSISTENT_SERVICES),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_UPLOAD_SESSION_ID),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUP_NOT_ENABLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUP_IS_ENABLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUP_POLICY_DOES_NOT_EXIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUP_POLICY_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RESTORE_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RESTORE_SOURCE_TARGET_PARTITION_MISMATCH),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FAULT_ANALYSIS_SERVICE_NOT_ENABLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CONTAINER_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_OBJECT_DISPOSED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NOT_READABLE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUPCOPIER_UNEXPECTED_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUPCOPIER_TIMEOUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUPCOPIER_ACCESS_DENIED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INVALID_SERVICE_SCALING_POLICY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SINGLE_INSTANCE_APPLICATION_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SINGLE_INSTANCE_APPLICATION_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_VOLUME_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_VOLUME_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DATABASE_MIGRATION_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_CENTRAL_SECRET_SERVICE_GENERIC),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SECRET_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SECRET_VERSION_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SINGLE_INSTANCE_APPLICATION_UPGRADE_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_OPERATION_NOT_SUPPORTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_COMPOSE_DEPLOYMENT_NOT_UPGRADING),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SECRET_TYPE_CANNOT_BE_CHANGED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NETWORK_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NETWORK_IN_USE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_ENDPOINT_NOT_REFERENCED),
+    TEST_ENUMERATOR_ALIAS(FABRIC_E_LAST_USED_HRESULT, FABRIC_E_ENDPOINT_NOT_REFERENCED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_LAST_RESERVED_HRESULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FACILITY_SF_FIRST_HRESULT),
+    TEST_ENUMERATOR_ALIAS(FABRIC_E_INSTANCE_ALREADY_EXISTS, FABRIC_E_FACILITY_SF_FIRST_HRESULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_NODE_TYPE_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INSTANCE_COUNT_UPDATE_NOT_ALLOWED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_COPY_ABORTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_AUXILIARY_ALREADY_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_AUXILIARY_FEATURE_DISABLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RUN_TO_COMPLETION_INCOMPATIBLE_WITH_SHARED_PROCESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_VERSION_STORE_OUT_OF_MEMORY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_BACKUP_NOT_FOUND),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SKIP_RESTORE_OPERATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_STORE_OUT_OF_SESSIONS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_RESTORE_WAITING_FOR_USER_INTERVENTION),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DATABASE_FILES_CORRUPTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_INSUFFICIENT_MAX_LOAD_CAPACITY),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_STORE_DISK_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_ALREADY_IN_REQUESTED_STATE),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_DISABLE_ENABLE_SERVICE_FEATURE_DISABLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_MAX_ALLOWED_DISABLED_SERVICES_REACHED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_DISABLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_SERVICE_DISABLE_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_STORE_OUT_OF_LONG_VALUE_IDS),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_STORE_OUT_OF_INSTANCES),
+    TEST_ENUMERATOR_ALIAS(FABRIC_E_LAST_USED_FACILITY_SF_HRESULT, FABRIC_E_STORE_OUT_OF_INSTANCES),
+    TEST_ENUMERATOR_VALUE(FABRIC_E_FACILITY_SF_LAST_HRESULT),
+};
+DEFINE_TEST_ENUM(FABRIC_ERROR_CODE)
+
+static const TEST_ENUMERATOR FABRIC_CLIENT_ROLE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_CLIENT_ROLE_UNKNOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_CLIENT_ROLE_USER),
+    TEST_ENUMERATOR_VALUE(FABRIC_CLIENT_ROLE_ADMIN),
+    TEST_ENUMERATOR_VALUE(FABRIC_CLIENT_ROLE_ELEVATED_ADMIN),
+};
+DEFINE_TEST_ENUM(FABRIC_CLIENT_ROLE)
+
+static const TEST_ENUMERATOR FABRIC_QUERY_SERVICE_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_STATUS_UNKNOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_STATUS_ACTIVE),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_STATUS_UPGRADING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_STATUS_DELETING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_STATUS_CREATING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_STATUS_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_STATUS_DISABLING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_STATUS_DISABLED),
+};
+DEFINE_TEST_ENUM(FABRIC_QUERY_SERVICE_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_QUERY_NODE_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_UP),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_DOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_ENABLING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_DISABLING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_DISABLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_UNKNOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_REMOVED),
+};
+DEFINE_TEST_ENUM(FABRIC_QUERY_NODE_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_QUERY_NODE_STATUS_FILTER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_FILTER_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_FILTER_UP),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_FILTER_DOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_FILTER_ENABLING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_FILTER_DISABLING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_FILTER_DISABLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_FILTER_UNKNOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_FILTER_REMOVED),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_NODE_STATUS_FILTER_ALL),
+};
+DEFINE_TEST_ENUM(FABRIC_QUERY_NODE_STATUS_FILTER)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_KIND_STATELESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_KIND_STATEFUL),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_KIND_SELF_RECONFIGURING),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_KIND)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_PARTITION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PARTITION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PARTITION_KIND_SINGLETON),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PARTITION_KIND_INT64_RANGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PARTITION_KIND_NAMED),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_PARTITION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_QUERY_SERVICE_PARTITION_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_PARTITION_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_PARTITION_STATUS_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_PARTITION_STATUS_NOT_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_PARTITION_STATUS_IN_QUORUM_LOSS),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_PARTITION_STATUS_RECONFIGURING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_PARTITION_STATUS_DELETING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLING),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_PARTITION_STATUS_DISABLED),
+};
+DEFINE_TEST_ENUM(FABRIC_QUERY_SERVICE_PARTITION_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_QUERY_SERVICE_REPLICA_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_INBUILD),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_STANDBY),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_DOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_DROPPED),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_COMPLETED),
+};
+DEFINE_TEST_ENUM(FABRIC_QUERY_SERVICE_REPLICA_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_INBUILD),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_STANDBY),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_DROPPED),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_COMPLETED),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER_ALL),
+};
+DEFINE_TEST_ENUM(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER)
+
+static const TEST_ENUMERATOR FABRIC_QUERY_SERVICE_OPERATION_NAME_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_OPERATION_NAME_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_OPERATION_NAME_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_OPERATION_NAME_OPEN),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_OPERATION_NAME_CHANGEROLE),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_OPERATION_NAME_CLOSE),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_SERVICE_OPERATION_NAME_ABORT),
+};
+DEFINE_TEST_ENUM(FABRIC_QUERY_SERVICE_OPERATION_NAME)
+
+static const TEST_ENUMERATOR FABRIC_QUERY_REPLICATOR_OPERATION_NAME_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_OPEN),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CHANGEROLE),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_UPDATEEPOCH),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_CLOSE),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ABORT),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_ONDATALOSS),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_WAITFORCATCHUP),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUERY_REPLICATOR_OPERATION_NAME_BUILD),
+};
+DEFINE_TEST_ENUM(FABRIC_QUERY_REPLICATOR_OPERATION_NAME)
+
+static const TEST_ENUMERATOR FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_EXEHOST),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_DLLHOST),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND_CONTAINERHOST),
+};
+DEFINE_TEST_ENUM(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND)
+
+static const TEST_ENUMERATOR FABRIC_EXEHOST_WORKING_FOLDER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_EXEHOST_WORKING_FOLDER_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_EXEHOST_WORKING_FOLDER_WORK),
+    TEST_ENUMERATOR_VALUE(FABRIC_EXEHOST_WORKING_FOLDER_CODE_PACKAGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_EXEHOST_WORKING_FOLDER_CODE_BASE),
+};
+DEFINE_TEST_ENUM(FABRIC_EXEHOST_WORKING_FOLDER)
+
+static const TEST_ENUMERATOR FABRIC_DLLHOST_HOSTED_DLL_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_DLLHOST_HOSTED_DLL_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_DLLHOST_HOSTED_DLL_KIND_UNMANAGED),
+    TEST_ENUMERATOR_VALUE(FABRIC_DLLHOST_HOSTED_DLL_KIND_MANAGED),
+};
+DEFINE_TEST_ENUM(FABRIC_DLLHOST_HOSTED_DLL_KIND)
+
+static const TEST_ENUMERATOR FABRIC_DLLHOST_ISOLATION_POLICY_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_DLLHOST_ISOLATION_POLICY_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_DLLHOST_ISOLATION_POLICY_SHARED_DOMAIN),
+    TEST_ENUMERATOR_VALUE(FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_DOMAIN),
+    TEST_ENUMERATOR_VALUE(FABRIC_DLLHOST_ISOLATION_POLICY_DEDICATED_PROCESS),
+};
+DEFINE_TEST_ENUM(FABRIC_DLLHOST_ISOLATION_POLICY)
+
+static const TEST_ENUMERATOR FABRIC_SECURITY_CREDENTIAL_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SECURITY_CREDENTIAL_KIND_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_SECURITY_CREDENTIAL_KIND_X509),
+    TEST_ENUMERATOR_VALUE(FABRIC_SECURITY_CREDENTIAL_KIND_WINDOWS),
+    TEST_ENUMERATOR_VALUE(FABRIC_SECURITY_CREDENTIAL_KIND_CLAIMS),
+    TEST_ENUMERATOR_VALUE(FABRIC_SECURITY_CREDENTIAL_KIND_X509_2),
+    TEST_ENUMERATOR_VALUE(FABRIC_SECURITY_CREDENTIAL_KIND_INVALID),
+};
+DEFINE_TEST_ENUM(FABRIC_SECURITY_CREDENTIAL_KIND)
+
+static const TEST_ENUMERATOR FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND_AAD),
+};
+DEFINE_TEST_ENUM(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND)
+
+static const TEST_ENUMERATOR FABRIC_PROTECTION_LEVEL_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_PROTECTION_LEVEL_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROTECTION_LEVEL_SIGN),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROTECTION_LEVEL_ENCRYPTANDSIGN),
+};
+DEFINE_TEST_ENUM(FABRIC_PROTECTION_LEVEL)
+
+static const TEST_ENUMERATOR FABRIC_X509_STORE_LOCATION_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_X509_STORE_LOCATION_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_X509_STORE_LOCATION_CURRENTUSER),
+    TEST_ENUMERATOR_VALUE(FABRIC_X509_STORE_LOCATION_LOCALMACHINE),
+};
+DEFINE_TEST_ENUM(FABRIC_X509_STORE_LOCATION)
+
+static const TEST_ENUMERATOR FABRIC_X509_FIND_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_X509_FIND_TYPE_FINDBYTHUMBPRINT),
+    TEST_ENUMERATOR_VALUE(FABRIC_X509_FIND_TYPE_FINDBYSUBJECTNAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_X509_FIND_TYPE_FINDBYEXTENSION),
+};
+DEFINE_TEST_ENUM(FABRIC_X509_FIND_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_LOAD_METRIC_WEIGHT_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_LOAD_METRIC_WEIGHT_ZERO),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_LOAD_METRIC_WEIGHT_LOW),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_LOAD_METRIC_WEIGHT_MEDIUM),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_LOAD_METRIC_WEIGHT_HIGH),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_LOAD_METRIC_WEIGHT)
+
+static const TEST_ENUMERATOR FABRIC_MOVE_COST_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_COST_ZERO),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_COST_LOW),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_COST_MEDIUM),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_COST_HIGH),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_COST_VERYHIGH),
+};
+DEFINE_TEST_ENUM(FABRIC_MOVE_COST)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_SHARED_PROCESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE_EXCLUSIVE_PROCESS),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_CORRELATION_SCHEME_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_CORRELATION_SCHEME_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_CORRELATION_SCHEME_AFFINITY),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_CORRELATION_SCHEME_ALIGNED_AFFINITY),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_CORRELATION_SCHEME_NONALIGNED_AFFINITY),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_CORRELATION_SCHEME)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_PARTITION_ACCESS_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PARTITION_ACCESS_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PARTITION_ACCESS_STATUS_GRANTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PARTITION_ACCESS_STATUS_RECONFIGURATION_PENDING),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NOT_PRIMARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_PARTITION_ACCESS_STATUS_NO_WRITE_QUORUM),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_PARTITION_ACCESS_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_REPLICA_ROLE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_ROLE_UNKNOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_ROLE_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_ROLE_PRIMARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_ROLE_IDLE_SECONDARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_ROLE_ACTIVE_SECONDARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_ROLE_IDLE_AUXILIARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_ROLE_ACTIVE_AUXILIARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_ROLE_PRIMARY_AUXILIARY),
+};
+DEFINE_TEST_ENUM(FABRIC_REPLICA_ROLE)
+
+static const TEST_ENUMERATOR FABRIC_REPLICA_OPEN_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_OPEN_MODE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_OPEN_MODE_NEW),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_OPEN_MODE_EXISTING),
+};
+DEFINE_TEST_ENUM(FABRIC_REPLICA_OPEN_MODE)
+
+static const TEST_ENUMERATOR FABRIC_REPLICA_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_STATUS_DOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_STATUS_UP),
+};
+DEFINE_TEST_ENUM(FABRIC_REPLICA_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_OPERATION_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_OPERATION_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_OPERATION_TYPE_NORMAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_OPERATION_TYPE_END_OF_STREAM),
+    TEST_ENUMERATOR_VALUE(FABRIC_OPERATION_TYPE_CREATE_ATOMIC_GROUP),
+    TEST_ENUMERATOR_VALUE(FABRIC_OPERATION_TYPE_ATOMIC_GROUP_OPERATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_OPERATION_TYPE_COMMIT_ATOMIC_GROUP),
+    TEST_ENUMERATOR_VALUE(FABRIC_OPERATION_TYPE_ROLLBACK_ATOMIC_GROUP),
+    TEST_ENUMERATOR_VALUE(FABRIC_OPERATION_TYPE_HAS_ATOMIC_GROUP_MASK),
+};
+DEFINE_TEST_ENUM(FABRIC_OPERATION_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_REPLICA_SET_QUORUM_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_SET_QUORUM_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_SET_WRITE_QUORUM),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICA_SET_QUORUM_ALL),
+};
+DEFINE_TEST_ENUM(FABRIC_REPLICA_SET_QUORUM_MODE)
+
+static const TEST_ENUMERATOR FABRIC_REPLICATOR_SETTINGS_FLAGS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_SETTINGS_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_ADDRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_SECURITY),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_RETRY_INTERVAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_BATCH_ACKNOWLEDGEMENT_INTERVAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_REQUIRE_SERVICE_ACK),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_REPLICATION_QUEUE_INITIAL_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_COPY_QUEUE_INITIAL_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_COPY_QUEUE_MAX_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_REPLICATION_QUEUE_MAX_MEMORY_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_SECONDARY_CLEAR_ACKNOWLEDGED_OPERATIONS),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_REPLICATION_MESSAGE_MAX_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_USE_STREAMFAULTS_AND_ENDOFSTREAM_OPERATIONACK),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_INITIAL_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_SECONDARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_INITIAL_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_PRIMARY_REPLICATION_QUEUE_MAX_MEMORY_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_PRIMARY_WAIT_FOR_PENDING_QUORUMS_TIMEOUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_LISTEN_ADDRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_PUBLISH_ADDRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_ENABLE_SEND_WINDOW_SIZE_IN_BYTES),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_USE_INDIVIDUAL_HEAP_PER_REPLICA),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_INITIAL_REPLICA_HEAP_SIZE_IN_KB),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_REPLICATION_BATCH_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPLICATOR_REPLICATION_BATCH_SEND_INTERVAL),
+};
+DEFINE_TEST_ENUM(FABRIC_REPLICATOR_SETTINGS_FLAGS)
+
+static const TEST_ENUMERATOR FABRIC_FAULT_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_FAULT_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_FAULT_TYPE_PERMANENT),
+    TEST_ENUMERATOR_VALUE(FABRIC_FAULT_TYPE_TRANSIENT),
+};
+DEFINE_TEST_ENUM(FABRIC_FAULT_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_HEALTH_STATE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_OK),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_WARNING),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_UNKNOWN),
+};
+DEFINE_TEST_ENUM(FABRIC_HEALTH_STATE)
+
+static const TEST_ENUMERATOR FABRIC_HEALTH_REPORT_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_STATEFUL_SERVICE_REPLICA),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_STATELESS_SERVICE_INSTANCE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_PARTITION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_NODE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_SERVICE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_APPLICATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_DEPLOYED_APPLICATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_DEPLOYED_SERVICE_PACKAGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_CLUSTER),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_REPORT_KIND_SELF_RECONFIGURING_SERVICE_INSTANCE),
+};
+DEFINE_TEST_ENUM(FABRIC_HEALTH_REPORT_KIND)
+
+static const TEST_ENUMERATOR FABRIC_HEALTH_ENTITY_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_ENTITY_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_ENTITY_KIND_NODE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_ENTITY_KIND_PARTITION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_ENTITY_KIND_SERVICE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_ENTITY_KIND_APPLICATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_ENTITY_KIND_REPLICA),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_APPLICATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_ENTITY_KIND_DEPLOYED_SERVICE_PACKAGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_ENTITY_KIND_CLUSTER),
+};
+DEFINE_TEST_ENUM(FABRIC_HEALTH_ENTITY_KIND)
+
+static const TEST_ENUMERATOR FABRIC_HEALTH_EVALUATION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_EVENT),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_REPLICAS),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_PARTITIONS),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGES),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATIONS),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_SERVICES),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_NODES),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_APPLICATIONS),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_SYSTEM_APPLICATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DEPLOYED_APPLICATIONS),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_NODES),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_NODE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_REPLICA),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_PARTITION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_SERVICE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_SERVICE_PACKAGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_DEPLOYED_APPLICATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_APPLICATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_DELTA_NODES_CHECK),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_UPGRADE_DOMAIN_DELTA_NODES_CHECK),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_APPLICATION_TYPE_APPLICATIONS),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_EVALUATION_KIND_NODE_TYPE_NODES),
+};
+DEFINE_TEST_ENUM(FABRIC_HEALTH_EVALUATION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_PROPERTY_TYPE_ID_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_TYPE_BINARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_TYPE_INT64),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_TYPE_DOUBLE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_TYPE_WSTRING),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_TYPE_GUID),
+};
+DEFINE_TEST_ENUM(FABRIC_PROPERTY_TYPE_ID)
+
+static const TEST_ENUMERATOR FABRIC_PROPERTY_BATCH_OPERATION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_BATCH_OPERATION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_BATCH_OPERATION_KIND_GET),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_EXISTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_SEQUENCE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_BATCH_OPERATION_KIND_DELETE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_BATCH_OPERATION_KIND_PUT_CUSTOM),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROPERTY_BATCH_OPERATION_KIND_CHECK_VALUE),
+};
+DEFINE_TEST_ENUM(FABRIC_PROPERTY_BATCH_OPERATION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_ENDPOINT_ROLE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_ROLE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_ROLE_STATELESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_ROLE_STATEFUL_SECONDARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_ROLE_STATEFUL_PRIMARY_AUXILIARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_ROLE_STATEFUL_AUXILIARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_ROLE_SELF_RECONFIGURING),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_ENDPOINT_ROLE)
+
+static const TEST_ENUMERATOR FABRIC_ENUMERATION_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_BEST_EFFORT_MORE_DATA),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_CONSISTENT_MORE_DATA),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_MORE_DATA_MASK),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_BEST_EFFORT_FINISHED),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_BEST_EFFORT_MASK),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_CONSISTENT_FINISHED),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_CONSISTENT_MASK),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_FINISHED_MASK),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENUMERATION_VALID_MASK),
+};
+DEFINE_TEST_ENUM(FABRIC_ENUMERATION_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_PARTITION_KEY_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_KEY_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_KEY_TYPE_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_KEY_TYPE_INT64),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_KEY_TYPE_STRING),
+};
+DEFINE_TEST_ENUM(FABRIC_PARTITION_KEY_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_PARTITION_SCHEME_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SCHEME_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SCHEME_SINGLETON),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SCHEME_UNIFORM_INT64_RANGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SCHEME_NAMED),
+};
+DEFINE_TEST_ENUM(FABRIC_PARTITION_SCHEME)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_DESCRIPTION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_DESCRIPTION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_DESCRIPTION_KIND_STATELESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_DESCRIPTION_KIND_STATEFUL),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_DESCRIPTION_KIND_SELF_RECONFIGURING),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_DESCRIPTION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_REPLICA_RESTART_WAIT_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_QUORUM_LOSS_WAIT_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_STANDBY_REPLICA_KEEP_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_PLACEMENT_TIME_LIMIT),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_DROP_SOURCE_REPLICA_ON_MOVE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_AUXILIARY_REPLICA_COUNT),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SETTINGS_SERVICE_SENSITIVITY),
+};
+DEFINE_TEST_ENUM(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS)
+
+static const TEST_ENUMERATOR FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_SETTINGS_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_CLOSE_DELAY_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_SETTINGS_INSTANCE_RESTART_WAIT_DURATION),
+};
+DEFINE_TEST_ENUM(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS)
+
+static const TEST_ENUMERATOR FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_INSTANCE_COUNT),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_PLACEMENT_CONSTRAINTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_POLICY_LIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_CORRELATIONS),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_METRICS),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_MOVE_COST),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_SCALING_POLICY),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_MIN_INSTANCE_COUNT),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_MIN_INSTANCE_PERCENTAGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_INSTANCE_CLOSE_DELAY_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_INSTANCE_RESTART_WAIT_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_SERVICE_DNS_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_PLACE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATELESS_SERVICE_TAGS_REQUIRED_TO_RUN),
+};
+DEFINE_TEST_ENUM(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS)
+
+static const TEST_ENUMERATOR FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_TARGET_REPLICA_SET_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_REPLICA_RESTART_WAIT_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_QUORUM_LOSS_WAIT_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_STANDBY_REPLICA_KEEP_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_MIN_REPLICA_SET_SIZE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_PLACEMENT_CONSTRAINTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_POLICY_LIST),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_CORRELATIONS),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_METRICS),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_MOVE_COST),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SCALING_POLICY),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SERVICE_PLACEMENT_TIME_LIMIT),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_DROP_SOURCE_REPLICA_ON_MOVE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SERVICE_DNS_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_IS_SINGLETON_REPLICA_MOVE_ALLOWED_DURING_UPGRADE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_RESTORE_REPLICA_LOCATION_AFTER_UPGRADE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_PLACE),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_TAGS_REQUIRED_TO_RUN),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_AUXILIARY_REPLICA_COUNT),
+    TEST_ENUMERATOR_VALUE(FABRIC_STATEFUL_SERVICE_SERVICE_SENSITIVITY),
+};
+DEFINE_TEST_ENUM(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS)
+
+static const TEST_ENUMERATOR FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_NEW),
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE_EXISTING),
+};
+DEFINE_TEST_ENUM(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE)
+
+static const TEST_ENUMERATOR FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_INITIAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_MEMBER),
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE_NONE),
+};
+DEFINE_TEST_ENUM(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE)
+
+static const TEST_ENUMERATOR FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURATION_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURATION_STATUS_ACTIVATED),
+    TEST_ENUMERATOR_VALUE(FABRIC_SELF_RECONFIGURATION_STATUS_DEACTIVATED),
+};
+DEFINE_TEST_ENUM(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_NAME_PREFIX),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS_PRIMARY_ONLY),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_UPGRADE_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_KIND_ROLLING),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_UPGRADE_KIND)
+
+static const TEST_ENUMERATOR FABRIC_UPGRADE_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_KIND_ROLLING),
+};
+DEFINE_TEST_ENUM(FABRIC_UPGRADE_KIND)
+
+static const TEST_ENUMERATOR FABRIC_UPGRADE_SORT_ORDER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_SORT_ORDER_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_SORT_ORDER_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_SORT_ORDER_NUMERIC),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_SORT_ORDER_LEXICOGRAPHICAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_SORT_ORDER_REVERSE_NUMERIC),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_SORT_ORDER_REVERSE_LEXICOGRAPHICAL),
+};
+DEFINE_TEST_ENUM(FABRIC_UPGRADE_SORT_ORDER)
+
+static const TEST_ENUMERATOR FABRIC_ROLLING_UPGRADE_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_MODE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_AUTO),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_MANUAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_MODE_MONITORED),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_MODE_UNMONITORED_DEFERRED),
+};
+DEFINE_TEST_ENUM(FABRIC_ROLLING_UPGRADE_MODE)
+
+static const TEST_ENUMERATOR FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_ROLLBACK),
+    TEST_ENUMERATOR_VALUE(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION_MANUAL),
+};
+DEFINE_TEST_ENUM(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION)
+
+static const TEST_ENUMERATOR FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_WAIT_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_STABLE_DURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE_RETRY),
+};
+DEFINE_TEST_ENUM(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE)
+
+static const TEST_ENUMERATOR FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_MODE),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FORCE_RESTART),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_REPLICA_SET_CHECK_TIMEOUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_FAILURE_ACTION),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_WAIT),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_STABLE),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_CHECK_RETRY),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_TIMEOUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_DOMAIN_TIMEOUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_HEALTH_POLICY),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_ENABLE_DELTAS),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_HEALTH_POLICY),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_UPGRADE_APPLICATION_HEALTH_POLICY_MAP),
+    TEST_ENUMERATOR_VALUE(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS_INSTANCE_CLOSE_DELAY_DURATION),
+};
+DEFINE_TEST_ENUM(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_UPGRADE_STATE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_STATE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_COMPLETED),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_PENDING),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_STATE_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPGRADE_STATE_ROLLING_BACK_PENDING),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_UPGRADE_STATE)
+
+static const TEST_ENUMERATOR FABRIC_UPGRADE_STATE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_STATE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_STATE_ROLLING_BACK_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_STATE_ROLLING_BACK_COMPLETED),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_STATE_ROLLING_FORWARD_PENDING),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_STATE_ROLLING_FORWARD_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_STATE_ROLLING_FORWARD_COMPLETED),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_STATE_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_STATE_ROLLING_BACK_PENDING),
+};
+DEFINE_TEST_ENUM(FABRIC_UPGRADE_STATE)
+
+static const TEST_ENUMERATOR FABRIC_UPGRADE_DOMAIN_STATE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_DOMAIN_STATE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_DOMAIN_STATE_PENDING),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_DOMAIN_STATE_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_DOMAIN_STATE_COMPLETED),
+};
+DEFINE_TEST_ENUM(FABRIC_UPGRADE_DOMAIN_STATE)
+
+static const TEST_ENUMERATOR FABRIC_UPGRADE_FAILURE_REASON_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_FAILURE_REASON_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_FAILURE_REASON_INTERRUPTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_FAILURE_REASON_HEALTH_CHECK),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_FAILURE_REASON_UPGRADE_DOMAIN_TIMEOUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_FAILURE_REASON_OVERALL_UPGRADE_TIMEOUT),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_FAILURE_REASON_PROCESSING_FAILURE),
+};
+DEFINE_TEST_ENUM(FABRIC_UPGRADE_FAILURE_REASON)
+
+static const TEST_ENUMERATOR FABRIC_LOCAL_STORE_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_LOCAL_STORE_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_LOCAL_STORE_KIND_ESE),
+};
+DEFINE_TEST_ENUM(FABRIC_LOCAL_STORE_KIND)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_REPLICA_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_REPLICA_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_REPLICA_KIND_KEY_VALUE_STORE),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_REPLICA_KIND)
+
+static const TEST_ENUMERATOR FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_NON_BLOCKING_QUORUM_ACKED),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE_BLOCK_SECONDARY_ACK),
+};
+DEFINE_TEST_ENUM(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE)
+
+static const TEST_ENUMERATOR FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_PHYSICAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_LOGICAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE_REBUILD),
+};
+DEFINE_TEST_ENUM(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE)
+
+static const TEST_ENUMERATOR FABRIC_TRANSACTION_ISOLATION_LEVEL_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_TRANSACTION_ISOLATION_LEVEL_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_UNCOMMITTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_TRANSACTION_ISOLATION_LEVEL_READ_COMMITTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_TRANSACTION_ISOLATION_LEVEL_REPEATABLE_READ),
+    TEST_ENUMERATOR_VALUE(FABRIC_TRANSACTION_ISOLATION_LEVEL_SNAPSHOT),
+    TEST_ENUMERATOR_VALUE(FABRIC_TRANSACTION_ISOLATION_LEVEL_SERIALIZABLE),
+};
+DEFINE_TEST_ENUM(FABRIC_TRANSACTION_ISOLATION_LEVEL)
+
+static const TEST_ENUMERATOR FABRIC_NODE_DEACTIVATION_INTENT_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_INTENT_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_INTENT_PAUSE),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_INTENT_RESTART),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_DATA),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_INTENT_REMOVE_NODE),
+};
+DEFINE_TEST_ENUM(FABRIC_NODE_DEACTIVATION_INTENT)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_DISABLE_FLAG_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_DISABLE_FLAG_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_DISABLE_FLAG_REMOVE_DATA),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_DISABLE_FLAG)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_TYPE_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_STATUS_PROVISIONING),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_STATUS_AVAILABLE),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_STATUS_UNPROVISIONING),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_STATUS_FAILED),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_TYPE_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_STATUS_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_STATUS_UPGRADING),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_STATUS_CREATING),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_STATUS_DELETING),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_STATUS_FAILED),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_DEFINITION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_DESCRIPTION),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_DEFINITION_KIND_COMPOSE),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_DEFINITION_KIND_INVALID),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_DEFINITION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_TYPE_DEFINITION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_SERVICE_FABRIC_APPLICATION_PACKAGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_COMPOSE),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_MESH_APPLICATION_DESCRIPTION),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_TYPE_DEFINITION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_DEFINITION_KIND_FILTER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_DEFINITION_KIND_FILTER_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_DESCRIPTION),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_DEFINITION_KIND_FILTER_COMPOSE),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_DEFINITION_KIND_FILTER_ALL),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_DEFINITION_KIND_FILTER)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_SERVICE_FABRIC_APPLICATION_PACKAGE),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_COMPOSE),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_MESH_APPLICATION_DESCRIPTION),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER_ALL),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_DISABLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_NOT_REGISTERED),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS_REGISTERED),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_DEPLOYMENT_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_DEPLOYMENT_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_DEPLOYMENT_STATUS_DOWNLOADING),
+    TEST_ENUMERATOR_VALUE(FABRIC_DEPLOYMENT_STATUS_ACTIVATING),
+    TEST_ENUMERATOR_VALUE(FABRIC_DEPLOYMENT_STATUS_ACTIVE),
+    TEST_ENUMERATOR_VALUE(FABRIC_DEPLOYMENT_STATUS_UPGRADING),
+    TEST_ENUMERATOR_VALUE(FABRIC_DEPLOYMENT_STATUS_DEACTIVATING),
+    TEST_ENUMERATOR_VALUE(FABRIC_DEPLOYMENT_STATUS_RAN_TO_COMPLETION),
+    TEST_ENUMERATOR_VALUE(FABRIC_DEPLOYMENT_STATUS_FAILED),
+};
+DEFINE_TEST_ENUM(FABRIC_DEPLOYMENT_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_HOST_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_HOST_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_HOST_TYPE_EXE_HOST),
+    TEST_ENUMERATOR_VALUE(FABRIC_HOST_TYPE_CONTAINER_HOST),
+};
+DEFINE_TEST_ENUM(FABRIC_HOST_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_HOST_ISOLATION_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_HOST_ISOLATION_MODE_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HOST_ISOLATION_MODE_PROCESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_HOST_ISOLATION_MODE_HYPER_V),
+};
+DEFINE_TEST_ENUM(FABRIC_HOST_ISOLATION_MODE)
+
+static const TEST_ENUMERATOR FABRIC_ENTRY_POINT_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_ENTRY_POINT_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENTRY_POINT_STATUS_PENDING),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENTRY_POINT_STATUS_STARTING),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENTRY_POINT_STATUS_STARTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENTRY_POINT_STATUS_STOPPING),
+    TEST_ENUMERATOR_VALUE(FABRIC_ENTRY_POINT_STATUS_STOPPED),
+};
+DEFINE_TEST_ENUM(FABRIC_ENTRY_POINT_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_NODE_UPGRADE_PHASE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_UPGRADE_PHASE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_UPGRADE_PHASE_PRE_UPGRADE_SAFETY_CHECK),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_UPGRADE_PHASE_UPGRADING),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_UPGRADE_PHASE_POST_UPGRADE_SAFETY_CHECK),
+};
+DEFINE_TEST_ENUM(FABRIC_NODE_UPGRADE_PHASE)
+
+static const TEST_ENUMERATOR FABRIC_UPGRADE_SAFETY_CHECK_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_SAFETY_CHECK_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY),
+    TEST_ENUMERATOR_VALUE(FABRIC_UPGRADE_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RESOURCE_AVAILABILITY),
+};
+DEFINE_TEST_ENUM(FABRIC_UPGRADE_SAFETY_CHECK_KIND)
+
+static const TEST_ENUMERATOR FABRIC_SAFETY_CHECK_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SAFETY_CHECK_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SEED_NODE_SAFETY_CHECK_KIND_ENSURE_QUORUM),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_QUORUM),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_PLACEMENT),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_PRIMARY_SWAP),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_RECONFIGURATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SAFETY_CHECK_KIND_WAIT_FOR_INBUILD_REPLICA),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SAFETY_CHECK_KIND_ENSURE_AVAILABILITY),
+};
+DEFINE_TEST_ENUM(FABRIC_SAFETY_CHECK_KIND)
+
+static const TEST_ENUMERATOR FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND_CLUSTER),
+};
+DEFINE_TEST_ENUM(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND)
+
+static const TEST_ENUMERATOR FABRIC_REPAIR_TARGET_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TARGET_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TARGET_KIND_NODE),
+};
+DEFINE_TEST_ENUM(FABRIC_REPAIR_TARGET_KIND)
+
+static const TEST_ENUMERATOR FABRIC_RESTART_NODE_DESCRIPTION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_RESTART_NODE_DESCRIPTION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_RESTART_NODE_DESCRIPTION_KIND_USING_NODE_NAME),
+};
+DEFINE_TEST_ENUM(FABRIC_RESTART_NODE_DESCRIPTION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_START_NODE_DESCRIPTION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_START_NODE_DESCRIPTION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_START_NODE_DESCRIPTION_KIND_USING_NODE_NAME),
+};
+DEFINE_TEST_ENUM(FABRIC_START_NODE_DESCRIPTION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_STOP_NODE_DESCRIPTION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_STOP_NODE_DESCRIPTION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_STOP_NODE_DESCRIPTION_KIND_USING_NODE_NAME),
+};
+DEFINE_TEST_ENUM(FABRIC_STOP_NODE_DESCRIPTION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND_USING_NODE_NAME),
+};
+DEFINE_TEST_ENUM(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_REPAIR_TASK_STATE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_STATE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_STATE_CREATED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_STATE_CLAIMED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_STATE_PREPARING),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_STATE_APPROVED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_STATE_EXECUTING),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_STATE_RESTORING),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_STATE_COMPLETED),
+};
+DEFINE_TEST_ENUM(FABRIC_REPAIR_TASK_STATE)
+
+static const TEST_ENUMERATOR FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_NOT_STARTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SUCCEEDED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_SKIPPED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE_TIMEDOUT),
+};
+DEFINE_TEST_ENUM(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE)
+
+static const TEST_ENUMERATOR FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_PREPARING_HEALTH_CHECK),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_HONOR_PERFORM_RESTORING_HEALTH_CHECK),
+};
+DEFINE_TEST_ENUM(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS)
+
+static const TEST_ENUMERATOR FABRIC_REPAIR_IMPACT_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_IMPACT_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_IMPACT_KIND_NODE),
+};
+DEFINE_TEST_ENUM(FABRIC_REPAIR_IMPACT_KIND)
+
+static const TEST_ENUMERATOR FABRIC_REPAIR_NODE_IMPACT_LEVEL_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_NODE_IMPACT_LEVEL_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_NODE_IMPACT_LEVEL_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_NODE_IMPACT_LEVEL_RESTART),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_DATA),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_NODE_IMPACT_LEVEL_REMOVE_NODE),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_NODE_IMPACT_LEVEL_PAUSE),
+};
+DEFINE_TEST_ENUM(FABRIC_REPAIR_NODE_IMPACT_LEVEL)
+
+static const TEST_ENUMERATOR FABRIC_REPAIR_TASK_RESULT_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_RESULT_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_RESULT_SUCCEEDED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_RESULT_CANCELLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_RESULT_INTERRUPTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_RESULT_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_REPAIR_TASK_RESULT_PENDING),
+};
+DEFINE_TEST_ENUM(FABRIC_REPAIR_TASK_RESULT)
+
+static const TEST_ENUMERATOR FABRIC_NODE_DEACTIVATION_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_STATUS_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_IN_PROGRESS),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_STATUS_SAFETY_CHECK_COMPLETE),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_STATUS_COMPLETED),
+};
+DEFINE_TEST_ENUM(FABRIC_NODE_DEACTIVATION_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_NODE_DEACTIVATION_TASK_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_TASK_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_TASK_TYPE_INFRASTRUCTURE),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_TASK_TYPE_REPAIR),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_DEACTIVATION_TASK_TYPE_CLIENT),
+};
+DEFINE_TEST_ENUM(FABRIC_NODE_DEACTIVATION_TASK_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_PARTITION_SELECTOR_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SELECTOR_TYPE_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SELECTOR_TYPE_SINGLETON),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SELECTOR_TYPE_NAMED),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SELECTOR_TYPE_UNIFORM_INT64),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SELECTOR_TYPE_PARTITION_ID),
+    TEST_ENUMERATOR_VALUE(FABRIC_PARTITION_SELECTOR_TYPE_RANDOM),
+};
+DEFINE_TEST_ENUM(FABRIC_PARTITION_SELECTOR_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_DATA_LOSS_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_DATA_LOSS_MODE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_DATA_LOSS_MODE_PARTIAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_DATA_LOSS_MODE_FULL),
+};
+DEFINE_TEST_ENUM(FABRIC_DATA_LOSS_MODE)
+
+static const TEST_ENUMERATOR FABRIC_TEST_COMMAND_PROGRESS_STATE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_PROGRESS_STATE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_PROGRESS_STATE_RUNNING),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_PROGRESS_STATE_ROLLING_BACK),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_PROGRESS_STATE_COMPLETED),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_PROGRESS_STATE_FAULTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_PROGRESS_STATE_CANCELLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_PROGRESS_STATE_FORCE_CANCELLED),
+};
+DEFINE_TEST_ENUM(FABRIC_TEST_COMMAND_PROGRESS_STATE)
+
+static const TEST_ENUMERATOR FABRIC_QUORUM_LOSS_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_QUORUM_LOSS_MODE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUORUM_LOSS_MODE_QUORUM_REPLICAS),
+    TEST_ENUMERATOR_VALUE(FABRIC_QUORUM_LOSS_MODE_ALL_REPLICAS),
+};
+DEFINE_TEST_ENUM(FABRIC_QUORUM_LOSS_MODE)
+
+static const TEST_ENUMERATOR FABRIC_RESTART_PARTITION_MODE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_RESTART_PARTITION_MODE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_RESTART_PARTITION_MODE_ALL_REPLICAS_OR_INSTANCES),
+    TEST_ENUMERATOR_VALUE(FABRIC_RESTART_PARTITION_MODE_ONLY_ACTIVE_SECONDARIES),
+};
+DEFINE_TEST_ENUM(FABRIC_RESTART_PARTITION_MODE)
+
+static const TEST_ENUMERATOR FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_NODE_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR),
+};
+DEFINE_TEST_ENUM(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_NODE_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR),
+};
+DEFINE_TEST_ENUM(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_NODE_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND_USING_REPLICA_SELECTOR),
+};
+DEFINE_TEST_ENUM(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_NODE_NAME),
+    TEST_ENUMERATOR_VALUE(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND_USING_REPLICA_SELECTOR),
+};
+DEFINE_TEST_ENUM(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND)
+
+static const TEST_ENUMERATOR FABRIC_NODE_TRANSITION_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_TRANSITION_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_TRANSITION_TYPE_START),
+    TEST_ENUMERATOR_VALUE(FABRIC_NODE_TRANSITION_TYPE_STOP),
+};
+DEFINE_TEST_ENUM(FABRIC_NODE_TRANSITION_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_RECONFIGURATION_PHASE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_PHASE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_PHASE_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_PHASE_ZERO),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_PHASE_ONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_PHASE_TWO),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_PHASE_THREE),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_PHASE_FOUR),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_ABORT_PHASE_ZERO),
+};
+DEFINE_TEST_ENUM(FABRIC_RECONFIGURATION_PHASE)
+
+static const TEST_ENUMERATOR FABRIC_RECONFIGURATION_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_TYPE_SWAPPRIMARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_TYPE_FAILOVER),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_TYPE_OTHER),
+    TEST_ENUMERATOR_VALUE(FABRIC_RECONFIGURATION_TYPE_NONE),
+};
+DEFINE_TEST_ENUM(FABRIC_RECONFIGURATION_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_CHAOS_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_STATUS_RUNNING),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_STATUS_STOPPED),
+};
+DEFINE_TEST_ENUM(FABRIC_CHAOS_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_CHAOS_SCHEDULE_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_SCHEDULE_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_SCHEDULE_STATUS_ACTIVE),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_SCHEDULE_STATUS_EXPIRED),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_SCHEDULE_STATUS_PENDING),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_SCHEDULE_STATUS_STOPPED),
+};
+DEFINE_TEST_ENUM(FABRIC_CHAOS_SCHEDULE_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_CHAOS_EVENT_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_EVENT_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_EVENT_KIND_STARTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_EVENT_KIND_EXECUTING_FAULTS),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_EVENT_KIND_WAITING),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_EVENT_KIND_VALIDATION_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_EVENT_KIND_TEST_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_CHAOS_EVENT_KIND_STOPPED),
+};
+DEFINE_TEST_ENUM(FABRIC_CHAOS_EVENT_KIND)
+
+static const TEST_ENUMERATOR FABRIC_PROVISION_APPLICATION_TYPE_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_PROVISION_APPLICATION_TYPE_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROVISION_APPLICATION_TYPE_KIND_IMAGE_STORE_PATH),
+    TEST_ENUMERATOR_VALUE(FABRIC_PROVISION_APPLICATION_TYPE_KIND_EXTERNAL_STORE),
+};
+DEFINE_TEST_ENUM(FABRIC_PROVISION_APPLICATION_TYPE_KIND)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_AUTOMATIC),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY_MANUAL),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY)
+
+static const TEST_ENUMERATOR FABRIC_DIAGNOSTICS_SINKS_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_DIAGNOSTICS_SINKS_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_DIAGNOSTICS_SINKS_KIND_AZUREINTERNAL),
+};
+DEFINE_TEST_ENUM(FABRIC_DIAGNOSTICS_SINKS_KIND)
+
+static const TEST_ENUMERATOR FABRIC_PLACEMENT_POLICY_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_PLACEMENT_POLICY_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_PLACEMENT_POLICY_INVALID_DOMAIN),
+    TEST_ENUMERATOR_VALUE(FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN),
+    TEST_ENUMERATOR_VALUE(FABRIC_PLACEMENT_POLICY_PREFERRED_PRIMARY_DOMAIN),
+    TEST_ENUMERATOR_VALUE(FABRIC_PLACEMENT_POLICY_REQUIRED_DOMAIN_DISTRIBUTION),
+    TEST_ENUMERATOR_VALUE(FABRIC_PLACEMENT_POLICY_NONPARTIALLY_PLACE_SERVICE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PLACEMENT_POLICY_ALLOW_MULTIPLE_STATELESS_INSTANCES_ON_NODE),
+};
+DEFINE_TEST_ENUM(FABRIC_PLACEMENT_POLICY_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_PACKAGE_SHARING_POLICY_SCOPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_PACKAGE_SHARING_POLICY_SCOPE_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PACKAGE_SHARING_POLICY_SCOPE_ALL),
+    TEST_ENUMERATOR_VALUE(FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CODE),
+    TEST_ENUMERATOR_VALUE(FABRIC_PACKAGE_SHARING_POLICY_SCOPE_CONFIG),
+    TEST_ENUMERATOR_VALUE(FABRIC_PACKAGE_SHARING_POLICY_SCOPE_DATA),
+};
+DEFINE_TEST_ENUM(FABRIC_PACKAGE_SHARING_POLICY_SCOPE)
+
+static const TEST_ENUMERATOR FABRIC_HEALTH_STATE_FILTER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_FILTER_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_FILTER_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_FILTER_OK),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_FILTER_WARNING),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_FILTER_ERROR),
+    TEST_ENUMERATOR_VALUE(FABRIC_HEALTH_STATE_FILTER_ALL),
+};
+DEFINE_TEST_ENUM(FABRIC_HEALTH_STATE_FILTER)
+
+static const TEST_ENUMERATOR FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MINNODES),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_MAXNODES),
+    TEST_ENUMERATOR_VALUE(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS_METRICS),
+};
+DEFINE_TEST_ENUM(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS)
+
+static const TEST_ENUMERATOR FABRIC_SCALING_TRIGGER_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SCALING_TRIGGER_KIND_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SCALING_TRIGGER_KIND_AVERAGE_PARTITION_LOAD),
+    TEST_ENUMERATOR_VALUE(FABRIC_SCALING_TRIGGER_KIND_AVERAGE_SERVICE_LOAD),
+};
+DEFINE_TEST_ENUM(FABRIC_SCALING_TRIGGER_KIND)
+
+static const TEST_ENUMERATOR FABRIC_SCALING_MECHANISM_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SCALING_MECHANISM_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SCALING_MECHANISM_KIND_SCALE_PARTITION_INSTANCE_COUNT),
+    TEST_ENUMERATOR_VALUE(FABRIC_SCALING_MECHANISM_KIND_ADD_REMOVE_INCREMENTAL_NAMED_PARTITION),
+};
+DEFINE_TEST_ENUM(FABRIC_SCALING_MECHANISM_KIND)
+
+static const TEST_ENUMERATOR FABRIC_TEST_COMMAND_STATE_FILTER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_STATE_FILTER_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_STATE_FILTER_RUNNING),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_STATE_FILTER_ROLLING_BACK),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_STATE_FILTER_COMPLETED_SUCCESSFULLY),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_STATE_FILTER_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_STATE_FILTER_CANCELLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_STATE_FILTER_FORCE_CANCELLED),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_STATE_FILTER_ALL),
+};
+DEFINE_TEST_ENUM(FABRIC_TEST_COMMAND_STATE_FILTER)
+
+static const TEST_ENUMERATOR FABRIC_TEST_COMMAND_TYPE_FILTER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_FILTER_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_DATA_LOSS),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_QUORUM_LOSS),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_FILTER_PARTITION_RESTART),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_FILTER_ALL),
+};
+DEFINE_TEST_ENUM(FABRIC_TEST_COMMAND_TYPE_FILTER)
+
+static const TEST_ENUMERATOR FABRIC_TEST_COMMAND_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_INVOKE_DATA_LOSS),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_INVOKE_QUORUM_LOSS),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_INVOKE_RESTART_PARTITION),
+    TEST_ENUMERATOR_VALUE(FABRIC_TEST_COMMAND_TYPE_START_NODE_TRANSITION),
+};
+DEFINE_TEST_ENUM(FABRIC_TEST_COMMAND_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_INACTIVE),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_MIGRATION),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_SWAP),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_CLEANUP),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_SOURCE_DATABASE_CLEANUP),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_TARGET_DATABASE_ACTIVE),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE_RESTORE_SOURCE_BACKUP),
+};
+DEFINE_TEST_ENUM(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE)
+
+static const TEST_ENUMERATOR FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_INACTIVE),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_PROCESSING),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_COMPLETED),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_CANCELED),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE_FAILED),
+};
+DEFINE_TEST_ENUM(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE)
+
+static const TEST_ENUMERATOR FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_UNKNOWN),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_ESE),
+    TEST_ENUMERATOR_VALUE(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND_TSTORE),
+};
+DEFINE_TEST_ENUM(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND)
+
+static const TEST_ENUMERATOR FABRIC_NETWORK_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_TYPE_LOCAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_TYPE_FEDERATED),
+};
+DEFINE_TEST_ENUM(FABRIC_NETWORK_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_NETWORK_STATUS_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_CREATING),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_DELETING),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_UPDATING),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_FAILED),
+};
+DEFINE_TEST_ENUM(FABRIC_NETWORK_STATUS)
+
+static const TEST_ENUMERATOR FABRIC_NETWORK_STATUS_FILTER_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_FILTER_DEFAULT),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_FILTER_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_FILTER_CREATING),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_FILTER_DELETING),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_FILTER_UPDATING),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_FILTER_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_NETWORK_STATUS_FILTER_ALL),
+};
+DEFINE_TEST_ENUM(FABRIC_NETWORK_STATUS_FILTER)
+
+static const TEST_ENUMERATOR FABRIC_ORDERING_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_ORDERING_DESC),
+    TEST_ENUMERATOR_VALUE(FABRIC_ORDERING_ASC),
+};
+DEFINE_TEST_ENUM(FABRIC_ORDERING)
+
+static const TEST_ENUMERATOR FABRIC_BLOCK_LIST_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_BLOCK_LIST_TYPE_SERVICE),
+    TEST_ENUMERATOR_VALUE(FABRIC_BLOCK_LIST_TYPE_OVERALL),
+    TEST_ENUMERATOR_VALUE(FABRIC_BLOCK_LIST_TYPE_PREFERRED_PRIMARY),
+    TEST_ENUMERATOR_VALUE(FABRIC_BLOCK_LIST_TYPE_PLACEMENT_TAGS),
+    TEST_ENUMERATOR_VALUE(FABRIC_BLOCK_LIST_TYPE_RUNNING_TAGS),
+};
+DEFINE_TEST_ENUM(FABRIC_BLOCK_LIST_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_STORE_BACKUP_OPTION_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_STORE_BACKUP_OPTION_FULL),
+    TEST_ENUMERATOR_VALUE(FABRIC_STORE_BACKUP_OPTION_INCREMENTAL),
+    TEST_ENUMERATOR_VALUE(FABRIC_STORE_BACKUP_OPTION_TRUNCATE_LOGS_ONLY),
+};
+DEFINE_TEST_ENUM(FABRIC_STORE_BACKUP_OPTION)
+
+static const TEST_ENUMERATOR FABRIC_CODE_PACKAGE_EVENT_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_EVENT_TYPE_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_EVENT_TYPE_START_FAILED),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_EVENT_TYPE_STARTED),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_EVENT_TYPE_READY),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_EVENT_TYPE_HEALTH),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_EVENT_TYPE_STOPPED),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_EVENT_TYPE_TERMINATED),
+    TEST_ENUMERATOR_VALUE(FABRIC_CODE_PACKAGE_EVENT_TYPE_RAN_TO_COMPLETION),
+};
+DEFINE_TEST_ENUM(FABRIC_CODE_PACKAGE_EVENT_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_SERVICE_HOST_UPGRADE_IMPACT_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_HOST_UPGRADE_IMPACT_INVALID),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_HOST_UPGRADE_IMPACT_NONE),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_HOST_UPGRADE_IMPACT_SERVICE_HOST_RESTART),
+    TEST_ENUMERATOR_VALUE(FABRIC_SERVICE_HOST_UPGRADE_IMPACT_UNEXPECTED_SERVICE_HOST_RESTART),
+};
+DEFINE_TEST_ENUM(FABRIC_SERVICE_HOST_UPGRADE_IMPACT)
+
+static const TEST_ENUMERATOR FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_ALWAYS),
+    TEST_ENUMERATOR_VALUE(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE_RUN_TO_COMPLETION),
+};
+DEFINE_TEST_ENUM(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE)
+
+static const TEST_ENUMERATOR FABRIC_EXECUTION_POLICY_RESTART_POLICY_enumerators[] =
+{
+    TEST_ENUMERATOR_VALUE(FABRIC_EXECUTION_POLICY_RESTART_POLICY_ALWAYS),
+    TEST_ENUMERATOR_VALUE(FABRIC_EXECUTION_POLICY_RESTART_POLICY_ON_FAILURE),
+    TEST_ENUMERATOR_VALUE(FABRIC_EXECUTION_POLICY_RESTART_POLICY_NEVER),
+};
+DEFINE_TEST_ENUM(FABRIC_EXECUTION_POLICY_RESTART_POLICY)
+
+static const TEST_ENUM test_enums[] =
+{
+    TEST_ENUM_ENTRY(FABRIC_ERROR_CODE),
+    TEST_ENUM_ENTRY(FABRIC_CLIENT_ROLE),
+    TEST_ENUM_ENTRY(FABRIC_QUERY_SERVICE_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_QUERY_NODE_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_QUERY_NODE_STATUS_FILTER),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_KIND),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_PARTITION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_QUERY_SERVICE_PARTITION_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_QUERY_SERVICE_REPLICA_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_QUERY_SERVICE_REPLICA_STATUS_FILTER),
+    TEST_ENUM_ENTRY(FABRIC_QUERY_SERVICE_OPERATION_NAME),
+    TEST_ENUM_ENTRY(FABRIC_QUERY_REPLICATOR_OPERATION_NAME),
+    TEST_ENUM_ENTRY(FABRIC_CODE_PACKAGE_ENTRY_POINT_KIND),
+    TEST_ENUM_ENTRY(FABRIC_EXEHOST_WORKING_FOLDER),
+    TEST_ENUM_ENTRY(FABRIC_DLLHOST_HOSTED_DLL_KIND),
+    TEST_ENUM_ENTRY(FABRIC_DLLHOST_ISOLATION_POLICY),
+    TEST_ENUM_ENTRY(FABRIC_SECURITY_CREDENTIAL_KIND),
+    TEST_ENUM_ENTRY(FABRIC_CLAIMS_RETRIEVAL_METADATA_KIND),
+    TEST_ENUM_ENTRY(FABRIC_PROTECTION_LEVEL),
+    TEST_ENUM_ENTRY(FABRIC_X509_STORE_LOCATION),
+    TEST_ENUM_ENTRY(FABRIC_X509_FIND_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_LOAD_METRIC_WEIGHT),
+    TEST_ENUM_ENTRY(FABRIC_MOVE_COST),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_PACKAGE_ACTIVATION_MODE),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_CORRELATION_SCHEME),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_PARTITION_ACCESS_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_REPLICA_ROLE),
+    TEST_ENUM_ENTRY(FABRIC_REPLICA_OPEN_MODE),
+    TEST_ENUM_ENTRY(FABRIC_REPLICA_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_OPERATION_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_REPLICA_SET_QUORUM_MODE),
+    TEST_ENUM_ENTRY(FABRIC_REPLICATOR_SETTINGS_FLAGS),
+    TEST_ENUM_ENTRY(FABRIC_FAULT_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_HEALTH_STATE),
+    TEST_ENUM_ENTRY(FABRIC_HEALTH_REPORT_KIND),
+    TEST_ENUM_ENTRY(FABRIC_HEALTH_ENTITY_KIND),
+    TEST_ENUM_ENTRY(FABRIC_HEALTH_EVALUATION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_PROPERTY_TYPE_ID),
+    TEST_ENUM_ENTRY(FABRIC_PROPERTY_BATCH_OPERATION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_ENDPOINT_ROLE),
+    TEST_ENUM_ENTRY(FABRIC_ENUMERATION_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_PARTITION_KEY_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_PARTITION_SCHEME),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_DESCRIPTION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_STATEFUL_SERVICE_FAILOVER_SETTINGS_FLAGS),
+    TEST_ENUM_ENTRY(FABRIC_STATELESS_SERVICE_FAILOVER_SETTINGS_FLAGS),
+    TEST_ENUM_ENTRY(FABRIC_STATELESS_SERVICE_UPDATE_DESCRIPTION_FLAGS),
+    TEST_ENUM_ENTRY(FABRIC_STATEFUL_SERVICE_UPDATE_DESCRIPTION_FLAGS),
+    TEST_ENUM_ENTRY(FABRIC_SELF_RECONFIGURING_INSTANCE_OPEN_MODE),
+    TEST_ENUM_ENTRY(FABRIC_SELF_RECONFIGURING_INSTANCE_ROLE),
+    TEST_ENUM_ENTRY(FABRIC_SELF_RECONFIGURING_INSTANCE_ACTIVATION_STATE),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_NOTIFICATION_FILTER_FLAGS),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_UPGRADE_KIND),
+    TEST_ENUM_ENTRY(FABRIC_UPGRADE_KIND),
+    TEST_ENUM_ENTRY(FABRIC_UPGRADE_SORT_ORDER),
+    TEST_ENUM_ENTRY(FABRIC_ROLLING_UPGRADE_MODE),
+    TEST_ENUM_ENTRY(FABRIC_MONITORED_UPGRADE_FAILURE_ACTION),
+    TEST_ENUM_ENTRY(FABRIC_MONITORED_UPGRADE_HEALTH_CHECK_PHASE),
+    TEST_ENUM_ENTRY(FABRIC_ROLLING_UPGRADE_UPDATE_FLAGS),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_UPGRADE_STATE),
+    TEST_ENUM_ENTRY(FABRIC_UPGRADE_STATE),
+    TEST_ENUM_ENTRY(FABRIC_UPGRADE_DOMAIN_STATE),
+    TEST_ENUM_ENTRY(FABRIC_UPGRADE_FAILURE_REASON),
+    TEST_ENUM_ENTRY(FABRIC_LOCAL_STORE_KIND),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_REPLICA_KIND),
+    TEST_ENUM_ENTRY(FABRIC_KEY_VALUE_STORE_NOTIFICATION_MODE),
+    TEST_ENUM_ENTRY(FABRIC_KEY_VALUE_STORE_FULL_COPY_MODE),
+    TEST_ENUM_ENTRY(FABRIC_TRANSACTION_ISOLATION_LEVEL),
+    TEST_ENUM_ENTRY(FABRIC_NODE_DEACTIVATION_INTENT),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_DISABLE_FLAG),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_TYPE_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_DEFINITION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_TYPE_DEFINITION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_DEFINITION_KIND_FILTER),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_TYPE_DEFINITION_KIND_FILTER),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_TYPE_REGISTRATION_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_DEPLOYMENT_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_HOST_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_HOST_ISOLATION_MODE),
+    TEST_ENUM_ENTRY(FABRIC_ENTRY_POINT_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_NODE_UPGRADE_PHASE),
+    TEST_ENUM_ENTRY(FABRIC_UPGRADE_SAFETY_CHECK_KIND),
+    TEST_ENUM_ENTRY(FABRIC_SAFETY_CHECK_KIND),
+    TEST_ENUM_ENTRY(FABRIC_REPAIR_SCOPE_IDENTIFIER_KIND),
+    TEST_ENUM_ENTRY(FABRIC_REPAIR_TARGET_KIND),
+    TEST_ENUM_ENTRY(FABRIC_RESTART_NODE_DESCRIPTION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_START_NODE_DESCRIPTION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_STOP_NODE_DESCRIPTION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_RESTART_DEPLOYED_CODE_PACKAGE_DESCRIPTION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_REPAIR_TASK_STATE),
+    TEST_ENUM_ENTRY(FABRIC_REPAIR_TASK_HEALTH_CHECK_STATE),
+    TEST_ENUM_ENTRY(FABRIC_REPAIR_TASK_HEALTH_POLICY_UPDATE_SETTINGS_FLAGS),
+    TEST_ENUM_ENTRY(FABRIC_REPAIR_IMPACT_KIND),
+    TEST_ENUM_ENTRY(FABRIC_REPAIR_NODE_IMPACT_LEVEL),
+    TEST_ENUM_ENTRY(FABRIC_REPAIR_TASK_RESULT),
+    TEST_ENUM_ENTRY(FABRIC_NODE_DEACTIVATION_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_NODE_DEACTIVATION_TASK_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_PARTITION_SELECTOR_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_DATA_LOSS_MODE),
+    TEST_ENUM_ENTRY(FABRIC_TEST_COMMAND_PROGRESS_STATE),
+    TEST_ENUM_ENTRY(FABRIC_QUORUM_LOSS_MODE),
+    TEST_ENUM_ENTRY(FABRIC_RESTART_PARTITION_MODE),
+    TEST_ENUM_ENTRY(FABRIC_MOVE_PRIMARY_DESCRIPTION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_MOVE_SECONDARY_DESCRIPTION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_MOVE_INSTANCE_DESCRIPTION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_MOVE_AUXILIARY_DESCRIPTION_KIND),
+    TEST_ENUM_ENTRY(FABRIC_NODE_TRANSITION_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_RECONFIGURATION_PHASE),
+    TEST_ENUM_ENTRY(FABRIC_RECONFIGURATION_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_CHAOS_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_CHAOS_SCHEDULE_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_CHAOS_EVENT_KIND),
+    TEST_ENUM_ENTRY(FABRIC_PROVISION_APPLICATION_TYPE_KIND),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_PACKAGE_CLEANUP_POLICY),
+    TEST_ENUM_ENTRY(FABRIC_DIAGNOSTICS_SINKS_KIND),
+    TEST_ENUM_ENTRY(FABRIC_PLACEMENT_POLICY_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_PACKAGE_SHARING_POLICY_SCOPE),
+    TEST_ENUM_ENTRY(FABRIC_HEALTH_STATE_FILTER),
+    TEST_ENUM_ENTRY(FABRIC_APPLICATION_UPDATE_DESCRIPTION_FLAGS),
+    TEST_ENUM_ENTRY(FABRIC_SCALING_TRIGGER_KIND),
+    TEST_ENUM_ENTRY(FABRIC_SCALING_MECHANISM_KIND),
+    TEST_ENUM_ENTRY(FABRIC_TEST_COMMAND_STATE_FILTER),
+    TEST_ENUM_ENTRY(FABRIC_TEST_COMMAND_TYPE_FILTER),
+    TEST_ENUM_ENTRY(FABRIC_TEST_COMMAND_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_KEY_VALUE_STORE_MIGRATION_PHASE),
+    TEST_ENUM_ENTRY(FABRIC_KEY_VALUE_STORE_MIGRATION_STATE),
+    TEST_ENUM_ENTRY(FABRIC_KEY_VALUE_STORE_PROVIDER_KIND),
+    TEST_ENUM_ENTRY(FABRIC_NETWORK_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_NETWORK_STATUS),
+    TEST_ENUM_ENTRY(FABRIC_NETWORK_STATUS_FILTER),
+    TEST_ENUM_ENTRY(FABRIC_ORDERING),
+    TEST_ENUM_ENTRY(FABRIC_BLOCK_LIST_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_STORE_BACKUP_OPTION),
+    TEST_ENUM_ENTRY(FABRIC_CODE_PACKAGE_EVENT_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_SERVICE_HOST_UPGRADE_IMPACT),
+    TEST_ENUM_ENTRY(FABRIC_EXECUTION_POLICY_EXECUTION_TYPE),
+    TEST_ENUM_ENTRY(FABRIC_EXECUTION_POLICY_RESTART_POLICY),
+};
+
+static bool is_enumerator_value(const TEST_ENUM* test_enum, int64_t value)
+{
+    bool result = false;
+    for (uint32_t i = 0; i < test_enum->enumerator_count; i++)
+    {
+        if (test_enum->enumerators[i].value == value)
+        {
+            result = true;
+            break;
+        }
+    }
+    return result;
+}
+
+static bool is_enumerator_name(const TEST_ENUM* test_enum, const char* name)
+{
+    bool result = false;
+    for (uint32_t i = 0; i < test_enum->enumerator_count; i++)
+    {
+        if (strcmp(test_enum->enumerators[i].name, name) == 0)
+        {
+            result = true;
+            break;
+        }
+    }
+    return result;
+}
+
+static void assert_from_string_fails_unless_enumerator_name(const TEST_ENUM* test_enum, const char* enum_as_string)
+{
+    if (!is_enumerator_name(test_enum, enum_as_string))
+    {
+        int value;
+        ASSERT_ARE_NOT_EQUAL(int, 0, test_enum->from_string(enum_as_string, &value), "%s", enum_as_string);
+        ASSERT_ARE_NOT_EQUAL(int, 0, test_enum->from_string_case_insensitive(enum_as_string, &value), "%s", enum_as_string);
+    }
+}
+
+static void get_enumerator_range(const TEST_ENUM* test_enum, int64_t* min_value, int64_t* max_value)
+{
+    *min_value = test_enum->enumerators[0].value;
+    *max_value = test_enum->enumerators[0].value;
+    for (uint32_t i = 1; i < test_enum->enumerator_count; i++)
+    {
+        if (test_enum->enumerators[i].value < *min_value)
+        {
+            *min_value = test_enum->enumerators[i].value;
+        }
+        if (test_enum->enumerators[i].value > *max_value)
+        {
+            *max_value = test_enum->enumerators[i].value;
+        }
+    }
+}
+
+/*longer than any enumerator name*/
+#define TEST_NAME_BUFFER_SIZE 128
+
+/*upper case letters at even positions, lower case letters at odd positions*/
+static void make_mixed_case(const char* name, char* mixed_case_name)
+{
+    ASSERT_IS_TRUE(strlen(name) < TEST_NAME_BUFFER_SIZE, "%s", name);
+    size_t i;
+    for (i = 0; name[i] != '\0'; i++)
+    {
+        mixed_case_name[i] = ((i % 2) == 0) ? (char)toupper((unsigned char)name[i]) : (char)tolower((unsigned char)name[i]);
+    }
+    mixed_case_name[i] = '\0';
+}
+
+/*sf_enum_hash folds every character with c | 0x20, so changing the first '_' to DEL (0x7F) gives a string with the same hash and a different text*/
+static void make_hash_colliding_name(const char* name, char* colliding_name)
+{
+    ASSERT_IS_TRUE(strlen(name) < TEST_NAME_BUFFER_SIZE, "%s", name);
+    (void)strcpy(colliding_name, name);
+    char* underscore = strchr(colliding_name, '_');
+    ASSERT_IS_NOT_NULL(underscore, "%s", name);
+    *underscore = (char)0x7F;
+}
+
+static void assert_to_string_is_unknown_unless_enumerator(const TEST_ENUM* test_enum, int64_t value)
+{
+    if ((value >= INT32_MIN) && (value <= INT32_MAX) && !is_enumerator_value(test_enum, value))
+    {
+        ASSERT_ARE_EQUAL(char_ptr, "UNKNOWN", test_enum->to_string((int)value), "%s value %" PRId64 "", test_enum->enum_name, value);
+    }
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+}
+
+/* _ToString */
+
+TEST_FUNCTION(ToString_returns_the_string_of_every_value_of_every_enum)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        for (uint32_t j = 0; j < test_enums[i].enumerator_count; j++)
+        {
+            ///arrange
+            const TEST_ENUMERATOR* enumerator = &test_enums[i].enumerators[j];
+
+            ///act
+            const char* result = test_enums[i].to_string(enumerator->value);
+
+            ///assert
+            ASSERT_ARE_EQUAL(char_ptr, enumerator->value_as_string, result, "%s", enumerator->name);
+        }
+    }
+}
+
+TEST_FUNCTION(ToString_returns_UNKNOWN_for_the_values_just_outside_every_enum)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        ///arrange
+        int64_t min_value;
+        int64_t max_value;
+        get_enumerator_range(&test_enums[i], &min_value, &max_value);
+
+        ///act
+        ///assert
+        assert_to_string_is_unknown_unless_enumerator(&test_enums[i], min_value - 1);
+        assert_to_string_is_unknown_unless_enumerator(&test_enums[i], max_value + 1);
+    }
+}
+
+TEST_FUNCTION(ToString_returns_UNKNOWN_for_the_gaps_of_every_enum)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        ///arrange
+        int64_t min_value;
+        int64_t max_value;
+        get_enumerator_range(&test_enums[i], &min_value, &max_value);
+
+        ///act
+        ///assert
+        if (max_value - min_value <= 2 * (int64_t)test_enums[i].enumerator_count)
+        {
+            /*small enough for the array indexed by [value - first], every value of the range is checked*/
+            for (int64_t value = min_value; value <= max_value; value++)
+            {
+                assert_to_string_is_unknown_unless_enumerator(&test_enums[i], value);
+            }
+        }
+        else
+        {
+            /*looked up with a binary search, the values right next to each enumerator are checked*/
+            for (uint32_t j = 0; j < test_enums[i].enumerator_count; j++)
+            {
+                assert_to_string_is_unknown_unless_enumerator(&test_enums[i], (int64_t)test_enums[i].enumerators[j].value - 1);
+                assert_to_string_is_unknown_unless_enumerator(&test_enums[i], (int64_t)test_enums[i].enumerators[j].value + 1);
+            }
+        }
+    }
+}
+
+TEST_FUNCTION(FABRIC_CLIENT_ROLE_ToString_returns_the_string_from_the_array)
+{
+    ///arrange
+
+    ///act
+    const char* result_first = MU_ENUM_TO_STRING(FABRIC_CLIENT_ROLE, FABRIC_CLIENT_ROLE_UNKNOWN);
+    const char* result_last = MU_ENUM_TO_STRING(FABRIC_CLIENT_ROLE, FABRIC_CLIENT_ROLE_ELEVATED_ADMIN);
+    const char* result_after_last = MU_ENUM_TO_STRING(FABRIC_CLIENT_ROLE, (FABRIC_CLIENT_ROLE)(FABRIC_CLIENT_ROLE_ELEVATED_ADMIN + 1));
+    const char* result_before_first = MU_ENUM_TO_STRING(FABRIC_CLIENT_ROLE, (FABRIC_CLIENT_ROLE)(FABRIC_CLIENT_ROLE_UNKNOWN - 1));
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, "FABRIC_CLIENT_ROLE_UNKNOWN", result_first);
+    ASSERT_ARE_EQUAL(char_ptr, "FABRIC_CLIENT_ROLE_ELEVATED_ADMIN", result_last);
+    ASSERT_ARE_EQUAL(char_ptr, "UNKNOWN", result_after_last);
+    ASSERT_ARE_EQUAL(char_ptr, "UNKNOWN", result_before_first);
+}
+
+TEST_FUNCTION(FABRIC_ERROR_CODE_ToString_returns_the_string_of_the_first_enumerator_with_the_value)
+{
+    ///arrange
+
+    ///act
+    const char* result_communication_error = MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, FABRIC_E_COMMUNICATION_ERROR);
+    const char* result_last_used_hresult = MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, FABRIC_E_LAST_USED_HRESULT);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, "FABRIC_E_FIRST_RESERVED_HRESULT", result_communication_error);
+    ASSERT_ARE_EQUAL(char_ptr, "FABRIC_E_ENDPOINT_NOT_REFERENCED", result_last_used_hresult);
+}
+
+TEST_FUNCTION(FABRIC_ERROR_CODE_ToString_returns_UNKNOWN_for_HRESULTs_that_are_not_FABRIC_ERROR_CODEs)
+{
+    ///arrange
+
+    ///act
+    const char* result_invalidarg = MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, (FABRIC_ERROR_CODE)E_INVALIDARG);
+    const char* result_s_ok = MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, (FABRIC_ERROR_CODE)S_OK);
+
+    ///assert
+    ASSERT_ARE_EQUAL(char_ptr, "UNKNOWN", result_invalidarg);
+    ASSERT_ARE_EQUAL(char_ptr, "UNKNOWN", result_s_ok);
+}
+
+/* _FromString and _FromStringCaseInsensitive */
+
+TEST_FUNCTION(FromString_returns_the_value_of_every_name_of_every_enum)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        for (uint32_t j = 0; j < test_enums[i].enumerator_count; j++)
+        {
+            ///arrange
+            const TEST_ENUMERATOR* enumerator = &test_enums[i].enumerators[j];
+            int value = enumerator->value + 1;
+            int value_from_first_name = enumerator->value + 1;
+
+            ///act
+            int result = test_enums[i].from_string(enumerator->name, &value);
+            int result_from_first_name = test_enums[i].from_string(enumerator->value_as_string, &value_from_first_name);
+
+            ///assert
+            ASSERT_ARE_EQUAL(int, 0, result, "%s", enumerator->name);
+            ASSERT_ARE_EQUAL(int, enumerator->value, value, "%s", enumerator->name);
+            ASSERT_ARE_EQUAL(int, 0, result_from_first_name, "%s", enumerator->value_as_string);
+            ASSERT_ARE_EQUAL(int, enumerator->value, value_from_first_name, "%s", enumerator->value_as_string);
+        }
+    }
+}
+
+TEST_FUNCTION(FromStringCaseInsensitive_returns_the_value_of_every_name_of_every_enum)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        for (uint32_t j = 0; j < test_enums[i].enumerator_count; j++)
+        {
+            ///arrange
+            const TEST_ENUMERATOR* enumerator = &test_enums[i].enumerators[j];
+            int value = enumerator->value + 1;
+
+            ///act
+            int result = test_enums[i].from_string_case_insensitive(enumerator->name, &value);
+
+            ///assert
+            ASSERT_ARE_EQUAL(int, 0, result, "%s", enumerator->name);
+            ASSERT_ARE_EQUAL(int, enumerator->value, value, "%s", enumerator->name);
+        }
+    }
+}
+
+TEST_FUNCTION(FromStringCaseInsensitive_returns_the_value_of_every_name_in_mixed_case)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        for (uint32_t j = 0; j < test_enums[i].enumerator_count; j++)
+        {
+            ///arrange
+            const TEST_ENUMERATOR* enumerator = &test_enums[i].enumerators[j];
+            char mixed_case_name[TEST_NAME_BUFFER_SIZE];
+            make_mixed_case(enumerator->name, mixed_case_name);
+            int value = enumerator->value + 1;
+
+            ///act
+            int result = test_enums[i].from_string_case_insensitive(mixed_case_name, &value);
+
+            ///assert
+            ASSERT_ARE_EQUAL(int, 0, result, "%s", mixed_case_name);
+            ASSERT_ARE_EQUAL(int, enumerator->value, value, "%s", mixed_case_name);
+        }
+    }
+}
+
+TEST_FUNCTION(FromString_fails_for_every_name_in_mixed_case)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        for (uint32_t j = 0; j < test_enums[i].enumerator_count; j++)
+        {
+            ///arrange
+            const TEST_ENUMERATOR* enumerator = &test_enums[i].enumerators[j];
+            char mixed_case_name[TEST_NAME_BUFFER_SIZE];
+            make_mixed_case(enumerator->name, mixed_case_name);
+            int value;
+
+            ///act
+            int result = test_enums[i].from_string(mixed_case_name, &value);
+
+            ///assert
+            ASSERT_ARE_NOT_EQUAL(int, 0, result, "%s", mixed_case_name);
+        }
+    }
+}
+
+TEST_FUNCTION(FromString_and_FromStringCaseInsensitive_fail_for_strings_with_the_hash_of_a_name)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        for (uint32_t j = 0; j < test_enums[i].enumerator_count; j++)
+        {
+            ///arrange
+            const TEST_ENUMERATOR* enumerator = &test_enums[i].enumerators[j];
+            char colliding_name[TEST_NAME_BUFFER_SIZE];
+            make_hash_colliding_name(enumerator->name, colliding_name);
+            int value;
+
+            ///act
+            int result = test_enums[i].from_string(colliding_name, &value);
+            int result_case_insensitive = test_enums[i].from_string_case_insensitive(colliding_name, &value);
+
+            ///assert
+            ASSERT_ARE_NOT_EQUAL(int, 0, result, "%s", enumerator->name);
+            ASSERT_ARE_NOT_EQUAL(int, 0, result_case_insensitive, "%s", enumerator->name);
+        }
+    }
+}
+
+TEST_FUNCTION(FromString_and_FromStringCaseInsensitive_fail_for_prefixes_and_extensions_of_a_name)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        for (uint32_t j = 0; j < test_enums[i].enumerator_count; j++)
+        {
+            ///arrange
+            const TEST_ENUMERATOR* enumerator = &test_enums[i].enumerators[j];
+            char prefix[TEST_NAME_BUFFER_SIZE];
+            char extension[TEST_NAME_BUFFER_SIZE + 1];
+            size_t length = strlen(enumerator->name);
+            ASSERT_IS_TRUE(length < TEST_NAME_BUFFER_SIZE, "%s", enumerator->name);
+            (void)memcpy(prefix, enumerator->name, length - 1);
+            prefix[length - 1] = '\0';
+            (void)memcpy(extension, enumerator->name, length);
+            extension[length] = 'X';
+            extension[length + 1] = '\0';
+
+            ///act
+            ///assert
+            /*some names are the prefix of another name (FABRIC_HEALTH_EVALUATION_KIND_NODE and FABRIC_HEALTH_EVALUATION_KIND_NODES), those are not checked*/
+            assert_from_string_fails_unless_enumerator_name(&test_enums[i], prefix);
+            assert_from_string_fails_unless_enumerator_name(&test_enums[i], extension);
+        }
+    }
+}
+
+TEST_FUNCTION(FromString_and_FromStringCaseInsensitive_fail_for_empty_and_NULL_strings)
+{
+    for (uint32_t i = 0; i < sizeof(test_enums) / sizeof(test_enums[0]); i++)
+    {
+        ///arrange
+        int value;
+
+        ///act
+        int result_empty = test_enums[i].from_string("", &value);
+        int result_empty_case_insensitive = test_enums[i].from_string_case_insensitive("", &value);
+        int result_null = test_enums[i].from_string(NULL, &value);
+        int result_null_case_insensitive = test_enums[i].from_string_case_insensitive(NULL, &value);
+
+        ///assert
+        ASSERT_ARE_NOT_EQUAL(int, 0, result_empty, "%s", test_enums[i].enum_name);
+        ASSERT_ARE_NOT_EQUAL(int, 0, result_empty_case_insensitive, "%s", test_enums[i].enum_name);
+        ASSERT_ARE_NOT_EQUAL(int, 0, result_null, "%s", test_enums[i].enum_name);
+        ASSERT_ARE_NOT_EQUAL(int, 0, result_null_case_insensitive, "%s", test_enums[i].enum_name);
+    }
+}
+
+TEST_FUNCTION(FromString_fails_for_a_name_of_another_enum)
+{
+    ///arrange
+    FABRIC_ERROR_CODE value;
+
+    ///act
+    int result = FABRIC_ERROR_CODE_FromString("FABRIC_CLIENT_ROLE_USER", &value);
+    int result_case_insensitive = FABRIC_ERROR_CODE_FromStringCaseInsensitive("FABRIC_CLIENT_ROLE_USER", &value);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_NOT_EQUAL(int, 0, result_case_insensitive);
+}
+
+TEST_FUNCTION(FromString_fails_with_NULL_destination)
+{
+    ///arrange
+
+    ///act
+    int result = FABRIC_ERROR_CODE_FromString("FABRIC_E_SERVICE_OFFLINE", NULL);
+    int result_case_insensitive = FABRIC_ERROR_CODE_FromStringCaseInsensitive("FABRIC_E_SERVICE_OFFLINE", NULL);
+
+    ///assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_NOT_EQUAL(int, 0, result_case_insensitive);
+}
+
+TEST_FUNCTION(FABRIC_ERROR_CODE_FromString_returns_the_same_value_for_aliased_names)
+{
+    ///arrange
+    FABRIC_ERROR_CODE value_first_name;
+    FABRIC_ERROR_CODE value_alias;
+
+    ///act
+    int result_first_name = FABRIC_ERROR_CODE_FromString("FABRIC_E_FIRST_RESERVED_HRESULT", &value_first_name);
+    int result_alias = FABRIC_ERROR_CODE_FromString("FABRIC_E_COMMUNICATION_ERROR", &value_alias);
+
+    ///assert
+    ASSERT_ARE_EQUAL(int, 0, result_first_name);
+    ASSERT_ARE_EQUAL(int, 0, result_alias);
+    ASSERT_ARE_EQUAL(int, FABRIC_E_FIRST_RESERVED_HRESULT, value_first_name);
+    ASSERT_ARE_EQUAL(int, FABRIC_E_COMMUNICATION_ERROR, value_alias);
+    ASSERT_ARE_EQUAL(char_ptr, "FABRIC_E_FIRST_RESERVED_HRESULT", MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, value_alias));
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
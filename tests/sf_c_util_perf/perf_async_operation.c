@@ -0,0 +1,233 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+
+#include "windows.h"
+#include "fabriccommon.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+
+#include "com_wrapper/com_wrapper.h"
+
+#include "perf_async_operation.h"
+#include "perf_async_operation_com.h"
+
+typedef struct PERF_ASYNC_OPERATION_TAG
+{
+    int dummy;
+} PERF_ASYNC_OPERATION;
+
+typedef struct PERF_ASYNC_OPERATION_CONTEXT_TAG
+{
+    IFabricAsyncOperationCallback* callback;
+} PERF_ASYNC_OPERATION_CONTEXT;
+
+PERF_ASYNC_OPERATION_HANDLE perf_async_operation_create(void)
+{
+    PERF_ASYNC_OPERATION_HANDLE result = malloc(sizeof(PERF_ASYNC_OPERATION));
+    if (result == NULL)
+    {
+        LogError("failure in malloc(%zu)", sizeof(PERF_ASYNC_OPERATION));
+    }
+    else
+    {
+        // all OK
+    }
+
+    return result;
+}
+
+void perf_async_operation_destroy(PERF_ASYNC_OPERATION_HANDLE perf_async_operation)
+{
+    if (perf_async_operation == NULL)
+    {
+        LogError("Invalid arguments: PERF_ASYNC_OPERATION_HANDLE perf_async_operation=%p", perf_async_operation);
+    }
+    else
+    {
+        free(perf_async_operation);
+    }
+}
+
+/*completes the operation synchronously: the callback is invoked (as Service Fabric does) before Begin returns the context*/
+static HRESULT begin_completed_synchronously(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context)
+{
+    HRESULT result;
+
+    if (
+        (perf_async_operation == NULL) ||
+        (callback == NULL) ||
+        (context == NULL)
+        )
+    {
+        LogError("Invalid arguments: PERF_ASYNC_OPERATION_HANDLE perf_async_operation=%p, IFabricAsyncOperationCallback* callback=%p, IFabricAsyncOperationContext** context=%p",
+            perf_async_operation, callback, context);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context = malloc(sizeof(PERF_ASYNC_OPERATION_CONTEXT));
+        if (perf_async_operation_context == NULL)
+        {
+            LogError("failure in malloc(%zu)", sizeof(PERF_ASYNC_OPERATION_CONTEXT));
+            result = E_OUTOFMEMORY;
+        }
+        else
+        {
+            (void)callback->lpVtbl->AddRef(callback);
+            perf_async_operation_context->callback = callback;
+
+            IFabricAsyncOperationContext* async_operation_context = COM_WRAPPER_CREATE(PERF_ASYNC_OPERATION_CONTEXT_HANDLE, IFabricAsyncOperationContext, perf_async_operation_context, perf_async_operation_context_destroy);
+            if (async_operation_context == NULL)
+            {
+                LogError("failure in COM_WRAPPER_CREATE");
+                perf_async_operation_context_destroy(perf_async_operation_context);
+                result = E_OUTOFMEMORY;
+            }
+            else
+            {
+                callback->lpVtbl->Invoke(callback, async_operation_context);
+                *context = async_operation_context;
+                result = S_OK;
+            }
+        }
+    }
+
+    return result;
+}
+
+HRESULT perf_async_operation_BeginTestOperation(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, int arg1, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context)
+{
+    (void)arg1;
+    return begin_completed_synchronously(perf_async_operation, callback, context);
+}
+
+HRESULT perf_async_operation_EndTestOperation(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationContext* context, int* operation_result_1, double* operation_result_2)
+{
+    HRESULT result;
+
+    if (
+        (perf_async_operation == NULL) ||
+        (context == NULL) ||
+        (operation_result_1 == NULL) ||
+        (operation_result_2 == NULL)
+        )
+    {
+        LogError("Invalid arguments: PERF_ASYNC_OPERATION_HANDLE perf_async_operation=%p, IFabricAsyncOperationContext* context=%p, int* operation_result_1=%p, double* operation_result_2=%p",
+            perf_async_operation, context, operation_result_1, operation_result_2);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        *operation_result_1 = 42;
+        *operation_result_2 = 0.42;
+        result = S_OK;
+    }
+
+    return result;
+}
+
+HRESULT perf_async_operation_BeginTestOperationWithNoBeginArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context)
+{
+    return begin_completed_synchronously(perf_async_operation, callback, context);
+}
+
+HRESULT perf_async_operation_EndTestOperationWithNoBeginArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationContext* context, int* operation_result_1, double* operation_result_2)
+{
+    return perf_async_operation_EndTestOperation(perf_async_operation, context, operation_result_1, operation_result_2);
+}
+
+HRESULT perf_async_operation_BeginTestOperationWithNoEndArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, int arg1, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context)
+{
+    (void)arg1;
+    return begin_completed_synchronously(perf_async_operation, callback, context);
+}
+
+HRESULT perf_async_operation_EndTestOperationWithNoEndArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationContext* context)
+{
+    HRESULT result;
+
+    if (
+        (perf_async_operation == NULL) ||
+        (context == NULL)
+        )
+    {
+        LogError("Invalid arguments: PERF_ASYNC_OPERATION_HANDLE perf_async_operation=%p, IFabricAsyncOperationContext* context=%p",
+            perf_async_operation, context);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        result = S_OK;
+    }
+
+    return result;
+}
+
+HRESULT perf_async_operation_BeginTestOperationWithNoArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context)
+{
+    return begin_completed_synchronously(perf_async_operation, callback, context);
+}
+
+HRESULT perf_async_operation_EndTestOperationWithNoArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationContext* context)
+{
+    return perf_async_operation_EndTestOperationWithNoEndArgs(perf_async_operation, context);
+}
+
+void perf_async_operation_context_destroy(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context)
+{
+    if (perf_async_operation_context == NULL)
+    {
+        LogError("Invalid arguments: PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context=%p", perf_async_operation_context);
+    }
+    else
+    {
+        (void)perf_async_operation_context->callback->lpVtbl->Release(perf_async_operation_context->callback);
+        free(perf_async_operation_context);
+    }
+}
+
+BOOLEAN perf_async_operation_context_IsCompleted(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context)
+{
+    (void)perf_async_operation_context;
+    return TRUE;
+}
+
+BOOLEAN perf_async_operation_context_CompletedSynchronously(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context)
+{
+    (void)perf_async_operation_context;
+    return TRUE;
+}
+
+HRESULT perf_async_operation_context_get_Callback(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context, IFabricAsyncOperationCallback** callback)
+{
+    HRESULT result;
+
+    if (
+        (perf_async_operation_context == NULL) ||
+        (callback == NULL)
+        )
+    {
+        LogError("Invalid arguments: PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context=%p, IFabricAsyncOperationCallback** callback=%p",
+            perf_async_operation_context, callback);
+        result = E_INVALIDARG;
+    }
+    else
+    {
+        (void)perf_async_operation_context->callback->lpVtbl->AddRef(perf_async_operation_context->callback);
+        *callback = perf_async_operation_context->callback;
+        result = S_OK;
+    }
+
+    return result;
+}
+
+HRESULT perf_async_operation_context_Cancel(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context)
+{
+    (void)perf_async_operation_context;
+    return S_OK;
+}
@@ -0,0 +1,32 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef PERF_ASYNC_OPERATION_H
+#define PERF_ASYNC_OPERATION_H
+
+#include "windows.h"
+#include "fabriccommon.h"
+
+/*an ITestAsyncOperation whose TestOperation completes synchronously, so that measuring the async wrappers measures only their own overhead*/
+
+typedef struct PERF_ASYNC_OPERATION_TAG* PERF_ASYNC_OPERATION_HANDLE;
+typedef struct PERF_ASYNC_OPERATION_CONTEXT_TAG* PERF_ASYNC_OPERATION_CONTEXT_HANDLE;
+
+PERF_ASYNC_OPERATION_HANDLE perf_async_operation_create(void);
+void perf_async_operation_destroy(PERF_ASYNC_OPERATION_HANDLE perf_async_operation);
+HRESULT perf_async_operation_BeginTestOperation(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, int arg1, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context);
+HRESULT perf_async_operation_EndTestOperation(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationContext* context, int* operation_result_1, double* operation_result_2);
+HRESULT perf_async_operation_BeginTestOperationWithNoBeginArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context);
+HRESULT perf_async_operation_EndTestOperationWithNoBeginArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationContext* context, int* operation_result_1, double* operation_result_2);
+HRESULT perf_async_operation_BeginTestOperationWithNoEndArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, int arg1, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context);
+HRESULT perf_async_operation_EndTestOperationWithNoEndArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationContext* context);
+HRESULT perf_async_operation_BeginTestOperationWithNoArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationCallback* callback, IFabricAsyncOperationContext** context);
+HRESULT perf_async_operation_EndTestOperationWithNoArgs(PERF_ASYNC_OPERATION_HANDLE perf_async_operation, IFabricAsyncOperationContext* context);
+
+void perf_async_operation_context_destroy(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context);
+BOOLEAN perf_async_operation_context_IsCompleted(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context);
+BOOLEAN perf_async_operation_context_CompletedSynchronously(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context);
+HRESULT perf_async_operation_context_get_Callback(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context, IFabricAsyncOperationCallback** callback);
+HRESULT perf_async_operation_context_Cancel(PERF_ASYNC_OPERATION_CONTEXT_HANDLE perf_async_operation_context);
+
+#endif /* PERF_ASYNC_OPERATION_H */
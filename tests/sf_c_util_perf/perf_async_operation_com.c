@@ -0,0 +1,10 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "com_wrapper/com_wrapper.h"
+
+#include "perf_async_operation.h"
+#include "perf_async_operation_com.h"
+
+DEFINE_COM_WRAPPER_OBJECT(PERF_ASYNC_OPERATION_HANDLE, PERF_ASYNC_OPERATION_HANDLE_INTERFACES);
+DEFINE_COM_WRAPPER_OBJECT(PERF_ASYNC_OPERATION_CONTEXT_HANDLE, PERF_ASYNC_OPERATION_CONTEXT_HANDLE_INTERFACES);
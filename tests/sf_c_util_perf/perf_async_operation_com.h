@@ -0,0 +1,48 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef PERF_ASYNC_OPERATION_COM_H
+#define PERF_ASYNC_OPERATION_COM_H
+
+#include "windows.h"
+#include "unknwn.h"
+#include "fabriccommon.h"
+
+#include "com_wrapper/com_wrapper.h"
+
+#include "testasyncoperation.h"
+#include "perf_async_operation.h"
+
+#define PERF_ASYNC_OPERATION_HANDLE_INTERFACES \
+    COM_WRAPPER_INTERFACE(IUnknown, \
+        COM_WRAPPER_IUNKNOWN_APIS() \
+    ), \
+    COM_WRAPPER_INTERFACE(ITestAsyncOperation, \
+        COM_WRAPPER_IUNKNOWN_APIS(), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_BeginTestOperation, int, arg1, IFabricAsyncOperationCallback*, callback, IFabricAsyncOperationContext**, context), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_EndTestOperation, IFabricAsyncOperationContext*, context, int*, operation_result_1, double*, operation_result_2), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_BeginTestOperationWithNoBeginArgs, IFabricAsyncOperationCallback*, callback, IFabricAsyncOperationContext**, context), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_EndTestOperationWithNoBeginArgs, IFabricAsyncOperationContext*, context, int*, operation_result_1, double*, operation_result_2), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_BeginTestOperationWithNoEndArgs, int, arg1, IFabricAsyncOperationCallback*, callback, IFabricAsyncOperationContext**, context), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_EndTestOperationWithNoEndArgs, IFabricAsyncOperationContext*, context), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_BeginTestOperationWithNoArgs, IFabricAsyncOperationCallback*, callback, IFabricAsyncOperationContext**, context), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_EndTestOperationWithNoArgs, IFabricAsyncOperationContext*, context) \
+    )
+
+DECLARE_COM_WRAPPER_OBJECT(PERF_ASYNC_OPERATION_HANDLE, PERF_ASYNC_OPERATION_HANDLE_INTERFACES);
+
+#define PERF_ASYNC_OPERATION_CONTEXT_HANDLE_INTERFACES \
+    COM_WRAPPER_INTERFACE(IUnknown, \
+        COM_WRAPPER_IUNKNOWN_APIS() \
+    ), \
+    COM_WRAPPER_INTERFACE(IFabricAsyncOperationContext, \
+        COM_WRAPPER_IUNKNOWN_APIS(), \
+        COM_WRAPPER_FUNCTION_WRAPPER(BOOLEAN, perf_async_operation_context_IsCompleted), \
+        COM_WRAPPER_FUNCTION_WRAPPER(BOOLEAN, perf_async_operation_context_CompletedSynchronously), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_context_get_Callback, IFabricAsyncOperationCallback**, callback), \
+        COM_WRAPPER_FUNCTION_WRAPPER(HRESULT, perf_async_operation_context_Cancel) \
+    )
+
+DECLARE_COM_WRAPPER_OBJECT(PERF_ASYNC_OPERATION_CONTEXT_HANDLE, PERF_ASYNC_OPERATION_CONTEXT_HANDLE_INTERFACES);
+
+#endif /* PERF_ASYNC_OPERATION_COM_H */
@@ -0,0 +1,16 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef PERF_ASYNC_OPERATION_SYNC_WRAPPER_H
+#define PERF_ASYNC_OPERATION_SYNC_WRAPPER_H
+
+#include "sf_c_util/fabric_async_op_sync_wrapper.h"
+#include "testasyncoperation.h"
+
+#define PERF_FABRIC_OPERATION_SYNC_SIGNATURE \
+    BEGIN_ARGS(int, arg1), \
+    END_ARGS(int, operation_result_1, double, operation_result_2)
+
+DECLARE_FABRIC_ASYNC_OPERATION_SYNC(ITestAsyncOperation, TestOperation, PERF_FABRIC_OPERATION_SYNC_SIGNATURE)
+
+#endif /* PERF_ASYNC_OPERATION_SYNC_WRAPPER_H */
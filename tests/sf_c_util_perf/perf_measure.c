@@ -0,0 +1,200 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "windows.h"
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/timer.h"
+
+#include "sf_c_util/alloc_stats.h"
+
+#include "perf_measure.h"
+
+static FILE* results_file = NULL;
+static char run_id[64]; /*UTC start time and process id, tells the results of one run apart from the ones of earlier runs in the same file*/
+
+int perf_measure_init(void)
+{
+    int result;
+    char file_name[MAX_PATH];
+    DWORD length = GetEnvironmentVariableA(PERF_MEASURE_RESULTS_FILE_ENVIRONMENT_VARIABLE, file_name, sizeof(file_name));
+    if (
+        (length == 0) ||
+        (length >= sizeof(file_name))
+        )
+    {
+        (void)strcpy_s(file_name, sizeof(file_name), PERF_MEASURE_DEFAULT_RESULTS_FILE);
+    }
+
+    /*results of earlier runs are kept, every run appends its own lines*/
+    if (fopen_s(&results_file, file_name, "a") != 0)
+    {
+        LogError("failure in fopen_s(%s)", file_name);
+        results_file = NULL;
+        result = MU_FAILURE;
+    }
+    else
+    {
+        SYSTEMTIME now;
+        GetSystemTime(&now);
+        (void)snprintf(run_id, sizeof(run_id), "%04u-%02u-%02uT%02u:%02u:%02uZ-%lu",
+            (unsigned int)now.wYear, (unsigned int)now.wMonth, (unsigned int)now.wDay, (unsigned int)now.wHour, (unsigned int)now.wMinute, (unsigned int)now.wSecond, (unsigned long)GetCurrentProcessId());
+        LogInfo("appending the perf results of run %s to %s", run_id, file_name);
+        result = 0;
+    }
+    return result;
+}
+
+void perf_measure_deinit(void)
+{
+    if (results_file == NULL)
+    {
+        LogError("perf_measure_init was not called");
+    }
+    else
+    {
+        (void)fclose(results_file);
+        results_file = NULL;
+    }
+}
+
+static int compare_latencies(const void* left, const void* right)
+{
+    double left_latency = *(const double*)left;
+    double right_latency = *(const double*)right;
+    return (left_latency < right_latency) ? -1 : ((left_latency > right_latency) ? 1 : 0);
+}
+
+#ifdef SF_C_UTIL_ALLOC_STATS
+/*allocations and reallocations done by all the modules of sf_c_util so far*/
+static int get_allocation_count(uint64_t* allocation_count)
+{
+    int result;
+    ALLOC_STATS_SNAPSHOT totals;
+    if (alloc_stats_get_totals(NULL, NULL, &totals) != 0)
+    {
+        LogError("failure in alloc_stats_get_totals");
+        result = MU_FAILURE;
+    }
+    else
+    {
+        *allocation_count = totals.allocation_count + totals.reallocation_count;
+        result = 0;
+    }
+    return result;
+}
+#endif
+
+int perf_measure_run(const char* name, uint32_t warm_up_count, uint32_t operation_count, PERF_MEASURE_OPERATION operation, void* context)
+{
+    return perf_measure_run_with_allocation_budget(name, warm_up_count, operation_count, operation, context, PERF_MEASURE_NO_ALLOCATION_BUDGET);
+}
+
+int perf_measure_run_with_allocation_budget(const char* name, uint32_t warm_up_count, uint32_t operation_count, PERF_MEASURE_OPERATION operation, void* context, double max_allocations_per_operation)
+{
+    int result;
+    if (
+        (results_file == NULL) ||
+        (name == NULL) ||
+        (operation_count == 0) ||
+        (operation == NULL)
+        )
+    {
+        LogError("invalid arguments const char* name=%s, uint32_t warm_up_count=%" PRIu32 ", uint32_t operation_count=%" PRIu32 ", PERF_MEASURE_OPERATION operation=%p, void* context=%p, double max_allocations_per_operation=%lf (results_file=%p)",
+            MU_P_OR_NULL(name), warm_up_count, operation_count, operation, context, max_allocations_per_operation, results_file);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*the latencies are allocated before measuring, so that measuring does not allocate*/
+        double* latencies_us = malloc_2(operation_count, sizeof(double));
+        if (latencies_us == NULL)
+        {
+            LogError("failure in malloc_2(%" PRIu32 ", %zu)", operation_count, sizeof(double));
+            result = MU_FAILURE;
+        }
+        else
+        {
+            uint32_t i;
+            double total_us;
+            double start_us;
+            double allocations_per_operation = -1; /*negative when the allocations are not counted*/
+#ifdef SF_C_UTIL_ALLOC_STATS
+            uint64_t allocation_count_before = 0;
+            uint64_t allocation_count_after = 0;
+#endif
+
+            for (i = 0; i < warm_up_count; i++)
+            {
+                operation(context);
+            }
+
+#ifdef SF_C_UTIL_ALLOC_STATS
+            (void)get_allocation_count(&allocation_count_before);
+#endif
+            start_us = timer_global_get_elapsed_us();
+            for (i = 0; i < operation_count; i++)
+            {
+                double operation_start_us = timer_global_get_elapsed_us();
+                operation(context);
+                latencies_us[i] = timer_global_get_elapsed_us() - operation_start_us;
+            }
+            total_us = timer_global_get_elapsed_us() - start_us;
+#ifdef SF_C_UTIL_ALLOC_STATS
+            if (get_allocation_count(&allocation_count_after) == 0)
+            {
+                allocations_per_operation = (double)(allocation_count_after - allocation_count_before) / operation_count;
+            }
+#endif
+
+            qsort(latencies_us, operation_count, sizeof(double), compare_latencies);
+
+            {
+                double ops_per_sec = (total_us > 0) ? (operation_count * 1000000.0 / total_us) : 0;
+                double p50_us = latencies_us[(operation_count - 1) / 2];
+                double p99_us = latencies_us[(uint32_t)(((uint64_t)operation_count - 1) * 99 / 100)];
+
+                (void)fprintf(results_file, "{ \"run\": \"%s\", \"name\": \"%s\", \"operations\": %" PRIu32 ", \"ops_per_sec\": %.1f, \"p50_us\": %.3f, \"p99_us\": %.3f, \"allocs_per_op\": ",
+                    run_id, name, operation_count, ops_per_sec, p50_us, p99_us);
+                if (allocations_per_operation < 0)
+                {
+                    LogInfo("%s: %" PRIu32 " operations, %.0f ops/sec, p50 %.3f us, p99 %.3f us",
+                        name, operation_count, ops_per_sec, p50_us, p99_us);
+                    (void)fprintf(results_file, "null }\n");
+                }
+                else
+                {
+                    LogInfo("%s: %" PRIu32 " operations, %.0f ops/sec, p50 %.3f us, p99 %.3f us, %.3f allocations/op",
+                        name, operation_count, ops_per_sec, p50_us, p99_us, allocations_per_operation);
+                    (void)fprintf(results_file, "%.3f }\n", allocations_per_operation);
+                }
+                (void)fflush(results_file);
+            }
+
+            if (allocations_per_operation > max_allocations_per_operation)
+            {
+                LogError("%s: %.3f allocations/op is over the budget of %.3f allocations/op", name, allocations_per_operation, max_allocations_per_operation);
+                result = MU_FAILURE;
+            }
+            else
+            {
+                result = 0;
+            }
+
+            free(latencies_us);
+        }
+    }
+    return result;
+}
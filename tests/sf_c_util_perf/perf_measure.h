@@ -0,0 +1,28 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef PERF_MEASURE_H
+#define PERF_MEASURE_H
+
+#include <stdint.h>
+#include <float.h>
+
+/*the results of every perf_measure_run are appended as one JSON object per line (JSON Lines) to this file (or to the file named by the environment variable). Every line has the "run" identifier of the run that wrote it, so results of several runs can be kept in one file and compared*/
+#define PERF_MEASURE_RESULTS_FILE_ENVIRONMENT_VARIABLE "SF_C_UTIL_PERF_RESULTS_FILE"
+#define PERF_MEASURE_DEFAULT_RESULTS_FILE "sf_c_util_perf_results.jsonl"
+
+/*max_allocations_per_operation of perf_measure_run (nothing the operations allocate is over it)*/
+#define PERF_MEASURE_NO_ALLOCATION_BUDGET DBL_MAX
+
+typedef void (*PERF_MEASURE_OPERATION)(void* context);
+
+int perf_measure_init(void);
+void perf_measure_deinit(void);
+
+/*calls operation warm_up_count times without measuring it, then operation_count times measuring every call. Logs and writes to the results file ops/sec, p50 and p99 latency*/
+int perf_measure_run(const char* name, uint32_t warm_up_count, uint32_t operation_count, PERF_MEASURE_OPERATION operation, void* context);
+
+/*same as perf_measure_run, also writes allocs_per_op (the allocations done by sf_c_util, only counted when SF_C_UTIL_ALLOC_STATS is defined) and fails when it is over max_allocations_per_operation*/
+int perf_measure_run_with_allocation_budget(const char* name, uint32_t warm_up_count, uint32_t operation_count, PERF_MEASURE_OPERATION operation, void* context, double max_allocations_per_operation);
+
+#endif /* PERF_MEASURE_H */
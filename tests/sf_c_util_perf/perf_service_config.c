@@ -0,0 +1,12 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+
+#include "c_pal/thandle.h"
+
+#include "sf_c_util/sf_service_config.h"
+#include "perf_service_config.h"
+
+DEFINE_SF_SERVICE_CONFIG(perf_config, PERF_CONFIG_PACKAGE_NAME_WIDE_DEFINE, PERF_SECTION_NAME_WIDE_DEFINE, PERF_CONFIG_PARAMS);
@@ -0,0 +1,57 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef PERF_SERVICE_CONFIG_H
+#define PERF_SERVICE_CONFIG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sf_c_util/sf_service_config.h"
+#include "sf_c_util/servicefabric_enums_sf_service_config.h"
+
+#define PERF_CONFIG_PACKAGE_NAME_DEFINE "PerfConfig"
+#define PERF_CONFIG_PACKAGE_NAME_WIDE_DEFINE MU_C2(L, PERF_CONFIG_PACKAGE_NAME_DEFINE)
+
+#define PERF_SECTION_NAME_DEFINE "PerfSection"
+#define PERF_SECTION_NAME_WIDE_DEFINE MU_C2(L, PERF_SECTION_NAME_DEFINE)
+
+/*the parameter names are needed both as narrow (argv) and wide (configuration) strings*/
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_uint64_1 "PerfUInt64One"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_uint64_2 "PerfUInt64Two"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_uint32 "PerfUInt32"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_double "PerfDouble"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_flag "PerfFlag"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_thandle_string "PerfThandleString"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_string "PerfString"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_wide_string "PerfWideString"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_optional_string "PerfOptionalString"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_health_state "PerfHealthState"
+
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_uint64_1              MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_uint64_1)
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_uint64_2              MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_uint64_2)
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_uint32                MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_uint32)
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_double                MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_double)
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_flag                  MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_flag)
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_thandle_string        MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_thandle_string)
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_string                MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_string)
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_wide_string           MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_wide_string)
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_optional_string       MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_optional_string)
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_perf_health_state          MU_C2C(L, SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_health_state)
+
+/*10 fields, one of every kind of field*/
+#define PERF_CONFIG_PARAMS \
+    CONFIG_REQUIRED(uint64_t, perf_uint64_1), \
+    CONFIG_REQUIRED(uint64_t, perf_uint64_2), \
+    CONFIG_REQUIRED(uint32_t, perf_uint32), \
+    CONFIG_REQUIRED(double, perf_double), \
+    CONFIG_REQUIRED(bool, perf_flag), \
+    CONFIG_REQUIRED(thandle_rc_string, perf_thandle_string), \
+    CONFIG_REQUIRED(char_ptr, perf_string), \
+    CONFIG_REQUIRED(wchar_ptr, perf_wide_string), \
+    CONFIG_OPTIONAL(char_ptr, perf_optional_string), \
+    CONFIG_REQUIRED(FABRIC_HEALTH_STATE, perf_health_state) \
+
+DECLARE_SF_SERVICE_CONFIG(perf_config, PERF_CONFIG_PARAMS)
+
+#endif /* PERF_SERVICE_CONFIG_H */
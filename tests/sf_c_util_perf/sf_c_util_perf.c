@@ -0,0 +1,435 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "windows.h"
+#include "fabriccommon.h"
+#include "fabricruntime.h"
+#include "fabrictypes.h"
+
+#include "macro_utils/macro_utils.h"
+#include "testrunnerswitcher.h"
+
+#include "c_logging/logger.h"
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/string_utils.h"
+#include "c_pal/thandle.h"
+
+#include "c_util/rc_string.h"
+
+#include "com_wrapper/com_wrapper.h"
+
+#include "sf_c_util/common_argc_argv.h"
+#include "sf_c_util/configuration_reader.h"
+#include "sf_c_util/fc_activation_context.h"
+#include "sf_c_util/fc_activation_context_com.h"
+#include "sf_c_util/hresult_to_string.h"
+#include "sf_c_util/servicefabric_enums_to_strings.h"
+#include "sf_c_util/sf_service_config.h"
+
+#include "testasyncoperation.h"
+
+#include "perf_measure.h"
+#include "perf_service_config.h"
+#include "perf_async_operation.h"
+#include "perf_async_operation_com.h"
+#include "perf_async_operation_wrapper.h"
+#include "perf_async_operation_sync_wrapper.h"
+
+/*measures the hot paths of sf_c_util against in-process COM objects (activation contexts made by fc_activation_context, an ITestAsyncOperation that completes synchronously).
+When sf_c_util is built with use_alloc_stats, the allocations per operation are reported too and the budgets below are asserted.
+The results are logged and appended as JSON lines to PERF_MEASURE_DEFAULT_RESULTS_FILE (or to the file named by PERF_MEASURE_RESULTS_FILE_ENVIRONMENT_VARIABLE) so that they can be compared between builds*/
+
+#define N_WARM_UP 100
+#define N_OPERATIONS 10000
+
+/*the activation contexts have one configuration package with one section of this many parameters: PERF_CONFIG_PARAMS and padding before them*/
+#define PERF_PARAMETER_COUNTS_VALUES 10, 100, 1000
+static const uint32_t perf_parameter_counts[] = { PERF_PARAMETER_COUNTS_VALUES };
+#define PERF_ACTIVATION_CONTEXT_COUNT (sizeof(perf_parameter_counts) / sizeof(perf_parameter_counts[0]))
+
+#define PERF_CONFIG_FIELD_COUNT 10
+
+typedef struct PERF_ACTIVATION_CONTEXT_TAG
+{
+    uint32_t parameter_count;
+    int argc;
+    char** argv;
+    IFabricCodePackageActivationContext* activation_context;
+} PERF_ACTIVATION_CONTEXT;
+
+static PERF_ACTIVATION_CONTEXT perf_activation_contexts[PERF_ACTIVATION_CONTEXT_COUNT];
+
+static const char* perf_config_argv[PERF_CONFIG_FIELD_COUNT * 2] =
+{
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_uint64_1, "1",
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_uint64_2, "2",
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_uint32, "3",
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_double, "4.5",
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_flag, "true",
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_thandle_string, "a string in a THANDLE",
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_string, "a string",
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_wide_string, "a wide string",
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_optional_string, "an optional string",
+    SF_SERVICE_CONFIG_PARAMETER_NAME_NARROW_perf_health_state, "fabric_health_state_ok"
+};
+
+static void perf_activation_context_create(PERF_ACTIVATION_CONTEXT* perf_activation_context, uint32_t parameter_count)
+{
+    uint32_t padding_count = parameter_count - PERF_CONFIG_FIELD_COUNT;
+    uint32_t i;
+    int argc_consumed;
+    FC_ACTIVATION_CONTEXT_HANDLE fc_activation_context;
+
+    perf_activation_context->parameter_count = parameter_count;
+    perf_activation_context->argc = 4 + 2 * (int)parameter_count;
+    perf_activation_context->argv = malloc_2(perf_activation_context->argc, sizeof(char*));
+    ASSERT_IS_NOT_NULL(perf_activation_context->argv);
+
+    perf_activation_context->argv[0] = CONFIGURATION_PACKAGE_NAME;
+    perf_activation_context->argv[1] = PERF_CONFIG_PACKAGE_NAME_DEFINE;
+    perf_activation_context->argv[2] = SECTION_NAME_DEFINE;
+    perf_activation_context->argv[3] = PERF_SECTION_NAME_DEFINE;
+
+    /*the padding comes first, so the parameters of the config are the last ones found*/
+    for (i = 0; i < padding_count; i++)
+    {
+        perf_activation_context->argv[4 + 2 * i] = sprintf_char("PerfPadding%" PRIu32 "", i);
+        ASSERT_IS_NOT_NULL(perf_activation_context->argv[4 + 2 * i]);
+        perf_activation_context->argv[4 + 2 * i + 1] = sprintf_char("padding value %" PRIu32 "", i);
+        ASSERT_IS_NOT_NULL(perf_activation_context->argv[4 + 2 * i + 1]);
+    }
+    for (i = 0; i < PERF_CONFIG_FIELD_COUNT * 2; i++)
+    {
+        perf_activation_context->argv[4 + 2 * padding_count + i] = (char*)perf_config_argv[i];
+    }
+
+    fc_activation_context = fc_activation_context_create(perf_activation_context->argc, perf_activation_context->argv, &argc_consumed);
+    ASSERT_IS_NOT_NULL(fc_activation_context);
+    ASSERT_ARE_EQUAL(int, perf_activation_context->argc, argc_consumed);
+
+    perf_activation_context->activation_context = COM_WRAPPER_CREATE(FC_ACTIVATION_CONTEXT_HANDLE, IFabricCodePackageActivationContext, fc_activation_context, fc_activation_context_destroy);
+    ASSERT_IS_NOT_NULL(perf_activation_context->activation_context);
+}
+
+static void perf_activation_context_destroy(PERF_ACTIVATION_CONTEXT* perf_activation_context)
+{
+    uint32_t padding_count = perf_activation_context->parameter_count - PERF_CONFIG_FIELD_COUNT;
+    uint32_t i;
+
+    (void)perf_activation_context->activation_context->lpVtbl->Release(perf_activation_context->activation_context);
+    for (i = 0; i < padding_count * 2; i++)
+    {
+        free(perf_activation_context->argv[4 + i]);
+    }
+    free(perf_activation_context->argv);
+}
+
+static void run_for_all_activation_contexts(const char* operation_name, PERF_MEASURE_OPERATION operation, double max_allocations_per_operation)
+{
+    size_t i;
+    for (i = 0; i < PERF_ACTIVATION_CONTEXT_COUNT; i++)
+    {
+        char name[128];
+        (void)snprintf(name, sizeof(name), "%s/%" PRIu32 "_parameters", operation_name, perf_activation_contexts[i].parameter_count);
+        ASSERT_ARE_EQUAL(int, 0, perf_measure_run_with_allocation_budget(name, N_WARM_UP, N_OPERATIONS, operation, &perf_activation_contexts[i], max_allocations_per_operation));
+    }
+}
+
+/*configuration_reader*/
+
+static void configuration_reader_get_uint64_t_operation(void* context)
+{
+    PERF_ACTIVATION_CONTEXT* perf_activation_context = context;
+    uint64_t value;
+    (void)configuration_reader_get_uint64_t(perf_activation_context->activation_context, PERF_CONFIG_PACKAGE_NAME_WIDE_DEFINE, PERF_SECTION_NAME_WIDE_DEFINE, SF_SERVICE_CONFIG_PARAMETER_NAME_perf_uint64_1, &value);
+}
+
+static void configuration_reader_get_wchar_string_operation(void* context)
+{
+    PERF_ACTIVATION_CONTEXT* perf_activation_context = context;
+    wchar_t* value;
+    if (configuration_reader_get_wchar_string(perf_activation_context->activation_context, PERF_CONFIG_PACKAGE_NAME_WIDE_DEFINE, PERF_SECTION_NAME_WIDE_DEFINE, SF_SERVICE_CONFIG_PARAMETER_NAME_perf_wide_string, &value) == 0)
+    {
+        free(value);
+    }
+}
+
+static void configuration_reader_get_thandle_rc_string_operation(void* context)
+{
+    PERF_ACTIVATION_CONTEXT* perf_activation_context = context;
+    THANDLE(RC_STRING) value = NULL;
+    if (configuration_reader_get_thandle_rc_string(perf_activation_context->activation_context, PERF_CONFIG_PACKAGE_NAME_WIDE_DEFINE, PERF_SECTION_NAME_WIDE_DEFINE, SF_SERVICE_CONFIG_PARAMETER_NAME_perf_thandle_string, &value) == 0)
+    {
+        THANDLE_ASSIGN(RC_STRING)(&value, NULL);
+    }
+}
+
+/*sf_service_config*/
+
+static void sf_service_config_create_operation(void* context)
+{
+    PERF_ACTIVATION_CONTEXT* perf_activation_context = context;
+    THANDLE(SF_SERVICE_CONFIG(perf_config)) config = SF_SERVICE_CONFIG_CREATE(perf_config)(perf_activation_context->activation_context);
+    if (config != NULL)
+    {
+        THANDLE_ASSIGN(SF_SERVICE_CONFIG(perf_config))(&config, NULL);
+    }
+}
+
+/*argc/argv*/
+
+static void activation_context_argc_argv_round_trip_operation(void* context)
+{
+    PERF_ACTIVATION_CONTEXT* perf_activation_context = context;
+    int argc;
+    char** argv;
+    if (IFabricCodePackageActivationContext_to_ARGC_ARGV(perf_activation_context->activation_context, &argc, &argv) == 0)
+    {
+        int argc_consumed;
+        FC_ACTIVATION_CONTEXT_HANDLE fc_activation_context = fc_activation_context_create(argc, argv, &argc_consumed);
+        if (fc_activation_context != NULL)
+        {
+            fc_activation_context_destroy(fc_activation_context);
+        }
+        ARGC_ARGV_free(argc, argv);
+    }
+}
+
+/*async wrappers*/
+
+static void on_test_operation_complete(void* context, HRESULT async_operation_result, int operation_result_1, double operation_result_2)
+{
+    (void)async_operation_result;
+    (void)operation_result_1;
+    (void)operation_result_2;
+    (*(uint32_t*)context)++;
+}
+
+typedef struct PERF_ASYNC_MEASURE_CONTEXT_TAG
+{
+    ITestAsyncOperation* test_async_operation;
+    uint32_t completed_count;
+} PERF_ASYNC_MEASURE_CONTEXT;
+
+static void execute_async_operation(void* context)
+{
+    PERF_ASYNC_MEASURE_CONTEXT* measure_context = context;
+    (void)ITestAsyncOperation_TestOperation_execute_async(measure_context->test_async_operation, 1, on_test_operation_complete, &measure_context->completed_count);
+}
+
+static void execute_operation(void* context)
+{
+    PERF_ASYNC_MEASURE_CONTEXT* measure_context = context;
+    int operation_result_1;
+    double operation_result_2;
+    if (ITestAsyncOperation_TestOperation_execute(measure_context->test_async_operation, 1, &operation_result_1, &operation_result_2) == S_OK)
+    {
+        measure_context->completed_count++;
+    }
+}
+
+/*hresult_to_string*/
+
+static void hresult_to_string_operation(void* context)
+{
+    HRESULT hr = *(const HRESULT*)context;
+    char* result = hresult_to_string(malloc, free, hr);
+    if (result != NULL)
+    {
+        free(result);
+    }
+}
+
+static void hresult_to_string_buffer_operation(void* context)
+{
+    HRESULT hr = *(const HRESULT*)context;
+    char buffer[HRESULT_TO_STRING_BUFFER_SIZE];
+    (void)hresult_to_string_buffer(hr, buffer, sizeof(buffer));
+}
+
+/*enum strings*/
+
+static volatile size_t enum_string_length_sum; /*so the lookups are not optimized away*/
+
+static void FABRIC_ERROR_CODE_ToString_operation(void* context)
+{
+    (void)context;
+    enum_string_length_sum += strlen(MU_ENUM_TO_STRING(FABRIC_ERROR_CODE, FABRIC_E_SERVICE_DOES_NOT_EXIST));
+}
+
+static void FABRIC_ERROR_CODE_FromString_operation(void* context)
+{
+    FABRIC_ERROR_CODE value;
+    (void)context;
+    if (FABRIC_ERROR_CODE_FromString("FABRIC_E_SERVICE_DOES_NOT_EXIST", &value) == 0)
+    {
+        enum_string_length_sum += (size_t)value;
+    }
+}
+
+static void FABRIC_HEALTH_STATE_FromStringCaseInsensitive_operation(void* context)
+{
+    FABRIC_HEALTH_STATE value;
+    (void)context;
+    if (FABRIC_HEALTH_STATE_FromStringCaseInsensitive("fabric_health_state_warning", &value) == 0)
+    {
+        enum_string_length_sum += (size_t)value;
+    }
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    size_t i;
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_init());
+    for (i = 0; i < PERF_ACTIVATION_CONTEXT_COUNT; i++)
+    {
+        perf_activation_context_create(&perf_activation_contexts[i], perf_parameter_counts[i]);
+    }
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    size_t i;
+    for (i = 0; i < PERF_ACTIVATION_CONTEXT_COUNT; i++)
+    {
+        perf_activation_context_destroy(&perf_activation_contexts[i]);
+    }
+    perf_measure_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+}
+
+TEST_FUNCTION(perf_configuration_reader_get)
+{
+    ///arrange
+    size_t i;
+    for (i = 0; i < PERF_ACTIVATION_CONTEXT_COUNT; i++)
+    {
+        uint64_t value;
+        ASSERT_ARE_EQUAL(int, 0, configuration_reader_get_uint64_t(perf_activation_contexts[i].activation_context, PERF_CONFIG_PACKAGE_NAME_WIDE_DEFINE, PERF_SECTION_NAME_WIDE_DEFINE, SF_SERVICE_CONFIG_PARAMETER_NAME_perf_uint64_1, &value));
+        ASSERT_ARE_EQUAL(uint64_t, 1, value);
+    }
+
+    ///act
+    run_for_all_activation_contexts("configuration_reader_get_uint64_t", configuration_reader_get_uint64_t_operation, 0);
+    run_for_all_activation_contexts("configuration_reader_get_wchar_string", configuration_reader_get_wchar_string_operation, PERF_MEASURE_NO_ALLOCATION_BUDGET);
+    run_for_all_activation_contexts("configuration_reader_get_thandle_rc_string", configuration_reader_get_thandle_rc_string_operation, PERF_MEASURE_NO_ALLOCATION_BUDGET);
+
+    ///assert - the results are in the results file
+}
+
+TEST_FUNCTION(perf_SF_SERVICE_CONFIG_CREATE)
+{
+    ///arrange
+    size_t i;
+    for (i = 0; i < PERF_ACTIVATION_CONTEXT_COUNT; i++)
+    {
+        THANDLE(SF_SERVICE_CONFIG(perf_config)) config = SF_SERVICE_CONFIG_CREATE(perf_config)(perf_activation_contexts[i].activation_context);
+        ASSERT_IS_NOT_NULL(config);
+        ASSERT_ARE_EQUAL(uint32_t, 3, SF_SERVICE_CONFIG_GETTER(perf_config, perf_uint32)(config));
+        ASSERT_ARE_EQUAL(int, FABRIC_HEALTH_STATE_OK, SF_SERVICE_CONFIG_GETTER(perf_config, perf_health_state)(config));
+        THANDLE_ASSIGN(SF_SERVICE_CONFIG(perf_config))(&config, NULL);
+    }
+
+    ///act
+    run_for_all_activation_contexts("SF_SERVICE_CONFIG_CREATE_10_fields", sf_service_config_create_operation, PERF_MEASURE_NO_ALLOCATION_BUDGET);
+
+    ///assert - the results are in the results file
+}
+
+TEST_FUNCTION(perf_activation_context_argc_argv_round_trip)
+{
+    ///arrange
+    size_t i;
+    for (i = 0; i < PERF_ACTIVATION_CONTEXT_COUNT; i++)
+    {
+        int argc;
+        char** argv;
+        ASSERT_ARE_EQUAL(int, 0, IFabricCodePackageActivationContext_to_ARGC_ARGV(perf_activation_contexts[i].activation_context, &argc, &argv));
+        ASSERT_ARE_EQUAL(int, perf_activation_contexts[i].argc, argc);
+        ARGC_ARGV_free(argc, argv);
+    }
+
+    ///act
+    run_for_all_activation_contexts("activation_context_argc_argv_round_trip", activation_context_argc_argv_round_trip_operation, PERF_MEASURE_NO_ALLOCATION_BUDGET);
+
+    ///assert - the results are in the results file
+}
+
+TEST_FUNCTION(perf_async_wrappers)
+{
+    ///arrange
+    PERF_ASYNC_OPERATION_HANDLE perf_async_operation = perf_async_operation_create();
+    ASSERT_IS_NOT_NULL(perf_async_operation);
+    PERF_ASYNC_MEASURE_CONTEXT measure_context;
+    measure_context.test_async_operation = COM_WRAPPER_CREATE(PERF_ASYNC_OPERATION_HANDLE, ITestAsyncOperation, perf_async_operation, perf_async_operation_destroy);
+    ASSERT_IS_NOT_NULL(measure_context.test_async_operation);
+    measure_context.completed_count = 0;
+
+    ///act
+    /*the context of the wrapper and the callback object*/
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_run_with_allocation_budget("ITestAsyncOperation_TestOperation_execute_async", N_WARM_UP, N_OPERATIONS, execute_async_operation, &measure_context, 2));
+    ASSERT_ARE_EQUAL(uint32_t, N_WARM_UP + N_OPERATIONS, measure_context.completed_count);
+
+    measure_context.completed_count = 0;
+    /*the callback object*/
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_run_with_allocation_budget("ITestAsyncOperation_TestOperation_execute", N_WARM_UP, N_OPERATIONS, execute_operation, &measure_context, 1));
+    ASSERT_ARE_EQUAL(uint32_t, N_WARM_UP + N_OPERATIONS, measure_context.completed_count);
+
+    ///assert - the results are in the results file
+
+    ///clean
+    (void)measure_context.test_async_operation->lpVtbl->Release(measure_context.test_async_operation);
+}
+
+TEST_FUNCTION(perf_hresult_to_string)
+{
+    ///arrange
+    HRESULT system_hr = E_INVALIDARG;
+    HRESULT fabric_hr = FABRIC_E_SERVICE_DOES_NOT_EXIST;
+    char* system_string = hresult_to_string(malloc, free, system_hr);
+    ASSERT_IS_NOT_NULL(system_string);
+    free(system_string);
+
+    ///act
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_run("hresult_to_string/system", N_WARM_UP, N_OPERATIONS, hresult_to_string_operation, &system_hr));
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_run("hresult_to_string/fabric", N_WARM_UP, N_OPERATIONS, hresult_to_string_operation, &fabric_hr));
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_run_with_allocation_budget("hresult_to_string_buffer/system", N_WARM_UP, N_OPERATIONS, hresult_to_string_buffer_operation, &system_hr, 0));
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_run_with_allocation_budget("hresult_to_string_buffer/fabric", N_WARM_UP, N_OPERATIONS, hresult_to_string_buffer_operation, &fabric_hr, 0));
+
+    ///assert - the results are in the results file
+}
+
+TEST_FUNCTION(perf_enum_strings)
+{
+    ///arrange
+    FABRIC_HEALTH_STATE health_state;
+    ASSERT_ARE_EQUAL(int, 0, FABRIC_HEALTH_STATE_FromStringCaseInsensitive("fabric_health_state_warning", &health_state));
+    ASSERT_ARE_EQUAL(int, FABRIC_HEALTH_STATE_WARNING, health_state);
+
+    ///act
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_run_with_allocation_budget("FABRIC_ERROR_CODE_ToString", N_WARM_UP, N_OPERATIONS, FABRIC_ERROR_CODE_ToString_operation, NULL, 0));
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_run_with_allocation_budget("FABRIC_ERROR_CODE_FromString", N_WARM_UP, N_OPERATIONS, FABRIC_ERROR_CODE_FromString_operation, NULL, 0));
+    ASSERT_ARE_EQUAL(int, 0, perf_measure_run_with_allocation_budget("FABRIC_HEALTH_STATE_FromStringCaseInsensitive", N_WARM_UP, N_OPERATIONS, FABRIC_HEALTH_STATE_FromStringCaseInsensitive_operation, NULL, 0));
+
+    ///assert - the results are in the results file
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include <wchar.h>
 
 #include "fabricruntime.h"
@@ -57,6 +58,43 @@ TEST_SF_SERVICE_CONFIG_DEFINE_CONFIGURATION_READER_HOOKS(my_config, MY_CONFIG_TE
 
 TEST_SF_SERVICE_CONFIG_DEFINE_EXPECTED_CALL_HELPERS(my_config, expected_config_package_name, expected_section_name, MY_CONFIG_TEST_PARAMS)
 
+// my_enum_config reads its enums with configuration_reader_get_char_string, the values are served here and everything else by the hook of my_config
+static const char* health_state_to_return;
+static const char* secret_replica_role_to_return;
+
+static int hook_configuration_reader_get_char_string_with_enums(IFabricCodePackageActivationContext* activation_context, const wchar_t* config_package_name, const wchar_t* section_name, const wchar_t* parameter_name, char** value)
+{
+    int result;
+    const char* enum_value_to_return;
+
+    if (wcscmp(parameter_name, SF_SERVICE_CONFIG_PARAMETER_NAME(health_state)) == 0)
+    {
+        enum_value_to_return = health_state_to_return;
+    }
+    else if (wcscmp(parameter_name, SF_SERVICE_CONFIG_PARAMETER_NAME(secret_replica_role)) == 0)
+    {
+        enum_value_to_return = secret_replica_role_to_return;
+    }
+    else
+    {
+        return MU_C3(hook_, my_config, _configuration_reader_get_char_ptr)(activation_context, config_package_name, section_name, parameter_name, value);
+    }
+
+    if (enum_value_to_return == NULL)
+    {
+        *value = NULL;
+    }
+    else
+    {
+        *value = (char*)real_gballoc_hl_malloc(strlen(enum_value_to_return) + 1);
+        ASSERT_IS_NOT_NULL(*value);
+        (void)strcpy(*value, enum_value_to_return);
+    }
+    result = 0;
+
+    return result;
+}
+
 
 // Also test that the generated code can be mocked
 
@@ -147,6 +185,7 @@ TEST_SUITE_INITIALIZE(suite_init)
 
     REGISTER_UMOCK_ALIAS_TYPE(THANDLE(SF_SERVICE_CONFIG(my_mocked_config)), void*);
     TEST_SF_SERVICE_CONFIG_HOOK_CONFIGURATION_READER(my_config)
+    REGISTER_GLOBAL_MOCK_HOOK(configuration_reader_get_char_string, hook_configuration_reader_get_char_string_with_enums);
 
     rc_string_test_init_statics();
 }
@@ -164,6 +203,8 @@ TEST_FUNCTION_INITIALIZE(method_init)
 {
     // Initialize so each default value is returned (individual tests can override what gets returned)
     TEST_SF_SERVICE_CONFIG_RESET(MY_CONFIG_TEST_PARAMS);
+    health_state_to_return = "FABRIC_HEALTH_STATE_WARNING";
+    secret_replica_role_to_return = "fabric_replica_role_primary";
 
     umock_c_reset_all_calls();
     umock_c_negative_tests_init();
@@ -545,6 +586,117 @@ TEST_FUNCTION(SF_SERVICE_CONFIG_CREATE_with_NULL_required_thandle_rcstring_fails
     ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
 }
 
+/*Tests_SRS_SF_SERVICE_CONFIG_01_005: [ If the type is an enum then: ]*/
+    /*Tests_SRS_SF_SERVICE_CONFIG_01_006: [ SF_SERVICE_CONFIG_CREATE(name) shall call configuration_reader_get_char_string with the activation_context, sf_config_name, sf_parameters_section_name, and SF_SERVICE_CONFIG_PARAMETER_NAME_config_name. ]*/
+    /*Tests_SRS_SF_SERVICE_CONFIG_01_007: [ SF_SERVICE_CONFIG_CREATE(name) shall convert the value to the enum by calling the from string function of the enum. ]*/
+    /*Tests_SRS_SF_SERVICE_CONFIG_01_009: [ SF_SERVICE_CONFIG_CREATE(name) shall free the string. ]*/
+TEST_FUNCTION(SF_SERVICE_CONFIG_CREATE_with_enum_values_succeeds)
+{
+    // arrange
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(MU_C2A(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), _AddRef)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config)));
+    STRICT_EXPECTED_CALL(configuration_reader_get_char_string(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), expected_config_package_name, expected_section_name, SF_SERVICE_CONFIG_PARAMETER_NAME(health_state), IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(configuration_reader_get_char_string(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), expected_config_package_name, expected_section_name, SF_SERVICE_CONFIG_PARAMETER_NAME(secret_replica_role), IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    // act
+    THANDLE(SF_SERVICE_CONFIG(my_enum_config)) result = SF_SERVICE_CONFIG_CREATE(my_enum_config)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config));
+
+    // assert
+    ASSERT_IS_NOT_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    THANDLE_ASSIGN(SF_SERVICE_CONFIG(my_enum_config))(&result, NULL);
+}
+
+/*Tests_SRS_SF_SERVICE_CONFIG_01_005: [ If the type is an enum then: ]*/
+    /*Tests_SRS_SF_SERVICE_CONFIG_01_008: [ If the value is NULL, empty or not the name of a value of the enum then SF_SERVICE_CONFIG_CREATE(name) shall fail and return NULL. ]*/
+    /*Tests_SRS_SF_SERVICE_CONFIG_01_009: [ SF_SERVICE_CONFIG_CREATE(name) shall free the string. ]*/
+TEST_FUNCTION(SF_SERVICE_CONFIG_CREATE_with_unknown_enum_value_fails)
+{
+    // arrange
+    health_state_to_return = "FABRIC_HEALTH_STATE_NOT_A_STATE";
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(MU_C2A(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), _AddRef)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config)));
+    STRICT_EXPECTED_CALL(configuration_reader_get_char_string(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), expected_config_package_name, expected_section_name, SF_SERVICE_CONFIG_PARAMETER_NAME(health_state), IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(MU_C2A(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), _Release)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config)));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    // act
+    THANDLE(SF_SERVICE_CONFIG(my_enum_config)) result = SF_SERVICE_CONFIG_CREATE(my_enum_config)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config));
+
+    // assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_SF_SERVICE_CONFIG_01_005: [ If the type is an enum then: ]*/
+    /*Tests_SRS_SF_SERVICE_CONFIG_01_008: [ If the value is NULL, empty or not the name of a value of the enum then SF_SERVICE_CONFIG_CREATE(name) shall fail and return NULL. ]*/
+TEST_FUNCTION(SF_SERVICE_CONFIG_CREATE_with_empty_enum_value_fails)
+{
+    // arrange
+    health_state_to_return = "";
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(MU_C2A(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), _AddRef)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config)));
+    STRICT_EXPECTED_CALL(configuration_reader_get_char_string(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), expected_config_package_name, expected_section_name, SF_SERVICE_CONFIG_PARAMETER_NAME(health_state), IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(MU_C2A(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), _Release)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config)));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    // act
+    THANDLE(SF_SERVICE_CONFIG(my_enum_config)) result = SF_SERVICE_CONFIG_CREATE(my_enum_config)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config));
+
+    // assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_SF_SERVICE_CONFIG_01_005: [ If the type is an enum then: ]*/
+    /*Tests_SRS_SF_SERVICE_CONFIG_01_008: [ If the value is NULL, empty or not the name of a value of the enum then SF_SERVICE_CONFIG_CREATE(name) shall fail and return NULL. ]*/
+TEST_FUNCTION(SF_SERVICE_CONFIG_CREATE_with_NULL_optional_enum_value_fails)
+{
+    // arrange
+    secret_replica_role_to_return = NULL;
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(MU_C2A(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), _AddRef)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config)));
+    STRICT_EXPECTED_CALL(configuration_reader_get_char_string(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), expected_config_package_name, expected_section_name, SF_SERVICE_CONFIG_PARAMETER_NAME(health_state), IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(configuration_reader_get_char_string(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), expected_config_package_name, expected_section_name, SF_SERVICE_CONFIG_PARAMETER_NAME(secret_replica_role), IGNORED_ARG));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(MU_C2A(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), _Release)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config)));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    // act
+    THANDLE(SF_SERVICE_CONFIG(my_enum_config)) result = SF_SERVICE_CONFIG_CREATE(my_enum_config)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config));
+
+    // assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/*Tests_SRS_SF_SERVICE_CONFIG_01_005: [ If the type is an enum then: ]*/
+    /*Tests_SRS_SF_SERVICE_CONFIG_42_034: [ If there are any errors then SF_SERVICE_CONFIG_CREATE(name) shall fail and return NULL. ]*/
+TEST_FUNCTION(SF_SERVICE_CONFIG_CREATE_with_enum_fails_when_configuration_reader_get_char_string_fails)
+{
+    // arrange
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(MU_C2A(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), _AddRef)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config)));
+    STRICT_EXPECTED_CALL(configuration_reader_get_char_string(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), expected_config_package_name, expected_section_name, SF_SERVICE_CONFIG_PARAMETER_NAME(health_state), IGNORED_ARG))
+        .SetReturn(MU_FAILURE);
+    STRICT_EXPECTED_CALL(MU_C2A(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config), _Release)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config)));
+    STRICT_EXPECTED_CALL(free(IGNORED_ARG));
+
+    // act
+    THANDLE(SF_SERVICE_CONFIG(my_enum_config)) result = SF_SERVICE_CONFIG_CREATE(my_enum_config)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config));
+
+    // assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
 //
 // Dispose
 //
@@ -975,4 +1127,39 @@ TEST_FUNCTION(SF_SERVICE_CONFIG_GETTER_for_rc_string_with_NULL_returns_NULL)
     THANDLE_ASSIGN(SF_SERVICE_CONFIG(my_config))(&config, NULL);
 }
 
+/*Tests_SRS_SF_SERVICE_CONFIG_42_050: [ SF_SERVICE_CONFIG_GETTER(name, field_name) shall return the configuration value for field_name. ]*/
+TEST_FUNCTION(SF_SERVICE_CONFIG_GETTER_for_enum_returns_value)
+{
+    // arrange
+    THANDLE(SF_SERVICE_CONFIG(my_enum_config)) config = SF_SERVICE_CONFIG_CREATE(my_enum_config)(TEST_SF_SERVICE_CONFIG_ACTIVATION_CONTEXT(my_config));
+    ASSERT_IS_NOT_NULL(config);
+    umock_c_reset_all_calls();
+
+    // act
+    FABRIC_HEALTH_STATE health_state = SF_SERVICE_CONFIG_GETTER(my_enum_config, health_state)(config);
+    FABRIC_REPLICA_ROLE secret_replica_role = SF_SERVICE_CONFIG_GETTER(my_enum_config, secret_replica_role)(config);
+
+    // assert
+    ASSERT_ARE_EQUAL(int, FABRIC_HEALTH_STATE_WARNING, health_state);
+    ASSERT_ARE_EQUAL(int, FABRIC_REPLICA_ROLE_PRIMARY, secret_replica_role);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    THANDLE_ASSIGN(SF_SERVICE_CONFIG(my_enum_config))(&config, NULL);
+}
+
+/*Tests_SRS_SF_SERVICE_CONFIG_42_044: [ If handle is NULL then SF_SERVICE_CONFIG_GETTER(name, field_name) shall fail and return... ]*/
+/*Tests_SRS_SF_SERVICE_CONFIG_01_010: [ ...(enum_type)-1 if the type is an enum ]*/
+TEST_FUNCTION(SF_SERVICE_CONFIG_GETTER_for_enum_with_NULL_handle_returns_minus_1)
+{
+    // arrange
+
+    // act
+    FABRIC_HEALTH_STATE health_state = SF_SERVICE_CONFIG_GETTER(my_enum_config, health_state)(NULL);
+
+    // assert
+    ASSERT_ARE_EQUAL(int, (FABRIC_HEALTH_STATE)-1, health_state);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
 END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
@@ -13,3 +13,4 @@
 #include "real_interlocked.h"
 
 DEFINE_SF_SERVICE_CONFIG(my_config, L"default_config", L"MyConfigSectionName", MY_CONFIG_TEST_PARAMS);
+DEFINE_SF_SERVICE_CONFIG(my_enum_config, L"default_config", L"MyConfigSectionName", MY_ENUM_CONFIG_TEST_PARAMS);
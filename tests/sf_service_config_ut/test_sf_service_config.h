@@ -10,6 +10,7 @@
 #include <wchar.h>
 
 #include "sf_c_util/sf_service_config.h"
+#include "sf_c_util/servicefabric_enums_sf_service_config.h"
 
 #include "umock_c/umock_c_prod.h"
 
@@ -36,6 +37,8 @@
 #define SF_SERVICE_CONFIG_PARAMETER_NAME_another_secret_char_ptr L"AnotherSecretCharPtr"
 #define SF_SERVICE_CONFIG_PARAMETER_NAME_another_secret_double L"AnotherSecretDouble"
 #define SF_SERVICE_CONFIG_PARAMETER_NAME_another_secret_bool L"AnotherSecretBool"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_health_state L"HealthState"
+#define SF_SERVICE_CONFIG_PARAMETER_NAME_secret_replica_role L"SecretReplicaRole"
 
 #define MY_CONFIG_TEST_PARAMS \
     CONFIG_REQUIRED(uint64_t, parameter_1), \
@@ -64,4 +67,10 @@
 
 DECLARE_SF_SERVICE_CONFIG(my_config, MY_CONFIG_TEST_PARAMS)
 
+#define MY_ENUM_CONFIG_TEST_PARAMS \
+    CONFIG_REQUIRED(FABRIC_HEALTH_STATE, health_state), \
+    CONFIG_OPTIONAL_NO_LOGGING(FABRIC_REPLICA_ROLE, secret_replica_role) \
+
+DECLARE_SF_SERVICE_CONFIG(my_enum_config, MY_ENUM_CONFIG_TEST_PARAMS)
+
 #endif /* TEST_CONFIGURATION_WRAPPER_H */
\ No newline at end of file
@@ -0,0 +1,886 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "testrunnerswitcher.h"
+#include "umock_c/umock_c.h"
+#include "umock_c/umocktypes.h"
+#include "umock_c/umocktypes_bool.h"
+#include "umock_c/umocktypes_stdint.h"
+#include "umock_c/umock_c_negative_tests.h"
+
+#include "c_pal/interlocked.h" /*included for mocking reasons - it will prohibit creation of mocks belonging to interlocked.h - at the moment verified through int tests - this is porting legacy code, temporary solution*/
+
+#define ENABLE_MOCKS
+
+#include "c_pal/gballoc_hl.h"
+#include "c_pal/gballoc_hl_redirect.h"
+#include "c_pal/interlocked_hl.h"
+#include "c_pal/sync.h"
+#include "c_pal/srw_lock.h"
+#include "c_pal/threadapi.h"
+#include "c_pal/timer.h"
+
+MOCKABLE_FUNCTION(, void, test_callback, void*, context, bool, is_cancelled);
+
+#undef ENABLE_MOCKS
+
+#include "real_gballoc_hl.h"
+
+#include "sf_c_util/timer_wheel.h"
+
+MU_DEFINE_ENUM_STRINGS(UMOCK_C_ERROR_CODE, UMOCK_C_ERROR_CODE_VALUES)
+
+static void on_umock_c_error(UMOCK_C_ERROR_CODE error_code)
+{
+    ASSERT_FAIL("umock_c reported error :%" PRI_MU_ENUM "", MU_ENUM_VALUE(UMOCK_C_ERROR_CODE, error_code));
+}
+
+IMPLEMENT_UMOCK_C_ENUM_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT_VALUES);
+IMPLEMENT_UMOCK_C_ENUM_TYPE(THREADAPI_RESULT, THREADAPI_RESULT_VALUES);
+
+#define TEST_TICK_MS 10
+#define TEST_START_TIME 1000
+
+static SRW_LOCK_HANDLE test_lock = (SRW_LOCK_HANDLE)0x4243;
+static THREAD_HANDLE test_thread = (THREAD_HANDLE)0x4244;
+static void* test_context_1 = (void*)0x4245;
+static void* test_context_2 = (void*)0x4246;
+
+static double test_time;
+
+static THREAD_START_FUNC captured_thread_func;
+static void* captured_thread_arg;
+
+/*every wait of the thread of the wheel first moves the time to the next value here and times out, once they are all used the wheel is stopped*/
+#define TEST_MAX_WAITS 4
+static double test_wait_times[TEST_MAX_WAITS];
+static INTERLOCKED_HL_RESULT test_wait_returns[TEST_MAX_WAITS];
+static uint32_t test_wait_time_count;
+static uint32_t test_wait_count;
+
+static double hook_timer_global_get_elapsed_ms(void)
+{
+    return test_time;
+}
+
+static THREADAPI_RESULT hook_ThreadAPI_Create(THREAD_HANDLE* threadHandle, THREAD_START_FUNC func, void* arg)
+{
+    *threadHandle = test_thread;
+    captured_thread_func = func;
+    captured_thread_arg = arg;
+    return THREADAPI_OK;
+}
+
+static THREADAPI_RESULT hook_ThreadAPI_Join(THREAD_HANDLE threadHandle, int* res)
+{
+    (void)threadHandle;
+    *res = 0;
+    return THREADAPI_OK;
+}
+
+static INTERLOCKED_HL_RESULT hook_InterlockedHL_WaitForValue(int32_t volatile_atomic* address_to_check, int32_t value_to_wait, uint32_t timeout_ms)
+{
+    INTERLOCKED_HL_RESULT result;
+    (void)timeout_ms;
+    if (test_wait_count < test_wait_time_count)
+    {
+        test_time = test_wait_times[test_wait_count];
+        result = test_wait_returns[test_wait_count];
+    }
+    else
+    {
+        /*the wheel is destroyed*/
+        (void)interlocked_exchange(address_to_check, value_to_wait);
+        result = INTERLOCKED_HL_OK;
+    }
+    test_wait_count++;
+    return result;
+}
+
+static void test_add_wait(double time)
+{
+    ASSERT_IS_TRUE(test_wait_time_count < TEST_MAX_WAITS);
+    test_wait_times[test_wait_time_count] = time;
+    test_wait_returns[test_wait_time_count] = INTERLOCKED_HL_TIMEOUT;
+    test_wait_time_count++;
+}
+
+static void test_run_thread(void)
+{
+    ASSERT_ARE_EQUAL(int, 0, captured_thread_func(captured_thread_arg));
+}
+
+/*the calls made by one run of the thread of the wheel that processes the expired timers*/
+static void setup_process_expectations(void)
+{
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, TEST_TICK_MS));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+}
+
+static void setup_stop_expectations(void)
+{
+    STRICT_EXPECTED_CALL(InterlockedHL_WaitForValue(IGNORED_ARG, 1, TEST_TICK_MS));
+}
+
+static void setup_schedule_expectations(void)
+{
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+}
+
+static TIMER_WHEEL_HANDLE test_create_wheel(void)
+{
+    TIMER_WHEEL_HANDLE result = timer_wheel_create(TEST_TICK_MS);
+    ASSERT_IS_NOT_NULL(result);
+    umock_c_reset_all_calls();
+    return result;
+}
+
+/*a callback that schedules its own timer again, the first time it runs*/
+static TIMER_WHEEL_HANDLE test_rescheduling_wheel;
+static TIMER_WHEEL_TIMER test_rescheduling_timer;
+static uint32_t test_rescheduling_count;
+
+static void test_rescheduling_callback(void* context, bool is_cancelled)
+{
+    ASSERT_IS_FALSE(is_cancelled);
+    test_rescheduling_count++;
+    if (test_rescheduling_count == 1)
+    {
+        ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(test_rescheduling_wheel, &test_rescheduling_timer, TEST_TICK_MS, test_rescheduling_callback, context));
+    }
+}
+
+/*a callback that tries to schedule its timer again when it is cancelled*/
+static int test_cancelled_schedule_result;
+
+static void test_cancelled_rescheduling_callback(void* context, bool is_cancelled)
+{
+    ASSERT_IS_TRUE(is_cancelled);
+    test_cancelled_schedule_result = timer_wheel_schedule(test_rescheduling_wheel, &test_rescheduling_timer, TEST_TICK_MS, test_cancelled_rescheduling_callback, context);
+}
+
+BEGIN_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
+
+TEST_SUITE_INITIALIZE(suite_init)
+{
+    ASSERT_ARE_EQUAL(int, 0, real_gballoc_hl_init(NULL, NULL));
+
+    ASSERT_ARE_EQUAL(int, 0, umock_c_init(on_umock_c_error), "umock_c_init");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_bool_register_types(), "umocktypes_bool_register_types");
+    ASSERT_ARE_EQUAL(int, 0, umocktypes_stdint_register_types(), "umocktypes_stdint_register_types");
+
+    REGISTER_GBALLOC_HL_GLOBAL_MOCK_HOOK();
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(malloc, NULL);
+    REGISTER_GLOBAL_MOCK_RETURNS(srw_lock_create, test_lock, NULL);
+    REGISTER_GLOBAL_MOCK_HOOK(timer_global_get_elapsed_ms, hook_timer_global_get_elapsed_ms);
+    REGISTER_GLOBAL_MOCK_HOOK(ThreadAPI_Create, hook_ThreadAPI_Create);
+    REGISTER_GLOBAL_MOCK_FAIL_RETURN(ThreadAPI_Create, THREADAPI_ERROR);
+    REGISTER_GLOBAL_MOCK_HOOK(ThreadAPI_Join, hook_ThreadAPI_Join);
+    REGISTER_GLOBAL_MOCK_HOOK(InterlockedHL_WaitForValue, hook_InterlockedHL_WaitForValue);
+
+    REGISTER_UMOCK_ALIAS_TYPE(SRW_LOCK_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THREAD_HANDLE, void*);
+    REGISTER_UMOCK_ALIAS_TYPE(THREAD_START_FUNC, void*);
+
+    REGISTER_TYPE(INTERLOCKED_HL_RESULT, INTERLOCKED_HL_RESULT);
+    REGISTER_TYPE(THREADAPI_RESULT, THREADAPI_RESULT);
+}
+
+TEST_SUITE_CLEANUP(suite_cleanup)
+{
+    umock_c_deinit();
+
+    real_gballoc_hl_deinit();
+}
+
+TEST_FUNCTION_INITIALIZE(method_init)
+{
+    umock_c_reset_all_calls();
+    umock_c_negative_tests_init();
+
+    test_time = TEST_START_TIME;
+    test_wait_time_count = 0;
+    test_wait_count = 0;
+    captured_thread_func = NULL;
+    captured_thread_arg = NULL;
+    test_rescheduling_count = 0;
+    test_cancelled_schedule_result = 0;
+}
+
+TEST_FUNCTION_CLEANUP(method_cleanup)
+{
+    umock_c_negative_tests_deinit();
+}
+
+/* timer_wheel_create */
+
+/* Tests_SRS_TIMER_WHEEL_01_001: [ If tick_ms is 0, timer_wheel_create shall fail and return NULL. ]*/
+TEST_FUNCTION(timer_wheel_create_with_0_tick_ms_fails)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE result;
+
+    // act
+    result = timer_wheel_create(0);
+
+    // assert
+    ASSERT_IS_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_002: [ timer_wheel_create shall allocate memory for the wheel. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_003: [ timer_wheel_create shall create the lock of the wheel by calling srw_lock_create. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_004: [ timer_wheel_create shall initialize all the slots of all the levels of the wheel as empty and count the ticks from the time returned by timer_global_get_elapsed_ms. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_005: [ timer_wheel_create shall start the thread that fires the timers by calling ThreadAPI_Create. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_007: [ timer_wheel_create shall succeed and return a non-NULL handle. ]*/
+TEST_FUNCTION(timer_wheel_create_succeeds)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE result;
+
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "timer_wheel"));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms());
+    STRICT_EXPECTED_CALL(ThreadAPI_Create(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+
+    // act
+    result = timer_wheel_create(TEST_TICK_MS);
+
+    // assert
+    ASSERT_IS_NOT_NULL(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(captured_thread_func);
+    ASSERT_ARE_EQUAL(void_ptr, result, captured_thread_arg);
+
+    // cleanup
+    timer_wheel_destroy(result);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_006: [ If any error occurs, timer_wheel_create shall fail and return NULL. ]*/
+TEST_FUNCTION(when_underlying_calls_fail_timer_wheel_create_fails)
+{
+    // arrange
+    STRICT_EXPECTED_CALL(malloc(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_create(false, "timer_wheel"));
+    STRICT_EXPECTED_CALL(timer_global_get_elapsed_ms())
+        .CallCannotFail();
+    STRICT_EXPECTED_CALL(ThreadAPI_Create(IGNORED_ARG, IGNORED_ARG, IGNORED_ARG));
+
+    umock_c_negative_tests_snapshot();
+
+    for (size_t i = 0; i < umock_c_negative_tests_call_count(); i++)
+    {
+        if (umock_c_negative_tests_can_call_fail(i))
+        {
+            TIMER_WHEEL_HANDLE result;
+
+            umock_c_negative_tests_reset();
+            umock_c_negative_tests_fail_call(i);
+
+            // act
+            result = timer_wheel_create(TEST_TICK_MS);
+
+            // assert
+            ASSERT_IS_NULL(result, "On failed call %zu", i);
+        }
+    }
+}
+
+/* timer_wheel_destroy */
+
+/* Tests_SRS_TIMER_WHEEL_01_008: [ If timer_wheel is NULL, timer_wheel_destroy shall return. ]*/
+TEST_FUNCTION(timer_wheel_destroy_with_NULL_timer_wheel_returns)
+{
+    // act
+    timer_wheel_destroy(NULL);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_009: [ timer_wheel_destroy shall stop the thread of the wheel by setting the stop flag, calling wake_by_address_single and ThreadAPI_Join. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_011: [ timer_wheel_destroy shall destroy the lock by calling srw_lock_destroy and free the memory used by the wheel. ]*/
+TEST_FUNCTION(timer_wheel_destroy_stops_the_thread_and_frees_the_wheel)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(ThreadAPI_Join(test_thread, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(free(timer_wheel));
+
+    // act
+    timer_wheel_destroy(timer_wheel);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_010: [ timer_wheel_destroy shall unlink under the lock the timers that are still scheduled and call their callbacks with is_cancelled set to true after releasing the lock. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_028: [ When the wheel is destroyed the thread of the wheel shall exit and leave the timers that are still scheduled to timer_wheel_destroy. ]*/
+TEST_FUNCTION(timer_wheel_destroy_calls_the_callbacks_of_the_scheduled_timers_as_cancelled)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer_1 = TIMER_WHEEL_TIMER_INITIALIZER;
+    TIMER_WHEEL_TIMER timer_2 = TIMER_WHEEL_TIMER_INITIALIZER;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer_1, 5 * TEST_TICK_MS, test_callback, test_context_1));
+    /*in level 1*/
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer_2, 2 * TIMER_WHEEL_LEVEL_SLOT_COUNT * TEST_TICK_MS, test_callback, test_context_2));
+    umock_c_reset_all_calls();
+
+    setup_stop_expectations();
+    STRICT_EXPECTED_CALL(wake_by_address_single(IGNORED_ARG));
+    STRICT_EXPECTED_CALL(ThreadAPI_Join(test_thread, IGNORED_ARG));
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(test_callback(test_context_1, true));
+    STRICT_EXPECTED_CALL(test_callback(test_context_2, true));
+    STRICT_EXPECTED_CALL(srw_lock_destroy(test_lock));
+    STRICT_EXPECTED_CALL(free(timer_wheel));
+
+    // act
+    test_run_thread();
+    timer_wheel_destroy(timer_wheel);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(timer_1.next);
+    ASSERT_IS_NULL(timer_2.next);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_034: [ If the wheel is being destroyed, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(a_callback_cancelled_by_timer_wheel_destroy_cannot_schedule_its_timer_again)
+{
+    // arrange
+    test_rescheduling_wheel = test_create_wheel();
+    timer_wheel_timer_init(&test_rescheduling_timer);
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(test_rescheduling_wheel, &test_rescheduling_timer, TEST_TICK_MS, test_cancelled_rescheduling_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    // act
+    test_run_thread();
+    timer_wheel_destroy(test_rescheduling_wheel);
+
+    // assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, test_cancelled_schedule_result);
+    ASSERT_IS_NULL(test_rescheduling_timer.next);
+}
+
+/* timer_wheel_timer_init */
+
+/* Tests_SRS_TIMER_WHEEL_01_012: [ If timer is NULL, timer_wheel_timer_init shall return. ]*/
+TEST_FUNCTION(timer_wheel_timer_init_with_NULL_timer_returns)
+{
+    // act
+    timer_wheel_timer_init(NULL);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_013: [ timer_wheel_timer_init shall initialize timer as not scheduled. ]*/
+TEST_FUNCTION(timer_wheel_timer_init_initializes_the_timer_as_not_scheduled)
+{
+    // arrange
+    TIMER_WHEEL_TIMER timer;
+    timer.next = (TIMER_WHEEL_TIMER*)0x1;
+    timer.previous = (TIMER_WHEEL_TIMER*)0x1;
+
+    // act
+    timer_wheel_timer_init(&timer);
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(timer.next);
+    ASSERT_IS_NULL(timer.previous);
+}
+
+/* timer_wheel_schedule */
+
+/* Tests_SRS_TIMER_WHEEL_01_014: [ If timer_wheel is NULL, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(timer_wheel_schedule_with_NULL_timer_wheel_fails)
+{
+    // arrange
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    int result;
+
+    // act
+    result = timer_wheel_schedule(NULL, &timer, TEST_TICK_MS, test_callback, test_context_1);
+
+    // assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_015: [ If timer is NULL, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(timer_wheel_schedule_with_NULL_timer_fails)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    int result;
+
+    // act
+    result = timer_wheel_schedule(timer_wheel, NULL, TEST_TICK_MS, test_callback, test_context_1);
+
+    // assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_016: [ If callback is NULL, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(timer_wheel_schedule_with_NULL_callback_fails)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    int result;
+
+    // act
+    result = timer_wheel_schedule(timer_wheel, &timer, TEST_TICK_MS, NULL, test_context_1);
+
+    // assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(timer.next);
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_017: [ timer_wheel_schedule shall acquire the lock of the wheel by calling srw_lock_acquire_exclusive. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_019: [ timer_wheel_schedule shall compute the expiry tick of timer as the current tick (timer_global_get_elapsed_ms) plus delay_ms rounded up to a whole number of ticks, but not earlier than the first tick that was not processed yet. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_020: [ timer_wheel_schedule shall link timer at the end of the slot for its expiry tick and return 0. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_029: [ timer_wheel_schedule shall release the lock by calling srw_lock_release_exclusive. ]*/
+TEST_FUNCTION(timer_wheel_schedule_succeeds)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    int result;
+
+    test_time = TEST_START_TIME + 3 * TEST_TICK_MS + 1;
+    setup_schedule_expectations();
+
+    // act
+    result = timer_wheel_schedule(timer_wheel, &timer, 2 * TEST_TICK_MS + 1, test_callback, test_context_1);
+
+    // assert
+    ASSERT_ARE_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NOT_NULL(timer.next);
+    ASSERT_ARE_EQUAL(uint64_t, 6, timer.expiry_tick);
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_018: [ If timer is already scheduled, timer_wheel_schedule shall fail and return a non-zero value. ]*/
+TEST_FUNCTION(timer_wheel_schedule_of_a_scheduled_timer_fails)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    int result;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer, TEST_TICK_MS, test_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    setup_schedule_expectations();
+
+    // act
+    result = timer_wheel_schedule(timer_wheel, &timer, 5 * TEST_TICK_MS, test_callback, test_context_2);
+
+    // assert
+    ASSERT_ARE_NOT_EQUAL(int, 0, result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_ARE_EQUAL(uint64_t, 1, timer.expiry_tick);
+    ASSERT_ARE_EQUAL(void_ptr, test_context_1, timer.callback_context);
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* timer_wheel_cancel */
+
+/* Tests_SRS_TIMER_WHEEL_01_021: [ If timer_wheel is NULL, timer_wheel_cancel shall fail and return false. ]*/
+TEST_FUNCTION(timer_wheel_cancel_with_NULL_timer_wheel_fails)
+{
+    // arrange
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    bool result;
+
+    // act
+    result = timer_wheel_cancel(NULL, &timer);
+
+    // assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_022: [ If timer is NULL, timer_wheel_cancel shall fail and return false. ]*/
+TEST_FUNCTION(timer_wheel_cancel_with_NULL_timer_fails)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    bool result;
+
+    // act
+    result = timer_wheel_cancel(timer_wheel, NULL);
+
+    // assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_023: [ If timer is scheduled, timer_wheel_cancel shall unlink it under the lock of the wheel and return true. ]*/
+TEST_FUNCTION(timer_wheel_cancel_of_a_scheduled_timer_unlinks_it)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    bool result;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer, TEST_TICK_MS, test_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    test_add_wait(TEST_START_TIME + 2 * TEST_TICK_MS);
+    setup_process_expectations();
+    setup_stop_expectations();
+
+    // act
+    result = timer_wheel_cancel(timer_wheel, &timer);
+    test_run_thread();
+
+    // assert
+    ASSERT_IS_TRUE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(timer.next);
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_024: [ Otherwise (timer expired or was never scheduled) timer_wheel_cancel shall return false. ]*/
+TEST_FUNCTION(timer_wheel_cancel_of_a_timer_that_is_not_scheduled_returns_false)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    bool result;
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    // act
+    result = timer_wheel_cancel(timer_wheel, &timer);
+
+    // assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_024: [ Otherwise (timer expired or was never scheduled) timer_wheel_cancel shall return false. ]*/
+TEST_FUNCTION(timer_wheel_cancel_of_a_timer_that_fired_returns_false)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    bool result;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer, TEST_TICK_MS, test_callback, test_context_1));
+    test_add_wait(TEST_START_TIME + TEST_TICK_MS);
+    test_run_thread();
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    // act
+    result = timer_wheel_cancel(timer_wheel, &timer);
+
+    // assert
+    ASSERT_IS_FALSE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* thread of the wheel */
+
+/* Tests_SRS_TIMER_WHEEL_01_025: [ The thread of the wheel shall wait at most tick_ms for the wheel to be destroyed by calling InterlockedHL_WaitForValue. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_026: [ Otherwise the thread of the wheel shall compute the current tick by calling timer_global_get_elapsed_ms and, under the lock, process every tick that was not processed yet up to the current tick. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_027: [ The thread of the wheel shall call the callback of every unlinked timer with is_cancelled set to false, in expiry order, after releasing the lock. ]*/
+TEST_FUNCTION(the_thread_of_the_wheel_calls_the_callback_of_an_expired_timer)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer, 2 * TEST_TICK_MS, test_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    test_add_wait(TEST_START_TIME + TEST_TICK_MS);
+    test_add_wait(TEST_START_TIME + 2 * TEST_TICK_MS);
+    setup_process_expectations();
+    setup_process_expectations();
+    STRICT_EXPECTED_CALL(test_callback(test_context_1, false));
+    setup_stop_expectations();
+
+    // act
+    test_run_thread();
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(timer.next);
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_027: [ The thread of the wheel shall call the callback of every unlinked timer with is_cancelled set to false, in expiry order, after releasing the lock. ]*/
+TEST_FUNCTION(the_thread_of_the_wheel_calls_the_callbacks_of_the_timers_of_all_the_elapsed_ticks_in_expiry_order)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer_1 = TIMER_WHEEL_TIMER_INITIALIZER;
+    TIMER_WHEEL_TIMER timer_2 = TIMER_WHEEL_TIMER_INITIALIZER;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer_1, 3 * TEST_TICK_MS, test_callback, test_context_1));
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer_2, TEST_TICK_MS, test_callback, test_context_2));
+    umock_c_reset_all_calls();
+
+    /*the thread was late, both timers expired*/
+    test_add_wait(TEST_START_TIME + 5 * TEST_TICK_MS);
+    setup_process_expectations();
+    STRICT_EXPECTED_CALL(test_callback(test_context_2, false));
+    STRICT_EXPECTED_CALL(test_callback(test_context_1, false));
+    setup_stop_expectations();
+
+    // act
+    test_run_thread();
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_030: [ The slot for a tick shall be in the lowest level level for which the tick is less than TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level + 1 ticks after the first tick that was not processed yet, at the index (tick / TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level) modulo TIMER_WHEEL_LEVEL_SLOT_COUNT. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_032: [ Before processing a tick that is a multiple of TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level, for every level from 1 up, the thread of the wheel shall move the timers of the slot for the tick in level to their slots relative to the tick. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_033: [ The thread of the wheel shall unlink all the timers of the slot for the tick in level 0, they all expire in the tick. ]*/
+TEST_FUNCTION(the_thread_of_the_wheel_fires_a_timer_of_level_1_at_its_expiry_tick)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    /*same index in level 0 as tick 1*/
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer, (TIMER_WHEEL_LEVEL_SLOT_COUNT + 1) * TEST_TICK_MS, test_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    test_add_wait(TEST_START_TIME + 2 * TEST_TICK_MS);
+    test_add_wait(TEST_START_TIME + TIMER_WHEEL_LEVEL_SLOT_COUNT * TEST_TICK_MS);
+    test_add_wait(TEST_START_TIME + (TIMER_WHEEL_LEVEL_SLOT_COUNT + 1) * TEST_TICK_MS);
+    setup_process_expectations();
+    setup_process_expectations();
+    setup_process_expectations();
+    STRICT_EXPECTED_CALL(test_callback(test_context_1, false));
+    setup_stop_expectations();
+
+    // act
+    test_run_thread();
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(timer.next);
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_030: [ The slot for a tick shall be in the lowest level level for which the tick is less than TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level + 1 ticks after the first tick that was not processed yet, at the index (tick / TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level) modulo TIMER_WHEEL_LEVEL_SLOT_COUNT. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_032: [ Before processing a tick that is a multiple of TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level, for every level from 1 up, the thread of the wheel shall move the timers of the slot for the tick in level to their slots relative to the tick. ]*/
+TEST_FUNCTION(the_thread_of_the_wheel_fires_a_timer_of_level_2_at_its_expiry_tick)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer, (TIMER_WHEEL_LEVEL_SLOT_COUNT * TIMER_WHEEL_LEVEL_SLOT_COUNT + 3) * TEST_TICK_MS, test_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    /*the timer moves from level 2 to level 0 at the first tick of its slot, it does not expire before its tick*/
+    test_add_wait(TEST_START_TIME + TIMER_WHEEL_LEVEL_SLOT_COUNT * TEST_TICK_MS);
+    test_add_wait(TEST_START_TIME + (TIMER_WHEEL_LEVEL_SLOT_COUNT * TIMER_WHEEL_LEVEL_SLOT_COUNT + 2) * TEST_TICK_MS);
+    test_add_wait(TEST_START_TIME + (TIMER_WHEEL_LEVEL_SLOT_COUNT * TIMER_WHEEL_LEVEL_SLOT_COUNT + 3) * TEST_TICK_MS);
+    setup_process_expectations();
+    setup_process_expectations();
+    setup_process_expectations();
+    STRICT_EXPECTED_CALL(test_callback(test_context_1, false));
+    setup_stop_expectations();
+
+    // act
+    test_run_thread();
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(timer.next);
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_031: [ A timer that expires TIMER_WHEEL_MAX_TICKS or more ticks after the first tick that was not processed yet shall be linked in the slot for the tick TIMER_WHEEL_MAX_TICKS - 1 ticks after it. ]*/
+TEST_FUNCTION(the_thread_of_the_wheel_fires_a_timer_that_expires_after_TIMER_WHEEL_MAX_TICKS_at_its_expiry_tick)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer, (uint32_t)(TIMER_WHEEL_MAX_TICKS + 5) * TEST_TICK_MS, test_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    test_add_wait(TEST_START_TIME + (double)(TIMER_WHEEL_MAX_TICKS - 1) * TEST_TICK_MS);
+    test_add_wait(TEST_START_TIME + (double)(TIMER_WHEEL_MAX_TICKS + 4) * TEST_TICK_MS);
+    test_add_wait(TEST_START_TIME + (double)(TIMER_WHEEL_MAX_TICKS + 5) * TEST_TICK_MS);
+    setup_process_expectations();
+    setup_process_expectations();
+    setup_process_expectations();
+    STRICT_EXPECTED_CALL(test_callback(test_context_1, false));
+    setup_stop_expectations();
+
+    // act
+    test_run_thread();
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(timer.next);
+    ASSERT_ARE_EQUAL(uint64_t, TIMER_WHEEL_MAX_TICKS + 5, timer.expiry_tick);
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_027: [ The thread of the wheel shall call the callback of every unlinked timer with is_cancelled set to false, in expiry order, after releasing the lock. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_032: [ Before processing a tick that is a multiple of TIMER_WHEEL_LEVEL_SLOT_COUNT to the power level, for every level from 1 up, the thread of the wheel shall move the timers of the slot for the tick in level to their slots relative to the tick. ]*/
+TEST_FUNCTION(the_thread_of_the_wheel_calls_the_callbacks_of_the_timers_of_the_same_slot_of_level_1_in_expiry_order)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer_1 = TIMER_WHEEL_TIMER_INITIALIZER;
+    TIMER_WHEEL_TIMER timer_2 = TIMER_WHEEL_TIMER_INITIALIZER;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer_1, (TIMER_WHEEL_LEVEL_SLOT_COUNT + 6) * TEST_TICK_MS, test_callback, test_context_1));
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer_2, (TIMER_WHEEL_LEVEL_SLOT_COUNT + 1) * TEST_TICK_MS, test_callback, test_context_2));
+    umock_c_reset_all_calls();
+
+    test_add_wait(TEST_START_TIME + 2 * TIMER_WHEEL_LEVEL_SLOT_COUNT * TEST_TICK_MS);
+    setup_process_expectations();
+    STRICT_EXPECTED_CALL(test_callback(test_context_2, false));
+    STRICT_EXPECTED_CALL(test_callback(test_context_1, false));
+    setup_stop_expectations();
+
+    // act
+    test_run_thread();
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_023: [ If timer is scheduled, timer_wheel_cancel shall unlink it under the lock of the wheel and return true. ]*/
+TEST_FUNCTION(timer_wheel_cancel_of_a_timer_of_level_3_unlinks_it)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    bool result;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer, (uint32_t)(TIMER_WHEEL_MAX_TICKS - 1) * TEST_TICK_MS, test_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    STRICT_EXPECTED_CALL(srw_lock_acquire_exclusive(test_lock));
+    STRICT_EXPECTED_CALL(srw_lock_release_exclusive(test_lock));
+
+    // act
+    result = timer_wheel_cancel(timer_wheel, &timer);
+
+    // assert
+    ASSERT_IS_TRUE(result);
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+    ASSERT_IS_NULL(timer.next);
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_019: [ timer_wheel_schedule shall compute the expiry tick of timer as the current tick (timer_global_get_elapsed_ms) plus delay_ms rounded up to a whole number of ticks, but not earlier than the first tick that was not processed yet. ]*/
+/* Tests_SRS_TIMER_WHEEL_01_027: [ The thread of the wheel shall call the callback of every unlinked timer with is_cancelled set to false, in expiry order, after releasing the lock. ]*/
+TEST_FUNCTION(a_callback_can_schedule_its_own_timer_again)
+{
+    // arrange
+    test_rescheduling_wheel = test_create_wheel();
+    timer_wheel_timer_init(&test_rescheduling_timer);
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(test_rescheduling_wheel, &test_rescheduling_timer, TEST_TICK_MS, test_rescheduling_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    test_add_wait(TEST_START_TIME + TEST_TICK_MS);
+    test_add_wait(TEST_START_TIME + 2 * TEST_TICK_MS);
+
+    // act
+    test_run_thread();
+
+    // assert
+    ASSERT_ARE_EQUAL(uint32_t, 2, test_rescheduling_count);
+    ASSERT_IS_NULL(test_rescheduling_timer.next);
+
+    // cleanup
+    timer_wheel_destroy(test_rescheduling_wheel);
+}
+
+/* Tests_SRS_TIMER_WHEEL_01_026: [ Otherwise the thread of the wheel shall compute the current tick by calling timer_global_get_elapsed_ms and, under the lock, process every tick that was not processed yet up to the current tick. ]*/
+TEST_FUNCTION(when_the_wait_fails_the_thread_of_the_wheel_still_processes_the_expired_timers)
+{
+    // arrange
+    TIMER_WHEEL_HANDLE timer_wheel = test_create_wheel();
+    TIMER_WHEEL_TIMER timer = TIMER_WHEEL_TIMER_INITIALIZER;
+    ASSERT_ARE_EQUAL(int, 0, timer_wheel_schedule(timer_wheel, &timer, TEST_TICK_MS, test_callback, test_context_1));
+    umock_c_reset_all_calls();
+
+    test_add_wait(TEST_START_TIME + TEST_TICK_MS);
+    test_wait_returns[0] = INTERLOCKED_HL_ERROR;
+    setup_process_expectations();
+    STRICT_EXPECTED_CALL(test_callback(test_context_1, false));
+    setup_stop_expectations();
+
+    // act
+    test_run_thread();
+
+    // assert
+    ASSERT_ARE_EQUAL(char_ptr, umock_c_get_expected_calls(), umock_c_get_actual_calls());
+
+    // cleanup
+    timer_wheel_destroy(timer_wheel);
+}
+
+END_TEST_SUITE(TEST_SUITE_NAME_FROM_CMAKE)
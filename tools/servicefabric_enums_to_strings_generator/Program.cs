@@ -48,6 +48,46 @@ extern ""C""
 );
         }
 
+        static void writeSfServiceConfigHeaderHeader(StreamWriter outputSfServiceConfigHeaderFile)
+        {
+            outputSfServiceConfigHeaderFile.Write(
+@"// Copyright (C) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+/*THIS FILE IS GENERATED, DO NOT EDIT BY HAND!!!*/
+/*generator is called ""servicefabric_enums_to_strings_generator""*/
+
+#ifndef SERVICEFABRIC_ENUMS_SF_SERVICE_CONFIG_H
+#define SERVICEFABRIC_ENUMS_SF_SERVICE_CONFIG_H
+
+#include ""fabrictypes.h""
+
+#include ""sf_c_util/servicefabric_enums_to_strings.h""
+#include ""sf_c_util/sf_service_config.h""
+
+/*the Service Fabric enums can be the types of sf_service_config configuration values, a value is the name of an enumerator in any case*/
+
+");
+        }
+
+        static void writeSfServiceConfigHeaderFooter(StreamWriter outputSfServiceConfigHeaderFile)
+        {
+            outputSfServiceConfigHeaderFile.Write(
+@"#endif
+"
+);
+        }
+
+        static void writeSfServiceConfigType(StreamWriter outputSfServiceConfigHeaderFile, string enumIdentifier)
+        {
+            outputSfServiceConfigHeaderFile.WriteLine($"#define SF_SERVICE_CONFIG_DO_READ_{enumIdentifier}(config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging) SF_SERVICE_CONFIG_DO_READ_enum({enumIdentifier}, MU_C2({enumIdentifier}, _FromStringCaseInsensitive), config, field_name, parameter_string, result_value, error_occurred_flag, fail_if_null, no_logging)");
+            outputSfServiceConfigHeaderFile.WriteLine($"#define SF_SERVICE_CONFIG_RETURN_TYPE_{enumIdentifier} {enumIdentifier}");
+            outputSfServiceConfigHeaderFile.WriteLine($"#define SF_SERVICE_CONFIG_INIT_RETURN_{enumIdentifier}");
+            outputSfServiceConfigHeaderFile.WriteLine($"#define SF_SERVICE_CONFIG_GETTER_ERROR_{enumIdentifier} SF_SERVICE_CONFIG_GETTER_ERROR_enum({enumIdentifier})");
+            outputSfServiceConfigHeaderFile.WriteLine($"#define SF_SERVICE_CONFIG_GETTER_DO_ASSIGN_{enumIdentifier}(lval, rval) lval = rval");
+            outputSfServiceConfigHeaderFile.WriteLine();
+        }
+
         static void writeSourceHeader(StreamWriter outputHeaderFile)
         {
             outputHeaderFile.Write(
@@ -58,6 +98,9 @@ extern ""C""
 /*generator is called ""servicefabric_enums_to_strings_generator""*/
 
 #include <stddef.h>                          // for NULL, size_t
+#include <stdbool.h>                         // for bool
+#include <stdint.h>                          // for uint32_t, int32_t
+#include <string.h>                          // for strcmp
 
 #include ""macro_utils/macro_utils.h""
 #include ""fabrictypes.h""
@@ -70,70 +113,384 @@ typedef struct SF_ENUM_AND_STRING_TAG
     const char* valueAsString;
 } SF_ENUM_AND_STRING;
 
+/*FNV-1a over the string with the ASCII letters folded to lower case (c | 0x20), so the same perfect hash serves _FromString and _FromStringCaseInsensitive*/
+static uint32_t sf_enum_hash(const char* enumAsString)
+{
+    uint32_t hash = 2166136261U;
+    for (const unsigned char* c = (const unsigned char*)enumAsString; *c != '\0'; c++)
+    {
+        hash ^= (uint32_t)(*c | 0x20);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/*finalizer of MurmurHash3, it spreads the hash of the string differently for every seed*/
+static uint32_t sf_enum_mix(uint32_t hash, uint32_t seed)
+{
+    hash ^= seed * 0x9E3779B9U;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35U;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/*minimal perfect hash built by the generator: the string picks a bucket, the bucket has either the index of its only string (stored as -index-1) or the seed that spreads all its strings to distinct indexes*/
+static size_t sf_enum_perfect_hash(const char* enumAsString, const int32_t* seeds, size_t count)
+{
+    uint32_t hash = sf_enum_hash(enumAsString);
+    int32_t seed = seeds[sf_enum_mix(hash, 0) % count];
+    return (seed < 0) ? (size_t)(-(seed + 1)) : (size_t)(sf_enum_mix(hash, (uint32_t)seed) % count);
+}
+
+static bool sf_enum_equals_case_insensitive(const char* left, const char* right)
+{
+    for (; (*left != '\0') && (*right != '\0'); left++, right++)
+    {
+        unsigned char leftLower = ((*left >= 'A') && (*left <= 'Z')) ? (unsigned char)(*left + ('a' - 'A')) : (unsigned char)*left;
+        unsigned char rightLower = ((*right >= 'A') && (*right <= 'Z')) ? (unsigned char)(*right + ('a' - 'A')) : (unsigned char)*right;
+        if (leftLower != rightLower)
+        {
+            return false;
+        }
+    }
+    return (*left == '\0') && (*right == '\0');
+}
+
 ");
         }
 
+        /*an enumerator is a constant of an enumeration, as in the C standard*/
+        class Enumerator
+        {
+            public string name;
+            public string expression;
+            public int value;
+        }
+
+        /*evaluates the constant expressions that fabrictypes.h uses for enumerators: a number, a previous enumerator or a sum of those (possibly in parenthesis)*/
+        static bool tryEvaluate(string expression, Dictionary<string, int> knownValues, out int value)
+        {
+            expression = expression.Trim();
+            while (expression.StartsWith("(") && expression.EndsWith(")"))
+            {
+                expression = expression.Substring(1, expression.Length - 2).Trim();
+            }
+
+            value = 0;
+            foreach (var term in expression.Split('+'))
+            {
+                var trimmedTerm = term.Trim();
+                int termValue;
+                if (trimmedTerm.StartsWith("0x") || trimmedTerm.StartsWith("0X"))
+                {
+                    uint hexValue;
+                    if (!uint.TryParse(trimmedTerm.Substring(2), System.Globalization.NumberStyles.HexNumber, null, out hexValue))
+                    {
+                        return false;
+                    }
+                    termValue = unchecked((int)hexValue); /*same as the C compiler does for the enumerators that do not fit an int*/
+                }
+                else if (!int.TryParse(trimmedTerm, out termValue) && !knownValues.TryGetValue(trimmedTerm, out termValue))
+                {
+                    return false;
+                }
+                value = unchecked(value + termValue);
+            }
+            return true;
+        }
+
+        /*to string: direct indexing for enums with values that are dense enough, binary search for the others*/
+        static void writeToString(StreamWriter outputSourceFile, string enumIdentifier, List<Enumerator> enumerators)
+        {
+            /*several enumerators can have the same value, the first one gives the string of the value*/
+            var distinctEnumerators = enumerators.GroupBy(e => e.value).Select(g => g.First()).OrderBy(e => e.value).ToList();
+            var first = distinctEnumerators.First();
+            var last = distinctEnumerators.Last();
+            if ((long)last.value - first.value + 1 <= 2 * (long)distinctEnumerators.Count)
+            {
+                /*the index of a string is the value of the enumerator minus the smallest value, so the compiler places the strings, the holes are NULL*/
+                outputSourceFile.WriteLine($"static const char* const {enumIdentifier}_Strings[{last.name} - {first.name} + 1] ={{");
+                foreach (var enumerator in distinctEnumerators)
+                {
+                    outputSourceFile.WriteLine($"[{enumerator.name} - {first.name}] = \"{enumerator.name}\",");
+                }
+                outputSourceFile.WriteLine(@"};");
+
+                outputSourceFile.WriteLine(
+$@"const char* MU_C3(MU_,{enumIdentifier},_ToString)({enumIdentifier} value)
+{{
+    uint32_t index = (uint32_t)value - (uint32_t){first.name};
+    if ((index < sizeof(MU_C2({enumIdentifier}, _Strings))/sizeof(MU_C2({enumIdentifier}, _Strings)[0])) && (MU_C2({enumIdentifier}, _Strings)[index] != NULL))
+    {{
+        return MU_C2({enumIdentifier}, _Strings)[index];
+    }}
+    return ""UNKNOWN"";
+}}
+");
+            }
+            else
+            {
+                outputSourceFile.WriteLine($"static const SF_ENUM_AND_STRING {enumIdentifier}_ValuesAndStrings[] ={{ /*sorted by value*/");
+                foreach (var enumerator in distinctEnumerators)
+                {
+                    outputSourceFile.WriteLine($"{{ {enumerator.name} , \"{enumerator.name}\" }},");
+                }
+                outputSourceFile.WriteLine(@"};");
+
+                outputSourceFile.WriteLine(
+$@"const char* MU_C3(MU_,{enumIdentifier},_ToString)({enumIdentifier} value)
+{{
+    size_t low = 0;
+    size_t high = sizeof(MU_C2({enumIdentifier}, _ValuesAndStrings))/sizeof(MU_C2({enumIdentifier}, _ValuesAndStrings)[0]);
+    while(low < high)
+    {{
+        size_t middle = low + (high - low) / 2;
+        if(MU_C2({enumIdentifier}, _ValuesAndStrings)[middle].value < (int)value)
+        {{
+            low = middle + 1;
+        }}
+        else if(MU_C2({enumIdentifier}, _ValuesAndStrings)[middle].value > (int)value)
+        {{
+            high = middle;
+        }}
+        else
+        {{
+            return MU_C2({enumIdentifier}, _ValuesAndStrings)[middle].valueAsString;
+        }}
+    }}
+    return ""UNKNOWN"";
+}}
+");
+            }
+        }
+
+        /*to string when the values of the enumerators are not known: linear search*/
+        static void writeToStringLinear(StreamWriter outputSourceFile, string enumIdentifier, List<Enumerator> enumerators)
+        {
+            outputSourceFile.WriteLine($"static const SF_ENUM_AND_STRING {enumIdentifier}_ValuesAndStrings[] ={{"); /*by convention, because SF defines "too big" enumerations that are not handled by macro_utils.h*/
+            foreach (var enumerator in enumerators)
+            {
+                outputSourceFile.WriteLine($"{{ {enumerator.name} , \"{enumerator.name}\" }},");
+            }
+            outputSourceFile.WriteLine(@"};");
+
+            outputSourceFile.WriteLine(
+$@"const char* MU_C3(MU_,{enumIdentifier},_ToString)({enumIdentifier} value)
+{{
+    for(size_t i=0;i<sizeof(MU_C2({enumIdentifier}, _ValuesAndStrings))/sizeof(MU_C2({enumIdentifier}, _ValuesAndStrings)[0]);i++)
+    {{
+        if(MU_C2({enumIdentifier}, _ValuesAndStrings)[i].value == (int)value)
+        {{
+            return MU_C2({enumIdentifier}, _ValuesAndStrings)[i].valueAsString;
+        }}
+    }}
+    return ""UNKNOWN"";
+}}
+");
+        }
+
+        /*same as sf_enum_hash in the generated source*/
+        static uint hash(string enumAsString)
+        {
+            unchecked
+            {
+                uint result = 2166136261U;
+                foreach (var c in Encoding.ASCII.GetBytes(enumAsString))
+                {
+                    result ^= (uint)(c | 0x20);
+                    result *= 16777619U;
+                }
+                return result;
+            }
+        }
+
+        /*same as sf_enum_mix in the generated source*/
+        static uint mix(uint hash, uint seed)
+        {
+            unchecked
+            {
+                hash ^= seed * 0x9E3779B9U;
+                hash ^= hash >> 16;
+                hash *= 0x85EBCA6BU;
+                hash ^= hash >> 13;
+                hash *= 0xC2B2AE35U;
+                hash ^= hash >> 16;
+                return hash;
+            }
+        }
+
+        /*builds a minimal perfect hash (hash and displace) of the names: as many buckets as names, the biggest buckets look first for a seed that puts all their names in free slots, the buckets with one name take the remaining slots directly*/
+        static void buildPerfectHash(List<Enumerator> enumerators, int[] seeds, Enumerator[] slots)
+        {
+            var count = enumerators.Count;
+            if (enumerators.GroupBy(e => hash(e.name)).Any(g => g.Count() > 1))
+            {
+                throw new Exception("the names of " + string.Join(", ", enumerators.Select(e => e.name)) + " do not have distinct hashes");
+            }
+            var buckets = enumerators.GroupBy(e => mix(hash(e.name), 0) % (uint)count).OrderByDescending(g => g.Count()).ThenBy(g => g.Key);
+            foreach (var bucket in buckets.Where(b => b.Count() > 1))
+            {
+                int seed = 1;
+                while (true)
+                {
+                    var candidateSlots = bucket.Select(e => mix(hash(e.name), (uint)seed) % (uint)count).ToList();
+                    if ((candidateSlots.Distinct().Count() == candidateSlots.Count) && candidateSlots.All(slot => slots[slot] == null))
+                    {
+                        foreach (var e in bucket.Zip(candidateSlots, (enumerator, slot) => new { enumerator, slot }))
+                        {
+                            slots[e.slot] = e.enumerator;
+                        }
+                        seeds[bucket.Key] = seed;
+                        break;
+                    }
+                    if (seed == int.MaxValue)
+                    {
+                        throw new Exception("cannot build a perfect hash for " + string.Join(", ", bucket.Select(e => e.name)));
+                    }
+                    seed++;
+                }
+            }
+            int freeSlot = 0;
+            foreach (var bucket in buckets.Where(b => b.Count() == 1))
+            {
+                while (slots[freeSlot] != null)
+                {
+                    freeSlot++;
+                }
+                slots[freeSlot] = bucket.First();
+                seeds[bucket.Key] = -freeSlot - 1;
+            }
+        }
+
+        /*from string: minimal perfect hash of the name, then one comparison with the only name that can match*/
+        static void writeFromString(StreamWriter outputSourceFile, string enumIdentifier, List<Enumerator> enumerators)
+        {
+            if (enumerators.GroupBy(e => e.name.ToLowerInvariant()).Any(g => g.Count() > 1))
+            {
+                throw new Exception($"{enumIdentifier} has enumerators that differ only by case, _FromStringCaseInsensitive cannot tell them apart");
+            }
+
+            var seeds = new int[enumerators.Count];
+            var slots = new Enumerator[enumerators.Count];
+            buildPerfectHash(enumerators, seeds, slots);
+
+            outputSourceFile.WriteLine($"static const SF_ENUM_AND_STRING {enumIdentifier}_StringsAndValues[] ={{ /*placed by the perfect hash of the string*/");
+            foreach (var enumerator in slots)
+            {
+                outputSourceFile.WriteLine($"{{ {enumerator.name} , \"{enumerator.name}\" }},");
+            }
+            outputSourceFile.WriteLine(@"};");
+
+            outputSourceFile.WriteLine($"static const int32_t {enumIdentifier}_Seeds[] ={{");
+            for (int i = 0; i < seeds.Length; i += 16)
+            {
+                outputSourceFile.WriteLine(string.Join(" ", seeds.Skip(i).Take(16).Select(seed => $"{seed},")));
+            }
+            outputSourceFile.WriteLine(@"};");
+
+            foreach (var variant in new[] { new { suffix = "_FromString", mismatch = "strcmp(enumAsString, candidate->valueAsString) != 0" }, new { suffix = "_FromStringCaseInsensitive", mismatch = "!sf_enum_equals_case_insensitive(enumAsString, candidate->valueAsString)" } })
+            {
+                outputSourceFile.WriteLine(
+$@"int MU_C2({enumIdentifier}, {variant.suffix})(const char* enumAsString, {enumIdentifier}* destination)
+{{
+    if((enumAsString == NULL) || (destination == NULL))
+    {{
+        return MU_FAILURE;
+    }}
+    const SF_ENUM_AND_STRING* candidate = &MU_C2({enumIdentifier}, _StringsAndValues)[sf_enum_perfect_hash(enumAsString, MU_C2({enumIdentifier}, _Seeds), sizeof(MU_C2({enumIdentifier}, _Seeds))/sizeof(MU_C2({enumIdentifier}, _Seeds)[0]))];
+    if({variant.mismatch})
+    {{
+        return MU_FAILURE;
+    }}
+    *destination = ({enumIdentifier})candidate->value;
+    return 0;
+}}
+");
+            }
+        }
+
         static void Main(string[] args)
         {
             var inputFileName =        @"..\..\..\..\deps\servicefabric\inc\fabrictypes.h";
             var outputHeaderFileName = @"..\..\..\..\inc\sf_c_util\servicefabric_enums_to_strings.h";
             var outputSourceFileName = @"..\..\..\..\src\servicefabric_enums_to_strings.c";
+            var outputSfServiceConfigHeaderFileName = @"..\..\..\..\inc\sf_c_util\servicefabric_enums_sf_service_config.h";
 
             var fileContent = File.ReadAllText(inputFileName);
 
             var outputHeaderFile = File.CreateText(outputHeaderFileName);
             var outputSourceFile = File.CreateText(outputSourceFileName);
+            var outputSfServiceConfigHeaderFile = File.CreateText(outputSfServiceConfigHeaderFileName);
 
             writeHeaderHeader(outputHeaderFile);
             writeSourceHeader(outputSourceFile);
+            writeSfServiceConfigHeaderHeader(outputSfServiceConfigHeaderFile);
 
             /*look for all enums*/
             var pattern = @"enum ([A-Z_a-z0-9]*)\r?\n\s*{\r?\n(([A-Z0-9a-z_\s]*=([A-Z_a-z0-9,(+) \t]*)\r?\n)*)\s*}\s*[A-Z_a-z0-9]*;";
             Regex regex = new Regex(pattern);
             var allEnum = regex.Matches(fileContent);
+            /*values of all the enumerators seen so far, enumerators can be defined in terms of previous ones*/
+            var knownValues = new Dictionary<string, int>();
             foreach (Match someEnum in allEnum)
             {
                 /*enumIdentifier has the same meaning as in C standard*/
                 Group enumIdentifier = someEnum.Groups[1];
 
-                /*declare its stringify function in header*/
+                /*declare its stringify functions in header*/
                 outputHeaderFile.WriteLine($"MU_DECLARE_ENUM_STRINGS({enumIdentifier});");
+                outputHeaderFile.WriteLine($"int MU_C2({enumIdentifier}, _FromString)(const char* enumAsString, {enumIdentifier}* destination);");
+                outputHeaderFile.WriteLine($"int MU_C2({enumIdentifier}, _FromStringCaseInsensitive)(const char* enumAsString, {enumIdentifier}* destination);");
+
+                writeSfServiceConfigType(outputSfServiceConfigHeaderFile, enumIdentifier.Value);
 
                 /*enumeratorList has the same meaning as in C standard*/
                 string enumeratorList = someEnum.Groups[2].Value;
-                outputSourceFile.WriteLine($"static const SF_ENUM_AND_STRING {enumIdentifier}_ValuesAndStrings[] ={{"); /*by convention, because SF defines "too big" enumerations that are not handled by macro_utils.h*/
+
+                var enumerators = new List<Enumerator>();
+                bool allValuesKnown = true;
 
                 /*enumerator has the same meaning as in C standard*/
                 foreach (var enumerator in Regex.Split(enumeratorList, "\r?\n"))
                 {
-                    var enumerationConstant = Regex.Match(enumerator, @"\s*([^\s]*)").Groups[1].Value;
+                    var enumeratorMatch = Regex.Match(enumerator, @"\s*([^\s=]*)\s*=\s*(.*?)\s*,?\s*$");
+                    var enumerationConstant = enumeratorMatch.Groups[1].Value;
                     if (enumerationConstant.Length > 0) /*skip empty lines*/
                     {
-                        outputSourceFile.WriteLine($"{{ {enumerationConstant} , \"{enumerationConstant}\" }},");
+                        var e = new Enumerator { name = enumerationConstant, expression = enumeratorMatch.Groups[2].Value };
+                        if (allValuesKnown && tryEvaluate(e.expression, knownValues, out e.value))
+                        {
+                            knownValues[e.name] = e.value;
+                        }
+                        else
+                        {
+                            allValuesKnown = false;
+                        }
+                        enumerators.Add(e);
                     }
-                    /*copy paste from macro_utils.h*/
                 }
-                outputSourceFile.WriteLine(@"};");
-
-                outputSourceFile.WriteLine(
-$@"const char* MU_C3(MU_,{enumIdentifier},_ToString)({enumIdentifier} value)
-{{
-    for(size_t i=0;i<sizeof(MU_C2({enumIdentifier}, _ValuesAndStrings))/sizeof(MU_C2({enumIdentifier}, _ValuesAndStrings)[0]);i++)
-    {{
-        if(MU_C2({enumIdentifier}, _ValuesAndStrings)[i].value == (int)value)
-        {{
-            return MU_C2({enumIdentifier}, _ValuesAndStrings)[i].valueAsString;
-        }}
-    }}
-    return ""UNKNOWN"";
-}}
-");
 
+                if (allValuesKnown)
+                {
+                    writeToString(outputSourceFile, enumIdentifier.Value, enumerators);
+                }
+                else
+                {
+                    /*the order of the values is not known, so the table cannot be sorted*/
+                    Console.WriteLine($"warning: cannot evaluate all the values of {enumIdentifier}, it will use a linear search for to string");
+                    writeToStringLinear(outputSourceFile, enumIdentifier.Value, enumerators);
+                }
+                writeFromString(outputSourceFile, enumIdentifier.Value, enumerators);
             }
 
             writeHeaderFooter(outputHeaderFile);
             outputHeaderFile.Close();
             outputSourceFile.Close();
+            writeSfServiceConfigHeaderFooter(outputSfServiceConfigHeaderFile);
+            outputSfServiceConfigHeaderFile.Close();
         }
     }
 }